@@ -0,0 +1,361 @@
+// Disk driver for a SATA disk on an AHCI controller, in place
+// of ide.c; see kernelahci in the Makefile.  Uses the first port
+// with a disk attached.
+//
+// The port has up to 32 command slots.  With native command
+// queuing (NCQ), the disk holds a command from every busy slot
+// at once and finishes them in whatever order suits it; without
+// it, one slot is used.  Each command moves up to IDEMAXMERGE
+// bufs for consecutive blocks, merged as in ide.c.  Bufs wait in
+// the queue of iosched.c only while every slot is busy.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iostat.h"
+#include "pci.h"
+
+#define SECTOR_SIZE 512
+
+// HBA registers, from BAR 5.
+#define HBA_CAP     0x00
+#define HBA_GHC     0x04
+#define HBA_IS      0x08
+#define HBA_PI      0x0c
+#define CAP_NCQ     (1<<30)
+#define GHC_AE      0x80000000  // AHCI mode
+#define GHC_IE      (1<<1)    // interrupts on
+
+// Registers of port p.
+#define PORT(p)     (0x100 + (p)*0x80)
+#define P_CLB       0x00      // command list
+#define P_CLBU      0x04
+#define P_FB        0x08      // received FISes
+#define P_FBU       0x0c
+#define P_IS        0x10
+#define P_IE        0x14
+#define P_CMD       0x18
+#define P_TFD       0x20
+#define P_SIG       0x24
+#define P_SSTS      0x28
+#define P_SERR      0x30
+#define P_SACT      0x34
+#define P_CI        0x38
+
+#define CMD_ST      (1<<0)    // in P_CMD
+#define CMD_FRE     (1<<4)
+#define CMD_FR      (1<<14)
+#define CMD_CR      (1<<15)
+#define IS_DHRS     (1<<0)    // in P_IS and P_IE
+#define IS_SDBS     (1<<3)
+#define IS_TFES     (1<<30)
+#define TFD_BSY     0x80
+#define TFD_DRQ     0x08
+#define SIG_ATA     0x00000101
+#define SSTS_PRESENT 3        // in low 4 bits of P_SSTS
+
+#define FIS_H2D     0x27
+#define ATA_RDDMA   0x25      // READ DMA EXT
+#define ATA_WRDMA   0x35      // WRITE DMA EXT
+#define ATA_RDFPDMA 0x60      // READ FPDMA QUEUED
+#define ATA_WRFPDMA 0x61      // WRITE FPDMA QUEUED
+#define ATA_LBA     0x40
+
+#define NSLOT       32
+
+// Entry in the command list.
+struct cmdhdr {
+  ushort flags;   // FIS length in dwords, CH_WRITE
+  ushort prdtl;   // entries in prdt
+  uint prdbc;
+  uint ctba;      // command table
+  uint ctbau;
+  uint reserved[4];
+};
+#define CH_WRITE    (1<<6)
+
+// Must start on a 128-byte boundary; the alignment pads the size
+// so that every entry of tbl[] does.
+struct cmdtbl {
+  uchar cfis[64];
+  uchar acmd[16];
+  uchar reserved[48];
+  struct {
+    uint dba;
+    uint dbau;
+    uint reserved;
+    uint dbc;     // bytes - 1
+  } prdt[IDEMAXMERGE];
+} __attribute__((aligned(128)));
+
+// What the controller reads and writes for the port.
+struct portmem {
+  struct cmdhdr cmd[NSLOT];
+  uchar rfis[256];
+};
+
+static struct spinlock ahcilock;
+static volatile uint *hba;
+static int port;
+static int ncq;
+static int nslot;
+static struct portmem *mem;
+static struct cmdtbl *tbl;
+static struct {
+  struct buf *b;       // bufs, through qnext
+  int n;
+} slot[NSLOT];
+static uint busy;          // slots the disk holds
+static uint ahcireqs;      // commands issued
+static uint ahciblocks;    // blocks they moved
+
+static uint
+rd(int reg)
+{
+  return hba[reg/4];
+}
+
+static void
+wr(int reg, uint v)
+{
+  hba[reg/4] = v;
+}
+
+void
+ideinit(void)
+{
+  struct pcidev d;
+  uint pi, cap;
+  int i;
+
+  initlock(&ahcilock, "ahci");
+  if(pcifind(PCI_STORAGE, PCI_SATA, 0, &d) < 0 || (d.bar[5] & 1) != 0)
+    panic("ahci: no controller");
+  if((d.bar[5] & ~0xf) < DEVSPACE)
+    panic("ahci: registers not mapped");
+  hba = (uint*)(d.bar[5] & ~0xf);
+  pcienable(&d, PCI_CMD_MEM|PCI_CMD_MASTER);
+  wr(HBA_GHC, rd(HBA_GHC) | GHC_AE);
+
+  cap = rd(HBA_CAP);
+  ncq = (cap & CAP_NCQ) != 0;
+  nslot = ncq ? ((cap >> 8) & 0x1f) + 1 : 1;
+  pi = rd(HBA_PI);
+  for(port = 0; port < 32; port++)
+    if((pi & (1<<port)) && (rd(PORT(port)+P_SSTS) & 0xf) == SSTS_PRESENT &&
+       rd(PORT(port)+P_SIG) == SIG_ATA)
+      break;
+  if(port == 32)
+    panic("ahci: no disk");
+
+  // Stop the port while we give it memory.
+  wr(PORT(port)+P_CMD, rd(PORT(port)+P_CMD) & ~CMD_ST);
+  while(rd(PORT(port)+P_CMD) & CMD_CR)
+    ;
+  wr(PORT(port)+P_CMD, rd(PORT(port)+P_CMD) & ~CMD_FRE);
+  while(rd(PORT(port)+P_CMD) & CMD_FR)
+    ;
+
+  mem = ktable(1, sizeof(struct portmem));
+  tbl = ktable(nslot, sizeof(struct cmdtbl));
+  for(i = 0; i < nslot; i++)
+    mem->cmd[i].ctba = V2P(&tbl[i]);
+  wr(PORT(port)+P_CLB, V2P(mem->cmd));
+  wr(PORT(port)+P_CLBU, 0);
+  wr(PORT(port)+P_FB, V2P(mem->rfis));
+  wr(PORT(port)+P_FBU, 0);
+  wr(PORT(port)+P_SERR, ~0);
+  wr(PORT(port)+P_IS, ~0);
+
+  wr(PORT(port)+P_CMD, rd(PORT(port)+P_CMD) | CMD_FRE);
+  while(rd(PORT(port)+P_TFD) & (TFD_BSY|TFD_DRQ))
+    ;
+  wr(PORT(port)+P_CMD, rd(PORT(port)+P_CMD) | CMD_ST);
+
+  if(pciintr(&d, ideintr) < 0)
+    panic("ahci: no irq");
+  wr(PORT(port)+P_IE, IS_DHRS|IS_SDBS|IS_TFES);
+  wr(HBA_IS, ~0);
+  wr(HBA_GHC, rd(HBA_GHC) | GHC_IE);
+  cprintf("ahci: port %d, %d slots%s, irq %d\n", port, nslot,
+          ncq ? " ncq" : "", d.irq);
+}
+
+// Give the disk commands for waiting bufs while slots are free.
+// Caller holds ahcilock.
+static void
+ahcistart(void)
+{
+  struct buf *b, *q;
+  struct cmdtbl *t;
+  uchar *fis;
+  uint lba, nsect;
+  int s, i, n, write;
+
+  for(;;){
+    for(s = 0; s < nslot && (busy & (1<<s)); s++)
+      ;
+    if(s == nslot || (b = iosnext()) == 0)
+      break;
+    if(b->blockno >= FSSIZE + SWAPSIZE)
+      panic("ahci: blockno");
+    n = iosmerge(b, IDEMAXMERGE);
+    ahcireqs++;
+    ahciblocks += n;
+    slot[s].b = b;
+    slot[s].n = n;
+
+    write = (b->flags & B_DIRTY) != 0;
+    lba = b->blockno * (BSIZE/SECTOR_SIZE);
+    nsect = n * (BSIZE/SECTOR_SIZE);
+    t = &tbl[s];
+    fis = t->cfis;
+    memset(fis, 0, 20);
+    fis[0] = FIS_H2D;
+    fis[1] = 0x80;        // a command
+    if(ncq){
+      fis[2] = write ? ATA_WRFPDMA : ATA_RDFPDMA;
+      fis[3] = nsect & 0xff;
+      fis[11] = (nsect >> 8) & 0xff;
+      fis[12] = s << 3;   // tag
+    } else {
+      fis[2] = write ? ATA_WRDMA : ATA_RDDMA;
+      fis[12] = nsect & 0xff;
+      fis[13] = (nsect >> 8) & 0xff;
+    }
+    fis[4] = lba & 0xff;
+    fis[5] = (lba >> 8) & 0xff;
+    fis[6] = (lba >> 16) & 0xff;
+    fis[7] = ATA_LBA;
+    fis[8] = (lba >> 24) & 0xff;
+    for(i = 0, q = b; i < n; i++, q = q->qnext){
+      t->prdt[i].dba = V2P(q->data);
+      t->prdt[i].dbau = 0;
+      t->prdt[i].dbc = BSIZE - 1;
+    }
+    mem->cmd[s].flags = 5 | (write ? CH_WRITE : 0);
+    mem->cmd[s].prdtl = n;
+    mem->cmd[s].prdbc = 0;
+
+    busy |= 1<<s;
+    __sync_synchronize();
+    if(ncq)
+      wr(PORT(port)+P_SACT, 1<<s);
+    wr(PORT(port)+P_CI, 1<<s);
+  }
+}
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+  struct buf *b, *next, *reada;
+  uint is, done;
+  int s, i;
+
+  acquire(&ahcilock);
+  is = rd(PORT(port)+P_IS);
+  wr(PORT(port)+P_IS, is);
+  wr(HBA_IS, 1<<port);
+  if(is & IS_TFES)
+    panic("ahci: disk error");
+
+  // A slot is done when the disk has cleared it in both.
+  done = busy & ~(rd(PORT(port)+P_SACT) | rd(PORT(port)+P_CI));
+  busy &= ~done;
+  reada = 0;
+  for(s = 0; s < nslot; s++){
+    if((done & (1<<s)) == 0)
+      continue;
+    // Wake processes waiting for these bufs.
+    for(i = 0, b = slot[s].b; i < slot[s].n; i++, b = next){
+      next = b->qnext;
+      iosdone(b);
+      b->flags |= B_VALID;
+      b->flags &= ~(B_DIRTY|B_ASYNC);
+      if(b->flags & B_READA){
+        b->flags &= ~B_READA;
+        b->qnext = reada;
+        reada = b;
+      }
+      wakeup(b);
+    }
+    slot[s].b = 0;
+  }
+  ahcistart();
+  release(&ahcilock);
+
+  // No one waits for a read-ahead; release its buffer.
+  for(b = reada; b; b = next){
+    next = b->qnext;
+    bdone(b);
+  }
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once: wait with ideawait(), or
+// if B_READA is set too, ideintr releases the buf.
+void
+iderw(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+  if(b->dev != ROOTDEV)
+    panic("iderw: request not for the ahci disk");
+
+  acquire(&ahcilock);
+  iosadd(b);
+  ahcistart();
+  if(b->flags & B_ASYNC){
+    release(&ahcilock);
+    return;
+  }
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &ahcilock);
+  release(&ahcilock);
+}
+
+// Wait for the disk to finish b, which iderw() started with
+// B_ASYNC set.
+void
+ideawait(struct buf *b)
+{
+  acquire(&ahcilock);
+  while(b->flags & B_ASYNC)
+    sleep(b, &ahcilock);
+  release(&ahcilock);
+}
+
+void
+idestat(struct iostat *st)
+{
+  acquire(&ahcilock);
+  st->diskreqs = ahcireqs;
+  st->diskblocks = ahciblocks;
+  iosstat(st);
+  release(&ahcilock);
+}
+
+// Switch the disk scheduler to policy n; see iosched.c.
+int
+idesched(int n)
+{
+  int old;
+
+  acquire(&ahcilock);
+  old = iosset(n);
+  release(&ahcilock);
+  return old;
+}
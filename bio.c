@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -8,6 +8,8 @@
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
 // * After changing buffer data, call bwrite to write it to disk.
+// * Or call bsubmit to start the write, and bwait before using
+//     or releasing the buffer, to have several writes in flight.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
@@ -17,79 +19,404 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are found through a hash table on (dev, blockno) with
+// a lock per bucket, so lookups of different blocks do not
+// contend.  A bucket's lock protects the chain through hnext and
+// the dev, blockno, refcnt and ref of the buffers on it.
+// Recycling a buffer takes bcache.lock, which serializes
+// evictions and protects the replacement queues below.  Only an
+// evicting process ever holds two bucket locks.
+//
+// The cache starts with NBUF buffers and grows, a page of data
+// at a time, up to BCACHEPCT percent of memory.  Replacement is
+// 2Q, so that one sequential scan cannot flush it:
+// * A new block enters a1in, a FIFO of up to a quarter of the
+//   buffers.  Blocks evicted from a1in are remembered in a1out,
+//   a list of block numbers ("ghosts") without data.
+// * A block read again while it is a ghost goes into am, which
+//   is managed as a clock: a hit sets ref, and the clock hand
+//   gives such buffers a second chance.
+//
+// breada() starts reading a block into the cache without
+// waiting for it, for read-ahead.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
+#include "meminfo.h"
 
-struct {
+#define BPP (PGSIZE/BSIZE)   // buffers per page of data
+
+#define BUCKET(dev, blockno) \
+  (&bcache.bucket[((dev) ^ (blockno)) % bcache.nbucket])
+
+#define Q_NONE 0
+#define Q_A1IN 1
+#define Q_AM   2
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+};
+
+// A block recently evicted from a1in.
+struct ghost {
+  uint dev;
+  uint blockno;   // ~0 if unused
+  int next;       // hash chain, as an index; -1 ends it
+};
+
+struct {
+  struct spinlock lock;   // held while evicting
+  struct bucket *bucket;
+  int nbucket;
+  int nwait;              // processes looking for a buffer to recycle
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  // Protected by lock.
+  int nbuf;               // buffers allocated so far
+  int maxbuf;             // most buffers the cache may have
+  struct buf *free;       // never-used buffers, through hnext
+  struct buf *hdr;        // unused buf headers from a header page
+  int nhdr;
+  struct buf a1in;        // queue heads, through qprev/qnext;
+  struct buf am;          //   head.lnext is the newest
+  int na1in;
+  int nam;
+  struct ghost *ghost;    // a1out: a ring of maxbuf/2 ghosts
+  int *ghead;             // ghost hash chains, nbucket of them
+  int nghost;
+  int ghand;              // next ghost slot to reuse
+
+  // Statistics, updated atomically.
+  uint hits;
+  uint misses;
+  uint writes;
+  uint readaheads;
 } bcache;
 
+static int bgrow(void);
+
+static void
+qinit(struct buf *q)
+{
+  q->lprev = q;
+  q->lnext = q;
+}
+
+static void
+qpush(struct buf *q, struct buf *b)
+{
+  b->lnext = q->lnext;
+  b->lprev = q;
+  q->lnext->lprev = b;
+  q->lnext = b;
+}
+
+static void
+qremove(struct buf *b)
+{
+  b->lnext->lprev = b->lprev;
+  b->lprev->lnext = b->lnext;
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  int i;
 
   initlock(&bcache.lock, "bcache");
+  bcache.maxbuf = phystop / 100 * BCACHEPCT / BSIZE;
+  if(bcache.maxbuf < NBUF)
+    bcache.maxbuf = NBUF;
+  bcache.nbucket = (bcache.maxbuf / 8) | 1;
+  bcache.bucket = ktable(bcache.nbucket, sizeof(struct bucket));
+  for(i = 0; i < bcache.nbucket; i++)
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
 
-//PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  bcache.nghost = bcache.maxbuf / 2;
+  bcache.ghost = ktable(bcache.nghost, sizeof(struct ghost));
+  bcache.ghead = ktable(bcache.nbucket, sizeof(int));
+  for(i = 0; i < bcache.nghost; i++)
+    bcache.ghost[i].blockno = ~0;
+  for(i = 0; i < bcache.nbucket; i++)
+    bcache.ghead[i] = -1;
+
+  qinit(&bcache.a1in);
+  qinit(&bcache.am);
+  while(bcache.nbuf < NBUF)
+    if(bgrow() < 0)
+      panic("binit");
+  cprintf("bcache: %d buffers, up to %d\n", bcache.nbuf, bcache.maxbuf);
+}
+
+// Add BPP buffers to the free list, with data from one new
+// page.  Caller holds bcache.lock, or is binit.  Returns -1 if
+// the cache is at its limit or memory is short.
+static int
+bgrow(void)
+{
+  struct buf *b;
+  char *data;
+  int i;
+
+  if(bcache.nbuf + BPP > bcache.maxbuf)
+    return -1;
+  if(bcache.nhdr < BPP){
+    if((bcache.hdr = (struct buf*)kalloc()) == 0)
+      return -1;
+    ktag((char*)bcache.hdr, KM_BCACHE);
+    memset(bcache.hdr, 0, PGSIZE);
+    bcache.nhdr = PGSIZE / sizeof(struct buf);
+  }
+  if((data = kalloc()) == 0)
+    return -1;
+  ktag(data, KM_BCACHE);
+  for(i = 0; i < BPP; i++){
+    b = bcache.hdr++;
+    bcache.nhdr--;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    b->data = (uchar*)data + i*BSIZE;
+    b->hnext = bcache.free;
+    bcache.free = b;
   }
+  bcache.nbuf += BPP;
+  return 0;
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Remember that block blockno of dev was evicted from a1in.
+static void
+ghostadd(uint dev, uint blockno)
+{
+  struct ghost *g;
+  int *pp;
+
+  g = &bcache.ghost[bcache.ghand];
+  if(g->blockno != ~0){
+    // Forget the oldest ghost, which is in this slot.
+    pp = &bcache.ghead[(g->dev ^ g->blockno) % bcache.nbucket];
+    while(*pp != bcache.ghand)
+      pp = &bcache.ghost[*pp].next;
+    *pp = g->next;
+  }
+  g->dev = dev;
+  g->blockno = blockno;
+  pp = &bcache.ghead[(dev ^ blockno) % bcache.nbucket];
+  g->next = *pp;
+  *pp = bcache.ghand;
+  bcache.ghand = (bcache.ghand + 1) % bcache.nghost;
+}
+
+// If block blockno of dev is a ghost, forget it and return 1.
+static int
+ghostfind(uint dev, uint blockno)
+{
+  struct ghost *g;
+  int *pp;
+
+  pp = &bcache.ghead[(dev ^ blockno) % bcache.nbucket];
+  for(; *pp >= 0; pp = &g->next){
+    g = &bcache.ghost[*pp];
+    if(g->dev == dev && g->blockno == blockno){
+      *pp = g->next;
+      g->blockno = ~0;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Look for block on device dev in bucket bk, which the caller
+// has locked.  If found, take a reference to it.
 static struct buf*
-bget(uint dev, uint blockno)
+bfind(struct bucket *bk, uint dev, uint blockno)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
-
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = bk->head; b != 0; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
       b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      b->ref = 1;
       return b;
     }
   }
+  return 0;
+}
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+// Like bfind, but without taking a reference.
+static struct buf*
+bpeek(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b != 0; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
       return b;
+  return 0;
+}
+
+// Even if refcnt==0, B_DIRTY indicates a buffer is in use
+// because log.c has modified it but not yet committed it.
+// Read without the bucket lock, so only a hint.
+#define UNUSED(b) ((b)->refcnt == 0 && ((b)->flags & B_DIRTY) == 0)
+
+// Pick the oldest unused buffer in a1in.
+static struct buf*
+pick1in(void)
+{
+  struct buf *b;
+
+  for(b = bcache.a1in.lprev; b != &bcache.a1in; b = b->lprev)
+    if(UNUSED(b))
+      return b;
+  return 0;
+}
+
+// Run the clock over am: an unused buffer that has not been
+// hit since the hand last passed is the victim.
+static struct buf*
+pickam(void)
+{
+  struct buf *b;
+  int n;
+
+  for(n = 0; n < 2*bcache.nam; n++){
+    b = bcache.am.lprev;
+    if(b->ref){
+      b->ref = 0;
+      qremove(b);
+      qpush(&bcache.am, b);
+    } else if(UNUSED(b))
+      return b;
+    else {
+      qremove(b);
+      qpush(&bcache.am, b);
     }
   }
-  panic("bget: no buffers");
+  return 0;
+}
+
+// Choose a buffer to recycle, by 2Q.
+static struct buf*
+pick(void)
+{
+  struct buf *b;
+
+  if(bcache.na1in > bcache.nbuf/4 || bcache.nam == 0)
+    if((b = pick1in()) != 0)
+      return b;
+  if((b = pickam()) != 0)
+    return b;
+  return pick1in();
+}
+
+// Recycle a buffer for block blockno on device dev: a never-used
+// one, a new one if the cache may grow, or else an unused one
+// chosen by 2Q.  Called with bcache.lock and bk's lock held,
+// where bk is the block's bucket.  Returns 0 if all buffers
+// are in use.
+static struct buf*
+bevict(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b, **pp;
+  struct bucket *vk;
+
+  if(bcache.free == 0)
+    bgrow();
+  if((b = bcache.free) != 0){
+    bcache.free = b->hnext;
+  } else {
+    for(;;){
+      if((b = pick()) == 0)
+        return 0;
+      vk = BUCKET(b->dev, b->blockno);
+      if(vk != bk)
+        acquire(&vk->lock);
+      if(UNUSED(b))
+        break;
+      // Someone took it meanwhile; choose again.
+      if(vk != bk)
+        release(&vk->lock);
+    }
+    for(pp = &vk->head; *pp != b; pp = &(*pp)->hnext)
+      ;
+    *pp = b->hnext;
+    if(vk != bk)
+      release(&vk->lock);
+    qremove(b);
+    if(b->queue == Q_A1IN){
+      bcache.na1in--;
+      ghostadd(b->dev, b->blockno);
+    } else
+      bcache.nam--;
+  }
+
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  b->ref = 0;
+  b->hnext = bk->head;
+  bk->head = b;
+  if(ghostfind(dev, blockno)){
+    b->queue = Q_AM;
+    qpush(&bcache.am, b);
+    bcache.nam++;
+  } else {
+    b->queue = Q_A1IN;
+    qpush(&bcache.a1in, b);
+    bcache.na1in++;
+  }
+  return b;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = BUCKET(dev, blockno);
+
+  // Is the block already cached?
+  acquire(&bk->lock);
+  b = bfind(bk, dev, blockno);
+  release(&bk->lock);
+  if(b){
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Not cached; recycle a buffer.  nwait goes up before the
+  // scan, so a brelse() that the scan misses will wake us.
+  acquire(&bcache.lock);
+  bcache.nwait++;
+  for(;;){
+    // Look again: another process may have read the block in
+    // while no lock was held.
+    acquire(&bk->lock);
+    if((b = bfind(bk, dev, blockno)) == 0)
+      b = bevict(bk, dev, blockno);
+    release(&bk->lock);
+    if(b)
+      break;
+    // All buffers are in use.  Wait for brelse() to free one.
+    sleep(&bcache, &bcache.lock);
+  }
+  bcache.nwait--;
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -100,11 +427,50 @@ bread(uint dev, uint blockno)
 
   b = bget(dev, blockno);
   if((b->flags & B_VALID) == 0) {
+    __sync_fetch_and_add(&bcache.misses, 1);
     iderw(b);
-  }
+  } else
+    __sync_fetch_and_add(&bcache.hits, 1);
   return b;
 }
 
+// Start reading block blockno of dev into the cache, unless it
+// is there already, and return without waiting.  The disk
+// driver calls bdone() when the read completes.  Gives up
+// rather than wait for a buffer.  Returns 1 if a read started.
+int
+breada(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = BUCKET(dev, blockno);
+  acquire(&bk->lock);
+  b = bpeek(bk, dev, blockno);
+  release(&bk->lock);
+  if(b)
+    return 0;
+
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  if(bpeek(bk, dev, blockno) == 0)
+    b = bevict(bk, dev, blockno);
+  release(&bk->lock);
+  release(&bcache.lock);
+  if(b == 0)
+    return 0;
+  acquiresleep(&b->lock);
+  if(b->flags & B_VALID){
+    // Someone else read it meanwhile.
+    brelse(b);
+    return 0;
+  }
+  __sync_fetch_and_add(&bcache.readaheads, 1);
+  b->flags |= B_ASYNC|B_READA;
+  iderw(b);
+  return 1;
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -112,31 +478,108 @@ bwrite(struct buf *b)
   if(!holdingsleep(&b->lock))
     panic("bwrite");
   b->flags |= B_DIRTY;
+  __sync_fetch_and_add(&bcache.writes, 1);
+  iderw(b);
+}
+
+// Start writing b's contents to disk and return without waiting.
+// Must be locked, and stays locked: call bwait() before using b
+// again or releasing it.  Lets a caller have many writes in flight.
+void
+bsubmit(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bsubmit");
+  b->flags |= B_DIRTY|B_ASYNC;
+  __sync_fetch_and_add(&bcache.writes, 1);
   iderw(b);
 }
 
+// Wait for the write bsubmit() started on b to finish.
+void
+bwait(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bwait");
+  ideawait(b);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("brelse");
+  bdone(b);
+}
+
+// Release b for whoever locked it: the caller of brelse(), or
+// the disk driver, perhaps in an interrupt, when a read started
+// by breada() is done.
+void
+bdone(struct buf *b)
+{
+  struct bucket *bk;
+  int unused;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = BUCKET(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  unused = b->refcnt == 0;
+  release(&bk->lock);
+
+  if(unused && bcache.nwait > 0){
+    acquire(&bcache.lock);
+    wakeup(&bcache);
+    release(&bcache.lock);
+  }
+}
+
+// Forget every cached block that no one is using and that is
+// not waiting to be written, so that the next reads of those
+// blocks go to the disk.  For benchmarks.
+void
+bdrop(void)
+{
+  struct bucket *bk;
+  struct buf *b, **pp;
+
+  acquire(&bcache.lock);
+  for(bk = bcache.bucket; bk < &bcache.bucket[bcache.nbucket]; bk++){
+    acquire(&bk->lock);
+    for(pp = &bk->head; (b = *pp) != 0; ){
+      if(b->refcnt != 0 || (b->flags & B_DIRTY)){
+        pp = &b->hnext;
+        continue;
+      }
+      *pp = b->hnext;
+      qremove(b);
+      if(b->queue == Q_A1IN)
+        bcache.na1in--;
+      else
+        bcache.nam--;
+      b->queue = Q_NONE;
+      b->flags = 0;
+      b->hnext = bcache.free;
+      bcache.free = b;
+    }
+    release(&bk->lock);
   }
-  
+  release(&bcache.lock);
+}
+
+void
+bstat(struct iostat *st)
+{
+  acquire(&bcache.lock);
+  st->nbuf = bcache.nbuf;
+  st->maxbuf = bcache.maxbuf;
+  st->hits = bcache.hits;
+  st->misses = bcache.misses;
+  st->writes = bcache.writes;
+  st->readaheads = bcache.readaheads;
   release(&bcache.lock);
 }
 //PAGEBREAK!
@@ -0,0 +1,79 @@
+// Measure buffer cache throughput as readers are added: 1, 2, 4
+// and 8 processes each read their own small file over and over.
+// The files stay cached, so every read is a buffer cache hit and
+// the time goes to bget() and brelse().  Run with CPUS > 1 to see
+// whether hits on different blocks proceed in parallel.
+
+#include "types.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define FSIZE  (8*512)
+#define PASSES 200
+#define MAXP   8
+
+char buf[512];
+
+static void
+name(char *s, int i)
+{
+  strcpy(s, "biobench.0");
+  s[9] = '0' + i;
+}
+
+static void
+reader(int i)
+{
+  char path[16];
+  int fd, pass;
+
+  name(path, i);
+  for(pass = 0; pass < PASSES; pass++){
+    if((fd = open(path, O_RDONLY)) < 0){
+      printf(2, "biobench: cannot open %s\n", path);
+      exit();
+    }
+    while(read(fd, buf, sizeof(buf)) > 0)
+      ;
+    close(fd);
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  char path[16];
+  int fd, i, n, t, kb;
+
+  for(i = 0; i < MAXP; i++){
+    name(path, i);
+    if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+      printf(2, "biobench: cannot create %s\n", path);
+      exit();
+    }
+    for(n = 0; n < FSIZE; n += sizeof(buf))
+      write(fd, buf, sizeof(buf));
+    close(fd);
+  }
+
+  for(n = 1; n <= MAXP; n *= 2){
+    t = uptime();
+    for(i = 0; i < n; i++)
+      if(fork() == 0)
+        reader(i);
+    for(i = 0; i < n; i++)
+      wait();
+    t = uptime() - t;
+    if(t == 0)
+      t = 1;
+    kb = n * PASSES * (FSIZE / 1024);
+    printf(1, "%d readers: %d KB in %d ms, %d KB/s\n", n, kb, t, kb * 1000 / t);
+  }
+
+  for(i = 0; i < MAXP; i++){
+    name(path, i);
+    unlink(path);
+  }
+  exit();
+}
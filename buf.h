@@ -4,11 +4,21 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
-  struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  struct buf *hnext; // hash bucket chain
+  struct buf *lprev; // replacement queue (see bio.c)
+  struct buf *lnext;
+  int queue;         // which replacement queue
+  int ref;           // hit since the clock hand passed
+  struct buf *qnext; // disk queue (see iosched.c)
+  struct buf *qprev;
+  struct buf *fnext; // disk queue in arrival order
+  struct buf *fprev;
+  uint qtick;        // when queued, in ticks
+  uint qtsc;         //   and in Kcycles
+  uchar *data;       // BSIZE bytes
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // disk I/O started without waiting, not yet done
+#define B_READA 0x10 // read-ahead: release buffer when the read is done
 
@@ -0,0 +1,1750 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 d4 03 00 00       	call   41b <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 d8 03 00 00       	call   433 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 5b 0b 00 00       	push   $0xb5b
+  6c:	6a 01                	push   $0x1
+  6e:	e8 7d 05 00 00       	call   5f0 <printf>
+      exit();
+  73:	e8 7b 03 00 00       	call   3f3 <exit>
+  }
+  exit();
+  78:	e8 76 03 00 00       	call   3f3 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 67 03 00 00       	call   3f3 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 c0 0f 00 00       	push   $0xfc0
+  a9:	6a 01                	push   $0x1
+  ab:	e8 63 03 00 00       	call   413 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 c0 0f 00 00       	push   $0xfc0
+  c4:	56                   	push   %esi
+  c5:	e8 41 03 00 00       	call   40b <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 38 0b 00 00       	push   $0xb38
+  e4:	6a 01                	push   $0x1
+  e6:	e8 05 05 00 00       	call   5f0 <printf>
+      exit();
+  eb:	e8 03 03 00 00       	call   3f3 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 4a 0b 00 00       	push   $0xb4a
+  f7:	6a 01                	push   $0x1
+  f9:	e8 f2 04 00 00       	call   5f0 <printf>
+    exit();
+  fe:	e8 f0 02 00 00       	call   3f3 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 be 01 00 00       	call   40b <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 91 01 00 00       	call   433 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 94 01 00 00       	call   44b <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 5a 01 00 00       	call   41b <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	56                   	push   %esi
+ 2e4:	53                   	push   %ebx
+ 2e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2e8:	0f b6 02             	movzbl (%edx),%eax
+ 2eb:	3c 20                	cmp    $0x20,%al
+ 2ed:	75 0c                	jne    2fb <atoi+0x1b>
+ 2ef:	90                   	nop
+ 2f0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2f4:	83 c2 01             	add    $0x1,%edx
+ 2f7:	3c 20                	cmp    $0x20,%al
+ 2f9:	74 f5                	je     2f0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2fb:	3c 2d                	cmp    $0x2d,%al
+ 2fd:	74 41                	je     340 <atoi+0x60>
+ 2ff:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 304:	3c 2b                	cmp    $0x2b,%al
+ 306:	74 3d                	je     345 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 308:	0f be 0a             	movsbl (%edx),%ecx
+ 30b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 30e:	3c 09                	cmp    $0x9,%al
+ 310:	b8 00 00 00 00       	mov    $0x0,%eax
+ 315:	77 21                	ja     338 <atoi+0x58>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 320:	83 c2 01             	add    $0x1,%edx
+ 323:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 326:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 32a:	0f be 0a             	movsbl (%edx),%ecx
+ 32d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 330:	80 fb 09             	cmp    $0x9,%bl
+ 333:	76 eb                	jbe    320 <atoi+0x40>
+  return sign*n;
+ 335:	0f af c6             	imul   %esi,%eax
+}
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5d                   	pop    %ebp
+ 33b:	c3                   	ret
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 345:	83 c2 01             	add    $0x1,%edx
+ 348:	eb be                	jmp    308 <atoi+0x28>
+ 34a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000350 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+ 355:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 358:	0f b6 02             	movzbl (%edx),%eax
+ 35b:	3c 20                	cmp    $0x20,%al
+ 35d:	75 0c                	jne    36b <atoo+0x1b>
+ 35f:	90                   	nop
+ 360:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 364:	83 c2 01             	add    $0x1,%edx
+ 367:	3c 20                	cmp    $0x20,%al
+ 369:	74 f5                	je     360 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 36b:	3c 2d                	cmp    $0x2d,%al
+ 36d:	74 41                	je     3b0 <atoo+0x60>
+ 36f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 374:	3c 2b                	cmp    $0x2b,%al
+ 376:	74 3d                	je     3b5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 378:	0f be 0a             	movsbl (%edx),%ecx
+ 37b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 37e:	3c 07                	cmp    $0x7,%al
+ 380:	b8 00 00 00 00       	mov    $0x0,%eax
+ 385:	77 1e                	ja     3a5 <atoo+0x55>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 390:	83 c2 01             	add    $0x1,%edx
+ 393:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 397:	0f be 0a             	movsbl (%edx),%ecx
+ 39a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 39d:	80 fb 07             	cmp    $0x7,%bl
+ 3a0:	76 ee                	jbe    390 <atoo+0x40>
+  return sign*n;
+ 3a2:	0f af c6             	imul   %esi,%eax
+}
+ 3a5:	5b                   	pop    %ebx
+ 3a6:	5e                   	pop    %esi
+ 3a7:	5d                   	pop    %ebp
+ 3a8:	c3                   	ret
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 3b5:	83 c2 01             	add    $0x1,%edx
+ 3b8:	eb be                	jmp    378 <atoo+0x28>
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003c0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ce:	85 c0                	test   %eax,%eax
+ 3d0:	7e 13                	jle    3e5 <memmove+0x25>
+ 3d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3d4:	89 d7                	mov    %edx,%edi
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3e1:	39 f8                	cmp    %edi,%eax
+ 3e3:	75 fb                	jne    3e0 <memmove+0x20>
+  return vdst;
+}
+ 3e5:	5e                   	pop    %esi
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	5f                   	pop    %edi
+ 3e9:	5d                   	pop    %ebp
+ 3ea:	c3                   	ret
+
+000003eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3eb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <exit>:
+SYSCALL(exit)
+ 3f3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <wait>:
+SYSCALL(wait)
+ 3fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <pipe>:
+SYSCALL(pipe)
+ 403:	b8 04 00 00 00       	mov    $0x4,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <read>:
+SYSCALL(read)
+ 40b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <write>:
+SYSCALL(write)
+ 413:	b8 10 00 00 00       	mov    $0x10,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <close>:
+SYSCALL(close)
+ 41b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <kill>:
+SYSCALL(kill)
+ 423:	b8 06 00 00 00       	mov    $0x6,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <exec>:
+SYSCALL(exec)
+ 42b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <open>:
+SYSCALL(open)
+ 433:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mknod>:
+SYSCALL(mknod)
+ 43b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <unlink>:
+SYSCALL(unlink)
+ 443:	b8 12 00 00 00       	mov    $0x12,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <fstat>:
+SYSCALL(fstat)
+ 44b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <link>:
+SYSCALL(link)
+ 453:	b8 13 00 00 00       	mov    $0x13,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mkdir>:
+SYSCALL(mkdir)
+ 45b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <chdir>:
+SYSCALL(chdir)
+ 463:	b8 09 00 00 00       	mov    $0x9,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <dup>:
+SYSCALL(dup)
+ 46b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getpid>:
+SYSCALL(getpid)
+ 473:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <sbrk>:
+SYSCALL(sbrk)
+ 47b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <sleep>:
+SYSCALL(sleep)
+ 483:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <uptime>:
+SYSCALL(uptime)
+ 48b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <superpages>:
+SYSCALL(superpages)
+ 493:	b8 23 00 00 00       	mov    $0x23,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mmap>:
+SYSCALL(mmap)
+ 49b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <munmap>:
+SYSCALL(munmap)
+ 4a3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <spawn>:
+SYSCALL(spawn)
+ 4ab:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <swapstat>:
+SYSCALL(swapstat)
+ 4b3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getmeminfo>:
+SYSCALL(getmeminfo)
+ 4bb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <iostat>:
+SYSCALL(iostat)
+ 4c3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <dropcache>:
+SYSCALL(dropcache)
+ 4cb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <iosched>:
+SYSCALL(iosched)
+ 4d3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <halt>:
+SYSCALL(halt)
+ 4db:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <date>:
+SYSCALL(date)
+ 4e3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 4eb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getgid>:
+SYSCALL(getgid)
+ 4f3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <getppid>:
+SYSCALL(getppid)
+ 4fb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <setuid>:
+SYSCALL(setuid)
+ 503:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <setgid>:
+SYSCALL(setgid)
+ 50b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <getprocs>:
+SYSCALL(getprocs)
+ 513:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 51b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getpriority>:
+SYSCALL(getpriority)
+ 523:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 52b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chown>:
+SYSCALL(chown)
+ 533:	b8 21 00 00 00       	mov    $0x21,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <chgrp>:
+SYSCALL(chgrp)
+ 53b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+ 543:	66 90                	xchg   %ax,%ax
+ 545:	66 90                	xchg   %ax,%ax
+ 547:	66 90                	xchg   %ax,%ax
+ 549:	66 90                	xchg   %ax,%ax
+ 54b:	66 90                	xchg   %ax,%ax
+ 54d:	66 90                	xchg   %ax,%ax
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 d0 0b 00 00 	movzbl 0xbd0(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 46 fe ff ff       	call   413 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 dc fd ff ff       	call   413 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 78 0b 00 00 	jmp    *0xb78(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 7d fd ff ff       	call   413 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 6b fd ff ff       	call   413 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 f1 fc ff ff       	call   413 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 a1 fc ff ff       	call   413 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb 70 0b 00 00       	mov    $0xb70,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a3:	a1 e4 11 00 00       	mov    0x11e4,%eax
+{
+ 7a8:	89 e5                	mov    %esp,%ebp
+ 7aa:	56                   	push   %esi
+ 7ab:	53                   	push   %ebx
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7b2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b4:	39 ca                	cmp    %ecx,%edx
+ 7b6:	73 30                	jae    7e8 <lfree+0x48>
+ 7b8:	39 c1                	cmp    %eax,%ecx
+ 7ba:	72 04                	jb     7c0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7bc:	39 c2                	cmp    %eax,%edx
+ 7be:	72 f0                	jb     7b0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7c0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 7c3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 7c6:	39 f0                	cmp    %esi,%eax
+ 7c8:	74 26                	je     7f0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7ca:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7d2:	39 d9                	cmp    %ebx,%ecx
+ 7d4:	74 30                	je     806 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7d6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7d8:	5b                   	pop    %ebx
+  freep = p;
+ 7d9:	89 15 e4 11 00 00    	mov    %edx,0x11e4
+}
+ 7df:	5e                   	pop    %esi
+ 7e0:	5d                   	pop    %ebp
+ 7e1:	c3                   	ret
+ 7e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7e8:	39 c1                	cmp    %eax,%ecx
+ 7ea:	72 d0                	jb     7bc <lfree+0x1c>
+ 7ec:	eb c2                	jmp    7b0 <lfree+0x10>
+ 7ee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 7f0:	03 58 04             	add    0x4(%eax),%ebx
+ 7f3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7f6:	8b 02                	mov    (%edx),%eax
+ 7f8:	8b 00                	mov    (%eax),%eax
+ 7fa:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 7fc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7ff:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 802:	39 d9                	cmp    %ebx,%ecx
+ 804:	75 d0                	jne    7d6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 806:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 809:	89 15 e4 11 00 00    	mov    %edx,0x11e4
+    p->s.size += bp->s.size;
+ 80f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 812:	8b 09                	mov    (%ecx),%ecx
+ 814:	89 0a                	mov    %ecx,(%edx)
+}
+ 816:	5b                   	pop    %ebx
+ 817:	5e                   	pop    %esi
+ 818:	5d                   	pop    %ebp
+ 819:	c3                   	ret
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000820 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	89 c7                	mov    %eax,%edi
+ 826:	56                   	push   %esi
+ 827:	53                   	push   %ebx
+ 828:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 82b:	a1 e4 11 00 00       	mov    0x11e4,%eax
+ 830:	85 c0                	test   %eax,%eax
+ 832:	0f 84 88 00 00 00    	je     8c0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 838:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 83a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 83d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 842:	39 df                	cmp    %ebx,%edi
+ 844:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 847:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 84e:	39 f9                	cmp    %edi,%ecx
+ 850:	72 0f                	jb     861 <lalloc+0x41>
+ 852:	eb 4c                	jmp    8a0 <lalloc+0x80>
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 858:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 85a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 85d:	39 f9                	cmp    %edi,%ecx
+ 85f:	73 3f                	jae    8a0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 861:	89 d0                	mov    %edx,%eax
+ 863:	39 15 e4 11 00 00    	cmp    %edx,0x11e4
+ 869:	75 ed                	jne    858 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 86b:	83 ec 0c             	sub    $0xc,%esp
+ 86e:	56                   	push   %esi
+ 86f:	e8 07 fc ff ff       	call   47b <sbrk>
+  if(p == (char*)-1)
+ 874:	83 c4 10             	add    $0x10,%esp
+ 877:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 87a:	74 11                	je     88d <lalloc+0x6d>
+  hp->s.size = nu;
+ 87c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 87f:	e8 1c ff ff ff       	call   7a0 <lfree>
+  return freep;
+ 884:	a1 e4 11 00 00       	mov    0x11e4,%eax
+      if((p = morecore(nunits)) == 0)
+ 889:	85 c0                	test   %eax,%eax
+ 88b:	75 cb                	jne    858 <lalloc+0x38>
+        return 0;
+  }
+}
+ 88d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 890:	31 d2                	xor    %edx,%edx
+}
+ 892:	5b                   	pop    %ebx
+ 893:	89 d0                	mov    %edx,%eax
+ 895:	5e                   	pop    %esi
+ 896:	5f                   	pop    %edi
+ 897:	5d                   	pop    %ebp
+ 898:	c3                   	ret
+ 899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 8a0:	39 cf                	cmp    %ecx,%edi
+ 8a2:	74 4c                	je     8f0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 8a4:	29 f9                	sub    %edi,%ecx
+ 8a6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 8a9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 8ac:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 8af:	a3 e4 11 00 00       	mov    %eax,0x11e4
+}
+ 8b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b7:	89 d0                	mov    %edx,%eax
+ 8b9:	5b                   	pop    %ebx
+ 8ba:	5e                   	pop    %esi
+ 8bb:	5f                   	pop    %edi
+ 8bc:	5d                   	pop    %ebp
+ 8bd:	c3                   	ret
+ 8be:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 8c0:	ba e8 11 00 00       	mov    $0x11e8,%edx
+ 8c5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 8c7:	c7 05 e4 11 00 00 e8 	movl   $0x11e8,0x11e4
+ 8ce:	11 00 00 
+ 8d1:	c7 05 e8 11 00 00 e8 	movl   $0x11e8,0x11e8
+ 8d8:	11 00 00 
+ 8db:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 8dd:	c7 05 ec 11 00 00 00 	movl   $0x0,0x11ec
+ 8e4:	00 00 00 
+ 8e7:	e9 51 ff ff ff       	jmp    83d <lalloc+0x1d>
+ 8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 8f0:	8b 0a                	mov    (%edx),%ecx
+ 8f2:	89 08                	mov    %ecx,(%eax)
+ 8f4:	eb b9                	jmp    8af <lalloc+0x8f>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 909:	85 f6                	test   %esi,%esi
+ 90b:	74 42                	je     94f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 90d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 910:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 913:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 919:	77 3d                	ja     958 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 91b:	31 c9                	xor    %ecx,%ecx
+ 91d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 922:	83 fa 02             	cmp    $0x2,%edx
+ 925:	74 17                	je     93e <free+0x3e>
+ 927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92e:	66 90                	xchg   %ax,%ax
+ 930:	83 c1 01             	add    $0x1,%ecx
+ 933:	89 d8                	mov    %ebx,%eax
+ 935:	d3 e0                	shl    %cl,%eax
+ 937:	83 c0 01             	add    $0x1,%eax
+ 93a:	39 c2                	cmp    %eax,%edx
+ 93c:	75 f2                	jne    930 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 93e:	8b 04 8d c0 11 00 00 	mov    0x11c0(,%ecx,4),%eax
+  classes[c] = bp;
+ 945:	89 3c 8d c0 11 00 00 	mov    %edi,0x11c0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 94c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 94f:	5b                   	pop    %ebx
+ 950:	5e                   	pop    %esi
+ 951:	5f                   	pop    %edi
+ 952:	5d                   	pop    %ebp
+ 953:	c3                   	ret
+ 954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 958:	5b                   	pop    %ebx
+    lfree(bp);
+ 959:	89 f8                	mov    %edi,%eax
+}
+ 95b:	5e                   	pop    %esi
+ 95c:	5f                   	pop    %edi
+ 95d:	5d                   	pop    %ebp
+    lfree(bp);
+ 95e:	e9 3d fe ff ff       	jmp    7a0 <lfree>
+ 963:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000970 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 979:	8b 45 08             	mov    0x8(%ebp),%eax
+ 97c:	83 c0 07             	add    $0x7,%eax
+ 97f:	c1 e8 03             	shr    $0x3,%eax
+ 982:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 985:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 98a:	77 44                	ja     9d0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 98c:	31 c9                	xor    %ecx,%ecx
+ 98e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 993:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 998:	83 f8 02             	cmp    $0x2,%eax
+ 99b:	76 11                	jbe    9ae <malloc+0x3e>
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+ 9a0:	83 c1 01             	add    $0x1,%ecx
+ 9a3:	89 d3                	mov    %edx,%ebx
+ 9a5:	d3 e3                	shl    %cl,%ebx
+ 9a7:	83 c3 01             	add    $0x1,%ebx
+ 9aa:	39 c3                	cmp    %eax,%ebx
+ 9ac:	72 f2                	jb     9a0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 9ae:	8b 04 8d c0 11 00 00 	mov    0x11c0(,%ecx,4),%eax
+ 9b5:	85 c0                	test   %eax,%eax
+ 9b7:	74 2f                	je     9e8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 9b9:	8b 10                	mov    (%eax),%edx
+ 9bb:	89 14 8d c0 11 00 00 	mov    %edx,0x11c0(,%ecx,4)
+  return (void*)(p + 1);
+ 9c2:	83 c0 08             	add    $0x8,%eax
+}
+ 9c5:	83 c4 1c             	add    $0x1c,%esp
+ 9c8:	5b                   	pop    %ebx
+ 9c9:	5e                   	pop    %esi
+ 9ca:	5f                   	pop    %edi
+ 9cb:	5d                   	pop    %ebp
+ 9cc:	c3                   	ret
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 9d0:	e8 4b fe ff ff       	call   820 <lalloc>
+ 9d5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 9d7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 9da:	85 d2                	test   %edx,%edx
+ 9dc:	75 e7                	jne    9c5 <malloc+0x55>
+      return 0;
+ 9de:	31 c0                	xor    %eax,%eax
+ 9e0:	eb e3                	jmp    9c5 <malloc+0x55>
+ 9e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 9e8:	31 d2                	xor    %edx,%edx
+ 9ea:	b8 00 02 00 00       	mov    $0x200,%eax
+ 9ef:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9f2:	f7 f3                	div    %ebx
+  if(n < 4)
+ 9f4:	ba 04 00 00 00       	mov    $0x4,%edx
+ 9f9:	89 d6                	mov    %edx,%esi
+ 9fb:	39 d0                	cmp    %edx,%eax
+ 9fd:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ a00:	0f af f3             	imul   %ebx,%esi
+ a03:	89 f0                	mov    %esi,%eax
+ a05:	e8 16 fe ff ff       	call   820 <lalloc>
+ a0a:	85 c0                	test   %eax,%eax
+ a0c:	74 d0                	je     9de <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ a0e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a11:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ a14:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a1b:	8b 14 8d c0 11 00 00 	mov    0x11c0(,%ecx,4),%edx
+ a22:	39 f8                	cmp    %edi,%eax
+ a24:	73 22                	jae    a48 <malloc+0xd8>
+ a26:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a29:	eb 09                	jmp    a34 <malloc+0xc4>
+ a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+ a30:	89 c2                	mov    %eax,%edx
+ a32:	89 c8                	mov    %ecx,%eax
+ a34:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ a37:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ a3a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ a3c:	39 f9                	cmp    %edi,%ecx
+ a3e:	72 f0                	jb     a30 <malloc+0xc0>
+ a40:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a43:	e9 73 ff ff ff       	jmp    9bb <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ a48:	89 d0                	mov    %edx,%eax
+ a4a:	8b 12                	mov    (%edx),%edx
+ a4c:	e9 6a ff ff ff       	jmp    9bb <malloc+0x4b>
+ a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+
+00000a60 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	56                   	push   %esi
+ a64:	53                   	push   %ebx
+ a65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a68:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ a6b:	85 c9                	test   %ecx,%ecx
+ a6d:	74 06                	je     a75 <calloc+0x15>
+ a6f:	89 c8                	mov    %ecx,%eax
+ a71:	f7 e3                	mul    %ebx
+ a73:	70 33                	jo     aa8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ a75:	0f af d9             	imul   %ecx,%ebx
+ a78:	83 ec 0c             	sub    $0xc,%esp
+ a7b:	53                   	push   %ebx
+ a7c:	e8 ef fe ff ff       	call   970 <malloc>
+ a81:	83 c4 10             	add    $0x10,%esp
+ a84:	89 c6                	mov    %eax,%esi
+ a86:	85 c0                	test   %eax,%eax
+ a88:	74 1e                	je     aa8 <calloc+0x48>
+    memset(p, 0, n * size);
+ a8a:	83 ec 04             	sub    $0x4,%esp
+ a8d:	53                   	push   %ebx
+ a8e:	6a 00                	push   $0x0
+ a90:	50                   	push   %eax
+ a91:	e8 3a f7 ff ff       	call   1d0 <memset>
+ a96:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ a99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a9c:	89 f0                	mov    %esi,%eax
+ a9e:	5b                   	pop    %ebx
+ a9f:	5e                   	pop    %esi
+ aa0:	5d                   	pop    %ebp
+ aa1:	c3                   	ret
+ aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ aa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ aab:	31 f6                	xor    %esi,%esi
+}
+ aad:	89 f0                	mov    %esi,%eax
+ aaf:	5b                   	pop    %ebx
+ ab0:	5e                   	pop    %esi
+ ab1:	5d                   	pop    %ebp
+ ab2:	c3                   	ret
+ ab3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ac0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	56                   	push   %esi
+ ac5:	53                   	push   %ebx
+ ac6:	83 ec 0c             	sub    $0xc,%esp
+ ac9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ acc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ acf:	85 db                	test   %ebx,%ebx
+ ad1:	74 55                	je     b28 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ad3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ad6:	89 de                	mov    %ebx,%esi
+ ad8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ adf:	39 c7                	cmp    %eax,%edi
+ ae1:	72 0d                	jb     af0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ ae3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ae6:	89 f0                	mov    %esi,%eax
+ ae8:	5b                   	pop    %ebx
+ ae9:	5e                   	pop    %esi
+ aea:	5f                   	pop    %edi
+ aeb:	5d                   	pop    %ebp
+ aec:	c3                   	ret
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ af0:	83 ec 0c             	sub    $0xc,%esp
+ af3:	50                   	push   %eax
+ af4:	e8 77 fe ff ff       	call   970 <malloc>
+ af9:	83 c4 10             	add    $0x10,%esp
+ afc:	89 c6                	mov    %eax,%esi
+ afe:	85 c0                	test   %eax,%eax
+ b00:	74 e1                	je     ae3 <realloc+0x23>
+  memmove(p, ap, have);
+ b02:	83 ec 04             	sub    $0x4,%esp
+ b05:	57                   	push   %edi
+ b06:	53                   	push   %ebx
+ b07:	50                   	push   %eax
+ b08:	e8 b3 f8 ff ff       	call   3c0 <memmove>
+  free(ap);
+ b0d:	89 1c 24             	mov    %ebx,(%esp)
+ b10:	e8 eb fd ff ff       	call   900 <free>
+  return p;
+ b15:	83 c4 10             	add    $0x10,%esp
+}
+ b18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b1b:	89 f0                	mov    %esi,%eax
+ b1d:	5b                   	pop    %ebx
+ b1e:	5e                   	pop    %esi
+ b1f:	5f                   	pop    %edi
+ b20:	5d                   	pop    %ebp
+ b21:	c3                   	ret
+ b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b28:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b2e:	5b                   	pop    %ebx
+ b2f:	5e                   	pop    %esi
+ b30:	5f                   	pop    %edi
+ b31:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b32:	e9 39 fe ff ff       	jmp    970 <malloc>
@@ -0,0 +1,1745 @@
+
+_chmod:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+
+  if(argc < 3) {
+  13:	83 39 02             	cmpl   $0x2,(%ecx)
+{
+  16:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc < 3) {
+  19:	7f 13                	jg     2e <main+0x2e>
+    printf(2, "Usage: chmod MODE TARGET\n");
+  1b:	50                   	push   %eax
+  1c:	50                   	push   %eax
+  1d:	68 08 0b 00 00       	push   $0xb08
+  22:	6a 02                	push   $0x2
+  24:	e8 97 05 00 00       	call   5c0 <printf>
+    exit();
+  29:	e8 95 03 00 00       	call   3c3 <exit>
+  }
+ 
+  char *mode = argv[1];
+  2e:	8b 58 04             	mov    0x4(%eax),%ebx
+  char *pathname = argv[2];
+  if(strlen(mode) != 4) {
+  31:	83 ec 0c             	sub    $0xc,%esp
+  char *pathname = argv[2];
+  34:	8b 70 08             	mov    0x8(%eax),%esi
+  if(strlen(mode) != 4) {
+  37:	53                   	push   %ebx
+  38:	e8 33 01 00 00       	call   170 <strlen>
+  3d:	83 c4 10             	add    $0x10,%esp
+  40:	83 f8 04             	cmp    $0x4,%eax
+  43:	75 42                	jne    87 <main+0x87>
+    printf(2, "Error: invalid mode 1\n");
+    exit();
+  }
+
+  if(mode[0] < '0' || mode[0] > '1') {
+  45:	0f b6 03             	movzbl (%ebx),%eax
+  48:	8d 50 d0             	lea    -0x30(%eax),%edx
+    printf(2, "Error: invalid mode 2\n");
+    exit();
+  }
+
+  for(int i = 1; i < 4; i++) {
+  4b:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(mode[0] < '0' || mode[0] > '1') {
+  50:	80 fa 01             	cmp    $0x1,%dl
+  53:	77 45                	ja     9a <main+0x9a>
+    if(mode[i] < '0' || mode[i] > '7'){
+  55:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  59:	83 ea 30             	sub    $0x30,%edx
+  5c:	80 fa 07             	cmp    $0x7,%dl
+  5f:	77 5f                	ja     c0 <main+0xc0>
+  for(int i = 1; i < 4; i++) {
+  61:	83 c0 01             	add    $0x1,%eax
+  64:	83 f8 04             	cmp    $0x4,%eax
+  67:	75 ec                	jne    55 <main+0x55>
+      printf(2, "Error: invalid mode 3\n");
+      exit();
+    }
+  }
+  int octMode = atoo(mode);
+  69:	83 ec 0c             	sub    $0xc,%esp
+  6c:	53                   	push   %ebx
+  6d:	e8 ae 02 00 00       	call   320 <atoo>
+  
+  int rc = chmod(pathname, octMode);
+  72:	5a                   	pop    %edx
+  73:	59                   	pop    %ecx
+  74:	50                   	push   %eax
+  75:	56                   	push   %esi
+  76:	e8 80 04 00 00       	call   4fb <chmod>
+  if(rc < 0) {
+  7b:	83 c4 10             	add    $0x10,%esp
+  7e:	85 c0                	test   %eax,%eax
+  80:	78 2b                	js     ad <main+0xad>
+    printf(2, "chmod failed\n");
+  }
+  exit();
+  82:	e8 3c 03 00 00       	call   3c3 <exit>
+    printf(2, "Error: invalid mode 1\n");
+  87:	50                   	push   %eax
+  88:	50                   	push   %eax
+  89:	68 22 0b 00 00       	push   $0xb22
+  8e:	6a 02                	push   $0x2
+  90:	e8 2b 05 00 00       	call   5c0 <printf>
+    exit();
+  95:	e8 29 03 00 00       	call   3c3 <exit>
+    printf(2, "Error: invalid mode 2\n");
+  9a:	56                   	push   %esi
+  9b:	56                   	push   %esi
+  9c:	68 39 0b 00 00       	push   $0xb39
+  a1:	6a 02                	push   $0x2
+  a3:	e8 18 05 00 00       	call   5c0 <printf>
+    exit();
+  a8:	e8 16 03 00 00       	call   3c3 <exit>
+    printf(2, "chmod failed\n");
+  ad:	50                   	push   %eax
+  ae:	50                   	push   %eax
+  af:	68 67 0b 00 00       	push   $0xb67
+  b4:	6a 02                	push   $0x2
+  b6:	e8 05 05 00 00       	call   5c0 <printf>
+  bb:	83 c4 10             	add    $0x10,%esp
+  be:	eb c2                	jmp    82 <main+0x82>
+      printf(2, "Error: invalid mode 3\n");
+  c0:	53                   	push   %ebx
+  c1:	53                   	push   %ebx
+  c2:	68 50 0b 00 00       	push   $0xb50
+  c7:	6a 02                	push   $0x2
+  c9:	e8 f2 04 00 00       	call   5c0 <printf>
+      exit();
+  ce:	e8 f0 02 00 00       	call   3c3 <exit>
+  d3:	66 90                	xchg   %ax,%ax
+  d5:	66 90                	xchg   %ax,%ax
+  d7:	66 90                	xchg   %ax,%ax
+  d9:	66 90                	xchg   %ax,%ax
+  db:	66 90                	xchg   %ax,%ax
+  dd:	66 90                	xchg   %ax,%ax
+  df:	90                   	nop
+
+000000e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e1:	31 c0                	xor    %eax,%eax
+{
+  e3:	89 e5                	mov    %esp,%ebp
+  e5:	53                   	push   %ebx
+  e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  f7:	83 c0 01             	add    $0x1,%eax
+  fa:	84 d2                	test   %dl,%dl
+  fc:	75 f2                	jne    f0 <strcpy+0x10>
+    ;
+  return os;
+}
+  fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 101:	89 c8                	mov    %ecx,%eax
+ 103:	c9                   	leave
+ 104:	c3                   	ret
+ 105:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	8b 55 08             	mov    0x8(%ebp),%edx
+ 117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 11a:	0f b6 02             	movzbl (%edx),%eax
+ 11d:	84 c0                	test   %al,%al
+ 11f:	75 17                	jne    138 <strcmp+0x28>
+ 121:	eb 3a                	jmp    15d <strcmp+0x4d>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 12c:	83 c2 01             	add    $0x1,%edx
+ 12f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 132:	84 c0                	test   %al,%al
+ 134:	74 1a                	je     150 <strcmp+0x40>
+    p++, q++;
+ 136:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 138:	0f b6 19             	movzbl (%ecx),%ebx
+ 13b:	38 c3                	cmp    %al,%bl
+ 13d:	74 e9                	je     128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 13f:	29 d8                	sub    %ebx,%eax
+}
+ 141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 144:	c9                   	leave
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 150:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 154:	31 c0                	xor    %eax,%eax
+ 156:	29 d8                	sub    %ebx,%eax
+}
+ 158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 15b:	c9                   	leave
+ 15c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 15d:	0f b6 19             	movzbl (%ecx),%ebx
+ 160:	31 c0                	xor    %eax,%eax
+ 162:	eb db                	jmp    13f <strcmp+0x2f>
+ 164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+
+00000170 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 176:	80 3a 00             	cmpb   $0x0,(%edx)
+ 179:	74 15                	je     190 <strlen+0x20>
+ 17b:	31 c0                	xor    %eax,%eax
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 187:	89 c1                	mov    %eax,%ecx
+ 189:	75 f5                	jne    180 <strlen+0x10>
+    ;
+  return n;
+}
+ 18b:	89 c8                	mov    %ecx,%eax
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+ 18f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 190:	31 c9                	xor    %ecx,%ecx
+}
+ 192:	5d                   	pop    %ebp
+ 193:	89 c8                	mov    %ecx,%eax
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ad:	89 d7                	mov    %edx,%edi
+ 1af:	fc                   	cld
+ 1b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1b5:	89 d0                	mov    %edx,%eax
+ 1b7:	c9                   	leave
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ca:	0f b6 10             	movzbl (%eax),%edx
+ 1cd:	84 d2                	test   %dl,%dl
+ 1cf:	75 12                	jne    1e3 <strchr+0x23>
+ 1d1:	eb 1d                	jmp    1f0 <strchr+0x30>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+ 1d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1dc:	83 c0 01             	add    $0x1,%eax
+ 1df:	84 d2                	test   %dl,%dl
+ 1e1:	74 0d                	je     1f0 <strchr+0x30>
+    if(*s == c)
+ 1e3:	38 d1                	cmp    %dl,%cl
+ 1e5:	75 f1                	jne    1d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1e7:	5d                   	pop    %ebp
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1f0:	31 c0                	xor    %eax,%eax
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	c3                   	ret
+ 1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 205:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 208:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 209:	31 db                	xor    %ebx,%ebx
+{
+ 20b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 20e:	eb 27                	jmp    237 <gets+0x37>
+    cc = read(0, &c, 1);
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	6a 01                	push   $0x1
+ 215:	56                   	push   %esi
+ 216:	6a 00                	push   $0x0
+ 218:	e8 be 01 00 00       	call   3db <read>
+    if(cc < 1)
+ 21d:	83 c4 10             	add    $0x10,%esp
+ 220:	85 c0                	test   %eax,%eax
+ 222:	7e 1d                	jle    241 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 224:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 228:	8b 55 08             	mov    0x8(%ebp),%edx
+ 22b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 22f:	3c 0a                	cmp    $0xa,%al
+ 231:	74 10                	je     243 <gets+0x43>
+ 233:	3c 0d                	cmp    $0xd,%al
+ 235:	74 0c                	je     243 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 237:	89 df                	mov    %ebx,%edi
+ 239:	83 c3 01             	add    $0x1,%ebx
+ 23c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 23f:	7c cf                	jl     210 <gets+0x10>
+ 241:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 24a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 24d:	5b                   	pop    %ebx
+ 24e:	5e                   	pop    %esi
+ 24f:	5f                   	pop    %edi
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+ 252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	56                   	push   %esi
+ 264:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	6a 00                	push   $0x0
+ 26a:	ff 75 08             	push   0x8(%ebp)
+ 26d:	e8 91 01 00 00       	call   403 <open>
+  if(fd < 0)
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	85 c0                	test   %eax,%eax
+ 277:	78 27                	js     2a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 279:	83 ec 08             	sub    $0x8,%esp
+ 27c:	ff 75 0c             	push   0xc(%ebp)
+ 27f:	89 c3                	mov    %eax,%ebx
+ 281:	50                   	push   %eax
+ 282:	e8 94 01 00 00       	call   41b <fstat>
+  close(fd);
+ 287:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 28a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 28c:	e8 5a 01 00 00       	call   3eb <close>
+  return r;
+ 291:	83 c4 10             	add    $0x10,%esp
+}
+ 294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 297:	89 f0                	mov    %esi,%eax
+ 299:	5b                   	pop    %ebx
+ 29a:	5e                   	pop    %esi
+ 29b:	5d                   	pop    %ebp
+ 29c:	c3                   	ret
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2a5:	eb ed                	jmp    294 <stat+0x34>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+ 2b4:	53                   	push   %ebx
+ 2b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2b8:	0f b6 02             	movzbl (%edx),%eax
+ 2bb:	3c 20                	cmp    $0x20,%al
+ 2bd:	75 0c                	jne    2cb <atoi+0x1b>
+ 2bf:	90                   	nop
+ 2c0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2c4:	83 c2 01             	add    $0x1,%edx
+ 2c7:	3c 20                	cmp    $0x20,%al
+ 2c9:	74 f5                	je     2c0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2cb:	3c 2d                	cmp    $0x2d,%al
+ 2cd:	74 41                	je     310 <atoi+0x60>
+ 2cf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2d4:	3c 2b                	cmp    $0x2b,%al
+ 2d6:	74 3d                	je     315 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 2d8:	0f be 0a             	movsbl (%edx),%ecx
+ 2db:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2de:	3c 09                	cmp    $0x9,%al
+ 2e0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2e5:	77 21                	ja     308 <atoi+0x58>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2f0:	83 c2 01             	add    $0x1,%edx
+ 2f3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 2f6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 2fa:	0f be 0a             	movsbl (%edx),%ecx
+ 2fd:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 300:	80 fb 09             	cmp    $0x9,%bl
+ 303:	76 eb                	jbe    2f0 <atoi+0x40>
+  return sign*n;
+ 305:	0f af c6             	imul   %esi,%eax
+}
+ 308:	5b                   	pop    %ebx
+ 309:	5e                   	pop    %esi
+ 30a:	5d                   	pop    %ebp
+ 30b:	c3                   	ret
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 315:	83 c2 01             	add    $0x1,%edx
+ 318:	eb be                	jmp    2d8 <atoi+0x28>
+ 31a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000320 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+ 325:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 328:	0f b6 02             	movzbl (%edx),%eax
+ 32b:	3c 20                	cmp    $0x20,%al
+ 32d:	75 0c                	jne    33b <atoo+0x1b>
+ 32f:	90                   	nop
+ 330:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 334:	83 c2 01             	add    $0x1,%edx
+ 337:	3c 20                	cmp    $0x20,%al
+ 339:	74 f5                	je     330 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 33b:	3c 2d                	cmp    $0x2d,%al
+ 33d:	74 41                	je     380 <atoo+0x60>
+ 33f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 344:	3c 2b                	cmp    $0x2b,%al
+ 346:	74 3d                	je     385 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 348:	0f be 0a             	movsbl (%edx),%ecx
+ 34b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 34e:	3c 07                	cmp    $0x7,%al
+ 350:	b8 00 00 00 00       	mov    $0x0,%eax
+ 355:	77 1e                	ja     375 <atoo+0x55>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 360:	83 c2 01             	add    $0x1,%edx
+ 363:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 367:	0f be 0a             	movsbl (%edx),%ecx
+ 36a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 36d:	80 fb 07             	cmp    $0x7,%bl
+ 370:	76 ee                	jbe    360 <atoo+0x40>
+  return sign*n;
+ 372:	0f af c6             	imul   %esi,%eax
+}
+ 375:	5b                   	pop    %ebx
+ 376:	5e                   	pop    %esi
+ 377:	5d                   	pop    %ebp
+ 378:	c3                   	ret
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 385:	83 c2 01             	add    $0x1,%edx
+ 388:	eb be                	jmp    348 <atoo+0x28>
+ 38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000390 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+
+000003bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <exit>:
+SYSCALL(exit)
+ 3c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <wait>:
+SYSCALL(wait)
+ 3cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <pipe>:
+SYSCALL(pipe)
+ 3d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <read>:
+SYSCALL(read)
+ 3db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <write>:
+SYSCALL(write)
+ 3e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <close>:
+SYSCALL(close)
+ 3eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <kill>:
+SYSCALL(kill)
+ 3f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <exec>:
+SYSCALL(exec)
+ 3fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <open>:
+SYSCALL(open)
+ 403:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mknod>:
+SYSCALL(mknod)
+ 40b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <unlink>:
+SYSCALL(unlink)
+ 413:	b8 12 00 00 00       	mov    $0x12,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <fstat>:
+SYSCALL(fstat)
+ 41b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <link>:
+SYSCALL(link)
+ 423:	b8 13 00 00 00       	mov    $0x13,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mkdir>:
+SYSCALL(mkdir)
+ 42b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <chdir>:
+SYSCALL(chdir)
+ 433:	b8 09 00 00 00       	mov    $0x9,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <dup>:
+SYSCALL(dup)
+ 43b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getpid>:
+SYSCALL(getpid)
+ 443:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <sbrk>:
+SYSCALL(sbrk)
+ 44b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <sleep>:
+SYSCALL(sleep)
+ 453:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <uptime>:
+SYSCALL(uptime)
+ 45b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <superpages>:
+SYSCALL(superpages)
+ 463:	b8 23 00 00 00       	mov    $0x23,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mmap>:
+SYSCALL(mmap)
+ 46b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <munmap>:
+SYSCALL(munmap)
+ 473:	b8 25 00 00 00       	mov    $0x25,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <spawn>:
+SYSCALL(spawn)
+ 47b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <swapstat>:
+SYSCALL(swapstat)
+ 483:	b8 27 00 00 00       	mov    $0x27,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 48b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <iostat>:
+SYSCALL(iostat)
+ 493:	b8 29 00 00 00       	mov    $0x29,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <dropcache>:
+SYSCALL(dropcache)
+ 49b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <iosched>:
+SYSCALL(iosched)
+ 4a3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <halt>:
+SYSCALL(halt)
+ 4ab:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <date>:
+SYSCALL(date)
+ 4b3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 4bb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getgid>:
+SYSCALL(getgid)
+ 4c3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <getppid>:
+SYSCALL(getppid)
+ 4cb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <setuid>:
+SYSCALL(setuid)
+ 4d3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <setgid>:
+SYSCALL(setgid)
+ 4db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <getprocs>:
+SYSCALL(getprocs)
+ 4e3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 4eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getpriority>:
+SYSCALL(getpriority)
+ 4f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 4fb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <chown>:
+SYSCALL(chown)
+ 503:	b8 21 00 00 00       	mov    $0x21,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <chgrp>:
+SYSCALL(chgrp)
+ 50b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+ 513:	66 90                	xchg   %ax,%ax
+ 515:	66 90                	xchg   %ax,%ax
+ 517:	66 90                	xchg   %ax,%ax
+ 519:	66 90                	xchg   %ax,%ax
+ 51b:	66 90                	xchg   %ax,%ax
+ 51d:	66 90                	xchg   %ax,%ax
+ 51f:	90                   	nop
+
+00000520 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	53                   	push   %ebx
+ 526:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 528:	89 d1                	mov    %edx,%ecx
+{
+ 52a:	83 ec 3c             	sub    $0x3c,%esp
+ 52d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 530:	85 d2                	test   %edx,%edx
+ 532:	0f 89 80 00 00 00    	jns    5b8 <printint+0x98>
+ 538:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 53c:	74 7a                	je     5b8 <printint+0x98>
+    x = -xx;
+ 53e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 540:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 545:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 548:	31 f6                	xor    %esi,%esi
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 550:	89 c8                	mov    %ecx,%eax
+ 552:	31 d2                	xor    %edx,%edx
+ 554:	89 f7                	mov    %esi,%edi
+ 556:	f7 f3                	div    %ebx
+ 558:	8d 76 01             	lea    0x1(%esi),%esi
+ 55b:	0f b6 92 d4 0b 00 00 	movzbl 0xbd4(%edx),%edx
+ 562:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 566:	89 ca                	mov    %ecx,%edx
+ 568:	89 c1                	mov    %eax,%ecx
+ 56a:	39 da                	cmp    %ebx,%edx
+ 56c:	73 e2                	jae    550 <printint+0x30>
+  if(neg)
+ 56e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 571:	85 c0                	test   %eax,%eax
+ 573:	74 07                	je     57c <printint+0x5c>
+    buf[i++] = '-';
+ 575:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 57a:	89 f7                	mov    %esi,%edi
+ 57c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 57f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 582:	01 df                	add    %ebx,%edi
+ 584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 588:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 58b:	83 ec 04             	sub    $0x4,%esp
+ 58e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 591:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 594:	6a 01                	push   $0x1
+ 596:	50                   	push   %eax
+ 597:	56                   	push   %esi
+ 598:	e8 46 fe ff ff       	call   3e3 <write>
+  while(--i >= 0)
+ 59d:	89 f8                	mov    %edi,%eax
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	83 ef 01             	sub    $0x1,%edi
+ 5a5:	39 d8                	cmp    %ebx,%eax
+ 5a7:	75 df                	jne    588 <printint+0x68>
+}
+ 5a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ac:	5b                   	pop    %ebx
+ 5ad:	5e                   	pop    %esi
+ 5ae:	5f                   	pop    %edi
+ 5af:	5d                   	pop    %ebp
+ 5b0:	c3                   	ret
+ 5b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5b8:	31 c0                	xor    %eax,%eax
+ 5ba:	eb 89                	jmp    545 <printint+0x25>
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d2:	83 c6 01             	add    $0x1,%esi
+ 5d5:	84 db                	test   %bl,%bl
+ 5d7:	74 67                	je     640 <printf+0x80>
+ 5d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5dc:	31 d2                	xor    %edx,%edx
+ 5de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5e1:	eb 34                	jmp    617 <printf+0x57>
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+ 5e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5f0:	83 f8 25             	cmp    $0x25,%eax
+ 5f3:	74 18                	je     60d <printf+0x4d>
+  write(fd, &c, 1);
+ 5f5:	83 ec 04             	sub    $0x4,%esp
+ 5f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5fe:	6a 01                	push   $0x1
+ 600:	50                   	push   %eax
+ 601:	57                   	push   %edi
+ 602:	e8 dc fd ff ff       	call   3e3 <write>
+ 607:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 60a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 60d:	0f b6 1e             	movzbl (%esi),%ebx
+ 610:	83 c6 01             	add    $0x1,%esi
+ 613:	84 db                	test   %bl,%bl
+ 615:	74 29                	je     640 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 617:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 61a:	85 d2                	test   %edx,%edx
+ 61c:	74 ca                	je     5e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 61e:	83 fa 25             	cmp    $0x25,%edx
+ 621:	75 ea                	jne    60d <printf+0x4d>
+      if(c == 'd'){
+ 623:	83 f8 25             	cmp    $0x25,%eax
+ 626:	0f 84 24 01 00 00    	je     750 <printf+0x190>
+ 62c:	83 e8 63             	sub    $0x63,%eax
+ 62f:	83 f8 15             	cmp    $0x15,%eax
+ 632:	77 1c                	ja     650 <printf+0x90>
+ 634:	ff 24 85 7c 0b 00 00 	jmp    *0xb7c(,%eax,4)
+ 63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 643:	5b                   	pop    %ebx
+ 644:	5e                   	pop    %esi
+ 645:	5f                   	pop    %edi
+ 646:	5d                   	pop    %ebp
+ 647:	c3                   	ret
+ 648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 656:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 65a:	6a 01                	push   $0x1
+ 65c:	52                   	push   %edx
+ 65d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 660:	57                   	push   %edi
+ 661:	e8 7d fd ff ff       	call   3e3 <write>
+ 666:	83 c4 0c             	add    $0xc,%esp
+ 669:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66c:	6a 01                	push   $0x1
+ 66e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 671:	52                   	push   %edx
+ 672:	57                   	push   %edi
+ 673:	e8 6b fd ff ff       	call   3e3 <write>
+        putc(fd, c);
+ 678:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 67b:	31 d2                	xor    %edx,%edx
+ 67d:	eb 8e                	jmp    60d <printf+0x4d>
+ 67f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 00                	push   $0x0
+ 68f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 691:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 694:	e8 87 fe ff ff       	call   520 <printint>
+        ap++;
+ 699:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 69c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 67 ff ff ff       	jmp    60d <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6b5:	83 c0 04             	add    $0x4,%eax
+ 6b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6bb:	85 db                	test   %ebx,%ebx
+ 6bd:	0f 84 9d 00 00 00    	je     760 <printf+0x1a0>
+        while(*s != 0){
+ 6c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	0f 84 3d ff ff ff    	je     60d <printf+0x4d>
+ 6d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6d6:	89 de                	mov    %ebx,%esi
+ 6d8:	89 d3                	mov    %edx,%ebx
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	53                   	push   %ebx
+ 6ec:	57                   	push   %edi
+ 6ed:	e8 f1 fc ff ff       	call   3e3 <write>
+        while(*s != 0){
+ 6f2:	0f b6 06             	movzbl (%esi),%eax
+ 6f5:	83 c4 10             	add    $0x10,%esp
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	75 e4                	jne    6e0 <printf+0x120>
+      state = 0;
+ 6fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 07 ff ff ff       	jmp    60d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 01                	push   $0x1
+ 71f:	e9 6b ff ff ff       	jmp    68f <printf+0xcf>
+ 724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 728:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 731:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 733:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 736:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 739:	6a 01                	push   $0x1
+ 73b:	52                   	push   %edx
+ 73c:	57                   	push   %edi
+ 73d:	e8 a1 fc ff ff       	call   3e3 <write>
+        ap++;
+ 742:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 745:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 748:	31 d2                	xor    %edx,%edx
+ 74a:	e9 be fe ff ff       	jmp    60d <printf+0x4d>
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 756:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 759:	6a 01                	push   $0x1
+ 75b:	e9 11 ff ff ff       	jmp    671 <printf+0xb1>
+ 760:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 765:	bb 75 0b 00 00       	mov    $0xb75,%ebx
+ 76a:	e9 61 ff ff ff       	jmp    6d0 <printf+0x110>
+ 76f:	90                   	nop
+
+00000770 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 773:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+{
+ 778:	89 e5                	mov    %esp,%ebp
+ 77a:	56                   	push   %esi
+ 77b:	53                   	push   %ebx
+ 77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 780:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 782:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 784:	39 ca                	cmp    %ecx,%edx
+ 786:	73 30                	jae    7b8 <lfree+0x48>
+ 788:	39 c1                	cmp    %eax,%ecx
+ 78a:	72 04                	jb     790 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 78c:	39 c2                	cmp    %eax,%edx
+ 78e:	72 f0                	jb     780 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 790:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 793:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 796:	39 f0                	cmp    %esi,%eax
+ 798:	74 26                	je     7c0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 79a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 79c:	8b 42 04             	mov    0x4(%edx),%eax
+ 79f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7a2:	39 d9                	cmp    %ebx,%ecx
+ 7a4:	74 30                	je     7d6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7a6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7a8:	5b                   	pop    %ebx
+  freep = p;
+ 7a9:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+}
+ 7af:	5e                   	pop    %esi
+ 7b0:	5d                   	pop    %ebp
+ 7b1:	c3                   	ret
+ 7b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7b8:	39 c1                	cmp    %eax,%ecx
+ 7ba:	72 d0                	jb     78c <lfree+0x1c>
+ 7bc:	eb c2                	jmp    780 <lfree+0x10>
+ 7be:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 7c0:	03 58 04             	add    0x4(%eax),%ebx
+ 7c3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7c6:	8b 02                	mov    (%edx),%eax
+ 7c8:	8b 00                	mov    (%eax),%eax
+ 7ca:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 7cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7d2:	39 d9                	cmp    %ebx,%ecx
+ 7d4:	75 d0                	jne    7a6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 7d6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 7d9:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+    p->s.size += bp->s.size;
+ 7df:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7e2:	8b 09                	mov    (%ecx),%ecx
+ 7e4:	89 0a                	mov    %ecx,(%edx)
+}
+ 7e6:	5b                   	pop    %ebx
+ 7e7:	5e                   	pop    %esi
+ 7e8:	5d                   	pop    %ebp
+ 7e9:	c3                   	ret
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007f0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	89 c7                	mov    %eax,%edi
+ 7f6:	56                   	push   %esi
+ 7f7:	53                   	push   %ebx
+ 7f8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 7fb:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+ 800:	85 c0                	test   %eax,%eax
+ 802:	0f 84 88 00 00 00    	je     890 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 808:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 80a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 80d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 812:	39 df                	cmp    %ebx,%edi
+ 814:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 817:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 81e:	39 f9                	cmp    %edi,%ecx
+ 820:	72 0f                	jb     831 <lalloc+0x41>
+ 822:	eb 4c                	jmp    870 <lalloc+0x80>
+ 824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 828:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 82a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 82d:	39 f9                	cmp    %edi,%ecx
+ 82f:	73 3f                	jae    870 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 831:	89 d0                	mov    %edx,%eax
+ 833:	39 15 c4 0f 00 00    	cmp    %edx,0xfc4
+ 839:	75 ed                	jne    828 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 83b:	83 ec 0c             	sub    $0xc,%esp
+ 83e:	56                   	push   %esi
+ 83f:	e8 07 fc ff ff       	call   44b <sbrk>
+  if(p == (char*)-1)
+ 844:	83 c4 10             	add    $0x10,%esp
+ 847:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 84a:	74 11                	je     85d <lalloc+0x6d>
+  hp->s.size = nu;
+ 84c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 84f:	e8 1c ff ff ff       	call   770 <lfree>
+  return freep;
+ 854:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+      if((p = morecore(nunits)) == 0)
+ 859:	85 c0                	test   %eax,%eax
+ 85b:	75 cb                	jne    828 <lalloc+0x38>
+        return 0;
+  }
+}
+ 85d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 860:	31 d2                	xor    %edx,%edx
+}
+ 862:	5b                   	pop    %ebx
+ 863:	89 d0                	mov    %edx,%eax
+ 865:	5e                   	pop    %esi
+ 866:	5f                   	pop    %edi
+ 867:	5d                   	pop    %ebp
+ 868:	c3                   	ret
+ 869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 870:	39 cf                	cmp    %ecx,%edi
+ 872:	74 4c                	je     8c0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 874:	29 f9                	sub    %edi,%ecx
+ 876:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 879:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 87c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 87f:	a3 c4 0f 00 00       	mov    %eax,0xfc4
+}
+ 884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 887:	89 d0                	mov    %edx,%eax
+ 889:	5b                   	pop    %ebx
+ 88a:	5e                   	pop    %esi
+ 88b:	5f                   	pop    %edi
+ 88c:	5d                   	pop    %ebp
+ 88d:	c3                   	ret
+ 88e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 890:	ba c8 0f 00 00       	mov    $0xfc8,%edx
+ 895:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 897:	c7 05 c4 0f 00 00 c8 	movl   $0xfc8,0xfc4
+ 89e:	0f 00 00 
+ 8a1:	c7 05 c8 0f 00 00 c8 	movl   $0xfc8,0xfc8
+ 8a8:	0f 00 00 
+ 8ab:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 8ad:	c7 05 cc 0f 00 00 00 	movl   $0x0,0xfcc
+ 8b4:	00 00 00 
+ 8b7:	e9 51 ff ff ff       	jmp    80d <lalloc+0x1d>
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 8c0:	8b 0a                	mov    (%edx),%ecx
+ 8c2:	89 08                	mov    %ecx,(%eax)
+ 8c4:	eb b9                	jmp    87f <lalloc+0x8f>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008d0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 8d9:	85 f6                	test   %esi,%esi
+ 8db:	74 42                	je     91f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 8dd:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 8e0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 8e3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 8e9:	77 3d                	ja     928 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 8eb:	31 c9                	xor    %ecx,%ecx
+ 8ed:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 8f2:	83 fa 02             	cmp    $0x2,%edx
+ 8f5:	74 17                	je     90e <free+0x3e>
+ 8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fe:	66 90                	xchg   %ax,%ax
+ 900:	83 c1 01             	add    $0x1,%ecx
+ 903:	89 d8                	mov    %ebx,%eax
+ 905:	d3 e0                	shl    %cl,%eax
+ 907:	83 c0 01             	add    $0x1,%eax
+ 90a:	39 c2                	cmp    %eax,%edx
+ 90c:	75 f2                	jne    900 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 90e:	8b 04 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%eax
+  classes[c] = bp;
+ 915:	89 3c 8d a0 0f 00 00 	mov    %edi,0xfa0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 91c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 91f:	5b                   	pop    %ebx
+ 920:	5e                   	pop    %esi
+ 921:	5f                   	pop    %edi
+ 922:	5d                   	pop    %ebp
+ 923:	c3                   	ret
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 928:	5b                   	pop    %ebx
+    lfree(bp);
+ 929:	89 f8                	mov    %edi,%eax
+}
+ 92b:	5e                   	pop    %esi
+ 92c:	5f                   	pop    %edi
+ 92d:	5d                   	pop    %ebp
+    lfree(bp);
+ 92e:	e9 3d fe ff ff       	jmp    770 <lfree>
+ 933:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000940 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 949:	8b 45 08             	mov    0x8(%ebp),%eax
+ 94c:	83 c0 07             	add    $0x7,%eax
+ 94f:	c1 e8 03             	shr    $0x3,%eax
+ 952:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 955:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 95a:	77 44                	ja     9a0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 95c:	31 c9                	xor    %ecx,%ecx
+ 95e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 963:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 968:	83 f8 02             	cmp    $0x2,%eax
+ 96b:	76 11                	jbe    97e <malloc+0x3e>
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+ 970:	83 c1 01             	add    $0x1,%ecx
+ 973:	89 d3                	mov    %edx,%ebx
+ 975:	d3 e3                	shl    %cl,%ebx
+ 977:	83 c3 01             	add    $0x1,%ebx
+ 97a:	39 c3                	cmp    %eax,%ebx
+ 97c:	72 f2                	jb     970 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 97e:	8b 04 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%eax
+ 985:	85 c0                	test   %eax,%eax
+ 987:	74 2f                	je     9b8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 989:	8b 10                	mov    (%eax),%edx
+ 98b:	89 14 8d a0 0f 00 00 	mov    %edx,0xfa0(,%ecx,4)
+  return (void*)(p + 1);
+ 992:	83 c0 08             	add    $0x8,%eax
+}
+ 995:	83 c4 1c             	add    $0x1c,%esp
+ 998:	5b                   	pop    %ebx
+ 999:	5e                   	pop    %esi
+ 99a:	5f                   	pop    %edi
+ 99b:	5d                   	pop    %ebp
+ 99c:	c3                   	ret
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 9a0:	e8 4b fe ff ff       	call   7f0 <lalloc>
+ 9a5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 9a7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 9aa:	85 d2                	test   %edx,%edx
+ 9ac:	75 e7                	jne    995 <malloc+0x55>
+      return 0;
+ 9ae:	31 c0                	xor    %eax,%eax
+ 9b0:	eb e3                	jmp    995 <malloc+0x55>
+ 9b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 9b8:	31 d2                	xor    %edx,%edx
+ 9ba:	b8 00 02 00 00       	mov    $0x200,%eax
+ 9bf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9c2:	f7 f3                	div    %ebx
+  if(n < 4)
+ 9c4:	ba 04 00 00 00       	mov    $0x4,%edx
+ 9c9:	89 d6                	mov    %edx,%esi
+ 9cb:	39 d0                	cmp    %edx,%eax
+ 9cd:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 9d0:	0f af f3             	imul   %ebx,%esi
+ 9d3:	89 f0                	mov    %esi,%eax
+ 9d5:	e8 16 fe ff ff       	call   7f0 <lalloc>
+ 9da:	85 c0                	test   %eax,%eax
+ 9dc:	74 d0                	je     9ae <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 9de:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9e1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 9e4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9eb:	8b 14 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%edx
+ 9f2:	39 f8                	cmp    %edi,%eax
+ 9f4:	73 22                	jae    a18 <malloc+0xd8>
+ 9f6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9f9:	eb 09                	jmp    a04 <malloc+0xc4>
+ 9fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+ a00:	89 c2                	mov    %eax,%edx
+ a02:	89 c8                	mov    %ecx,%eax
+ a04:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ a07:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ a0a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ a0c:	39 f9                	cmp    %edi,%ecx
+ a0e:	72 f0                	jb     a00 <malloc+0xc0>
+ a10:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a13:	e9 73 ff ff ff       	jmp    98b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ a18:	89 d0                	mov    %edx,%eax
+ a1a:	8b 12                	mov    (%edx),%edx
+ a1c:	e9 6a ff ff ff       	jmp    98b <malloc+0x4b>
+ a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+
+00000a30 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	56                   	push   %esi
+ a34:	53                   	push   %ebx
+ a35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ a3b:	85 c9                	test   %ecx,%ecx
+ a3d:	74 06                	je     a45 <calloc+0x15>
+ a3f:	89 c8                	mov    %ecx,%eax
+ a41:	f7 e3                	mul    %ebx
+ a43:	70 33                	jo     a78 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ a45:	0f af d9             	imul   %ecx,%ebx
+ a48:	83 ec 0c             	sub    $0xc,%esp
+ a4b:	53                   	push   %ebx
+ a4c:	e8 ef fe ff ff       	call   940 <malloc>
+ a51:	83 c4 10             	add    $0x10,%esp
+ a54:	89 c6                	mov    %eax,%esi
+ a56:	85 c0                	test   %eax,%eax
+ a58:	74 1e                	je     a78 <calloc+0x48>
+    memset(p, 0, n * size);
+ a5a:	83 ec 04             	sub    $0x4,%esp
+ a5d:	53                   	push   %ebx
+ a5e:	6a 00                	push   $0x0
+ a60:	50                   	push   %eax
+ a61:	e8 3a f7 ff ff       	call   1a0 <memset>
+ a66:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ a69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a6c:	89 f0                	mov    %esi,%eax
+ a6e:	5b                   	pop    %ebx
+ a6f:	5e                   	pop    %esi
+ a70:	5d                   	pop    %ebp
+ a71:	c3                   	ret
+ a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a7b:	31 f6                	xor    %esi,%esi
+}
+ a7d:	89 f0                	mov    %esi,%eax
+ a7f:	5b                   	pop    %ebx
+ a80:	5e                   	pop    %esi
+ a81:	5d                   	pop    %ebp
+ a82:	c3                   	ret
+ a83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a90 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	83 ec 0c             	sub    $0xc,%esp
+ a99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ a9f:	85 db                	test   %ebx,%ebx
+ aa1:	74 55                	je     af8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ aa3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ aa6:	89 de                	mov    %ebx,%esi
+ aa8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ aaf:	39 c7                	cmp    %eax,%edi
+ ab1:	72 0d                	jb     ac0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ ab3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ab6:	89 f0                	mov    %esi,%eax
+ ab8:	5b                   	pop    %ebx
+ ab9:	5e                   	pop    %esi
+ aba:	5f                   	pop    %edi
+ abb:	5d                   	pop    %ebp
+ abc:	c3                   	ret
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ ac0:	83 ec 0c             	sub    $0xc,%esp
+ ac3:	50                   	push   %eax
+ ac4:	e8 77 fe ff ff       	call   940 <malloc>
+ ac9:	83 c4 10             	add    $0x10,%esp
+ acc:	89 c6                	mov    %eax,%esi
+ ace:	85 c0                	test   %eax,%eax
+ ad0:	74 e1                	je     ab3 <realloc+0x23>
+  memmove(p, ap, have);
+ ad2:	83 ec 04             	sub    $0x4,%esp
+ ad5:	57                   	push   %edi
+ ad6:	53                   	push   %ebx
+ ad7:	50                   	push   %eax
+ ad8:	e8 b3 f8 ff ff       	call   390 <memmove>
+  free(ap);
+ add:	89 1c 24             	mov    %ebx,(%esp)
+ ae0:	e8 eb fd ff ff       	call   8d0 <free>
+  return p;
+ ae5:	83 c4 10             	add    $0x10,%esp
+}
+ ae8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aeb:	89 f0                	mov    %esi,%eax
+ aed:	5b                   	pop    %ebx
+ aee:	5e                   	pop    %esi
+ aef:	5f                   	pop    %edi
+ af0:	5d                   	pop    %ebp
+ af1:	c3                   	ret
+ af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ af8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ afb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ afe:	5b                   	pop    %ebx
+ aff:	5e                   	pop    %esi
+ b00:	5f                   	pop    %edi
+ b01:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b02:	e9 39 fe ff ff       	jmp    940 <malloc>
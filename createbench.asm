@@ -0,0 +1,1915 @@
+
+_createbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec c8 00 00 00    	sub    $0xc8,%esp
+  struct iostat a, b;
+  int i, n, t;
+  uint c;
+
+  n = argc > 1 ? atoi(argv[1]) : NCREATOR;
+  17:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1a:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : NCREATOR;
+  1d:	0f 8f 94 01 00 00    	jg     1b7 <main+0x1b7>
+  if(n < 1 || n > MAXC)
+    n = NCREATOR;
+  iostat(&a);
+  23:	83 ec 0c             	sub    $0xc,%esp
+  26:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+    n = NCREATOR;
+  2c:	be 04 00 00 00       	mov    $0x4,%esi
+  iostat(&a);
+  31:	50                   	push   %eax
+  32:	e8 0c 06 00 00       	call   643 <iostat>
+  t = uptime();
+  37:	e8 cf 05 00 00       	call   60b <uptime>
+  3c:	83 c4 10             	add    $0x10,%esp
+  3f:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%ebp)
+  for(i = 0; i < n; i++)
+  45:	31 ff                	xor    %edi,%edi
+  47:	eb 12                	jmp    5b <main+0x5b>
+  49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  50:	83 c7 01             	add    $0x1,%edi
+  53:	39 f7                	cmp    %esi,%edi
+  55:	0f 84 e5 00 00 00    	je     140 <main+0x140>
+    if(fork() == 0)
+  5b:	e8 0b 05 00 00       	call   56b <fork>
+  60:	85 c0                	test   %eax,%eax
+  62:	75 ec                	jne    50 <main+0x50>
+  strcpy(dir, "cb0");
+  64:	89 c3                	mov    %eax,%ebx
+  66:	50                   	push   %eax
+  67:	50                   	push   %eax
+  68:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  6e:	68 b8 0c 00 00       	push   $0xcb8
+  73:	50                   	push   %eax
+  74:	e8 17 02 00 00       	call   290 <strcpy>
+  dir[2] = '0' + id;
+  79:	8d 57 30             	lea    0x30(%edi),%edx
+  if(mkdir(dir) < 0){
+  7c:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  dir[2] = '0' + id;
+  82:	88 95 3a ff ff ff    	mov    %dl,-0xc6(%ebp)
+  if(mkdir(dir) < 0){
+  88:	89 04 24             	mov    %eax,(%esp)
+  8b:	e8 4b 05 00 00       	call   5db <mkdir>
+  90:	83 c4 10             	add    $0x10,%esp
+  93:	85 c0                	test   %eax,%eax
+  95:	0f 88 5a 01 00 00    	js     1f5 <main+0x1f5>
+  strcpy(name, dir);
+  9b:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  a1:	56                   	push   %esi
+  a2:	56                   	push   %esi
+  a3:	8d 75 94             	lea    -0x6c(%ebp),%esi
+  a6:	50                   	push   %eax
+  a7:	56                   	push   %esi
+  a8:	e8 e3 01 00 00       	call   290 <strcpy>
+  strcpy(name + 3, "/f00");
+  ad:	5f                   	pop    %edi
+  ae:	58                   	pop    %eax
+  af:	8d 45 97             	lea    -0x69(%ebp),%eax
+  b2:	68 da 0c 00 00       	push   $0xcda
+  for(i = 0; i < NFILE; i++){
+  b7:	31 ff                	xor    %edi,%edi
+  strcpy(name + 3, "/f00");
+  b9:	50                   	push   %eax
+  ba:	e8 d1 01 00 00       	call   290 <strcpy>
+    name[5] = '0' + i / 10;
+  bf:	89 9d 34 ff ff ff    	mov    %ebx,-0xcc(%ebp)
+  strcpy(name + 3, "/f00");
+  c5:	83 c4 10             	add    $0x10,%esp
+  c8:	eb 2d                	jmp    f7 <main+0xf7>
+  ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, data, sizeof(data));
+  d0:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < NFILE; i++){
+  d3:	83 c7 01             	add    $0x1,%edi
+    write(fd, data, sizeof(data));
+  d6:	6a 64                	push   $0x64
+  d8:	68 80 11 00 00       	push   $0x1180
+  dd:	50                   	push   %eax
+  de:	e8 b0 04 00 00       	call   593 <write>
+    close(fd);
+  e3:	89 1c 24             	mov    %ebx,(%esp)
+  e6:	e8 b0 04 00 00       	call   59b <close>
+  for(i = 0; i < NFILE; i++){
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	83 ff 14             	cmp    $0x14,%edi
+  f1:	0f 84 41 01 00 00    	je     238 <main+0x238>
+    name[5] = '0' + i / 10;
+  f7:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    if((fd = open(name, O_CREATE|O_WRONLY)) < 0){
+  fc:	83 ec 08             	sub    $0x8,%esp
+    name[5] = '0' + i / 10;
+  ff:	f7 e7                	mul    %edi
+ 101:	c1 ea 03             	shr    $0x3,%edx
+ 104:	8d 42 30             	lea    0x30(%edx),%eax
+    name[6] = '0' + i % 10;
+ 107:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[5] = '0' + i / 10;
+ 10a:	88 45 99             	mov    %al,-0x67(%ebp)
+    name[6] = '0' + i % 10;
+ 10d:	01 d2                	add    %edx,%edx
+ 10f:	89 f8                	mov    %edi,%eax
+ 111:	29 d0                	sub    %edx,%eax
+ 113:	83 c0 30             	add    $0x30,%eax
+ 116:	88 45 9a             	mov    %al,-0x66(%ebp)
+    if((fd = open(name, O_CREATE|O_WRONLY)) < 0){
+ 119:	68 01 02 00 00       	push   $0x201
+ 11e:	56                   	push   %esi
+ 11f:	e8 8f 04 00 00       	call   5b3 <open>
+ 124:	83 c4 10             	add    $0x10,%esp
+ 127:	89 c3                	mov    %eax,%ebx
+ 129:	85 c0                	test   %eax,%eax
+ 12b:	79 a3                	jns    d0 <main+0xd0>
+      printf(2, "createbench: cannot create %s\n", name);
+ 12d:	51                   	push   %ecx
+ 12e:	56                   	push   %esi
+ 12f:	68 e0 0c 00 00       	push   $0xce0
+ 134:	6a 02                	push   $0x2
+ 136:	e8 35 06 00 00       	call   770 <printf>
+      exit();
+ 13b:	e8 33 04 00 00       	call   573 <exit>
+      creator(i);
+  for(i = 0; i < n; i++)
+ 140:	31 db                	xor    %ebx,%ebx
+ 142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+ 148:	e8 2e 04 00 00       	call   57b <wait>
+  for(i = 0; i < n; i++)
+ 14d:	83 c3 01             	add    $0x1,%ebx
+ 150:	39 f3                	cmp    %esi,%ebx
+ 152:	75 f4                	jne    148 <main+0x148>
+  t = uptime() - t;
+ 154:	e8 b2 04 00 00       	call   60b <uptime>
+ 159:	8b 8d 34 ff ff ff    	mov    -0xcc(%ebp),%ecx
+  iostat(&b);
+ 15f:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - t;
+ 162:	29 c8                	sub    %ecx,%eax
+ 164:	89 c3                	mov    %eax,%ebx
+  iostat(&b);
+ 166:	8d 45 94             	lea    -0x6c(%ebp),%eax
+ 169:	50                   	push   %eax
+ 16a:	e8 d4 04 00 00       	call   643 <iostat>
+  if(t == 0)
+ 16f:	83 c4 10             	add    $0x10,%esp
+ 172:	85 db                	test   %ebx,%ebx
+ 174:	75 05                	jne    17b <main+0x17b>
+    t = 1;
+ 176:	bb 01 00 00 00       	mov    $0x1,%ebx
+
+  c = b.ncommit - a.ncommit;
+  printf(1, "%d creators, %d files each: %d ms, %d files/s, %d commits",
+         n, NFILE, t, n * NFILE * 1000 / t, c);
+ 17b:	69 c6 20 4e 00 00    	imul   $0x4e20,%esi,%eax
+  c = b.ncommit - a.ncommit;
+ 181:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ 184:	2b 7d 84             	sub    -0x7c(%ebp),%edi
+  printf(1, "%d creators, %d files each: %d ms, %d files/s, %d commits",
+ 187:	52                   	push   %edx
+ 188:	57                   	push   %edi
+ 189:	99                   	cltd
+ 18a:	f7 fb                	idiv   %ebx
+ 18c:	50                   	push   %eax
+ 18d:	53                   	push   %ebx
+ 18e:	6a 14                	push   $0x14
+ 190:	56                   	push   %esi
+ 191:	68 00 0d 00 00       	push   $0xd00
+ 196:	6a 01                	push   $0x1
+ 198:	e8 d3 05 00 00       	call   770 <printf>
+  if(c > 0)
+ 19d:	83 c4 20             	add    $0x20,%esp
+ 1a0:	85 ff                	test   %edi,%edi
+ 1a2:	75 6a                	jne    20e <main+0x20e>
+    printf(1, " of %d blocks avg, %d Kcycles avg",
+           (b.commitblocks - a.commitblocks) / c,
+           (b.commitlat - a.commitlat) / c);
+  printf(1, "\n");
+ 1a4:	50                   	push   %eax
+ 1a5:	50                   	push   %eax
+ 1a6:	68 d8 0c 00 00       	push   $0xcd8
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	e8 be 05 00 00       	call   770 <printf>
+  exit();
+ 1b2:	e8 bc 03 00 00       	call   573 <exit>
+  n = argc > 1 ? atoi(argv[1]) : NCREATOR;
+ 1b7:	83 ec 0c             	sub    $0xc,%esp
+ 1ba:	ff 70 04             	push   0x4(%eax)
+ 1bd:	e8 9e 02 00 00       	call   460 <atoi>
+  if(n < 1 || n > MAXC)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : NCREATOR;
+ 1c5:	89 c6                	mov    %eax,%esi
+  if(n < 1 || n > MAXC)
+ 1c7:	8d 40 ff             	lea    -0x1(%eax),%eax
+ 1ca:	83 f8 07             	cmp    $0x7,%eax
+ 1cd:	0f 87 50 fe ff ff    	ja     23 <main+0x23>
+  iostat(&a);
+ 1d3:	83 ec 0c             	sub    $0xc,%esp
+ 1d6:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+ 1dc:	50                   	push   %eax
+ 1dd:	e8 61 04 00 00       	call   643 <iostat>
+  t = uptime();
+ 1e2:	e8 24 04 00 00       	call   60b <uptime>
+ 1e7:	83 c4 10             	add    $0x10,%esp
+ 1ea:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%ebp)
+  for(i = 0; i < n; i++)
+ 1f0:	e9 50 fe ff ff       	jmp    45 <main+0x45>
+    printf(2, "createbench: cannot mkdir %s\n", dir);
+ 1f5:	50                   	push   %eax
+ 1f6:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+ 1fc:	50                   	push   %eax
+ 1fd:	68 bc 0c 00 00       	push   $0xcbc
+ 202:	6a 02                	push   $0x2
+ 204:	e8 67 05 00 00       	call   770 <printf>
+    exit();
+ 209:	e8 65 03 00 00       	call   573 <exit>
+           (b.commitlat - a.commitlat) / c);
+ 20e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    printf(1, " of %d blocks avg, %d Kcycles avg",
+ 211:	31 d2                	xor    %edx,%edx
+           (b.commitlat - a.commitlat) / c);
+ 213:	2b 45 8c             	sub    -0x74(%ebp),%eax
+    printf(1, " of %d blocks avg, %d Kcycles avg",
+ 216:	f7 f7                	div    %edi
+ 218:	31 d2                	xor    %edx,%edx
+ 21a:	50                   	push   %eax
+           (b.commitblocks - a.commitblocks) / c,
+ 21b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 21e:	2b 45 88             	sub    -0x78(%ebp),%eax
+    printf(1, " of %d blocks avg, %d Kcycles avg",
+ 221:	f7 f7                	div    %edi
+ 223:	50                   	push   %eax
+ 224:	68 3c 0d 00 00       	push   $0xd3c
+ 229:	6a 01                	push   $0x1
+ 22b:	e8 40 05 00 00       	call   770 <printf>
+ 230:	83 c4 10             	add    $0x10,%esp
+ 233:	e9 6c ff ff ff       	jmp    1a4 <main+0x1a4>
+    name[5] = '0' + i / 10;
+ 238:	8b 9d 34 ff ff ff    	mov    -0xcc(%ebp),%ebx
+ 23e:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	89 d8                	mov    %ebx,%eax
+    unlink(name);
+ 24a:	83 ec 0c             	sub    $0xc,%esp
+    name[5] = '0' + i / 10;
+ 24d:	f7 e7                	mul    %edi
+ 24f:	c1 ea 03             	shr    $0x3,%edx
+ 252:	8d 42 30             	lea    0x30(%edx),%eax
+    name[6] = '0' + i % 10;
+ 255:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[5] = '0' + i / 10;
+ 258:	88 45 99             	mov    %al,-0x67(%ebp)
+    name[6] = '0' + i % 10;
+ 25b:	01 d2                	add    %edx,%edx
+ 25d:	89 d8                	mov    %ebx,%eax
+  for(i = 0; i < NFILE; i++){
+ 25f:	83 c3 01             	add    $0x1,%ebx
+    name[6] = '0' + i % 10;
+ 262:	29 d0                	sub    %edx,%eax
+ 264:	83 c0 30             	add    $0x30,%eax
+ 267:	88 45 9a             	mov    %al,-0x66(%ebp)
+    unlink(name);
+ 26a:	56                   	push   %esi
+ 26b:	e8 53 03 00 00       	call   5c3 <unlink>
+  for(i = 0; i < NFILE; i++){
+ 270:	83 c4 10             	add    $0x10,%esp
+ 273:	83 fb 14             	cmp    $0x14,%ebx
+ 276:	75 d0                	jne    248 <main+0x248>
+  unlink(dir);
+ 278:	83 ec 0c             	sub    $0xc,%esp
+ 27b:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+ 281:	50                   	push   %eax
+ 282:	e8 3c 03 00 00       	call   5c3 <unlink>
+  exit();
+ 287:	e8 e7 02 00 00       	call   573 <exit>
+ 28c:	66 90                	xchg   %ax,%ax
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 290:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 291:	31 c0                	xor    %eax,%eax
+{
+ 293:	89 e5                	mov    %esp,%ebp
+ 295:	53                   	push   %ebx
+ 296:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 299:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2a7:	83 c0 01             	add    $0x1,%eax
+ 2aa:	84 d2                	test   %dl,%dl
+ 2ac:	75 f2                	jne    2a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b1:	89 c8                	mov    %ecx,%eax
+ 2b3:	c9                   	leave
+ 2b4:	c3                   	ret
+ 2b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ca:	0f b6 02             	movzbl (%edx),%eax
+ 2cd:	84 c0                	test   %al,%al
+ 2cf:	75 17                	jne    2e8 <strcmp+0x28>
+ 2d1:	eb 3a                	jmp    30d <strcmp+0x4d>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2dc:	83 c2 01             	add    $0x1,%edx
+ 2df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2e2:	84 c0                	test   %al,%al
+ 2e4:	74 1a                	je     300 <strcmp+0x40>
+    p++, q++;
+ 2e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2eb:	38 c3                	cmp    %al,%bl
+ 2ed:	74 e9                	je     2d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2ef:	29 d8                	sub    %ebx,%eax
+}
+ 2f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f4:	c9                   	leave
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 300:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 304:	31 c0                	xor    %eax,%eax
+ 306:	29 d8                	sub    %ebx,%eax
+}
+ 308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 30b:	c9                   	leave
+ 30c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 30d:	0f b6 19             	movzbl (%ecx),%ebx
+ 310:	31 c0                	xor    %eax,%eax
+ 312:	eb db                	jmp    2ef <strcmp+0x2f>
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 326:	80 3a 00             	cmpb   $0x0,(%edx)
+ 329:	74 15                	je     340 <strlen+0x20>
+ 32b:	31 c0                	xor    %eax,%eax
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+ 330:	83 c0 01             	add    $0x1,%eax
+ 333:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 337:	89 c1                	mov    %eax,%ecx
+ 339:	75 f5                	jne    330 <strlen+0x10>
+    ;
+  return n;
+}
+ 33b:	89 c8                	mov    %ecx,%eax
+ 33d:	5d                   	pop    %ebp
+ 33e:	c3                   	ret
+ 33f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 340:	31 c9                	xor    %ecx,%ecx
+}
+ 342:	5d                   	pop    %ebp
+ 343:	89 c8                	mov    %ecx,%eax
+ 345:	c3                   	ret
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 357:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 35a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 35d:	89 d7                	mov    %edx,%edi
+ 35f:	fc                   	cld
+ 360:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 362:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 365:	89 d0                	mov    %edx,%eax
+ 367:	c9                   	leave
+ 368:	c3                   	ret
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 37a:	0f b6 10             	movzbl (%eax),%edx
+ 37d:	84 d2                	test   %dl,%dl
+ 37f:	75 12                	jne    393 <strchr+0x23>
+ 381:	eb 1d                	jmp    3a0 <strchr+0x30>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 38c:	83 c0 01             	add    $0x1,%eax
+ 38f:	84 d2                	test   %dl,%dl
+ 391:	74 0d                	je     3a0 <strchr+0x30>
+    if(*s == c)
+ 393:	38 d1                	cmp    %dl,%cl
+ 395:	75 f1                	jne    388 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 397:	5d                   	pop    %ebp
+ 398:	c3                   	ret
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3a0:	31 c0                	xor    %eax,%eax
+}
+ 3a2:	5d                   	pop    %ebp
+ 3a3:	c3                   	ret
+ 3a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+
+000003b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3b9:	31 db                	xor    %ebx,%ebx
+{
+ 3bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3be:	eb 27                	jmp    3e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3c0:	83 ec 04             	sub    $0x4,%esp
+ 3c3:	6a 01                	push   $0x1
+ 3c5:	56                   	push   %esi
+ 3c6:	6a 00                	push   $0x0
+ 3c8:	e8 be 01 00 00       	call   58b <read>
+    if(cc < 1)
+ 3cd:	83 c4 10             	add    $0x10,%esp
+ 3d0:	85 c0                	test   %eax,%eax
+ 3d2:	7e 1d                	jle    3f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3df:	3c 0a                	cmp    $0xa,%al
+ 3e1:	74 10                	je     3f3 <gets+0x43>
+ 3e3:	3c 0d                	cmp    $0xd,%al
+ 3e5:	74 0c                	je     3f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3e7:	89 df                	mov    %ebx,%edi
+ 3e9:	83 c3 01             	add    $0x1,%ebx
+ 3ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3ef:	7c cf                	jl     3c0 <gets+0x10>
+ 3f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3fd:	5b                   	pop    %ebx
+ 3fe:	5e                   	pop    %esi
+ 3ff:	5f                   	pop    %edi
+ 400:	5d                   	pop    %ebp
+ 401:	c3                   	ret
+ 402:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	56                   	push   %esi
+ 414:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 415:	83 ec 08             	sub    $0x8,%esp
+ 418:	6a 00                	push   $0x0
+ 41a:	ff 75 08             	push   0x8(%ebp)
+ 41d:	e8 91 01 00 00       	call   5b3 <open>
+  if(fd < 0)
+ 422:	83 c4 10             	add    $0x10,%esp
+ 425:	85 c0                	test   %eax,%eax
+ 427:	78 27                	js     450 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 429:	83 ec 08             	sub    $0x8,%esp
+ 42c:	ff 75 0c             	push   0xc(%ebp)
+ 42f:	89 c3                	mov    %eax,%ebx
+ 431:	50                   	push   %eax
+ 432:	e8 94 01 00 00       	call   5cb <fstat>
+  close(fd);
+ 437:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 43a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 43c:	e8 5a 01 00 00       	call   59b <close>
+  return r;
+ 441:	83 c4 10             	add    $0x10,%esp
+}
+ 444:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 447:	89 f0                	mov    %esi,%eax
+ 449:	5b                   	pop    %ebx
+ 44a:	5e                   	pop    %esi
+ 44b:	5d                   	pop    %ebp
+ 44c:	c3                   	ret
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 450:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 455:	eb ed                	jmp    444 <stat+0x34>
+ 457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+ 465:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 468:	0f b6 02             	movzbl (%edx),%eax
+ 46b:	3c 20                	cmp    $0x20,%al
+ 46d:	75 0c                	jne    47b <atoi+0x1b>
+ 46f:	90                   	nop
+ 470:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 474:	83 c2 01             	add    $0x1,%edx
+ 477:	3c 20                	cmp    $0x20,%al
+ 479:	74 f5                	je     470 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 47b:	3c 2d                	cmp    $0x2d,%al
+ 47d:	74 41                	je     4c0 <atoi+0x60>
+ 47f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 484:	3c 2b                	cmp    $0x2b,%al
+ 486:	74 3d                	je     4c5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 488:	0f be 0a             	movsbl (%edx),%ecx
+ 48b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 48e:	3c 09                	cmp    $0x9,%al
+ 490:	b8 00 00 00 00       	mov    $0x0,%eax
+ 495:	77 21                	ja     4b8 <atoi+0x58>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4a0:	83 c2 01             	add    $0x1,%edx
+ 4a3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 4a6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 4aa:	0f be 0a             	movsbl (%edx),%ecx
+ 4ad:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4b0:	80 fb 09             	cmp    $0x9,%bl
+ 4b3:	76 eb                	jbe    4a0 <atoi+0x40>
+  return sign*n;
+ 4b5:	0f af c6             	imul   %esi,%eax
+}
+ 4b8:	5b                   	pop    %ebx
+ 4b9:	5e                   	pop    %esi
+ 4ba:	5d                   	pop    %ebp
+ 4bb:	c3                   	ret
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 4c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 4c5:	83 c2 01             	add    $0x1,%edx
+ 4c8:	eb be                	jmp    488 <atoi+0x28>
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004d0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	56                   	push   %esi
+ 4d4:	53                   	push   %ebx
+ 4d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4d8:	0f b6 02             	movzbl (%edx),%eax
+ 4db:	3c 20                	cmp    $0x20,%al
+ 4dd:	75 0c                	jne    4eb <atoo+0x1b>
+ 4df:	90                   	nop
+ 4e0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 4e4:	83 c2 01             	add    $0x1,%edx
+ 4e7:	3c 20                	cmp    $0x20,%al
+ 4e9:	74 f5                	je     4e0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4eb:	3c 2d                	cmp    $0x2d,%al
+ 4ed:	74 41                	je     530 <atoo+0x60>
+ 4ef:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4f4:	3c 2b                	cmp    $0x2b,%al
+ 4f6:	74 3d                	je     535 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 4f8:	0f be 0a             	movsbl (%edx),%ecx
+ 4fb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4fe:	3c 07                	cmp    $0x7,%al
+ 500:	b8 00 00 00 00       	mov    $0x0,%eax
+ 505:	77 1e                	ja     525 <atoo+0x55>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 510:	83 c2 01             	add    $0x1,%edx
+ 513:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 517:	0f be 0a             	movsbl (%edx),%ecx
+ 51a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 51d:	80 fb 07             	cmp    $0x7,%bl
+ 520:	76 ee                	jbe    510 <atoo+0x40>
+  return sign*n;
+ 522:	0f af c6             	imul   %esi,%eax
+}
+ 525:	5b                   	pop    %ebx
+ 526:	5e                   	pop    %esi
+ 527:	5d                   	pop    %ebp
+ 528:	c3                   	ret
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 530:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 535:	83 c2 01             	add    $0x1,%edx
+ 538:	eb be                	jmp    4f8 <atoo+0x28>
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000540 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	8b 45 10             	mov    0x10(%ebp),%eax
+ 548:	8b 55 08             	mov    0x8(%ebp),%edx
+ 54b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 54e:	85 c0                	test   %eax,%eax
+ 550:	7e 13                	jle    565 <memmove+0x25>
+ 552:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 554:	89 d7                	mov    %edx,%edi
+ 556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 560:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 561:	39 f8                	cmp    %edi,%eax
+ 563:	75 fb                	jne    560 <memmove+0x20>
+  return vdst;
+}
+ 565:	5e                   	pop    %esi
+ 566:	89 d0                	mov    %edx,%eax
+ 568:	5f                   	pop    %edi
+ 569:	5d                   	pop    %ebp
+ 56a:	c3                   	ret
+
+0000056b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 56b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <exit>:
+SYSCALL(exit)
+ 573:	b8 02 00 00 00       	mov    $0x2,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <wait>:
+SYSCALL(wait)
+ 57b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <pipe>:
+SYSCALL(pipe)
+ 583:	b8 04 00 00 00       	mov    $0x4,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <read>:
+SYSCALL(read)
+ 58b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <write>:
+SYSCALL(write)
+ 593:	b8 10 00 00 00       	mov    $0x10,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <close>:
+SYSCALL(close)
+ 59b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <kill>:
+SYSCALL(kill)
+ 5a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <exec>:
+SYSCALL(exec)
+ 5ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <open>:
+SYSCALL(open)
+ 5b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <mknod>:
+SYSCALL(mknod)
+ 5bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <unlink>:
+SYSCALL(unlink)
+ 5c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <fstat>:
+SYSCALL(fstat)
+ 5cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <link>:
+SYSCALL(link)
+ 5d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <mkdir>:
+SYSCALL(mkdir)
+ 5db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <chdir>:
+SYSCALL(chdir)
+ 5e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <dup>:
+SYSCALL(dup)
+ 5eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getpid>:
+SYSCALL(getpid)
+ 5f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <sbrk>:
+SYSCALL(sbrk)
+ 5fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <sleep>:
+SYSCALL(sleep)
+ 603:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <uptime>:
+SYSCALL(uptime)
+ 60b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <superpages>:
+SYSCALL(superpages)
+ 613:	b8 23 00 00 00       	mov    $0x23,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mmap>:
+SYSCALL(mmap)
+ 61b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <munmap>:
+SYSCALL(munmap)
+ 623:	b8 25 00 00 00       	mov    $0x25,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <spawn>:
+SYSCALL(spawn)
+ 62b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <swapstat>:
+SYSCALL(swapstat)
+ 633:	b8 27 00 00 00       	mov    $0x27,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 63b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <iostat>:
+SYSCALL(iostat)
+ 643:	b8 29 00 00 00       	mov    $0x29,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <dropcache>:
+SYSCALL(dropcache)
+ 64b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <iosched>:
+SYSCALL(iosched)
+ 653:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <halt>:
+SYSCALL(halt)
+ 65b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <date>:
+SYSCALL(date)
+ 663:	b8 17 00 00 00       	mov    $0x17,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 66b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <getgid>:
+SYSCALL(getgid)
+ 673:	b8 19 00 00 00       	mov    $0x19,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <getppid>:
+SYSCALL(getppid)
+ 67b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <setuid>:
+SYSCALL(setuid)
+ 683:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <setgid>:
+SYSCALL(setgid)
+ 68b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <getprocs>:
+SYSCALL(getprocs)
+ 693:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 69b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <getpriority>:
+SYSCALL(getpriority)
+ 6a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 6ab:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <chown>:
+SYSCALL(chown)
+ 6b3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <chgrp>:
+SYSCALL(chgrp)
+ 6bb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+ 6c3:	66 90                	xchg   %ax,%ax
+ 6c5:	66 90                	xchg   %ax,%ax
+ 6c7:	66 90                	xchg   %ax,%ax
+ 6c9:	66 90                	xchg   %ax,%ax
+ 6cb:	66 90                	xchg   %ax,%ax
+ 6cd:	66 90                	xchg   %ax,%ax
+ 6cf:	90                   	nop
+
+000006d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6d8:	89 d1                	mov    %edx,%ecx
+{
+ 6da:	83 ec 3c             	sub    $0x3c,%esp
+ 6dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6e0:	85 d2                	test   %edx,%edx
+ 6e2:	0f 89 80 00 00 00    	jns    768 <printint+0x98>
+ 6e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ec:	74 7a                	je     768 <printint+0x98>
+    x = -xx;
+ 6ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6f8:	31 f6                	xor    %esi,%esi
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 700:	89 c8                	mov    %ecx,%eax
+ 702:	31 d2                	xor    %edx,%edx
+ 704:	89 f7                	mov    %esi,%edi
+ 706:	f7 f3                	div    %ebx
+ 708:	8d 76 01             	lea    0x1(%esi),%esi
+ 70b:	0f b6 92 c0 0d 00 00 	movzbl 0xdc0(%edx),%edx
+ 712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 716:	89 ca                	mov    %ecx,%edx
+ 718:	89 c1                	mov    %eax,%ecx
+ 71a:	39 da                	cmp    %ebx,%edx
+ 71c:	73 e2                	jae    700 <printint+0x30>
+  if(neg)
+ 71e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 721:	85 c0                	test   %eax,%eax
+ 723:	74 07                	je     72c <printint+0x5c>
+    buf[i++] = '-';
+ 725:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 72a:	89 f7                	mov    %esi,%edi
+ 72c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 72f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 732:	01 df                	add    %ebx,%edi
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 738:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 741:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 744:	6a 01                	push   $0x1
+ 746:	50                   	push   %eax
+ 747:	56                   	push   %esi
+ 748:	e8 46 fe ff ff       	call   593 <write>
+  while(--i >= 0)
+ 74d:	89 f8                	mov    %edi,%eax
+ 74f:	83 c4 10             	add    $0x10,%esp
+ 752:	83 ef 01             	sub    $0x1,%edi
+ 755:	39 d8                	cmp    %ebx,%eax
+ 757:	75 df                	jne    738 <printint+0x68>
+}
+ 759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75c:	5b                   	pop    %ebx
+ 75d:	5e                   	pop    %esi
+ 75e:	5f                   	pop    %edi
+ 75f:	5d                   	pop    %ebp
+ 760:	c3                   	ret
+ 761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 768:	31 c0                	xor    %eax,%eax
+ 76a:	eb 89                	jmp    6f5 <printint+0x25>
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 779:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 77c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 77f:	0f b6 1e             	movzbl (%esi),%ebx
+ 782:	83 c6 01             	add    $0x1,%esi
+ 785:	84 db                	test   %bl,%bl
+ 787:	74 67                	je     7f0 <printf+0x80>
+ 789:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 78c:	31 d2                	xor    %edx,%edx
+ 78e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 791:	eb 34                	jmp    7c7 <printf+0x57>
+ 793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 797:	90                   	nop
+ 798:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 79b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7a0:	83 f8 25             	cmp    $0x25,%eax
+ 7a3:	74 18                	je     7bd <printf+0x4d>
+  write(fd, &c, 1);
+ 7a5:	83 ec 04             	sub    $0x4,%esp
+ 7a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ae:	6a 01                	push   $0x1
+ 7b0:	50                   	push   %eax
+ 7b1:	57                   	push   %edi
+ 7b2:	e8 dc fd ff ff       	call   593 <write>
+ 7b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c0:	83 c6 01             	add    $0x1,%esi
+ 7c3:	84 db                	test   %bl,%bl
+ 7c5:	74 29                	je     7f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ca:	85 d2                	test   %edx,%edx
+ 7cc:	74 ca                	je     798 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ce:	83 fa 25             	cmp    $0x25,%edx
+ 7d1:	75 ea                	jne    7bd <printf+0x4d>
+      if(c == 'd'){
+ 7d3:	83 f8 25             	cmp    $0x25,%eax
+ 7d6:	0f 84 24 01 00 00    	je     900 <printf+0x190>
+ 7dc:	83 e8 63             	sub    $0x63,%eax
+ 7df:	83 f8 15             	cmp    $0x15,%eax
+ 7e2:	77 1c                	ja     800 <printf+0x90>
+ 7e4:	ff 24 85 68 0d 00 00 	jmp    *0xd68(,%eax,4)
+ 7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7f3:	5b                   	pop    %ebx
+ 7f4:	5e                   	pop    %esi
+ 7f5:	5f                   	pop    %edi
+ 7f6:	5d                   	pop    %ebp
+ 7f7:	c3                   	ret
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 806:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 80a:	6a 01                	push   $0x1
+ 80c:	52                   	push   %edx
+ 80d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 810:	57                   	push   %edi
+ 811:	e8 7d fd ff ff       	call   593 <write>
+ 816:	83 c4 0c             	add    $0xc,%esp
+ 819:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 81c:	6a 01                	push   $0x1
+ 81e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 821:	52                   	push   %edx
+ 822:	57                   	push   %edi
+ 823:	e8 6b fd ff ff       	call   593 <write>
+        putc(fd, c);
+ 828:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82b:	31 d2                	xor    %edx,%edx
+ 82d:	eb 8e                	jmp    7bd <printf+0x4d>
+ 82f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 00                	push   $0x0
+ 83f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 841:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 844:	e8 87 fe ff ff       	call   6d0 <printint>
+        ap++;
+ 849:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 84c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 67 ff ff ff       	jmp    7bd <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 860:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 863:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 865:	83 c0 04             	add    $0x4,%eax
+ 868:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 86b:	85 db                	test   %ebx,%ebx
+ 86d:	0f 84 9d 00 00 00    	je     910 <printf+0x1a0>
+        while(*s != 0){
+ 873:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 876:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 878:	84 c0                	test   %al,%al
+ 87a:	0f 84 3d ff ff ff    	je     7bd <printf+0x4d>
+ 880:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 883:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 886:	89 de                	mov    %ebx,%esi
+ 888:	89 d3                	mov    %edx,%ebx
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 896:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	53                   	push   %ebx
+ 89c:	57                   	push   %edi
+ 89d:	e8 f1 fc ff ff       	call   593 <write>
+        while(*s != 0){
+ 8a2:	0f b6 06             	movzbl (%esi),%eax
+ 8a5:	83 c4 10             	add    $0x10,%esp
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	75 e4                	jne    890 <printf+0x120>
+      state = 0;
+ 8ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 07 ff ff ff       	jmp    7bd <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8cb:	8b 13                	mov    (%ebx),%edx
+ 8cd:	6a 01                	push   $0x1
+ 8cf:	e9 6b ff ff ff       	jmp    83f <printf+0xcf>
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8db:	83 ec 04             	sub    $0x4,%esp
+ 8de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	52                   	push   %edx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 a1 fc ff ff       	call   593 <write>
+        ap++;
+ 8f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8f8:	31 d2                	xor    %edx,%edx
+ 8fa:	e9 be fe ff ff       	jmp    7bd <printf+0x4d>
+ 8ff:	90                   	nop
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 906:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 909:	6a 01                	push   $0x1
+ 90b:	e9 11 ff ff ff       	jmp    821 <printf+0xb1>
+ 910:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 915:	bb 5e 0d 00 00       	mov    $0xd5e,%ebx
+ 91a:	e9 61 ff ff ff       	jmp    880 <printf+0x110>
+ 91f:	90                   	nop
+
+00000920 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 923:	a1 24 12 00 00       	mov    0x1224,%eax
+{
+ 928:	89 e5                	mov    %esp,%ebp
+ 92a:	56                   	push   %esi
+ 92b:	53                   	push   %ebx
+ 92c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 930:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 932:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 934:	39 ca                	cmp    %ecx,%edx
+ 936:	73 30                	jae    968 <lfree+0x48>
+ 938:	39 c1                	cmp    %eax,%ecx
+ 93a:	72 04                	jb     940 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 93c:	39 c2                	cmp    %eax,%edx
+ 93e:	72 f0                	jb     930 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 940:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 943:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 946:	39 f0                	cmp    %esi,%eax
+ 948:	74 26                	je     970 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 94a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 94c:	8b 42 04             	mov    0x4(%edx),%eax
+ 94f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 952:	39 d9                	cmp    %ebx,%ecx
+ 954:	74 30                	je     986 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 956:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 958:	5b                   	pop    %ebx
+  freep = p;
+ 959:	89 15 24 12 00 00    	mov    %edx,0x1224
+}
+ 95f:	5e                   	pop    %esi
+ 960:	5d                   	pop    %ebp
+ 961:	c3                   	ret
+ 962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 968:	39 c1                	cmp    %eax,%ecx
+ 96a:	72 d0                	jb     93c <lfree+0x1c>
+ 96c:	eb c2                	jmp    930 <lfree+0x10>
+ 96e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 970:	03 58 04             	add    0x4(%eax),%ebx
+ 973:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 976:	8b 02                	mov    (%edx),%eax
+ 978:	8b 00                	mov    (%eax),%eax
+ 97a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 97c:	8b 42 04             	mov    0x4(%edx),%eax
+ 97f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 982:	39 d9                	cmp    %ebx,%ecx
+ 984:	75 d0                	jne    956 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 986:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 989:	89 15 24 12 00 00    	mov    %edx,0x1224
+    p->s.size += bp->s.size;
+ 98f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 992:	8b 09                	mov    (%ecx),%ecx
+ 994:	89 0a                	mov    %ecx,(%edx)
+}
+ 996:	5b                   	pop    %ebx
+ 997:	5e                   	pop    %esi
+ 998:	5d                   	pop    %ebp
+ 999:	c3                   	ret
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009a0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	89 c7                	mov    %eax,%edi
+ 9a6:	56                   	push   %esi
+ 9a7:	53                   	push   %ebx
+ 9a8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 9ab:	a1 24 12 00 00       	mov    0x1224,%eax
+ 9b0:	85 c0                	test   %eax,%eax
+ 9b2:	0f 84 88 00 00 00    	je     a40 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 9ba:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 9bd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9c2:	39 df                	cmp    %ebx,%edi
+ 9c4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9c7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 9ce:	39 f9                	cmp    %edi,%ecx
+ 9d0:	72 0f                	jb     9e1 <lalloc+0x41>
+ 9d2:	eb 4c                	jmp    a20 <lalloc+0x80>
+ 9d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 9da:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 9dd:	39 f9                	cmp    %edi,%ecx
+ 9df:	73 3f                	jae    a20 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 9e1:	89 d0                	mov    %edx,%eax
+ 9e3:	39 15 24 12 00 00    	cmp    %edx,0x1224
+ 9e9:	75 ed                	jne    9d8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 9eb:	83 ec 0c             	sub    $0xc,%esp
+ 9ee:	56                   	push   %esi
+ 9ef:	e8 07 fc ff ff       	call   5fb <sbrk>
+  if(p == (char*)-1)
+ 9f4:	83 c4 10             	add    $0x10,%esp
+ 9f7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9fa:	74 11                	je     a0d <lalloc+0x6d>
+  hp->s.size = nu;
+ 9fc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 9ff:	e8 1c ff ff ff       	call   920 <lfree>
+  return freep;
+ a04:	a1 24 12 00 00       	mov    0x1224,%eax
+      if((p = morecore(nunits)) == 0)
+ a09:	85 c0                	test   %eax,%eax
+ a0b:	75 cb                	jne    9d8 <lalloc+0x38>
+        return 0;
+  }
+}
+ a0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a10:	31 d2                	xor    %edx,%edx
+}
+ a12:	5b                   	pop    %ebx
+ a13:	89 d0                	mov    %edx,%eax
+ a15:	5e                   	pop    %esi
+ a16:	5f                   	pop    %edi
+ a17:	5d                   	pop    %ebp
+ a18:	c3                   	ret
+ a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ a20:	39 cf                	cmp    %ecx,%edi
+ a22:	74 4c                	je     a70 <lalloc+0xd0>
+        p->s.size -= nunits;
+ a24:	29 f9                	sub    %edi,%ecx
+ a26:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ a29:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ a2c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ a2f:	a3 24 12 00 00       	mov    %eax,0x1224
+}
+ a34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a37:	89 d0                	mov    %edx,%eax
+ a39:	5b                   	pop    %ebx
+ a3a:	5e                   	pop    %esi
+ a3b:	5f                   	pop    %edi
+ a3c:	5d                   	pop    %ebp
+ a3d:	c3                   	ret
+ a3e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ a40:	ba 28 12 00 00       	mov    $0x1228,%edx
+ a45:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ a47:	c7 05 24 12 00 00 28 	movl   $0x1228,0x1224
+ a4e:	12 00 00 
+ a51:	c7 05 28 12 00 00 28 	movl   $0x1228,0x1228
+ a58:	12 00 00 
+ a5b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ a5d:	c7 05 2c 12 00 00 00 	movl   $0x0,0x122c
+ a64:	00 00 00 
+ a67:	e9 51 ff ff ff       	jmp    9bd <lalloc+0x1d>
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ a70:	8b 0a                	mov    (%edx),%ecx
+ a72:	89 08                	mov    %ecx,(%eax)
+ a74:	eb b9                	jmp    a2f <lalloc+0x8f>
+ a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a80 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ a89:	85 f6                	test   %esi,%esi
+ a8b:	74 42                	je     acf <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ a8d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ a90:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ a93:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ a99:	77 3d                	ja     ad8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ a9b:	31 c9                	xor    %ecx,%ecx
+ a9d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ aa2:	83 fa 02             	cmp    $0x2,%edx
+ aa5:	74 17                	je     abe <free+0x3e>
+ aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aae:	66 90                	xchg   %ax,%ax
+ ab0:	83 c1 01             	add    $0x1,%ecx
+ ab3:	89 d8                	mov    %ebx,%eax
+ ab5:	d3 e0                	shl    %cl,%eax
+ ab7:	83 c0 01             	add    $0x1,%eax
+ aba:	39 c2                	cmp    %eax,%edx
+ abc:	75 f2                	jne    ab0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ abe:	8b 04 8d 00 12 00 00 	mov    0x1200(,%ecx,4),%eax
+  classes[c] = bp;
+ ac5:	89 3c 8d 00 12 00 00 	mov    %edi,0x1200(,%ecx,4)
+  bp->s.ptr = classes[c];
+ acc:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ acf:	5b                   	pop    %ebx
+ ad0:	5e                   	pop    %esi
+ ad1:	5f                   	pop    %edi
+ ad2:	5d                   	pop    %ebp
+ ad3:	c3                   	ret
+ ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ad8:	5b                   	pop    %ebx
+    lfree(bp);
+ ad9:	89 f8                	mov    %edi,%eax
+}
+ adb:	5e                   	pop    %esi
+ adc:	5f                   	pop    %edi
+ add:	5d                   	pop    %ebp
+    lfree(bp);
+ ade:	e9 3d fe ff ff       	jmp    920 <lfree>
+ ae3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000af0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af9:	8b 45 08             	mov    0x8(%ebp),%eax
+ afc:	83 c0 07             	add    $0x7,%eax
+ aff:	c1 e8 03             	shr    $0x3,%eax
+ b02:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ b05:	3d 01 01 00 00       	cmp    $0x101,%eax
+ b0a:	77 44                	ja     b50 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ b0c:	31 c9                	xor    %ecx,%ecx
+ b0e:	ba 01 00 00 00       	mov    $0x1,%edx
+ b13:	bb 02 00 00 00       	mov    $0x2,%ebx
+ b18:	83 f8 02             	cmp    $0x2,%eax
+ b1b:	76 11                	jbe    b2e <malloc+0x3e>
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+ b20:	83 c1 01             	add    $0x1,%ecx
+ b23:	89 d3                	mov    %edx,%ebx
+ b25:	d3 e3                	shl    %cl,%ebx
+ b27:	83 c3 01             	add    $0x1,%ebx
+ b2a:	39 c3                	cmp    %eax,%ebx
+ b2c:	72 f2                	jb     b20 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ b2e:	8b 04 8d 00 12 00 00 	mov    0x1200(,%ecx,4),%eax
+ b35:	85 c0                	test   %eax,%eax
+ b37:	74 2f                	je     b68 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ b39:	8b 10                	mov    (%eax),%edx
+ b3b:	89 14 8d 00 12 00 00 	mov    %edx,0x1200(,%ecx,4)
+  return (void*)(p + 1);
+ b42:	83 c0 08             	add    $0x8,%eax
+}
+ b45:	83 c4 1c             	add    $0x1c,%esp
+ b48:	5b                   	pop    %ebx
+ b49:	5e                   	pop    %esi
+ b4a:	5f                   	pop    %edi
+ b4b:	5d                   	pop    %ebp
+ b4c:	c3                   	ret
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ b50:	e8 4b fe ff ff       	call   9a0 <lalloc>
+ b55:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ b57:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ b5a:	85 d2                	test   %edx,%edx
+ b5c:	75 e7                	jne    b45 <malloc+0x55>
+      return 0;
+ b5e:	31 c0                	xor    %eax,%eax
+ b60:	eb e3                	jmp    b45 <malloc+0x55>
+ b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ b68:	31 d2                	xor    %edx,%edx
+ b6a:	b8 00 02 00 00       	mov    $0x200,%eax
+ b6f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b72:	f7 f3                	div    %ebx
+  if(n < 4)
+ b74:	ba 04 00 00 00       	mov    $0x4,%edx
+ b79:	89 d6                	mov    %edx,%esi
+ b7b:	39 d0                	cmp    %edx,%eax
+ b7d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ b80:	0f af f3             	imul   %ebx,%esi
+ b83:	89 f0                	mov    %esi,%eax
+ b85:	e8 16 fe ff ff       	call   9a0 <lalloc>
+ b8a:	85 c0                	test   %eax,%eax
+ b8c:	74 d0                	je     b5e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ b8e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b91:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ b94:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b9b:	8b 14 8d 00 12 00 00 	mov    0x1200(,%ecx,4),%edx
+ ba2:	39 f8                	cmp    %edi,%eax
+ ba4:	73 22                	jae    bc8 <malloc+0xd8>
+ ba6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ ba9:	eb 09                	jmp    bb4 <malloc+0xc4>
+ bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+ bb0:	89 c2                	mov    %eax,%edx
+ bb2:	89 c8                	mov    %ecx,%eax
+ bb4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ bb7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ bba:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ bbc:	39 f9                	cmp    %edi,%ecx
+ bbe:	72 f0                	jb     bb0 <malloc+0xc0>
+ bc0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ bc3:	e9 73 ff ff ff       	jmp    b3b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ bc8:	89 d0                	mov    %edx,%eax
+ bca:	8b 12                	mov    (%edx),%edx
+ bcc:	e9 6a ff ff ff       	jmp    b3b <malloc+0x4b>
+ bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdf:	90                   	nop
+
+00000be0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	56                   	push   %esi
+ be4:	53                   	push   %ebx
+ be5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ be8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ beb:	85 c9                	test   %ecx,%ecx
+ bed:	74 06                	je     bf5 <calloc+0x15>
+ bef:	89 c8                	mov    %ecx,%eax
+ bf1:	f7 e3                	mul    %ebx
+ bf3:	70 33                	jo     c28 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ bf5:	0f af d9             	imul   %ecx,%ebx
+ bf8:	83 ec 0c             	sub    $0xc,%esp
+ bfb:	53                   	push   %ebx
+ bfc:	e8 ef fe ff ff       	call   af0 <malloc>
+ c01:	83 c4 10             	add    $0x10,%esp
+ c04:	89 c6                	mov    %eax,%esi
+ c06:	85 c0                	test   %eax,%eax
+ c08:	74 1e                	je     c28 <calloc+0x48>
+    memset(p, 0, n * size);
+ c0a:	83 ec 04             	sub    $0x4,%esp
+ c0d:	53                   	push   %ebx
+ c0e:	6a 00                	push   $0x0
+ c10:	50                   	push   %eax
+ c11:	e8 3a f7 ff ff       	call   350 <memset>
+ c16:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ c19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c1c:	89 f0                	mov    %esi,%eax
+ c1e:	5b                   	pop    %ebx
+ c1f:	5e                   	pop    %esi
+ c20:	5d                   	pop    %ebp
+ c21:	c3                   	ret
+ c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ c2b:	31 f6                	xor    %esi,%esi
+}
+ c2d:	89 f0                	mov    %esi,%eax
+ c2f:	5b                   	pop    %ebx
+ c30:	5e                   	pop    %esi
+ c31:	5d                   	pop    %ebp
+ c32:	c3                   	ret
+ c33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c40 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	57                   	push   %edi
+ c44:	56                   	push   %esi
+ c45:	53                   	push   %ebx
+ c46:	83 ec 0c             	sub    $0xc,%esp
+ c49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ c4f:	85 db                	test   %ebx,%ebx
+ c51:	74 55                	je     ca8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ c53:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ c56:	89 de                	mov    %ebx,%esi
+ c58:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ c5f:	39 c7                	cmp    %eax,%edi
+ c61:	72 0d                	jb     c70 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c66:	89 f0                	mov    %esi,%eax
+ c68:	5b                   	pop    %ebx
+ c69:	5e                   	pop    %esi
+ c6a:	5f                   	pop    %edi
+ c6b:	5d                   	pop    %ebp
+ c6c:	c3                   	ret
+ c6d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ c70:	83 ec 0c             	sub    $0xc,%esp
+ c73:	50                   	push   %eax
+ c74:	e8 77 fe ff ff       	call   af0 <malloc>
+ c79:	83 c4 10             	add    $0x10,%esp
+ c7c:	89 c6                	mov    %eax,%esi
+ c7e:	85 c0                	test   %eax,%eax
+ c80:	74 e1                	je     c63 <realloc+0x23>
+  memmove(p, ap, have);
+ c82:	83 ec 04             	sub    $0x4,%esp
+ c85:	57                   	push   %edi
+ c86:	53                   	push   %ebx
+ c87:	50                   	push   %eax
+ c88:	e8 b3 f8 ff ff       	call   540 <memmove>
+  free(ap);
+ c8d:	89 1c 24             	mov    %ebx,(%esp)
+ c90:	e8 eb fd ff ff       	call   a80 <free>
+  return p;
+ c95:	83 c4 10             	add    $0x10,%esp
+}
+ c98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c9b:	89 f0                	mov    %esi,%eax
+ c9d:	5b                   	pop    %ebx
+ c9e:	5e                   	pop    %esi
+ c9f:	5f                   	pop    %edi
+ ca0:	5d                   	pop    %ebp
+ ca1:	c3                   	ret
+ ca2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ ca8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cae:	5b                   	pop    %ebx
+ caf:	5e                   	pop    %esi
+ cb0:	5f                   	pop    %edi
+ cb1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ cb2:	e9 39 fe ff ff       	jmp    af0 <malloc>
@@ -0,0 +1,82 @@
+// Measure concurrent file creation.  NCREATOR processes (the
+// argument overrides) each create NFILE small files in a
+// directory of their own, then remove them, so that system calls
+// keep arriving while transactions commit.  Prints the time
+// taken, files per second, and the commits' size and time.
+
+#include "types.h"
+#include "user.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+#define NCREATOR 4
+#define MAXC     8
+#define NFILE    20
+
+char data[100];
+
+static void
+creator(int id)
+{
+  char dir[8], name[16];
+  int i, fd;
+
+  strcpy(dir, "cb0");
+  dir[2] = '0' + id;
+  if(mkdir(dir) < 0){
+    printf(2, "createbench: cannot mkdir %s\n", dir);
+    exit();
+  }
+  strcpy(name, dir);
+  strcpy(name + 3, "/f00");
+  for(i = 0; i < NFILE; i++){
+    name[5] = '0' + i / 10;
+    name[6] = '0' + i % 10;
+    if((fd = open(name, O_CREATE|O_WRONLY)) < 0){
+      printf(2, "createbench: cannot create %s\n", name);
+      exit();
+    }
+    write(fd, data, sizeof(data));
+    close(fd);
+  }
+  for(i = 0; i < NFILE; i++){
+    name[5] = '0' + i / 10;
+    name[6] = '0' + i % 10;
+    unlink(name);
+  }
+  unlink(dir);
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat a, b;
+  int i, n, t;
+  uint c;
+
+  n = argc > 1 ? atoi(argv[1]) : NCREATOR;
+  if(n < 1 || n > MAXC)
+    n = NCREATOR;
+  iostat(&a);
+  t = uptime();
+  for(i = 0; i < n; i++)
+    if(fork() == 0)
+      creator(i);
+  for(i = 0; i < n; i++)
+    wait();
+  t = uptime() - t;
+  iostat(&b);
+  if(t == 0)
+    t = 1;
+
+  c = b.ncommit - a.ncommit;
+  printf(1, "%d creators, %d files each: %d ms, %d files/s, %d commits",
+         n, NFILE, t, n * NFILE * 1000 / t, c);
+  if(c > 0)
+    printf(1, " of %d blocks avg, %d Kcycles avg",
+           (b.commitblocks - a.commitblocks) / c,
+           (b.commitlat - a.commitlat) / c);
+  printf(1, "\n");
+  exit();
+}
@@ -0,0 +1,1768 @@
+
+_date:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  int day;
+  struct rtcdate r;
+
+  if (date(&r)) {
+   f:	8d 45 d0             	lea    -0x30(%ebp),%eax
+{
+  12:	53                   	push   %ebx
+  13:	51                   	push   %ecx
+  14:	83 ec 34             	sub    $0x34,%esp
+  if (date(&r)) {
+  17:	50                   	push   %eax
+  18:	e8 06 05 00 00       	call   523 <date>
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	85 c0                	test   %eax,%eax
+  22:	74 18                	je     3c <main+0x3c>
+    printf(2,"Error: date call failed. %s at line %d\n",
+  24:	6a 1c                	push   $0x1c
+  26:	68 80 0b 00 00       	push   $0xb80
+  2b:	68 f4 0b 00 00       	push   $0xbf4
+  30:	6a 02                	push   $0x2
+  32:	e8 f9 05 00 00       	call   630 <printf>
+        __FILE__, __LINE__);
+    exit();
+  37:	e8 f7 03 00 00       	call   433 <exit>
+  }
+
+  day = dayofweek(r.year, r.month, r.day);
+  3c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  3f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  42:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+  45:	8d 71 fe             	lea    -0x2(%ecx),%esi
+  48:	83 f8 02             	cmp    $0x2,%eax
+  4b:	7f 05                	jg     52 <main+0x52>
+  4d:	89 ce                	mov    %ecx,%esi
+  4f:	83 e9 01             	sub    $0x1,%ecx
+
+  printf(1, "%s %s %d", days[day], months[r.month], r.day);
+  52:	83 ec 0c             	sub    $0xc,%esp
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+  55:	bf 09 00 00 00       	mov    $0x9,%edi
+  printf(1, "%s %s %d", days[day], months[r.month], r.day);
+  5a:	53                   	push   %ebx
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+  5b:	01 f3                	add    %esi,%ebx
+  5d:	be 04 00 00 00       	mov    $0x4,%esi
+  printf(1, "%s %s %d", days[day], months[r.month], r.day);
+  62:	ff 34 85 40 0c 00 00 	push   0xc40(,%eax,4)
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+  69:	6b c0 17             	imul   $0x17,%eax,%eax
+  6c:	99                   	cltd
+  6d:	f7 ff                	idiv   %edi
+  6f:	8d 5c 18 04          	lea    0x4(%eax,%ebx,1),%ebx
+  73:	89 c8                	mov    %ecx,%eax
+  75:	99                   	cltd
+  76:	f7 fe                	idiv   %esi
+  78:	be 9c ff ff ff       	mov    $0xffffff9c,%esi
+  7d:	01 c3                	add    %eax,%ebx
+  7f:	89 c8                	mov    %ecx,%eax
+  81:	99                   	cltd
+  82:	f7 fe                	idiv   %esi
+  84:	be 90 01 00 00       	mov    $0x190,%esi
+  89:	01 c3                	add    %eax,%ebx
+  8b:	89 c8                	mov    %ecx,%eax
+  8d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  92:	99                   	cltd
+  93:	f7 fe                	idiv   %esi
+  95:	01 d8                	add    %ebx,%eax
+  97:	99                   	cltd
+  98:	f7 f9                	idiv   %ecx
+  printf(1, "%s %s %d", days[day], months[r.month], r.day);
+  9a:	ff 34 95 20 0c 00 00 	push   0xc20(,%edx,4)
+  a1:	68 87 0b 00 00       	push   $0xb87
+  a6:	6a 01                	push   $0x1
+  a8:	e8 83 05 00 00       	call   630 <printf>
+  printf(1, " ");
+  ad:	83 c4 18             	add    $0x18,%esp
+  b0:	68 90 0b 00 00       	push   $0xb90
+  b5:	6a 01                	push   $0x1
+  b7:	e8 74 05 00 00       	call   630 <printf>
+  if (r.hour < 10) printf(1, "0");
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	83 7d d8 09          	cmpl   $0x9,-0x28(%ebp)
+  c3:	76 5c                	jbe    121 <main+0x121>
+  printf(1, "%d:", r.hour);
+  c5:	53                   	push   %ebx
+  c6:	ff 75 d8             	push   -0x28(%ebp)
+  c9:	68 94 0b 00 00       	push   $0xb94
+  ce:	6a 01                	push   $0x1
+  d0:	e8 5b 05 00 00       	call   630 <printf>
+  if (r.minute < 10) printf(1, "0");
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	83 7d d4 09          	cmpl   $0x9,-0x2c(%ebp)
+  dc:	76 56                	jbe    134 <main+0x134>
+  printf(1, "%d:", r.minute);
+  de:	52                   	push   %edx
+  df:	ff 75 d4             	push   -0x2c(%ebp)
+  e2:	68 94 0b 00 00       	push   $0xb94
+  e7:	6a 01                	push   $0x1
+  e9:	e8 42 05 00 00       	call   630 <printf>
+  if (r.second < 10) printf(1, "0");
+  ee:	83 c4 10             	add    $0x10,%esp
+  f1:	83 7d d0 09          	cmpl   $0x9,-0x30(%ebp)
+  f5:	76 17                	jbe    10e <main+0x10e>
+  printf(1, "%d UTC %d\n", r.second, r.year);
+  f7:	ff 75 e4             	push   -0x1c(%ebp)
+  fa:	ff 75 d0             	push   -0x30(%ebp)
+  fd:	68 98 0b 00 00       	push   $0xb98
+ 102:	6a 01                	push   $0x1
+ 104:	e8 27 05 00 00       	call   630 <printf>
+
+  exit();
+ 109:	e8 25 03 00 00       	call   433 <exit>
+  if (r.second < 10) printf(1, "0");
+ 10e:	50                   	push   %eax
+ 10f:	50                   	push   %eax
+ 110:	68 92 0b 00 00       	push   $0xb92
+ 115:	6a 01                	push   $0x1
+ 117:	e8 14 05 00 00       	call   630 <printf>
+ 11c:	83 c4 10             	add    $0x10,%esp
+ 11f:	eb d6                	jmp    f7 <main+0xf7>
+  if (r.hour < 10) printf(1, "0");
+ 121:	56                   	push   %esi
+ 122:	56                   	push   %esi
+ 123:	68 92 0b 00 00       	push   $0xb92
+ 128:	6a 01                	push   $0x1
+ 12a:	e8 01 05 00 00       	call   630 <printf>
+ 12f:	83 c4 10             	add    $0x10,%esp
+ 132:	eb 91                	jmp    c5 <main+0xc5>
+  if (r.minute < 10) printf(1, "0");
+ 134:	51                   	push   %ecx
+ 135:	51                   	push   %ecx
+ 136:	68 92 0b 00 00       	push   $0xb92
+ 13b:	6a 01                	push   $0x1
+ 13d:	e8 ee 04 00 00       	call   630 <printf>
+ 142:	83 c4 10             	add    $0x10,%esp
+ 145:	eb 97                	jmp    de <main+0xde>
+ 147:	66 90                	xchg   %ax,%ax
+ 149:	66 90                	xchg   %ax,%ax
+ 14b:	66 90                	xchg   %ax,%ax
+ 14d:	66 90                	xchg   %ax,%ax
+ 14f:	90                   	nop
+
+00000150 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 150:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 151:	31 c0                	xor    %eax,%eax
+{
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	53                   	push   %ebx
+ 156:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 159:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 160:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 164:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 167:	83 c0 01             	add    $0x1,%eax
+ 16a:	84 d2                	test   %dl,%dl
+ 16c:	75 f2                	jne    160 <strcpy+0x10>
+    ;
+  return os;
+}
+ 16e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 171:	89 c8                	mov    %ecx,%eax
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+ 175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	53                   	push   %ebx
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+ 187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 18a:	0f b6 02             	movzbl (%edx),%eax
+ 18d:	84 c0                	test   %al,%al
+ 18f:	75 17                	jne    1a8 <strcmp+0x28>
+ 191:	eb 3a                	jmp    1cd <strcmp+0x4d>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 19c:	83 c2 01             	add    $0x1,%edx
+ 19f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1a2:	84 c0                	test   %al,%al
+ 1a4:	74 1a                	je     1c0 <strcmp+0x40>
+    p++, q++;
+ 1a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1ab:	38 c3                	cmp    %al,%bl
+ 1ad:	74 e9                	je     198 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1af:	29 d8                	sub    %ebx,%eax
+}
+ 1b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b4:	c9                   	leave
+ 1b5:	c3                   	ret
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1c4:	31 c0                	xor    %eax,%eax
+ 1c6:	29 d8                	sub    %ebx,%eax
+}
+ 1c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1cb:	c9                   	leave
+ 1cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1d0:	31 c0                	xor    %eax,%eax
+ 1d2:	eb db                	jmp    1af <strcmp+0x2f>
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1e9:	74 15                	je     200 <strlen+0x20>
+ 1eb:	31 c0                	xor    %eax,%eax
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1f7:	89 c1                	mov    %eax,%ecx
+ 1f9:	75 f5                	jne    1f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1fb:	89 c8                	mov    %ecx,%eax
+ 1fd:	5d                   	pop    %ebp
+ 1fe:	c3                   	ret
+ 1ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 200:	31 c9                	xor    %ecx,%ecx
+}
+ 202:	5d                   	pop    %ebp
+ 203:	89 c8                	mov    %ecx,%eax
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 217:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21d:	89 d7                	mov    %edx,%edi
+ 21f:	fc                   	cld
+ 220:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 222:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 225:	89 d0                	mov    %edx,%eax
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 23a:	0f b6 10             	movzbl (%eax),%edx
+ 23d:	84 d2                	test   %dl,%dl
+ 23f:	75 12                	jne    253 <strchr+0x23>
+ 241:	eb 1d                	jmp    260 <strchr+0x30>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 24c:	83 c0 01             	add    $0x1,%eax
+ 24f:	84 d2                	test   %dl,%dl
+ 251:	74 0d                	je     260 <strchr+0x30>
+    if(*s == c)
+ 253:	38 d1                	cmp    %dl,%cl
+ 255:	75 f1                	jne    248 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 260:	31 c0                	xor    %eax,%eax
+}
+ 262:	5d                   	pop    %ebp
+ 263:	c3                   	ret
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 275:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 278:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 279:	31 db                	xor    %ebx,%ebx
+{
+ 27b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 27e:	eb 27                	jmp    2a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 280:	83 ec 04             	sub    $0x4,%esp
+ 283:	6a 01                	push   $0x1
+ 285:	56                   	push   %esi
+ 286:	6a 00                	push   $0x0
+ 288:	e8 be 01 00 00       	call   44b <read>
+    if(cc < 1)
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	85 c0                	test   %eax,%eax
+ 292:	7e 1d                	jle    2b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 294:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 29f:	3c 0a                	cmp    $0xa,%al
+ 2a1:	74 10                	je     2b3 <gets+0x43>
+ 2a3:	3c 0d                	cmp    $0xd,%al
+ 2a5:	74 0c                	je     2b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2a7:	89 df                	mov    %ebx,%edi
+ 2a9:	83 c3 01             	add    $0x1,%ebx
+ 2ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2af:	7c cf                	jl     280 <gets+0x10>
+ 2b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+ 2c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+ 2d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	6a 00                	push   $0x0
+ 2da:	ff 75 08             	push   0x8(%ebp)
+ 2dd:	e8 91 01 00 00       	call   473 <open>
+  if(fd < 0)
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	85 c0                	test   %eax,%eax
+ 2e7:	78 27                	js     310 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2e9:	83 ec 08             	sub    $0x8,%esp
+ 2ec:	ff 75 0c             	push   0xc(%ebp)
+ 2ef:	89 c3                	mov    %eax,%ebx
+ 2f1:	50                   	push   %eax
+ 2f2:	e8 94 01 00 00       	call   48b <fstat>
+  close(fd);
+ 2f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2fc:	e8 5a 01 00 00       	call   45b <close>
+  return r;
+ 301:	83 c4 10             	add    $0x10,%esp
+}
+ 304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 307:	89 f0                	mov    %esi,%eax
+ 309:	5b                   	pop    %ebx
+ 30a:	5e                   	pop    %esi
+ 30b:	5d                   	pop    %ebp
+ 30c:	c3                   	ret
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 315:	eb ed                	jmp    304 <stat+0x34>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+ 325:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 328:	0f b6 02             	movzbl (%edx),%eax
+ 32b:	3c 20                	cmp    $0x20,%al
+ 32d:	75 0c                	jne    33b <atoi+0x1b>
+ 32f:	90                   	nop
+ 330:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 334:	83 c2 01             	add    $0x1,%edx
+ 337:	3c 20                	cmp    $0x20,%al
+ 339:	74 f5                	je     330 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 33b:	3c 2d                	cmp    $0x2d,%al
+ 33d:	74 41                	je     380 <atoi+0x60>
+ 33f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 344:	3c 2b                	cmp    $0x2b,%al
+ 346:	74 3d                	je     385 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 348:	0f be 0a             	movsbl (%edx),%ecx
+ 34b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 34e:	3c 09                	cmp    $0x9,%al
+ 350:	b8 00 00 00 00       	mov    $0x0,%eax
+ 355:	77 21                	ja     378 <atoi+0x58>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 360:	83 c2 01             	add    $0x1,%edx
+ 363:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 366:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 36a:	0f be 0a             	movsbl (%edx),%ecx
+ 36d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 370:	80 fb 09             	cmp    $0x9,%bl
+ 373:	76 eb                	jbe    360 <atoi+0x40>
+  return sign*n;
+ 375:	0f af c6             	imul   %esi,%eax
+}
+ 378:	5b                   	pop    %ebx
+ 379:	5e                   	pop    %esi
+ 37a:	5d                   	pop    %ebp
+ 37b:	c3                   	ret
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 385:	83 c2 01             	add    $0x1,%edx
+ 388:	eb be                	jmp    348 <atoi+0x28>
+ 38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000390 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	56                   	push   %esi
+ 394:	53                   	push   %ebx
+ 395:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 398:	0f b6 02             	movzbl (%edx),%eax
+ 39b:	3c 20                	cmp    $0x20,%al
+ 39d:	75 0c                	jne    3ab <atoo+0x1b>
+ 39f:	90                   	nop
+ 3a0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 3a4:	83 c2 01             	add    $0x1,%edx
+ 3a7:	3c 20                	cmp    $0x20,%al
+ 3a9:	74 f5                	je     3a0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 3ab:	3c 2d                	cmp    $0x2d,%al
+ 3ad:	74 41                	je     3f0 <atoo+0x60>
+ 3af:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 3b4:	3c 2b                	cmp    $0x2b,%al
+ 3b6:	74 3d                	je     3f5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 3b8:	0f be 0a             	movsbl (%edx),%ecx
+ 3bb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 3be:	3c 07                	cmp    $0x7,%al
+ 3c0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3c5:	77 1e                	ja     3e5 <atoo+0x55>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 3d0:	83 c2 01             	add    $0x1,%edx
+ 3d3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 3d7:	0f be 0a             	movsbl (%edx),%ecx
+ 3da:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 3dd:	80 fb 07             	cmp    $0x7,%bl
+ 3e0:	76 ee                	jbe    3d0 <atoo+0x40>
+  return sign*n;
+ 3e2:	0f af c6             	imul   %esi,%eax
+}
+ 3e5:	5b                   	pop    %ebx
+ 3e6:	5e                   	pop    %esi
+ 3e7:	5d                   	pop    %ebp
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 3f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 3f5:	83 c2 01             	add    $0x1,%edx
+ 3f8:	eb be                	jmp    3b8 <atoo+0x28>
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 13                	jle    425 <memmove+0x25>
+ 412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 414:	89 d7                	mov    %edx,%edi
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 421:	39 f8                	cmp    %edi,%eax
+ 423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+ 425:	5e                   	pop    %esi
+ 426:	89 d0                	mov    %edx,%eax
+ 428:	5f                   	pop    %edi
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+
+0000042b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 42b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <exit>:
+SYSCALL(exit)
+ 433:	b8 02 00 00 00       	mov    $0x2,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <wait>:
+SYSCALL(wait)
+ 43b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <pipe>:
+SYSCALL(pipe)
+ 443:	b8 04 00 00 00       	mov    $0x4,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <read>:
+SYSCALL(read)
+ 44b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <write>:
+SYSCALL(write)
+ 453:	b8 10 00 00 00       	mov    $0x10,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <close>:
+SYSCALL(close)
+ 45b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <kill>:
+SYSCALL(kill)
+ 463:	b8 06 00 00 00       	mov    $0x6,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <exec>:
+SYSCALL(exec)
+ 46b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <open>:
+SYSCALL(open)
+ 473:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mknod>:
+SYSCALL(mknod)
+ 47b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <unlink>:
+SYSCALL(unlink)
+ 483:	b8 12 00 00 00       	mov    $0x12,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <fstat>:
+SYSCALL(fstat)
+ 48b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <link>:
+SYSCALL(link)
+ 493:	b8 13 00 00 00       	mov    $0x13,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mkdir>:
+SYSCALL(mkdir)
+ 49b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <chdir>:
+SYSCALL(chdir)
+ 4a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <dup>:
+SYSCALL(dup)
+ 4ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getpid>:
+SYSCALL(getpid)
+ 4b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <sbrk>:
+SYSCALL(sbrk)
+ 4bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <sleep>:
+SYSCALL(sleep)
+ 4c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <uptime>:
+SYSCALL(uptime)
+ 4cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <superpages>:
+SYSCALL(superpages)
+ 4d3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mmap>:
+SYSCALL(mmap)
+ 4db:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <munmap>:
+SYSCALL(munmap)
+ 4e3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <spawn>:
+SYSCALL(spawn)
+ 4eb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <swapstat>:
+SYSCALL(swapstat)
+ 4f3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <getmeminfo>:
+SYSCALL(getmeminfo)
+ 4fb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <iostat>:
+SYSCALL(iostat)
+ 503:	b8 29 00 00 00       	mov    $0x29,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <dropcache>:
+SYSCALL(dropcache)
+ 50b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <iosched>:
+SYSCALL(iosched)
+ 513:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <halt>:
+SYSCALL(halt)
+ 51b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <date>:
+SYSCALL(date)
+ 523:	b8 17 00 00 00       	mov    $0x17,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 52b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <getgid>:
+SYSCALL(getgid)
+ 533:	b8 19 00 00 00       	mov    $0x19,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <getppid>:
+SYSCALL(getppid)
+ 53b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <setuid>:
+SYSCALL(setuid)
+ 543:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <setgid>:
+SYSCALL(setgid)
+ 54b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <getprocs>:
+SYSCALL(getprocs)
+ 553:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 55b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getpriority>:
+SYSCALL(getpriority)
+ 563:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 56b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <chown>:
+SYSCALL(chown)
+ 573:	b8 21 00 00 00       	mov    $0x21,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <chgrp>:
+SYSCALL(chgrp)
+ 57b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+ 583:	66 90                	xchg   %ax,%ax
+ 585:	66 90                	xchg   %ax,%ax
+ 587:	66 90                	xchg   %ax,%ax
+ 589:	66 90                	xchg   %ax,%ax
+ 58b:	66 90                	xchg   %ax,%ax
+ 58d:	66 90                	xchg   %ax,%ax
+ 58f:	90                   	nop
+
+00000590 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 598:	89 d1                	mov    %edx,%ecx
+{
+ 59a:	83 ec 3c             	sub    $0x3c,%esp
+ 59d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5a0:	85 d2                	test   %edx,%edx
+ 5a2:	0f 89 80 00 00 00    	jns    628 <printint+0x98>
+ 5a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ac:	74 7a                	je     628 <printint+0x98>
+    x = -xx;
+ 5ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5b8:	31 f6                	xor    %esi,%esi
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5c0:	89 c8                	mov    %ecx,%eax
+ 5c2:	31 d2                	xor    %edx,%edx
+ 5c4:	89 f7                	mov    %esi,%edi
+ 5c6:	f7 f3                	div    %ebx
+ 5c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5cb:	0f b6 92 d4 0c 00 00 	movzbl 0xcd4(%edx),%edx
+ 5d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5d6:	89 ca                	mov    %ecx,%edx
+ 5d8:	89 c1                	mov    %eax,%ecx
+ 5da:	39 da                	cmp    %ebx,%edx
+ 5dc:	73 e2                	jae    5c0 <printint+0x30>
+  if(neg)
+ 5de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5e1:	85 c0                	test   %eax,%eax
+ 5e3:	74 07                	je     5ec <printint+0x5c>
+    buf[i++] = '-';
+ 5e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ea:	89 f7                	mov    %esi,%edi
+ 5ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5f2:	01 df                	add    %ebx,%edi
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 601:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 604:	6a 01                	push   $0x1
+ 606:	50                   	push   %eax
+ 607:	56                   	push   %esi
+ 608:	e8 46 fe ff ff       	call   453 <write>
+  while(--i >= 0)
+ 60d:	89 f8                	mov    %edi,%eax
+ 60f:	83 c4 10             	add    $0x10,%esp
+ 612:	83 ef 01             	sub    $0x1,%edi
+ 615:	39 d8                	cmp    %ebx,%eax
+ 617:	75 df                	jne    5f8 <printint+0x68>
+}
+ 619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 61c:	5b                   	pop    %ebx
+ 61d:	5e                   	pop    %esi
+ 61e:	5f                   	pop    %edi
+ 61f:	5d                   	pop    %ebp
+ 620:	c3                   	ret
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 628:	31 c0                	xor    %eax,%eax
+ 62a:	eb 89                	jmp    5b5 <printint+0x25>
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 639:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 63c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 63f:	0f b6 1e             	movzbl (%esi),%ebx
+ 642:	83 c6 01             	add    $0x1,%esi
+ 645:	84 db                	test   %bl,%bl
+ 647:	74 67                	je     6b0 <printf+0x80>
+ 649:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 64c:	31 d2                	xor    %edx,%edx
+ 64e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 651:	eb 34                	jmp    687 <printf+0x57>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+ 658:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 65b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 660:	83 f8 25             	cmp    $0x25,%eax
+ 663:	74 18                	je     67d <printf+0x4d>
+  write(fd, &c, 1);
+ 665:	83 ec 04             	sub    $0x4,%esp
+ 668:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 66b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66e:	6a 01                	push   $0x1
+ 670:	50                   	push   %eax
+ 671:	57                   	push   %edi
+ 672:	e8 dc fd ff ff       	call   453 <write>
+ 677:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 67a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 67d:	0f b6 1e             	movzbl (%esi),%ebx
+ 680:	83 c6 01             	add    $0x1,%esi
+ 683:	84 db                	test   %bl,%bl
+ 685:	74 29                	je     6b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 687:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 68a:	85 d2                	test   %edx,%edx
+ 68c:	74 ca                	je     658 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 68e:	83 fa 25             	cmp    $0x25,%edx
+ 691:	75 ea                	jne    67d <printf+0x4d>
+      if(c == 'd'){
+ 693:	83 f8 25             	cmp    $0x25,%eax
+ 696:	0f 84 24 01 00 00    	je     7c0 <printf+0x190>
+ 69c:	83 e8 63             	sub    $0x63,%eax
+ 69f:	83 f8 15             	cmp    $0x15,%eax
+ 6a2:	77 1c                	ja     6c0 <printf+0x90>
+ 6a4:	ff 24 85 7c 0c 00 00 	jmp    *0xc7c(,%eax,4)
+ 6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b3:	5b                   	pop    %ebx
+ 6b4:	5e                   	pop    %esi
+ 6b5:	5f                   	pop    %edi
+ 6b6:	5d                   	pop    %ebp
+ 6b7:	c3                   	ret
+ 6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ca:	6a 01                	push   $0x1
+ 6cc:	52                   	push   %edx
+ 6cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6d0:	57                   	push   %edi
+ 6d1:	e8 7d fd ff ff       	call   453 <write>
+ 6d6:	83 c4 0c             	add    $0xc,%esp
+ 6d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6dc:	6a 01                	push   $0x1
+ 6de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6e1:	52                   	push   %edx
+ 6e2:	57                   	push   %edi
+ 6e3:	e8 6b fd ff ff       	call   453 <write>
+        putc(fd, c);
+ 6e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6eb:	31 d2                	xor    %edx,%edx
+ 6ed:	eb 8e                	jmp    67d <printf+0x4d>
+ 6ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6fb:	8b 13                	mov    (%ebx),%edx
+ 6fd:	6a 00                	push   $0x0
+ 6ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 701:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 704:	e8 87 fe ff ff       	call   590 <printint>
+        ap++;
+ 709:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 70c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 67 ff ff ff       	jmp    67d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 720:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 723:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 725:	83 c0 04             	add    $0x4,%eax
+ 728:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 72b:	85 db                	test   %ebx,%ebx
+ 72d:	0f 84 9d 00 00 00    	je     7d0 <printf+0x1a0>
+        while(*s != 0){
+ 733:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 736:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 738:	84 c0                	test   %al,%al
+ 73a:	0f 84 3d ff ff ff    	je     67d <printf+0x4d>
+ 740:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 743:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 746:	89 de                	mov    %ebx,%esi
+ 748:	89 d3                	mov    %edx,%ebx
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 756:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 759:	6a 01                	push   $0x1
+ 75b:	53                   	push   %ebx
+ 75c:	57                   	push   %edi
+ 75d:	e8 f1 fc ff ff       	call   453 <write>
+        while(*s != 0){
+ 762:	0f b6 06             	movzbl (%esi),%eax
+ 765:	83 c4 10             	add    $0x10,%esp
+ 768:	84 c0                	test   %al,%al
+ 76a:	75 e4                	jne    750 <printf+0x120>
+      state = 0;
+ 76c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 76f:	31 d2                	xor    %edx,%edx
+ 771:	e9 07 ff ff ff       	jmp    67d <printf+0x4d>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 01                	push   $0x1
+ 78f:	e9 6b ff ff ff       	jmp    6ff <printf+0xcf>
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 798:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	52                   	push   %edx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 a1 fc ff ff       	call   453 <write>
+        ap++;
+ 7b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7b8:	31 d2                	xor    %edx,%edx
+ 7ba:	e9 be fe ff ff       	jmp    67d <printf+0x4d>
+ 7bf:	90                   	nop
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	e9 11 ff ff ff       	jmp    6e1 <printf+0xb1>
+ 7d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7d5:	bb 74 0c 00 00       	mov    $0xc74,%ebx
+ 7da:	e9 61 ff ff ff       	jmp    740 <printf+0x110>
+ 7df:	90                   	nop
+
+000007e0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e3:	a1 c4 10 00 00       	mov    0x10c4,%eax
+{
+ 7e8:	89 e5                	mov    %esp,%ebp
+ 7ea:	56                   	push   %esi
+ 7eb:	53                   	push   %ebx
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f4:	39 ca                	cmp    %ecx,%edx
+ 7f6:	73 30                	jae    828 <lfree+0x48>
+ 7f8:	39 c1                	cmp    %eax,%ecx
+ 7fa:	72 04                	jb     800 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7fc:	39 c2                	cmp    %eax,%edx
+ 7fe:	72 f0                	jb     7f0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 800:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 803:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 806:	39 f0                	cmp    %esi,%eax
+ 808:	74 26                	je     830 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 80a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 80c:	8b 42 04             	mov    0x4(%edx),%eax
+ 80f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 812:	39 d9                	cmp    %ebx,%ecx
+ 814:	74 30                	je     846 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 816:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 818:	5b                   	pop    %ebx
+  freep = p;
+ 819:	89 15 c4 10 00 00    	mov    %edx,0x10c4
+}
+ 81f:	5e                   	pop    %esi
+ 820:	5d                   	pop    %ebp
+ 821:	c3                   	ret
+ 822:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 828:	39 c1                	cmp    %eax,%ecx
+ 82a:	72 d0                	jb     7fc <lfree+0x1c>
+ 82c:	eb c2                	jmp    7f0 <lfree+0x10>
+ 82e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 830:	03 58 04             	add    0x4(%eax),%ebx
+ 833:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 836:	8b 02                	mov    (%edx),%eax
+ 838:	8b 00                	mov    (%eax),%eax
+ 83a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 83c:	8b 42 04             	mov    0x4(%edx),%eax
+ 83f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 842:	39 d9                	cmp    %ebx,%ecx
+ 844:	75 d0                	jne    816 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 846:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 849:	89 15 c4 10 00 00    	mov    %edx,0x10c4
+    p->s.size += bp->s.size;
+ 84f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 852:	8b 09                	mov    (%ecx),%ecx
+ 854:	89 0a                	mov    %ecx,(%edx)
+}
+ 856:	5b                   	pop    %ebx
+ 857:	5e                   	pop    %esi
+ 858:	5d                   	pop    %ebp
+ 859:	c3                   	ret
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000860 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	89 c7                	mov    %eax,%edi
+ 866:	56                   	push   %esi
+ 867:	53                   	push   %ebx
+ 868:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 86b:	a1 c4 10 00 00       	mov    0x10c4,%eax
+ 870:	85 c0                	test   %eax,%eax
+ 872:	0f 84 88 00 00 00    	je     900 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 878:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 87a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 87d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 882:	39 df                	cmp    %ebx,%edi
+ 884:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 887:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 88e:	39 f9                	cmp    %edi,%ecx
+ 890:	72 0f                	jb     8a1 <lalloc+0x41>
+ 892:	eb 4c                	jmp    8e0 <lalloc+0x80>
+ 894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 898:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 89a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 89d:	39 f9                	cmp    %edi,%ecx
+ 89f:	73 3f                	jae    8e0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 8a1:	89 d0                	mov    %edx,%eax
+ 8a3:	39 15 c4 10 00 00    	cmp    %edx,0x10c4
+ 8a9:	75 ed                	jne    898 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 8ab:	83 ec 0c             	sub    $0xc,%esp
+ 8ae:	56                   	push   %esi
+ 8af:	e8 07 fc ff ff       	call   4bb <sbrk>
+  if(p == (char*)-1)
+ 8b4:	83 c4 10             	add    $0x10,%esp
+ 8b7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8ba:	74 11                	je     8cd <lalloc+0x6d>
+  hp->s.size = nu;
+ 8bc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 8bf:	e8 1c ff ff ff       	call   7e0 <lfree>
+  return freep;
+ 8c4:	a1 c4 10 00 00       	mov    0x10c4,%eax
+      if((p = morecore(nunits)) == 0)
+ 8c9:	85 c0                	test   %eax,%eax
+ 8cb:	75 cb                	jne    898 <lalloc+0x38>
+        return 0;
+  }
+}
+ 8cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8d0:	31 d2                	xor    %edx,%edx
+}
+ 8d2:	5b                   	pop    %ebx
+ 8d3:	89 d0                	mov    %edx,%eax
+ 8d5:	5e                   	pop    %esi
+ 8d6:	5f                   	pop    %edi
+ 8d7:	5d                   	pop    %ebp
+ 8d8:	c3                   	ret
+ 8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 8e0:	39 cf                	cmp    %ecx,%edi
+ 8e2:	74 4c                	je     930 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 8e4:	29 f9                	sub    %edi,%ecx
+ 8e6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 8e9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 8ec:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 8ef:	a3 c4 10 00 00       	mov    %eax,0x10c4
+}
+ 8f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8f7:	89 d0                	mov    %edx,%eax
+ 8f9:	5b                   	pop    %ebx
+ 8fa:	5e                   	pop    %esi
+ 8fb:	5f                   	pop    %edi
+ 8fc:	5d                   	pop    %ebp
+ 8fd:	c3                   	ret
+ 8fe:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 900:	ba c8 10 00 00       	mov    $0x10c8,%edx
+ 905:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 907:	c7 05 c4 10 00 00 c8 	movl   $0x10c8,0x10c4
+ 90e:	10 00 00 
+ 911:	c7 05 c8 10 00 00 c8 	movl   $0x10c8,0x10c8
+ 918:	10 00 00 
+ 91b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 91d:	c7 05 cc 10 00 00 00 	movl   $0x0,0x10cc
+ 924:	00 00 00 
+ 927:	e9 51 ff ff ff       	jmp    87d <lalloc+0x1d>
+ 92c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 930:	8b 0a                	mov    (%edx),%ecx
+ 932:	89 08                	mov    %ecx,(%eax)
+ 934:	eb b9                	jmp    8ef <lalloc+0x8f>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 949:	85 f6                	test   %esi,%esi
+ 94b:	74 42                	je     98f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 94d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 950:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 953:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 959:	77 3d                	ja     998 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 95b:	31 c9                	xor    %ecx,%ecx
+ 95d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 962:	83 fa 02             	cmp    $0x2,%edx
+ 965:	74 17                	je     97e <free+0x3e>
+ 967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96e:	66 90                	xchg   %ax,%ax
+ 970:	83 c1 01             	add    $0x1,%ecx
+ 973:	89 d8                	mov    %ebx,%eax
+ 975:	d3 e0                	shl    %cl,%eax
+ 977:	83 c0 01             	add    $0x1,%eax
+ 97a:	39 c2                	cmp    %eax,%edx
+ 97c:	75 f2                	jne    970 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 97e:	8b 04 8d a0 10 00 00 	mov    0x10a0(,%ecx,4),%eax
+  classes[c] = bp;
+ 985:	89 3c 8d a0 10 00 00 	mov    %edi,0x10a0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 98c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 98f:	5b                   	pop    %ebx
+ 990:	5e                   	pop    %esi
+ 991:	5f                   	pop    %edi
+ 992:	5d                   	pop    %ebp
+ 993:	c3                   	ret
+ 994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 998:	5b                   	pop    %ebx
+    lfree(bp);
+ 999:	89 f8                	mov    %edi,%eax
+}
+ 99b:	5e                   	pop    %esi
+ 99c:	5f                   	pop    %edi
+ 99d:	5d                   	pop    %ebp
+    lfree(bp);
+ 99e:	e9 3d fe ff ff       	jmp    7e0 <lfree>
+ 9a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009b0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9bc:	83 c0 07             	add    $0x7,%eax
+ 9bf:	c1 e8 03             	shr    $0x3,%eax
+ 9c2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 9c5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 9ca:	77 44                	ja     a10 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 9cc:	31 c9                	xor    %ecx,%ecx
+ 9ce:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9d3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 9d8:	83 f8 02             	cmp    $0x2,%eax
+ 9db:	76 11                	jbe    9ee <malloc+0x3e>
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 9e0:	83 c1 01             	add    $0x1,%ecx
+ 9e3:	89 d3                	mov    %edx,%ebx
+ 9e5:	d3 e3                	shl    %cl,%ebx
+ 9e7:	83 c3 01             	add    $0x1,%ebx
+ 9ea:	39 c3                	cmp    %eax,%ebx
+ 9ec:	72 f2                	jb     9e0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 9ee:	8b 04 8d a0 10 00 00 	mov    0x10a0(,%ecx,4),%eax
+ 9f5:	85 c0                	test   %eax,%eax
+ 9f7:	74 2f                	je     a28 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 9f9:	8b 10                	mov    (%eax),%edx
+ 9fb:	89 14 8d a0 10 00 00 	mov    %edx,0x10a0(,%ecx,4)
+  return (void*)(p + 1);
+ a02:	83 c0 08             	add    $0x8,%eax
+}
+ a05:	83 c4 1c             	add    $0x1c,%esp
+ a08:	5b                   	pop    %ebx
+ a09:	5e                   	pop    %esi
+ a0a:	5f                   	pop    %edi
+ a0b:	5d                   	pop    %ebp
+ a0c:	c3                   	ret
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ a10:	e8 4b fe ff ff       	call   860 <lalloc>
+ a15:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ a17:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ a1a:	85 d2                	test   %edx,%edx
+ a1c:	75 e7                	jne    a05 <malloc+0x55>
+      return 0;
+ a1e:	31 c0                	xor    %eax,%eax
+ a20:	eb e3                	jmp    a05 <malloc+0x55>
+ a22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ a28:	31 d2                	xor    %edx,%edx
+ a2a:	b8 00 02 00 00       	mov    $0x200,%eax
+ a2f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a32:	f7 f3                	div    %ebx
+  if(n < 4)
+ a34:	ba 04 00 00 00       	mov    $0x4,%edx
+ a39:	89 d6                	mov    %edx,%esi
+ a3b:	39 d0                	cmp    %edx,%eax
+ a3d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ a40:	0f af f3             	imul   %ebx,%esi
+ a43:	89 f0                	mov    %esi,%eax
+ a45:	e8 16 fe ff ff       	call   860 <lalloc>
+ a4a:	85 c0                	test   %eax,%eax
+ a4c:	74 d0                	je     a1e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ a4e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a51:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ a54:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a5b:	8b 14 8d a0 10 00 00 	mov    0x10a0(,%ecx,4),%edx
+ a62:	39 f8                	cmp    %edi,%eax
+ a64:	73 22                	jae    a88 <malloc+0xd8>
+ a66:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a69:	eb 09                	jmp    a74 <malloc+0xc4>
+ a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+ a70:	89 c2                	mov    %eax,%edx
+ a72:	89 c8                	mov    %ecx,%eax
+ a74:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ a77:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ a7a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ a7c:	39 f9                	cmp    %edi,%ecx
+ a7e:	72 f0                	jb     a70 <malloc+0xc0>
+ a80:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a83:	e9 73 ff ff ff       	jmp    9fb <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ a88:	89 d0                	mov    %edx,%eax
+ a8a:	8b 12                	mov    (%edx),%edx
+ a8c:	e9 6a ff ff ff       	jmp    9fb <malloc+0x4b>
+ a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+
+00000aa0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	56                   	push   %esi
+ aa4:	53                   	push   %ebx
+ aa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ aa8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ aab:	85 c9                	test   %ecx,%ecx
+ aad:	74 06                	je     ab5 <calloc+0x15>
+ aaf:	89 c8                	mov    %ecx,%eax
+ ab1:	f7 e3                	mul    %ebx
+ ab3:	70 33                	jo     ae8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ ab5:	0f af d9             	imul   %ecx,%ebx
+ ab8:	83 ec 0c             	sub    $0xc,%esp
+ abb:	53                   	push   %ebx
+ abc:	e8 ef fe ff ff       	call   9b0 <malloc>
+ ac1:	83 c4 10             	add    $0x10,%esp
+ ac4:	89 c6                	mov    %eax,%esi
+ ac6:	85 c0                	test   %eax,%eax
+ ac8:	74 1e                	je     ae8 <calloc+0x48>
+    memset(p, 0, n * size);
+ aca:	83 ec 04             	sub    $0x4,%esp
+ acd:	53                   	push   %ebx
+ ace:	6a 00                	push   $0x0
+ ad0:	50                   	push   %eax
+ ad1:	e8 3a f7 ff ff       	call   210 <memset>
+ ad6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ ad9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ adc:	89 f0                	mov    %esi,%eax
+ ade:	5b                   	pop    %ebx
+ adf:	5e                   	pop    %esi
+ ae0:	5d                   	pop    %ebp
+ ae1:	c3                   	ret
+ ae2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ ae8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ aeb:	31 f6                	xor    %esi,%esi
+}
+ aed:	89 f0                	mov    %esi,%eax
+ aef:	5b                   	pop    %ebx
+ af0:	5e                   	pop    %esi
+ af1:	5d                   	pop    %ebp
+ af2:	c3                   	ret
+ af3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b00 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	83 ec 0c             	sub    $0xc,%esp
+ b09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ b0f:	85 db                	test   %ebx,%ebx
+ b11:	74 55                	je     b68 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ b13:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ b16:	89 de                	mov    %ebx,%esi
+ b18:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ b1f:	39 c7                	cmp    %eax,%edi
+ b21:	72 0d                	jb     b30 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ b23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b26:	89 f0                	mov    %esi,%eax
+ b28:	5b                   	pop    %ebx
+ b29:	5e                   	pop    %esi
+ b2a:	5f                   	pop    %edi
+ b2b:	5d                   	pop    %ebp
+ b2c:	c3                   	ret
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ b30:	83 ec 0c             	sub    $0xc,%esp
+ b33:	50                   	push   %eax
+ b34:	e8 77 fe ff ff       	call   9b0 <malloc>
+ b39:	83 c4 10             	add    $0x10,%esp
+ b3c:	89 c6                	mov    %eax,%esi
+ b3e:	85 c0                	test   %eax,%eax
+ b40:	74 e1                	je     b23 <realloc+0x23>
+  memmove(p, ap, have);
+ b42:	83 ec 04             	sub    $0x4,%esp
+ b45:	57                   	push   %edi
+ b46:	53                   	push   %ebx
+ b47:	50                   	push   %eax
+ b48:	e8 b3 f8 ff ff       	call   400 <memmove>
+  free(ap);
+ b4d:	89 1c 24             	mov    %ebx,(%esp)
+ b50:	e8 eb fd ff ff       	call   940 <free>
+  return p;
+ b55:	83 c4 10             	add    $0x10,%esp
+}
+ b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b5b:	89 f0                	mov    %esi,%eax
+ b5d:	5b                   	pop    %ebx
+ b5e:	5e                   	pop    %esi
+ b5f:	5f                   	pop    %edi
+ b60:	5d                   	pop    %ebp
+ b61:	c3                   	ret
+ b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b68:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b6e:	5b                   	pop    %ebx
+ b6f:	5e                   	pop    %esi
+ b70:	5f                   	pop    %edi
+ b71:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b72:	e9 39 fe ff ff       	jmp    9b0 <malloc>
@@ -9,6 +9,11 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct swapstat;
+struct meminfo;
+struct iostat;
+struct pcidev;
+struct vma;
 #ifdef CS333_P2
 struct uproc;
 #endif
@@ -18,6 +23,12 @@ void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bstat(struct iostat*);
+int             breada(uint, uint);
+void            bdone(struct buf*);
+void            bdrop(void);
+void            bsubmit(struct buf*);
+void            bwait(struct buf*);
 
 // console.c
 void            consoleinit(void);
@@ -27,6 +38,7 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             loadimage(struct proc*, char*, char**);
 
 // file.c
 struct file*    filealloc(void);
@@ -43,6 +55,7 @@ int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            itext(struct inode*, int);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -64,6 +77,17 @@ int             chgrp(char*, int);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            ideawait(struct buf*);
+void            idestat(struct iostat*);
+int             idesched(int);
+
+// iosched.c
+void            iosadd(struct buf*);
+struct buf*     iosnext(void);
+int             iosmerge(struct buf*, int);
+void            iosdone(struct buf*);
+int             iosset(int);
+void            iosstat(struct iostat*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -73,14 +97,27 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+void            kref(char*);
+char*           kalloc4m(void);
+void            kfree4m(char*);
+void            ksplit4m(char*);
+uint            kscale(uint);
+uint            kscaleboot(uint, uint);
+void*           ktable(uint, uint);
+int             krefcnt(char*);
+void            ktag(char*, int);
+void            kmeminfo(struct meminfo*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             kready(void);
+extern uint     phystop;
 
 // kbd.c
 void            kbdintr(void);
 
 // lapic.c
 void            cmostime(struct rtcdate *r);
+uint            cmosmem(void);
 int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
@@ -91,13 +128,27 @@ void            microdelay(int);
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            logstat(struct iostat*);
 void            begin_op();
 void            end_op();
 
+// main.c
+void            bootmark(char*);
+void            bootreport(void);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+uint            pciread(struct pcidev*, int);
+void            pciwrite(struct pcidev*, int, uint);
+int             pcifind(int, int, int, struct pcidev*);
+int             pcifindid(int, int, int, struct pcidev*);
+void            pcienable(struct pcidev*, uint);
+int             pciintr(struct pcidev*, void (*)(void));
+int             pcitrap(int);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -113,6 +164,8 @@ int             pipewrite(struct pipe*, char*, int);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             spawn(char*, char**, int*, int);
+char*           swapvictim(uint);
 int             growproc(int);
 int             kill(int);
 struct cpu*     mycpu(void);
@@ -168,9 +221,19 @@ int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
 char*           strncpy(char*, const char*, int);
 
+// swap.c
+void            swapinit(int);
+int             swapout(void);
+char*           kallocsw(void);
+int             swapin(uint*, char*);
+void            swapread(uint, char*);
+void            swapfree(uint);
+void            swapstat(struct swapstat*);
+
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argrdptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -193,17 +256,32 @@ void            uartputc(int);
 void            seginit(void);
 void            kvmalloc(void);
 pde_t*          setupkvm(void);
+int             fillpgdirs(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
-pde_t*          copyuvm(pde_t*, uint);
+pde_t*          copyuvm(pde_t*, uint, struct vma*);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             pgfault(struct proc*, uint, int);
+void            textinit(void);
+void            textinval(struct inode*);
+void            dupvmas(struct vma*, struct vma*);
+struct vma*     vmaoverlap(struct proc*, uint, uint);
+void            syncvmas(pde_t*, struct vma*);
+int             vmamap(struct proc*, uint, int, int, struct inode*, uint);
+int             vmaunmap(struct proc*, uint, uint);
+void            freevmas(struct vma*);
+int             uvmtouch(uint, uint, int);
+void            uvmunpin(struct proc*);
+int             uvmrss(pde_t*, uint);
+int             uvmptpages(pde_t*);
+char*           pgevict(struct proc*, uint*, uint);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,2095 @@
+
+_diskbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return (expect - soak) * 100 / expect;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 68             	sub    $0x68,%esp
+  uint s, idle, tot;
+  int t;
+
+  nsoak = argc > 1 ? atoi(argv[1]) : NSOAK;
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  nsoak = argc > 1 ? atoi(argv[1]) : NSOAK;
+  1a:	7f 31                	jg     4d <main+0x4d>
+  1c:	c7 05 40 13 00 00 02 	movl   $0x2,0x1340
+  23:	00 00 00 
+{
+  26:	31 db                	xor    %ebx,%ebx
+  28:	eb 11                	jmp    3b <main+0x3b>
+  2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < nsoak; i++){
+  30:	83 c3 01             	add    $0x1,%ebx
+  33:	3b 1d 40 13 00 00    	cmp    0x1340,%ebx
+  39:	7d 36                	jge    71 <main+0x71>
+    if((soaker[i] = fork()) == 0)
+  3b:	e8 9b 06 00 00       	call   6db <fork>
+  40:	89 04 9d 60 13 00 00 	mov    %eax,0x1360(,%ebx,4)
+  47:	85 c0                	test   %eax,%eax
+  49:	75 e5                	jne    30 <main+0x30>
+      for(;;)
+  4b:	eb fe                	jmp    4b <main+0x4b>
+  nsoak = argc > 1 ? atoi(argv[1]) : NSOAK;
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	ff 70 04             	push   0x4(%eax)
+  53:	e8 78 05 00 00       	call   5d0 <atoi>
+  if(nsoak < 1 || nsoak > MAXSOAK)
+  58:	83 c4 10             	add    $0x10,%esp
+  nsoak = argc > 1 ? atoi(argv[1]) : NSOAK;
+  5b:	a3 40 13 00 00       	mov    %eax,0x1340
+  if(nsoak < 1 || nsoak > MAXSOAK)
+  60:	83 e8 01             	sub    $0x1,%eax
+  63:	83 f8 07             	cmp    $0x7,%eax
+  66:	77 b4                	ja     1c <main+0x1c>
+  for(i = 0; i < nsoak; i++){
+  68:	83 3d 40 13 00 00 00 	cmpl   $0x0,0x1340
+  6f:	7f b5                	jg     26 <main+0x26>
+    nsoak = NSOAK;
+  startsoak();
+
+  s = soaked();
+  71:	e8 ba 02 00 00       	call   330 <soaked>
+  76:	89 c6                	mov    %eax,%esi
+  t = uptime();
+  78:	e8 fe 06 00 00       	call   77b <uptime>
+  sleep(200);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	68 c8 00 00 00       	push   $0xc8
+  t = uptime();
+  85:	89 c7                	mov    %eax,%edi
+  sleep(200);
+  87:	e8 e7 06 00 00       	call   773 <sleep>
+  t = uptime() - t;
+  8c:	e8 ea 06 00 00       	call   77b <uptime>
+  91:	29 f8                	sub    %edi,%eax
+  93:	89 c3                	mov    %eax,%ebx
+  idle = (soaked() - s) * 1000 / t;
+  95:	e8 96 02 00 00       	call   330 <soaked>
+  9a:	31 d2                	xor    %edx,%edx
+  9c:	29 f0                	sub    %esi,%eax
+  tot = 0;
+  9e:	31 f6                	xor    %esi,%esi
+  idle = (soaked() - s) * 1000 / t;
+  a0:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  a6:	f7 f3                	div    %ebx
+  a8:	89 45 9c             	mov    %eax,-0x64(%ebp)
+
+  dropcache();
+  ab:	e8 0b 07 00 00       	call   7bb <dropcache>
+  s = soaked();
+  b0:	e8 7b 02 00 00       	call   330 <soaked>
+  b5:	89 45 98             	mov    %eax,-0x68(%ebp)
+  t = uptime();
+  b8:	e8 be 06 00 00       	call   77b <uptime>
+  dfd = open("/", O_RDONLY);
+  bd:	59                   	pop    %ecx
+  be:	5b                   	pop    %ebx
+  bf:	6a 00                	push   $0x0
+  c1:	68 28 0e 00 00       	push   $0xe28
+  t = uptime();
+  c6:	89 c7                	mov    %eax,%edi
+  dfd = open("/", O_RDONLY);
+  c8:	e8 56 06 00 00       	call   723 <open>
+  tot = 0;
+  cd:	89 75 a0             	mov    %esi,-0x60(%ebp)
+  while(read(dfd, &de, sizeof(de)) == sizeof(de)){
+  d0:	83 c4 10             	add    $0x10,%esp
+  d3:	8d 75 ac             	lea    -0x54(%ebp),%esi
+  d6:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+  dfd = open("/", O_RDONLY);
+  d9:	89 c3                	mov    %eax,%ebx
+    memmove(path + 1, de.name, DIRSIZ);
+  db:	8d 7d bc             	lea    -0x44(%ebp),%edi
+  de:	66 90                	xchg   %ax,%ax
+  while(read(dfd, &de, sizeof(de)) == sizeof(de)){
+  e0:	83 ec 04             	sub    $0x4,%esp
+  e3:	6a 10                	push   $0x10
+  e5:	56                   	push   %esi
+  e6:	53                   	push   %ebx
+  e7:	e8 0f 06 00 00       	call   6fb <read>
+  ec:	83 c4 10             	add    $0x10,%esp
+  ef:	83 f8 10             	cmp    $0x10,%eax
+  f2:	75 6a                	jne    15e <main+0x15e>
+    if(de.inum == 0)
+  f4:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+  f9:	74 e5                	je     e0 <main+0xe0>
+    memmove(path + 1, de.name, DIRSIZ);
+  fb:	83 ec 04             	sub    $0x4,%esp
+  fe:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    path[0] = '/';
+ 101:	c6 45 bc 2f          	movb   $0x2f,-0x44(%ebp)
+    memmove(path + 1, de.name, DIRSIZ);
+ 105:	6a 0e                	push   $0xe
+ 107:	50                   	push   %eax
+ 108:	8d 45 bd             	lea    -0x43(%ebp),%eax
+ 10b:	50                   	push   %eax
+ 10c:	e8 9f 05 00 00       	call   6b0 <memmove>
+    path[DIRSIZ+1] = 0;
+ 111:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+    if((fd = open(path, O_RDONLY)) < 0)
+ 115:	58                   	pop    %eax
+ 116:	5a                   	pop    %edx
+ 117:	6a 00                	push   $0x0
+ 119:	57                   	push   %edi
+ 11a:	e8 04 06 00 00       	call   723 <open>
+ 11f:	83 c4 10             	add    $0x10,%esp
+ 122:	89 c2                	mov    %eax,%edx
+ 124:	85 c0                	test   %eax,%eax
+ 126:	78 b8                	js     e0 <main+0xe0>
+    if(fstat(fd, &st) == 0 && st.type == T_FILE)
+ 128:	83 ec 08             	sub    $0x8,%esp
+ 12b:	8d 45 cc             	lea    -0x34(%ebp),%eax
+ 12e:	50                   	push   %eax
+ 12f:	52                   	push   %edx
+ 130:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+ 133:	e8 03 06 00 00       	call   73b <fstat>
+ 138:	83 c4 10             	add    $0x10,%esp
+ 13b:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+ 13e:	85 c0                	test   %eax,%eax
+ 140:	75 0b                	jne    14d <main+0x14d>
+ 142:	66 83 7d cc 02       	cmpw   $0x2,-0x34(%ebp)
+ 147:	0f 84 8e 01 00 00    	je     2db <main+0x2db>
+    close(fd);
+ 14d:	83 ec 0c             	sub    $0xc,%esp
+    memmove(path + 1, de.name, DIRSIZ);
+ 150:	8d 7d bc             	lea    -0x44(%ebp),%edi
+    close(fd);
+ 153:	52                   	push   %edx
+ 154:	e8 b2 05 00 00       	call   70b <close>
+ 159:	83 c4 10             	add    $0x10,%esp
+ 15c:	eb 82                	jmp    e0 <main+0xe0>
+  close(dfd);
+ 15e:	83 ec 0c             	sub    $0xc,%esp
+ 161:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+ 164:	53                   	push   %ebx
+ 165:	e8 a1 05 00 00       	call   70b <close>
+  tot = readall();
+  t = uptime() - t;
+ 16a:	e8 0c 06 00 00       	call   77b <uptime>
+ 16f:	29 f8                	sub    %edi,%eax
+ 171:	89 c3                	mov    %eax,%ebx
+  s = soaked() - s;
+ 173:	e8 b8 01 00 00       	call   330 <soaked>
+  if(t == 0)
+ 178:	83 c4 10             	add    $0x10,%esp
+  s = soaked() - s;
+ 17b:	89 c7                	mov    %eax,%edi
+ 17d:	89 c6                	mov    %eax,%esi
+ 17f:	8b 45 98             	mov    -0x68(%ebp),%eax
+ 182:	29 c7                	sub    %eax,%edi
+  if(t == 0)
+ 184:	85 db                	test   %ebx,%ebx
+ 186:	75 05                	jne    18d <main+0x18d>
+    t = 1;
+ 188:	bb 01 00 00 00       	mov    $0x1,%ebx
+  expect = idle * t / 1000;
+ 18d:	8b 45 9c             	mov    -0x64(%ebp),%eax
+ 190:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+ 195:	31 d2                	xor    %edx,%edx
+ 197:	0f af c3             	imul   %ebx,%eax
+ 19a:	f7 f1                	div    %ecx
+ 19c:	89 c1                	mov    %eax,%ecx
+  if(expect == 0 || soak >= expect)
+ 19e:	39 c7                	cmp    %eax,%edi
+ 1a0:	0f 83 2a 01 00 00    	jae    2d0 <main+0x2d0>
+  return (expect - soak) * 100 / expect;
+ 1a6:	8b 45 98             	mov    -0x68(%ebp),%eax
+ 1a9:	31 d2                	xor    %edx,%edx
+ 1ab:	29 f0                	sub    %esi,%eax
+ 1ad:	01 c8                	add    %ecx,%eax
+ 1af:	6b c0 64             	imul   $0x64,%eax,%eax
+ 1b2:	f7 f1                	div    %ecx
+  printf(1, "read:  %d KB in %d ms, %d KB/s, %d%% of CPU\n",
+ 1b4:	56                   	push   %esi
+ 1b5:	56                   	push   %esi
+ 1b6:	50                   	push   %eax
+         tot / 1024, t, tot / t * 1000 / 1024, busy(s, t, idle));
+ 1b7:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 1ba:	31 d2                	xor    %edx,%edx
+
+  s = soaked();
+  t = uptime();
+ 1bc:	be 14 00 00 00       	mov    $0x14,%esi
+         tot / 1024, t, tot / t * 1000 / 1024, busy(s, t, idle));
+ 1c1:	f7 f3                	div    %ebx
+ 1c3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  printf(1, "read:  %d KB in %d ms, %d KB/s, %d%% of CPU\n",
+ 1c9:	c1 e8 0a             	shr    $0xa,%eax
+ 1cc:	50                   	push   %eax
+ 1cd:	53                   	push   %ebx
+ 1ce:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 1d1:	c1 e8 0a             	shr    $0xa,%eax
+ 1d4:	50                   	push   %eax
+ 1d5:	68 38 0e 00 00       	push   $0xe38
+ 1da:	6a 01                	push   $0x1
+ 1dc:	e8 ff 06 00 00       	call   8e0 <printf>
+  s = soaked();
+ 1e1:	83 c4 20             	add    $0x20,%esp
+ 1e4:	e8 47 01 00 00       	call   330 <soaked>
+ 1e9:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  t = uptime();
+ 1ec:	e8 8a 05 00 00       	call   77b <uptime>
+ 1f1:	89 45 a0             	mov    %eax,-0x60(%ebp)
+ 1f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((fd = open("diskbench.tmp", O_CREATE|O_WRONLY)) < 0){
+ 1f8:	83 ec 08             	sub    $0x8,%esp
+ 1fb:	68 01 02 00 00       	push   $0x201
+ 200:	68 2a 0e 00 00       	push   $0xe2a
+ 205:	e8 19 05 00 00       	call   723 <open>
+ 20a:	83 c4 10             	add    $0x10,%esp
+ 20d:	89 c7                	mov    %eax,%edi
+ 20f:	85 c0                	test   %eax,%eax
+ 211:	0f 88 fa 00 00 00    	js     311 <main+0x311>
+ 217:	bb 04 00 00 00       	mov    $0x4,%ebx
+      write(fd, buf, sizeof(buf));
+ 21c:	83 ec 04             	sub    $0x4,%esp
+ 21f:	68 00 20 00 00       	push   $0x2000
+ 224:	68 80 13 00 00       	push   $0x1380
+ 229:	57                   	push   %edi
+ 22a:	e8 d4 04 00 00       	call   703 <write>
+    for(j = 0; j < WSIZE; j += sizeof(buf))
+ 22f:	83 c4 10             	add    $0x10,%esp
+ 232:	83 eb 01             	sub    $0x1,%ebx
+ 235:	75 e5                	jne    21c <main+0x21c>
+    close(fd);
+ 237:	83 ec 0c             	sub    $0xc,%esp
+ 23a:	57                   	push   %edi
+ 23b:	e8 cb 04 00 00       	call   70b <close>
+  for(i = 0; i < WPASSES; i++){
+ 240:	83 c4 10             	add    $0x10,%esp
+ 243:	83 ee 01             	sub    $0x1,%esi
+ 246:	75 b0                	jne    1f8 <main+0x1f8>
+  tot = writeall();
+  t = uptime() - t;
+ 248:	8b 7d a0             	mov    -0x60(%ebp),%edi
+ 24b:	e8 2b 05 00 00       	call   77b <uptime>
+ 250:	29 f8                	sub    %edi,%eax
+ 252:	89 c3                	mov    %eax,%ebx
+  s = soaked() - s;
+ 254:	e8 d7 00 00 00       	call   330 <soaked>
+ 259:	89 c7                	mov    %eax,%edi
+ 25b:	89 c6                	mov    %eax,%esi
+ 25d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+ 260:	29 c7                	sub    %eax,%edi
+  if(t == 0)
+ 262:	85 db                	test   %ebx,%ebx
+ 264:	75 05                	jne    26b <main+0x26b>
+    t = 1;
+ 266:	bb 01 00 00 00       	mov    $0x1,%ebx
+  expect = idle * t / 1000;
+ 26b:	8b 45 9c             	mov    -0x64(%ebp),%eax
+ 26e:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+ 273:	31 d2                	xor    %edx,%edx
+ 275:	0f af c3             	imul   %ebx,%eax
+ 278:	f7 f1                	div    %ecx
+ 27a:	89 c1                	mov    %eax,%ecx
+  if(expect == 0 || soak >= expect)
+ 27c:	39 c7                	cmp    %eax,%edi
+ 27e:	73 57                	jae    2d7 <main+0x2d7>
+  return (expect - soak) * 100 / expect;
+ 280:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+ 283:	31 d2                	xor    %edx,%edx
+ 285:	29 f0                	sub    %esi,%eax
+ 287:	01 c8                	add    %ecx,%eax
+ 289:	6b c0 64             	imul   $0x64,%eax,%eax
+ 28c:	f7 f1                	div    %ecx
+  printf(1, "write: %d KB in %d ms, %d KB/s, %d%% of CPU\n",
+ 28e:	52                   	push   %edx
+ 28f:	52                   	push   %edx
+ 290:	50                   	push   %eax
+         tot / 1024, t, tot / t * 1000 / 1024, busy(s, t, idle));
+ 291:	31 d2                	xor    %edx,%edx
+ 293:	b8 00 00 0a 00       	mov    $0xa0000,%eax
+ 298:	f7 f3                	div    %ebx
+ 29a:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  printf(1, "write: %d KB in %d ms, %d KB/s, %d%% of CPU\n",
+ 2a0:	c1 e8 0a             	shr    $0xa,%eax
+ 2a3:	50                   	push   %eax
+ 2a4:	53                   	push   %ebx
+ 2a5:	68 80 02 00 00       	push   $0x280
+ 2aa:	68 90 0e 00 00       	push   $0xe90
+ 2af:	6a 01                	push   $0x1
+ 2b1:	e8 2a 06 00 00       	call   8e0 <printf>
+
+  stopsoak();
+ 2b6:	83 c4 20             	add    $0x20,%esp
+ 2b9:	e8 e2 00 00 00       	call   3a0 <stopsoak>
+  unlink("diskbench.tmp");
+ 2be:	83 ec 0c             	sub    $0xc,%esp
+ 2c1:	68 2a 0e 00 00       	push   $0xe2a
+ 2c6:	e8 68 04 00 00       	call   733 <unlink>
+  exit();
+ 2cb:	e8 13 04 00 00       	call   6e3 <exit>
+    return 0;
+ 2d0:	31 c0                	xor    %eax,%eax
+ 2d2:	e9 dd fe ff ff       	jmp    1b4 <main+0x1b4>
+ 2d7:	31 c0                	xor    %eax,%eax
+ 2d9:	eb b3                	jmp    28e <main+0x28e>
+ 2db:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+ 2de:	89 d7                	mov    %edx,%edi
+ 2e0:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+ 2e3:	eb 05                	jmp    2ea <main+0x2ea>
+ 2e5:	8d 76 00             	lea    0x0(%esi),%esi
+        tot += n;
+ 2e8:	01 c3                	add    %eax,%ebx
+      while((n = read(fd, buf, sizeof(buf))) > 0)
+ 2ea:	83 ec 04             	sub    $0x4,%esp
+ 2ed:	68 00 20 00 00       	push   $0x2000
+ 2f2:	68 80 13 00 00       	push   $0x1380
+ 2f7:	57                   	push   %edi
+ 2f8:	e8 fe 03 00 00       	call   6fb <read>
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	85 c0                	test   %eax,%eax
+ 302:	7f e4                	jg     2e8 <main+0x2e8>
+ 304:	89 5d a0             	mov    %ebx,-0x60(%ebp)
+ 307:	89 fa                	mov    %edi,%edx
+ 309:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+ 30c:	e9 3c fe ff ff       	jmp    14d <main+0x14d>
+      printf(2, "diskbench: cannot create diskbench.tmp\n");
+ 311:	51                   	push   %ecx
+ 312:	51                   	push   %ecx
+ 313:	68 68 0e 00 00       	push   $0xe68
+ 318:	6a 02                	push   $0x2
+ 31a:	e8 c1 05 00 00       	call   8e0 <printf>
+      stopsoak();
+ 31f:	e8 7c 00 00 00       	call   3a0 <stopsoak>
+      exit();
+ 324:	e8 ba 03 00 00       	call   6e3 <exit>
+ 329:	66 90                	xchg   %ax,%ax
+ 32b:	66 90                	xchg   %ax,%ax
+ 32d:	66 90                	xchg   %ax,%ax
+ 32f:	90                   	nop
+
+00000330 <soaked>:
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	53                   	push   %ebx
+ 336:	83 ec 24             	sub    $0x24,%esp
+  n = getprocs(NUPROC, tab);
+ 339:	68 80 33 00 00       	push   $0x3380
+ 33e:	6a 48                	push   $0x48
+ 340:	e8 be 04 00 00       	call   803 <getprocs>
+  for(i = 0; i < n; i++)
+ 345:	83 c4 10             	add    $0x10,%esp
+  n = getprocs(NUPROC, tab);
+ 348:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < n; i++)
+ 34b:	85 c0                	test   %eax,%eax
+ 34d:	7e 49                	jle    398 <soaked+0x68>
+    for(j = 0; j < nsoak; j++)
+ 34f:	8b 15 40 13 00 00    	mov    0x1340,%edx
+ 355:	bb 80 33 00 00       	mov    $0x3380,%ebx
+  t = 0;
+ 35a:	31 f6                	xor    %esi,%esi
+  for(i = 0; i < n; i++)
+ 35c:	31 ff                	xor    %edi,%edi
+ 35e:	66 90                	xchg   %ax,%ax
+    for(j = 0; j < nsoak; j++)
+ 360:	85 d2                	test   %edx,%edx
+ 362:	7e 1f                	jle    383 <soaked+0x53>
+      if(tab[i].pid == soaker[j])
+ 364:	8b 0b                	mov    (%ebx),%ecx
+    for(j = 0; j < nsoak; j++)
+ 366:	31 c0                	xor    %eax,%eax
+ 368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+      if(tab[i].pid == soaker[j])
+ 370:	3b 0c 85 60 13 00 00 	cmp    0x1360(,%eax,4),%ecx
+ 377:	75 03                	jne    37c <soaked+0x4c>
+        t += tab[i].CPU_total_ticks;
+ 379:	03 73 18             	add    0x18(%ebx),%esi
+    for(j = 0; j < nsoak; j++)
+ 37c:	83 c0 01             	add    $0x1,%eax
+ 37f:	39 d0                	cmp    %edx,%eax
+ 381:	75 ed                	jne    370 <soaked+0x40>
+  for(i = 0; i < n; i++)
+ 383:	83 c7 01             	add    $0x1,%edi
+ 386:	83 c3 68             	add    $0x68,%ebx
+ 389:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 38c:	75 d2                	jne    360 <soaked+0x30>
+}
+ 38e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 391:	89 f0                	mov    %esi,%eax
+ 393:	5b                   	pop    %ebx
+ 394:	5e                   	pop    %esi
+ 395:	5f                   	pop    %edi
+ 396:	5d                   	pop    %ebp
+ 397:	c3                   	ret
+  t = 0;
+ 398:	31 f6                	xor    %esi,%esi
+  return t;
+ 39a:	eb f2                	jmp    38e <soaked+0x5e>
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <stopsoak>:
+  for(i = 0; i < nsoak; i++)
+ 3a0:	a1 40 13 00 00       	mov    0x1340,%eax
+ 3a5:	85 c0                	test   %eax,%eax
+ 3a7:	7e 4c                	jle    3f5 <stopsoak+0x55>
+{
+ 3a9:	55                   	push   %ebp
+ 3aa:	89 e5                	mov    %esp,%ebp
+ 3ac:	53                   	push   %ebx
+ 3ad:	31 db                	xor    %ebx,%ebx
+ 3af:	83 ec 04             	sub    $0x4,%esp
+ 3b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    kill(soaker[i]);
+ 3b8:	83 ec 0c             	sub    $0xc,%esp
+ 3bb:	ff 34 9d 60 13 00 00 	push   0x1360(,%ebx,4)
+  for(i = 0; i < nsoak; i++)
+ 3c2:	83 c3 01             	add    $0x1,%ebx
+    kill(soaker[i]);
+ 3c5:	e8 49 03 00 00       	call   713 <kill>
+  for(i = 0; i < nsoak; i++)
+ 3ca:	a1 40 13 00 00       	mov    0x1340,%eax
+ 3cf:	83 c4 10             	add    $0x10,%esp
+ 3d2:	39 d8                	cmp    %ebx,%eax
+ 3d4:	7f e2                	jg     3b8 <stopsoak+0x18>
+  for(i = 0; i < nsoak; i++)
+ 3d6:	85 c0                	test   %eax,%eax
+ 3d8:	7e 16                	jle    3f0 <stopsoak+0x50>
+ 3da:	31 db                	xor    %ebx,%ebx
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 3e0:	e8 06 03 00 00       	call   6eb <wait>
+  for(i = 0; i < nsoak; i++)
+ 3e5:	83 c3 01             	add    $0x1,%ebx
+ 3e8:	39 1d 40 13 00 00    	cmp    %ebx,0x1340
+ 3ee:	7f f0                	jg     3e0 <stopsoak+0x40>
+}
+ 3f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f3:	c9                   	leave
+ 3f4:	c3                   	ret
+ 3f5:	c3                   	ret
+ 3f6:	66 90                	xchg   %ax,%ax
+ 3f8:	66 90                	xchg   %ax,%ax
+ 3fa:	66 90                	xchg   %ax,%ax
+ 3fc:	66 90                	xchg   %ax,%ax
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 400:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 401:	31 c0                	xor    %eax,%eax
+{
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	53                   	push   %ebx
+ 406:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 409:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 410:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 414:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 417:	83 c0 01             	add    $0x1,%eax
+ 41a:	84 d2                	test   %dl,%dl
+ 41c:	75 f2                	jne    410 <strcpy+0x10>
+    ;
+  return os;
+}
+ 41e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 421:	89 c8                	mov    %ecx,%eax
+ 423:	c9                   	leave
+ 424:	c3                   	ret
+ 425:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	53                   	push   %ebx
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+ 437:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 43a:	0f b6 02             	movzbl (%edx),%eax
+ 43d:	84 c0                	test   %al,%al
+ 43f:	75 17                	jne    458 <strcmp+0x28>
+ 441:	eb 3a                	jmp    47d <strcmp+0x4d>
+ 443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 447:	90                   	nop
+ 448:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 44c:	83 c2 01             	add    $0x1,%edx
+ 44f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 452:	84 c0                	test   %al,%al
+ 454:	74 1a                	je     470 <strcmp+0x40>
+    p++, q++;
+ 456:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 458:	0f b6 19             	movzbl (%ecx),%ebx
+ 45b:	38 c3                	cmp    %al,%bl
+ 45d:	74 e9                	je     448 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 45f:	29 d8                	sub    %ebx,%eax
+}
+ 461:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 464:	c9                   	leave
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 470:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 474:	31 c0                	xor    %eax,%eax
+ 476:	29 d8                	sub    %ebx,%eax
+}
+ 478:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 47b:	c9                   	leave
+ 47c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 47d:	0f b6 19             	movzbl (%ecx),%ebx
+ 480:	31 c0                	xor    %eax,%eax
+ 482:	eb db                	jmp    45f <strcmp+0x2f>
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 496:	80 3a 00             	cmpb   $0x0,(%edx)
+ 499:	74 15                	je     4b0 <strlen+0x20>
+ 49b:	31 c0                	xor    %eax,%eax
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+ 4a0:	83 c0 01             	add    $0x1,%eax
+ 4a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4a7:	89 c1                	mov    %eax,%ecx
+ 4a9:	75 f5                	jne    4a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 4ab:	89 c8                	mov    %ecx,%eax
+ 4ad:	5d                   	pop    %ebp
+ 4ae:	c3                   	ret
+ 4af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4b0:	31 c9                	xor    %ecx,%ecx
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	89 c8                	mov    %ecx,%eax
+ 4b5:	c3                   	ret
+ 4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4cd:	89 d7                	mov    %edx,%edi
+ 4cf:	fc                   	cld
+ 4d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4d5:	89 d0                	mov    %edx,%eax
+ 4d7:	c9                   	leave
+ 4d8:	c3                   	ret
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4ea:	0f b6 10             	movzbl (%eax),%edx
+ 4ed:	84 d2                	test   %dl,%dl
+ 4ef:	75 12                	jne    503 <strchr+0x23>
+ 4f1:	eb 1d                	jmp    510 <strchr+0x30>
+ 4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4f7:	90                   	nop
+ 4f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4fc:	83 c0 01             	add    $0x1,%eax
+ 4ff:	84 d2                	test   %dl,%dl
+ 501:	74 0d                	je     510 <strchr+0x30>
+    if(*s == c)
+ 503:	38 d1                	cmp    %dl,%cl
+ 505:	75 f1                	jne    4f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 507:	5d                   	pop    %ebp
+ 508:	c3                   	ret
+ 509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 510:	31 c0                	xor    %eax,%eax
+}
+ 512:	5d                   	pop    %ebp
+ 513:	c3                   	ret
+ 514:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+
+00000520 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 525:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 528:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 529:	31 db                	xor    %ebx,%ebx
+{
+ 52b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 52e:	eb 27                	jmp    557 <gets+0x37>
+    cc = read(0, &c, 1);
+ 530:	83 ec 04             	sub    $0x4,%esp
+ 533:	6a 01                	push   $0x1
+ 535:	56                   	push   %esi
+ 536:	6a 00                	push   $0x0
+ 538:	e8 be 01 00 00       	call   6fb <read>
+    if(cc < 1)
+ 53d:	83 c4 10             	add    $0x10,%esp
+ 540:	85 c0                	test   %eax,%eax
+ 542:	7e 1d                	jle    561 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 544:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 548:	8b 55 08             	mov    0x8(%ebp),%edx
+ 54b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 54f:	3c 0a                	cmp    $0xa,%al
+ 551:	74 10                	je     563 <gets+0x43>
+ 553:	3c 0d                	cmp    $0xd,%al
+ 555:	74 0c                	je     563 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 557:	89 df                	mov    %ebx,%edi
+ 559:	83 c3 01             	add    $0x1,%ebx
+ 55c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 55f:	7c cf                	jl     530 <gets+0x10>
+ 561:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 56a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 56d:	5b                   	pop    %ebx
+ 56e:	5e                   	pop    %esi
+ 56f:	5f                   	pop    %edi
+ 570:	5d                   	pop    %ebp
+ 571:	c3                   	ret
+ 572:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	56                   	push   %esi
+ 584:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 585:	83 ec 08             	sub    $0x8,%esp
+ 588:	6a 00                	push   $0x0
+ 58a:	ff 75 08             	push   0x8(%ebp)
+ 58d:	e8 91 01 00 00       	call   723 <open>
+  if(fd < 0)
+ 592:	83 c4 10             	add    $0x10,%esp
+ 595:	85 c0                	test   %eax,%eax
+ 597:	78 27                	js     5c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 599:	83 ec 08             	sub    $0x8,%esp
+ 59c:	ff 75 0c             	push   0xc(%ebp)
+ 59f:	89 c3                	mov    %eax,%ebx
+ 5a1:	50                   	push   %eax
+ 5a2:	e8 94 01 00 00       	call   73b <fstat>
+  close(fd);
+ 5a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 5aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 5ac:	e8 5a 01 00 00       	call   70b <close>
+  return r;
+ 5b1:	83 c4 10             	add    $0x10,%esp
+}
+ 5b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5b7:	89 f0                	mov    %esi,%eax
+ 5b9:	5b                   	pop    %ebx
+ 5ba:	5e                   	pop    %esi
+ 5bb:	5d                   	pop    %ebp
+ 5bc:	c3                   	ret
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5c5:	eb ed                	jmp    5b4 <stat+0x34>
+ 5c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	56                   	push   %esi
+ 5d4:	53                   	push   %ebx
+ 5d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 5d8:	0f b6 02             	movzbl (%edx),%eax
+ 5db:	3c 20                	cmp    $0x20,%al
+ 5dd:	75 0c                	jne    5eb <atoi+0x1b>
+ 5df:	90                   	nop
+ 5e0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 5e4:	83 c2 01             	add    $0x1,%edx
+ 5e7:	3c 20                	cmp    $0x20,%al
+ 5e9:	74 f5                	je     5e0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 5eb:	3c 2d                	cmp    $0x2d,%al
+ 5ed:	74 41                	je     630 <atoi+0x60>
+ 5ef:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 5f4:	3c 2b                	cmp    $0x2b,%al
+ 5f6:	74 3d                	je     635 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 5f8:	0f be 0a             	movsbl (%edx),%ecx
+ 5fb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 5fe:	3c 09                	cmp    $0x9,%al
+ 600:	b8 00 00 00 00       	mov    $0x0,%eax
+ 605:	77 21                	ja     628 <atoi+0x58>
+ 607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 610:	83 c2 01             	add    $0x1,%edx
+ 613:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 616:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 61a:	0f be 0a             	movsbl (%edx),%ecx
+ 61d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 620:	80 fb 09             	cmp    $0x9,%bl
+ 623:	76 eb                	jbe    610 <atoi+0x40>
+  return sign*n;
+ 625:	0f af c6             	imul   %esi,%eax
+}
+ 628:	5b                   	pop    %ebx
+ 629:	5e                   	pop    %esi
+ 62a:	5d                   	pop    %ebp
+ 62b:	c3                   	ret
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 630:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 635:	83 c2 01             	add    $0x1,%edx
+ 638:	eb be                	jmp    5f8 <atoi+0x28>
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000640 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	56                   	push   %esi
+ 644:	53                   	push   %ebx
+ 645:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 648:	0f b6 02             	movzbl (%edx),%eax
+ 64b:	3c 20                	cmp    $0x20,%al
+ 64d:	75 0c                	jne    65b <atoo+0x1b>
+ 64f:	90                   	nop
+ 650:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 654:	83 c2 01             	add    $0x1,%edx
+ 657:	3c 20                	cmp    $0x20,%al
+ 659:	74 f5                	je     650 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 65b:	3c 2d                	cmp    $0x2d,%al
+ 65d:	74 41                	je     6a0 <atoo+0x60>
+ 65f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 664:	3c 2b                	cmp    $0x2b,%al
+ 666:	74 3d                	je     6a5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 668:	0f be 0a             	movsbl (%edx),%ecx
+ 66b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 66e:	3c 07                	cmp    $0x7,%al
+ 670:	b8 00 00 00 00       	mov    $0x0,%eax
+ 675:	77 1e                	ja     695 <atoo+0x55>
+ 677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 680:	83 c2 01             	add    $0x1,%edx
+ 683:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 687:	0f be 0a             	movsbl (%edx),%ecx
+ 68a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 68d:	80 fb 07             	cmp    $0x7,%bl
+ 690:	76 ee                	jbe    680 <atoo+0x40>
+  return sign*n;
+ 692:	0f af c6             	imul   %esi,%eax
+}
+ 695:	5b                   	pop    %ebx
+ 696:	5e                   	pop    %esi
+ 697:	5d                   	pop    %ebp
+ 698:	c3                   	ret
+ 699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 6a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 6a5:	83 c2 01             	add    $0x1,%edx
+ 6a8:	eb be                	jmp    668 <atoo+0x28>
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006b0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 6be:	85 c0                	test   %eax,%eax
+ 6c0:	7e 13                	jle    6d5 <memmove+0x25>
+ 6c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6c4:	89 d7                	mov    %edx,%edi
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6d1:	39 f8                	cmp    %edi,%eax
+ 6d3:	75 fb                	jne    6d0 <memmove+0x20>
+  return vdst;
+}
+ 6d5:	5e                   	pop    %esi
+ 6d6:	89 d0                	mov    %edx,%eax
+ 6d8:	5f                   	pop    %edi
+ 6d9:	5d                   	pop    %ebp
+ 6da:	c3                   	ret
+
+000006db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <exit>:
+SYSCALL(exit)
+ 6e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <wait>:
+SYSCALL(wait)
+ 6eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <pipe>:
+SYSCALL(pipe)
+ 6f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <read>:
+SYSCALL(read)
+ 6fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <write>:
+SYSCALL(write)
+ 703:	b8 10 00 00 00       	mov    $0x10,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <close>:
+SYSCALL(close)
+ 70b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <kill>:
+SYSCALL(kill)
+ 713:	b8 06 00 00 00       	mov    $0x6,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <exec>:
+SYSCALL(exec)
+ 71b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <open>:
+SYSCALL(open)
+ 723:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <mknod>:
+SYSCALL(mknod)
+ 72b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <unlink>:
+SYSCALL(unlink)
+ 733:	b8 12 00 00 00       	mov    $0x12,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <fstat>:
+SYSCALL(fstat)
+ 73b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <link>:
+SYSCALL(link)
+ 743:	b8 13 00 00 00       	mov    $0x13,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <mkdir>:
+SYSCALL(mkdir)
+ 74b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <chdir>:
+SYSCALL(chdir)
+ 753:	b8 09 00 00 00       	mov    $0x9,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <dup>:
+SYSCALL(dup)
+ 75b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <getpid>:
+SYSCALL(getpid)
+ 763:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <sbrk>:
+SYSCALL(sbrk)
+ 76b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <sleep>:
+SYSCALL(sleep)
+ 773:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <uptime>:
+SYSCALL(uptime)
+ 77b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <superpages>:
+SYSCALL(superpages)
+ 783:	b8 23 00 00 00       	mov    $0x23,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <mmap>:
+SYSCALL(mmap)
+ 78b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <munmap>:
+SYSCALL(munmap)
+ 793:	b8 25 00 00 00       	mov    $0x25,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <spawn>:
+SYSCALL(spawn)
+ 79b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <swapstat>:
+SYSCALL(swapstat)
+ 7a3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <getmeminfo>:
+SYSCALL(getmeminfo)
+ 7ab:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <iostat>:
+SYSCALL(iostat)
+ 7b3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <dropcache>:
+SYSCALL(dropcache)
+ 7bb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <iosched>:
+SYSCALL(iosched)
+ 7c3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <halt>:
+SYSCALL(halt)
+ 7cb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <date>:
+SYSCALL(date)
+ 7d3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 7db:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <getgid>:
+SYSCALL(getgid)
+ 7e3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <getppid>:
+SYSCALL(getppid)
+ 7eb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <setuid>:
+SYSCALL(setuid)
+ 7f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <setgid>:
+SYSCALL(setgid)
+ 7fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <getprocs>:
+SYSCALL(getprocs)
+ 803:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 80b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <getpriority>:
+SYSCALL(getpriority)
+ 813:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 81b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <chown>:
+SYSCALL(chown)
+ 823:	b8 21 00 00 00       	mov    $0x21,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <chgrp>:
+SYSCALL(chgrp)
+ 82b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+ 833:	66 90                	xchg   %ax,%ax
+ 835:	66 90                	xchg   %ax,%ax
+ 837:	66 90                	xchg   %ax,%ax
+ 839:	66 90                	xchg   %ax,%ax
+ 83b:	66 90                	xchg   %ax,%ax
+ 83d:	66 90                	xchg   %ax,%ax
+ 83f:	90                   	nop
+
+00000840 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 848:	89 d1                	mov    %edx,%ecx
+{
+ 84a:	83 ec 3c             	sub    $0x3c,%esp
+ 84d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 850:	85 d2                	test   %edx,%edx
+ 852:	0f 89 80 00 00 00    	jns    8d8 <printint+0x98>
+ 858:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 85c:	74 7a                	je     8d8 <printint+0x98>
+    x = -xx;
+ 85e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 860:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 865:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 868:	31 f6                	xor    %esi,%esi
+ 86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 870:	89 c8                	mov    %ecx,%eax
+ 872:	31 d2                	xor    %edx,%edx
+ 874:	89 f7                	mov    %esi,%edi
+ 876:	f7 f3                	div    %ebx
+ 878:	8d 76 01             	lea    0x1(%esi),%esi
+ 87b:	0f b6 92 1c 0f 00 00 	movzbl 0xf1c(%edx),%edx
+ 882:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 886:	89 ca                	mov    %ecx,%edx
+ 888:	89 c1                	mov    %eax,%ecx
+ 88a:	39 da                	cmp    %ebx,%edx
+ 88c:	73 e2                	jae    870 <printint+0x30>
+  if(neg)
+ 88e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 891:	85 c0                	test   %eax,%eax
+ 893:	74 07                	je     89c <printint+0x5c>
+    buf[i++] = '-';
+ 895:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 89a:	89 f7                	mov    %esi,%edi
+ 89c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 89f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8a2:	01 df                	add    %ebx,%edi
+ 8a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8ab:	83 ec 04             	sub    $0x4,%esp
+ 8ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8b4:	6a 01                	push   $0x1
+ 8b6:	50                   	push   %eax
+ 8b7:	56                   	push   %esi
+ 8b8:	e8 46 fe ff ff       	call   703 <write>
+  while(--i >= 0)
+ 8bd:	89 f8                	mov    %edi,%eax
+ 8bf:	83 c4 10             	add    $0x10,%esp
+ 8c2:	83 ef 01             	sub    $0x1,%edi
+ 8c5:	39 d8                	cmp    %ebx,%eax
+ 8c7:	75 df                	jne    8a8 <printint+0x68>
+}
+ 8c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8cc:	5b                   	pop    %ebx
+ 8cd:	5e                   	pop    %esi
+ 8ce:	5f                   	pop    %edi
+ 8cf:	5d                   	pop    %ebp
+ 8d0:	c3                   	ret
+ 8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8d8:	31 c0                	xor    %eax,%eax
+ 8da:	eb 89                	jmp    865 <printint+0x25>
+ 8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 8f2:	83 c6 01             	add    $0x1,%esi
+ 8f5:	84 db                	test   %bl,%bl
+ 8f7:	74 67                	je     960 <printf+0x80>
+ 8f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8fc:	31 d2                	xor    %edx,%edx
+ 8fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 901:	eb 34                	jmp    937 <printf+0x57>
+ 903:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 907:	90                   	nop
+ 908:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 90b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 910:	83 f8 25             	cmp    $0x25,%eax
+ 913:	74 18                	je     92d <printf+0x4d>
+  write(fd, &c, 1);
+ 915:	83 ec 04             	sub    $0x4,%esp
+ 918:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 91b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 91e:	6a 01                	push   $0x1
+ 920:	50                   	push   %eax
+ 921:	57                   	push   %edi
+ 922:	e8 dc fd ff ff       	call   703 <write>
+ 927:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 92a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 92d:	0f b6 1e             	movzbl (%esi),%ebx
+ 930:	83 c6 01             	add    $0x1,%esi
+ 933:	84 db                	test   %bl,%bl
+ 935:	74 29                	je     960 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 937:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 93a:	85 d2                	test   %edx,%edx
+ 93c:	74 ca                	je     908 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 93e:	83 fa 25             	cmp    $0x25,%edx
+ 941:	75 ea                	jne    92d <printf+0x4d>
+      if(c == 'd'){
+ 943:	83 f8 25             	cmp    $0x25,%eax
+ 946:	0f 84 24 01 00 00    	je     a70 <printf+0x190>
+ 94c:	83 e8 63             	sub    $0x63,%eax
+ 94f:	83 f8 15             	cmp    $0x15,%eax
+ 952:	77 1c                	ja     970 <printf+0x90>
+ 954:	ff 24 85 c4 0e 00 00 	jmp    *0xec4(,%eax,4)
+ 95b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 963:	5b                   	pop    %ebx
+ 964:	5e                   	pop    %esi
+ 965:	5f                   	pop    %edi
+ 966:	5d                   	pop    %ebp
+ 967:	c3                   	ret
+ 968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+  write(fd, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 976:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 97a:	6a 01                	push   $0x1
+ 97c:	52                   	push   %edx
+ 97d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 980:	57                   	push   %edi
+ 981:	e8 7d fd ff ff       	call   703 <write>
+ 986:	83 c4 0c             	add    $0xc,%esp
+ 989:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 98c:	6a 01                	push   $0x1
+ 98e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 991:	52                   	push   %edx
+ 992:	57                   	push   %edi
+ 993:	e8 6b fd ff ff       	call   703 <write>
+        putc(fd, c);
+ 998:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 99b:	31 d2                	xor    %edx,%edx
+ 99d:	eb 8e                	jmp    92d <printf+0x4d>
+ 99f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9ab:	8b 13                	mov    (%ebx),%edx
+ 9ad:	6a 00                	push   $0x0
+ 9af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9b4:	e8 87 fe ff ff       	call   840 <printint>
+        ap++;
+ 9b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9bf:	31 d2                	xor    %edx,%edx
+ 9c1:	e9 67 ff ff ff       	jmp    92d <printf+0x4d>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9d5:	83 c0 04             	add    $0x4,%eax
+ 9d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9db:	85 db                	test   %ebx,%ebx
+ 9dd:	0f 84 9d 00 00 00    	je     a80 <printf+0x1a0>
+        while(*s != 0){
+ 9e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9e8:	84 c0                	test   %al,%al
+ 9ea:	0f 84 3d ff ff ff    	je     92d <printf+0x4d>
+ 9f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9f6:	89 de                	mov    %ebx,%esi
+ 9f8:	89 d3                	mov    %edx,%ebx
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a06:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a09:	6a 01                	push   $0x1
+ a0b:	53                   	push   %ebx
+ a0c:	57                   	push   %edi
+ a0d:	e8 f1 fc ff ff       	call   703 <write>
+        while(*s != 0){
+ a12:	0f b6 06             	movzbl (%esi),%eax
+ a15:	83 c4 10             	add    $0x10,%esp
+ a18:	84 c0                	test   %al,%al
+ a1a:	75 e4                	jne    a00 <printf+0x120>
+      state = 0;
+ a1c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a1f:	31 d2                	xor    %edx,%edx
+ a21:	e9 07 ff ff ff       	jmp    92d <printf+0x4d>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a3b:	8b 13                	mov    (%ebx),%edx
+ a3d:	6a 01                	push   $0x1
+ a3f:	e9 6b ff ff ff       	jmp    9af <printf+0xcf>
+ a44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a48:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a4b:	83 ec 04             	sub    $0x4,%esp
+ a4e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a51:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a53:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a56:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a59:	6a 01                	push   $0x1
+ a5b:	52                   	push   %edx
+ a5c:	57                   	push   %edi
+ a5d:	e8 a1 fc ff ff       	call   703 <write>
+        ap++;
+ a62:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a65:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a68:	31 d2                	xor    %edx,%edx
+ a6a:	e9 be fe ff ff       	jmp    92d <printf+0x4d>
+ a6f:	90                   	nop
+  write(fd, &c, 1);
+ a70:	83 ec 04             	sub    $0x4,%esp
+ a73:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a76:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a79:	6a 01                	push   $0x1
+ a7b:	e9 11 ff ff ff       	jmp    991 <printf+0xb1>
+ a80:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a85:	bb bd 0e 00 00       	mov    $0xebd,%ebx
+ a8a:	e9 61 ff ff ff       	jmp    9f0 <printf+0x110>
+ a8f:	90                   	nop
+
+00000a90 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a93:	a1 e4 50 00 00       	mov    0x50e4,%eax
+{
+ a98:	89 e5                	mov    %esp,%ebp
+ a9a:	56                   	push   %esi
+ a9b:	53                   	push   %ebx
+ a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aa0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aa2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aa4:	39 ca                	cmp    %ecx,%edx
+ aa6:	73 30                	jae    ad8 <lfree+0x48>
+ aa8:	39 c1                	cmp    %eax,%ecx
+ aaa:	72 04                	jb     ab0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aac:	39 c2                	cmp    %eax,%edx
+ aae:	72 f0                	jb     aa0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ab0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ ab3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ ab6:	39 f0                	cmp    %esi,%eax
+ ab8:	74 26                	je     ae0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aba:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ abc:	8b 42 04             	mov    0x4(%edx),%eax
+ abf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ ac2:	39 d9                	cmp    %ebx,%ecx
+ ac4:	74 30                	je     af6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ ac6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ac8:	5b                   	pop    %ebx
+  freep = p;
+ ac9:	89 15 e4 50 00 00    	mov    %edx,0x50e4
+}
+ acf:	5e                   	pop    %esi
+ ad0:	5d                   	pop    %ebp
+ ad1:	c3                   	ret
+ ad2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ad8:	39 c1                	cmp    %eax,%ecx
+ ada:	72 d0                	jb     aac <lfree+0x1c>
+ adc:	eb c2                	jmp    aa0 <lfree+0x10>
+ ade:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ ae0:	03 58 04             	add    0x4(%eax),%ebx
+ ae3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ae6:	8b 02                	mov    (%edx),%eax
+ ae8:	8b 00                	mov    (%eax),%eax
+ aea:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ aec:	8b 42 04             	mov    0x4(%edx),%eax
+ aef:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ af2:	39 d9                	cmp    %ebx,%ecx
+ af4:	75 d0                	jne    ac6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ af6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ af9:	89 15 e4 50 00 00    	mov    %edx,0x50e4
+    p->s.size += bp->s.size;
+ aff:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b02:	8b 09                	mov    (%ecx),%ecx
+ b04:	89 0a                	mov    %ecx,(%edx)
+}
+ b06:	5b                   	pop    %ebx
+ b07:	5e                   	pop    %esi
+ b08:	5d                   	pop    %ebp
+ b09:	c3                   	ret
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b10 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	89 c7                	mov    %eax,%edi
+ b16:	56                   	push   %esi
+ b17:	53                   	push   %ebx
+ b18:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ b1b:	a1 e4 50 00 00       	mov    0x50e4,%eax
+ b20:	85 c0                	test   %eax,%eax
+ b22:	0f 84 88 00 00 00    	je     bb0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b28:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b2a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ b2d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b32:	39 df                	cmp    %ebx,%edi
+ b34:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b37:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ b3e:	39 f9                	cmp    %edi,%ecx
+ b40:	72 0f                	jb     b51 <lalloc+0x41>
+ b42:	eb 4c                	jmp    b90 <lalloc+0x80>
+ b44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b48:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ b4a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ b4d:	39 f9                	cmp    %edi,%ecx
+ b4f:	73 3f                	jae    b90 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ b51:	89 d0                	mov    %edx,%eax
+ b53:	39 15 e4 50 00 00    	cmp    %edx,0x50e4
+ b59:	75 ed                	jne    b48 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ b5b:	83 ec 0c             	sub    $0xc,%esp
+ b5e:	56                   	push   %esi
+ b5f:	e8 07 fc ff ff       	call   76b <sbrk>
+  if(p == (char*)-1)
+ b64:	83 c4 10             	add    $0x10,%esp
+ b67:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b6a:	74 11                	je     b7d <lalloc+0x6d>
+  hp->s.size = nu;
+ b6c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ b6f:	e8 1c ff ff ff       	call   a90 <lfree>
+  return freep;
+ b74:	a1 e4 50 00 00       	mov    0x50e4,%eax
+      if((p = morecore(nunits)) == 0)
+ b79:	85 c0                	test   %eax,%eax
+ b7b:	75 cb                	jne    b48 <lalloc+0x38>
+        return 0;
+  }
+}
+ b7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b80:	31 d2                	xor    %edx,%edx
+}
+ b82:	5b                   	pop    %ebx
+ b83:	89 d0                	mov    %edx,%eax
+ b85:	5e                   	pop    %esi
+ b86:	5f                   	pop    %edi
+ b87:	5d                   	pop    %ebp
+ b88:	c3                   	ret
+ b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ b90:	39 cf                	cmp    %ecx,%edi
+ b92:	74 4c                	je     be0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ b94:	29 f9                	sub    %edi,%ecx
+ b96:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ b99:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ b9c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ b9f:	a3 e4 50 00 00       	mov    %eax,0x50e4
+}
+ ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ba7:	89 d0                	mov    %edx,%eax
+ ba9:	5b                   	pop    %ebx
+ baa:	5e                   	pop    %esi
+ bab:	5f                   	pop    %edi
+ bac:	5d                   	pop    %ebp
+ bad:	c3                   	ret
+ bae:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ bb0:	ba e8 50 00 00       	mov    $0x50e8,%edx
+ bb5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ bb7:	c7 05 e4 50 00 00 e8 	movl   $0x50e8,0x50e4
+ bbe:	50 00 00 
+ bc1:	c7 05 e8 50 00 00 e8 	movl   $0x50e8,0x50e8
+ bc8:	50 00 00 
+ bcb:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ bcd:	c7 05 ec 50 00 00 00 	movl   $0x0,0x50ec
+ bd4:	00 00 00 
+ bd7:	e9 51 ff ff ff       	jmp    b2d <lalloc+0x1d>
+ bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ be0:	8b 0a                	mov    (%edx),%ecx
+ be2:	89 08                	mov    %ecx,(%eax)
+ be4:	eb b9                	jmp    b9f <lalloc+0x8f>
+ be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bf0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+ bf3:	57                   	push   %edi
+ bf4:	56                   	push   %esi
+ bf5:	53                   	push   %ebx
+ bf6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ bf9:	85 f6                	test   %esi,%esi
+ bfb:	74 42                	je     c3f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ bfd:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ c00:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ c03:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ c09:	77 3d                	ja     c48 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ c0b:	31 c9                	xor    %ecx,%ecx
+ c0d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ c12:	83 fa 02             	cmp    $0x2,%edx
+ c15:	74 17                	je     c2e <free+0x3e>
+ c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1e:	66 90                	xchg   %ax,%ax
+ c20:	83 c1 01             	add    $0x1,%ecx
+ c23:	89 d8                	mov    %ebx,%eax
+ c25:	d3 e0                	shl    %cl,%eax
+ c27:	83 c0 01             	add    $0x1,%eax
+ c2a:	39 c2                	cmp    %eax,%edx
+ c2c:	75 f2                	jne    c20 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ c2e:	8b 04 8d c0 50 00 00 	mov    0x50c0(,%ecx,4),%eax
+  classes[c] = bp;
+ c35:	89 3c 8d c0 50 00 00 	mov    %edi,0x50c0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ c3c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ c3f:	5b                   	pop    %ebx
+ c40:	5e                   	pop    %esi
+ c41:	5f                   	pop    %edi
+ c42:	5d                   	pop    %ebp
+ c43:	c3                   	ret
+ c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c48:	5b                   	pop    %ebx
+    lfree(bp);
+ c49:	89 f8                	mov    %edi,%eax
+}
+ c4b:	5e                   	pop    %esi
+ c4c:	5f                   	pop    %edi
+ c4d:	5d                   	pop    %ebp
+    lfree(bp);
+ c4e:	e9 3d fe ff ff       	jmp    a90 <lfree>
+ c53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c60 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	57                   	push   %edi
+ c64:	56                   	push   %esi
+ c65:	53                   	push   %ebx
+ c66:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c69:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6c:	83 c0 07             	add    $0x7,%eax
+ c6f:	c1 e8 03             	shr    $0x3,%eax
+ c72:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ c75:	3d 01 01 00 00       	cmp    $0x101,%eax
+ c7a:	77 44                	ja     cc0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ c7c:	31 c9                	xor    %ecx,%ecx
+ c7e:	ba 01 00 00 00       	mov    $0x1,%edx
+ c83:	bb 02 00 00 00       	mov    $0x2,%ebx
+ c88:	83 f8 02             	cmp    $0x2,%eax
+ c8b:	76 11                	jbe    c9e <malloc+0x3e>
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+ c90:	83 c1 01             	add    $0x1,%ecx
+ c93:	89 d3                	mov    %edx,%ebx
+ c95:	d3 e3                	shl    %cl,%ebx
+ c97:	83 c3 01             	add    $0x1,%ebx
+ c9a:	39 c3                	cmp    %eax,%ebx
+ c9c:	72 f2                	jb     c90 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ c9e:	8b 04 8d c0 50 00 00 	mov    0x50c0(,%ecx,4),%eax
+ ca5:	85 c0                	test   %eax,%eax
+ ca7:	74 2f                	je     cd8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ ca9:	8b 10                	mov    (%eax),%edx
+ cab:	89 14 8d c0 50 00 00 	mov    %edx,0x50c0(,%ecx,4)
+  return (void*)(p + 1);
+ cb2:	83 c0 08             	add    $0x8,%eax
+}
+ cb5:	83 c4 1c             	add    $0x1c,%esp
+ cb8:	5b                   	pop    %ebx
+ cb9:	5e                   	pop    %esi
+ cba:	5f                   	pop    %edi
+ cbb:	5d                   	pop    %ebp
+ cbc:	c3                   	ret
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ cc0:	e8 4b fe ff ff       	call   b10 <lalloc>
+ cc5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ cc7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ cca:	85 d2                	test   %edx,%edx
+ ccc:	75 e7                	jne    cb5 <malloc+0x55>
+      return 0;
+ cce:	31 c0                	xor    %eax,%eax
+ cd0:	eb e3                	jmp    cb5 <malloc+0x55>
+ cd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ cd8:	31 d2                	xor    %edx,%edx
+ cda:	b8 00 02 00 00       	mov    $0x200,%eax
+ cdf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ ce2:	f7 f3                	div    %ebx
+  if(n < 4)
+ ce4:	ba 04 00 00 00       	mov    $0x4,%edx
+ ce9:	89 d6                	mov    %edx,%esi
+ ceb:	39 d0                	cmp    %edx,%eax
+ ced:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ cf0:	0f af f3             	imul   %ebx,%esi
+ cf3:	89 f0                	mov    %esi,%eax
+ cf5:	e8 16 fe ff ff       	call   b10 <lalloc>
+ cfa:	85 c0                	test   %eax,%eax
+ cfc:	74 d0                	je     cce <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ cfe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ d01:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ d04:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d0b:	8b 14 8d c0 50 00 00 	mov    0x50c0(,%ecx,4),%edx
+ d12:	39 f8                	cmp    %edi,%eax
+ d14:	73 22                	jae    d38 <malloc+0xd8>
+ d16:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ d19:	eb 09                	jmp    d24 <malloc+0xc4>
+ d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d1f:	90                   	nop
+ d20:	89 c2                	mov    %eax,%edx
+ d22:	89 c8                	mov    %ecx,%eax
+ d24:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ d27:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ d2a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ d2c:	39 f9                	cmp    %edi,%ecx
+ d2e:	72 f0                	jb     d20 <malloc+0xc0>
+ d30:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ d33:	e9 73 ff ff ff       	jmp    cab <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ d38:	89 d0                	mov    %edx,%eax
+ d3a:	8b 12                	mov    (%edx),%edx
+ d3c:	e9 6a ff ff ff       	jmp    cab <malloc+0x4b>
+ d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4f:	90                   	nop
+
+00000d50 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	56                   	push   %esi
+ d54:	53                   	push   %ebx
+ d55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ d58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ d5b:	85 c9                	test   %ecx,%ecx
+ d5d:	74 06                	je     d65 <calloc+0x15>
+ d5f:	89 c8                	mov    %ecx,%eax
+ d61:	f7 e3                	mul    %ebx
+ d63:	70 33                	jo     d98 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ d65:	0f af d9             	imul   %ecx,%ebx
+ d68:	83 ec 0c             	sub    $0xc,%esp
+ d6b:	53                   	push   %ebx
+ d6c:	e8 ef fe ff ff       	call   c60 <malloc>
+ d71:	83 c4 10             	add    $0x10,%esp
+ d74:	89 c6                	mov    %eax,%esi
+ d76:	85 c0                	test   %eax,%eax
+ d78:	74 1e                	je     d98 <calloc+0x48>
+    memset(p, 0, n * size);
+ d7a:	83 ec 04             	sub    $0x4,%esp
+ d7d:	53                   	push   %ebx
+ d7e:	6a 00                	push   $0x0
+ d80:	50                   	push   %eax
+ d81:	e8 3a f7 ff ff       	call   4c0 <memset>
+ d86:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ d89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d8c:	89 f0                	mov    %esi,%eax
+ d8e:	5b                   	pop    %ebx
+ d8f:	5e                   	pop    %esi
+ d90:	5d                   	pop    %ebp
+ d91:	c3                   	ret
+ d92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ d98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ d9b:	31 f6                	xor    %esi,%esi
+}
+ d9d:	89 f0                	mov    %esi,%eax
+ d9f:	5b                   	pop    %ebx
+ da0:	5e                   	pop    %esi
+ da1:	5d                   	pop    %ebp
+ da2:	c3                   	ret
+ da3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000db0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ db0:	55                   	push   %ebp
+ db1:	89 e5                	mov    %esp,%ebp
+ db3:	57                   	push   %edi
+ db4:	56                   	push   %esi
+ db5:	53                   	push   %ebx
+ db6:	83 ec 0c             	sub    $0xc,%esp
+ db9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ dbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ dbf:	85 db                	test   %ebx,%ebx
+ dc1:	74 55                	je     e18 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ dc3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ dc6:	89 de                	mov    %ebx,%esi
+ dc8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ dcf:	39 c7                	cmp    %eax,%edi
+ dd1:	72 0d                	jb     de0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dd6:	89 f0                	mov    %esi,%eax
+ dd8:	5b                   	pop    %ebx
+ dd9:	5e                   	pop    %esi
+ dda:	5f                   	pop    %edi
+ ddb:	5d                   	pop    %ebp
+ ddc:	c3                   	ret
+ ddd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ de0:	83 ec 0c             	sub    $0xc,%esp
+ de3:	50                   	push   %eax
+ de4:	e8 77 fe ff ff       	call   c60 <malloc>
+ de9:	83 c4 10             	add    $0x10,%esp
+ dec:	89 c6                	mov    %eax,%esi
+ dee:	85 c0                	test   %eax,%eax
+ df0:	74 e1                	je     dd3 <realloc+0x23>
+  memmove(p, ap, have);
+ df2:	83 ec 04             	sub    $0x4,%esp
+ df5:	57                   	push   %edi
+ df6:	53                   	push   %ebx
+ df7:	50                   	push   %eax
+ df8:	e8 b3 f8 ff ff       	call   6b0 <memmove>
+  free(ap);
+ dfd:	89 1c 24             	mov    %ebx,(%esp)
+ e00:	e8 eb fd ff ff       	call   bf0 <free>
+  return p;
+ e05:	83 c4 10             	add    $0x10,%esp
+}
+ e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e0b:	89 f0                	mov    %esi,%eax
+ e0d:	5b                   	pop    %ebx
+ e0e:	5e                   	pop    %esi
+ e0f:	5f                   	pop    %edi
+ e10:	5d                   	pop    %ebp
+ e11:	c3                   	ret
+ e12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ e18:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e1e:	5b                   	pop    %ebx
+ e1f:	5e                   	pop    %esi
+ e20:	5f                   	pop    %edi
+ e21:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ e22:	e9 39 fe ff ff       	jmp    c60 <malloc>
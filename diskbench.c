@@ -0,0 +1,166 @@
+// Measure disk throughput and the CPU time it costs.  Reads
+// every file in / after dropping the buffer cache, and rewrites
+// a 32 KB file over and over.  Meanwhile NSOAK processes (one
+// per CPU; the argument overrides) spin, and the CPU time they
+// lose, against an idle period, is what the disk I/O used.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "uproc.h"
+
+#define NSOAK   2
+#define MAXSOAK 8
+#define WSIZE   (32*1024)
+#define WPASSES 20
+#define NUPROC  72
+
+char buf[8192];
+int soaker[MAXSOAK];
+int nsoak;
+
+static void
+startsoak(void)
+{
+  int i;
+
+  for(i = 0; i < nsoak; i++){
+    if((soaker[i] = fork()) == 0)
+      for(;;)
+        ;
+  }
+}
+
+static void
+stopsoak(void)
+{
+  int i;
+
+  for(i = 0; i < nsoak; i++)
+    kill(soaker[i]);
+  for(i = 0; i < nsoak; i++)
+    wait();
+}
+
+// CPU time the soakers have had, in ms.
+static uint
+soaked(void)
+{
+  static struct uproc tab[NUPROC];
+  int i, j, n;
+  uint t;
+
+  n = getprocs(NUPROC, tab);
+  t = 0;
+  for(i = 0; i < n; i++)
+    for(j = 0; j < nsoak; j++)
+      if(tab[i].pid == soaker[j])
+        t += tab[i].CPU_total_ticks;
+  return t;
+}
+
+// Read every file in /; return the bytes read.
+static uint
+readall(void)
+{
+  char path[DIRSIZ+2];
+  struct dirent de;
+  struct stat st;
+  int dfd, fd, n;
+  uint tot;
+
+  dfd = open("/", O_RDONLY);
+  tot = 0;
+  while(read(dfd, &de, sizeof(de)) == sizeof(de)){
+    if(de.inum == 0)
+      continue;
+    path[0] = '/';
+    memmove(path + 1, de.name, DIRSIZ);
+    path[DIRSIZ+1] = 0;
+    if((fd = open(path, O_RDONLY)) < 0)
+      continue;
+    if(fstat(fd, &st) == 0 && st.type == T_FILE)
+      while((n = read(fd, buf, sizeof(buf))) > 0)
+        tot += n;
+    close(fd);
+  }
+  close(dfd);
+  return tot;
+}
+
+// Rewrite one file WPASSES times; return the bytes written.
+static uint
+writeall(void)
+{
+  int fd, i, j;
+
+  for(i = 0; i < WPASSES; i++){
+    if((fd = open("diskbench.tmp", O_CREATE|O_WRONLY)) < 0){
+      printf(2, "diskbench: cannot create diskbench.tmp\n");
+      stopsoak();
+      exit();
+    }
+    for(j = 0; j < WSIZE; j += sizeof(buf))
+      write(fd, buf, sizeof(buf));
+    close(fd);
+  }
+  return WPASSES * WSIZE;
+}
+
+// Percent of the soakers' CPU time lost, given what they got
+// per ms of an idle period (idle, scaled by 1000).
+static int
+busy(uint soak, int t, uint idle)
+{
+  uint expect;
+
+  expect = idle * t / 1000;
+  if(expect == 0 || soak >= expect)
+    return 0;
+  return (expect - soak) * 100 / expect;
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint s, idle, tot;
+  int t;
+
+  nsoak = argc > 1 ? atoi(argv[1]) : NSOAK;
+  if(nsoak < 1 || nsoak > MAXSOAK)
+    nsoak = NSOAK;
+  startsoak();
+
+  s = soaked();
+  t = uptime();
+  sleep(200);
+  t = uptime() - t;
+  idle = (soaked() - s) * 1000 / t;
+
+  dropcache();
+  s = soaked();
+  t = uptime();
+  tot = readall();
+  t = uptime() - t;
+  s = soaked() - s;
+  if(t == 0)
+    t = 1;
+  printf(1, "read:  %d KB in %d ms, %d KB/s, %d%% of CPU\n",
+         tot / 1024, t, tot / t * 1000 / 1024, busy(s, t, idle));
+
+  s = soaked();
+  t = uptime();
+  tot = writeall();
+  t = uptime() - t;
+  s = soaked() - s;
+  if(t == 0)
+    t = 1;
+  printf(1, "write: %d KB in %d ms, %d KB/s, %d%% of CPU\n",
+         tot / 1024, t, tot / t * 1000 / 1024, busy(s, t, idle));
+
+  stopsoak();
+  unlink("diskbench.tmp");
+  exit();
+}
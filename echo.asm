@@ -0,0 +1,1664 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 98 0a 00 00       	push   $0xa98
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 9a 0a 00 00       	push   $0xa9a
+  3e:	6a 01                	push   $0x1
+  40:	e8 0b 05 00 00       	call   550 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 9f 0a 00 00       	push   $0xa9f
+  55:	50                   	push   %eax
+  56:	68 9a 0a 00 00       	push   $0xa9a
+  5b:	6a 01                	push   $0x1
+  5d:	e8 ee 04 00 00       	call   550 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 e9 02 00 00       	call   353 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 be 01 00 00       	call   36b <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 91 01 00 00       	call   393 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 94 01 00 00       	call   3ab <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 5a 01 00 00       	call   37b <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+ 245:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 248:	0f b6 02             	movzbl (%edx),%eax
+ 24b:	3c 20                	cmp    $0x20,%al
+ 24d:	75 0c                	jne    25b <atoi+0x1b>
+ 24f:	90                   	nop
+ 250:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 254:	83 c2 01             	add    $0x1,%edx
+ 257:	3c 20                	cmp    $0x20,%al
+ 259:	74 f5                	je     250 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 25b:	3c 2d                	cmp    $0x2d,%al
+ 25d:	74 41                	je     2a0 <atoi+0x60>
+ 25f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 264:	3c 2b                	cmp    $0x2b,%al
+ 266:	74 3d                	je     2a5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 268:	0f be 0a             	movsbl (%edx),%ecx
+ 26b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 26e:	3c 09                	cmp    $0x9,%al
+ 270:	b8 00 00 00 00       	mov    $0x0,%eax
+ 275:	77 21                	ja     298 <atoi+0x58>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 280:	83 c2 01             	add    $0x1,%edx
+ 283:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 286:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 28a:	0f be 0a             	movsbl (%edx),%ecx
+ 28d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 290:	80 fb 09             	cmp    $0x9,%bl
+ 293:	76 eb                	jbe    280 <atoi+0x40>
+  return sign*n;
+ 295:	0f af c6             	imul   %esi,%eax
+}
+ 298:	5b                   	pop    %ebx
+ 299:	5e                   	pop    %esi
+ 29a:	5d                   	pop    %ebp
+ 29b:	c3                   	ret
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2a5:	83 c2 01             	add    $0x1,%edx
+ 2a8:	eb be                	jmp    268 <atoi+0x28>
+ 2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002b0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+ 2b4:	53                   	push   %ebx
+ 2b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2b8:	0f b6 02             	movzbl (%edx),%eax
+ 2bb:	3c 20                	cmp    $0x20,%al
+ 2bd:	75 0c                	jne    2cb <atoo+0x1b>
+ 2bf:	90                   	nop
+ 2c0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2c4:	83 c2 01             	add    $0x1,%edx
+ 2c7:	3c 20                	cmp    $0x20,%al
+ 2c9:	74 f5                	je     2c0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2cb:	3c 2d                	cmp    $0x2d,%al
+ 2cd:	74 41                	je     310 <atoo+0x60>
+ 2cf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2d4:	3c 2b                	cmp    $0x2b,%al
+ 2d6:	74 3d                	je     315 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 2d8:	0f be 0a             	movsbl (%edx),%ecx
+ 2db:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2de:	3c 07                	cmp    $0x7,%al
+ 2e0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2e5:	77 1e                	ja     305 <atoo+0x55>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 2f0:	83 c2 01             	add    $0x1,%edx
+ 2f3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 2f7:	0f be 0a             	movsbl (%edx),%ecx
+ 2fa:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2fd:	80 fb 07             	cmp    $0x7,%bl
+ 300:	76 ee                	jbe    2f0 <atoo+0x40>
+  return sign*n;
+ 302:	0f af c6             	imul   %esi,%eax
+}
+ 305:	5b                   	pop    %ebx
+ 306:	5e                   	pop    %esi
+ 307:	5d                   	pop    %ebp
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 315:	83 c2 01             	add    $0x1,%edx
+ 318:	eb be                	jmp    2d8 <atoo+0x28>
+ 31a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000320 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+
+0000034b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 34b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <exit>:
+SYSCALL(exit)
+ 353:	b8 02 00 00 00       	mov    $0x2,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <wait>:
+SYSCALL(wait)
+ 35b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <pipe>:
+SYSCALL(pipe)
+ 363:	b8 04 00 00 00       	mov    $0x4,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <read>:
+SYSCALL(read)
+ 36b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <write>:
+SYSCALL(write)
+ 373:	b8 10 00 00 00       	mov    $0x10,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <close>:
+SYSCALL(close)
+ 37b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <kill>:
+SYSCALL(kill)
+ 383:	b8 06 00 00 00       	mov    $0x6,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <exec>:
+SYSCALL(exec)
+ 38b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <open>:
+SYSCALL(open)
+ 393:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mknod>:
+SYSCALL(mknod)
+ 39b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <unlink>:
+SYSCALL(unlink)
+ 3a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <fstat>:
+SYSCALL(fstat)
+ 3ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <link>:
+SYSCALL(link)
+ 3b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <mkdir>:
+SYSCALL(mkdir)
+ 3bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <chdir>:
+SYSCALL(chdir)
+ 3c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <dup>:
+SYSCALL(dup)
+ 3cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <getpid>:
+SYSCALL(getpid)
+ 3d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <sbrk>:
+SYSCALL(sbrk)
+ 3db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <sleep>:
+SYSCALL(sleep)
+ 3e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <uptime>:
+SYSCALL(uptime)
+ 3eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <superpages>:
+SYSCALL(superpages)
+ 3f3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <mmap>:
+SYSCALL(mmap)
+ 3fb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <munmap>:
+SYSCALL(munmap)
+ 403:	b8 25 00 00 00       	mov    $0x25,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <spawn>:
+SYSCALL(spawn)
+ 40b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <swapstat>:
+SYSCALL(swapstat)
+ 413:	b8 27 00 00 00       	mov    $0x27,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 41b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <iostat>:
+SYSCALL(iostat)
+ 423:	b8 29 00 00 00       	mov    $0x29,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <dropcache>:
+SYSCALL(dropcache)
+ 42b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <iosched>:
+SYSCALL(iosched)
+ 433:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <halt>:
+SYSCALL(halt)
+ 43b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <date>:
+SYSCALL(date)
+ 443:	b8 17 00 00 00       	mov    $0x17,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 44b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <getgid>:
+SYSCALL(getgid)
+ 453:	b8 19 00 00 00       	mov    $0x19,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <getppid>:
+SYSCALL(getppid)
+ 45b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <setuid>:
+SYSCALL(setuid)
+ 463:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <setgid>:
+SYSCALL(setgid)
+ 46b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getprocs>:
+SYSCALL(getprocs)
+ 473:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 47b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getpriority>:
+SYSCALL(getpriority)
+ 483:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 48b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <chown>:
+SYSCALL(chown)
+ 493:	b8 21 00 00 00       	mov    $0x21,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <chgrp>:
+SYSCALL(chgrp)
+ 49b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+ 4a3:	66 90                	xchg   %ax,%ax
+ 4a5:	66 90                	xchg   %ax,%ax
+ 4a7:	66 90                	xchg   %ax,%ax
+ 4a9:	66 90                	xchg   %ax,%ax
+ 4ab:	66 90                	xchg   %ax,%ax
+ 4ad:	66 90                	xchg   %ax,%ax
+ 4af:	90                   	nop
+
+000004b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4b8:	89 d1                	mov    %edx,%ecx
+{
+ 4ba:	83 ec 3c             	sub    $0x3c,%esp
+ 4bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4c0:	85 d2                	test   %edx,%edx
+ 4c2:	0f 89 80 00 00 00    	jns    548 <printint+0x98>
+ 4c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4cc:	74 7a                	je     548 <printint+0x98>
+    x = -xx;
+ 4ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4d8:	31 f6                	xor    %esi,%esi
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4e0:	89 c8                	mov    %ecx,%eax
+ 4e2:	31 d2                	xor    %edx,%edx
+ 4e4:	89 f7                	mov    %esi,%edi
+ 4e6:	f7 f3                	div    %ebx
+ 4e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4eb:	0f b6 92 00 0b 00 00 	movzbl 0xb00(%edx),%edx
+ 4f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4f6:	89 ca                	mov    %ecx,%edx
+ 4f8:	89 c1                	mov    %eax,%ecx
+ 4fa:	39 da                	cmp    %ebx,%edx
+ 4fc:	73 e2                	jae    4e0 <printint+0x30>
+  if(neg)
+ 4fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 501:	85 c0                	test   %eax,%eax
+ 503:	74 07                	je     50c <printint+0x5c>
+    buf[i++] = '-';
+ 505:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 50a:	89 f7                	mov    %esi,%edi
+ 50c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 50f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 512:	01 df                	add    %ebx,%edi
+ 514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 518:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 51b:	83 ec 04             	sub    $0x4,%esp
+ 51e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 521:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 524:	6a 01                	push   $0x1
+ 526:	50                   	push   %eax
+ 527:	56                   	push   %esi
+ 528:	e8 46 fe ff ff       	call   373 <write>
+  while(--i >= 0)
+ 52d:	89 f8                	mov    %edi,%eax
+ 52f:	83 c4 10             	add    $0x10,%esp
+ 532:	83 ef 01             	sub    $0x1,%edi
+ 535:	39 d8                	cmp    %ebx,%eax
+ 537:	75 df                	jne    518 <printint+0x68>
+}
+ 539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 53c:	5b                   	pop    %ebx
+ 53d:	5e                   	pop    %esi
+ 53e:	5f                   	pop    %edi
+ 53f:	5d                   	pop    %ebp
+ 540:	c3                   	ret
+ 541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 548:	31 c0                	xor    %eax,%eax
+ 54a:	eb 89                	jmp    4d5 <printint+0x25>
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 559:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 55c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 55f:	0f b6 1e             	movzbl (%esi),%ebx
+ 562:	83 c6 01             	add    $0x1,%esi
+ 565:	84 db                	test   %bl,%bl
+ 567:	74 67                	je     5d0 <printf+0x80>
+ 569:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 56c:	31 d2                	xor    %edx,%edx
+ 56e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 571:	eb 34                	jmp    5a7 <printf+0x57>
+ 573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 577:	90                   	nop
+ 578:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 57b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 580:	83 f8 25             	cmp    $0x25,%eax
+ 583:	74 18                	je     59d <printf+0x4d>
+  write(fd, &c, 1);
+ 585:	83 ec 04             	sub    $0x4,%esp
+ 588:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 58b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 58e:	6a 01                	push   $0x1
+ 590:	50                   	push   %eax
+ 591:	57                   	push   %edi
+ 592:	e8 dc fd ff ff       	call   373 <write>
+ 597:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 59a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 59d:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a0:	83 c6 01             	add    $0x1,%esi
+ 5a3:	84 db                	test   %bl,%bl
+ 5a5:	74 29                	je     5d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5aa:	85 d2                	test   %edx,%edx
+ 5ac:	74 ca                	je     578 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ae:	83 fa 25             	cmp    $0x25,%edx
+ 5b1:	75 ea                	jne    59d <printf+0x4d>
+      if(c == 'd'){
+ 5b3:	83 f8 25             	cmp    $0x25,%eax
+ 5b6:	0f 84 24 01 00 00    	je     6e0 <printf+0x190>
+ 5bc:	83 e8 63             	sub    $0x63,%eax
+ 5bf:	83 f8 15             	cmp    $0x15,%eax
+ 5c2:	77 1c                	ja     5e0 <printf+0x90>
+ 5c4:	ff 24 85 a8 0a 00 00 	jmp    *0xaa8(,%eax,4)
+ 5cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5d3:	5b                   	pop    %ebx
+ 5d4:	5e                   	pop    %esi
+ 5d5:	5f                   	pop    %edi
+ 5d6:	5d                   	pop    %ebp
+ 5d7:	c3                   	ret
+ 5d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+  write(fd, &c, 1);
+ 5e0:	83 ec 04             	sub    $0x4,%esp
+ 5e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ea:	6a 01                	push   $0x1
+ 5ec:	52                   	push   %edx
+ 5ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5f0:	57                   	push   %edi
+ 5f1:	e8 7d fd ff ff       	call   373 <write>
+ 5f6:	83 c4 0c             	add    $0xc,%esp
+ 5f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5fc:	6a 01                	push   $0x1
+ 5fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 601:	52                   	push   %edx
+ 602:	57                   	push   %edi
+ 603:	e8 6b fd ff ff       	call   373 <write>
+        putc(fd, c);
+ 608:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60b:	31 d2                	xor    %edx,%edx
+ 60d:	eb 8e                	jmp    59d <printf+0x4d>
+ 60f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 610:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 613:	83 ec 0c             	sub    $0xc,%esp
+ 616:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 61b:	8b 13                	mov    (%ebx),%edx
+ 61d:	6a 00                	push   $0x0
+ 61f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 621:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 624:	e8 87 fe ff ff       	call   4b0 <printint>
+        ap++;
+ 629:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 62c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 62f:	31 d2                	xor    %edx,%edx
+ 631:	e9 67 ff ff ff       	jmp    59d <printf+0x4d>
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 640:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 643:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 645:	83 c0 04             	add    $0x4,%eax
+ 648:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 64b:	85 db                	test   %ebx,%ebx
+ 64d:	0f 84 9d 00 00 00    	je     6f0 <printf+0x1a0>
+        while(*s != 0){
+ 653:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 656:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 658:	84 c0                	test   %al,%al
+ 65a:	0f 84 3d ff ff ff    	je     59d <printf+0x4d>
+ 660:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 663:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 666:	89 de                	mov    %ebx,%esi
+ 668:	89 d3                	mov    %edx,%ebx
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 676:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 679:	6a 01                	push   $0x1
+ 67b:	53                   	push   %ebx
+ 67c:	57                   	push   %edi
+ 67d:	e8 f1 fc ff ff       	call   373 <write>
+        while(*s != 0){
+ 682:	0f b6 06             	movzbl (%esi),%eax
+ 685:	83 c4 10             	add    $0x10,%esp
+ 688:	84 c0                	test   %al,%al
+ 68a:	75 e4                	jne    670 <printf+0x120>
+      state = 0;
+ 68c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 68f:	31 d2                	xor    %edx,%edx
+ 691:	e9 07 ff ff ff       	jmp    59d <printf+0x4d>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6a3:	83 ec 0c             	sub    $0xc,%esp
+ 6a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6ab:	8b 13                	mov    (%ebx),%edx
+ 6ad:	6a 01                	push   $0x1
+ 6af:	e9 6b ff ff ff       	jmp    61f <printf+0xcf>
+ 6b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6bb:	83 ec 04             	sub    $0x4,%esp
+ 6be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	52                   	push   %edx
+ 6cc:	57                   	push   %edi
+ 6cd:	e8 a1 fc ff ff       	call   373 <write>
+        ap++;
+ 6d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6d8:	31 d2                	xor    %edx,%edx
+ 6da:	e9 be fe ff ff       	jmp    59d <printf+0x4d>
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	e9 11 ff ff ff       	jmp    601 <printf+0xb1>
+ 6f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6f5:	bb a1 0a 00 00       	mov    $0xaa1,%ebx
+ 6fa:	e9 61 ff ff ff       	jmp    660 <printf+0x110>
+ 6ff:	90                   	nop
+
+00000700 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 703:	a1 e4 0e 00 00       	mov    0xee4,%eax
+{
+ 708:	89 e5                	mov    %esp,%ebp
+ 70a:	56                   	push   %esi
+ 70b:	53                   	push   %ebx
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 710:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 712:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 714:	39 ca                	cmp    %ecx,%edx
+ 716:	73 30                	jae    748 <lfree+0x48>
+ 718:	39 c1                	cmp    %eax,%ecx
+ 71a:	72 04                	jb     720 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 71c:	39 c2                	cmp    %eax,%edx
+ 71e:	72 f0                	jb     710 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 720:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 723:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 726:	39 f0                	cmp    %esi,%eax
+ 728:	74 26                	je     750 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 72a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 72c:	8b 42 04             	mov    0x4(%edx),%eax
+ 72f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 732:	39 d9                	cmp    %ebx,%ecx
+ 734:	74 30                	je     766 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 736:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 738:	5b                   	pop    %ebx
+  freep = p;
+ 739:	89 15 e4 0e 00 00    	mov    %edx,0xee4
+}
+ 73f:	5e                   	pop    %esi
+ 740:	5d                   	pop    %ebp
+ 741:	c3                   	ret
+ 742:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 748:	39 c1                	cmp    %eax,%ecx
+ 74a:	72 d0                	jb     71c <lfree+0x1c>
+ 74c:	eb c2                	jmp    710 <lfree+0x10>
+ 74e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 750:	03 58 04             	add    0x4(%eax),%ebx
+ 753:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 756:	8b 02                	mov    (%edx),%eax
+ 758:	8b 00                	mov    (%eax),%eax
+ 75a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 75c:	8b 42 04             	mov    0x4(%edx),%eax
+ 75f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 762:	39 d9                	cmp    %ebx,%ecx
+ 764:	75 d0                	jne    736 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 766:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 769:	89 15 e4 0e 00 00    	mov    %edx,0xee4
+    p->s.size += bp->s.size;
+ 76f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 772:	8b 09                	mov    (%ecx),%ecx
+ 774:	89 0a                	mov    %ecx,(%edx)
+}
+ 776:	5b                   	pop    %ebx
+ 777:	5e                   	pop    %esi
+ 778:	5d                   	pop    %ebp
+ 779:	c3                   	ret
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000780 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	89 c7                	mov    %eax,%edi
+ 786:	56                   	push   %esi
+ 787:	53                   	push   %ebx
+ 788:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 78b:	a1 e4 0e 00 00       	mov    0xee4,%eax
+ 790:	85 c0                	test   %eax,%eax
+ 792:	0f 84 88 00 00 00    	je     820 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 798:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 79a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 79d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7a2:	39 df                	cmp    %ebx,%edi
+ 7a4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7a7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 7ae:	39 f9                	cmp    %edi,%ecx
+ 7b0:	72 0f                	jb     7c1 <lalloc+0x41>
+ 7b2:	eb 4c                	jmp    800 <lalloc+0x80>
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7b8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 7ba:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 7bd:	39 f9                	cmp    %edi,%ecx
+ 7bf:	73 3f                	jae    800 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 7c1:	89 d0                	mov    %edx,%eax
+ 7c3:	39 15 e4 0e 00 00    	cmp    %edx,0xee4
+ 7c9:	75 ed                	jne    7b8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 7cb:	83 ec 0c             	sub    $0xc,%esp
+ 7ce:	56                   	push   %esi
+ 7cf:	e8 07 fc ff ff       	call   3db <sbrk>
+  if(p == (char*)-1)
+ 7d4:	83 c4 10             	add    $0x10,%esp
+ 7d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7da:	74 11                	je     7ed <lalloc+0x6d>
+  hp->s.size = nu;
+ 7dc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 7df:	e8 1c ff ff ff       	call   700 <lfree>
+  return freep;
+ 7e4:	a1 e4 0e 00 00       	mov    0xee4,%eax
+      if((p = morecore(nunits)) == 0)
+ 7e9:	85 c0                	test   %eax,%eax
+ 7eb:	75 cb                	jne    7b8 <lalloc+0x38>
+        return 0;
+  }
+}
+ 7ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7f0:	31 d2                	xor    %edx,%edx
+}
+ 7f2:	5b                   	pop    %ebx
+ 7f3:	89 d0                	mov    %edx,%eax
+ 7f5:	5e                   	pop    %esi
+ 7f6:	5f                   	pop    %edi
+ 7f7:	5d                   	pop    %ebp
+ 7f8:	c3                   	ret
+ 7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 800:	39 cf                	cmp    %ecx,%edi
+ 802:	74 4c                	je     850 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 804:	29 f9                	sub    %edi,%ecx
+ 806:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 809:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 80c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 80f:	a3 e4 0e 00 00       	mov    %eax,0xee4
+}
+ 814:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 817:	89 d0                	mov    %edx,%eax
+ 819:	5b                   	pop    %ebx
+ 81a:	5e                   	pop    %esi
+ 81b:	5f                   	pop    %edi
+ 81c:	5d                   	pop    %ebp
+ 81d:	c3                   	ret
+ 81e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 820:	ba e8 0e 00 00       	mov    $0xee8,%edx
+ 825:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 827:	c7 05 e4 0e 00 00 e8 	movl   $0xee8,0xee4
+ 82e:	0e 00 00 
+ 831:	c7 05 e8 0e 00 00 e8 	movl   $0xee8,0xee8
+ 838:	0e 00 00 
+ 83b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 83d:	c7 05 ec 0e 00 00 00 	movl   $0x0,0xeec
+ 844:	00 00 00 
+ 847:	e9 51 ff ff ff       	jmp    79d <lalloc+0x1d>
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 850:	8b 0a                	mov    (%edx),%ecx
+ 852:	89 08                	mov    %ecx,(%eax)
+ 854:	eb b9                	jmp    80f <lalloc+0x8f>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000860 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 869:	85 f6                	test   %esi,%esi
+ 86b:	74 42                	je     8af <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 86d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 870:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 873:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 879:	77 3d                	ja     8b8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 87b:	31 c9                	xor    %ecx,%ecx
+ 87d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 882:	83 fa 02             	cmp    $0x2,%edx
+ 885:	74 17                	je     89e <free+0x3e>
+ 887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88e:	66 90                	xchg   %ax,%ax
+ 890:	83 c1 01             	add    $0x1,%ecx
+ 893:	89 d8                	mov    %ebx,%eax
+ 895:	d3 e0                	shl    %cl,%eax
+ 897:	83 c0 01             	add    $0x1,%eax
+ 89a:	39 c2                	cmp    %eax,%edx
+ 89c:	75 f2                	jne    890 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 89e:	8b 04 8d c0 0e 00 00 	mov    0xec0(,%ecx,4),%eax
+  classes[c] = bp;
+ 8a5:	89 3c 8d c0 0e 00 00 	mov    %edi,0xec0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 8ac:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 8af:	5b                   	pop    %ebx
+ 8b0:	5e                   	pop    %esi
+ 8b1:	5f                   	pop    %edi
+ 8b2:	5d                   	pop    %ebp
+ 8b3:	c3                   	ret
+ 8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8b8:	5b                   	pop    %ebx
+    lfree(bp);
+ 8b9:	89 f8                	mov    %edi,%eax
+}
+ 8bb:	5e                   	pop    %esi
+ 8bc:	5f                   	pop    %edi
+ 8bd:	5d                   	pop    %ebp
+    lfree(bp);
+ 8be:	e9 3d fe ff ff       	jmp    700 <lfree>
+ 8c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008d0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8dc:	83 c0 07             	add    $0x7,%eax
+ 8df:	c1 e8 03             	shr    $0x3,%eax
+ 8e2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 8e5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 8ea:	77 44                	ja     930 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 8ec:	31 c9                	xor    %ecx,%ecx
+ 8ee:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8f3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 8f8:	83 f8 02             	cmp    $0x2,%eax
+ 8fb:	76 11                	jbe    90e <malloc+0x3e>
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 900:	83 c1 01             	add    $0x1,%ecx
+ 903:	89 d3                	mov    %edx,%ebx
+ 905:	d3 e3                	shl    %cl,%ebx
+ 907:	83 c3 01             	add    $0x1,%ebx
+ 90a:	39 c3                	cmp    %eax,%ebx
+ 90c:	72 f2                	jb     900 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 90e:	8b 04 8d c0 0e 00 00 	mov    0xec0(,%ecx,4),%eax
+ 915:	85 c0                	test   %eax,%eax
+ 917:	74 2f                	je     948 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 919:	8b 10                	mov    (%eax),%edx
+ 91b:	89 14 8d c0 0e 00 00 	mov    %edx,0xec0(,%ecx,4)
+  return (void*)(p + 1);
+ 922:	83 c0 08             	add    $0x8,%eax
+}
+ 925:	83 c4 1c             	add    $0x1c,%esp
+ 928:	5b                   	pop    %ebx
+ 929:	5e                   	pop    %esi
+ 92a:	5f                   	pop    %edi
+ 92b:	5d                   	pop    %ebp
+ 92c:	c3                   	ret
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 930:	e8 4b fe ff ff       	call   780 <lalloc>
+ 935:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 937:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 93a:	85 d2                	test   %edx,%edx
+ 93c:	75 e7                	jne    925 <malloc+0x55>
+      return 0;
+ 93e:	31 c0                	xor    %eax,%eax
+ 940:	eb e3                	jmp    925 <malloc+0x55>
+ 942:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 948:	31 d2                	xor    %edx,%edx
+ 94a:	b8 00 02 00 00       	mov    $0x200,%eax
+ 94f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 952:	f7 f3                	div    %ebx
+  if(n < 4)
+ 954:	ba 04 00 00 00       	mov    $0x4,%edx
+ 959:	89 d6                	mov    %edx,%esi
+ 95b:	39 d0                	cmp    %edx,%eax
+ 95d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 960:	0f af f3             	imul   %ebx,%esi
+ 963:	89 f0                	mov    %esi,%eax
+ 965:	e8 16 fe ff ff       	call   780 <lalloc>
+ 96a:	85 c0                	test   %eax,%eax
+ 96c:	74 d0                	je     93e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 96e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 971:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 974:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 97b:	8b 14 8d c0 0e 00 00 	mov    0xec0(,%ecx,4),%edx
+ 982:	39 f8                	cmp    %edi,%eax
+ 984:	73 22                	jae    9a8 <malloc+0xd8>
+ 986:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 989:	eb 09                	jmp    994 <malloc+0xc4>
+ 98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+ 990:	89 c2                	mov    %eax,%edx
+ 992:	89 c8                	mov    %ecx,%eax
+ 994:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ 997:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ 99a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ 99c:	39 f9                	cmp    %edi,%ecx
+ 99e:	72 f0                	jb     990 <malloc+0xc0>
+ 9a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9a3:	e9 73 ff ff ff       	jmp    91b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ 9a8:	89 d0                	mov    %edx,%eax
+ 9aa:	8b 12                	mov    (%edx),%edx
+ 9ac:	e9 6a ff ff ff       	jmp    91b <malloc+0x4b>
+ 9b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+
+000009c0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	56                   	push   %esi
+ 9c4:	53                   	push   %ebx
+ 9c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ 9cb:	85 c9                	test   %ecx,%ecx
+ 9cd:	74 06                	je     9d5 <calloc+0x15>
+ 9cf:	89 c8                	mov    %ecx,%eax
+ 9d1:	f7 e3                	mul    %ebx
+ 9d3:	70 33                	jo     a08 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ 9d5:	0f af d9             	imul   %ecx,%ebx
+ 9d8:	83 ec 0c             	sub    $0xc,%esp
+ 9db:	53                   	push   %ebx
+ 9dc:	e8 ef fe ff ff       	call   8d0 <malloc>
+ 9e1:	83 c4 10             	add    $0x10,%esp
+ 9e4:	89 c6                	mov    %eax,%esi
+ 9e6:	85 c0                	test   %eax,%eax
+ 9e8:	74 1e                	je     a08 <calloc+0x48>
+    memset(p, 0, n * size);
+ 9ea:	83 ec 04             	sub    $0x4,%esp
+ 9ed:	53                   	push   %ebx
+ 9ee:	6a 00                	push   $0x0
+ 9f0:	50                   	push   %eax
+ 9f1:	e8 3a f7 ff ff       	call   130 <memset>
+ 9f6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ 9f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9fc:	89 f0                	mov    %esi,%eax
+ 9fe:	5b                   	pop    %ebx
+ 9ff:	5e                   	pop    %esi
+ a00:	5d                   	pop    %ebp
+ a01:	c3                   	ret
+ a02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a0b:	31 f6                	xor    %esi,%esi
+}
+ a0d:	89 f0                	mov    %esi,%eax
+ a0f:	5b                   	pop    %ebx
+ a10:	5e                   	pop    %esi
+ a11:	5d                   	pop    %ebp
+ a12:	c3                   	ret
+ a13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a20 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	83 ec 0c             	sub    $0xc,%esp
+ a29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ a2f:	85 db                	test   %ebx,%ebx
+ a31:	74 55                	je     a88 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ a33:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ a36:	89 de                	mov    %ebx,%esi
+ a38:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ a3f:	39 c7                	cmp    %eax,%edi
+ a41:	72 0d                	jb     a50 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a46:	89 f0                	mov    %esi,%eax
+ a48:	5b                   	pop    %ebx
+ a49:	5e                   	pop    %esi
+ a4a:	5f                   	pop    %edi
+ a4b:	5d                   	pop    %ebp
+ a4c:	c3                   	ret
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ a50:	83 ec 0c             	sub    $0xc,%esp
+ a53:	50                   	push   %eax
+ a54:	e8 77 fe ff ff       	call   8d0 <malloc>
+ a59:	83 c4 10             	add    $0x10,%esp
+ a5c:	89 c6                	mov    %eax,%esi
+ a5e:	85 c0                	test   %eax,%eax
+ a60:	74 e1                	je     a43 <realloc+0x23>
+  memmove(p, ap, have);
+ a62:	83 ec 04             	sub    $0x4,%esp
+ a65:	57                   	push   %edi
+ a66:	53                   	push   %ebx
+ a67:	50                   	push   %eax
+ a68:	e8 b3 f8 ff ff       	call   320 <memmove>
+  free(ap);
+ a6d:	89 1c 24             	mov    %ebx,(%esp)
+ a70:	e8 eb fd ff ff       	call   860 <free>
+  return p;
+ a75:	83 c4 10             	add    $0x10,%esp
+}
+ a78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a7b:	89 f0                	mov    %esi,%eax
+ a7d:	5b                   	pop    %ebx
+ a7e:	5e                   	pop    %esi
+ a7f:	5f                   	pop    %edi
+ a80:	5d                   	pop    %ebp
+ a81:	c3                   	ret
+ a82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a88:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a8e:	5b                   	pop    %ebx
+ a8f:	5e                   	pop    %esi
+ a90:	5f                   	pop    %edi
+ a91:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ a92:	e9 39 fe ff ff       	jmp    8d0 <malloc>
@@ -7,18 +7,26 @@
 #include "x86.h"
 #include "elf.h"
 #include "stat.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
 
+// Build a new user image for p from the program at path and
+// install it, replacing any image p already has.  p is either
+// the current process (exec) or a new one that has no image yet
+// (spawn).
 int
-exec(char *path, char **argv)
+loadimage(struct proc *p, char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
+  int i, off, nvma;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+  struct vma vma[NVMA], t;
 
   begin_op();
 
@@ -31,6 +39,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  memset(vma, 0, sizeof(vma));
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -44,11 +53,11 @@ exec(char *path, char **argv)
   struct stat st;
   stati(ip, &st);
 
-  if(st.uid == curproc->uid){
+  if(st.uid == p->uid){
     if(st.mode.flags.u_x != 1)
       goto bad;
   }
-  else if(st.gid == curproc->gid){
+  else if(st.gid == p->gid){
     if(st.mode.flags.g_x != 1)
       goto bad;
   }
@@ -56,8 +65,10 @@ exec(char *path, char **argv)
     goto bad;
 #endif
 
-  // Load program into memory.
+  // Map the program's segments.  Nothing is read yet: pgfault()
+  // reads each page from ip the first time it is touched.
   sz = 0;
+  nvma = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -67,12 +78,24 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.off + ph.filesz < ph.off || ph.off + ph.filesz > ip->size)
+      goto bad;
+    if(nvma >= NVMA)
       goto bad;
+    vma[nvma].start = ph.vaddr;
+    vma[nvma].end = PGROUNDUP(ph.vaddr + ph.memsz);
+    vma[nvma].off = ph.off;
+    vma[nvma].filesz = ph.filesz;
+    vma[nvma].perm = (ph.flags & ELF_PROG_FLAG_WRITE) ? PTE_W : 0;
+    vma[nvma].ip = idup(ip);
+    itext(ip, 1);
+    nvma++;
+    if(ph.vaddr + ph.memsz > sz)
+      sz = ph.vaddr + ph.memsz;
   }
   iunlockput(ip);
   end_op();
@@ -109,28 +132,54 @@ exec(char *path, char **argv)
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  safestrcpy(p->name, last, sizeof(p->name));
 
-  // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
+  // Commit to the user image.  Swap the vmas, so vma[] holds the
+  // old ones to free; the kernel stack has no room for a third copy.
+  oldpgdir = p->pgdir;
+  for(i = 0; i < NVMA; i++){
+    t = p->vma[i];
+    p->vma[i] = vma[i];
+    vma[i] = t;
+  }
+  p->pgdir = pgdir;
+  p->sz = sz;
+  p->superpg = 0;
+  p->tf->eip = elf.entry;  // main
+  p->tf->esp = sp;
 #ifdef CS333_P5
   if(st.mode.flags.setuid == 1)
-    curproc->uid = st.uid;
+    p->uid = st.uid;
 #endif
-  switchuvm(curproc);
-  freevm(oldpgdir);
+  if(p == myproc())
+    switchuvm(p);
+  if(oldpgdir){
+    syncvmas(oldpgdir, vma);
+    freevm(oldpgdir);
+    begin_op();
+    freevmas(vma);
+    end_op();
+  }
   return 0;
 
 bad:
   if(pgdir)
     freevm(pgdir);
   if(ip){
-    iunlockput(ip);
+    iunlock(ip);  // each vma holds a reference to ip
+    freevmas(vma);
+    iput(ip);
+    end_op();
+  } else {
+    begin_op();
+    freevmas(vma);
     end_op();
   }
   return -1;
 }
+
+int
+exec(char *path, char **argv)
+{
+  return loadimage(myproc(), path, argv);
+}
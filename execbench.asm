@@ -0,0 +1,1861 @@
+
+_execbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int i, sum;
+
+  if(argc > 1 && strcmp(argv[1], "-main") == 0)
+   f:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1 && strcmp(argv[1], "-main") == 0)
+  15:	7e 31                	jle    48 <main+0x48>
+  17:	50                   	push   %eax
+  18:	50                   	push   %eax
+  19:	68 7f 0c 00 00       	push   $0xc7f
+  1e:	ff 73 04             	push   0x4(%ebx)
+  21:	e8 fa 01 00 00       	call   220 <strcmp>
+  26:	83 c4 10             	add    $0x10,%esp
+  29:	85 c0                	test   %eax,%eax
+  2b:	75 05                	jne    32 <main+0x32>
+    exit();
+  2d:	e8 a1 04 00 00       	call   4d3 <exit>
+  if(argc > 1 && strcmp(argv[1], "-touch") == 0){
+  32:	51                   	push   %ecx
+  33:	51                   	push   %ecx
+  34:	68 85 0c 00 00       	push   $0xc85
+  39:	ff 73 04             	push   0x4(%ebx)
+  3c:	e8 df 01 00 00       	call   220 <strcmp>
+  41:	83 c4 10             	add    $0x10,%esp
+  44:	85 c0                	test   %eax,%eax
+  46:	74 40                	je     88 <main+0x88>
+    if(sum < 0)
+      printf(1, "unreachable\n");
+    exit();
+  }
+
+  printf(1, "execbench: %d KB program\n", PADSIZE/1024);
+  48:	50                   	push   %eax
+  49:	6a 28                	push   $0x28
+  4b:	68 99 0c 00 00       	push   $0xc99
+  50:	6a 01                	push   $0x1
+  52:	e8 79 06 00 00       	call   6d0 <printf>
+  report("exec to main", run("-main"));
+  57:	b8 7f 0c 00 00       	mov    $0xc7f,%eax
+  5c:	e8 0f 01 00 00       	call   170 <run>
+  61:	89 c2                	mov    %eax,%edx
+  63:	b8 b3 0c 00 00       	mov    $0xcb3,%eax
+  68:	e8 63 00 00 00       	call   d0 <report>
+  report("exec and touch all", run("-touch"));
+  6d:	b8 85 0c 00 00       	mov    $0xc85,%eax
+  72:	e8 f9 00 00 00       	call   170 <run>
+  77:	89 c2                	mov    %eax,%edx
+  79:	b8 c0 0c 00 00       	mov    $0xcc0,%eax
+  7e:	e8 4d 00 00 00       	call   d0 <report>
+  exit();
+  83:	e8 4b 04 00 00       	call   4d3 <exit>
+    for(i = 0; i < PADSIZE; i += 4096)
+  88:	31 d2                	xor    %edx,%edx
+  8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      sum += pad[i];
+  90:	0f be 8a 60 11 00 00 	movsbl 0x1160(%edx),%ecx
+    for(i = 0; i < PADSIZE; i += 4096)
+  97:	81 c2 00 10 00 00    	add    $0x1000,%edx
+      sum += pad[i];
+  9d:	01 c8                	add    %ecx,%eax
+    for(i = 0; i < PADSIZE; i += 4096)
+  9f:	81 fa 00 a0 00 00    	cmp    $0xa000,%edx
+  a5:	75 e9                	jne    90 <main+0x90>
+    if(sum < 0)
+  a7:	85 c0                	test   %eax,%eax
+  a9:	79 82                	jns    2d <main+0x2d>
+      printf(1, "unreachable\n");
+  ab:	52                   	push   %edx
+  ac:	52                   	push   %edx
+  ad:	68 8c 0c 00 00       	push   $0xc8c
+  b2:	6a 01                	push   $0x1
+  b4:	e8 17 06 00 00       	call   6d0 <printf>
+  b9:	83 c4 10             	add    $0x10,%esp
+  bc:	e9 6c ff ff ff       	jmp    2d <main+0x2d>
+  c1:	66 90                	xchg   %ax,%ax
+  c3:	66 90                	xchg   %ax,%ax
+  c5:	66 90                	xchg   %ax,%ax
+  c7:	66 90                	xchg   %ax,%ax
+  c9:	66 90                	xchg   %ax,%ax
+  cb:	66 90                	xchg   %ax,%ax
+  cd:	66 90                	xchg   %ax,%ax
+  cf:	90                   	nop
+
+000000d0 <report>:
+{
+  d0:	55                   	push   %ebp
+  int us = t * 1000 / N;   // ticks are milliseconds
+  d1:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+  d4:	c1 e1 02             	shl    $0x2,%ecx
+{
+  d7:	89 e5                	mov    %esp,%ebp
+  d9:	57                   	push   %edi
+  da:	89 d7                	mov    %edx,%edi
+  dc:	56                   	push   %esi
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+  dd:	be 67 66 66 66       	mov    $0x66666667,%esi
+{
+  e2:	53                   	push   %ebx
+  e3:	83 ec 28             	sub    $0x28,%esp
+  e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+  e9:	89 c8                	mov    %ecx,%eax
+  eb:	f7 ee                	imul   %esi
+  printf(1, "%s: %d runs in %d ms, %d.%d%d%d ms per exec\n", what, N, t,
+  ed:	6a 00                	push   $0x0
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+  ef:	89 d3                	mov    %edx,%ebx
+  f1:	89 ca                	mov    %ecx,%edx
+  f3:	c1 fa 1f             	sar    $0x1f,%edx
+  f6:	c1 fb 02             	sar    $0x2,%ebx
+  f9:	29 d3                	sub    %edx,%ebx
+  fb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  printf(1, "%s: %d runs in %d ms, %d.%d%d%d ms per exec\n", what, N, t,
+  fe:	89 d8                	mov    %ebx,%eax
+ 100:	f7 ee                	imul   %esi
+ 102:	89 d8                	mov    %ebx,%eax
+ 104:	c1 f8 1f             	sar    $0x1f,%eax
+ 107:	c1 fa 02             	sar    $0x2,%edx
+ 10a:	29 c2                	sub    %eax,%edx
+ 10c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 10f:	01 c0                	add    %eax,%eax
+ 111:	29 c3                	sub    %eax,%ebx
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+ 113:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ 118:	f7 e9                	imul   %ecx
+  printf(1, "%s: %d runs in %d ms, %d.%d%d%d ms per exec\n", what, N, t,
+ 11a:	53                   	push   %ebx
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+ 11b:	89 d3                	mov    %edx,%ebx
+ 11d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 120:	c1 fb 05             	sar    $0x5,%ebx
+ 123:	29 d3                	sub    %edx,%ebx
+  printf(1, "%s: %d runs in %d ms, %d.%d%d%d ms per exec\n", what, N, t,
+ 125:	89 d8                	mov    %ebx,%eax
+ 127:	f7 ee                	imul   %esi
+ 129:	89 d8                	mov    %ebx,%eax
+ 12b:	c1 f8 1f             	sar    $0x1f,%eax
+ 12e:	89 d6                	mov    %edx,%esi
+ 130:	c1 fe 02             	sar    $0x2,%esi
+ 133:	29 c6                	sub    %eax,%esi
+ 135:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+ 138:	01 c0                	add    %eax,%eax
+ 13a:	29 c3                	sub    %eax,%ebx
+ 13c:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 141:	f7 e9                	imul   %ecx
+ 143:	53                   	push   %ebx
+ 144:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 147:	c1 fa 06             	sar    $0x6,%edx
+ 14a:	29 ca                	sub    %ecx,%edx
+ 14c:	52                   	push   %edx
+ 14d:	57                   	push   %edi
+ 14e:	6a 32                	push   $0x32
+ 150:	ff 75 e0             	push   -0x20(%ebp)
+ 153:	68 18 0c 00 00       	push   $0xc18
+ 158:	6a 01                	push   $0x1
+ 15a:	e8 71 05 00 00       	call   6d0 <printf>
+}
+ 15f:	83 c4 30             	add    $0x30,%esp
+ 162:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 165:	5b                   	pop    %ebx
+ 166:	5e                   	pop    %esi
+ 167:	5f                   	pop    %edi
+ 168:	5d                   	pop    %ebp
+ 169:	c3                   	ret
+ 16a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000170 <run>:
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	56                   	push   %esi
+ 174:	53                   	push   %ebx
+  start = uptime();
+ 175:	bb 32 00 00 00       	mov    $0x32,%ebx
+{
+ 17a:	83 ec 10             	sub    $0x10,%esp
+  args[0] = "execbench";
+ 17d:	c7 45 ec 45 0c 00 00 	movl   $0xc45,-0x14(%ebp)
+  args[1] = mode;
+ 184:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  args[2] = 0;
+ 187:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  start = uptime();
+ 18e:	e8 d8 03 00 00       	call   56b <uptime>
+ 193:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < N; i++){
+ 195:	8d 76 00             	lea    0x0(%esi),%esi
+    pid = fork();
+ 198:	e8 2e 03 00 00       	call   4cb <fork>
+    if(pid < 0){
+ 19d:	85 c0                	test   %eax,%eax
+ 19f:	78 1a                	js     1bb <run+0x4b>
+    if(pid == 0){
+ 1a1:	74 2b                	je     1ce <run+0x5e>
+    wait();
+ 1a3:	e8 33 03 00 00       	call   4db <wait>
+  for(i = 0; i < N; i++){
+ 1a8:	83 eb 01             	sub    $0x1,%ebx
+ 1ab:	75 eb                	jne    198 <run+0x28>
+  return uptime() - start;
+ 1ad:	e8 b9 03 00 00       	call   56b <uptime>
+}
+ 1b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return uptime() - start;
+ 1b5:	29 f0                	sub    %esi,%eax
+}
+ 1b7:	5b                   	pop    %ebx
+ 1b8:	5e                   	pop    %esi
+ 1b9:	5d                   	pop    %ebp
+ 1ba:	c3                   	ret
+      printf(2, "execbench: fork failed\n");
+ 1bb:	53                   	push   %ebx
+ 1bc:	53                   	push   %ebx
+ 1bd:	68 4f 0c 00 00       	push   $0xc4f
+ 1c2:	6a 02                	push   $0x2
+ 1c4:	e8 07 05 00 00       	call   6d0 <printf>
+      exit();
+ 1c9:	e8 05 03 00 00       	call   4d3 <exit>
+      exec(args[0], args);
+ 1ce:	50                   	push   %eax
+ 1cf:	50                   	push   %eax
+ 1d0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+ 1d3:	50                   	push   %eax
+ 1d4:	ff 75 ec             	push   -0x14(%ebp)
+ 1d7:	e8 2f 03 00 00       	call   50b <exec>
+      printf(2, "execbench: exec failed\n");
+ 1dc:	5a                   	pop    %edx
+ 1dd:	59                   	pop    %ecx
+ 1de:	68 67 0c 00 00       	push   $0xc67
+ 1e3:	6a 02                	push   $0x2
+ 1e5:	e8 e6 04 00 00       	call   6d0 <printf>
+      exit();
+ 1ea:	e8 e4 02 00 00       	call   4d3 <exit>
+ 1ef:	90                   	nop
+
+000001f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 207:	83 c0 01             	add    $0x1,%eax
+ 20a:	84 d2                	test   %dl,%dl
+ 20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+ 20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 211:	89 c8                	mov    %ecx,%eax
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+ 215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 be 01 00 00       	call   4eb <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 91 01 00 00       	call   513 <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 94 01 00 00       	call   52b <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 5a 01 00 00       	call   4fb <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	56                   	push   %esi
+ 3c4:	53                   	push   %ebx
+ 3c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 3c8:	0f b6 02             	movzbl (%edx),%eax
+ 3cb:	3c 20                	cmp    $0x20,%al
+ 3cd:	75 0c                	jne    3db <atoi+0x1b>
+ 3cf:	90                   	nop
+ 3d0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 3d4:	83 c2 01             	add    $0x1,%edx
+ 3d7:	3c 20                	cmp    $0x20,%al
+ 3d9:	74 f5                	je     3d0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 3db:	3c 2d                	cmp    $0x2d,%al
+ 3dd:	74 41                	je     420 <atoi+0x60>
+ 3df:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 3e4:	3c 2b                	cmp    $0x2b,%al
+ 3e6:	74 3d                	je     425 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 3e8:	0f be 0a             	movsbl (%edx),%ecx
+ 3eb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 3ee:	3c 09                	cmp    $0x9,%al
+ 3f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3f5:	77 21                	ja     418 <atoi+0x58>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 400:	83 c2 01             	add    $0x1,%edx
+ 403:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 406:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 40a:	0f be 0a             	movsbl (%edx),%ecx
+ 40d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 410:	80 fb 09             	cmp    $0x9,%bl
+ 413:	76 eb                	jbe    400 <atoi+0x40>
+  return sign*n;
+ 415:	0f af c6             	imul   %esi,%eax
+}
+ 418:	5b                   	pop    %ebx
+ 419:	5e                   	pop    %esi
+ 41a:	5d                   	pop    %ebp
+ 41b:	c3                   	ret
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 425:	83 c2 01             	add    $0x1,%edx
+ 428:	eb be                	jmp    3e8 <atoi+0x28>
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	56                   	push   %esi
+ 434:	53                   	push   %ebx
+ 435:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 438:	0f b6 02             	movzbl (%edx),%eax
+ 43b:	3c 20                	cmp    $0x20,%al
+ 43d:	75 0c                	jne    44b <atoo+0x1b>
+ 43f:	90                   	nop
+ 440:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 444:	83 c2 01             	add    $0x1,%edx
+ 447:	3c 20                	cmp    $0x20,%al
+ 449:	74 f5                	je     440 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 44b:	3c 2d                	cmp    $0x2d,%al
+ 44d:	74 41                	je     490 <atoo+0x60>
+ 44f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 454:	3c 2b                	cmp    $0x2b,%al
+ 456:	74 3d                	je     495 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 458:	0f be 0a             	movsbl (%edx),%ecx
+ 45b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 45e:	3c 07                	cmp    $0x7,%al
+ 460:	b8 00 00 00 00       	mov    $0x0,%eax
+ 465:	77 1e                	ja     485 <atoo+0x55>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 477:	0f be 0a             	movsbl (%edx),%ecx
+ 47a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 47d:	80 fb 07             	cmp    $0x7,%bl
+ 480:	76 ee                	jbe    470 <atoo+0x40>
+  return sign*n;
+ 482:	0f af c6             	imul   %esi,%eax
+}
+ 485:	5b                   	pop    %ebx
+ 486:	5e                   	pop    %esi
+ 487:	5d                   	pop    %ebp
+ 488:	c3                   	ret
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 490:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 495:	83 c2 01             	add    $0x1,%edx
+ 498:	eb be                	jmp    458 <atoo+0x28>
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004a0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ae:	85 c0                	test   %eax,%eax
+ 4b0:	7e 13                	jle    4c5 <memmove+0x25>
+ 4b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4b4:	89 d7                	mov    %edx,%edi
+ 4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4c1:	39 f8                	cmp    %edi,%eax
+ 4c3:	75 fb                	jne    4c0 <memmove+0x20>
+  return vdst;
+}
+ 4c5:	5e                   	pop    %esi
+ 4c6:	89 d0                	mov    %edx,%eax
+ 4c8:	5f                   	pop    %edi
+ 4c9:	5d                   	pop    %ebp
+ 4ca:	c3                   	ret
+
+000004cb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <exit>:
+SYSCALL(exit)
+ 4d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <wait>:
+SYSCALL(wait)
+ 4db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <pipe>:
+SYSCALL(pipe)
+ 4e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <read>:
+SYSCALL(read)
+ 4eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <write>:
+SYSCALL(write)
+ 4f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <close>:
+SYSCALL(close)
+ 4fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <kill>:
+SYSCALL(kill)
+ 503:	b8 06 00 00 00       	mov    $0x6,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <exec>:
+SYSCALL(exec)
+ 50b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <open>:
+SYSCALL(open)
+ 513:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mknod>:
+SYSCALL(mknod)
+ 51b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <unlink>:
+SYSCALL(unlink)
+ 523:	b8 12 00 00 00       	mov    $0x12,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <fstat>:
+SYSCALL(fstat)
+ 52b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <link>:
+SYSCALL(link)
+ 533:	b8 13 00 00 00       	mov    $0x13,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <mkdir>:
+SYSCALL(mkdir)
+ 53b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <chdir>:
+SYSCALL(chdir)
+ 543:	b8 09 00 00 00       	mov    $0x9,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <dup>:
+SYSCALL(dup)
+ 54b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <getpid>:
+SYSCALL(getpid)
+ 553:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <sbrk>:
+SYSCALL(sbrk)
+ 55b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <sleep>:
+SYSCALL(sleep)
+ 563:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <uptime>:
+SYSCALL(uptime)
+ 56b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <superpages>:
+SYSCALL(superpages)
+ 573:	b8 23 00 00 00       	mov    $0x23,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mmap>:
+SYSCALL(mmap)
+ 57b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <munmap>:
+SYSCALL(munmap)
+ 583:	b8 25 00 00 00       	mov    $0x25,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <spawn>:
+SYSCALL(spawn)
+ 58b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <swapstat>:
+SYSCALL(swapstat)
+ 593:	b8 27 00 00 00       	mov    $0x27,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 59b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <iostat>:
+SYSCALL(iostat)
+ 5a3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <dropcache>:
+SYSCALL(dropcache)
+ 5ab:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <iosched>:
+SYSCALL(iosched)
+ 5b3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <halt>:
+SYSCALL(halt)
+ 5bb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <date>:
+SYSCALL(date)
+ 5c3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 5cb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <getgid>:
+SYSCALL(getgid)
+ 5d3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <getppid>:
+SYSCALL(getppid)
+ 5db:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <setuid>:
+SYSCALL(setuid)
+ 5e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <setgid>:
+SYSCALL(setgid)
+ 5eb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getprocs>:
+SYSCALL(getprocs)
+ 5f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 5fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <getpriority>:
+SYSCALL(getpriority)
+ 603:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 60b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <chown>:
+SYSCALL(chown)
+ 613:	b8 21 00 00 00       	mov    $0x21,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <chgrp>:
+SYSCALL(chgrp)
+ 61b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+ 623:	66 90                	xchg   %ax,%ax
+ 625:	66 90                	xchg   %ax,%ax
+ 627:	66 90                	xchg   %ax,%ax
+ 629:	66 90                	xchg   %ax,%ax
+ 62b:	66 90                	xchg   %ax,%ax
+ 62d:	66 90                	xchg   %ax,%ax
+ 62f:	90                   	nop
+
+00000630 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 638:	89 d1                	mov    %edx,%ecx
+{
+ 63a:	83 ec 3c             	sub    $0x3c,%esp
+ 63d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 640:	85 d2                	test   %edx,%edx
+ 642:	0f 89 80 00 00 00    	jns    6c8 <printint+0x98>
+ 648:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 64c:	74 7a                	je     6c8 <printint+0x98>
+    x = -xx;
+ 64e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 650:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 655:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 658:	31 f6                	xor    %esi,%esi
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 660:	89 c8                	mov    %ecx,%eax
+ 662:	31 d2                	xor    %edx,%edx
+ 664:	89 f7                	mov    %esi,%edi
+ 666:	f7 f3                	div    %ebx
+ 668:	8d 76 01             	lea    0x1(%esi),%esi
+ 66b:	0f b6 92 34 0d 00 00 	movzbl 0xd34(%edx),%edx
+ 672:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 676:	89 ca                	mov    %ecx,%edx
+ 678:	89 c1                	mov    %eax,%ecx
+ 67a:	39 da                	cmp    %ebx,%edx
+ 67c:	73 e2                	jae    660 <printint+0x30>
+  if(neg)
+ 67e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 681:	85 c0                	test   %eax,%eax
+ 683:	74 07                	je     68c <printint+0x5c>
+    buf[i++] = '-';
+ 685:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 68a:	89 f7                	mov    %esi,%edi
+ 68c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 68f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 692:	01 df                	add    %ebx,%edi
+ 694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 698:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 69b:	83 ec 04             	sub    $0x4,%esp
+ 69e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6a4:	6a 01                	push   $0x1
+ 6a6:	50                   	push   %eax
+ 6a7:	56                   	push   %esi
+ 6a8:	e8 46 fe ff ff       	call   4f3 <write>
+  while(--i >= 0)
+ 6ad:	89 f8                	mov    %edi,%eax
+ 6af:	83 c4 10             	add    $0x10,%esp
+ 6b2:	83 ef 01             	sub    $0x1,%edi
+ 6b5:	39 d8                	cmp    %ebx,%eax
+ 6b7:	75 df                	jne    698 <printint+0x68>
+}
+ 6b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6bc:	5b                   	pop    %ebx
+ 6bd:	5e                   	pop    %esi
+ 6be:	5f                   	pop    %edi
+ 6bf:	5d                   	pop    %ebp
+ 6c0:	c3                   	ret
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6c8:	31 c0                	xor    %eax,%eax
+ 6ca:	eb 89                	jmp    655 <printint+0x25>
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6df:	0f b6 1e             	movzbl (%esi),%ebx
+ 6e2:	83 c6 01             	add    $0x1,%esi
+ 6e5:	84 db                	test   %bl,%bl
+ 6e7:	74 67                	je     750 <printf+0x80>
+ 6e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6ec:	31 d2                	xor    %edx,%edx
+ 6ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6f1:	eb 34                	jmp    727 <printf+0x57>
+ 6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6f7:	90                   	nop
+ 6f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 700:	83 f8 25             	cmp    $0x25,%eax
+ 703:	74 18                	je     71d <printf+0x4d>
+  write(fd, &c, 1);
+ 705:	83 ec 04             	sub    $0x4,%esp
+ 708:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 70b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70e:	6a 01                	push   $0x1
+ 710:	50                   	push   %eax
+ 711:	57                   	push   %edi
+ 712:	e8 dc fd ff ff       	call   4f3 <write>
+ 717:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 71a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 71d:	0f b6 1e             	movzbl (%esi),%ebx
+ 720:	83 c6 01             	add    $0x1,%esi
+ 723:	84 db                	test   %bl,%bl
+ 725:	74 29                	je     750 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 727:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 72a:	85 d2                	test   %edx,%edx
+ 72c:	74 ca                	je     6f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 72e:	83 fa 25             	cmp    $0x25,%edx
+ 731:	75 ea                	jne    71d <printf+0x4d>
+      if(c == 'd'){
+ 733:	83 f8 25             	cmp    $0x25,%eax
+ 736:	0f 84 24 01 00 00    	je     860 <printf+0x190>
+ 73c:	83 e8 63             	sub    $0x63,%eax
+ 73f:	83 f8 15             	cmp    $0x15,%eax
+ 742:	77 1c                	ja     760 <printf+0x90>
+ 744:	ff 24 85 dc 0c 00 00 	jmp    *0xcdc(,%eax,4)
+ 74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 753:	5b                   	pop    %ebx
+ 754:	5e                   	pop    %esi
+ 755:	5f                   	pop    %edi
+ 756:	5d                   	pop    %ebp
+ 757:	c3                   	ret
+ 758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 766:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 76a:	6a 01                	push   $0x1
+ 76c:	52                   	push   %edx
+ 76d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 770:	57                   	push   %edi
+ 771:	e8 7d fd ff ff       	call   4f3 <write>
+ 776:	83 c4 0c             	add    $0xc,%esp
+ 779:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 77c:	6a 01                	push   $0x1
+ 77e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 781:	52                   	push   %edx
+ 782:	57                   	push   %edi
+ 783:	e8 6b fd ff ff       	call   4f3 <write>
+        putc(fd, c);
+ 788:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78b:	31 d2                	xor    %edx,%edx
+ 78d:	eb 8e                	jmp    71d <printf+0x4d>
+ 78f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 790:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 79b:	8b 13                	mov    (%ebx),%edx
+ 79d:	6a 00                	push   $0x0
+ 79f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7a4:	e8 87 fe ff ff       	call   630 <printint>
+        ap++;
+ 7a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 67 ff ff ff       	jmp    71d <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7c5:	83 c0 04             	add    $0x4,%eax
+ 7c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7cb:	85 db                	test   %ebx,%ebx
+ 7cd:	0f 84 9d 00 00 00    	je     870 <printf+0x1a0>
+        while(*s != 0){
+ 7d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7d8:	84 c0                	test   %al,%al
+ 7da:	0f 84 3d ff ff ff    	je     71d <printf+0x4d>
+ 7e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7e6:	89 de                	mov    %ebx,%esi
+ 7e8:	89 d3                	mov    %edx,%ebx
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	53                   	push   %ebx
+ 7fc:	57                   	push   %edi
+ 7fd:	e8 f1 fc ff ff       	call   4f3 <write>
+        while(*s != 0){
+ 802:	0f b6 06             	movzbl (%esi),%eax
+ 805:	83 c4 10             	add    $0x10,%esp
+ 808:	84 c0                	test   %al,%al
+ 80a:	75 e4                	jne    7f0 <printf+0x120>
+      state = 0;
+ 80c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 80f:	31 d2                	xor    %edx,%edx
+ 811:	e9 07 ff ff ff       	jmp    71d <printf+0x4d>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 82b:	8b 13                	mov    (%ebx),%edx
+ 82d:	6a 01                	push   $0x1
+ 82f:	e9 6b ff ff ff       	jmp    79f <printf+0xcf>
+ 834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 838:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 83b:	83 ec 04             	sub    $0x4,%esp
+ 83e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 841:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 843:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 846:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 849:	6a 01                	push   $0x1
+ 84b:	52                   	push   %edx
+ 84c:	57                   	push   %edi
+ 84d:	e8 a1 fc ff ff       	call   4f3 <write>
+        ap++;
+ 852:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 855:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 858:	31 d2                	xor    %edx,%edx
+ 85a:	e9 be fe ff ff       	jmp    71d <printf+0x4d>
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 866:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 869:	6a 01                	push   $0x1
+ 86b:	e9 11 ff ff ff       	jmp    781 <printf+0xb1>
+ 870:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 875:	bb d3 0c 00 00       	mov    $0xcd3,%ebx
+ 87a:	e9 61 ff ff ff       	jmp    7e0 <printf+0x110>
+ 87f:	90                   	nop
+
+00000880 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 883:	a1 84 b1 00 00       	mov    0xb184,%eax
+{
+ 888:	89 e5                	mov    %esp,%ebp
+ 88a:	56                   	push   %esi
+ 88b:	53                   	push   %ebx
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 890:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 892:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 894:	39 ca                	cmp    %ecx,%edx
+ 896:	73 30                	jae    8c8 <lfree+0x48>
+ 898:	39 c1                	cmp    %eax,%ecx
+ 89a:	72 04                	jb     8a0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 89c:	39 c2                	cmp    %eax,%edx
+ 89e:	72 f0                	jb     890 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8a0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 8a3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 8a6:	39 f0                	cmp    %esi,%eax
+ 8a8:	74 26                	je     8d0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8aa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8ac:	8b 42 04             	mov    0x4(%edx),%eax
+ 8af:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 8b2:	39 d9                	cmp    %ebx,%ecx
+ 8b4:	74 30                	je     8e6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8b6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8b8:	5b                   	pop    %ebx
+  freep = p;
+ 8b9:	89 15 84 b1 00 00    	mov    %edx,0xb184
+}
+ 8bf:	5e                   	pop    %esi
+ 8c0:	5d                   	pop    %ebp
+ 8c1:	c3                   	ret
+ 8c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c8:	39 c1                	cmp    %eax,%ecx
+ 8ca:	72 d0                	jb     89c <lfree+0x1c>
+ 8cc:	eb c2                	jmp    890 <lfree+0x10>
+ 8ce:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 8d0:	03 58 04             	add    0x4(%eax),%ebx
+ 8d3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d6:	8b 02                	mov    (%edx),%eax
+ 8d8:	8b 00                	mov    (%eax),%eax
+ 8da:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 8dc:	8b 42 04             	mov    0x4(%edx),%eax
+ 8df:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 8e2:	39 d9                	cmp    %ebx,%ecx
+ 8e4:	75 d0                	jne    8b6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 8e6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 8e9:	89 15 84 b1 00 00    	mov    %edx,0xb184
+    p->s.size += bp->s.size;
+ 8ef:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8f2:	8b 09                	mov    (%ecx),%ecx
+ 8f4:	89 0a                	mov    %ecx,(%edx)
+}
+ 8f6:	5b                   	pop    %ebx
+ 8f7:	5e                   	pop    %esi
+ 8f8:	5d                   	pop    %ebp
+ 8f9:	c3                   	ret
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000900 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	89 c7                	mov    %eax,%edi
+ 906:	56                   	push   %esi
+ 907:	53                   	push   %ebx
+ 908:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 90b:	a1 84 b1 00 00       	mov    0xb184,%eax
+ 910:	85 c0                	test   %eax,%eax
+ 912:	0f 84 88 00 00 00    	je     9a0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 918:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 91a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 91d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 922:	39 df                	cmp    %ebx,%edi
+ 924:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 927:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 92e:	39 f9                	cmp    %edi,%ecx
+ 930:	72 0f                	jb     941 <lalloc+0x41>
+ 932:	eb 4c                	jmp    980 <lalloc+0x80>
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 938:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 93a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 93d:	39 f9                	cmp    %edi,%ecx
+ 93f:	73 3f                	jae    980 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 941:	89 d0                	mov    %edx,%eax
+ 943:	39 15 84 b1 00 00    	cmp    %edx,0xb184
+ 949:	75 ed                	jne    938 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 94b:	83 ec 0c             	sub    $0xc,%esp
+ 94e:	56                   	push   %esi
+ 94f:	e8 07 fc ff ff       	call   55b <sbrk>
+  if(p == (char*)-1)
+ 954:	83 c4 10             	add    $0x10,%esp
+ 957:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 95a:	74 11                	je     96d <lalloc+0x6d>
+  hp->s.size = nu;
+ 95c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 95f:	e8 1c ff ff ff       	call   880 <lfree>
+  return freep;
+ 964:	a1 84 b1 00 00       	mov    0xb184,%eax
+      if((p = morecore(nunits)) == 0)
+ 969:	85 c0                	test   %eax,%eax
+ 96b:	75 cb                	jne    938 <lalloc+0x38>
+        return 0;
+  }
+}
+ 96d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 970:	31 d2                	xor    %edx,%edx
+}
+ 972:	5b                   	pop    %ebx
+ 973:	89 d0                	mov    %edx,%eax
+ 975:	5e                   	pop    %esi
+ 976:	5f                   	pop    %edi
+ 977:	5d                   	pop    %ebp
+ 978:	c3                   	ret
+ 979:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 980:	39 cf                	cmp    %ecx,%edi
+ 982:	74 4c                	je     9d0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 984:	29 f9                	sub    %edi,%ecx
+ 986:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 989:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 98c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 98f:	a3 84 b1 00 00       	mov    %eax,0xb184
+}
+ 994:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 997:	89 d0                	mov    %edx,%eax
+ 999:	5b                   	pop    %ebx
+ 99a:	5e                   	pop    %esi
+ 99b:	5f                   	pop    %edi
+ 99c:	5d                   	pop    %ebp
+ 99d:	c3                   	ret
+ 99e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 9a0:	ba 88 b1 00 00       	mov    $0xb188,%edx
+ 9a5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 9a7:	c7 05 84 b1 00 00 88 	movl   $0xb188,0xb184
+ 9ae:	b1 00 00 
+ 9b1:	c7 05 88 b1 00 00 88 	movl   $0xb188,0xb188
+ 9b8:	b1 00 00 
+ 9bb:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 9bd:	c7 05 8c b1 00 00 00 	movl   $0x0,0xb18c
+ 9c4:	00 00 00 
+ 9c7:	e9 51 ff ff ff       	jmp    91d <lalloc+0x1d>
+ 9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 9d0:	8b 0a                	mov    (%edx),%ecx
+ 9d2:	89 08                	mov    %ecx,(%eax)
+ 9d4:	eb b9                	jmp    98f <lalloc+0x8f>
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 9e9:	85 f6                	test   %esi,%esi
+ 9eb:	74 42                	je     a2f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 9ed:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 9f0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 9f3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 9f9:	77 3d                	ja     a38 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 9fb:	31 c9                	xor    %ecx,%ecx
+ 9fd:	bb 01 00 00 00       	mov    $0x1,%ebx
+ a02:	83 fa 02             	cmp    $0x2,%edx
+ a05:	74 17                	je     a1e <free+0x3e>
+ a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0e:	66 90                	xchg   %ax,%ax
+ a10:	83 c1 01             	add    $0x1,%ecx
+ a13:	89 d8                	mov    %ebx,%eax
+ a15:	d3 e0                	shl    %cl,%eax
+ a17:	83 c0 01             	add    $0x1,%eax
+ a1a:	39 c2                	cmp    %eax,%edx
+ a1c:	75 f2                	jne    a10 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ a1e:	8b 04 8d 60 b1 00 00 	mov    0xb160(,%ecx,4),%eax
+  classes[c] = bp;
+ a25:	89 3c 8d 60 b1 00 00 	mov    %edi,0xb160(,%ecx,4)
+  bp->s.ptr = classes[c];
+ a2c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ a2f:	5b                   	pop    %ebx
+ a30:	5e                   	pop    %esi
+ a31:	5f                   	pop    %edi
+ a32:	5d                   	pop    %ebp
+ a33:	c3                   	ret
+ a34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a38:	5b                   	pop    %ebx
+    lfree(bp);
+ a39:	89 f8                	mov    %edi,%eax
+}
+ a3b:	5e                   	pop    %esi
+ a3c:	5f                   	pop    %edi
+ a3d:	5d                   	pop    %ebp
+    lfree(bp);
+ a3e:	e9 3d fe ff ff       	jmp    880 <lfree>
+ a43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a50 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a59:	8b 45 08             	mov    0x8(%ebp),%eax
+ a5c:	83 c0 07             	add    $0x7,%eax
+ a5f:	c1 e8 03             	shr    $0x3,%eax
+ a62:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ a65:	3d 01 01 00 00       	cmp    $0x101,%eax
+ a6a:	77 44                	ja     ab0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ a6c:	31 c9                	xor    %ecx,%ecx
+ a6e:	ba 01 00 00 00       	mov    $0x1,%edx
+ a73:	bb 02 00 00 00       	mov    $0x2,%ebx
+ a78:	83 f8 02             	cmp    $0x2,%eax
+ a7b:	76 11                	jbe    a8e <malloc+0x3e>
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+ a80:	83 c1 01             	add    $0x1,%ecx
+ a83:	89 d3                	mov    %edx,%ebx
+ a85:	d3 e3                	shl    %cl,%ebx
+ a87:	83 c3 01             	add    $0x1,%ebx
+ a8a:	39 c3                	cmp    %eax,%ebx
+ a8c:	72 f2                	jb     a80 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ a8e:	8b 04 8d 60 b1 00 00 	mov    0xb160(,%ecx,4),%eax
+ a95:	85 c0                	test   %eax,%eax
+ a97:	74 2f                	je     ac8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ a99:	8b 10                	mov    (%eax),%edx
+ a9b:	89 14 8d 60 b1 00 00 	mov    %edx,0xb160(,%ecx,4)
+  return (void*)(p + 1);
+ aa2:	83 c0 08             	add    $0x8,%eax
+}
+ aa5:	83 c4 1c             	add    $0x1c,%esp
+ aa8:	5b                   	pop    %ebx
+ aa9:	5e                   	pop    %esi
+ aaa:	5f                   	pop    %edi
+ aab:	5d                   	pop    %ebp
+ aac:	c3                   	ret
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ ab0:	e8 4b fe ff ff       	call   900 <lalloc>
+ ab5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ ab7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ aba:	85 d2                	test   %edx,%edx
+ abc:	75 e7                	jne    aa5 <malloc+0x55>
+      return 0;
+ abe:	31 c0                	xor    %eax,%eax
+ ac0:	eb e3                	jmp    aa5 <malloc+0x55>
+ ac2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ ac8:	31 d2                	xor    %edx,%edx
+ aca:	b8 00 02 00 00       	mov    $0x200,%eax
+ acf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ ad2:	f7 f3                	div    %ebx
+  if(n < 4)
+ ad4:	ba 04 00 00 00       	mov    $0x4,%edx
+ ad9:	89 d6                	mov    %edx,%esi
+ adb:	39 d0                	cmp    %edx,%eax
+ add:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ ae0:	0f af f3             	imul   %ebx,%esi
+ ae3:	89 f0                	mov    %esi,%eax
+ ae5:	e8 16 fe ff ff       	call   900 <lalloc>
+ aea:	85 c0                	test   %eax,%eax
+ aec:	74 d0                	je     abe <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ aee:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ af1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ af4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ afb:	8b 14 8d 60 b1 00 00 	mov    0xb160(,%ecx,4),%edx
+ b02:	39 f8                	cmp    %edi,%eax
+ b04:	73 22                	jae    b28 <malloc+0xd8>
+ b06:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b09:	eb 09                	jmp    b14 <malloc+0xc4>
+ b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+ b10:	89 c2                	mov    %eax,%edx
+ b12:	89 c8                	mov    %ecx,%eax
+ b14:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ b17:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ b1a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ b1c:	39 f9                	cmp    %edi,%ecx
+ b1e:	72 f0                	jb     b10 <malloc+0xc0>
+ b20:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b23:	e9 73 ff ff ff       	jmp    a9b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ b28:	89 d0                	mov    %edx,%eax
+ b2a:	8b 12                	mov    (%edx),%edx
+ b2c:	e9 6a ff ff ff       	jmp    a9b <malloc+0x4b>
+ b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+
+00000b40 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	56                   	push   %esi
+ b44:	53                   	push   %ebx
+ b45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ b48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ b4b:	85 c9                	test   %ecx,%ecx
+ b4d:	74 06                	je     b55 <calloc+0x15>
+ b4f:	89 c8                	mov    %ecx,%eax
+ b51:	f7 e3                	mul    %ebx
+ b53:	70 33                	jo     b88 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ b55:	0f af d9             	imul   %ecx,%ebx
+ b58:	83 ec 0c             	sub    $0xc,%esp
+ b5b:	53                   	push   %ebx
+ b5c:	e8 ef fe ff ff       	call   a50 <malloc>
+ b61:	83 c4 10             	add    $0x10,%esp
+ b64:	89 c6                	mov    %eax,%esi
+ b66:	85 c0                	test   %eax,%eax
+ b68:	74 1e                	je     b88 <calloc+0x48>
+    memset(p, 0, n * size);
+ b6a:	83 ec 04             	sub    $0x4,%esp
+ b6d:	53                   	push   %ebx
+ b6e:	6a 00                	push   $0x0
+ b70:	50                   	push   %eax
+ b71:	e8 3a f7 ff ff       	call   2b0 <memset>
+ b76:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ b79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b7c:	89 f0                	mov    %esi,%eax
+ b7e:	5b                   	pop    %ebx
+ b7f:	5e                   	pop    %esi
+ b80:	5d                   	pop    %ebp
+ b81:	c3                   	ret
+ b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ b8b:	31 f6                	xor    %esi,%esi
+}
+ b8d:	89 f0                	mov    %esi,%eax
+ b8f:	5b                   	pop    %ebx
+ b90:	5e                   	pop    %esi
+ b91:	5d                   	pop    %ebp
+ b92:	c3                   	ret
+ b93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ba0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+ ba6:	83 ec 0c             	sub    $0xc,%esp
+ ba9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ bac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ baf:	85 db                	test   %ebx,%ebx
+ bb1:	74 55                	je     c08 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ bb3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ bb6:	89 de                	mov    %ebx,%esi
+ bb8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ bbf:	39 c7                	cmp    %eax,%edi
+ bc1:	72 0d                	jb     bd0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ bc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bc6:	89 f0                	mov    %esi,%eax
+ bc8:	5b                   	pop    %ebx
+ bc9:	5e                   	pop    %esi
+ bca:	5f                   	pop    %edi
+ bcb:	5d                   	pop    %ebp
+ bcc:	c3                   	ret
+ bcd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ bd0:	83 ec 0c             	sub    $0xc,%esp
+ bd3:	50                   	push   %eax
+ bd4:	e8 77 fe ff ff       	call   a50 <malloc>
+ bd9:	83 c4 10             	add    $0x10,%esp
+ bdc:	89 c6                	mov    %eax,%esi
+ bde:	85 c0                	test   %eax,%eax
+ be0:	74 e1                	je     bc3 <realloc+0x23>
+  memmove(p, ap, have);
+ be2:	83 ec 04             	sub    $0x4,%esp
+ be5:	57                   	push   %edi
+ be6:	53                   	push   %ebx
+ be7:	50                   	push   %eax
+ be8:	e8 b3 f8 ff ff       	call   4a0 <memmove>
+  free(ap);
+ bed:	89 1c 24             	mov    %ebx,(%esp)
+ bf0:	e8 eb fd ff ff       	call   9e0 <free>
+  return p;
+ bf5:	83 c4 10             	add    $0x10,%esp
+}
+ bf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bfb:	89 f0                	mov    %esi,%eax
+ bfd:	5b                   	pop    %ebx
+ bfe:	5e                   	pop    %esi
+ bff:	5f                   	pop    %edi
+ c00:	5d                   	pop    %ebp
+ c01:	c3                   	ret
+ c02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ c08:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ c0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c0e:	5b                   	pop    %ebx
+ c0f:	5e                   	pop    %esi
+ c10:	5f                   	pop    %edi
+ c11:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ c12:	e9 39 fe ff ff       	jmp    a50 <malloc>
@@ -0,0 +1,70 @@
+// Measure exec-to-main latency for a large program.
+// The binary carries a big initialized table in its data segment.
+// With demand-paged exec a child that exits straight from main()
+// reads only the pages it touches; a child that walks the table
+// pays for all of it, which is what every exec used to cost.
+
+#include "types.h"
+#include "user.h"
+
+#define N 50
+#define PADSIZE (40*1024)
+
+char pad[PADSIZE] = { 1 };
+
+static int
+run(char *mode)
+{
+  char *args[3];
+  int i, pid, start;
+
+  args[0] = "execbench";
+  args[1] = mode;
+  args[2] = 0;
+  start = uptime();
+  for(i = 0; i < N; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(2, "execbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(args[0], args);
+      printf(2, "execbench: exec failed\n");
+      exit();
+    }
+    wait();
+  }
+  return uptime() - start;
+}
+
+static void
+report(char *what, int t)
+{
+  int us = t * 1000 / N;   // ticks are milliseconds
+
+  printf(1, "%s: %d runs in %d ms, %d.%d%d%d ms per exec\n", what, N, t,
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, sum;
+
+  if(argc > 1 && strcmp(argv[1], "-main") == 0)
+    exit();
+  if(argc > 1 && strcmp(argv[1], "-touch") == 0){
+    sum = 0;
+    for(i = 0; i < PADSIZE; i += 4096)
+      sum += pad[i];
+    if(sum < 0)
+      printf(1, "unreachable\n");
+    exit();
+  }
+
+  printf(1, "execbench: %d KB program\n", PADSIZE/1024);
+  report("exec to main", run("-main"));
+  report("exec and touch all", run("-touch"));
+  exit();
+}
@@ -13,13 +13,17 @@
 struct devsw devsw[NDEV];
 struct {
   struct spinlock lock;
-  struct file file[NFILE];
+  struct file *file;    // nfile entries
 } ftable;
 
+static int nfile;
+
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  nfile = kscale(NFILE);
+  ftable.file = ktable(nfile, sizeof(struct file));
 }
 
 // Allocate a file structure.
@@ -29,7 +33,7 @@ filealloc(void)
   struct file *f;
 
   acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
+  for(f = ftable.file; f < ftable.file + nfile; f++){
     if(f->ref == 0){
       f->ref = 1;
       release(&ftable.lock);
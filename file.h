@@ -14,8 +14,13 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  int ntext;          // Program images mapping it (see itext)
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
+  uint ranext;        // block after the last one read
+  uint raend;         // block after the last one read ahead
+  uint rawin;         // read-ahead window, in blocks
+  int textpg;         // textcache or shmcache may hold its pages
 
   short type;         // copy of disk inode
   short major;
@@ -0,0 +1,1962 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  free(tab);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 64             	sub    $0x64,%esp
+  tab = malloc(NPS * sizeof(struct uproc));
+  14:	68 40 1d 00 00       	push   $0x1d40
+  19:	e8 12 0b 00 00       	call   b30 <malloc>
+  if(tab == 0 || pipe(fd) < 0 || getmeminfo(&mi) < 0){
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 84 06 01 00 00    	je     12f <main+0x12f>
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	89 c3                	mov    %eax,%ebx
+  2e:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  31:	50                   	push   %eax
+  32:	e8 8c 05 00 00       	call   5c3 <pipe>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	0f 88 ed 00 00 00    	js     12f <main+0x12f>
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  48:	50                   	push   %eax
+  49:	e8 2d 06 00 00       	call   67b <getmeminfo>
+  4e:	83 c4 10             	add    $0x10,%esp
+  51:	85 c0                	test   %eax,%eax
+  53:	0f 88 d6 00 00 00    	js     12f <main+0x12f>
+  59:	be 08 00 00 00       	mov    $0x8,%esi
+  5e:	66 90                	xchg   %ax,%ax
+    if(fork() == 0){
+  60:	e8 46 05 00 00       	call   5ab <fork>
+  65:	85 c0                	test   %eax,%eax
+  67:	0f 84 41 01 00 00    	je     1ae <main+0x1ae>
+  for(i = 0; i < NHOLD; i++){
+  6d:	83 ee 01             	sub    $0x1,%esi
+  70:	75 ee                	jne    60 <main+0x60>
+  n = getprocs(NPS, tab);
+  72:	50                   	push   %eax
+  close(fd[1]);
+  73:	bf 08 00 00 00       	mov    $0x8,%edi
+  n = getprocs(NPS, tab);
+  78:	50                   	push   %eax
+  79:	53                   	push   %ebx
+  7a:	6a 48                	push   $0x48
+  7c:	e8 52 06 00 00       	call   6d3 <getprocs>
+  81:	89 c6                	mov    %eax,%esi
+  close(fd[0]);
+  83:	58                   	pop    %eax
+  84:	ff 75 b8             	push   -0x48(%ebp)
+  87:	e8 4f 05 00 00       	call   5db <close>
+  close(fd[1]);
+  8c:	58                   	pop    %eax
+  8d:	ff 75 bc             	push   -0x44(%ebp)
+  90:	e8 46 05 00 00       	call   5db <close>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9f:	90                   	nop
+    wait();
+  a0:	e8 16 05 00 00       	call   5bb <wait>
+  for(i = 0; i < NHOLD; i++)
+  a5:	83 ef 01             	sub    $0x1,%edi
+  a8:	75 f6                	jne    a0 <main+0xa0>
+  pid = getpid();
+  aa:	e8 84 05 00 00       	call   633 <getpid>
+  af:	89 c1                	mov    %eax,%ecx
+  for(i = 0; i < n; i++){
+  b1:	85 f6                	test   %esi,%esi
+  b3:	0f 8e ec 00 00 00    	jle    1a5 <main+0x1a5>
+  b9:	6b f6 68             	imul   $0x68,%esi,%esi
+  nchild = child = self = 0;
+  bc:	31 c0                	xor    %eax,%eax
+  be:	89 da                	mov    %ebx,%edx
+  c0:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  c3:	31 c0                	xor    %eax,%eax
+  c5:	8d 3c 1e             	lea    (%esi,%ebx,1),%edi
+  c8:	31 f6                	xor    %esi,%esi
+  ca:	eb 17                	jmp    e3 <main+0xe3>
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    else if(tab[i].ppid == pid){
+  d0:	39 4a 0c             	cmp    %ecx,0xc(%edx)
+  d3:	75 07                	jne    dc <main+0xdc>
+      nchild++;
+  d5:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      child += tab[i].ptpages;
+  d9:	03 42 44             	add    0x44(%edx),%eax
+  for(i = 0; i < n; i++){
+  dc:	83 c2 68             	add    $0x68,%edx
+  df:	39 d7                	cmp    %edx,%edi
+  e1:	74 0e                	je     f1 <main+0xf1>
+    if(tab[i].pid == pid)
+  e3:	39 0a                	cmp    %ecx,(%edx)
+  e5:	75 e9                	jne    d0 <main+0xd0>
+      self = tab[i].ptpages;
+  e7:	8b 72 44             	mov    0x44(%edx),%esi
+  for(i = 0; i < n; i++){
+  ea:	83 c2 68             	add    $0x68,%edx
+  ed:	39 d7                	cmp    %edx,%edi
+  ef:	75 f2                	jne    e3 <main+0xe3>
+  if(nchild > 0)
+  f1:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+  f4:	85 c9                	test   %ecx,%ecx
+  f6:	74 03                	je     fb <main+0xfb>
+    child /= nchild;
+  f8:	99                   	cltd
+  f9:	f7 f9                	idiv   %ecx
+  kpt = (mi.physpages + 1023) / 1024 + DEVPT;
+  fb:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  printf(1, "page-table pages: parent %d, child %d; %d and %d if each copied the kernel's %d\n",
+  fe:	51                   	push   %ecx
+  kpt = (mi.physpages + 1023) / 1024 + DEVPT;
+  ff:	8d 97 ff 03 00 00    	lea    0x3ff(%edi),%edx
+ 105:	c1 ea 0a             	shr    $0xa,%edx
+ 108:	83 c2 08             	add    $0x8,%edx
+  printf(1, "page-table pages: parent %d, child %d; %d and %d if each copied the kernel's %d\n",
+ 10b:	52                   	push   %edx
+ 10c:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+ 10f:	01 f2                	add    %esi,%edx
+ 111:	51                   	push   %ecx
+ 112:	52                   	push   %edx
+ 113:	50                   	push   %eax
+ 114:	56                   	push   %esi
+ 115:	68 50 0d 00 00       	push   $0xd50
+ 11a:	6a 01                	push   $0x1
+ 11c:	e8 8f 06 00 00       	call   7b0 <printf>
+  free(tab);
+ 121:	83 c4 14             	add    $0x14,%esp
+ 124:	53                   	push   %ebx
+ 125:	e8 96 09 00 00       	call   ac0 <free>
+ 12a:	83 c4 10             	add    $0x10,%esp
+ 12d:	eb 11                	jmp    140 <main+0x140>
+    printf(2, "forkbench: cannot count page tables\n");
+ 12f:	50                   	push   %eax
+ 130:	50                   	push   %eax
+ 131:	68 28 0d 00 00       	push   $0xd28
+ 136:	6a 02                	push   $0x2
+ 138:	e8 73 06 00 00       	call   7b0 <printf>
+ 13d:	83 c4 10             	add    $0x10,%esp
+  char *p;
+  int i;
+
+  ptpages();
+  report("small parent", run());
+ 140:	e8 2b 01 00 00       	call   270 <run>
+ 145:	89 c2                	mov    %eax,%edx
+ 147:	b8 b9 0d 00 00       	mov    $0xdb9,%eax
+ 14c:	e8 7f 00 00 00       	call   1d0 <report>
+
+  // Grow the parent by 1 MB of touched memory.
+  p = sbrk(1024*1024);
+ 151:	83 ec 0c             	sub    $0xc,%esp
+ 154:	68 00 00 10 00       	push   $0x100000
+ 159:	e8 dd 04 00 00       	call   63b <sbrk>
+  if(p == (char*)-1){
+ 15e:	83 c4 10             	add    $0x10,%esp
+ 161:	8d 90 00 00 10 00    	lea    0x100000(%eax),%edx
+ 167:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 16a:	74 26                	je     192 <main+0x192>
+ 16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(2, "forkbench: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < 1024*1024; i += 4096)
+    p[i] = 1;
+ 170:	c6 00 01             	movb   $0x1,(%eax)
+  for(i = 0; i < 1024*1024; i += 4096)
+ 173:	05 00 10 00 00       	add    $0x1000,%eax
+ 178:	39 d0                	cmp    %edx,%eax
+ 17a:	75 f4                	jne    170 <main+0x170>
+  report("1 MB parent", run());
+ 17c:	e8 ef 00 00 00       	call   270 <run>
+ 181:	89 c2                	mov    %eax,%edx
+ 183:	b8 de 0d 00 00       	mov    $0xdde,%eax
+ 188:	e8 43 00 00 00       	call   1d0 <report>
+  exit();
+ 18d:	e8 21 04 00 00       	call   5b3 <exit>
+    printf(2, "forkbench: sbrk failed\n");
+ 192:	50                   	push   %eax
+ 193:	50                   	push   %eax
+ 194:	68 c6 0d 00 00       	push   $0xdc6
+ 199:	6a 02                	push   $0x2
+ 19b:	e8 10 06 00 00       	call   7b0 <printf>
+    exit();
+ 1a0:	e8 0e 04 00 00       	call   5b3 <exit>
+  nchild = child = self = 0;
+ 1a5:	31 f6                	xor    %esi,%esi
+ 1a7:	31 c0                	xor    %eax,%eax
+ 1a9:	e9 4d ff ff ff       	jmp    fb <main+0xfb>
+      close(fd[1]);
+ 1ae:	83 ec 0c             	sub    $0xc,%esp
+ 1b1:	ff 75 bc             	push   -0x44(%ebp)
+ 1b4:	e8 22 04 00 00       	call   5db <close>
+      read(fd[0], &c, 1);
+ 1b9:	83 c4 0c             	add    $0xc,%esp
+ 1bc:	8d 45 b7             	lea    -0x49(%ebp),%eax
+ 1bf:	6a 01                	push   $0x1
+ 1c1:	50                   	push   %eax
+ 1c2:	ff 75 b8             	push   -0x48(%ebp)
+ 1c5:	e8 01 04 00 00       	call   5cb <read>
+      exit();
+ 1ca:	e8 e4 03 00 00       	call   5b3 <exit>
+ 1cf:	90                   	nop
+
+000001d0 <report>:
+{
+ 1d0:	55                   	push   %ebp
+  int us = t * 1000 / N;   // ticks are milliseconds
+ 1d1:	8d 0c 12             	lea    (%edx,%edx,1),%ecx
+{
+ 1d4:	89 e5                	mov    %esp,%ebp
+ 1d6:	57                   	push   %edi
+  printf(1, "%s: %d forks in %d ms, %d.%d%d%d ms per fork\n", what, N, t,
+ 1d7:	89 cf                	mov    %ecx,%edi
+{
+ 1d9:	56                   	push   %esi
+  printf(1, "%s: %d forks in %d ms, %d.%d%d%d ms per fork\n", what, N, t,
+ 1da:	be 67 66 66 66       	mov    $0x66666667,%esi
+ 1df:	c1 ff 1f             	sar    $0x1f,%edi
+{
+ 1e2:	53                   	push   %ebx
+ 1e3:	83 ec 28             	sub    $0x28,%esp
+ 1e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  printf(1, "%s: %d forks in %d ms, %d.%d%d%d ms per fork\n", what, N, t,
+ 1e9:	89 c8                	mov    %ecx,%eax
+  int us = t * 1000 / N;   // ticks are milliseconds
+ 1eb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  printf(1, "%s: %d forks in %d ms, %d.%d%d%d ms per fork\n", what, N, t,
+ 1ee:	f7 ee                	imul   %esi
+ 1f0:	89 d3                	mov    %edx,%ebx
+ 1f2:	89 ca                	mov    %ecx,%edx
+ 1f4:	c1 fb 02             	sar    $0x2,%ebx
+ 1f7:	29 fb                	sub    %edi,%ebx
+ 1f9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 1fc:	01 c0                	add    %eax,%eax
+ 1fe:	29 c2                	sub    %eax,%edx
+ 200:	89 d8                	mov    %ebx,%eax
+ 202:	52                   	push   %edx
+ 203:	f7 ee                	imul   %esi
+ 205:	89 d8                	mov    %ebx,%eax
+ 207:	c1 f8 1f             	sar    $0x1f,%eax
+ 20a:	c1 fa 02             	sar    $0x2,%edx
+ 20d:	29 c2                	sub    %eax,%edx
+ 20f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 212:	01 c0                	add    %eax,%eax
+ 214:	29 c3                	sub    %eax,%ebx
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+ 216:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ 21b:	f7 e9                	imul   %ecx
+  printf(1, "%s: %d forks in %d ms, %d.%d%d%d ms per fork\n", what, N, t,
+ 21d:	53                   	push   %ebx
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+ 21e:	89 d3                	mov    %edx,%ebx
+ 220:	c1 fb 05             	sar    $0x5,%ebx
+ 223:	29 fb                	sub    %edi,%ebx
+  printf(1, "%s: %d forks in %d ms, %d.%d%d%d ms per fork\n", what, N, t,
+ 225:	89 d8                	mov    %ebx,%eax
+ 227:	f7 ee                	imul   %esi
+ 229:	89 d8                	mov    %ebx,%eax
+ 22b:	c1 f8 1f             	sar    $0x1f,%eax
+ 22e:	89 d6                	mov    %edx,%esi
+ 230:	c1 fe 02             	sar    $0x2,%esi
+ 233:	29 c6                	sub    %eax,%esi
+ 235:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+ 238:	01 c0                	add    %eax,%eax
+ 23a:	29 c3                	sub    %eax,%ebx
+ 23c:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 241:	f7 e9                	imul   %ecx
+ 243:	53                   	push   %ebx
+ 244:	c1 fa 06             	sar    $0x6,%edx
+ 247:	29 fa                	sub    %edi,%edx
+ 249:	52                   	push   %edx
+ 24a:	ff 75 e4             	push   -0x1c(%ebp)
+ 24d:	68 f4 01 00 00       	push   $0x1f4
+ 252:	ff 75 e0             	push   -0x20(%ebp)
+ 255:	68 f8 0c 00 00       	push   $0xcf8
+ 25a:	6a 01                	push   $0x1
+ 25c:	e8 4f 05 00 00       	call   7b0 <printf>
+}
+ 261:	83 c4 30             	add    $0x30,%esp
+ 264:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 267:	5b                   	pop    %ebx
+ 268:	5e                   	pop    %esi
+ 269:	5f                   	pop    %edi
+ 26a:	5d                   	pop    %ebp
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <run>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+  start = uptime();
+ 275:	bb f4 01 00 00       	mov    $0x1f4,%ebx
+ 27a:	e8 cc 03 00 00       	call   64b <uptime>
+ 27f:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < N; i++){
+ 281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    pid = fork();
+ 288:	e8 1e 03 00 00       	call   5ab <fork>
+    if(pid < 0){
+ 28d:	85 c0                	test   %eax,%eax
+ 28f:	78 1a                	js     2ab <run+0x3b>
+    if(pid == 0)
+ 291:	74 2b                	je     2be <run+0x4e>
+    wait();
+ 293:	e8 23 03 00 00       	call   5bb <wait>
+  for(i = 0; i < N; i++){
+ 298:	83 eb 01             	sub    $0x1,%ebx
+ 29b:	75 eb                	jne    288 <run+0x18>
+  return uptime() - start;
+ 29d:	e8 a9 03 00 00       	call   64b <uptime>
+}
+ 2a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return uptime() - start;
+ 2a5:	29 f0                	sub    %esi,%eax
+}
+ 2a7:	5b                   	pop    %ebx
+ 2a8:	5e                   	pop    %esi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+      printf(2, "forkbench: fork failed\n");
+ 2ab:	50                   	push   %eax
+ 2ac:	50                   	push   %eax
+ 2ad:	68 a1 0d 00 00       	push   $0xda1
+ 2b2:	6a 02                	push   $0x2
+ 2b4:	e8 f7 04 00 00       	call   7b0 <printf>
+      exit();
+ 2b9:	e8 f5 02 00 00       	call   5b3 <exit>
+      exit();
+ 2be:	e8 f0 02 00 00       	call   5b3 <exit>
+ 2c3:	66 90                	xchg   %ax,%ax
+ 2c5:	66 90                	xchg   %ax,%ax
+ 2c7:	66 90                	xchg   %ax,%ax
+ 2c9:	66 90                	xchg   %ax,%ax
+ 2cb:	66 90                	xchg   %ax,%ax
+ 2cd:	66 90                	xchg   %ax,%ax
+ 2cf:	90                   	nop
+
+000002d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2d1:	31 c0                	xor    %eax,%eax
+{
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	53                   	push   %ebx
+ 2d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2e7:	83 c0 01             	add    $0x1,%eax
+ 2ea:	84 d2                	test   %dl,%dl
+ 2ec:	75 f2                	jne    2e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f1:	89 c8                	mov    %ecx,%eax
+ 2f3:	c9                   	leave
+ 2f4:	c3                   	ret
+ 2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+ 307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 30a:	0f b6 02             	movzbl (%edx),%eax
+ 30d:	84 c0                	test   %al,%al
+ 30f:	75 17                	jne    328 <strcmp+0x28>
+ 311:	eb 3a                	jmp    34d <strcmp+0x4d>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 31c:	83 c2 01             	add    $0x1,%edx
+ 31f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 322:	84 c0                	test   %al,%al
+ 324:	74 1a                	je     340 <strcmp+0x40>
+    p++, q++;
+ 326:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 328:	0f b6 19             	movzbl (%ecx),%ebx
+ 32b:	38 c3                	cmp    %al,%bl
+ 32d:	74 e9                	je     318 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 32f:	29 d8                	sub    %ebx,%eax
+}
+ 331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 334:	c9                   	leave
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 340:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 344:	31 c0                	xor    %eax,%eax
+ 346:	29 d8                	sub    %ebx,%eax
+}
+ 348:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 34b:	c9                   	leave
+ 34c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 34d:	0f b6 19             	movzbl (%ecx),%ebx
+ 350:	31 c0                	xor    %eax,%eax
+ 352:	eb db                	jmp    32f <strcmp+0x2f>
+ 354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 366:	80 3a 00             	cmpb   $0x0,(%edx)
+ 369:	74 15                	je     380 <strlen+0x20>
+ 36b:	31 c0                	xor    %eax,%eax
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+ 370:	83 c0 01             	add    $0x1,%eax
+ 373:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 377:	89 c1                	mov    %eax,%ecx
+ 379:	75 f5                	jne    370 <strlen+0x10>
+    ;
+  return n;
+}
+ 37b:	89 c8                	mov    %ecx,%eax
+ 37d:	5d                   	pop    %ebp
+ 37e:	c3                   	ret
+ 37f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 380:	31 c9                	xor    %ecx,%ecx
+}
+ 382:	5d                   	pop    %ebp
+ 383:	89 c8                	mov    %ecx,%eax
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 397:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 39a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 39d:	89 d7                	mov    %edx,%edi
+ 39f:	fc                   	cld
+ 3a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3a5:	89 d0                	mov    %edx,%eax
+ 3a7:	c9                   	leave
+ 3a8:	c3                   	ret
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ba:	0f b6 10             	movzbl (%eax),%edx
+ 3bd:	84 d2                	test   %dl,%dl
+ 3bf:	75 12                	jne    3d3 <strchr+0x23>
+ 3c1:	eb 1d                	jmp    3e0 <strchr+0x30>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+ 3c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3cc:	83 c0 01             	add    $0x1,%eax
+ 3cf:	84 d2                	test   %dl,%dl
+ 3d1:	74 0d                	je     3e0 <strchr+0x30>
+    if(*s == c)
+ 3d3:	38 d1                	cmp    %dl,%cl
+ 3d5:	75 f1                	jne    3c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3d7:	5d                   	pop    %ebp
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3e0:	31 c0                	xor    %eax,%eax
+}
+ 3e2:	5d                   	pop    %ebp
+ 3e3:	c3                   	ret
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3f9:	31 db                	xor    %ebx,%ebx
+{
+ 3fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3fe:	eb 27                	jmp    427 <gets+0x37>
+    cc = read(0, &c, 1);
+ 400:	83 ec 04             	sub    $0x4,%esp
+ 403:	6a 01                	push   $0x1
+ 405:	56                   	push   %esi
+ 406:	6a 00                	push   $0x0
+ 408:	e8 be 01 00 00       	call   5cb <read>
+    if(cc < 1)
+ 40d:	83 c4 10             	add    $0x10,%esp
+ 410:	85 c0                	test   %eax,%eax
+ 412:	7e 1d                	jle    431 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 414:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 41f:	3c 0a                	cmp    $0xa,%al
+ 421:	74 10                	je     433 <gets+0x43>
+ 423:	3c 0d                	cmp    $0xd,%al
+ 425:	74 0c                	je     433 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 427:	89 df                	mov    %ebx,%edi
+ 429:	83 c3 01             	add    $0x1,%ebx
+ 42c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 42f:	7c cf                	jl     400 <gets+0x10>
+ 431:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 43a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43d:	5b                   	pop    %ebx
+ 43e:	5e                   	pop    %esi
+ 43f:	5f                   	pop    %edi
+ 440:	5d                   	pop    %ebp
+ 441:	c3                   	ret
+ 442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	56                   	push   %esi
+ 454:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 455:	83 ec 08             	sub    $0x8,%esp
+ 458:	6a 00                	push   $0x0
+ 45a:	ff 75 08             	push   0x8(%ebp)
+ 45d:	e8 91 01 00 00       	call   5f3 <open>
+  if(fd < 0)
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	85 c0                	test   %eax,%eax
+ 467:	78 27                	js     490 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 469:	83 ec 08             	sub    $0x8,%esp
+ 46c:	ff 75 0c             	push   0xc(%ebp)
+ 46f:	89 c3                	mov    %eax,%ebx
+ 471:	50                   	push   %eax
+ 472:	e8 94 01 00 00       	call   60b <fstat>
+  close(fd);
+ 477:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 47a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 47c:	e8 5a 01 00 00       	call   5db <close>
+  return r;
+ 481:	83 c4 10             	add    $0x10,%esp
+}
+ 484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 487:	89 f0                	mov    %esi,%eax
+ 489:	5b                   	pop    %ebx
+ 48a:	5e                   	pop    %esi
+ 48b:	5d                   	pop    %ebp
+ 48c:	c3                   	ret
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 490:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 495:	eb ed                	jmp    484 <stat+0x34>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	56                   	push   %esi
+ 4a4:	53                   	push   %ebx
+ 4a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4a8:	0f b6 02             	movzbl (%edx),%eax
+ 4ab:	3c 20                	cmp    $0x20,%al
+ 4ad:	75 0c                	jne    4bb <atoi+0x1b>
+ 4af:	90                   	nop
+ 4b0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 4b4:	83 c2 01             	add    $0x1,%edx
+ 4b7:	3c 20                	cmp    $0x20,%al
+ 4b9:	74 f5                	je     4b0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4bb:	3c 2d                	cmp    $0x2d,%al
+ 4bd:	74 41                	je     500 <atoi+0x60>
+ 4bf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4c4:	3c 2b                	cmp    $0x2b,%al
+ 4c6:	74 3d                	je     505 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 4c8:	0f be 0a             	movsbl (%edx),%ecx
+ 4cb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4ce:	3c 09                	cmp    $0x9,%al
+ 4d0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4d5:	77 21                	ja     4f8 <atoi+0x58>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4e0:	83 c2 01             	add    $0x1,%edx
+ 4e3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 4e6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 4ea:	0f be 0a             	movsbl (%edx),%ecx
+ 4ed:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4f0:	80 fb 09             	cmp    $0x9,%bl
+ 4f3:	76 eb                	jbe    4e0 <atoi+0x40>
+  return sign*n;
+ 4f5:	0f af c6             	imul   %esi,%eax
+}
+ 4f8:	5b                   	pop    %ebx
+ 4f9:	5e                   	pop    %esi
+ 4fa:	5d                   	pop    %ebp
+ 4fb:	c3                   	ret
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 505:	83 c2 01             	add    $0x1,%edx
+ 508:	eb be                	jmp    4c8 <atoi+0x28>
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000510 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	56                   	push   %esi
+ 514:	53                   	push   %ebx
+ 515:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 518:	0f b6 02             	movzbl (%edx),%eax
+ 51b:	3c 20                	cmp    $0x20,%al
+ 51d:	75 0c                	jne    52b <atoo+0x1b>
+ 51f:	90                   	nop
+ 520:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 524:	83 c2 01             	add    $0x1,%edx
+ 527:	3c 20                	cmp    $0x20,%al
+ 529:	74 f5                	je     520 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 52b:	3c 2d                	cmp    $0x2d,%al
+ 52d:	74 41                	je     570 <atoo+0x60>
+ 52f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 534:	3c 2b                	cmp    $0x2b,%al
+ 536:	74 3d                	je     575 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 538:	0f be 0a             	movsbl (%edx),%ecx
+ 53b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 53e:	3c 07                	cmp    $0x7,%al
+ 540:	b8 00 00 00 00       	mov    $0x0,%eax
+ 545:	77 1e                	ja     565 <atoo+0x55>
+ 547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 550:	83 c2 01             	add    $0x1,%edx
+ 553:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 557:	0f be 0a             	movsbl (%edx),%ecx
+ 55a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 55d:	80 fb 07             	cmp    $0x7,%bl
+ 560:	76 ee                	jbe    550 <atoo+0x40>
+  return sign*n;
+ 562:	0f af c6             	imul   %esi,%eax
+}
+ 565:	5b                   	pop    %ebx
+ 566:	5e                   	pop    %esi
+ 567:	5d                   	pop    %ebp
+ 568:	c3                   	ret
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 570:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 575:	83 c2 01             	add    $0x1,%edx
+ 578:	eb be                	jmp    538 <atoo+0x28>
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000580 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	8b 45 10             	mov    0x10(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 58e:	85 c0                	test   %eax,%eax
+ 590:	7e 13                	jle    5a5 <memmove+0x25>
+ 592:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 594:	89 d7                	mov    %edx,%edi
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5a1:	39 f8                	cmp    %edi,%eax
+ 5a3:	75 fb                	jne    5a0 <memmove+0x20>
+  return vdst;
+}
+ 5a5:	5e                   	pop    %esi
+ 5a6:	89 d0                	mov    %edx,%eax
+ 5a8:	5f                   	pop    %edi
+ 5a9:	5d                   	pop    %ebp
+ 5aa:	c3                   	ret
+
+000005ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <exit>:
+SYSCALL(exit)
+ 5b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <wait>:
+SYSCALL(wait)
+ 5bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <pipe>:
+SYSCALL(pipe)
+ 5c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <read>:
+SYSCALL(read)
+ 5cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <write>:
+SYSCALL(write)
+ 5d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <close>:
+SYSCALL(close)
+ 5db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <kill>:
+SYSCALL(kill)
+ 5e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <exec>:
+SYSCALL(exec)
+ 5eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <open>:
+SYSCALL(open)
+ 5f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mknod>:
+SYSCALL(mknod)
+ 5fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <unlink>:
+SYSCALL(unlink)
+ 603:	b8 12 00 00 00       	mov    $0x12,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <fstat>:
+SYSCALL(fstat)
+ 60b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <link>:
+SYSCALL(link)
+ 613:	b8 13 00 00 00       	mov    $0x13,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mkdir>:
+SYSCALL(mkdir)
+ 61b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <chdir>:
+SYSCALL(chdir)
+ 623:	b8 09 00 00 00       	mov    $0x9,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <dup>:
+SYSCALL(dup)
+ 62b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getpid>:
+SYSCALL(getpid)
+ 633:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <sbrk>:
+SYSCALL(sbrk)
+ 63b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <sleep>:
+SYSCALL(sleep)
+ 643:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <uptime>:
+SYSCALL(uptime)
+ 64b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <superpages>:
+SYSCALL(superpages)
+ 653:	b8 23 00 00 00       	mov    $0x23,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <mmap>:
+SYSCALL(mmap)
+ 65b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <munmap>:
+SYSCALL(munmap)
+ 663:	b8 25 00 00 00       	mov    $0x25,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <spawn>:
+SYSCALL(spawn)
+ 66b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <swapstat>:
+SYSCALL(swapstat)
+ 673:	b8 27 00 00 00       	mov    $0x27,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 67b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <iostat>:
+SYSCALL(iostat)
+ 683:	b8 29 00 00 00       	mov    $0x29,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <dropcache>:
+SYSCALL(dropcache)
+ 68b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <iosched>:
+SYSCALL(iosched)
+ 693:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <halt>:
+SYSCALL(halt)
+ 69b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <date>:
+SYSCALL(date)
+ 6a3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 6ab:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <getgid>:
+SYSCALL(getgid)
+ 6b3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <getppid>:
+SYSCALL(getppid)
+ 6bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <setuid>:
+SYSCALL(setuid)
+ 6c3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <setgid>:
+SYSCALL(setgid)
+ 6cb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <getprocs>:
+SYSCALL(getprocs)
+ 6d3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 6db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <getpriority>:
+SYSCALL(getpriority)
+ 6e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 6eb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <chown>:
+SYSCALL(chown)
+ 6f3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <chgrp>:
+SYSCALL(chgrp)
+ 6fb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+ 703:	66 90                	xchg   %ax,%ax
+ 705:	66 90                	xchg   %ax,%ax
+ 707:	66 90                	xchg   %ax,%ax
+ 709:	66 90                	xchg   %ax,%ax
+ 70b:	66 90                	xchg   %ax,%ax
+ 70d:	66 90                	xchg   %ax,%ax
+ 70f:	90                   	nop
+
+00000710 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 718:	89 d1                	mov    %edx,%ecx
+{
+ 71a:	83 ec 3c             	sub    $0x3c,%esp
+ 71d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 720:	85 d2                	test   %edx,%edx
+ 722:	0f 89 80 00 00 00    	jns    7a8 <printint+0x98>
+ 728:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 72c:	74 7a                	je     7a8 <printint+0x98>
+    x = -xx;
+ 72e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 730:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 735:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 738:	31 f6                	xor    %esi,%esi
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 740:	89 c8                	mov    %ecx,%eax
+ 742:	31 d2                	xor    %edx,%edx
+ 744:	89 f7                	mov    %esi,%edi
+ 746:	f7 f3                	div    %ebx
+ 748:	8d 76 01             	lea    0x1(%esi),%esi
+ 74b:	0f b6 92 4c 0e 00 00 	movzbl 0xe4c(%edx),%edx
+ 752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 756:	89 ca                	mov    %ecx,%edx
+ 758:	89 c1                	mov    %eax,%ecx
+ 75a:	39 da                	cmp    %ebx,%edx
+ 75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+ 75e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 761:	85 c0                	test   %eax,%eax
+ 763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+ 765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 76a:	89 f7                	mov    %esi,%edi
+ 76c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 76f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 772:	01 df                	add    %ebx,%edi
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 778:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 781:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 784:	6a 01                	push   $0x1
+ 786:	50                   	push   %eax
+ 787:	56                   	push   %esi
+ 788:	e8 46 fe ff ff       	call   5d3 <write>
+  while(--i >= 0)
+ 78d:	89 f8                	mov    %edi,%eax
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	83 ef 01             	sub    $0x1,%edi
+ 795:	39 d8                	cmp    %ebx,%eax
+ 797:	75 df                	jne    778 <printint+0x68>
+}
+ 799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 79c:	5b                   	pop    %ebx
+ 79d:	5e                   	pop    %esi
+ 79e:	5f                   	pop    %edi
+ 79f:	5d                   	pop    %ebp
+ 7a0:	c3                   	ret
+ 7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7a8:	31 c0                	xor    %eax,%eax
+ 7aa:	eb 89                	jmp    735 <printint+0x25>
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c2:	83 c6 01             	add    $0x1,%esi
+ 7c5:	84 db                	test   %bl,%bl
+ 7c7:	74 67                	je     830 <printf+0x80>
+ 7c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7cc:	31 d2                	xor    %edx,%edx
+ 7ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7d1:	eb 34                	jmp    807 <printf+0x57>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+ 7d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7e0:	83 f8 25             	cmp    $0x25,%eax
+ 7e3:	74 18                	je     7fd <printf+0x4d>
+  write(fd, &c, 1);
+ 7e5:	83 ec 04             	sub    $0x4,%esp
+ 7e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ee:	6a 01                	push   $0x1
+ 7f0:	50                   	push   %eax
+ 7f1:	57                   	push   %edi
+ 7f2:	e8 dc fd ff ff       	call   5d3 <write>
+ 7f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 800:	83 c6 01             	add    $0x1,%esi
+ 803:	84 db                	test   %bl,%bl
+ 805:	74 29                	je     830 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 807:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 80a:	85 d2                	test   %edx,%edx
+ 80c:	74 ca                	je     7d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 80e:	83 fa 25             	cmp    $0x25,%edx
+ 811:	75 ea                	jne    7fd <printf+0x4d>
+      if(c == 'd'){
+ 813:	83 f8 25             	cmp    $0x25,%eax
+ 816:	0f 84 24 01 00 00    	je     940 <printf+0x190>
+ 81c:	83 e8 63             	sub    $0x63,%eax
+ 81f:	83 f8 15             	cmp    $0x15,%eax
+ 822:	77 1c                	ja     840 <printf+0x90>
+ 824:	ff 24 85 f4 0d 00 00 	jmp    *0xdf4(,%eax,4)
+ 82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 833:	5b                   	pop    %ebx
+ 834:	5e                   	pop    %esi
+ 835:	5f                   	pop    %edi
+ 836:	5d                   	pop    %ebp
+ 837:	c3                   	ret
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 846:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 84a:	6a 01                	push   $0x1
+ 84c:	52                   	push   %edx
+ 84d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 850:	57                   	push   %edi
+ 851:	e8 7d fd ff ff       	call   5d3 <write>
+ 856:	83 c4 0c             	add    $0xc,%esp
+ 859:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85c:	6a 01                	push   $0x1
+ 85e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 861:	52                   	push   %edx
+ 862:	57                   	push   %edi
+ 863:	e8 6b fd ff ff       	call   5d3 <write>
+        putc(fd, c);
+ 868:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86b:	31 d2                	xor    %edx,%edx
+ 86d:	eb 8e                	jmp    7fd <printf+0x4d>
+ 86f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 00                	push   $0x0
+ 87f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 881:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 884:	e8 87 fe ff ff       	call   710 <printint>
+        ap++;
+ 889:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 88c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 67 ff ff ff       	jmp    7fd <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8ab:	85 db                	test   %ebx,%ebx
+ 8ad:	0f 84 9d 00 00 00    	je     950 <printf+0x1a0>
+        while(*s != 0){
+ 8b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	0f 84 3d ff ff ff    	je     7fd <printf+0x4d>
+ 8c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8c6:	89 de                	mov    %ebx,%esi
+ 8c8:	89 d3                	mov    %edx,%ebx
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	53                   	push   %ebx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 f1 fc ff ff       	call   5d3 <write>
+        while(*s != 0){
+ 8e2:	0f b6 06             	movzbl (%esi),%eax
+ 8e5:	83 c4 10             	add    $0x10,%esp
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	75 e4                	jne    8d0 <printf+0x120>
+      state = 0;
+ 8ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 07 ff ff ff       	jmp    7fd <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 01                	push   $0x1
+ 90f:	e9 6b ff ff ff       	jmp    87f <printf+0xcf>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 918:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 921:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 923:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 926:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	52                   	push   %edx
+ 92c:	57                   	push   %edi
+ 92d:	e8 a1 fc ff ff       	call   5d3 <write>
+        ap++;
+ 932:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 935:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 938:	31 d2                	xor    %edx,%edx
+ 93a:	e9 be fe ff ff       	jmp    7fd <printf+0x4d>
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 946:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 949:	6a 01                	push   $0x1
+ 94b:	e9 11 ff ff ff       	jmp    861 <printf+0xb1>
+ 950:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 955:	bb ea 0d 00 00       	mov    $0xdea,%ebx
+ 95a:	e9 61 ff ff ff       	jmp    8c0 <printf+0x110>
+ 95f:	90                   	nop
+
+00000960 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 963:	a1 a4 12 00 00       	mov    0x12a4,%eax
+{
+ 968:	89 e5                	mov    %esp,%ebp
+ 96a:	56                   	push   %esi
+ 96b:	53                   	push   %ebx
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 970:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 972:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 974:	39 ca                	cmp    %ecx,%edx
+ 976:	73 30                	jae    9a8 <lfree+0x48>
+ 978:	39 c1                	cmp    %eax,%ecx
+ 97a:	72 04                	jb     980 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 97c:	39 c2                	cmp    %eax,%edx
+ 97e:	72 f0                	jb     970 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 980:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 983:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 986:	39 f0                	cmp    %esi,%eax
+ 988:	74 26                	je     9b0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 98a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 98c:	8b 42 04             	mov    0x4(%edx),%eax
+ 98f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 992:	39 d9                	cmp    %ebx,%ecx
+ 994:	74 30                	je     9c6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 996:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 998:	5b                   	pop    %ebx
+  freep = p;
+ 999:	89 15 a4 12 00 00    	mov    %edx,0x12a4
+}
+ 99f:	5e                   	pop    %esi
+ 9a0:	5d                   	pop    %ebp
+ 9a1:	c3                   	ret
+ 9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9a8:	39 c1                	cmp    %eax,%ecx
+ 9aa:	72 d0                	jb     97c <lfree+0x1c>
+ 9ac:	eb c2                	jmp    970 <lfree+0x10>
+ 9ae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 9b0:	03 58 04             	add    0x4(%eax),%ebx
+ 9b3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9b6:	8b 02                	mov    (%edx),%eax
+ 9b8:	8b 00                	mov    (%eax),%eax
+ 9ba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 9bc:	8b 42 04             	mov    0x4(%edx),%eax
+ 9bf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9c2:	39 d9                	cmp    %ebx,%ecx
+ 9c4:	75 d0                	jne    996 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 9c6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 9c9:	89 15 a4 12 00 00    	mov    %edx,0x12a4
+    p->s.size += bp->s.size;
+ 9cf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9d2:	8b 09                	mov    (%ecx),%ecx
+ 9d4:	89 0a                	mov    %ecx,(%edx)
+}
+ 9d6:	5b                   	pop    %ebx
+ 9d7:	5e                   	pop    %esi
+ 9d8:	5d                   	pop    %ebp
+ 9d9:	c3                   	ret
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009e0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	89 c7                	mov    %eax,%edi
+ 9e6:	56                   	push   %esi
+ 9e7:	53                   	push   %ebx
+ 9e8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 9eb:	a1 a4 12 00 00       	mov    0x12a4,%eax
+ 9f0:	85 c0                	test   %eax,%eax
+ 9f2:	0f 84 88 00 00 00    	je     a80 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9f8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 9fa:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 9fd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a02:	39 df                	cmp    %ebx,%edi
+ a04:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a07:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ a0e:	39 f9                	cmp    %edi,%ecx
+ a10:	72 0f                	jb     a21 <lalloc+0x41>
+ a12:	eb 4c                	jmp    a60 <lalloc+0x80>
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a18:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a1a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a1d:	39 f9                	cmp    %edi,%ecx
+ a1f:	73 3f                	jae    a60 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ a21:	89 d0                	mov    %edx,%eax
+ a23:	39 15 a4 12 00 00    	cmp    %edx,0x12a4
+ a29:	75 ed                	jne    a18 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ a2b:	83 ec 0c             	sub    $0xc,%esp
+ a2e:	56                   	push   %esi
+ a2f:	e8 07 fc ff ff       	call   63b <sbrk>
+  if(p == (char*)-1)
+ a34:	83 c4 10             	add    $0x10,%esp
+ a37:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a3a:	74 11                	je     a4d <lalloc+0x6d>
+  hp->s.size = nu;
+ a3c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ a3f:	e8 1c ff ff ff       	call   960 <lfree>
+  return freep;
+ a44:	a1 a4 12 00 00       	mov    0x12a4,%eax
+      if((p = morecore(nunits)) == 0)
+ a49:	85 c0                	test   %eax,%eax
+ a4b:	75 cb                	jne    a18 <lalloc+0x38>
+        return 0;
+  }
+}
+ a4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a50:	31 d2                	xor    %edx,%edx
+}
+ a52:	5b                   	pop    %ebx
+ a53:	89 d0                	mov    %edx,%eax
+ a55:	5e                   	pop    %esi
+ a56:	5f                   	pop    %edi
+ a57:	5d                   	pop    %ebp
+ a58:	c3                   	ret
+ a59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ a60:	39 cf                	cmp    %ecx,%edi
+ a62:	74 4c                	je     ab0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ a64:	29 f9                	sub    %edi,%ecx
+ a66:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ a69:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ a6c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ a6f:	a3 a4 12 00 00       	mov    %eax,0x12a4
+}
+ a74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a77:	89 d0                	mov    %edx,%eax
+ a79:	5b                   	pop    %ebx
+ a7a:	5e                   	pop    %esi
+ a7b:	5f                   	pop    %edi
+ a7c:	5d                   	pop    %ebp
+ a7d:	c3                   	ret
+ a7e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ a80:	ba a8 12 00 00       	mov    $0x12a8,%edx
+ a85:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ a87:	c7 05 a4 12 00 00 a8 	movl   $0x12a8,0x12a4
+ a8e:	12 00 00 
+ a91:	c7 05 a8 12 00 00 a8 	movl   $0x12a8,0x12a8
+ a98:	12 00 00 
+ a9b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ a9d:	c7 05 ac 12 00 00 00 	movl   $0x0,0x12ac
+ aa4:	00 00 00 
+ aa7:	e9 51 ff ff ff       	jmp    9fd <lalloc+0x1d>
+ aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ ab0:	8b 0a                	mov    (%edx),%ecx
+ ab2:	89 08                	mov    %ecx,(%eax)
+ ab4:	eb b9                	jmp    a6f <lalloc+0x8f>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	56                   	push   %esi
+ ac5:	53                   	push   %ebx
+ ac6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ ac9:	85 f6                	test   %esi,%esi
+ acb:	74 42                	je     b0f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ acd:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ ad0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ ad3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ ad9:	77 3d                	ja     b18 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ adb:	31 c9                	xor    %ecx,%ecx
+ add:	bb 01 00 00 00       	mov    $0x1,%ebx
+ ae2:	83 fa 02             	cmp    $0x2,%edx
+ ae5:	74 17                	je     afe <free+0x3e>
+ ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aee:	66 90                	xchg   %ax,%ax
+ af0:	83 c1 01             	add    $0x1,%ecx
+ af3:	89 d8                	mov    %ebx,%eax
+ af5:	d3 e0                	shl    %cl,%eax
+ af7:	83 c0 01             	add    $0x1,%eax
+ afa:	39 c2                	cmp    %eax,%edx
+ afc:	75 f2                	jne    af0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ afe:	8b 04 8d 80 12 00 00 	mov    0x1280(,%ecx,4),%eax
+  classes[c] = bp;
+ b05:	89 3c 8d 80 12 00 00 	mov    %edi,0x1280(,%ecx,4)
+  bp->s.ptr = classes[c];
+ b0c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ b0f:	5b                   	pop    %ebx
+ b10:	5e                   	pop    %esi
+ b11:	5f                   	pop    %edi
+ b12:	5d                   	pop    %ebp
+ b13:	c3                   	ret
+ b14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b18:	5b                   	pop    %ebx
+    lfree(bp);
+ b19:	89 f8                	mov    %edi,%eax
+}
+ b1b:	5e                   	pop    %esi
+ b1c:	5f                   	pop    %edi
+ b1d:	5d                   	pop    %ebp
+    lfree(bp);
+ b1e:	e9 3d fe ff ff       	jmp    960 <lfree>
+ b23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b30 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	57                   	push   %edi
+ b34:	56                   	push   %esi
+ b35:	53                   	push   %ebx
+ b36:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b39:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3c:	83 c0 07             	add    $0x7,%eax
+ b3f:	c1 e8 03             	shr    $0x3,%eax
+ b42:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ b45:	3d 01 01 00 00       	cmp    $0x101,%eax
+ b4a:	77 44                	ja     b90 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ b4c:	31 c9                	xor    %ecx,%ecx
+ b4e:	ba 01 00 00 00       	mov    $0x1,%edx
+ b53:	bb 02 00 00 00       	mov    $0x2,%ebx
+ b58:	83 f8 02             	cmp    $0x2,%eax
+ b5b:	76 11                	jbe    b6e <malloc+0x3e>
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+ b60:	83 c1 01             	add    $0x1,%ecx
+ b63:	89 d3                	mov    %edx,%ebx
+ b65:	d3 e3                	shl    %cl,%ebx
+ b67:	83 c3 01             	add    $0x1,%ebx
+ b6a:	39 c3                	cmp    %eax,%ebx
+ b6c:	72 f2                	jb     b60 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ b6e:	8b 04 8d 80 12 00 00 	mov    0x1280(,%ecx,4),%eax
+ b75:	85 c0                	test   %eax,%eax
+ b77:	74 2f                	je     ba8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ b79:	8b 10                	mov    (%eax),%edx
+ b7b:	89 14 8d 80 12 00 00 	mov    %edx,0x1280(,%ecx,4)
+  return (void*)(p + 1);
+ b82:	83 c0 08             	add    $0x8,%eax
+}
+ b85:	83 c4 1c             	add    $0x1c,%esp
+ b88:	5b                   	pop    %ebx
+ b89:	5e                   	pop    %esi
+ b8a:	5f                   	pop    %edi
+ b8b:	5d                   	pop    %ebp
+ b8c:	c3                   	ret
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ b90:	e8 4b fe ff ff       	call   9e0 <lalloc>
+ b95:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ b97:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ b9a:	85 d2                	test   %edx,%edx
+ b9c:	75 e7                	jne    b85 <malloc+0x55>
+      return 0;
+ b9e:	31 c0                	xor    %eax,%eax
+ ba0:	eb e3                	jmp    b85 <malloc+0x55>
+ ba2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ ba8:	31 d2                	xor    %edx,%edx
+ baa:	b8 00 02 00 00       	mov    $0x200,%eax
+ baf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ bb2:	f7 f3                	div    %ebx
+  if(n < 4)
+ bb4:	ba 04 00 00 00       	mov    $0x4,%edx
+ bb9:	89 d6                	mov    %edx,%esi
+ bbb:	39 d0                	cmp    %edx,%eax
+ bbd:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ bc0:	0f af f3             	imul   %ebx,%esi
+ bc3:	89 f0                	mov    %esi,%eax
+ bc5:	e8 16 fe ff ff       	call   9e0 <lalloc>
+ bca:	85 c0                	test   %eax,%eax
+ bcc:	74 d0                	je     b9e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ bce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ bd1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ bd4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bdb:	8b 14 8d 80 12 00 00 	mov    0x1280(,%ecx,4),%edx
+ be2:	39 f8                	cmp    %edi,%eax
+ be4:	73 22                	jae    c08 <malloc+0xd8>
+ be6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ be9:	eb 09                	jmp    bf4 <malloc+0xc4>
+ beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bef:	90                   	nop
+ bf0:	89 c2                	mov    %eax,%edx
+ bf2:	89 c8                	mov    %ecx,%eax
+ bf4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ bf7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ bfa:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ bfc:	39 f9                	cmp    %edi,%ecx
+ bfe:	72 f0                	jb     bf0 <malloc+0xc0>
+ c00:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c03:	e9 73 ff ff ff       	jmp    b7b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ c08:	89 d0                	mov    %edx,%eax
+ c0a:	8b 12                	mov    (%edx),%edx
+ c0c:	e9 6a ff ff ff       	jmp    b7b <malloc+0x4b>
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+
+00000c20 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	56                   	push   %esi
+ c24:	53                   	push   %ebx
+ c25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ c28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ c2b:	85 c9                	test   %ecx,%ecx
+ c2d:	74 06                	je     c35 <calloc+0x15>
+ c2f:	89 c8                	mov    %ecx,%eax
+ c31:	f7 e3                	mul    %ebx
+ c33:	70 33                	jo     c68 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ c35:	0f af d9             	imul   %ecx,%ebx
+ c38:	83 ec 0c             	sub    $0xc,%esp
+ c3b:	53                   	push   %ebx
+ c3c:	e8 ef fe ff ff       	call   b30 <malloc>
+ c41:	83 c4 10             	add    $0x10,%esp
+ c44:	89 c6                	mov    %eax,%esi
+ c46:	85 c0                	test   %eax,%eax
+ c48:	74 1e                	je     c68 <calloc+0x48>
+    memset(p, 0, n * size);
+ c4a:	83 ec 04             	sub    $0x4,%esp
+ c4d:	53                   	push   %ebx
+ c4e:	6a 00                	push   $0x0
+ c50:	50                   	push   %eax
+ c51:	e8 3a f7 ff ff       	call   390 <memset>
+ c56:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ c59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c5c:	89 f0                	mov    %esi,%eax
+ c5e:	5b                   	pop    %ebx
+ c5f:	5e                   	pop    %esi
+ c60:	5d                   	pop    %ebp
+ c61:	c3                   	ret
+ c62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ c6b:	31 f6                	xor    %esi,%esi
+}
+ c6d:	89 f0                	mov    %esi,%eax
+ c6f:	5b                   	pop    %ebx
+ c70:	5e                   	pop    %esi
+ c71:	5d                   	pop    %ebp
+ c72:	c3                   	ret
+ c73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c80 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	57                   	push   %edi
+ c84:	56                   	push   %esi
+ c85:	53                   	push   %ebx
+ c86:	83 ec 0c             	sub    $0xc,%esp
+ c89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ c8f:	85 db                	test   %ebx,%ebx
+ c91:	74 55                	je     ce8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ c93:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ c96:	89 de                	mov    %ebx,%esi
+ c98:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ c9f:	39 c7                	cmp    %eax,%edi
+ ca1:	72 0d                	jb     cb0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ca6:	89 f0                	mov    %esi,%eax
+ ca8:	5b                   	pop    %ebx
+ ca9:	5e                   	pop    %esi
+ caa:	5f                   	pop    %edi
+ cab:	5d                   	pop    %ebp
+ cac:	c3                   	ret
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ cb0:	83 ec 0c             	sub    $0xc,%esp
+ cb3:	50                   	push   %eax
+ cb4:	e8 77 fe ff ff       	call   b30 <malloc>
+ cb9:	83 c4 10             	add    $0x10,%esp
+ cbc:	89 c6                	mov    %eax,%esi
+ cbe:	85 c0                	test   %eax,%eax
+ cc0:	74 e1                	je     ca3 <realloc+0x23>
+  memmove(p, ap, have);
+ cc2:	83 ec 04             	sub    $0x4,%esp
+ cc5:	57                   	push   %edi
+ cc6:	53                   	push   %ebx
+ cc7:	50                   	push   %eax
+ cc8:	e8 b3 f8 ff ff       	call   580 <memmove>
+  free(ap);
+ ccd:	89 1c 24             	mov    %ebx,(%esp)
+ cd0:	e8 eb fd ff ff       	call   ac0 <free>
+  return p;
+ cd5:	83 c4 10             	add    $0x10,%esp
+}
+ cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cdb:	89 f0                	mov    %esi,%eax
+ cdd:	5b                   	pop    %ebx
+ cde:	5e                   	pop    %esi
+ cdf:	5f                   	pop    %edi
+ ce0:	5d                   	pop    %ebp
+ ce1:	c3                   	ret
+ ce2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ ce8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cee:	5b                   	pop    %ebx
+ cef:	5e                   	pop    %esi
+ cf0:	5f                   	pop    %edi
+ cf1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ cf2:	e9 39 fe ff ff       	jmp    b30 <malloc>
@@ -0,0 +1,111 @@
+// Measure fork latency: fork a child that exits at once, wait
+// for it, repeat.  Run with a small and a large parent image to
+// see how much of the cost is address-space setup and copying.
+// Also count the page-table pages each process costs, and what
+// it would cost if every page directory had its own copy of the
+// kernel half, mapped with 4KB pages.
+
+#include "types.h"
+#include "user.h"
+#include "meminfo.h"
+#include "uproc.h"
+
+#define N     500
+#define NHOLD 8
+#define NPS   72   // as in ps
+#define DEVPT 8    // page tables for DEVSPACE..4GB
+
+static int
+run(void)
+{
+  int i, pid, start;
+
+  start = uptime();
+  for(i = 0; i < N; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(2, "forkbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      exit();
+    wait();
+  }
+  return uptime() - start;
+}
+
+static void
+report(char *what, int t)
+{
+  int us = t * 1000 / N;   // ticks are milliseconds
+
+  printf(1, "%s: %d forks in %d ms, %d.%d%d%d ms per fork\n", what, N, t,
+         us/1000, (us/100)%10, (us/10)%10, us%10);
+}
+
+// Fork NHOLD children that wait on a pipe and report the
+// page-table pages (directory included) that ps shows for them.
+static void
+ptpages(void)
+{
+  struct uproc *tab;
+  struct meminfo mi;
+  int i, n, fd[2], pid, nchild, child, self, kpt;
+  char c;
+
+  tab = malloc(NPS * sizeof(struct uproc));
+  if(tab == 0 || pipe(fd) < 0 || getmeminfo(&mi) < 0){
+    printf(2, "forkbench: cannot count page tables\n");
+    return;
+  }
+  for(i = 0; i < NHOLD; i++){
+    if(fork() == 0){
+      close(fd[1]);
+      read(fd[0], &c, 1);
+      exit();
+    }
+  }
+  n = getprocs(NPS, tab);
+  close(fd[0]);
+  close(fd[1]);
+  for(i = 0; i < NHOLD; i++)
+    wait();
+
+  pid = getpid();
+  nchild = child = self = 0;
+  for(i = 0; i < n; i++){
+    if(tab[i].pid == pid)
+      self = tab[i].ptpages;
+    else if(tab[i].ppid == pid){
+      child += tab[i].ptpages;
+      nchild++;
+    }
+  }
+  if(nchild > 0)
+    child /= nchild;
+  kpt = (mi.physpages + 1023) / 1024 + DEVPT;
+  printf(1, "page-table pages: parent %d, child %d; %d and %d if each copied the kernel's %d\n",
+         self, child, self + kpt, child + kpt, kpt);
+  free(tab);
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *p;
+  int i;
+
+  ptpages();
+  report("small parent", run());
+
+  // Grow the parent by 1 MB of touched memory.
+  p = sbrk(1024*1024);
+  if(p == (char*)-1){
+    printf(2, "forkbench: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < 1024*1024; i += 4096)
+    p[i] = 1;
+  report("1 MB parent", run());
+  exit();
+}
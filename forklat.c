@@ -0,0 +1,68 @@
+// Report the distribution of fork latency: the time, in CPU
+// cycles, from calling fork() to its return in the parent.  Each
+// child exits at once and is reaped before the next fork.  The
+// paced run sleeps a tick between forks, which gives idle cpus
+// time to refill the kernel's pools of stacks and page tables.
+
+#include "types.h"
+#include "user.h"
+
+#define N 1000
+
+static uint lat[N];
+
+static uint
+cycles(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+static void
+sort(uint *a, int n)
+{
+  int i, j;
+  uint x;
+
+  for(i = 1; i < n; i++){
+    x = a[i];
+    for(j = i; j > 0 && a[j-1] > x; j--)
+      a[j] = a[j-1];
+    a[j] = x;
+  }
+}
+
+static void
+run(char *what, int pause)
+{
+  int i, pid;
+  uint t;
+
+  for(i = 0; i < N; i++){
+    t = cycles();
+    pid = fork();
+    if(pid == 0)
+      exit();
+    lat[i] = cycles() - t;
+    if(pid < 0){
+      printf(2, "forklat: fork failed\n");
+      exit();
+    }
+    wait();
+    if(pause)
+      sleep(1);
+  }
+  sort(lat, N);
+  printf(1, "%s: fork cycles p50 %d p90 %d p99 %d max %d\n", what,
+         lat[N/2], lat[N*9/10], lat[N*99/100], lat[N-1]);
+}
+
+int
+main(int argc, char *argv[])
+{
+  run("back to back", 0);
+  run("paced", 1);
+  exit();
+}
@@ -0,0 +1,1716 @@
+
+_free:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+[KM_BCACHE] "bcache",
+};
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+  struct meminfo mi;
+  struct swapstat st;
+  int i;
+
+  if(getmeminfo(&mi) < 0){
+   f:	8d 75 c0             	lea    -0x40(%ebp),%esi
+{
+  12:	51                   	push   %ecx
+  13:	83 ec 58             	sub    $0x58,%esp
+  if(getmeminfo(&mi) < 0){
+  16:	56                   	push   %esi
+  17:	e8 5f 04 00 00       	call   47b <getmeminfo>
+  1c:	83 c4 10             	add    $0x10,%esp
+  1f:	85 c0                	test   %eax,%eax
+  21:	78 7b                	js     9e <main+0x9e>
+    printf(2, "free: getmeminfo failed\n");
+    exit();
+  }
+  printf(1, "total\t%d KB\n", KB(mi.total));
+  23:	50                   	push   %eax
+  24:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  printf(1, "free\t%d KB (+%d KB superpage reserve)\n",
+         KB(mi.free), KB(mi.spfree));
+  for(i = 0; i < NKM; i++)
+  27:	31 db                	xor    %ebx,%ebx
+  printf(1, "total\t%d KB\n", KB(mi.total));
+  29:	c1 e0 02             	shl    $0x2,%eax
+  2c:	50                   	push   %eax
+  2d:	68 11 0b 00 00       	push   $0xb11
+  32:	6a 01                	push   $0x1
+  34:	e8 77 05 00 00       	call   5b0 <printf>
+  printf(1, "free\t%d KB (+%d KB superpage reserve)\n",
+  39:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  3c:	c1 e0 02             	shl    $0x2,%eax
+  3f:	50                   	push   %eax
+  40:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  43:	c1 e0 02             	shl    $0x2,%eax
+  46:	50                   	push   %eax
+  47:	68 5c 0b 00 00       	push   $0xb5c
+  4c:	6a 01                	push   $0x1
+  4e:	e8 5d 05 00 00       	call   5b0 <printf>
+  53:	83 c4 20             	add    $0x20,%esp
+  56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s\t%d KB\n", kinds[i], KB(mi.used[i]));
+  60:	8b 44 9e 10          	mov    0x10(%esi,%ebx,4),%eax
+  64:	c1 e0 02             	shl    $0x2,%eax
+  67:	50                   	push   %eax
+  68:	ff 34 9d 84 0b 00 00 	push   0xb84(,%ebx,4)
+  for(i = 0; i < NKM; i++)
+  6f:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "%s\t%d KB\n", kinds[i], KB(mi.used[i]));
+  72:	68 1e 0b 00 00       	push   $0xb1e
+  77:	6a 01                	push   $0x1
+  79:	e8 32 05 00 00       	call   5b0 <printf>
+  for(i = 0; i < NKM; i++)
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	83 fb 06             	cmp    $0x6,%ebx
+  84:	75 da                	jne    60 <main+0x60>
+  if(swapstat(&st) == 0)
+  86:	83 ec 0c             	sub    $0xc,%esp
+  89:	8d 45 b0             	lea    -0x50(%ebp),%eax
+  8c:	50                   	push   %eax
+  8d:	e8 e1 03 00 00       	call   473 <swapstat>
+  92:	83 c4 10             	add    $0x10,%esp
+  95:	85 c0                	test   %eax,%eax
+  97:	74 18                	je     b1 <main+0xb1>
+    printf(1, "swap\t%d/%d KB\n", KB(st.used), KB(st.nslot));
+  exit();
+  99:	e8 15 03 00 00       	call   3b3 <exit>
+    printf(2, "free: getmeminfo failed\n");
+  9e:	52                   	push   %edx
+  9f:	52                   	push   %edx
+  a0:	68 f8 0a 00 00       	push   $0xaf8
+  a5:	6a 02                	push   $0x2
+  a7:	e8 04 05 00 00       	call   5b0 <printf>
+    exit();
+  ac:	e8 02 03 00 00       	call   3b3 <exit>
+    printf(1, "swap\t%d/%d KB\n", KB(st.used), KB(st.nslot));
+  b1:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  b4:	c1 e0 02             	shl    $0x2,%eax
+  b7:	50                   	push   %eax
+  b8:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  bb:	c1 e0 02             	shl    $0x2,%eax
+  be:	50                   	push   %eax
+  bf:	68 28 0b 00 00       	push   $0xb28
+  c4:	6a 01                	push   $0x1
+  c6:	e8 e5 04 00 00       	call   5b0 <printf>
+  cb:	83 c4 10             	add    $0x10,%esp
+  ce:	eb c9                	jmp    99 <main+0x99>
+
+000000d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  d1:	31 c0                	xor    %eax,%eax
+{
+  d3:	89 e5                	mov    %esp,%ebp
+  d5:	53                   	push   %ebx
+  d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  e7:	83 c0 01             	add    $0x1,%eax
+  ea:	84 d2                	test   %dl,%dl
+  ec:	75 f2                	jne    e0 <strcpy+0x10>
+    ;
+  return os;
+}
+  ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  f1:	89 c8                	mov    %ecx,%eax
+  f3:	c9                   	leave
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	53                   	push   %ebx
+ 104:	8b 55 08             	mov    0x8(%ebp),%edx
+ 107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 10a:	0f b6 02             	movzbl (%edx),%eax
+ 10d:	84 c0                	test   %al,%al
+ 10f:	75 17                	jne    128 <strcmp+0x28>
+ 111:	eb 3a                	jmp    14d <strcmp+0x4d>
+ 113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 117:	90                   	nop
+ 118:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 11c:	83 c2 01             	add    $0x1,%edx
+ 11f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 122:	84 c0                	test   %al,%al
+ 124:	74 1a                	je     140 <strcmp+0x40>
+    p++, q++;
+ 126:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 128:	0f b6 19             	movzbl (%ecx),%ebx
+ 12b:	38 c3                	cmp    %al,%bl
+ 12d:	74 e9                	je     118 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 12f:	29 d8                	sub    %ebx,%eax
+}
+ 131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 134:	c9                   	leave
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 140:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 144:	31 c0                	xor    %eax,%eax
+ 146:	29 d8                	sub    %ebx,%eax
+}
+ 148:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 14b:	c9                   	leave
+ 14c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 14d:	0f b6 19             	movzbl (%ecx),%ebx
+ 150:	31 c0                	xor    %eax,%eax
+ 152:	eb db                	jmp    12f <strcmp+0x2f>
+ 154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+
+00000160 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 166:	80 3a 00             	cmpb   $0x0,(%edx)
+ 169:	74 15                	je     180 <strlen+0x20>
+ 16b:	31 c0                	xor    %eax,%eax
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+ 170:	83 c0 01             	add    $0x1,%eax
+ 173:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 177:	89 c1                	mov    %eax,%ecx
+ 179:	75 f5                	jne    170 <strlen+0x10>
+    ;
+  return n;
+}
+ 17b:	89 c8                	mov    %ecx,%eax
+ 17d:	5d                   	pop    %ebp
+ 17e:	c3                   	ret
+ 17f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 180:	31 c9                	xor    %ecx,%ecx
+}
+ 182:	5d                   	pop    %ebp
+ 183:	89 c8                	mov    %ecx,%eax
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000190 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 197:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 19a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19d:	89 d7                	mov    %edx,%edi
+ 19f:	fc                   	cld
+ 1a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1a5:	89 d0                	mov    %edx,%eax
+ 1a7:	c9                   	leave
+ 1a8:	c3                   	ret
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ba:	0f b6 10             	movzbl (%eax),%edx
+ 1bd:	84 d2                	test   %dl,%dl
+ 1bf:	75 12                	jne    1d3 <strchr+0x23>
+ 1c1:	eb 1d                	jmp    1e0 <strchr+0x30>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1cc:	83 c0 01             	add    $0x1,%eax
+ 1cf:	84 d2                	test   %dl,%dl
+ 1d1:	74 0d                	je     1e0 <strchr+0x30>
+    if(*s == c)
+ 1d3:	38 d1                	cmp    %dl,%cl
+ 1d5:	75 f1                	jne    1c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1d7:	5d                   	pop    %ebp
+ 1d8:	c3                   	ret
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1e0:	31 c0                	xor    %eax,%eax
+}
+ 1e2:	5d                   	pop    %ebp
+ 1e3:	c3                   	ret
+ 1e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1f9:	31 db                	xor    %ebx,%ebx
+{
+ 1fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1fe:	eb 27                	jmp    227 <gets+0x37>
+    cc = read(0, &c, 1);
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	6a 01                	push   $0x1
+ 205:	56                   	push   %esi
+ 206:	6a 00                	push   $0x0
+ 208:	e8 be 01 00 00       	call   3cb <read>
+    if(cc < 1)
+ 20d:	83 c4 10             	add    $0x10,%esp
+ 210:	85 c0                	test   %eax,%eax
+ 212:	7e 1d                	jle    231 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 214:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 218:	8b 55 08             	mov    0x8(%ebp),%edx
+ 21b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 21f:	3c 0a                	cmp    $0xa,%al
+ 221:	74 10                	je     233 <gets+0x43>
+ 223:	3c 0d                	cmp    $0xd,%al
+ 225:	74 0c                	je     233 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 227:	89 df                	mov    %ebx,%edi
+ 229:	83 c3 01             	add    $0x1,%ebx
+ 22c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 22f:	7c cf                	jl     200 <gets+0x10>
+ 231:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 23a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 23d:	5b                   	pop    %ebx
+ 23e:	5e                   	pop    %esi
+ 23f:	5f                   	pop    %edi
+ 240:	5d                   	pop    %ebp
+ 241:	c3                   	ret
+ 242:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	56                   	push   %esi
+ 254:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 255:	83 ec 08             	sub    $0x8,%esp
+ 258:	6a 00                	push   $0x0
+ 25a:	ff 75 08             	push   0x8(%ebp)
+ 25d:	e8 91 01 00 00       	call   3f3 <open>
+  if(fd < 0)
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	85 c0                	test   %eax,%eax
+ 267:	78 27                	js     290 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 269:	83 ec 08             	sub    $0x8,%esp
+ 26c:	ff 75 0c             	push   0xc(%ebp)
+ 26f:	89 c3                	mov    %eax,%ebx
+ 271:	50                   	push   %eax
+ 272:	e8 94 01 00 00       	call   40b <fstat>
+  close(fd);
+ 277:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 27a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 27c:	e8 5a 01 00 00       	call   3db <close>
+  return r;
+ 281:	83 c4 10             	add    $0x10,%esp
+}
+ 284:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 287:	89 f0                	mov    %esi,%eax
+ 289:	5b                   	pop    %ebx
+ 28a:	5e                   	pop    %esi
+ 28b:	5d                   	pop    %ebp
+ 28c:	c3                   	ret
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 290:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 295:	eb ed                	jmp    284 <stat+0x34>
+ 297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+ 2a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2a8:	0f b6 02             	movzbl (%edx),%eax
+ 2ab:	3c 20                	cmp    $0x20,%al
+ 2ad:	75 0c                	jne    2bb <atoi+0x1b>
+ 2af:	90                   	nop
+ 2b0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2b4:	83 c2 01             	add    $0x1,%edx
+ 2b7:	3c 20                	cmp    $0x20,%al
+ 2b9:	74 f5                	je     2b0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2bb:	3c 2d                	cmp    $0x2d,%al
+ 2bd:	74 41                	je     300 <atoi+0x60>
+ 2bf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2c4:	3c 2b                	cmp    $0x2b,%al
+ 2c6:	74 3d                	je     305 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 2c8:	0f be 0a             	movsbl (%edx),%ecx
+ 2cb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2ce:	3c 09                	cmp    $0x9,%al
+ 2d0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2d5:	77 21                	ja     2f8 <atoi+0x58>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 2e6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 2ea:	0f be 0a             	movsbl (%edx),%ecx
+ 2ed:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2f0:	80 fb 09             	cmp    $0x9,%bl
+ 2f3:	76 eb                	jbe    2e0 <atoi+0x40>
+  return sign*n;
+ 2f5:	0f af c6             	imul   %esi,%eax
+}
+ 2f8:	5b                   	pop    %ebx
+ 2f9:	5e                   	pop    %esi
+ 2fa:	5d                   	pop    %ebp
+ 2fb:	c3                   	ret
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 305:	83 c2 01             	add    $0x1,%edx
+ 308:	eb be                	jmp    2c8 <atoi+0x28>
+ 30a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000310 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	56                   	push   %esi
+ 314:	53                   	push   %ebx
+ 315:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 318:	0f b6 02             	movzbl (%edx),%eax
+ 31b:	3c 20                	cmp    $0x20,%al
+ 31d:	75 0c                	jne    32b <atoo+0x1b>
+ 31f:	90                   	nop
+ 320:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 324:	83 c2 01             	add    $0x1,%edx
+ 327:	3c 20                	cmp    $0x20,%al
+ 329:	74 f5                	je     320 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 32b:	3c 2d                	cmp    $0x2d,%al
+ 32d:	74 41                	je     370 <atoo+0x60>
+ 32f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 334:	3c 2b                	cmp    $0x2b,%al
+ 336:	74 3d                	je     375 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 338:	0f be 0a             	movsbl (%edx),%ecx
+ 33b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 33e:	3c 07                	cmp    $0x7,%al
+ 340:	b8 00 00 00 00       	mov    $0x0,%eax
+ 345:	77 1e                	ja     365 <atoo+0x55>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 350:	83 c2 01             	add    $0x1,%edx
+ 353:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 357:	0f be 0a             	movsbl (%edx),%ecx
+ 35a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 35d:	80 fb 07             	cmp    $0x7,%bl
+ 360:	76 ee                	jbe    350 <atoo+0x40>
+  return sign*n;
+ 362:	0f af c6             	imul   %esi,%eax
+}
+ 365:	5b                   	pop    %ebx
+ 366:	5e                   	pop    %esi
+ 367:	5d                   	pop    %ebp
+ 368:	c3                   	ret
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 370:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 375:	83 c2 01             	add    $0x1,%edx
+ 378:	eb be                	jmp    338 <atoo+0x28>
+ 37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000380 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	8b 45 10             	mov    0x10(%ebp),%eax
+ 388:	8b 55 08             	mov    0x8(%ebp),%edx
+ 38b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 38e:	85 c0                	test   %eax,%eax
+ 390:	7e 13                	jle    3a5 <memmove+0x25>
+ 392:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 394:	89 d7                	mov    %edx,%edi
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3a1:	39 f8                	cmp    %edi,%eax
+ 3a3:	75 fb                	jne    3a0 <memmove+0x20>
+  return vdst;
+}
+ 3a5:	5e                   	pop    %esi
+ 3a6:	89 d0                	mov    %edx,%eax
+ 3a8:	5f                   	pop    %edi
+ 3a9:	5d                   	pop    %ebp
+ 3aa:	c3                   	ret
+
+000003ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <exit>:
+SYSCALL(exit)
+ 3b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <wait>:
+SYSCALL(wait)
+ 3bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <pipe>:
+SYSCALL(pipe)
+ 3c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <read>:
+SYSCALL(read)
+ 3cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <write>:
+SYSCALL(write)
+ 3d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <close>:
+SYSCALL(close)
+ 3db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <kill>:
+SYSCALL(kill)
+ 3e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <exec>:
+SYSCALL(exec)
+ 3eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <open>:
+SYSCALL(open)
+ 3f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <mknod>:
+SYSCALL(mknod)
+ 3fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <unlink>:
+SYSCALL(unlink)
+ 403:	b8 12 00 00 00       	mov    $0x12,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <fstat>:
+SYSCALL(fstat)
+ 40b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <link>:
+SYSCALL(link)
+ 413:	b8 13 00 00 00       	mov    $0x13,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <mkdir>:
+SYSCALL(mkdir)
+ 41b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <chdir>:
+SYSCALL(chdir)
+ 423:	b8 09 00 00 00       	mov    $0x9,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <dup>:
+SYSCALL(dup)
+ 42b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <getpid>:
+SYSCALL(getpid)
+ 433:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <sbrk>:
+SYSCALL(sbrk)
+ 43b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <sleep>:
+SYSCALL(sleep)
+ 443:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <uptime>:
+SYSCALL(uptime)
+ 44b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <superpages>:
+SYSCALL(superpages)
+ 453:	b8 23 00 00 00       	mov    $0x23,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mmap>:
+SYSCALL(mmap)
+ 45b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <munmap>:
+SYSCALL(munmap)
+ 463:	b8 25 00 00 00       	mov    $0x25,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <spawn>:
+SYSCALL(spawn)
+ 46b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <swapstat>:
+SYSCALL(swapstat)
+ 473:	b8 27 00 00 00       	mov    $0x27,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 47b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <iostat>:
+SYSCALL(iostat)
+ 483:	b8 29 00 00 00       	mov    $0x29,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <dropcache>:
+SYSCALL(dropcache)
+ 48b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <iosched>:
+SYSCALL(iosched)
+ 493:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <halt>:
+SYSCALL(halt)
+ 49b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <date>:
+SYSCALL(date)
+ 4a3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 4ab:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getgid>:
+SYSCALL(getgid)
+ 4b3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getppid>:
+SYSCALL(getppid)
+ 4bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <setuid>:
+SYSCALL(setuid)
+ 4c3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <setgid>:
+SYSCALL(setgid)
+ 4cb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <getprocs>:
+SYSCALL(getprocs)
+ 4d3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 4db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <getpriority>:
+SYSCALL(getpriority)
+ 4e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 4eb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <chown>:
+SYSCALL(chown)
+ 4f3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <chgrp>:
+SYSCALL(chgrp)
+ 4fb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+ 503:	66 90                	xchg   %ax,%ax
+ 505:	66 90                	xchg   %ax,%ax
+ 507:	66 90                	xchg   %ax,%ax
+ 509:	66 90                	xchg   %ax,%ax
+ 50b:	66 90                	xchg   %ax,%ax
+ 50d:	66 90                	xchg   %ax,%ax
+ 50f:	90                   	nop
+
+00000510 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 518:	89 d1                	mov    %edx,%ecx
+{
+ 51a:	83 ec 3c             	sub    $0x3c,%esp
+ 51d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 520:	85 d2                	test   %edx,%edx
+ 522:	0f 89 80 00 00 00    	jns    5a8 <printint+0x98>
+ 528:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 52c:	74 7a                	je     5a8 <printint+0x98>
+    x = -xx;
+ 52e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 530:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 535:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 538:	31 f6                	xor    %esi,%esi
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 540:	89 c8                	mov    %ecx,%eax
+ 542:	31 d2                	xor    %edx,%edx
+ 544:	89 f7                	mov    %esi,%edi
+ 546:	f7 f3                	div    %ebx
+ 548:	8d 76 01             	lea    0x1(%esi),%esi
+ 54b:	0f b6 92 fc 0b 00 00 	movzbl 0xbfc(%edx),%edx
+ 552:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 556:	89 ca                	mov    %ecx,%edx
+ 558:	89 c1                	mov    %eax,%ecx
+ 55a:	39 da                	cmp    %ebx,%edx
+ 55c:	73 e2                	jae    540 <printint+0x30>
+  if(neg)
+ 55e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 561:	85 c0                	test   %eax,%eax
+ 563:	74 07                	je     56c <printint+0x5c>
+    buf[i++] = '-';
+ 565:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 56a:	89 f7                	mov    %esi,%edi
+ 56c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 56f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 572:	01 df                	add    %ebx,%edi
+ 574:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 578:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 57b:	83 ec 04             	sub    $0x4,%esp
+ 57e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 581:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 584:	6a 01                	push   $0x1
+ 586:	50                   	push   %eax
+ 587:	56                   	push   %esi
+ 588:	e8 46 fe ff ff       	call   3d3 <write>
+  while(--i >= 0)
+ 58d:	89 f8                	mov    %edi,%eax
+ 58f:	83 c4 10             	add    $0x10,%esp
+ 592:	83 ef 01             	sub    $0x1,%edi
+ 595:	39 d8                	cmp    %ebx,%eax
+ 597:	75 df                	jne    578 <printint+0x68>
+}
+ 599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 59c:	5b                   	pop    %ebx
+ 59d:	5e                   	pop    %esi
+ 59e:	5f                   	pop    %edi
+ 59f:	5d                   	pop    %ebp
+ 5a0:	c3                   	ret
+ 5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5a8:	31 c0                	xor    %eax,%eax
+ 5aa:	eb 89                	jmp    535 <printint+0x25>
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5c2:	83 c6 01             	add    $0x1,%esi
+ 5c5:	84 db                	test   %bl,%bl
+ 5c7:	74 67                	je     630 <printf+0x80>
+ 5c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5cc:	31 d2                	xor    %edx,%edx
+ 5ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5d1:	eb 34                	jmp    607 <printf+0x57>
+ 5d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5d7:	90                   	nop
+ 5d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5e0:	83 f8 25             	cmp    $0x25,%eax
+ 5e3:	74 18                	je     5fd <printf+0x4d>
+  write(fd, &c, 1);
+ 5e5:	83 ec 04             	sub    $0x4,%esp
+ 5e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ee:	6a 01                	push   $0x1
+ 5f0:	50                   	push   %eax
+ 5f1:	57                   	push   %edi
+ 5f2:	e8 dc fd ff ff       	call   3d3 <write>
+ 5f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 600:	83 c6 01             	add    $0x1,%esi
+ 603:	84 db                	test   %bl,%bl
+ 605:	74 29                	je     630 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 607:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 60a:	85 d2                	test   %edx,%edx
+ 60c:	74 ca                	je     5d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 60e:	83 fa 25             	cmp    $0x25,%edx
+ 611:	75 ea                	jne    5fd <printf+0x4d>
+      if(c == 'd'){
+ 613:	83 f8 25             	cmp    $0x25,%eax
+ 616:	0f 84 24 01 00 00    	je     740 <printf+0x190>
+ 61c:	83 e8 63             	sub    $0x63,%eax
+ 61f:	83 f8 15             	cmp    $0x15,%eax
+ 622:	77 1c                	ja     640 <printf+0x90>
+ 624:	ff 24 85 a4 0b 00 00 	jmp    *0xba4(,%eax,4)
+ 62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 633:	5b                   	pop    %ebx
+ 634:	5e                   	pop    %esi
+ 635:	5f                   	pop    %edi
+ 636:	5d                   	pop    %ebp
+ 637:	c3                   	ret
+ 638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 646:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 64a:	6a 01                	push   $0x1
+ 64c:	52                   	push   %edx
+ 64d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 650:	57                   	push   %edi
+ 651:	e8 7d fd ff ff       	call   3d3 <write>
+ 656:	83 c4 0c             	add    $0xc,%esp
+ 659:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65c:	6a 01                	push   $0x1
+ 65e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 661:	52                   	push   %edx
+ 662:	57                   	push   %edi
+ 663:	e8 6b fd ff ff       	call   3d3 <write>
+        putc(fd, c);
+ 668:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66b:	31 d2                	xor    %edx,%edx
+ 66d:	eb 8e                	jmp    5fd <printf+0x4d>
+ 66f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 670:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 673:	83 ec 0c             	sub    $0xc,%esp
+ 676:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 67b:	8b 13                	mov    (%ebx),%edx
+ 67d:	6a 00                	push   $0x0
+ 67f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 681:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 684:	e8 87 fe ff ff       	call   510 <printint>
+        ap++;
+ 689:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 68c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68f:	31 d2                	xor    %edx,%edx
+ 691:	e9 67 ff ff ff       	jmp    5fd <printf+0x4d>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6a5:	83 c0 04             	add    $0x4,%eax
+ 6a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6ab:	85 db                	test   %ebx,%ebx
+ 6ad:	0f 84 9d 00 00 00    	je     750 <printf+0x1a0>
+        while(*s != 0){
+ 6b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	0f 84 3d ff ff ff    	je     5fd <printf+0x4d>
+ 6c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6c6:	89 de                	mov    %ebx,%esi
+ 6c8:	89 d3                	mov    %edx,%ebx
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6d9:	6a 01                	push   $0x1
+ 6db:	53                   	push   %ebx
+ 6dc:	57                   	push   %edi
+ 6dd:	e8 f1 fc ff ff       	call   3d3 <write>
+        while(*s != 0){
+ 6e2:	0f b6 06             	movzbl (%esi),%eax
+ 6e5:	83 c4 10             	add    $0x10,%esp
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	75 e4                	jne    6d0 <printf+0x120>
+      state = 0;
+ 6ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ef:	31 d2                	xor    %edx,%edx
+ 6f1:	e9 07 ff ff ff       	jmp    5fd <printf+0x4d>
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 700:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 70b:	8b 13                	mov    (%ebx),%edx
+ 70d:	6a 01                	push   $0x1
+ 70f:	e9 6b ff ff ff       	jmp    67f <printf+0xcf>
+ 714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 718:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 71b:	83 ec 04             	sub    $0x4,%esp
+ 71e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 721:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 723:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 726:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	52                   	push   %edx
+ 72c:	57                   	push   %edi
+ 72d:	e8 a1 fc ff ff       	call   3d3 <write>
+        ap++;
+ 732:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 735:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 738:	31 d2                	xor    %edx,%edx
+ 73a:	e9 be fe ff ff       	jmp    5fd <printf+0x4d>
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 746:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 749:	6a 01                	push   $0x1
+ 74b:	e9 11 ff ff ff       	jmp    661 <printf+0xb1>
+ 750:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 755:	bb 9c 0b 00 00       	mov    $0xb9c,%ebx
+ 75a:	e9 61 ff ff ff       	jmp    6c0 <printf+0x110>
+ 75f:	90                   	nop
+
+00000760 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 763:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+{
+ 768:	89 e5                	mov    %esp,%ebp
+ 76a:	56                   	push   %esi
+ 76b:	53                   	push   %ebx
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 770:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 772:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 774:	39 ca                	cmp    %ecx,%edx
+ 776:	73 30                	jae    7a8 <lfree+0x48>
+ 778:	39 c1                	cmp    %eax,%ecx
+ 77a:	72 04                	jb     780 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 77c:	39 c2                	cmp    %eax,%edx
+ 77e:	72 f0                	jb     770 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 780:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 783:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 786:	39 f0                	cmp    %esi,%eax
+ 788:	74 26                	je     7b0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 78a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 78c:	8b 42 04             	mov    0x4(%edx),%eax
+ 78f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 792:	39 d9                	cmp    %ebx,%ecx
+ 794:	74 30                	je     7c6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 796:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 798:	5b                   	pop    %ebx
+  freep = p;
+ 799:	89 15 e4 0f 00 00    	mov    %edx,0xfe4
+}
+ 79f:	5e                   	pop    %esi
+ 7a0:	5d                   	pop    %ebp
+ 7a1:	c3                   	ret
+ 7a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a8:	39 c1                	cmp    %eax,%ecx
+ 7aa:	72 d0                	jb     77c <lfree+0x1c>
+ 7ac:	eb c2                	jmp    770 <lfree+0x10>
+ 7ae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 7b0:	03 58 04             	add    0x4(%eax),%ebx
+ 7b3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b6:	8b 02                	mov    (%edx),%eax
+ 7b8:	8b 00                	mov    (%eax),%eax
+ 7ba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 7bc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7bf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7c2:	39 d9                	cmp    %ebx,%ecx
+ 7c4:	75 d0                	jne    796 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 7c6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 7c9:	89 15 e4 0f 00 00    	mov    %edx,0xfe4
+    p->s.size += bp->s.size;
+ 7cf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7d2:	8b 09                	mov    (%ecx),%ecx
+ 7d4:	89 0a                	mov    %ecx,(%edx)
+}
+ 7d6:	5b                   	pop    %ebx
+ 7d7:	5e                   	pop    %esi
+ 7d8:	5d                   	pop    %ebp
+ 7d9:	c3                   	ret
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007e0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	89 c7                	mov    %eax,%edi
+ 7e6:	56                   	push   %esi
+ 7e7:	53                   	push   %ebx
+ 7e8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 7eb:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+ 7f0:	85 c0                	test   %eax,%eax
+ 7f2:	0f 84 88 00 00 00    	je     880 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 7fa:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 7fd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 802:	39 df                	cmp    %ebx,%edi
+ 804:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 807:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 80e:	39 f9                	cmp    %edi,%ecx
+ 810:	72 0f                	jb     821 <lalloc+0x41>
+ 812:	eb 4c                	jmp    860 <lalloc+0x80>
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 818:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 81a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 81d:	39 f9                	cmp    %edi,%ecx
+ 81f:	73 3f                	jae    860 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 821:	89 d0                	mov    %edx,%eax
+ 823:	39 15 e4 0f 00 00    	cmp    %edx,0xfe4
+ 829:	75 ed                	jne    818 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 82b:	83 ec 0c             	sub    $0xc,%esp
+ 82e:	56                   	push   %esi
+ 82f:	e8 07 fc ff ff       	call   43b <sbrk>
+  if(p == (char*)-1)
+ 834:	83 c4 10             	add    $0x10,%esp
+ 837:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 83a:	74 11                	je     84d <lalloc+0x6d>
+  hp->s.size = nu;
+ 83c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 83f:	e8 1c ff ff ff       	call   760 <lfree>
+  return freep;
+ 844:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+      if((p = morecore(nunits)) == 0)
+ 849:	85 c0                	test   %eax,%eax
+ 84b:	75 cb                	jne    818 <lalloc+0x38>
+        return 0;
+  }
+}
+ 84d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 850:	31 d2                	xor    %edx,%edx
+}
+ 852:	5b                   	pop    %ebx
+ 853:	89 d0                	mov    %edx,%eax
+ 855:	5e                   	pop    %esi
+ 856:	5f                   	pop    %edi
+ 857:	5d                   	pop    %ebp
+ 858:	c3                   	ret
+ 859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 860:	39 cf                	cmp    %ecx,%edi
+ 862:	74 4c                	je     8b0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 864:	29 f9                	sub    %edi,%ecx
+ 866:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 869:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 86c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 86f:	a3 e4 0f 00 00       	mov    %eax,0xfe4
+}
+ 874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 877:	89 d0                	mov    %edx,%eax
+ 879:	5b                   	pop    %ebx
+ 87a:	5e                   	pop    %esi
+ 87b:	5f                   	pop    %edi
+ 87c:	5d                   	pop    %ebp
+ 87d:	c3                   	ret
+ 87e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 880:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+ 885:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 887:	c7 05 e4 0f 00 00 e8 	movl   $0xfe8,0xfe4
+ 88e:	0f 00 00 
+ 891:	c7 05 e8 0f 00 00 e8 	movl   $0xfe8,0xfe8
+ 898:	0f 00 00 
+ 89b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 89d:	c7 05 ec 0f 00 00 00 	movl   $0x0,0xfec
+ 8a4:	00 00 00 
+ 8a7:	e9 51 ff ff ff       	jmp    7fd <lalloc+0x1d>
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 8b0:	8b 0a                	mov    (%edx),%ecx
+ 8b2:	89 08                	mov    %ecx,(%eax)
+ 8b4:	eb b9                	jmp    86f <lalloc+0x8f>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008c0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 8c9:	85 f6                	test   %esi,%esi
+ 8cb:	74 42                	je     90f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 8cd:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 8d0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 8d3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 8d9:	77 3d                	ja     918 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 8db:	31 c9                	xor    %ecx,%ecx
+ 8dd:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 8e2:	83 fa 02             	cmp    $0x2,%edx
+ 8e5:	74 17                	je     8fe <free+0x3e>
+ 8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ee:	66 90                	xchg   %ax,%ax
+ 8f0:	83 c1 01             	add    $0x1,%ecx
+ 8f3:	89 d8                	mov    %ebx,%eax
+ 8f5:	d3 e0                	shl    %cl,%eax
+ 8f7:	83 c0 01             	add    $0x1,%eax
+ 8fa:	39 c2                	cmp    %eax,%edx
+ 8fc:	75 f2                	jne    8f0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 8fe:	8b 04 8d c0 0f 00 00 	mov    0xfc0(,%ecx,4),%eax
+  classes[c] = bp;
+ 905:	89 3c 8d c0 0f 00 00 	mov    %edi,0xfc0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 90c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 90f:	5b                   	pop    %ebx
+ 910:	5e                   	pop    %esi
+ 911:	5f                   	pop    %edi
+ 912:	5d                   	pop    %ebp
+ 913:	c3                   	ret
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 918:	5b                   	pop    %ebx
+    lfree(bp);
+ 919:	89 f8                	mov    %edi,%eax
+}
+ 91b:	5e                   	pop    %esi
+ 91c:	5f                   	pop    %edi
+ 91d:	5d                   	pop    %ebp
+    lfree(bp);
+ 91e:	e9 3d fe ff ff       	jmp    760 <lfree>
+ 923:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000930 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	56                   	push   %esi
+ 935:	53                   	push   %ebx
+ 936:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 939:	8b 45 08             	mov    0x8(%ebp),%eax
+ 93c:	83 c0 07             	add    $0x7,%eax
+ 93f:	c1 e8 03             	shr    $0x3,%eax
+ 942:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 945:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 94a:	77 44                	ja     990 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 94c:	31 c9                	xor    %ecx,%ecx
+ 94e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 953:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 958:	83 f8 02             	cmp    $0x2,%eax
+ 95b:	76 11                	jbe    96e <malloc+0x3e>
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+ 960:	83 c1 01             	add    $0x1,%ecx
+ 963:	89 d3                	mov    %edx,%ebx
+ 965:	d3 e3                	shl    %cl,%ebx
+ 967:	83 c3 01             	add    $0x1,%ebx
+ 96a:	39 c3                	cmp    %eax,%ebx
+ 96c:	72 f2                	jb     960 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 96e:	8b 04 8d c0 0f 00 00 	mov    0xfc0(,%ecx,4),%eax
+ 975:	85 c0                	test   %eax,%eax
+ 977:	74 2f                	je     9a8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 979:	8b 10                	mov    (%eax),%edx
+ 97b:	89 14 8d c0 0f 00 00 	mov    %edx,0xfc0(,%ecx,4)
+  return (void*)(p + 1);
+ 982:	83 c0 08             	add    $0x8,%eax
+}
+ 985:	83 c4 1c             	add    $0x1c,%esp
+ 988:	5b                   	pop    %ebx
+ 989:	5e                   	pop    %esi
+ 98a:	5f                   	pop    %edi
+ 98b:	5d                   	pop    %ebp
+ 98c:	c3                   	ret
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 990:	e8 4b fe ff ff       	call   7e0 <lalloc>
+ 995:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 997:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 99a:	85 d2                	test   %edx,%edx
+ 99c:	75 e7                	jne    985 <malloc+0x55>
+      return 0;
+ 99e:	31 c0                	xor    %eax,%eax
+ 9a0:	eb e3                	jmp    985 <malloc+0x55>
+ 9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 9a8:	31 d2                	xor    %edx,%edx
+ 9aa:	b8 00 02 00 00       	mov    $0x200,%eax
+ 9af:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9b2:	f7 f3                	div    %ebx
+  if(n < 4)
+ 9b4:	ba 04 00 00 00       	mov    $0x4,%edx
+ 9b9:	89 d6                	mov    %edx,%esi
+ 9bb:	39 d0                	cmp    %edx,%eax
+ 9bd:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 9c0:	0f af f3             	imul   %ebx,%esi
+ 9c3:	89 f0                	mov    %esi,%eax
+ 9c5:	e8 16 fe ff ff       	call   7e0 <lalloc>
+ 9ca:	85 c0                	test   %eax,%eax
+ 9cc:	74 d0                	je     99e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 9ce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9d1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 9d4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9db:	8b 14 8d c0 0f 00 00 	mov    0xfc0(,%ecx,4),%edx
+ 9e2:	39 f8                	cmp    %edi,%eax
+ 9e4:	73 22                	jae    a08 <malloc+0xd8>
+ 9e6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9e9:	eb 09                	jmp    9f4 <malloc+0xc4>
+ 9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+ 9f0:	89 c2                	mov    %eax,%edx
+ 9f2:	89 c8                	mov    %ecx,%eax
+ 9f4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ 9f7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ 9fa:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ 9fc:	39 f9                	cmp    %edi,%ecx
+ 9fe:	72 f0                	jb     9f0 <malloc+0xc0>
+ a00:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a03:	e9 73 ff ff ff       	jmp    97b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ a08:	89 d0                	mov    %edx,%eax
+ a0a:	8b 12                	mov    (%edx),%edx
+ a0c:	e9 6a ff ff ff       	jmp    97b <malloc+0x4b>
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+
+00000a20 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	56                   	push   %esi
+ a24:	53                   	push   %ebx
+ a25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ a2b:	85 c9                	test   %ecx,%ecx
+ a2d:	74 06                	je     a35 <calloc+0x15>
+ a2f:	89 c8                	mov    %ecx,%eax
+ a31:	f7 e3                	mul    %ebx
+ a33:	70 33                	jo     a68 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ a35:	0f af d9             	imul   %ecx,%ebx
+ a38:	83 ec 0c             	sub    $0xc,%esp
+ a3b:	53                   	push   %ebx
+ a3c:	e8 ef fe ff ff       	call   930 <malloc>
+ a41:	83 c4 10             	add    $0x10,%esp
+ a44:	89 c6                	mov    %eax,%esi
+ a46:	85 c0                	test   %eax,%eax
+ a48:	74 1e                	je     a68 <calloc+0x48>
+    memset(p, 0, n * size);
+ a4a:	83 ec 04             	sub    $0x4,%esp
+ a4d:	53                   	push   %ebx
+ a4e:	6a 00                	push   $0x0
+ a50:	50                   	push   %eax
+ a51:	e8 3a f7 ff ff       	call   190 <memset>
+ a56:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ a59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a5c:	89 f0                	mov    %esi,%eax
+ a5e:	5b                   	pop    %ebx
+ a5f:	5e                   	pop    %esi
+ a60:	5d                   	pop    %ebp
+ a61:	c3                   	ret
+ a62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a6b:	31 f6                	xor    %esi,%esi
+}
+ a6d:	89 f0                	mov    %esi,%eax
+ a6f:	5b                   	pop    %ebx
+ a70:	5e                   	pop    %esi
+ a71:	5d                   	pop    %ebp
+ a72:	c3                   	ret
+ a73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a80 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	83 ec 0c             	sub    $0xc,%esp
+ a89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ a8f:	85 db                	test   %ebx,%ebx
+ a91:	74 55                	je     ae8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ a93:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ a96:	89 de                	mov    %ebx,%esi
+ a98:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ a9f:	39 c7                	cmp    %eax,%edi
+ aa1:	72 0d                	jb     ab0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ aa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aa6:	89 f0                	mov    %esi,%eax
+ aa8:	5b                   	pop    %ebx
+ aa9:	5e                   	pop    %esi
+ aaa:	5f                   	pop    %edi
+ aab:	5d                   	pop    %ebp
+ aac:	c3                   	ret
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ ab0:	83 ec 0c             	sub    $0xc,%esp
+ ab3:	50                   	push   %eax
+ ab4:	e8 77 fe ff ff       	call   930 <malloc>
+ ab9:	83 c4 10             	add    $0x10,%esp
+ abc:	89 c6                	mov    %eax,%esi
+ abe:	85 c0                	test   %eax,%eax
+ ac0:	74 e1                	je     aa3 <realloc+0x23>
+  memmove(p, ap, have);
+ ac2:	83 ec 04             	sub    $0x4,%esp
+ ac5:	57                   	push   %edi
+ ac6:	53                   	push   %ebx
+ ac7:	50                   	push   %eax
+ ac8:	e8 b3 f8 ff ff       	call   380 <memmove>
+  free(ap);
+ acd:	89 1c 24             	mov    %ebx,(%esp)
+ ad0:	e8 eb fd ff ff       	call   8c0 <free>
+  return p;
+ ad5:	83 c4 10             	add    $0x10,%esp
+}
+ ad8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ adb:	89 f0                	mov    %esi,%eax
+ add:	5b                   	pop    %ebx
+ ade:	5e                   	pop    %esi
+ adf:	5f                   	pop    %edi
+ ae0:	5d                   	pop    %ebp
+ ae1:	c3                   	ret
+ ae2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ ae8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ aeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aee:	5b                   	pop    %ebx
+ aef:	5e                   	pop    %esi
+ af0:	5f                   	pop    %edi
+ af1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ af2:	e9 39 fe ff ff       	jmp    930 <malloc>
@@ -0,0 +1,40 @@
+// Print physical memory use, in KB: how much the kernel's page
+// allocator manages, how much is free, what the rest is used
+// for, and how much swap is in use.
+
+#include "types.h"
+#include "user.h"
+#include "meminfo.h"
+#include "swap.h"
+
+#define KB(n) ((n) * 4)
+
+static char *kinds[NKM] = {
+[KM_OTHER]  "other",
+[KM_USER]   "user",
+[KM_PGTBL]  "pgtbl",
+[KM_KSTACK] "kstack",
+[KM_PIPE]   "pipe",
+[KM_BCACHE] "bcache",
+};
+
+int
+main(int argc, char *argv[])
+{
+  struct meminfo mi;
+  struct swapstat st;
+  int i;
+
+  if(getmeminfo(&mi) < 0){
+    printf(2, "free: getmeminfo failed\n");
+    exit();
+  }
+  printf(1, "total\t%d KB\n", KB(mi.total));
+  printf(1, "free\t%d KB (+%d KB superpage reserve)\n",
+         KB(mi.free), KB(mi.spfree));
+  for(i = 0; i < NKM; i++)
+    printf(1, "%s\t%d KB\n", kinds[i], KB(mi.used[i]));
+  if(swapstat(&st) == 0)
+    printf(1, "swap\t%d/%d KB\n", KB(st.used), KB(st.nslot));
+  exit();
+}
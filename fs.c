@@ -166,16 +166,20 @@ bfree(int dev, uint b)
 
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *inode;  // ninode entries
 } icache;
 
+static int ninode;
+
 void
 iinit(int dev)
 {
   int i = 0;
 
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
+  ninode = kscale(NINODE);
+  icache.inode = ktable(ninode, sizeof(struct inode));
+  for(i = 0; i < ninode; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
   }
 
@@ -191,18 +195,25 @@ static struct inode* iget(uint dev, uint inum);
 //PAGEBREAK!
 // Allocate an inode on device dev.
 // Mark it as allocated by  giving it type type.
-// Returns an unlocked but allocated and referenced inode.
+// Returns an unlocked but allocated and referenced inode,
+// or 0 if there is no free inode on disk or in the cache.
 struct inode*
 ialloc(uint dev, short type)
 {
   int inum;
   struct buf *bp;
   struct dinode *dip;
+  struct inode *ip;
 
   for(inum = 1; inum < sb.ninodes; inum++){
     bp = bread(dev, IBLOCK(inum, sb));
     dip = (struct dinode*)bp->data + inum%IPB;
     if(dip->type == 0){  // a free inode
+      if((ip = iget(dev, inum)) == 0){
+        brelse(bp);
+        return 0;
+      }
+      ip->textpg = 0;  // iput() dropped the old file's pages
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
 #ifdef CS333_P5
@@ -212,11 +223,11 @@ ialloc(uint dev, short type)
 #endif      
       log_write(bp);   // mark it allocated on the disk
       brelse(bp);
-      return iget(dev, inum);
+      return ip;
     }
     brelse(bp);
   }
-  panic("ialloc: no inodes");
+  return 0;
 }
 
 // Copy a modified in-memory inode to disk.
@@ -249,6 +260,7 @@ iupdate(struct inode *ip)
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
+// Returns 0 if the inode cache is full.
 static struct inode*
 iget(uint dev, uint inum)
 {
@@ -258,7 +270,7 @@ iget(uint dev, uint inum)
 
   // Is the inode already cached?
   empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+  for(ip = &icache.inode[0]; ip < &icache.inode[ninode]; ip++){
     if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
       ip->ref++;
       release(&icache.lock);
@@ -269,18 +281,33 @@ iget(uint dev, uint inum)
   }
 
   // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+  if(empty == 0){
+    release(&icache.lock);
+    return 0;
+  }
 
   ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->ranext = ip->raend = ip->rawin = 0;
+  ip->textpg = 1;  // the caches may still hold pages from before
   release(&icache.lock);
   return ip;
 }
 
+// Count one more (n is 1) or one fewer (n is -1) program image
+// mapping ip.  writei() refuses to change a file while any image
+// maps it, so a running program never sees two versions of it.
+void
+itext(struct inode *ip, int n)
+{
+  acquire(&icache.lock);
+  ip->ntext += n;
+  release(&icache.lock);
+}
+
 // Increment reference count for ip.
 // Returns ip to enable ip = idup(ip1) idiom.
 struct inode*
@@ -449,7 +476,9 @@ itrunc(struct inode *ip)
   }
 
   ip->size = 0;
+  ip->raend = 0;
   iupdate(ip);
+  textinval(ip);
 }
 
 // Copy stat information from inode.
@@ -470,12 +499,45 @@ stati(struct inode *ip, struct stat *st)
 }
 
 //PAGEBREAK!
+// Read ahead after a read of blocks first through last of ip.
+// A read that starts where the last one stopped is sequential;
+// the window then starts at RAMIN blocks and doubles each time
+// the reader catches up with its second half, up to RAMAX.  Any
+// other read closes it.  If the blocks are all cached already,
+// the window halves instead.  Caller must hold ip->lock.
+static void
+readahead(struct inode *ip, uint first, uint last)
+{
+  uint bn, end, nblk, win;
+  int started;
+
+  if(first != ip->ranext && first + 1 != ip->ranext){
+    ip->ranext = last + 1;
+    ip->raend = 0;
+    ip->rawin = 0;
+    return;
+  }
+  ip->ranext = last + 1;
+  if(ip->raend > last + ip->rawin/2)
+    return;
+
+  win = ip->rawin ? min(2*ip->rawin, RAMAX) : RAMIN;
+  nblk = (ip->size + BSIZE - 1) / BSIZE;
+  bn = ip->raend > last ? ip->raend : last + 1;
+  end = min(last + 1 + win, nblk);
+  started = 0;
+  for(; bn < end; bn++)
+    started += breada(ip->dev, bmap(ip, bn));
+  ip->raend = end;
+  ip->rawin = started ? win : ip->rawin/2;
+}
+
 // Read data from inode.
 // Caller must hold ip->lock.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, first;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -489,12 +551,17 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  first = off/BSIZE;
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
+
+  // Only now, so the blocks asked for don't queue behind it.
+  if(n > 0 && ip->type == T_FILE)
+    readahead(ip, first, (off - 1)/BSIZE);
   return n;
 }
 
@@ -506,6 +573,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
 {
   uint tot, m;
   struct buf *bp;
+  int busy;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
@@ -517,6 +585,14 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->type == T_FILE){
+    acquire(&icache.lock);
+    busy = ip->ntext > 0;
+    release(&icache.lock);
+    if(busy)
+      return -1;  // a running program's text (ETXTBSY)
+    textinval(ip);
+  }
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -574,23 +650,26 @@ dirlookup(struct inode *dp, char *name, uint *poff)
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  int off, empty;
   struct dirent de;
-  struct inode *ip;
 
-  // Check that name is not present.
-  if((ip = dirlookup(dp, name, 0)) != 0){
-    iput(ip);
-    return -1;
-  }
-
-  // Look for an empty dirent.
+  // Check that name is not present, and look for an empty
+  // dirent.  (Not with dirlookup, which needs a free inode
+  // cache entry to report a match.)
+  empty = -1;
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlink read");
-    if(de.inum == 0)
-      break;
+    if(de.inum == 0){
+      if(empty < 0)
+        empty = off;
+      continue;
+    }
+    if(namecmp(name, de.name) == 0)
+      return -1;
   }
+  if(empty >= 0)
+    off = empty;
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
@@ -649,9 +728,10 @@ namex(char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
 
-  if(*path == '/')
-    ip = iget(ROOTDEV, ROOTINO);
-  else
+  if(*path == '/'){
+    if((ip = iget(ROOTDEV, ROOTINO)) == 0)
+      return 0;
+  } else
     ip = idup(myproc()->cwd);
 
   while((path = skipelem(path, name)) != 0){
@@ -0,0 +1,2098 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 51 06 00 00       	call   6ab <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 55 06 00 00       	call   6c3 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 e8 0d 00 00       	push   $0xde8
+  7f:	6a 01                	push   $0x1
+  81:	e8 fa 07 00 00       	call   880 <printf>
+      exit();
+  86:	e8 f8 05 00 00       	call   683 <exit>
+  }
+  exit();
+  8b:	e8 f3 05 00 00       	call   683 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 c8 0d 00 00       	push   $0xdc8
+  97:	6a 02                	push   $0x2
+  99:	e8 e2 07 00 00       	call   880 <printf>
+    exit();
+  9e:	e8 e0 05 00 00       	call   683 <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 d1 05 00 00       	call   683 <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 00 13 00 00    	lea    0x1300(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 6e 04 00 00       	call   69b <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf 00 13 00 00       	mov    $0x1300,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 00 13 00 00 00 	movb   $0x0,0x1300(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 ec 03 00 00       	call   6a3 <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff 00 13 00 00    	cmp    $0x1300,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d 00 13 00 00       	sub    $0x1300,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 00 13 00 00       	push   $0x1300
+ 31c:	e8 2f 03 00 00       	call   650 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 be 01 00 00       	call   69b <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 91 01 00 00       	call   6c3 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 94 01 00 00       	call   6db <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 5a 01 00 00       	call   6ab <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	56                   	push   %esi
+ 574:	53                   	push   %ebx
+ 575:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 578:	0f b6 02             	movzbl (%edx),%eax
+ 57b:	3c 20                	cmp    $0x20,%al
+ 57d:	75 0c                	jne    58b <atoi+0x1b>
+ 57f:	90                   	nop
+ 580:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 584:	83 c2 01             	add    $0x1,%edx
+ 587:	3c 20                	cmp    $0x20,%al
+ 589:	74 f5                	je     580 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 58b:	3c 2d                	cmp    $0x2d,%al
+ 58d:	74 41                	je     5d0 <atoi+0x60>
+ 58f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 594:	3c 2b                	cmp    $0x2b,%al
+ 596:	74 3d                	je     5d5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 598:	0f be 0a             	movsbl (%edx),%ecx
+ 59b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 59e:	3c 09                	cmp    $0x9,%al
+ 5a0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 5a5:	77 21                	ja     5c8 <atoi+0x58>
+ 5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5b0:	83 c2 01             	add    $0x1,%edx
+ 5b3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 5b6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 5ba:	0f be 0a             	movsbl (%edx),%ecx
+ 5bd:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 5c0:	80 fb 09             	cmp    $0x9,%bl
+ 5c3:	76 eb                	jbe    5b0 <atoi+0x40>
+  return sign*n;
+ 5c5:	0f af c6             	imul   %esi,%eax
+}
+ 5c8:	5b                   	pop    %ebx
+ 5c9:	5e                   	pop    %esi
+ 5ca:	5d                   	pop    %ebp
+ 5cb:	c3                   	ret
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 5d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 5d5:	83 c2 01             	add    $0x1,%edx
+ 5d8:	eb be                	jmp    598 <atoi+0x28>
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005e0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	56                   	push   %esi
+ 5e4:	53                   	push   %ebx
+ 5e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 5e8:	0f b6 02             	movzbl (%edx),%eax
+ 5eb:	3c 20                	cmp    $0x20,%al
+ 5ed:	75 0c                	jne    5fb <atoo+0x1b>
+ 5ef:	90                   	nop
+ 5f0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 5f4:	83 c2 01             	add    $0x1,%edx
+ 5f7:	3c 20                	cmp    $0x20,%al
+ 5f9:	74 f5                	je     5f0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 5fb:	3c 2d                	cmp    $0x2d,%al
+ 5fd:	74 41                	je     640 <atoo+0x60>
+ 5ff:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 604:	3c 2b                	cmp    $0x2b,%al
+ 606:	74 3d                	je     645 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 608:	0f be 0a             	movsbl (%edx),%ecx
+ 60b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 60e:	3c 07                	cmp    $0x7,%al
+ 610:	b8 00 00 00 00       	mov    $0x0,%eax
+ 615:	77 1e                	ja     635 <atoo+0x55>
+ 617:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 620:	83 c2 01             	add    $0x1,%edx
+ 623:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 627:	0f be 0a             	movsbl (%edx),%ecx
+ 62a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 62d:	80 fb 07             	cmp    $0x7,%bl
+ 630:	76 ee                	jbe    620 <atoo+0x40>
+  return sign*n;
+ 632:	0f af c6             	imul   %esi,%eax
+}
+ 635:	5b                   	pop    %ebx
+ 636:	5e                   	pop    %esi
+ 637:	5d                   	pop    %ebp
+ 638:	c3                   	ret
+ 639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 640:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 645:	83 c2 01             	add    $0x1,%edx
+ 648:	eb be                	jmp    608 <atoo+0x28>
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000650 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	8b 45 10             	mov    0x10(%ebp),%eax
+ 658:	8b 55 08             	mov    0x8(%ebp),%edx
+ 65b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 65e:	85 c0                	test   %eax,%eax
+ 660:	7e 13                	jle    675 <memmove+0x25>
+ 662:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 664:	89 d7                	mov    %edx,%edi
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 670:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 671:	39 f8                	cmp    %edi,%eax
+ 673:	75 fb                	jne    670 <memmove+0x20>
+  return vdst;
+}
+ 675:	5e                   	pop    %esi
+ 676:	89 d0                	mov    %edx,%eax
+ 678:	5f                   	pop    %edi
+ 679:	5d                   	pop    %ebp
+ 67a:	c3                   	ret
+
+0000067b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 67b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <exit>:
+SYSCALL(exit)
+ 683:	b8 02 00 00 00       	mov    $0x2,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <wait>:
+SYSCALL(wait)
+ 68b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <pipe>:
+SYSCALL(pipe)
+ 693:	b8 04 00 00 00       	mov    $0x4,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <read>:
+SYSCALL(read)
+ 69b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <write>:
+SYSCALL(write)
+ 6a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <close>:
+SYSCALL(close)
+ 6ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <kill>:
+SYSCALL(kill)
+ 6b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <exec>:
+SYSCALL(exec)
+ 6bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <open>:
+SYSCALL(open)
+ 6c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mknod>:
+SYSCALL(mknod)
+ 6cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <unlink>:
+SYSCALL(unlink)
+ 6d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <fstat>:
+SYSCALL(fstat)
+ 6db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <link>:
+SYSCALL(link)
+ 6e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <mkdir>:
+SYSCALL(mkdir)
+ 6eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <chdir>:
+SYSCALL(chdir)
+ 6f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <dup>:
+SYSCALL(dup)
+ 6fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <getpid>:
+SYSCALL(getpid)
+ 703:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <sbrk>:
+SYSCALL(sbrk)
+ 70b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <sleep>:
+SYSCALL(sleep)
+ 713:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <uptime>:
+SYSCALL(uptime)
+ 71b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <superpages>:
+SYSCALL(superpages)
+ 723:	b8 23 00 00 00       	mov    $0x23,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <mmap>:
+SYSCALL(mmap)
+ 72b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <munmap>:
+SYSCALL(munmap)
+ 733:	b8 25 00 00 00       	mov    $0x25,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <spawn>:
+SYSCALL(spawn)
+ 73b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <swapstat>:
+SYSCALL(swapstat)
+ 743:	b8 27 00 00 00       	mov    $0x27,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 74b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <iostat>:
+SYSCALL(iostat)
+ 753:	b8 29 00 00 00       	mov    $0x29,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <dropcache>:
+SYSCALL(dropcache)
+ 75b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <iosched>:
+SYSCALL(iosched)
+ 763:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <halt>:
+SYSCALL(halt)
+ 76b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <date>:
+SYSCALL(date)
+ 773:	b8 17 00 00 00       	mov    $0x17,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 77b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <getgid>:
+SYSCALL(getgid)
+ 783:	b8 19 00 00 00       	mov    $0x19,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <getppid>:
+SYSCALL(getppid)
+ 78b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <setuid>:
+SYSCALL(setuid)
+ 793:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <setgid>:
+SYSCALL(setgid)
+ 79b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <getprocs>:
+SYSCALL(getprocs)
+ 7a3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 7ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <getpriority>:
+SYSCALL(getpriority)
+ 7b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 7bb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <chown>:
+SYSCALL(chown)
+ 7c3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <chgrp>:
+SYSCALL(chgrp)
+ 7cb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+ 7d3:	66 90                	xchg   %ax,%ax
+ 7d5:	66 90                	xchg   %ax,%ax
+ 7d7:	66 90                	xchg   %ax,%ax
+ 7d9:	66 90                	xchg   %ax,%ax
+ 7db:	66 90                	xchg   %ax,%ax
+ 7dd:	66 90                	xchg   %ax,%ax
+ 7df:	90                   	nop
+
+000007e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	56                   	push   %esi
+ 7e5:	53                   	push   %ebx
+ 7e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7e8:	89 d1                	mov    %edx,%ecx
+{
+ 7ea:	83 ec 3c             	sub    $0x3c,%esp
+ 7ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7f0:	85 d2                	test   %edx,%edx
+ 7f2:	0f 89 80 00 00 00    	jns    878 <printint+0x98>
+ 7f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7fc:	74 7a                	je     878 <printint+0x98>
+    x = -xx;
+ 7fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 800:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 805:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 808:	31 f6                	xor    %esi,%esi
+ 80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 810:	89 c8                	mov    %ecx,%eax
+ 812:	31 d2                	xor    %edx,%edx
+ 814:	89 f7                	mov    %esi,%edi
+ 816:	f7 f3                	div    %ebx
+ 818:	8d 76 01             	lea    0x1(%esi),%esi
+ 81b:	0f b6 92 60 0e 00 00 	movzbl 0xe60(%edx),%edx
+ 822:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 826:	89 ca                	mov    %ecx,%edx
+ 828:	89 c1                	mov    %eax,%ecx
+ 82a:	39 da                	cmp    %ebx,%edx
+ 82c:	73 e2                	jae    810 <printint+0x30>
+  if(neg)
+ 82e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 831:	85 c0                	test   %eax,%eax
+ 833:	74 07                	je     83c <printint+0x5c>
+    buf[i++] = '-';
+ 835:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 83a:	89 f7                	mov    %esi,%edi
+ 83c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 83f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 842:	01 df                	add    %ebx,%edi
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 848:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 84b:	83 ec 04             	sub    $0x4,%esp
+ 84e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 851:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 854:	6a 01                	push   $0x1
+ 856:	50                   	push   %eax
+ 857:	56                   	push   %esi
+ 858:	e8 46 fe ff ff       	call   6a3 <write>
+  while(--i >= 0)
+ 85d:	89 f8                	mov    %edi,%eax
+ 85f:	83 c4 10             	add    $0x10,%esp
+ 862:	83 ef 01             	sub    $0x1,%edi
+ 865:	39 d8                	cmp    %ebx,%eax
+ 867:	75 df                	jne    848 <printint+0x68>
+}
+ 869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 86c:	5b                   	pop    %ebx
+ 86d:	5e                   	pop    %esi
+ 86e:	5f                   	pop    %edi
+ 86f:	5d                   	pop    %ebp
+ 870:	c3                   	ret
+ 871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 878:	31 c0                	xor    %eax,%eax
+ 87a:	eb 89                	jmp    805 <printint+0x25>
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000880 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 889:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 88c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 88f:	0f b6 1e             	movzbl (%esi),%ebx
+ 892:	83 c6 01             	add    $0x1,%esi
+ 895:	84 db                	test   %bl,%bl
+ 897:	74 67                	je     900 <printf+0x80>
+ 899:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 89c:	31 d2                	xor    %edx,%edx
+ 89e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8a1:	eb 34                	jmp    8d7 <printf+0x57>
+ 8a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8a7:	90                   	nop
+ 8a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8b0:	83 f8 25             	cmp    $0x25,%eax
+ 8b3:	74 18                	je     8cd <printf+0x4d>
+  write(fd, &c, 1);
+ 8b5:	83 ec 04             	sub    $0x4,%esp
+ 8b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8be:	6a 01                	push   $0x1
+ 8c0:	50                   	push   %eax
+ 8c1:	57                   	push   %edi
+ 8c2:	e8 dc fd ff ff       	call   6a3 <write>
+ 8c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 8d0:	83 c6 01             	add    $0x1,%esi
+ 8d3:	84 db                	test   %bl,%bl
+ 8d5:	74 29                	je     900 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8da:	85 d2                	test   %edx,%edx
+ 8dc:	74 ca                	je     8a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8de:	83 fa 25             	cmp    $0x25,%edx
+ 8e1:	75 ea                	jne    8cd <printf+0x4d>
+      if(c == 'd'){
+ 8e3:	83 f8 25             	cmp    $0x25,%eax
+ 8e6:	0f 84 24 01 00 00    	je     a10 <printf+0x190>
+ 8ec:	83 e8 63             	sub    $0x63,%eax
+ 8ef:	83 f8 15             	cmp    $0x15,%eax
+ 8f2:	77 1c                	ja     910 <printf+0x90>
+ 8f4:	ff 24 85 08 0e 00 00 	jmp    *0xe08(,%eax,4)
+ 8fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 903:	5b                   	pop    %ebx
+ 904:	5e                   	pop    %esi
+ 905:	5f                   	pop    %edi
+ 906:	5d                   	pop    %ebp
+ 907:	c3                   	ret
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 916:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 91a:	6a 01                	push   $0x1
+ 91c:	52                   	push   %edx
+ 91d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 920:	57                   	push   %edi
+ 921:	e8 7d fd ff ff       	call   6a3 <write>
+ 926:	83 c4 0c             	add    $0xc,%esp
+ 929:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 92c:	6a 01                	push   $0x1
+ 92e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 931:	52                   	push   %edx
+ 932:	57                   	push   %edi
+ 933:	e8 6b fd ff ff       	call   6a3 <write>
+        putc(fd, c);
+ 938:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 93b:	31 d2                	xor    %edx,%edx
+ 93d:	eb 8e                	jmp    8cd <printf+0x4d>
+ 93f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 940:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 94b:	8b 13                	mov    (%ebx),%edx
+ 94d:	6a 00                	push   $0x0
+ 94f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 951:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 954:	e8 87 fe ff ff       	call   7e0 <printint>
+        ap++;
+ 959:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 95c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 95f:	31 d2                	xor    %edx,%edx
+ 961:	e9 67 ff ff ff       	jmp    8cd <printf+0x4d>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 970:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 973:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 975:	83 c0 04             	add    $0x4,%eax
+ 978:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 97b:	85 db                	test   %ebx,%ebx
+ 97d:	0f 84 9d 00 00 00    	je     a20 <printf+0x1a0>
+        while(*s != 0){
+ 983:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 986:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 988:	84 c0                	test   %al,%al
+ 98a:	0f 84 3d ff ff ff    	je     8cd <printf+0x4d>
+ 990:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 993:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 996:	89 de                	mov    %ebx,%esi
+ 998:	89 d3                	mov    %edx,%ebx
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	53                   	push   %ebx
+ 9ac:	57                   	push   %edi
+ 9ad:	e8 f1 fc ff ff       	call   6a3 <write>
+        while(*s != 0){
+ 9b2:	0f b6 06             	movzbl (%esi),%eax
+ 9b5:	83 c4 10             	add    $0x10,%esp
+ 9b8:	84 c0                	test   %al,%al
+ 9ba:	75 e4                	jne    9a0 <printf+0x120>
+      state = 0;
+ 9bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9bf:	31 d2                	xor    %edx,%edx
+ 9c1:	e9 07 ff ff ff       	jmp    8cd <printf+0x4d>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9db:	8b 13                	mov    (%ebx),%edx
+ 9dd:	6a 01                	push   $0x1
+ 9df:	e9 6b ff ff ff       	jmp    94f <printf+0xcf>
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9eb:	83 ec 04             	sub    $0x4,%esp
+ 9ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9f9:	6a 01                	push   $0x1
+ 9fb:	52                   	push   %edx
+ 9fc:	57                   	push   %edi
+ 9fd:	e8 a1 fc ff ff       	call   6a3 <write>
+        ap++;
+ a02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a08:	31 d2                	xor    %edx,%edx
+ a0a:	e9 be fe ff ff       	jmp    8cd <printf+0x4d>
+ a0f:	90                   	nop
+  write(fd, &c, 1);
+ a10:	83 ec 04             	sub    $0x4,%esp
+ a13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a19:	6a 01                	push   $0x1
+ a1b:	e9 11 ff ff ff       	jmp    931 <printf+0xb1>
+ a20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a25:	bb fe 0d 00 00       	mov    $0xdfe,%ebx
+ a2a:	e9 61 ff ff ff       	jmp    990 <printf+0x110>
+ a2f:	90                   	nop
+
+00000a30 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a33:	a1 24 17 00 00       	mov    0x1724,%eax
+{
+ a38:	89 e5                	mov    %esp,%ebp
+ a3a:	56                   	push   %esi
+ a3b:	53                   	push   %ebx
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a40:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a42:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a44:	39 ca                	cmp    %ecx,%edx
+ a46:	73 30                	jae    a78 <lfree+0x48>
+ a48:	39 c1                	cmp    %eax,%ecx
+ a4a:	72 04                	jb     a50 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a4c:	39 c2                	cmp    %eax,%edx
+ a4e:	72 f0                	jb     a40 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a50:	8b 59 04             	mov    0x4(%ecx),%ebx
+ a53:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ a56:	39 f0                	cmp    %esi,%eax
+ a58:	74 26                	je     a80 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a5a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a5c:	8b 42 04             	mov    0x4(%edx),%eax
+ a5f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a62:	39 d9                	cmp    %ebx,%ecx
+ a64:	74 30                	je     a96 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a66:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a68:	5b                   	pop    %ebx
+  freep = p;
+ a69:	89 15 24 17 00 00    	mov    %edx,0x1724
+}
+ a6f:	5e                   	pop    %esi
+ a70:	5d                   	pop    %ebp
+ a71:	c3                   	ret
+ a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a78:	39 c1                	cmp    %eax,%ecx
+ a7a:	72 d0                	jb     a4c <lfree+0x1c>
+ a7c:	eb c2                	jmp    a40 <lfree+0x10>
+ a7e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ a80:	03 58 04             	add    0x4(%eax),%ebx
+ a83:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a86:	8b 02                	mov    (%edx),%eax
+ a88:	8b 00                	mov    (%eax),%eax
+ a8a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ a8c:	8b 42 04             	mov    0x4(%edx),%eax
+ a8f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a92:	39 d9                	cmp    %ebx,%ecx
+ a94:	75 d0                	jne    a66 <lfree+0x36>
+    p->s.size += bp->s.size;
+ a96:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ a99:	89 15 24 17 00 00    	mov    %edx,0x1724
+    p->s.size += bp->s.size;
+ a9f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ aa2:	8b 09                	mov    (%ecx),%ecx
+ aa4:	89 0a                	mov    %ecx,(%edx)
+}
+ aa6:	5b                   	pop    %ebx
+ aa7:	5e                   	pop    %esi
+ aa8:	5d                   	pop    %ebp
+ aa9:	c3                   	ret
+ aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ab0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	57                   	push   %edi
+ ab4:	89 c7                	mov    %eax,%edi
+ ab6:	56                   	push   %esi
+ ab7:	53                   	push   %ebx
+ ab8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ abb:	a1 24 17 00 00       	mov    0x1724,%eax
+ ac0:	85 c0                	test   %eax,%eax
+ ac2:	0f 84 88 00 00 00    	je     b50 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ac8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ aca:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ acd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ad2:	39 df                	cmp    %ebx,%edi
+ ad4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ad7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ ade:	39 f9                	cmp    %edi,%ecx
+ ae0:	72 0f                	jb     af1 <lalloc+0x41>
+ ae2:	eb 4c                	jmp    b30 <lalloc+0x80>
+ ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ae8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ aea:	8b 4a 04             	mov    0x4(%edx),%ecx
+ aed:	39 f9                	cmp    %edi,%ecx
+ aef:	73 3f                	jae    b30 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ af1:	89 d0                	mov    %edx,%eax
+ af3:	39 15 24 17 00 00    	cmp    %edx,0x1724
+ af9:	75 ed                	jne    ae8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ afb:	83 ec 0c             	sub    $0xc,%esp
+ afe:	56                   	push   %esi
+ aff:	e8 07 fc ff ff       	call   70b <sbrk>
+  if(p == (char*)-1)
+ b04:	83 c4 10             	add    $0x10,%esp
+ b07:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b0a:	74 11                	je     b1d <lalloc+0x6d>
+  hp->s.size = nu;
+ b0c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ b0f:	e8 1c ff ff ff       	call   a30 <lfree>
+  return freep;
+ b14:	a1 24 17 00 00       	mov    0x1724,%eax
+      if((p = morecore(nunits)) == 0)
+ b19:	85 c0                	test   %eax,%eax
+ b1b:	75 cb                	jne    ae8 <lalloc+0x38>
+        return 0;
+  }
+}
+ b1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b20:	31 d2                	xor    %edx,%edx
+}
+ b22:	5b                   	pop    %ebx
+ b23:	89 d0                	mov    %edx,%eax
+ b25:	5e                   	pop    %esi
+ b26:	5f                   	pop    %edi
+ b27:	5d                   	pop    %ebp
+ b28:	c3                   	ret
+ b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ b30:	39 cf                	cmp    %ecx,%edi
+ b32:	74 4c                	je     b80 <lalloc+0xd0>
+        p->s.size -= nunits;
+ b34:	29 f9                	sub    %edi,%ecx
+ b36:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ b39:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ b3c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ b3f:	a3 24 17 00 00       	mov    %eax,0x1724
+}
+ b44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b47:	89 d0                	mov    %edx,%eax
+ b49:	5b                   	pop    %ebx
+ b4a:	5e                   	pop    %esi
+ b4b:	5f                   	pop    %edi
+ b4c:	5d                   	pop    %ebp
+ b4d:	c3                   	ret
+ b4e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ b50:	ba 28 17 00 00       	mov    $0x1728,%edx
+ b55:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ b57:	c7 05 24 17 00 00 28 	movl   $0x1728,0x1724
+ b5e:	17 00 00 
+ b61:	c7 05 28 17 00 00 28 	movl   $0x1728,0x1728
+ b68:	17 00 00 
+ b6b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ b6d:	c7 05 2c 17 00 00 00 	movl   $0x0,0x172c
+ b74:	00 00 00 
+ b77:	e9 51 ff ff ff       	jmp    acd <lalloc+0x1d>
+ b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ b80:	8b 0a                	mov    (%edx),%ecx
+ b82:	89 08                	mov    %ecx,(%eax)
+ b84:	eb b9                	jmp    b3f <lalloc+0x8f>
+ b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b90 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ b90:	55                   	push   %ebp
+ b91:	89 e5                	mov    %esp,%ebp
+ b93:	57                   	push   %edi
+ b94:	56                   	push   %esi
+ b95:	53                   	push   %ebx
+ b96:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ b99:	85 f6                	test   %esi,%esi
+ b9b:	74 42                	je     bdf <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ b9d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ ba0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ ba3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ ba9:	77 3d                	ja     be8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ bab:	31 c9                	xor    %ecx,%ecx
+ bad:	bb 01 00 00 00       	mov    $0x1,%ebx
+ bb2:	83 fa 02             	cmp    $0x2,%edx
+ bb5:	74 17                	je     bce <free+0x3e>
+ bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbe:	66 90                	xchg   %ax,%ax
+ bc0:	83 c1 01             	add    $0x1,%ecx
+ bc3:	89 d8                	mov    %ebx,%eax
+ bc5:	d3 e0                	shl    %cl,%eax
+ bc7:	83 c0 01             	add    $0x1,%eax
+ bca:	39 c2                	cmp    %eax,%edx
+ bcc:	75 f2                	jne    bc0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ bce:	8b 04 8d 00 17 00 00 	mov    0x1700(,%ecx,4),%eax
+  classes[c] = bp;
+ bd5:	89 3c 8d 00 17 00 00 	mov    %edi,0x1700(,%ecx,4)
+  bp->s.ptr = classes[c];
+ bdc:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ bdf:	5b                   	pop    %ebx
+ be0:	5e                   	pop    %esi
+ be1:	5f                   	pop    %edi
+ be2:	5d                   	pop    %ebp
+ be3:	c3                   	ret
+ be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ be8:	5b                   	pop    %ebx
+    lfree(bp);
+ be9:	89 f8                	mov    %edi,%eax
+}
+ beb:	5e                   	pop    %esi
+ bec:	5f                   	pop    %edi
+ bed:	5d                   	pop    %ebp
+    lfree(bp);
+ bee:	e9 3d fe ff ff       	jmp    a30 <lfree>
+ bf3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c00 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c00:	55                   	push   %ebp
+ c01:	89 e5                	mov    %esp,%ebp
+ c03:	57                   	push   %edi
+ c04:	56                   	push   %esi
+ c05:	53                   	push   %ebx
+ c06:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c09:	8b 45 08             	mov    0x8(%ebp),%eax
+ c0c:	83 c0 07             	add    $0x7,%eax
+ c0f:	c1 e8 03             	shr    $0x3,%eax
+ c12:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ c15:	3d 01 01 00 00       	cmp    $0x101,%eax
+ c1a:	77 44                	ja     c60 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ c1c:	31 c9                	xor    %ecx,%ecx
+ c1e:	ba 01 00 00 00       	mov    $0x1,%edx
+ c23:	bb 02 00 00 00       	mov    $0x2,%ebx
+ c28:	83 f8 02             	cmp    $0x2,%eax
+ c2b:	76 11                	jbe    c3e <malloc+0x3e>
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+ c30:	83 c1 01             	add    $0x1,%ecx
+ c33:	89 d3                	mov    %edx,%ebx
+ c35:	d3 e3                	shl    %cl,%ebx
+ c37:	83 c3 01             	add    $0x1,%ebx
+ c3a:	39 c3                	cmp    %eax,%ebx
+ c3c:	72 f2                	jb     c30 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ c3e:	8b 04 8d 00 17 00 00 	mov    0x1700(,%ecx,4),%eax
+ c45:	85 c0                	test   %eax,%eax
+ c47:	74 2f                	je     c78 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ c49:	8b 10                	mov    (%eax),%edx
+ c4b:	89 14 8d 00 17 00 00 	mov    %edx,0x1700(,%ecx,4)
+  return (void*)(p + 1);
+ c52:	83 c0 08             	add    $0x8,%eax
+}
+ c55:	83 c4 1c             	add    $0x1c,%esp
+ c58:	5b                   	pop    %ebx
+ c59:	5e                   	pop    %esi
+ c5a:	5f                   	pop    %edi
+ c5b:	5d                   	pop    %ebp
+ c5c:	c3                   	ret
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ c60:	e8 4b fe ff ff       	call   ab0 <lalloc>
+ c65:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ c67:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ c6a:	85 d2                	test   %edx,%edx
+ c6c:	75 e7                	jne    c55 <malloc+0x55>
+      return 0;
+ c6e:	31 c0                	xor    %eax,%eax
+ c70:	eb e3                	jmp    c55 <malloc+0x55>
+ c72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ c78:	31 d2                	xor    %edx,%edx
+ c7a:	b8 00 02 00 00       	mov    $0x200,%eax
+ c7f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ c82:	f7 f3                	div    %ebx
+  if(n < 4)
+ c84:	ba 04 00 00 00       	mov    $0x4,%edx
+ c89:	89 d6                	mov    %edx,%esi
+ c8b:	39 d0                	cmp    %edx,%eax
+ c8d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ c90:	0f af f3             	imul   %ebx,%esi
+ c93:	89 f0                	mov    %esi,%eax
+ c95:	e8 16 fe ff ff       	call   ab0 <lalloc>
+ c9a:	85 c0                	test   %eax,%eax
+ c9c:	74 d0                	je     c6e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ c9e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ ca1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ ca4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cab:	8b 14 8d 00 17 00 00 	mov    0x1700(,%ecx,4),%edx
+ cb2:	39 f8                	cmp    %edi,%eax
+ cb4:	73 22                	jae    cd8 <malloc+0xd8>
+ cb6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ cb9:	eb 09                	jmp    cc4 <malloc+0xc4>
+ cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cbf:	90                   	nop
+ cc0:	89 c2                	mov    %eax,%edx
+ cc2:	89 c8                	mov    %ecx,%eax
+ cc4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ cc7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ cca:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ ccc:	39 f9                	cmp    %edi,%ecx
+ cce:	72 f0                	jb     cc0 <malloc+0xc0>
+ cd0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ cd3:	e9 73 ff ff ff       	jmp    c4b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ cd8:	89 d0                	mov    %edx,%eax
+ cda:	8b 12                	mov    (%edx),%edx
+ cdc:	e9 6a ff ff ff       	jmp    c4b <malloc+0x4b>
+ ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cef:	90                   	nop
+
+00000cf0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ cf0:	55                   	push   %ebp
+ cf1:	89 e5                	mov    %esp,%ebp
+ cf3:	56                   	push   %esi
+ cf4:	53                   	push   %ebx
+ cf5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ cf8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ cfb:	85 c9                	test   %ecx,%ecx
+ cfd:	74 06                	je     d05 <calloc+0x15>
+ cff:	89 c8                	mov    %ecx,%eax
+ d01:	f7 e3                	mul    %ebx
+ d03:	70 33                	jo     d38 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ d05:	0f af d9             	imul   %ecx,%ebx
+ d08:	83 ec 0c             	sub    $0xc,%esp
+ d0b:	53                   	push   %ebx
+ d0c:	e8 ef fe ff ff       	call   c00 <malloc>
+ d11:	83 c4 10             	add    $0x10,%esp
+ d14:	89 c6                	mov    %eax,%esi
+ d16:	85 c0                	test   %eax,%eax
+ d18:	74 1e                	je     d38 <calloc+0x48>
+    memset(p, 0, n * size);
+ d1a:	83 ec 04             	sub    $0x4,%esp
+ d1d:	53                   	push   %ebx
+ d1e:	6a 00                	push   $0x0
+ d20:	50                   	push   %eax
+ d21:	e8 3a f7 ff ff       	call   460 <memset>
+ d26:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ d29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d2c:	89 f0                	mov    %esi,%eax
+ d2e:	5b                   	pop    %ebx
+ d2f:	5e                   	pop    %esi
+ d30:	5d                   	pop    %ebp
+ d31:	c3                   	ret
+ d32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ d38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ d3b:	31 f6                	xor    %esi,%esi
+}
+ d3d:	89 f0                	mov    %esi,%eax
+ d3f:	5b                   	pop    %ebx
+ d40:	5e                   	pop    %esi
+ d41:	5d                   	pop    %ebp
+ d42:	c3                   	ret
+ d43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d50 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	57                   	push   %edi
+ d54:	56                   	push   %esi
+ d55:	53                   	push   %ebx
+ d56:	83 ec 0c             	sub    $0xc,%esp
+ d59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ d5f:	85 db                	test   %ebx,%ebx
+ d61:	74 55                	je     db8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ d63:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ d66:	89 de                	mov    %ebx,%esi
+ d68:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ d6f:	39 c7                	cmp    %eax,%edi
+ d71:	72 0d                	jb     d80 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ d73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d76:	89 f0                	mov    %esi,%eax
+ d78:	5b                   	pop    %ebx
+ d79:	5e                   	pop    %esi
+ d7a:	5f                   	pop    %edi
+ d7b:	5d                   	pop    %ebp
+ d7c:	c3                   	ret
+ d7d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ d80:	83 ec 0c             	sub    $0xc,%esp
+ d83:	50                   	push   %eax
+ d84:	e8 77 fe ff ff       	call   c00 <malloc>
+ d89:	83 c4 10             	add    $0x10,%esp
+ d8c:	89 c6                	mov    %eax,%esi
+ d8e:	85 c0                	test   %eax,%eax
+ d90:	74 e1                	je     d73 <realloc+0x23>
+  memmove(p, ap, have);
+ d92:	83 ec 04             	sub    $0x4,%esp
+ d95:	57                   	push   %edi
+ d96:	53                   	push   %ebx
+ d97:	50                   	push   %eax
+ d98:	e8 b3 f8 ff ff       	call   650 <memmove>
+  free(ap);
+ d9d:	89 1c 24             	mov    %ebx,(%esp)
+ da0:	e8 eb fd ff ff       	call   b90 <free>
+  return p;
+ da5:	83 c4 10             	add    $0x10,%esp
+}
+ da8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dab:	89 f0                	mov    %esi,%eax
+ dad:	5b                   	pop    %ebx
+ dae:	5e                   	pop    %esi
+ daf:	5f                   	pop    %edi
+ db0:	5d                   	pop    %ebp
+ db1:	c3                   	ret
+ db2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ db8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ dbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dbe:	5b                   	pop    %ebx
+ dbf:	5e                   	pop    %esi
+ dc0:	5f                   	pop    %edi
+ dc1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ dc2:	e9 39 fe ff ff       	jmp    c00 <malloc>
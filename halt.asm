@@ -0,0 +1,1626 @@
+
+_halt:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// halt the system.
+#include "types.h"
+#include "user.h"
+
+int
+main(void) {
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  halt();
+   6:	e8 d0 03 00 00       	call   3db <halt>
+  exit();
+   b:	e8 e3 02 00 00       	call   2f3 <exit>
+
+00000010 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  10:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  11:	31 c0                	xor    %eax,%eax
+{
+  13:	89 e5                	mov    %esp,%ebp
+  15:	53                   	push   %ebx
+  16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  20:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  24:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  27:	83 c0 01             	add    $0x1,%eax
+  2a:	84 d2                	test   %dl,%dl
+  2c:	75 f2                	jne    20 <strcpy+0x10>
+    ;
+  return os;
+}
+  2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  31:	89 c8                	mov    %ecx,%eax
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  44:	8b 55 08             	mov    0x8(%ebp),%edx
+  47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  4a:	0f b6 02             	movzbl (%edx),%eax
+  4d:	84 c0                	test   %al,%al
+  4f:	75 17                	jne    68 <strcmp+0x28>
+  51:	eb 3a                	jmp    8d <strcmp+0x4d>
+  53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  57:	90                   	nop
+  58:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  5c:	83 c2 01             	add    $0x1,%edx
+  5f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  62:	84 c0                	test   %al,%al
+  64:	74 1a                	je     80 <strcmp+0x40>
+    p++, q++;
+  66:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  68:	0f b6 19             	movzbl (%ecx),%ebx
+  6b:	38 c3                	cmp    %al,%bl
+  6d:	74 e9                	je     58 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  6f:	29 d8                	sub    %ebx,%eax
+}
+  71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  74:	c9                   	leave
+  75:	c3                   	ret
+  76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  80:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  84:	31 c0                	xor    %eax,%eax
+  86:	29 d8                	sub    %ebx,%eax
+}
+  88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8b:	c9                   	leave
+  8c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  8d:	0f b6 19             	movzbl (%ecx),%ebx
+  90:	31 c0                	xor    %eax,%eax
+  92:	eb db                	jmp    6f <strcmp+0x2f>
+  94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  9f:	90                   	nop
+
+000000a0 <strlen>:
+
+uint
+strlen(char *s)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  a6:	80 3a 00             	cmpb   $0x0,(%edx)
+  a9:	74 15                	je     c0 <strlen+0x20>
+  ab:	31 c0                	xor    %eax,%eax
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+  b0:	83 c0 01             	add    $0x1,%eax
+  b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  b7:	89 c1                	mov    %eax,%ecx
+  b9:	75 f5                	jne    b0 <strlen+0x10>
+    ;
+  return n;
+}
+  bb:	89 c8                	mov    %ecx,%eax
+  bd:	5d                   	pop    %ebp
+  be:	c3                   	ret
+  bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+  c0:	31 c9                	xor    %ecx,%ecx
+}
+  c2:	5d                   	pop    %ebp
+  c3:	89 c8                	mov    %ecx,%eax
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	57                   	push   %edi
+  d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  dd:	89 d7                	mov    %edx,%edi
+  df:	fc                   	cld
+  e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  e5:	89 d0                	mov    %edx,%eax
+  e7:	c9                   	leave
+  e8:	c3                   	ret
+  e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  fa:	0f b6 10             	movzbl (%eax),%edx
+  fd:	84 d2                	test   %dl,%dl
+  ff:	75 12                	jne    113 <strchr+0x23>
+ 101:	eb 1d                	jmp    120 <strchr+0x30>
+ 103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 107:	90                   	nop
+ 108:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 10c:	83 c0 01             	add    $0x1,%eax
+ 10f:	84 d2                	test   %dl,%dl
+ 111:	74 0d                	je     120 <strchr+0x30>
+    if(*s == c)
+ 113:	38 d1                	cmp    %dl,%cl
+ 115:	75 f1                	jne    108 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 117:	5d                   	pop    %ebp
+ 118:	c3                   	ret
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 120:	31 c0                	xor    %eax,%eax
+}
+ 122:	5d                   	pop    %ebp
+ 123:	c3                   	ret
+ 124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+
+00000130 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 135:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 138:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 139:	31 db                	xor    %ebx,%ebx
+{
+ 13b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 13e:	eb 27                	jmp    167 <gets+0x37>
+    cc = read(0, &c, 1);
+ 140:	83 ec 04             	sub    $0x4,%esp
+ 143:	6a 01                	push   $0x1
+ 145:	56                   	push   %esi
+ 146:	6a 00                	push   $0x0
+ 148:	e8 be 01 00 00       	call   30b <read>
+    if(cc < 1)
+ 14d:	83 c4 10             	add    $0x10,%esp
+ 150:	85 c0                	test   %eax,%eax
+ 152:	7e 1d                	jle    171 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 154:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 158:	8b 55 08             	mov    0x8(%ebp),%edx
+ 15b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 15f:	3c 0a                	cmp    $0xa,%al
+ 161:	74 10                	je     173 <gets+0x43>
+ 163:	3c 0d                	cmp    $0xd,%al
+ 165:	74 0c                	je     173 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 167:	89 df                	mov    %ebx,%edi
+ 169:	83 c3 01             	add    $0x1,%ebx
+ 16c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 16f:	7c cf                	jl     140 <gets+0x10>
+ 171:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 173:	8b 45 08             	mov    0x8(%ebp),%eax
+ 176:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 17a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 17d:	5b                   	pop    %ebx
+ 17e:	5e                   	pop    %esi
+ 17f:	5f                   	pop    %edi
+ 180:	5d                   	pop    %ebp
+ 181:	c3                   	ret
+ 182:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 195:	83 ec 08             	sub    $0x8,%esp
+ 198:	6a 00                	push   $0x0
+ 19a:	ff 75 08             	push   0x8(%ebp)
+ 19d:	e8 91 01 00 00       	call   333 <open>
+  if(fd < 0)
+ 1a2:	83 c4 10             	add    $0x10,%esp
+ 1a5:	85 c0                	test   %eax,%eax
+ 1a7:	78 27                	js     1d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1a9:	83 ec 08             	sub    $0x8,%esp
+ 1ac:	ff 75 0c             	push   0xc(%ebp)
+ 1af:	89 c3                	mov    %eax,%ebx
+ 1b1:	50                   	push   %eax
+ 1b2:	e8 94 01 00 00       	call   34b <fstat>
+  close(fd);
+ 1b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1bc:	e8 5a 01 00 00       	call   31b <close>
+  return r;
+ 1c1:	83 c4 10             	add    $0x10,%esp
+}
+ 1c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1c7:	89 f0                	mov    %esi,%eax
+ 1c9:	5b                   	pop    %ebx
+ 1ca:	5e                   	pop    %esi
+ 1cb:	5d                   	pop    %ebp
+ 1cc:	c3                   	ret
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1d5:	eb ed                	jmp    1c4 <stat+0x34>
+ 1d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1de:	66 90                	xchg   %ax,%ax
+
+000001e0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+ 1e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1e8:	0f b6 02             	movzbl (%edx),%eax
+ 1eb:	3c 20                	cmp    $0x20,%al
+ 1ed:	75 0c                	jne    1fb <atoi+0x1b>
+ 1ef:	90                   	nop
+ 1f0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 1f4:	83 c2 01             	add    $0x1,%edx
+ 1f7:	3c 20                	cmp    $0x20,%al
+ 1f9:	74 f5                	je     1f0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 1fb:	3c 2d                	cmp    $0x2d,%al
+ 1fd:	74 41                	je     240 <atoi+0x60>
+ 1ff:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 204:	3c 2b                	cmp    $0x2b,%al
+ 206:	74 3d                	je     245 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 208:	0f be 0a             	movsbl (%edx),%ecx
+ 20b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 20e:	3c 09                	cmp    $0x9,%al
+ 210:	b8 00 00 00 00       	mov    $0x0,%eax
+ 215:	77 21                	ja     238 <atoi+0x58>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 226:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 0a             	movsbl (%edx),%ecx
+ 22d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x40>
+  return sign*n;
+ 235:	0f af c6             	imul   %esi,%eax
+}
+ 238:	5b                   	pop    %ebx
+ 239:	5e                   	pop    %esi
+ 23a:	5d                   	pop    %ebp
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 245:	83 c2 01             	add    $0x1,%edx
+ 248:	eb be                	jmp    208 <atoi+0x28>
+ 24a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000250 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	56                   	push   %esi
+ 254:	53                   	push   %ebx
+ 255:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 258:	0f b6 02             	movzbl (%edx),%eax
+ 25b:	3c 20                	cmp    $0x20,%al
+ 25d:	75 0c                	jne    26b <atoo+0x1b>
+ 25f:	90                   	nop
+ 260:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 264:	83 c2 01             	add    $0x1,%edx
+ 267:	3c 20                	cmp    $0x20,%al
+ 269:	74 f5                	je     260 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 26b:	3c 2d                	cmp    $0x2d,%al
+ 26d:	74 41                	je     2b0 <atoo+0x60>
+ 26f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 274:	3c 2b                	cmp    $0x2b,%al
+ 276:	74 3d                	je     2b5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 278:	0f be 0a             	movsbl (%edx),%ecx
+ 27b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 27e:	3c 07                	cmp    $0x7,%al
+ 280:	b8 00 00 00 00       	mov    $0x0,%eax
+ 285:	77 1e                	ja     2a5 <atoo+0x55>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 290:	83 c2 01             	add    $0x1,%edx
+ 293:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 297:	0f be 0a             	movsbl (%edx),%ecx
+ 29a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 29d:	80 fb 07             	cmp    $0x7,%bl
+ 2a0:	76 ee                	jbe    290 <atoo+0x40>
+  return sign*n;
+ 2a2:	0f af c6             	imul   %esi,%eax
+}
+ 2a5:	5b                   	pop    %ebx
+ 2a6:	5e                   	pop    %esi
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2b5:	83 c2 01             	add    $0x1,%edx
+ 2b8:	eb be                	jmp    278 <atoo+0x28>
+ 2ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002c0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+ 2c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ce:	85 c0                	test   %eax,%eax
+ 2d0:	7e 13                	jle    2e5 <memmove+0x25>
+ 2d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2d4:	89 d7                	mov    %edx,%edi
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2e1:	39 f8                	cmp    %edi,%eax
+ 2e3:	75 fb                	jne    2e0 <memmove+0x20>
+  return vdst;
+}
+ 2e5:	5e                   	pop    %esi
+ 2e6:	89 d0                	mov    %edx,%eax
+ 2e8:	5f                   	pop    %edi
+ 2e9:	5d                   	pop    %ebp
+ 2ea:	c3                   	ret
+
+000002eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2eb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <exit>:
+SYSCALL(exit)
+ 2f3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <wait>:
+SYSCALL(wait)
+ 2fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <pipe>:
+SYSCALL(pipe)
+ 303:	b8 04 00 00 00       	mov    $0x4,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <read>:
+SYSCALL(read)
+ 30b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <write>:
+SYSCALL(write)
+ 313:	b8 10 00 00 00       	mov    $0x10,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <close>:
+SYSCALL(close)
+ 31b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <kill>:
+SYSCALL(kill)
+ 323:	b8 06 00 00 00       	mov    $0x6,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <exec>:
+SYSCALL(exec)
+ 32b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <open>:
+SYSCALL(open)
+ 333:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <mknod>:
+SYSCALL(mknod)
+ 33b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <unlink>:
+SYSCALL(unlink)
+ 343:	b8 12 00 00 00       	mov    $0x12,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <fstat>:
+SYSCALL(fstat)
+ 34b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <link>:
+SYSCALL(link)
+ 353:	b8 13 00 00 00       	mov    $0x13,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <mkdir>:
+SYSCALL(mkdir)
+ 35b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <chdir>:
+SYSCALL(chdir)
+ 363:	b8 09 00 00 00       	mov    $0x9,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <dup>:
+SYSCALL(dup)
+ 36b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <getpid>:
+SYSCALL(getpid)
+ 373:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <sbrk>:
+SYSCALL(sbrk)
+ 37b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <sleep>:
+SYSCALL(sleep)
+ 383:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <uptime>:
+SYSCALL(uptime)
+ 38b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <superpages>:
+SYSCALL(superpages)
+ 393:	b8 23 00 00 00       	mov    $0x23,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mmap>:
+SYSCALL(mmap)
+ 39b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <munmap>:
+SYSCALL(munmap)
+ 3a3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <spawn>:
+SYSCALL(spawn)
+ 3ab:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <swapstat>:
+SYSCALL(swapstat)
+ 3b3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <getmeminfo>:
+SYSCALL(getmeminfo)
+ 3bb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <iostat>:
+SYSCALL(iostat)
+ 3c3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <dropcache>:
+SYSCALL(dropcache)
+ 3cb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <iosched>:
+SYSCALL(iosched)
+ 3d3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <halt>:
+SYSCALL(halt)
+ 3db:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <date>:
+SYSCALL(date)
+ 3e3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 3eb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <getgid>:
+SYSCALL(getgid)
+ 3f3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <getppid>:
+SYSCALL(getppid)
+ 3fb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <setuid>:
+SYSCALL(setuid)
+ 403:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <setgid>:
+SYSCALL(setgid)
+ 40b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getprocs>:
+SYSCALL(getprocs)
+ 413:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 41b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <getpriority>:
+SYSCALL(getpriority)
+ 423:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 42b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <chown>:
+SYSCALL(chown)
+ 433:	b8 21 00 00 00       	mov    $0x21,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <chgrp>:
+SYSCALL(chgrp)
+ 43b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+ 443:	66 90                	xchg   %ax,%ax
+ 445:	66 90                	xchg   %ax,%ax
+ 447:	66 90                	xchg   %ax,%ax
+ 449:	66 90                	xchg   %ax,%ax
+ 44b:	66 90                	xchg   %ax,%ax
+ 44d:	66 90                	xchg   %ax,%ax
+ 44f:	90                   	nop
+
+00000450 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 458:	89 d1                	mov    %edx,%ecx
+{
+ 45a:	83 ec 3c             	sub    $0x3c,%esp
+ 45d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 460:	85 d2                	test   %edx,%edx
+ 462:	0f 89 80 00 00 00    	jns    4e8 <printint+0x98>
+ 468:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 46c:	74 7a                	je     4e8 <printint+0x98>
+    x = -xx;
+ 46e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 470:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 475:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 478:	31 f6                	xor    %esi,%esi
+ 47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 480:	89 c8                	mov    %ecx,%eax
+ 482:	31 d2                	xor    %edx,%edx
+ 484:	89 f7                	mov    %esi,%edi
+ 486:	f7 f3                	div    %ebx
+ 488:	8d 76 01             	lea    0x1(%esi),%esi
+ 48b:	0f b6 92 98 0a 00 00 	movzbl 0xa98(%edx),%edx
+ 492:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 496:	89 ca                	mov    %ecx,%edx
+ 498:	89 c1                	mov    %eax,%ecx
+ 49a:	39 da                	cmp    %ebx,%edx
+ 49c:	73 e2                	jae    480 <printint+0x30>
+  if(neg)
+ 49e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4a1:	85 c0                	test   %eax,%eax
+ 4a3:	74 07                	je     4ac <printint+0x5c>
+    buf[i++] = '-';
+ 4a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4aa:	89 f7                	mov    %esi,%edi
+ 4ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4b2:	01 df                	add    %ebx,%edi
+ 4b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4bb:	83 ec 04             	sub    $0x4,%esp
+ 4be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4c4:	6a 01                	push   $0x1
+ 4c6:	50                   	push   %eax
+ 4c7:	56                   	push   %esi
+ 4c8:	e8 46 fe ff ff       	call   313 <write>
+  while(--i >= 0)
+ 4cd:	89 f8                	mov    %edi,%eax
+ 4cf:	83 c4 10             	add    $0x10,%esp
+ 4d2:	83 ef 01             	sub    $0x1,%edi
+ 4d5:	39 d8                	cmp    %ebx,%eax
+ 4d7:	75 df                	jne    4b8 <printint+0x68>
+}
+ 4d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4dc:	5b                   	pop    %ebx
+ 4dd:	5e                   	pop    %esi
+ 4de:	5f                   	pop    %edi
+ 4df:	5d                   	pop    %ebp
+ 4e0:	c3                   	ret
+ 4e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4e8:	31 c0                	xor    %eax,%eax
+ 4ea:	eb 89                	jmp    475 <printint+0x25>
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 502:	83 c6 01             	add    $0x1,%esi
+ 505:	84 db                	test   %bl,%bl
+ 507:	74 67                	je     570 <printf+0x80>
+ 509:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 50c:	31 d2                	xor    %edx,%edx
+ 50e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 511:	eb 34                	jmp    547 <printf+0x57>
+ 513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 517:	90                   	nop
+ 518:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 51b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 520:	83 f8 25             	cmp    $0x25,%eax
+ 523:	74 18                	je     53d <printf+0x4d>
+  write(fd, &c, 1);
+ 525:	83 ec 04             	sub    $0x4,%esp
+ 528:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 52b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 52e:	6a 01                	push   $0x1
+ 530:	50                   	push   %eax
+ 531:	57                   	push   %edi
+ 532:	e8 dc fd ff ff       	call   313 <write>
+ 537:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 53a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 53d:	0f b6 1e             	movzbl (%esi),%ebx
+ 540:	83 c6 01             	add    $0x1,%esi
+ 543:	84 db                	test   %bl,%bl
+ 545:	74 29                	je     570 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 547:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 54a:	85 d2                	test   %edx,%edx
+ 54c:	74 ca                	je     518 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 54e:	83 fa 25             	cmp    $0x25,%edx
+ 551:	75 ea                	jne    53d <printf+0x4d>
+      if(c == 'd'){
+ 553:	83 f8 25             	cmp    $0x25,%eax
+ 556:	0f 84 24 01 00 00    	je     680 <printf+0x190>
+ 55c:	83 e8 63             	sub    $0x63,%eax
+ 55f:	83 f8 15             	cmp    $0x15,%eax
+ 562:	77 1c                	ja     580 <printf+0x90>
+ 564:	ff 24 85 40 0a 00 00 	jmp    *0xa40(,%eax,4)
+ 56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 570:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 573:	5b                   	pop    %ebx
+ 574:	5e                   	pop    %esi
+ 575:	5f                   	pop    %edi
+ 576:	5d                   	pop    %ebp
+ 577:	c3                   	ret
+ 578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+  write(fd, &c, 1);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 586:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 58a:	6a 01                	push   $0x1
+ 58c:	52                   	push   %edx
+ 58d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 590:	57                   	push   %edi
+ 591:	e8 7d fd ff ff       	call   313 <write>
+ 596:	83 c4 0c             	add    $0xc,%esp
+ 599:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 59c:	6a 01                	push   $0x1
+ 59e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5a1:	52                   	push   %edx
+ 5a2:	57                   	push   %edi
+ 5a3:	e8 6b fd ff ff       	call   313 <write>
+        putc(fd, c);
+ 5a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ab:	31 d2                	xor    %edx,%edx
+ 5ad:	eb 8e                	jmp    53d <printf+0x4d>
+ 5af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5b3:	83 ec 0c             	sub    $0xc,%esp
+ 5b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5bb:	8b 13                	mov    (%ebx),%edx
+ 5bd:	6a 00                	push   $0x0
+ 5bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5c4:	e8 87 fe ff ff       	call   450 <printint>
+        ap++;
+ 5c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5cf:	31 d2                	xor    %edx,%edx
+ 5d1:	e9 67 ff ff ff       	jmp    53d <printf+0x4d>
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5e5:	83 c0 04             	add    $0x4,%eax
+ 5e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5eb:	85 db                	test   %ebx,%ebx
+ 5ed:	0f 84 9d 00 00 00    	je     690 <printf+0x1a0>
+        while(*s != 0){
+ 5f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5f8:	84 c0                	test   %al,%al
+ 5fa:	0f 84 3d ff ff ff    	je     53d <printf+0x4d>
+ 600:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 603:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 606:	89 de                	mov    %ebx,%esi
+ 608:	89 d3                	mov    %edx,%ebx
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 616:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 619:	6a 01                	push   $0x1
+ 61b:	53                   	push   %ebx
+ 61c:	57                   	push   %edi
+ 61d:	e8 f1 fc ff ff       	call   313 <write>
+        while(*s != 0){
+ 622:	0f b6 06             	movzbl (%esi),%eax
+ 625:	83 c4 10             	add    $0x10,%esp
+ 628:	84 c0                	test   %al,%al
+ 62a:	75 e4                	jne    610 <printf+0x120>
+      state = 0;
+ 62c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 62f:	31 d2                	xor    %edx,%edx
+ 631:	e9 07 ff ff ff       	jmp    53d <printf+0x4d>
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 64b:	8b 13                	mov    (%ebx),%edx
+ 64d:	6a 01                	push   $0x1
+ 64f:	e9 6b ff ff ff       	jmp    5bf <printf+0xcf>
+ 654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 658:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 65b:	83 ec 04             	sub    $0x4,%esp
+ 65e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 661:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 663:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 666:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 669:	6a 01                	push   $0x1
+ 66b:	52                   	push   %edx
+ 66c:	57                   	push   %edi
+ 66d:	e8 a1 fc ff ff       	call   313 <write>
+        ap++;
+ 672:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 675:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 678:	31 d2                	xor    %edx,%edx
+ 67a:	e9 be fe ff ff       	jmp    53d <printf+0x4d>
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 686:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 689:	6a 01                	push   $0x1
+ 68b:	e9 11 ff ff ff       	jmp    5a1 <printf+0xb1>
+ 690:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 695:	bb 38 0a 00 00       	mov    $0xa38,%ebx
+ 69a:	e9 61 ff ff ff       	jmp    600 <printf+0x110>
+ 69f:	90                   	nop
+
+000006a0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a3:	a1 64 0e 00 00       	mov    0xe64,%eax
+{
+ 6a8:	89 e5                	mov    %esp,%ebp
+ 6aa:	56                   	push   %esi
+ 6ab:	53                   	push   %ebx
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b4:	39 ca                	cmp    %ecx,%edx
+ 6b6:	73 30                	jae    6e8 <lfree+0x48>
+ 6b8:	39 c1                	cmp    %eax,%ecx
+ 6ba:	72 04                	jb     6c0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6bc:	39 c2                	cmp    %eax,%edx
+ 6be:	72 f0                	jb     6b0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6c0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 6c3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 6c6:	39 f0                	cmp    %esi,%eax
+ 6c8:	74 26                	je     6f0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6ca:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 6cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 6d2:	39 d9                	cmp    %ebx,%ecx
+ 6d4:	74 30                	je     706 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6d6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6d8:	5b                   	pop    %ebx
+  freep = p;
+ 6d9:	89 15 64 0e 00 00    	mov    %edx,0xe64
+}
+ 6df:	5e                   	pop    %esi
+ 6e0:	5d                   	pop    %ebp
+ 6e1:	c3                   	ret
+ 6e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6e8:	39 c1                	cmp    %eax,%ecx
+ 6ea:	72 d0                	jb     6bc <lfree+0x1c>
+ 6ec:	eb c2                	jmp    6b0 <lfree+0x10>
+ 6ee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 6f0:	03 58 04             	add    0x4(%eax),%ebx
+ 6f3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6f6:	8b 02                	mov    (%edx),%eax
+ 6f8:	8b 00                	mov    (%eax),%eax
+ 6fa:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 6fc:	8b 42 04             	mov    0x4(%edx),%eax
+ 6ff:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 702:	39 d9                	cmp    %ebx,%ecx
+ 704:	75 d0                	jne    6d6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 706:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 709:	89 15 64 0e 00 00    	mov    %edx,0xe64
+    p->s.size += bp->s.size;
+ 70f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 712:	8b 09                	mov    (%ecx),%ecx
+ 714:	89 0a                	mov    %ecx,(%edx)
+}
+ 716:	5b                   	pop    %ebx
+ 717:	5e                   	pop    %esi
+ 718:	5d                   	pop    %ebp
+ 719:	c3                   	ret
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000720 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	89 c7                	mov    %eax,%edi
+ 726:	56                   	push   %esi
+ 727:	53                   	push   %ebx
+ 728:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 72b:	a1 64 0e 00 00       	mov    0xe64,%eax
+ 730:	85 c0                	test   %eax,%eax
+ 732:	0f 84 88 00 00 00    	je     7c0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 738:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 73a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 73d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 742:	39 df                	cmp    %ebx,%edi
+ 744:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 747:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 74e:	39 f9                	cmp    %edi,%ecx
+ 750:	72 0f                	jb     761 <lalloc+0x41>
+ 752:	eb 4c                	jmp    7a0 <lalloc+0x80>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 758:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 75a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 75d:	39 f9                	cmp    %edi,%ecx
+ 75f:	73 3f                	jae    7a0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 761:	89 d0                	mov    %edx,%eax
+ 763:	39 15 64 0e 00 00    	cmp    %edx,0xe64
+ 769:	75 ed                	jne    758 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 76b:	83 ec 0c             	sub    $0xc,%esp
+ 76e:	56                   	push   %esi
+ 76f:	e8 07 fc ff ff       	call   37b <sbrk>
+  if(p == (char*)-1)
+ 774:	83 c4 10             	add    $0x10,%esp
+ 777:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 77a:	74 11                	je     78d <lalloc+0x6d>
+  hp->s.size = nu;
+ 77c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 77f:	e8 1c ff ff ff       	call   6a0 <lfree>
+  return freep;
+ 784:	a1 64 0e 00 00       	mov    0xe64,%eax
+      if((p = morecore(nunits)) == 0)
+ 789:	85 c0                	test   %eax,%eax
+ 78b:	75 cb                	jne    758 <lalloc+0x38>
+        return 0;
+  }
+}
+ 78d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 790:	31 d2                	xor    %edx,%edx
+}
+ 792:	5b                   	pop    %ebx
+ 793:	89 d0                	mov    %edx,%eax
+ 795:	5e                   	pop    %esi
+ 796:	5f                   	pop    %edi
+ 797:	5d                   	pop    %ebp
+ 798:	c3                   	ret
+ 799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 7a0:	39 cf                	cmp    %ecx,%edi
+ 7a2:	74 4c                	je     7f0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 7a4:	29 f9                	sub    %edi,%ecx
+ 7a6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 7a9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 7ac:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 7af:	a3 64 0e 00 00       	mov    %eax,0xe64
+}
+ 7b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7b7:	89 d0                	mov    %edx,%eax
+ 7b9:	5b                   	pop    %ebx
+ 7ba:	5e                   	pop    %esi
+ 7bb:	5f                   	pop    %edi
+ 7bc:	5d                   	pop    %ebp
+ 7bd:	c3                   	ret
+ 7be:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 7c0:	ba 68 0e 00 00       	mov    $0xe68,%edx
+ 7c5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 7c7:	c7 05 64 0e 00 00 68 	movl   $0xe68,0xe64
+ 7ce:	0e 00 00 
+ 7d1:	c7 05 68 0e 00 00 68 	movl   $0xe68,0xe68
+ 7d8:	0e 00 00 
+ 7db:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 7dd:	c7 05 6c 0e 00 00 00 	movl   $0x0,0xe6c
+ 7e4:	00 00 00 
+ 7e7:	e9 51 ff ff ff       	jmp    73d <lalloc+0x1d>
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 7f0:	8b 0a                	mov    (%edx),%ecx
+ 7f2:	89 08                	mov    %ecx,(%eax)
+ 7f4:	eb b9                	jmp    7af <lalloc+0x8f>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000800 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 809:	85 f6                	test   %esi,%esi
+ 80b:	74 42                	je     84f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 80d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 810:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 813:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 819:	77 3d                	ja     858 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 81b:	31 c9                	xor    %ecx,%ecx
+ 81d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 822:	83 fa 02             	cmp    $0x2,%edx
+ 825:	74 17                	je     83e <free+0x3e>
+ 827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82e:	66 90                	xchg   %ax,%ax
+ 830:	83 c1 01             	add    $0x1,%ecx
+ 833:	89 d8                	mov    %ebx,%eax
+ 835:	d3 e0                	shl    %cl,%eax
+ 837:	83 c0 01             	add    $0x1,%eax
+ 83a:	39 c2                	cmp    %eax,%edx
+ 83c:	75 f2                	jne    830 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 83e:	8b 04 8d 40 0e 00 00 	mov    0xe40(,%ecx,4),%eax
+  classes[c] = bp;
+ 845:	89 3c 8d 40 0e 00 00 	mov    %edi,0xe40(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 84c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 84f:	5b                   	pop    %ebx
+ 850:	5e                   	pop    %esi
+ 851:	5f                   	pop    %edi
+ 852:	5d                   	pop    %ebp
+ 853:	c3                   	ret
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 858:	5b                   	pop    %ebx
+    lfree(bp);
+ 859:	89 f8                	mov    %edi,%eax
+}
+ 85b:	5e                   	pop    %esi
+ 85c:	5f                   	pop    %edi
+ 85d:	5d                   	pop    %ebp
+    lfree(bp);
+ 85e:	e9 3d fe ff ff       	jmp    6a0 <lfree>
+ 863:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000870 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 879:	8b 45 08             	mov    0x8(%ebp),%eax
+ 87c:	83 c0 07             	add    $0x7,%eax
+ 87f:	c1 e8 03             	shr    $0x3,%eax
+ 882:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 885:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 88a:	77 44                	ja     8d0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 88c:	31 c9                	xor    %ecx,%ecx
+ 88e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 893:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 898:	83 f8 02             	cmp    $0x2,%eax
+ 89b:	76 11                	jbe    8ae <malloc+0x3e>
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+ 8a0:	83 c1 01             	add    $0x1,%ecx
+ 8a3:	89 d3                	mov    %edx,%ebx
+ 8a5:	d3 e3                	shl    %cl,%ebx
+ 8a7:	83 c3 01             	add    $0x1,%ebx
+ 8aa:	39 c3                	cmp    %eax,%ebx
+ 8ac:	72 f2                	jb     8a0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 8ae:	8b 04 8d 40 0e 00 00 	mov    0xe40(,%ecx,4),%eax
+ 8b5:	85 c0                	test   %eax,%eax
+ 8b7:	74 2f                	je     8e8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 8b9:	8b 10                	mov    (%eax),%edx
+ 8bb:	89 14 8d 40 0e 00 00 	mov    %edx,0xe40(,%ecx,4)
+  return (void*)(p + 1);
+ 8c2:	83 c0 08             	add    $0x8,%eax
+}
+ 8c5:	83 c4 1c             	add    $0x1c,%esp
+ 8c8:	5b                   	pop    %ebx
+ 8c9:	5e                   	pop    %esi
+ 8ca:	5f                   	pop    %edi
+ 8cb:	5d                   	pop    %ebp
+ 8cc:	c3                   	ret
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 8d0:	e8 4b fe ff ff       	call   720 <lalloc>
+ 8d5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 8d7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 8da:	85 d2                	test   %edx,%edx
+ 8dc:	75 e7                	jne    8c5 <malloc+0x55>
+      return 0;
+ 8de:	31 c0                	xor    %eax,%eax
+ 8e0:	eb e3                	jmp    8c5 <malloc+0x55>
+ 8e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 8e8:	31 d2                	xor    %edx,%edx
+ 8ea:	b8 00 02 00 00       	mov    $0x200,%eax
+ 8ef:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 8f2:	f7 f3                	div    %ebx
+  if(n < 4)
+ 8f4:	ba 04 00 00 00       	mov    $0x4,%edx
+ 8f9:	89 d6                	mov    %edx,%esi
+ 8fb:	39 d0                	cmp    %edx,%eax
+ 8fd:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 900:	0f af f3             	imul   %ebx,%esi
+ 903:	89 f0                	mov    %esi,%eax
+ 905:	e8 16 fe ff ff       	call   720 <lalloc>
+ 90a:	85 c0                	test   %eax,%eax
+ 90c:	74 d0                	je     8de <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 90e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 911:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 914:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 91b:	8b 14 8d 40 0e 00 00 	mov    0xe40(,%ecx,4),%edx
+ 922:	39 f8                	cmp    %edi,%eax
+ 924:	73 22                	jae    948 <malloc+0xd8>
+ 926:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 929:	eb 09                	jmp    934 <malloc+0xc4>
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+ 930:	89 c2                	mov    %eax,%edx
+ 932:	89 c8                	mov    %ecx,%eax
+ 934:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ 937:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ 93a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ 93c:	39 f9                	cmp    %edi,%ecx
+ 93e:	72 f0                	jb     930 <malloc+0xc0>
+ 940:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 943:	e9 73 ff ff ff       	jmp    8bb <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ 948:	89 d0                	mov    %edx,%eax
+ 94a:	8b 12                	mov    (%edx),%edx
+ 94c:	e9 6a ff ff ff       	jmp    8bb <malloc+0x4b>
+ 951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+
+00000960 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	56                   	push   %esi
+ 964:	53                   	push   %ebx
+ 965:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 968:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ 96b:	85 c9                	test   %ecx,%ecx
+ 96d:	74 06                	je     975 <calloc+0x15>
+ 96f:	89 c8                	mov    %ecx,%eax
+ 971:	f7 e3                	mul    %ebx
+ 973:	70 33                	jo     9a8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ 975:	0f af d9             	imul   %ecx,%ebx
+ 978:	83 ec 0c             	sub    $0xc,%esp
+ 97b:	53                   	push   %ebx
+ 97c:	e8 ef fe ff ff       	call   870 <malloc>
+ 981:	83 c4 10             	add    $0x10,%esp
+ 984:	89 c6                	mov    %eax,%esi
+ 986:	85 c0                	test   %eax,%eax
+ 988:	74 1e                	je     9a8 <calloc+0x48>
+    memset(p, 0, n * size);
+ 98a:	83 ec 04             	sub    $0x4,%esp
+ 98d:	53                   	push   %ebx
+ 98e:	6a 00                	push   $0x0
+ 990:	50                   	push   %eax
+ 991:	e8 3a f7 ff ff       	call   d0 <memset>
+ 996:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ 999:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 99c:	89 f0                	mov    %esi,%eax
+ 99e:	5b                   	pop    %ebx
+ 99f:	5e                   	pop    %esi
+ 9a0:	5d                   	pop    %ebp
+ 9a1:	c3                   	ret
+ 9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 9a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 9ab:	31 f6                	xor    %esi,%esi
+}
+ 9ad:	89 f0                	mov    %esi,%eax
+ 9af:	5b                   	pop    %ebx
+ 9b0:	5e                   	pop    %esi
+ 9b1:	5d                   	pop    %ebp
+ 9b2:	c3                   	ret
+ 9b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009c0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	83 ec 0c             	sub    $0xc,%esp
+ 9c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 9cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ 9cf:	85 db                	test   %ebx,%ebx
+ 9d1:	74 55                	je     a28 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ 9d3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ 9d6:	89 de                	mov    %ebx,%esi
+ 9d8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ 9df:	39 c7                	cmp    %eax,%edi
+ 9e1:	72 0d                	jb     9f0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ 9e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9e6:	89 f0                	mov    %esi,%eax
+ 9e8:	5b                   	pop    %ebx
+ 9e9:	5e                   	pop    %esi
+ 9ea:	5f                   	pop    %edi
+ 9eb:	5d                   	pop    %ebp
+ 9ec:	c3                   	ret
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ 9f0:	83 ec 0c             	sub    $0xc,%esp
+ 9f3:	50                   	push   %eax
+ 9f4:	e8 77 fe ff ff       	call   870 <malloc>
+ 9f9:	83 c4 10             	add    $0x10,%esp
+ 9fc:	89 c6                	mov    %eax,%esi
+ 9fe:	85 c0                	test   %eax,%eax
+ a00:	74 e1                	je     9e3 <realloc+0x23>
+  memmove(p, ap, have);
+ a02:	83 ec 04             	sub    $0x4,%esp
+ a05:	57                   	push   %edi
+ a06:	53                   	push   %ebx
+ a07:	50                   	push   %eax
+ a08:	e8 b3 f8 ff ff       	call   2c0 <memmove>
+  free(ap);
+ a0d:	89 1c 24             	mov    %ebx,(%esp)
+ a10:	e8 eb fd ff ff       	call   800 <free>
+  return p;
+ a15:	83 c4 10             	add    $0x10,%esp
+}
+ a18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a1b:	89 f0                	mov    %esi,%eax
+ a1d:	5b                   	pop    %ebx
+ a1e:	5e                   	pop    %esi
+ a1f:	5f                   	pop    %edi
+ a20:	5d                   	pop    %ebp
+ a21:	c3                   	ret
+ a22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a28:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a2e:	5b                   	pop    %ebx
+ a2f:	5e                   	pop    %esi
+ a30:	5f                   	pop    %edi
+ a31:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ a32:	e9 39 fe ff ff       	jmp    870 <malloc>
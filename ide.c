@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.  Transfers use bus-master DMA if
+// the PCI IDE controller offers it, else PIO.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +13,8 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +26,49 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// Bus master registers for the primary channel, at bmiba.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+#define BM_START      0x01  // in BM_CMD
+#define BM_TOMEM      0x08  //   direction: disk to memory
+#define BM_ERR        0x02  // in BM_STATUS, write 1 to clear
+#define BM_IRQ        0x04
+
+// A physical region descriptor: one piece of memory for DMA.
+// It may not cross a 64KB boundary, nor may the table.
+struct prd {
+  uint addr;
+  ushort n;        // bytes
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last entry in table
+
+// Bufs wait for the disk in the queue of iosched.c, which
+// chooses the order.  idecur points to the buf now being
+// read/written to the disk, and idecur->qnext to the others in
+// the same command: idestart() merges requests for consecutive
+// blocks into one command of up to IDEMAXMERGE blocks, a DMA
+// transfer or else READ/WRITE MULTIPLE.  idenbuf says how many
+// bufs the command covers.
+// You must hold idelock while manipulating the queue.
 
 static struct spinlock idelock;
-static struct buf *idequeue;
+static struct buf *idecur;
+static int idenbuf;
 
 static int havedisk1;
-static void idestart(struct buf*);
+static int idemerge[2];    // most bufs per command, per disk
+static int idedma;         // use DMA?
+static ushort bmiba;       // bus master I/O base
+static struct prd prdt[2*IDEMAXMERGE] __attribute__((aligned(256)));
+static uint idereqs;       // commands issued
+static uint ideblocks;     // blocks they moved
+static void idestart(void);
 
 // Wait for IDE disk to become ready.
 static int
@@ -47,6 +83,42 @@ idewait(int checkerr)
   return 0;
 }
 
+// Let disk dev move up to IDEMAXMERGE blocks per interrupt
+// with READ/WRITE MULTIPLE.  If it refuses, do not merge.
+static void
+idesetmult(int dev)
+{
+  int n;
+
+  n = IDEMAXMERGE * (BSIZE/SECTOR_SIZE);
+  idewait(0);
+  outb(0x1f6, 0xe0 | ((dev&1)<<4));
+  outb(0x1f2, n);
+  outb(0x1f7, IDE_CMD_SETMUL);
+  if(idewait(1) >= 0)
+    idemerge[dev&1] = IDEMAXMERGE;
+  else
+    idemerge[dev&1] = 1;
+}
+
+// Find the PCI IDE controller and let it do DMA.  Returns -1
+// if there is none or it cannot be bus master.
+static int
+idedmainit(void)
+{
+  struct pcidev d;
+
+  if(pcifind(PCI_STORAGE, PCI_IDE, 0, &d) < 0)
+    return -1;
+  if((d.progif & 0x80) == 0 || (d.bar[4] & 1) == 0)
+    return -1;
+  bmiba = d.bar[4] & ~3;
+  pcienable(&d, PCI_CMD_IO|PCI_CMD_MASTER);
+  outb(bmiba + BM_CMD, 0);
+  outb(bmiba + BM_STATUS, BM_ERR|BM_IRQ);
+  return 0;
+}
+
 void
 ideinit(void)
 {
@@ -65,35 +137,90 @@ ideinit(void)
     }
   }
 
+  if(idedmainit() == 0){
+    idedma = 1;
+    idemerge[0] = idemerge[1] = IDEMAXMERGE;
+  } else {
+    if(havedisk1)
+      idesetmult(1);
+    idesetmult(0);
+  }
+  cprintf("ide: %s\n", idedma ? "dma" : "pio");
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Point the bus master at the data of the n bufs from b on.
+static void
+idedmasetup(struct buf *b, int n)
+{
+  struct buf *q;
+  uint pa, m, left;
+  int i, np;
+
+  np = 0;
+  for(i = 0, q = b; i < n; i++, q = q->qnext){
+    pa = V2P(q->data);
+    for(left = BSIZE; left > 0; left -= m, pa += m){
+      m = 0x10000 - (pa & 0xffff);
+      if(m > left)
+        m = left;
+      prdt[np].addr = pa;
+      prdt[np].n = m;
+      prdt[np].flags = 0;
+      np++;
+    }
+  }
+  prdt[np-1].flags = PRD_EOT;
+  outl(bmiba + BM_PRDT, V2P(prdt));
+  outb(bmiba + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_TOMEM);
+  outb(bmiba + BM_STATUS, BM_ERR|BM_IRQ);
+}
+
+// Start the next request, if any.  Caller must hold idelock.
 static void
-idestart(struct buf *b)
+idestart(void)
 {
-  if(b == 0)
-    panic("idestart");
-  if(b->blockno >= FSSIZE)
+  struct buf *b, *q;
+  int i, n;
+
+  if((b = iosnext()) == 0)
+    return;
+  if(b->blockno >= FSSIZE + SWAPSIZE)
     panic("incorrect blockno");
+
+  // Take along bufs for the next blocks, in the same direction.
+  n = iosmerge(b, idemerge[b->dev&1]);
+  idecur = b;
+  idenbuf = n;
+  idereqs++;
+  ideblocks += n;
+
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int nsector = n * sector_per_block;
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   if (sector_per_block > 7) panic("idestart");
 
   idewait(0);
+  if(idedma)
+    idedmasetup(b, n);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsector);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(idedma){
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(bmiba + BM_CMD, inb(bmiba + BM_CMD) | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(i = 0, q = b; i < n; i++, q = q->qnext)
+      outsl(0x1f0, q->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -103,42 +230,59 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *async[IDEMAXMERGE];
+  int i, n, nasync;
 
-  // First queued buffer is the active request.
+  // idecur is the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = idecur) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  // Stop the DMA engine, or read data if needed.
+  if(idedma){
+    outb(bmiba + BM_CMD, 0);
+    outb(bmiba + BM_STATUS, BM_ERR|BM_IRQ);
+    idewait(1);
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+    for(i = 0; i < idenbuf; i++, b = b->qnext)
+      insl(0x1f0, b->data, BSIZE/4);
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for these bufs.
+  n = idenbuf;
+  nasync = 0;
+  b = idecur;
+  idecur = 0;
+  for(i = 0; i < n; i++, b = b->qnext){
+    iosdone(b);
+    if(b->flags & B_READA)
+      async[nasync++] = b;
+    b->flags |= B_VALID;
+    b->flags &= ~(B_DIRTY|B_ASYNC|B_READA);
+    wakeup(b);
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  // Start disk on next request.
+  idestart();
 
   release(&idelock);
+
+  // No one waits for a read-ahead; release its buffer.
+  for(i = 0; i < nasync; i++)
+    bdone(async[i]);
 }
 
 //PAGEBREAK!
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once: wait with ideawait(), or
+// if B_READA is set too, ideintr releases the buf.
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
-
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
@@ -148,15 +292,16 @@ iderw(struct buf *b)
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  iosadd(b);  //DOC:insert-queue
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(idecur == 0)
+    idestart();
+
+  if(b->flags & B_ASYNC){
+    release(&idelock);
+    return;
+  }
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
@@ -166,3 +311,36 @@ iderw(struct buf *b)
 
   release(&idelock);
 }
+
+// Wait for the disk to finish b, which iderw() started with
+// B_ASYNC set.
+void
+ideawait(struct buf *b)
+{
+  acquire(&idelock);
+  while(b->flags & B_ASYNC)
+    sleep(b, &idelock);
+  release(&idelock);
+}
+
+void
+idestat(struct iostat *st)
+{
+  acquire(&idelock);
+  st->diskreqs = idereqs;
+  st->diskblocks = ideblocks;
+  iosstat(st);
+  release(&idelock);
+}
+
+// Switch the disk scheduler to policy n; see iosched.c.
+int
+idesched(int n)
+{
+  int old;
+
+  acquire(&idelock);
+  old = iosset(n);
+  release(&idelock);
+  return old;
+}
@@ -0,0 +1,1726 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 18 0b 00 00       	push   $0xb18
+  19:	e8 f5 03 00 00       	call   413 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 18 04 00 00       	call   44b <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 0c 04 00 00       	call   44b <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 20 0b 00 00       	push   $0xb20
+  50:	6a 01                	push   $0x1
+  52:	e8 79 05 00 00       	call   5d0 <printf>
+    pid = fork();
+  57:	e8 6f 03 00 00       	call   3cb <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 66 03 00 00       	call   3db <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 5f 0b 00 00       	push   $0xb5f
+  85:	6a 01                	push   $0x1
+  87:	e8 44 05 00 00       	call   5d0 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 33 0b 00 00       	push   $0xb33
+  98:	6a 01                	push   $0x1
+  9a:	e8 31 05 00 00       	call   5d0 <printf>
+      exit();
+  9f:	e8 2f 03 00 00       	call   3d3 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 7c 0f 00 00       	push   $0xf7c
+  ab:	68 46 0b 00 00       	push   $0xb46
+  b0:	e8 56 03 00 00       	call   40b <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 49 0b 00 00       	push   $0xb49
+  bc:	6a 01                	push   $0x1
+  be:	e8 0d 05 00 00       	call   5d0 <printf>
+      exit();
+  c3:	e8 0b 03 00 00       	call   3d3 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 18 0b 00 00       	push   $0xb18
+  d2:	e8 44 03 00 00       	call   41b <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 18 0b 00 00       	push   $0xb18
+  e0:	e8 2e 03 00 00       	call   413 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1da:	0f b6 10             	movzbl (%eax),%edx
+ 1dd:	84 d2                	test   %dl,%dl
+ 1df:	75 12                	jne    1f3 <strchr+0x23>
+ 1e1:	eb 1d                	jmp    200 <strchr+0x30>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	84 d2                	test   %dl,%dl
+ 1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+ 1f3:	38 d1                	cmp    %dl,%cl
+ 1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 200:	31 c0                	xor    %eax,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 219:	31 db                	xor    %ebx,%ebx
+{
+ 21b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 21e:	eb 27                	jmp    247 <gets+0x37>
+    cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	56                   	push   %esi
+ 226:	6a 00                	push   $0x0
+ 228:	e8 be 01 00 00       	call   3eb <read>
+    if(cc < 1)
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	7e 1d                	jle    251 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+ 23b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 23f:	3c 0a                	cmp    $0xa,%al
+ 241:	74 10                	je     253 <gets+0x43>
+ 243:	3c 0d                	cmp    $0xd,%al
+ 245:	74 0c                	je     253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 247:	89 df                	mov    %ebx,%edi
+ 249:	83 c3 01             	add    $0x1,%ebx
+ 24c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 24f:	7c cf                	jl     220 <gets+0x10>
+ 251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5f                   	pop    %edi
+ 260:	5d                   	pop    %ebp
+ 261:	c3                   	ret
+ 262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 275:	83 ec 08             	sub    $0x8,%esp
+ 278:	6a 00                	push   $0x0
+ 27a:	ff 75 08             	push   0x8(%ebp)
+ 27d:	e8 91 01 00 00       	call   413 <open>
+  if(fd < 0)
+ 282:	83 c4 10             	add    $0x10,%esp
+ 285:	85 c0                	test   %eax,%eax
+ 287:	78 27                	js     2b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	ff 75 0c             	push   0xc(%ebp)
+ 28f:	89 c3                	mov    %eax,%ebx
+ 291:	50                   	push   %eax
+ 292:	e8 94 01 00 00       	call   42b <fstat>
+  close(fd);
+ 297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 29a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29c:	e8 5a 01 00 00       	call   3fb <close>
+  return r;
+ 2a1:	83 c4 10             	add    $0x10,%esp
+}
+ 2a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2a7:	89 f0                	mov    %esi,%eax
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b5:	eb ed                	jmp    2a4 <stat+0x34>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+ 2c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2c8:	0f b6 02             	movzbl (%edx),%eax
+ 2cb:	3c 20                	cmp    $0x20,%al
+ 2cd:	75 0c                	jne    2db <atoi+0x1b>
+ 2cf:	90                   	nop
+ 2d0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2d4:	83 c2 01             	add    $0x1,%edx
+ 2d7:	3c 20                	cmp    $0x20,%al
+ 2d9:	74 f5                	je     2d0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2db:	3c 2d                	cmp    $0x2d,%al
+ 2dd:	74 41                	je     320 <atoi+0x60>
+ 2df:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2e4:	3c 2b                	cmp    $0x2b,%al
+ 2e6:	74 3d                	je     325 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 2e8:	0f be 0a             	movsbl (%edx),%ecx
+ 2eb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2ee:	3c 09                	cmp    $0x9,%al
+ 2f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2f5:	77 21                	ja     318 <atoi+0x58>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 306:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 0a             	movsbl (%edx),%ecx
+ 30d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x40>
+  return sign*n;
+ 315:	0f af c6             	imul   %esi,%eax
+}
+ 318:	5b                   	pop    %ebx
+ 319:	5e                   	pop    %esi
+ 31a:	5d                   	pop    %ebp
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 320:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 325:	83 c2 01             	add    $0x1,%edx
+ 328:	eb be                	jmp    2e8 <atoi+0x28>
+ 32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000330 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	56                   	push   %esi
+ 334:	53                   	push   %ebx
+ 335:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 338:	0f b6 02             	movzbl (%edx),%eax
+ 33b:	3c 20                	cmp    $0x20,%al
+ 33d:	75 0c                	jne    34b <atoo+0x1b>
+ 33f:	90                   	nop
+ 340:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 344:	83 c2 01             	add    $0x1,%edx
+ 347:	3c 20                	cmp    $0x20,%al
+ 349:	74 f5                	je     340 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 34b:	3c 2d                	cmp    $0x2d,%al
+ 34d:	74 41                	je     390 <atoo+0x60>
+ 34f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 354:	3c 2b                	cmp    $0x2b,%al
+ 356:	74 3d                	je     395 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 358:	0f be 0a             	movsbl (%edx),%ecx
+ 35b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 35e:	3c 07                	cmp    $0x7,%al
+ 360:	b8 00 00 00 00       	mov    $0x0,%eax
+ 365:	77 1e                	ja     385 <atoo+0x55>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 377:	0f be 0a             	movsbl (%edx),%ecx
+ 37a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 37d:	80 fb 07             	cmp    $0x7,%bl
+ 380:	76 ee                	jbe    370 <atoo+0x40>
+  return sign*n;
+ 382:	0f af c6             	imul   %esi,%eax
+}
+ 385:	5b                   	pop    %ebx
+ 386:	5e                   	pop    %esi
+ 387:	5d                   	pop    %ebp
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 395:	83 c2 01             	add    $0x1,%edx
+ 398:	eb be                	jmp    358 <atoo+0x28>
+ 39a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003a0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+ 3a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ae:	85 c0                	test   %eax,%eax
+ 3b0:	7e 13                	jle    3c5 <memmove+0x25>
+ 3b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3b4:	89 d7                	mov    %edx,%edi
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3c1:	39 f8                	cmp    %edi,%eax
+ 3c3:	75 fb                	jne    3c0 <memmove+0x20>
+  return vdst;
+}
+ 3c5:	5e                   	pop    %esi
+ 3c6:	89 d0                	mov    %edx,%eax
+ 3c8:	5f                   	pop    %edi
+ 3c9:	5d                   	pop    %ebp
+ 3ca:	c3                   	ret
+
+000003cb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <exit>:
+SYSCALL(exit)
+ 3d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <wait>:
+SYSCALL(wait)
+ 3db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <pipe>:
+SYSCALL(pipe)
+ 3e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <read>:
+SYSCALL(read)
+ 3eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <write>:
+SYSCALL(write)
+ 3f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <close>:
+SYSCALL(close)
+ 3fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <kill>:
+SYSCALL(kill)
+ 403:	b8 06 00 00 00       	mov    $0x6,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <exec>:
+SYSCALL(exec)
+ 40b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <open>:
+SYSCALL(open)
+ 413:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <mknod>:
+SYSCALL(mknod)
+ 41b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <unlink>:
+SYSCALL(unlink)
+ 423:	b8 12 00 00 00       	mov    $0x12,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <fstat>:
+SYSCALL(fstat)
+ 42b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <link>:
+SYSCALL(link)
+ 433:	b8 13 00 00 00       	mov    $0x13,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mkdir>:
+SYSCALL(mkdir)
+ 43b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <chdir>:
+SYSCALL(chdir)
+ 443:	b8 09 00 00 00       	mov    $0x9,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <dup>:
+SYSCALL(dup)
+ 44b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <getpid>:
+SYSCALL(getpid)
+ 453:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <sbrk>:
+SYSCALL(sbrk)
+ 45b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <sleep>:
+SYSCALL(sleep)
+ 463:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <uptime>:
+SYSCALL(uptime)
+ 46b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <superpages>:
+SYSCALL(superpages)
+ 473:	b8 23 00 00 00       	mov    $0x23,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mmap>:
+SYSCALL(mmap)
+ 47b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <munmap>:
+SYSCALL(munmap)
+ 483:	b8 25 00 00 00       	mov    $0x25,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <spawn>:
+SYSCALL(spawn)
+ 48b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <swapstat>:
+SYSCALL(swapstat)
+ 493:	b8 27 00 00 00       	mov    $0x27,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 49b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <iostat>:
+SYSCALL(iostat)
+ 4a3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <dropcache>:
+SYSCALL(dropcache)
+ 4ab:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <iosched>:
+SYSCALL(iosched)
+ 4b3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <halt>:
+SYSCALL(halt)
+ 4bb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <date>:
+SYSCALL(date)
+ 4c3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 4cb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <getgid>:
+SYSCALL(getgid)
+ 4d3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <getppid>:
+SYSCALL(getppid)
+ 4db:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <setuid>:
+SYSCALL(setuid)
+ 4e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <setgid>:
+SYSCALL(setgid)
+ 4eb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getprocs>:
+SYSCALL(getprocs)
+ 4f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 4fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <getpriority>:
+SYSCALL(getpriority)
+ 503:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 50b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <chown>:
+SYSCALL(chown)
+ 513:	b8 21 00 00 00       	mov    $0x21,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <chgrp>:
+SYSCALL(chgrp)
+ 51b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+ 523:	66 90                	xchg   %ax,%ax
+ 525:	66 90                	xchg   %ax,%ax
+ 527:	66 90                	xchg   %ax,%ax
+ 529:	66 90                	xchg   %ax,%ax
+ 52b:	66 90                	xchg   %ax,%ax
+ 52d:	66 90                	xchg   %ax,%ax
+ 52f:	90                   	nop
+
+00000530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 538:	89 d1                	mov    %edx,%ecx
+{
+ 53a:	83 ec 3c             	sub    $0x3c,%esp
+ 53d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 540:	85 d2                	test   %edx,%edx
+ 542:	0f 89 80 00 00 00    	jns    5c8 <printint+0x98>
+ 548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 54c:	74 7a                	je     5c8 <printint+0x98>
+    x = -xx;
+ 54e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 558:	31 f6                	xor    %esi,%esi
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 560:	89 c8                	mov    %ecx,%eax
+ 562:	31 d2                	xor    %edx,%edx
+ 564:	89 f7                	mov    %esi,%edi
+ 566:	f7 f3                	div    %ebx
+ 568:	8d 76 01             	lea    0x1(%esi),%esi
+ 56b:	0f b6 92 c8 0b 00 00 	movzbl 0xbc8(%edx),%edx
+ 572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 576:	89 ca                	mov    %ecx,%edx
+ 578:	89 c1                	mov    %eax,%ecx
+ 57a:	39 da                	cmp    %ebx,%edx
+ 57c:	73 e2                	jae    560 <printint+0x30>
+  if(neg)
+ 57e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 581:	85 c0                	test   %eax,%eax
+ 583:	74 07                	je     58c <printint+0x5c>
+    buf[i++] = '-';
+ 585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 58a:	89 f7                	mov    %esi,%edi
+ 58c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 58f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 592:	01 df                	add    %ebx,%edi
+ 594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 59b:	83 ec 04             	sub    $0x4,%esp
+ 59e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5a4:	6a 01                	push   $0x1
+ 5a6:	50                   	push   %eax
+ 5a7:	56                   	push   %esi
+ 5a8:	e8 46 fe ff ff       	call   3f3 <write>
+  while(--i >= 0)
+ 5ad:	89 f8                	mov    %edi,%eax
+ 5af:	83 c4 10             	add    $0x10,%esp
+ 5b2:	83 ef 01             	sub    $0x1,%edi
+ 5b5:	39 d8                	cmp    %ebx,%eax
+ 5b7:	75 df                	jne    598 <printint+0x68>
+}
+ 5b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bc:	5b                   	pop    %ebx
+ 5bd:	5e                   	pop    %esi
+ 5be:	5f                   	pop    %edi
+ 5bf:	5d                   	pop    %ebp
+ 5c0:	c3                   	ret
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5c8:	31 c0                	xor    %eax,%eax
+ 5ca:	eb 89                	jmp    555 <printint+0x25>
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5df:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e2:	83 c6 01             	add    $0x1,%esi
+ 5e5:	84 db                	test   %bl,%bl
+ 5e7:	74 67                	je     650 <printf+0x80>
+ 5e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ec:	31 d2                	xor    %edx,%edx
+ 5ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5f1:	eb 34                	jmp    627 <printf+0x57>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 600:	83 f8 25             	cmp    $0x25,%eax
+ 603:	74 18                	je     61d <printf+0x4d>
+  write(fd, &c, 1);
+ 605:	83 ec 04             	sub    $0x4,%esp
+ 608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 60b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60e:	6a 01                	push   $0x1
+ 610:	50                   	push   %eax
+ 611:	57                   	push   %edi
+ 612:	e8 dc fd ff ff       	call   3f3 <write>
+ 617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 61a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 61d:	0f b6 1e             	movzbl (%esi),%ebx
+ 620:	83 c6 01             	add    $0x1,%esi
+ 623:	84 db                	test   %bl,%bl
+ 625:	74 29                	je     650 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 62a:	85 d2                	test   %edx,%edx
+ 62c:	74 ca                	je     5f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 62e:	83 fa 25             	cmp    $0x25,%edx
+ 631:	75 ea                	jne    61d <printf+0x4d>
+      if(c == 'd'){
+ 633:	83 f8 25             	cmp    $0x25,%eax
+ 636:	0f 84 24 01 00 00    	je     760 <printf+0x190>
+ 63c:	83 e8 63             	sub    $0x63,%eax
+ 63f:	83 f8 15             	cmp    $0x15,%eax
+ 642:	77 1c                	ja     660 <printf+0x90>
+ 644:	ff 24 85 70 0b 00 00 	jmp    *0xb70(,%eax,4)
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 653:	5b                   	pop    %ebx
+ 654:	5e                   	pop    %esi
+ 655:	5f                   	pop    %edi
+ 656:	5d                   	pop    %ebp
+ 657:	c3                   	ret
+ 658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 66a:	6a 01                	push   $0x1
+ 66c:	52                   	push   %edx
+ 66d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 670:	57                   	push   %edi
+ 671:	e8 7d fd ff ff       	call   3f3 <write>
+ 676:	83 c4 0c             	add    $0xc,%esp
+ 679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67c:	6a 01                	push   $0x1
+ 67e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 681:	52                   	push   %edx
+ 682:	57                   	push   %edi
+ 683:	e8 6b fd ff ff       	call   3f3 <write>
+        putc(fd, c);
+ 688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68b:	31 d2                	xor    %edx,%edx
+ 68d:	eb 8e                	jmp    61d <printf+0x4d>
+ 68f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 00                	push   $0x0
+ 69f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6a4:	e8 87 fe ff ff       	call   530 <printint>
+        ap++;
+ 6a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 67 ff ff ff       	jmp    61d <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6c5:	83 c0 04             	add    $0x4,%eax
+ 6c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6cb:	85 db                	test   %ebx,%ebx
+ 6cd:	0f 84 9d 00 00 00    	je     770 <printf+0x1a0>
+        while(*s != 0){
+ 6d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6d8:	84 c0                	test   %al,%al
+ 6da:	0f 84 3d ff ff ff    	je     61d <printf+0x4d>
+ 6e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6e6:	89 de                	mov    %ebx,%esi
+ 6e8:	89 d3                	mov    %edx,%ebx
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	53                   	push   %ebx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 f1 fc ff ff       	call   3f3 <write>
+        while(*s != 0){
+ 702:	0f b6 06             	movzbl (%esi),%eax
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 e4                	jne    6f0 <printf+0x120>
+      state = 0;
+ 70c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 07 ff ff ff       	jmp    61d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 01                	push   $0x1
+ 72f:	e9 6b ff ff ff       	jmp    69f <printf+0xcf>
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	52                   	push   %edx
+ 74c:	57                   	push   %edi
+ 74d:	e8 a1 fc ff ff       	call   3f3 <write>
+        ap++;
+ 752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 758:	31 d2                	xor    %edx,%edx
+ 75a:	e9 be fe ff ff       	jmp    61d <printf+0x4d>
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 769:	6a 01                	push   $0x1
+ 76b:	e9 11 ff ff ff       	jmp    681 <printf+0xb1>
+ 770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 775:	bb 68 0b 00 00       	mov    $0xb68,%ebx
+ 77a:	e9 61 ff ff ff       	jmp    6e0 <printf+0x110>
+ 77f:	90                   	nop
+
+00000780 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 783:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+{
+ 788:	89 e5                	mov    %esp,%ebp
+ 78a:	56                   	push   %esi
+ 78b:	53                   	push   %ebx
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 790:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 792:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 794:	39 ca                	cmp    %ecx,%edx
+ 796:	73 30                	jae    7c8 <lfree+0x48>
+ 798:	39 c1                	cmp    %eax,%ecx
+ 79a:	72 04                	jb     7a0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 79c:	39 c2                	cmp    %eax,%edx
+ 79e:	72 f0                	jb     790 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7a0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 7a3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 7a6:	39 f0                	cmp    %esi,%eax
+ 7a8:	74 26                	je     7d0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7aa:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7ac:	8b 42 04             	mov    0x4(%edx),%eax
+ 7af:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7b2:	39 d9                	cmp    %ebx,%ecx
+ 7b4:	74 30                	je     7e6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7b6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7b8:	5b                   	pop    %ebx
+  freep = p;
+ 7b9:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+}
+ 7bf:	5e                   	pop    %esi
+ 7c0:	5d                   	pop    %ebp
+ 7c1:	c3                   	ret
+ 7c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c8:	39 c1                	cmp    %eax,%ecx
+ 7ca:	72 d0                	jb     79c <lfree+0x1c>
+ 7cc:	eb c2                	jmp    790 <lfree+0x10>
+ 7ce:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 7d0:	03 58 04             	add    0x4(%eax),%ebx
+ 7d3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d6:	8b 02                	mov    (%edx),%eax
+ 7d8:	8b 00                	mov    (%eax),%eax
+ 7da:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 7dc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7df:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7e2:	39 d9                	cmp    %ebx,%ecx
+ 7e4:	75 d0                	jne    7b6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 7e6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 7e9:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+    p->s.size += bp->s.size;
+ 7ef:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7f2:	8b 09                	mov    (%ecx),%ecx
+ 7f4:	89 0a                	mov    %ecx,(%edx)
+}
+ 7f6:	5b                   	pop    %ebx
+ 7f7:	5e                   	pop    %esi
+ 7f8:	5d                   	pop    %ebp
+ 7f9:	c3                   	ret
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000800 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	89 c7                	mov    %eax,%edi
+ 806:	56                   	push   %esi
+ 807:	53                   	push   %ebx
+ 808:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 80b:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+ 810:	85 c0                	test   %eax,%eax
+ 812:	0f 84 88 00 00 00    	je     8a0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 818:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 81a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 81d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 822:	39 df                	cmp    %ebx,%edi
+ 824:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 827:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 82e:	39 f9                	cmp    %edi,%ecx
+ 830:	72 0f                	jb     841 <lalloc+0x41>
+ 832:	eb 4c                	jmp    880 <lalloc+0x80>
+ 834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 838:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 83a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 83d:	39 f9                	cmp    %edi,%ecx
+ 83f:	73 3f                	jae    880 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 841:	89 d0                	mov    %edx,%eax
+ 843:	39 15 c4 0f 00 00    	cmp    %edx,0xfc4
+ 849:	75 ed                	jne    838 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 84b:	83 ec 0c             	sub    $0xc,%esp
+ 84e:	56                   	push   %esi
+ 84f:	e8 07 fc ff ff       	call   45b <sbrk>
+  if(p == (char*)-1)
+ 854:	83 c4 10             	add    $0x10,%esp
+ 857:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 85a:	74 11                	je     86d <lalloc+0x6d>
+  hp->s.size = nu;
+ 85c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 85f:	e8 1c ff ff ff       	call   780 <lfree>
+  return freep;
+ 864:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+      if((p = morecore(nunits)) == 0)
+ 869:	85 c0                	test   %eax,%eax
+ 86b:	75 cb                	jne    838 <lalloc+0x38>
+        return 0;
+  }
+}
+ 86d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 870:	31 d2                	xor    %edx,%edx
+}
+ 872:	5b                   	pop    %ebx
+ 873:	89 d0                	mov    %edx,%eax
+ 875:	5e                   	pop    %esi
+ 876:	5f                   	pop    %edi
+ 877:	5d                   	pop    %ebp
+ 878:	c3                   	ret
+ 879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 880:	39 cf                	cmp    %ecx,%edi
+ 882:	74 4c                	je     8d0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 884:	29 f9                	sub    %edi,%ecx
+ 886:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 889:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 88c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 88f:	a3 c4 0f 00 00       	mov    %eax,0xfc4
+}
+ 894:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 897:	89 d0                	mov    %edx,%eax
+ 899:	5b                   	pop    %ebx
+ 89a:	5e                   	pop    %esi
+ 89b:	5f                   	pop    %edi
+ 89c:	5d                   	pop    %ebp
+ 89d:	c3                   	ret
+ 89e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 8a0:	ba c8 0f 00 00       	mov    $0xfc8,%edx
+ 8a5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 8a7:	c7 05 c4 0f 00 00 c8 	movl   $0xfc8,0xfc4
+ 8ae:	0f 00 00 
+ 8b1:	c7 05 c8 0f 00 00 c8 	movl   $0xfc8,0xfc8
+ 8b8:	0f 00 00 
+ 8bb:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 8bd:	c7 05 cc 0f 00 00 00 	movl   $0x0,0xfcc
+ 8c4:	00 00 00 
+ 8c7:	e9 51 ff ff ff       	jmp    81d <lalloc+0x1d>
+ 8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 8d0:	8b 0a                	mov    (%edx),%ecx
+ 8d2:	89 08                	mov    %ecx,(%eax)
+ 8d4:	eb b9                	jmp    88f <lalloc+0x8f>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 8e9:	85 f6                	test   %esi,%esi
+ 8eb:	74 42                	je     92f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 8ed:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 8f0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 8f3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 8f9:	77 3d                	ja     938 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 8fb:	31 c9                	xor    %ecx,%ecx
+ 8fd:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 902:	83 fa 02             	cmp    $0x2,%edx
+ 905:	74 17                	je     91e <free+0x3e>
+ 907:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90e:	66 90                	xchg   %ax,%ax
+ 910:	83 c1 01             	add    $0x1,%ecx
+ 913:	89 d8                	mov    %ebx,%eax
+ 915:	d3 e0                	shl    %cl,%eax
+ 917:	83 c0 01             	add    $0x1,%eax
+ 91a:	39 c2                	cmp    %eax,%edx
+ 91c:	75 f2                	jne    910 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 91e:	8b 04 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%eax
+  classes[c] = bp;
+ 925:	89 3c 8d a0 0f 00 00 	mov    %edi,0xfa0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 92c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 92f:	5b                   	pop    %ebx
+ 930:	5e                   	pop    %esi
+ 931:	5f                   	pop    %edi
+ 932:	5d                   	pop    %ebp
+ 933:	c3                   	ret
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 938:	5b                   	pop    %ebx
+    lfree(bp);
+ 939:	89 f8                	mov    %edi,%eax
+}
+ 93b:	5e                   	pop    %esi
+ 93c:	5f                   	pop    %edi
+ 93d:	5d                   	pop    %ebp
+    lfree(bp);
+ 93e:	e9 3d fe ff ff       	jmp    780 <lfree>
+ 943:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000950 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 959:	8b 45 08             	mov    0x8(%ebp),%eax
+ 95c:	83 c0 07             	add    $0x7,%eax
+ 95f:	c1 e8 03             	shr    $0x3,%eax
+ 962:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 965:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 96a:	77 44                	ja     9b0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 96c:	31 c9                	xor    %ecx,%ecx
+ 96e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 973:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 978:	83 f8 02             	cmp    $0x2,%eax
+ 97b:	76 11                	jbe    98e <malloc+0x3e>
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+ 980:	83 c1 01             	add    $0x1,%ecx
+ 983:	89 d3                	mov    %edx,%ebx
+ 985:	d3 e3                	shl    %cl,%ebx
+ 987:	83 c3 01             	add    $0x1,%ebx
+ 98a:	39 c3                	cmp    %eax,%ebx
+ 98c:	72 f2                	jb     980 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 98e:	8b 04 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%eax
+ 995:	85 c0                	test   %eax,%eax
+ 997:	74 2f                	je     9c8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 999:	8b 10                	mov    (%eax),%edx
+ 99b:	89 14 8d a0 0f 00 00 	mov    %edx,0xfa0(,%ecx,4)
+  return (void*)(p + 1);
+ 9a2:	83 c0 08             	add    $0x8,%eax
+}
+ 9a5:	83 c4 1c             	add    $0x1c,%esp
+ 9a8:	5b                   	pop    %ebx
+ 9a9:	5e                   	pop    %esi
+ 9aa:	5f                   	pop    %edi
+ 9ab:	5d                   	pop    %ebp
+ 9ac:	c3                   	ret
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 9b0:	e8 4b fe ff ff       	call   800 <lalloc>
+ 9b5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 9b7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 9ba:	85 d2                	test   %edx,%edx
+ 9bc:	75 e7                	jne    9a5 <malloc+0x55>
+      return 0;
+ 9be:	31 c0                	xor    %eax,%eax
+ 9c0:	eb e3                	jmp    9a5 <malloc+0x55>
+ 9c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 9c8:	31 d2                	xor    %edx,%edx
+ 9ca:	b8 00 02 00 00       	mov    $0x200,%eax
+ 9cf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9d2:	f7 f3                	div    %ebx
+  if(n < 4)
+ 9d4:	ba 04 00 00 00       	mov    $0x4,%edx
+ 9d9:	89 d6                	mov    %edx,%esi
+ 9db:	39 d0                	cmp    %edx,%eax
+ 9dd:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 9e0:	0f af f3             	imul   %ebx,%esi
+ 9e3:	89 f0                	mov    %esi,%eax
+ 9e5:	e8 16 fe ff ff       	call   800 <lalloc>
+ 9ea:	85 c0                	test   %eax,%eax
+ 9ec:	74 d0                	je     9be <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 9ee:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9f1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 9f4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9fb:	8b 14 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%edx
+ a02:	39 f8                	cmp    %edi,%eax
+ a04:	73 22                	jae    a28 <malloc+0xd8>
+ a06:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a09:	eb 09                	jmp    a14 <malloc+0xc4>
+ a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+ a10:	89 c2                	mov    %eax,%edx
+ a12:	89 c8                	mov    %ecx,%eax
+ a14:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ a17:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ a1a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ a1c:	39 f9                	cmp    %edi,%ecx
+ a1e:	72 f0                	jb     a10 <malloc+0xc0>
+ a20:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a23:	e9 73 ff ff ff       	jmp    99b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ a28:	89 d0                	mov    %edx,%eax
+ a2a:	8b 12                	mov    (%edx),%edx
+ a2c:	e9 6a ff ff ff       	jmp    99b <malloc+0x4b>
+ a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+
+00000a40 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	56                   	push   %esi
+ a44:	53                   	push   %ebx
+ a45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ a4b:	85 c9                	test   %ecx,%ecx
+ a4d:	74 06                	je     a55 <calloc+0x15>
+ a4f:	89 c8                	mov    %ecx,%eax
+ a51:	f7 e3                	mul    %ebx
+ a53:	70 33                	jo     a88 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ a55:	0f af d9             	imul   %ecx,%ebx
+ a58:	83 ec 0c             	sub    $0xc,%esp
+ a5b:	53                   	push   %ebx
+ a5c:	e8 ef fe ff ff       	call   950 <malloc>
+ a61:	83 c4 10             	add    $0x10,%esp
+ a64:	89 c6                	mov    %eax,%esi
+ a66:	85 c0                	test   %eax,%eax
+ a68:	74 1e                	je     a88 <calloc+0x48>
+    memset(p, 0, n * size);
+ a6a:	83 ec 04             	sub    $0x4,%esp
+ a6d:	53                   	push   %ebx
+ a6e:	6a 00                	push   $0x0
+ a70:	50                   	push   %eax
+ a71:	e8 3a f7 ff ff       	call   1b0 <memset>
+ a76:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ a79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a7c:	89 f0                	mov    %esi,%eax
+ a7e:	5b                   	pop    %ebx
+ a7f:	5e                   	pop    %esi
+ a80:	5d                   	pop    %ebp
+ a81:	c3                   	ret
+ a82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a8b:	31 f6                	xor    %esi,%esi
+}
+ a8d:	89 f0                	mov    %esi,%eax
+ a8f:	5b                   	pop    %ebx
+ a90:	5e                   	pop    %esi
+ a91:	5d                   	pop    %ebp
+ a92:	c3                   	ret
+ a93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000aa0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	53                   	push   %ebx
+ aa6:	83 ec 0c             	sub    $0xc,%esp
+ aa9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ aac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ aaf:	85 db                	test   %ebx,%ebx
+ ab1:	74 55                	je     b08 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ab3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ab6:	89 de                	mov    %ebx,%esi
+ ab8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ abf:	39 c7                	cmp    %eax,%edi
+ ac1:	72 0d                	jb     ad0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ ac3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ac6:	89 f0                	mov    %esi,%eax
+ ac8:	5b                   	pop    %ebx
+ ac9:	5e                   	pop    %esi
+ aca:	5f                   	pop    %edi
+ acb:	5d                   	pop    %ebp
+ acc:	c3                   	ret
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ ad0:	83 ec 0c             	sub    $0xc,%esp
+ ad3:	50                   	push   %eax
+ ad4:	e8 77 fe ff ff       	call   950 <malloc>
+ ad9:	83 c4 10             	add    $0x10,%esp
+ adc:	89 c6                	mov    %eax,%esi
+ ade:	85 c0                	test   %eax,%eax
+ ae0:	74 e1                	je     ac3 <realloc+0x23>
+  memmove(p, ap, have);
+ ae2:	83 ec 04             	sub    $0x4,%esp
+ ae5:	57                   	push   %edi
+ ae6:	53                   	push   %ebx
+ ae7:	50                   	push   %eax
+ ae8:	e8 b3 f8 ff ff       	call   3a0 <memmove>
+  free(ap);
+ aed:	89 1c 24             	mov    %ebx,(%esp)
+ af0:	e8 eb fd ff ff       	call   8e0 <free>
+  return p;
+ af5:	83 c4 10             	add    $0x10,%esp
+}
+ af8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ afb:	89 f0                	mov    %esi,%eax
+ afd:	5b                   	pop    %ebx
+ afe:	5e                   	pop    %esi
+ aff:	5f                   	pop    %edi
+ b00:	5d                   	pop    %ebp
+ b01:	c3                   	ret
+ b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b08:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b0e:	5b                   	pop    %ebx
+ b0f:	5e                   	pop    %esi
+ b10:	5f                   	pop    %edi
+ b11:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b12:	e9 39 fe ff ff       	jmp    950 <malloc>
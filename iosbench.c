@@ -0,0 +1,102 @@
+// Compare the disk scheduler policies.  Under each one, a child
+// rewrites a 32 KB file, so the disk sees log and file writes,
+// while the parent reads every file in / from a cold cache.
+// Prints the time taken and the read and write latencies.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+#define WSIZE   (32*1024)
+#define WPASSES 10
+
+char buf[4096];
+char *policies[] = {
+[IOS_FIFO]     "fifo",
+[IOS_CLOOK]    "c-look",
+[IOS_DEADLINE] "deadline",
+};
+
+static void
+readall(void)
+{
+  char path[DIRSIZ+2];
+  struct dirent de;
+  struct stat st;
+  int dfd, fd;
+
+  dfd = open("/", O_RDONLY);
+  while(read(dfd, &de, sizeof(de)) == sizeof(de)){
+    if(de.inum == 0)
+      continue;
+    path[0] = '/';
+    memmove(path + 1, de.name, DIRSIZ);
+    path[DIRSIZ+1] = 0;
+    if((fd = open(path, O_RDONLY)) < 0)
+      continue;
+    if(fstat(fd, &st) == 0 && st.type == T_FILE)
+      while(read(fd, buf, sizeof(buf)) > 0)
+        ;
+    close(fd);
+  }
+  close(dfd);
+}
+
+static void
+writeall(void)
+{
+  int fd, i, j;
+
+  for(i = 0; i < WPASSES; i++){
+    if((fd = open("iosbench.tmp", O_CREATE|O_WRONLY)) < 0){
+      printf(2, "iosbench: cannot create iosbench.tmp\n");
+      exit();
+    }
+    for(j = 0; j < WSIZE; j += sizeof(buf))
+      write(fd, buf, sizeof(buf));
+    close(fd);
+  }
+}
+
+static void
+avg(char *what, uint n, uint tot, uint max)
+{
+  printf(1, ", %s %d avg %d max", what, n ? tot / n : 0, max);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat st;
+  int p, old, t;
+
+  old = -1;
+  for(p = 0; p < sizeof(policies)/sizeof(policies[0]); p++){
+    dropcache();
+    if((t = iosched(p)) < 0){
+      printf(2, "iosbench: iosched failed\n");
+      exit();
+    }
+    if(old < 0)
+      old = t;
+    t = uptime();
+    if(fork() == 0){
+      writeall();
+      exit();
+    }
+    readall();
+    wait();
+    t = uptime() - t;
+    iostat(&st);
+    printf(1, "%s: %d ms", policies[p], t);
+    avg("read", st.nread, st.readlat, st.readmax);
+    avg("write", st.nwrite, st.writelat, st.writemax);
+    printf(1, " Kcycles\n");
+  }
+  iosched(old);
+  unlink("iosbench.tmp");
+  exit();
+}
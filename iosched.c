@@ -0,0 +1,326 @@
+// Disk request scheduler.
+//
+// The IDE driver hands each buf to iosadd() and asks iosnext()
+// which one the disk should do next.  A policy decides:
+// * IOS_FIFO: in order of arrival.
+// * IOS_CLOOK: the C-LOOK elevator.  The head sweeps towards
+//   higher block numbers, serving the nearest request at or
+//   after its position, and jumps back to the lowest request
+//   when none is left ahead of it.
+// * IOS_DEADLINE: C-LOOK, but reads go first, a write at most
+//   every WSTARVE picks while reads wait, and a request that
+//   has waited past its deadline goes first of all.
+//
+// Requests wait in an ioq, which files each buf both in arrival
+// order and under its zone of ZONE blocks, with a bitmap of the
+// zones that are not empty.  Adding or removing a buf is O(1);
+// finding the next request up the disk scans the bitmap and one
+// zone.  The deadline policy keeps reads and writes in separate
+// ioqs.
+//
+// The caller holds idelock for all of these.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iostat.h"
+
+#define ZONE      128   // blocks per zone
+#define NZONE     ((FSSIZE + SWAPSIZE + ZONE - 1) / ZONE)
+#define RDEADLINE 50    // ms a read may wait before it goes first
+#define WDEADLINE 500   // ms a write may wait
+#define WSTARVE   4     // reads picked in a row while writes wait
+
+struct ioq {
+  struct buf *zone[NZONE];      // through qnext/qprev
+  uint map[(NZONE + 31) / 32];  // bit set if zone not empty
+  struct buf *head;             // oldest; through fnext/fprev
+  struct buf *tail;
+  int n;
+};
+
+struct policy {
+  char *name;
+  struct ioq *(*queue)(struct buf*);   // where b waits
+  struct buf *(*pick)(void);           // next buf to serve
+};
+
+static struct ioq ioq[2];
+static uint headpos;      // block after the last request served
+static int starved;       // reads picked while writes waited
+
+// Latency statistics, in Kcycles.
+static uint nread, readlat, readmax;
+static uint nwrite, writelat, writemax;
+
+static uint
+kcycles(void)
+{
+  return rdtsc() >> 10;
+}
+
+static void
+qadd(struct ioq *q, struct buf *b)
+{
+  uint z;
+
+  z = b->blockno / ZONE;
+  b->qprev = 0;
+  b->qnext = q->zone[z];
+  if(q->zone[z])
+    q->zone[z]->qprev = b;
+  q->zone[z] = b;
+  q->map[z/32] |= 1 << (z%32);
+
+  b->fnext = 0;
+  b->fprev = q->tail;
+  if(q->tail)
+    q->tail->fnext = b;
+  else
+    q->head = b;
+  q->tail = b;
+  q->n++;
+}
+
+static void
+qremove(struct ioq *q, struct buf *b)
+{
+  uint z;
+
+  z = b->blockno / ZONE;
+  if(b->qprev)
+    b->qprev->qnext = b->qnext;
+  else
+    q->zone[z] = b->qnext;
+  if(b->qnext)
+    b->qnext->qprev = b->qprev;
+  if(q->zone[z] == 0)
+    q->map[z/32] &= ~(1 << (z%32));
+
+  if(b->fprev)
+    b->fprev->fnext = b->fnext;
+  else
+    q->head = b->fnext;
+  if(b->fnext)
+    b->fnext->fprev = b->fprev;
+  else
+    q->tail = b->fprev;
+  q->n--;
+}
+
+// The buf in q with the lowest block number at or after pos,
+// or 0 if there is none.
+static struct buf*
+above(struct ioq *q, uint pos)
+{
+  struct buf *b, *best;
+  uint z;
+
+  z = pos / ZONE;
+  while(z < NZONE){
+    if((q->map[z/32] >> (z%32)) == 0){
+      z = (z/32 + 1) * 32;
+      continue;
+    }
+    if(q->map[z/32] & (1 << (z%32))){
+      best = 0;
+      for(b = q->zone[z]; b; b = b->qnext)
+        if(b->blockno >= pos && (best == 0 || b->blockno < best->blockno))
+          best = b;
+      if(best)
+        return best;
+    }
+    z++;
+  }
+  return 0;
+}
+
+static struct buf*
+clook(struct ioq *q)
+{
+  struct buf *b;
+
+  if(q->n == 0)
+    return 0;
+  if((b = above(q, headpos)) != 0)
+    return b;
+  return above(q, 0);
+}
+
+static struct ioq*
+onequeue(struct buf *b)
+{
+  return &ioq[0];
+}
+
+static struct ioq*
+rwqueue(struct buf *b)
+{
+  return (b->flags & B_DIRTY) ? &ioq[1] : &ioq[0];
+}
+
+static struct buf*
+fifopick(void)
+{
+  return ioq[0].head;
+}
+
+static struct buf*
+clookpick(void)
+{
+  return clook(&ioq[0]);
+}
+
+static struct buf*
+deadlinepick(void)
+{
+  struct ioq *r, *w;
+
+  r = &ioq[0];
+  w = &ioq[1];
+  if(r->head && ticks - r->head->qtick >= RDEADLINE)
+    return r->head;
+  if(w->head && ticks - w->head->qtick >= WDEADLINE)
+    return w->head;
+  if(r->n > 0 && (w->n == 0 || starved < WSTARVE)){
+    if(w->n > 0)
+      starved++;
+    return clook(r);
+  }
+  starved = 0;
+  return clook(w);
+}
+
+static struct policy policies[] = {
+[IOS_FIFO]     { "fifo",     onequeue, fifopick },
+[IOS_CLOOK]    { "c-look",   onequeue, clookpick },
+[IOS_DEADLINE] { "deadline", rwqueue,  deadlinepick },
+};
+
+static struct policy *policy = &policies[IOS_DEADLINE];
+
+// Queue b for the disk.
+void
+iosadd(struct buf *b)
+{
+  b->qtick = ticks;
+  b->qtsc = kcycles();
+  qadd(policy->queue(b), b);
+}
+
+// Take the request the policy picks off the queue, or return 0
+// if there is none.
+struct buf*
+iosnext(void)
+{
+  struct buf *b;
+
+  if((b = policy->pick()) != 0)
+    qremove(policy->queue(b), b);
+  return b;
+}
+
+// Also take up to max-1 bufs queued for the blocks after b's, on
+// the same disk and in the same direction, chained to b through
+// qnext.  Returns how many bufs the request now has.
+int
+iosmerge(struct buf *b, int max)
+{
+  struct ioq *q;
+  struct buf *last, *x;
+  uint bn, z;
+  int n;
+
+  q = policy->queue(b);
+  last = b;
+  for(n = 1; n < max; n++){
+    bn = b->blockno + n;
+    z = bn / ZONE;
+    if(z >= NZONE)
+      break;
+    for(x = q->zone[z]; x; x = x->qnext)
+      if(x->blockno == bn && x->dev == b->dev &&
+         (x->flags & B_DIRTY) == (b->flags & B_DIRTY))
+        break;
+    if(x == 0)
+      break;
+    qremove(q, x);
+    last->qnext = x;
+    last = x;
+  }
+  last->qnext = 0;
+  headpos = b->blockno + n;
+  return n;
+}
+
+// Record that the disk finished b.
+void
+iosdone(struct buf *b)
+{
+  uint t;
+
+  t = kcycles() - b->qtsc;
+  if(b->flags & B_DIRTY){
+    nwrite++;
+    writelat += t;
+    if(t > writemax)
+      writemax = t;
+  } else {
+    nread++;
+    readlat += t;
+    if(t > readmax)
+      readmax = t;
+  }
+}
+
+// Switch to policy n, requeueing whatever waits, and start new
+// latency statistics.  Returns the policy before, or -1 if n is
+// not a policy.
+int
+iosset(int n)
+{
+  struct buf *b, *list, **tail;
+  int i, old;
+
+  if(n < 0 || n >= NELEM(policies))
+    return -1;
+  old = policy - policies;
+
+  list = 0;
+  tail = &list;
+  for(i = 0; i < 2; i++){
+    while((b = ioq[i].head) != 0){
+      qremove(&ioq[i], b);
+      *tail = b;
+      tail = &b->fnext;
+    }
+  }
+  *tail = 0;
+  policy = &policies[n];
+  for(; list; list = b){
+    b = list->fnext;
+    qadd(policy->queue(list), list);
+  }
+
+  nread = readlat = readmax = 0;
+  nwrite = writelat = writemax = 0;
+  starved = 0;
+  return old;
+}
+
+void
+iosstat(struct iostat *st)
+{
+  safestrcpy(st->sched, policy->name, sizeof(st->sched));
+  st->nread = nread;
+  st->readlat = readlat;
+  st->readmax = readmax;
+  st->nwrite = nwrite;
+  st->writelat = writelat;
+  st->writemax = writemax;
+}
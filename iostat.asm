@@ -0,0 +1,2015 @@
+
+_iostat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  struct iostat a, b;
+  int i;
+
+  if(argc > 2 && strcmp(argv[1], "-r") == 0){
+  16:	83 39 02             	cmpl   $0x2,(%ecx)
+{
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 2 && strcmp(argv[1], "-r") == 0){
+  1c:	7e 72                	jle    90 <main+0x90>
+  1e:	50                   	push   %eax
+  1f:	50                   	push   %eax
+  20:	68 a2 0e 00 00       	push   $0xea2
+  25:	ff 73 04             	push   0x4(%ebx)
+  28:	e8 b3 03 00 00       	call   3e0 <strcmp>
+  2d:	83 c4 10             	add    $0x10,%esp
+  30:	85 c0                	test   %eax,%eax
+  32:	75 3d                	jne    71 <main+0x71>
+    get(&a);
+  34:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+  3a:	e8 41 03 00 00       	call   380 <get>
+    if(fork() == 0){
+  3f:	e8 47 06 00 00       	call   68b <fork>
+  44:	85 c0                	test   %eax,%eax
+  46:	0f 85 98 00 00 00    	jne    e4 <main+0xe4>
+      exec(argv[2], argv + 2);
+  4c:	8d 43 08             	lea    0x8(%ebx),%eax
+  4f:	56                   	push   %esi
+  50:	56                   	push   %esi
+  51:	50                   	push   %eax
+  52:	ff 73 08             	push   0x8(%ebx)
+  55:	e8 71 06 00 00       	call   6cb <exec>
+      printf(2, "iostat: exec %s failed\n", argv[2]);
+  5a:	83 c4 0c             	add    $0xc,%esp
+  5d:	ff 73 08             	push   0x8(%ebx)
+  60:	68 a5 0e 00 00       	push   $0xea5
+  65:	6a 02                	push   $0x2
+  67:	e8 24 08 00 00       	call   890 <printf>
+      exit();
+  6c:	e8 22 06 00 00       	call   693 <exit>
+    b.commitblocks -= a.commitblocks;
+    b.commitlat -= a.commitlat;
+    print(&b);
+    exit();
+  }
+  if(argc > 2 && strcmp(argv[1], "-s") == 0){
+  71:	51                   	push   %ecx
+  72:	51                   	push   %ecx
+  73:	68 bd 0e 00 00       	push   $0xebd
+  78:	ff 73 04             	push   0x4(%ebx)
+  7b:	e8 60 03 00 00       	call   3e0 <strcmp>
+  80:	83 c4 10             	add    $0x10,%esp
+  83:	89 c6                	mov    %eax,%esi
+  85:	85 c0                	test   %eax,%eax
+  87:	74 22                	je     ab <main+0xab>
+  89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(i == NELEM(policies) || iosched(i) < 0){
+      printf(2, "iostat: no policy %s\n", argv[2]);
+      exit();
+    }
+  }
+  get(&a);
+  90:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+  96:	e8 e5 02 00 00       	call   380 <get>
+  print(&a);
+  9b:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+  a1:	e8 4a 01 00 00       	call   1f0 <print>
+  exit();
+  a6:	e8 e8 05 00 00       	call   693 <exit>
+      if(strcmp(argv[2], policies[i]) == 0)
+  ab:	52                   	push   %edx
+  ac:	52                   	push   %edx
+  ad:	ff 34 b5 f4 13 00 00 	push   0x13f4(,%esi,4)
+  b4:	ff 73 08             	push   0x8(%ebx)
+  b7:	e8 24 03 00 00       	call   3e0 <strcmp>
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	85 c0                	test   %eax,%eax
+  c1:	0f 84 a3 00 00 00    	je     16a <main+0x16a>
+    for(i = 0; i < NELEM(policies); i++)
+  c7:	83 c6 01             	add    $0x1,%esi
+  ca:	83 fe 03             	cmp    $0x3,%esi
+  cd:	75 dc                	jne    ab <main+0xab>
+      printf(2, "iostat: no policy %s\n", argv[2]);
+  cf:	50                   	push   %eax
+  d0:	ff 73 08             	push   0x8(%ebx)
+  d3:	68 c0 0e 00 00       	push   $0xec0
+  d8:	6a 02                	push   $0x2
+  da:	e8 b1 07 00 00       	call   890 <printf>
+      exit();
+  df:	e8 af 05 00 00       	call   693 <exit>
+    wait();
+  e4:	e8 b2 05 00 00       	call   69b <wait>
+    get(&b);
+  e9:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  ec:	e8 8f 02 00 00       	call   380 <get>
+    b.hits -= a.hits;
+  f1:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+  f7:	29 45 9c             	sub    %eax,-0x64(%ebp)
+    b.misses -= a.misses;
+  fa:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+ 100:	29 45 a0             	sub    %eax,-0x60(%ebp)
+    b.writes -= a.writes;
+ 103:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+ 109:	29 45 a4             	sub    %eax,-0x5c(%ebp)
+    b.readaheads -= a.readaheads;
+ 10c:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+ 112:	29 45 a8             	sub    %eax,-0x58(%ebp)
+    b.diskreqs -= a.diskreqs;
+ 115:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+ 11b:	29 45 ac             	sub    %eax,-0x54(%ebp)
+    b.diskblocks -= a.diskblocks;
+ 11e:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+ 124:	29 45 b0             	sub    %eax,-0x50(%ebp)
+    b.nread -= a.nread;
+ 127:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+ 12d:	29 45 c0             	sub    %eax,-0x40(%ebp)
+    b.readlat -= a.readlat;
+ 130:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+ 136:	29 45 c4             	sub    %eax,-0x3c(%ebp)
+    b.nwrite -= a.nwrite;
+ 139:	8b 85 78 ff ff ff    	mov    -0x88(%ebp),%eax
+ 13f:	29 45 cc             	sub    %eax,-0x34(%ebp)
+    b.writelat -= a.writelat;
+ 142:	8b 85 7c ff ff ff    	mov    -0x84(%ebp),%eax
+ 148:	29 45 d0             	sub    %eax,-0x30(%ebp)
+    b.ncommit -= a.ncommit;
+ 14b:	8b 45 84             	mov    -0x7c(%ebp),%eax
+ 14e:	29 45 d8             	sub    %eax,-0x28(%ebp)
+    b.commitblocks -= a.commitblocks;
+ 151:	8b 45 88             	mov    -0x78(%ebp),%eax
+ 154:	29 45 dc             	sub    %eax,-0x24(%ebp)
+    b.commitlat -= a.commitlat;
+ 157:	8b 45 8c             	mov    -0x74(%ebp),%eax
+ 15a:	29 45 e0             	sub    %eax,-0x20(%ebp)
+    print(&b);
+ 15d:	8d 45 94             	lea    -0x6c(%ebp),%eax
+ 160:	e8 8b 00 00 00       	call   1f0 <print>
+    exit();
+ 165:	e8 29 05 00 00       	call   693 <exit>
+    if(i == NELEM(policies) || iosched(i) < 0){
+ 16a:	83 ec 0c             	sub    $0xc,%esp
+ 16d:	56                   	push   %esi
+ 16e:	e8 00 06 00 00       	call   773 <iosched>
+ 173:	83 c4 10             	add    $0x10,%esp
+ 176:	85 c0                	test   %eax,%eax
+ 178:	0f 89 12 ff ff ff    	jns    90 <main+0x90>
+ 17e:	e9 4c ff ff ff       	jmp    cf <main+0xcf>
+ 183:	66 90                	xchg   %ax,%ax
+ 185:	66 90                	xchg   %ax,%ax
+ 187:	66 90                	xchg   %ax,%ax
+ 189:	66 90                	xchg   %ax,%ax
+ 18b:	66 90                	xchg   %ax,%ax
+ 18d:	66 90                	xchg   %ax,%ax
+ 18f:	90                   	nop
+
+00000190 <latency>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	89 ce                	mov    %ecx,%esi
+ 196:	53                   	push   %ebx
+ 197:	89 d3                	mov    %edx,%ebx
+  printf(1, "%s\t%d blocks", what, n);
+ 199:	52                   	push   %edx
+ 19a:	50                   	push   %eax
+ 19b:	68 d8 0d 00 00       	push   $0xdd8
+ 1a0:	6a 01                	push   $0x1
+ 1a2:	e8 e9 06 00 00       	call   890 <printf>
+  if(n > 0)
+ 1a7:	83 c4 10             	add    $0x10,%esp
+ 1aa:	85 db                	test   %ebx,%ebx
+ 1ac:	75 19                	jne    1c7 <latency+0x37>
+  printf(1, "\n");
+ 1ae:	83 ec 08             	sub    $0x8,%esp
+ 1b1:	68 01 0e 00 00       	push   $0xe01
+ 1b6:	6a 01                	push   $0x1
+ 1b8:	e8 d3 06 00 00       	call   890 <printf>
+}
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1c3:	5b                   	pop    %ebx
+ 1c4:	5e                   	pop    %esi
+ 1c5:	5d                   	pop    %ebp
+ 1c6:	c3                   	ret
+    printf(1, ", latency %d avg, %d max Kcycles", tot / n, max);
+ 1c7:	89 f0                	mov    %esi,%eax
+ 1c9:	31 d2                	xor    %edx,%edx
+ 1cb:	ff 75 08             	push   0x8(%ebp)
+ 1ce:	f7 f3                	div    %ebx
+ 1d0:	50                   	push   %eax
+ 1d1:	68 ec 0e 00 00       	push   $0xeec
+ 1d6:	6a 01                	push   $0x1
+ 1d8:	e8 b3 06 00 00       	call   890 <printf>
+ 1dd:	83 c4 10             	add    $0x10,%esp
+ 1e0:	eb cc                	jmp    1ae <latency+0x1e>
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <print>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+ 1f5:	53                   	push   %ebx
+ 1f6:	89 c3                	mov    %eax,%ebx
+ 1f8:	83 ec 18             	sub    $0x18,%esp
+  n = st->hits + st->misses;
+ 1fb:	8b 70 0c             	mov    0xc(%eax),%esi
+ 1fe:	03 70 08             	add    0x8(%eax),%esi
+         st->nbuf / 2);
+ 201:	8b 00                	mov    (%eax),%eax
+  printf(1, "bcache\t%d/%d buffers (%d KB)\n", st->nbuf, st->maxbuf,
+ 203:	89 c2                	mov    %eax,%edx
+ 205:	d1 ea                	shr    %edx
+ 207:	52                   	push   %edx
+ 208:	ff 73 04             	push   0x4(%ebx)
+ 20b:	50                   	push   %eax
+ 20c:	68 e5 0d 00 00       	push   $0xde5
+ 211:	6a 01                	push   $0x1
+ 213:	e8 78 06 00 00       	call   890 <printf>
+  printf(1, "reads\t%d: %d hits, %d misses", n, st->hits, st->misses);
+ 218:	83 c4 14             	add    $0x14,%esp
+ 21b:	ff 73 0c             	push   0xc(%ebx)
+ 21e:	ff 73 08             	push   0x8(%ebx)
+ 221:	56                   	push   %esi
+ 222:	68 03 0e 00 00       	push   $0xe03
+ 227:	6a 01                	push   $0x1
+ 229:	e8 62 06 00 00       	call   890 <printf>
+  if(n >= 100)
+ 22e:	83 c4 20             	add    $0x20,%esp
+ 231:	83 fe 63             	cmp    $0x63,%esi
+ 234:	0f 87 c4 00 00 00    	ja     2fe <print+0x10e>
+  printf(1, "\nahead\t%d blocks read ahead\n", st->readaheads);
+ 23a:	83 ec 04             	sub    $0x4,%esp
+ 23d:	ff 73 14             	push   0x14(%ebx)
+ 240:	68 2b 0e 00 00       	push   $0xe2b
+ 245:	6a 01                	push   $0x1
+ 247:	e8 44 06 00 00       	call   890 <printf>
+  printf(1, "writes\t%d\n", st->writes);
+ 24c:	83 c4 0c             	add    $0xc,%esp
+ 24f:	ff 73 10             	push   0x10(%ebx)
+ 252:	68 48 0e 00 00       	push   $0xe48
+ 257:	6a 01                	push   $0x1
+ 259:	e8 32 06 00 00       	call   890 <printf>
+  printf(1, "disk\t%d commands for %d blocks", st->diskreqs, st->diskblocks);
+ 25e:	ff 73 1c             	push   0x1c(%ebx)
+ 261:	ff 73 18             	push   0x18(%ebx)
+ 264:	68 10 0f 00 00       	push   $0xf10
+ 269:	6a 01                	push   $0x1
+ 26b:	e8 20 06 00 00       	call   890 <printf>
+  if(st->diskreqs > 0)
+ 270:	8b 4b 18             	mov    0x18(%ebx),%ecx
+ 273:	83 c4 20             	add    $0x20,%esp
+ 276:	85 c9                	test   %ecx,%ecx
+ 278:	0f 85 d1 00 00 00    	jne    34f <print+0x15f>
+  printf(1, "\n");
+ 27e:	83 ec 08             	sub    $0x8,%esp
+ 281:	68 01 0e 00 00       	push   $0xe01
+ 286:	6a 01                	push   $0x1
+ 288:	e8 03 06 00 00       	call   890 <printf>
+  printf(1, "sched\t%s\n", st->sched);
+ 28d:	83 c4 0c             	add    $0xc,%esp
+ 290:	8d 43 20             	lea    0x20(%ebx),%eax
+ 293:	50                   	push   %eax
+ 294:	68 67 0e 00 00       	push   $0xe67
+ 299:	6a 01                	push   $0x1
+ 29b:	e8 f0 05 00 00       	call   890 <printf>
+  latency("read", st->nread, st->readlat, st->readmax);
+ 2a0:	58                   	pop    %eax
+ 2a1:	8b 4b 30             	mov    0x30(%ebx),%ecx
+ 2a4:	b8 71 0e 00 00       	mov    $0xe71,%eax
+ 2a9:	8b 53 2c             	mov    0x2c(%ebx),%edx
+ 2ac:	ff 73 34             	push   0x34(%ebx)
+ 2af:	e8 dc fe ff ff       	call   190 <latency>
+  latency("write", st->nwrite, st->writelat, st->writemax);
+ 2b4:	8b 4b 3c             	mov    0x3c(%ebx),%ecx
+ 2b7:	8b 53 38             	mov    0x38(%ebx),%edx
+ 2ba:	b8 76 0e 00 00       	mov    $0xe76,%eax
+ 2bf:	5e                   	pop    %esi
+ 2c0:	ff 73 40             	push   0x40(%ebx)
+ 2c3:	e8 c8 fe ff ff       	call   190 <latency>
+  printf(1, "log\t%d commits", st->ncommit);
+ 2c8:	83 c4 0c             	add    $0xc,%esp
+ 2cb:	ff 73 44             	push   0x44(%ebx)
+ 2ce:	68 7c 0e 00 00       	push   $0xe7c
+ 2d3:	6a 01                	push   $0x1
+ 2d5:	e8 b6 05 00 00       	call   890 <printf>
+  if(st->ncommit > 0)
+ 2da:	8b 4b 44             	mov    0x44(%ebx),%ecx
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	85 c9                	test   %ecx,%ecx
+ 2e2:	75 44                	jne    328 <print+0x138>
+  printf(1, "\n");
+ 2e4:	83 ec 08             	sub    $0x8,%esp
+ 2e7:	68 01 0e 00 00       	push   $0xe01
+ 2ec:	6a 01                	push   $0x1
+ 2ee:	e8 9d 05 00 00       	call   890 <printf>
+}
+ 2f3:	83 c4 10             	add    $0x10,%esp
+ 2f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2f9:	5b                   	pop    %ebx
+ 2fa:	5e                   	pop    %esi
+ 2fb:	5f                   	pop    %edi
+ 2fc:	5d                   	pop    %ebp
+ 2fd:	c3                   	ret
+    printf(1, ", %d%% hit", st->hits / (n / 100));
+ 2fe:	b9 64 00 00 00       	mov    $0x64,%ecx
+ 303:	89 f0                	mov    %esi,%eax
+ 305:	31 d2                	xor    %edx,%edx
+ 307:	57                   	push   %edi
+ 308:	f7 f1                	div    %ecx
+ 30a:	31 d2                	xor    %edx,%edx
+ 30c:	89 c6                	mov    %eax,%esi
+ 30e:	8b 43 08             	mov    0x8(%ebx),%eax
+ 311:	f7 f6                	div    %esi
+ 313:	50                   	push   %eax
+ 314:	68 20 0e 00 00       	push   $0xe20
+ 319:	6a 01                	push   $0x1
+ 31b:	e8 70 05 00 00       	call   890 <printf>
+ 320:	83 c4 10             	add    $0x10,%esp
+ 323:	e9 12 ff ff ff       	jmp    23a <print+0x4a>
+    printf(1, " of %d blocks avg, %d avg, %d max Kcycles",
+ 328:	83 ec 0c             	sub    $0xc,%esp
+ 32b:	ff 73 50             	push   0x50(%ebx)
+ 32e:	8b 43 4c             	mov    0x4c(%ebx),%eax
+ 331:	31 d2                	xor    %edx,%edx
+ 333:	f7 f1                	div    %ecx
+ 335:	31 d2                	xor    %edx,%edx
+ 337:	50                   	push   %eax
+ 338:	8b 43 48             	mov    0x48(%ebx),%eax
+ 33b:	f7 f1                	div    %ecx
+ 33d:	50                   	push   %eax
+ 33e:	68 30 0f 00 00       	push   $0xf30
+ 343:	6a 01                	push   $0x1
+ 345:	e8 46 05 00 00       	call   890 <printf>
+ 34a:	83 c4 20             	add    $0x20,%esp
+ 34d:	eb 95                	jmp    2e4 <print+0xf4>
+           st->diskblocks * 10 / st->diskreqs % 10);
+ 34f:	8b 73 1c             	mov    0x1c(%ebx),%esi
+ 352:	31 d2                	xor    %edx,%edx
+    printf(1, ", %d.%d blocks each", st->diskblocks / st->diskreqs,
+ 354:	bf 0a 00 00 00       	mov    $0xa,%edi
+           st->diskblocks * 10 / st->diskreqs % 10);
+ 359:	6b c6 0a             	imul   $0xa,%esi,%eax
+ 35c:	f7 f1                	div    %ecx
+    printf(1, ", %d.%d blocks each", st->diskblocks / st->diskreqs,
+ 35e:	31 d2                	xor    %edx,%edx
+ 360:	f7 f7                	div    %edi
+ 362:	89 f0                	mov    %esi,%eax
+ 364:	52                   	push   %edx
+ 365:	31 d2                	xor    %edx,%edx
+ 367:	f7 f1                	div    %ecx
+ 369:	50                   	push   %eax
+ 36a:	68 53 0e 00 00       	push   $0xe53
+ 36f:	6a 01                	push   $0x1
+ 371:	e8 1a 05 00 00       	call   890 <printf>
+ 376:	83 c4 10             	add    $0x10,%esp
+ 379:	e9 00 ff ff ff       	jmp    27e <print+0x8e>
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <get>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	83 ec 14             	sub    $0x14,%esp
+  if(iostat(st) < 0){
+ 386:	50                   	push   %eax
+ 387:	e8 d7 03 00 00       	call   763 <iostat>
+ 38c:	83 c4 10             	add    $0x10,%esp
+ 38f:	85 c0                	test   %eax,%eax
+ 391:	78 02                	js     395 <get+0x15>
+}
+ 393:	c9                   	leave
+ 394:	c3                   	ret
+    printf(2, "iostat: iostat failed\n");
+ 395:	50                   	push   %eax
+ 396:	50                   	push   %eax
+ 397:	68 8b 0e 00 00       	push   $0xe8b
+ 39c:	6a 02                	push   $0x2
+ 39e:	e8 ed 04 00 00       	call   890 <printf>
+    exit();
+ 3a3:	e8 eb 02 00 00       	call   693 <exit>
+ 3a8:	66 90                	xchg   %ax,%ax
+ 3aa:	66 90                	xchg   %ax,%ax
+ 3ac:	66 90                	xchg   %ax,%ax
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 3b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3b1:	31 c0                	xor    %eax,%eax
+{
+ 3b3:	89 e5                	mov    %esp,%ebp
+ 3b5:	53                   	push   %ebx
+ 3b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3c7:	83 c0 01             	add    $0x1,%eax
+ 3ca:	84 d2                	test   %dl,%dl
+ 3cc:	75 f2                	jne    3c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d1:	89 c8                	mov    %ecx,%eax
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3ea:	0f b6 02             	movzbl (%edx),%eax
+ 3ed:	84 c0                	test   %al,%al
+ 3ef:	75 17                	jne    408 <strcmp+0x28>
+ 3f1:	eb 3a                	jmp    42d <strcmp+0x4d>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3fc:	83 c2 01             	add    $0x1,%edx
+ 3ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 402:	84 c0                	test   %al,%al
+ 404:	74 1a                	je     420 <strcmp+0x40>
+    p++, q++;
+ 406:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 408:	0f b6 19             	movzbl (%ecx),%ebx
+ 40b:	38 c3                	cmp    %al,%bl
+ 40d:	74 e9                	je     3f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 40f:	29 d8                	sub    %ebx,%eax
+}
+ 411:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 414:	c9                   	leave
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 420:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 424:	31 c0                	xor    %eax,%eax
+ 426:	29 d8                	sub    %ebx,%eax
+}
+ 428:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 42b:	c9                   	leave
+ 42c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 42d:	0f b6 19             	movzbl (%ecx),%ebx
+ 430:	31 c0                	xor    %eax,%eax
+ 432:	eb db                	jmp    40f <strcmp+0x2f>
+ 434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 446:	80 3a 00             	cmpb   $0x0,(%edx)
+ 449:	74 15                	je     460 <strlen+0x20>
+ 44b:	31 c0                	xor    %eax,%eax
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+ 450:	83 c0 01             	add    $0x1,%eax
+ 453:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 457:	89 c1                	mov    %eax,%ecx
+ 459:	75 f5                	jne    450 <strlen+0x10>
+    ;
+  return n;
+}
+ 45b:	89 c8                	mov    %ecx,%eax
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+ 45f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 460:	31 c9                	xor    %ecx,%ecx
+}
+ 462:	5d                   	pop    %ebp
+ 463:	89 c8                	mov    %ecx,%eax
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 477:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 47a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47d:	89 d7                	mov    %edx,%edi
+ 47f:	fc                   	cld
+ 480:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 482:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 485:	89 d0                	mov    %edx,%eax
+ 487:	c9                   	leave
+ 488:	c3                   	ret
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 49a:	0f b6 10             	movzbl (%eax),%edx
+ 49d:	84 d2                	test   %dl,%dl
+ 49f:	75 12                	jne    4b3 <strchr+0x23>
+ 4a1:	eb 1d                	jmp    4c0 <strchr+0x30>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ac:	83 c0 01             	add    $0x1,%eax
+ 4af:	84 d2                	test   %dl,%dl
+ 4b1:	74 0d                	je     4c0 <strchr+0x30>
+    if(*s == c)
+ 4b3:	38 d1                	cmp    %dl,%cl
+ 4b5:	75 f1                	jne    4a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4b7:	5d                   	pop    %ebp
+ 4b8:	c3                   	ret
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4c0:	31 c0                	xor    %eax,%eax
+}
+ 4c2:	5d                   	pop    %ebp
+ 4c3:	c3                   	ret
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4d9:	31 db                	xor    %ebx,%ebx
+{
+ 4db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4de:	eb 27                	jmp    507 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4e0:	83 ec 04             	sub    $0x4,%esp
+ 4e3:	6a 01                	push   $0x1
+ 4e5:	56                   	push   %esi
+ 4e6:	6a 00                	push   $0x0
+ 4e8:	e8 be 01 00 00       	call   6ab <read>
+    if(cc < 1)
+ 4ed:	83 c4 10             	add    $0x10,%esp
+ 4f0:	85 c0                	test   %eax,%eax
+ 4f2:	7e 1d                	jle    511 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ff:	3c 0a                	cmp    $0xa,%al
+ 501:	74 10                	je     513 <gets+0x43>
+ 503:	3c 0d                	cmp    $0xd,%al
+ 505:	74 0c                	je     513 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 507:	89 df                	mov    %ebx,%edi
+ 509:	83 c3 01             	add    $0x1,%ebx
+ 50c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 50f:	7c cf                	jl     4e0 <gets+0x10>
+ 511:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 51a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51d:	5b                   	pop    %ebx
+ 51e:	5e                   	pop    %esi
+ 51f:	5f                   	pop    %edi
+ 520:	5d                   	pop    %ebp
+ 521:	c3                   	ret
+ 522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	56                   	push   %esi
+ 534:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 535:	83 ec 08             	sub    $0x8,%esp
+ 538:	6a 00                	push   $0x0
+ 53a:	ff 75 08             	push   0x8(%ebp)
+ 53d:	e8 91 01 00 00       	call   6d3 <open>
+  if(fd < 0)
+ 542:	83 c4 10             	add    $0x10,%esp
+ 545:	85 c0                	test   %eax,%eax
+ 547:	78 27                	js     570 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 549:	83 ec 08             	sub    $0x8,%esp
+ 54c:	ff 75 0c             	push   0xc(%ebp)
+ 54f:	89 c3                	mov    %eax,%ebx
+ 551:	50                   	push   %eax
+ 552:	e8 94 01 00 00       	call   6eb <fstat>
+  close(fd);
+ 557:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 55a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 55c:	e8 5a 01 00 00       	call   6bb <close>
+  return r;
+ 561:	83 c4 10             	add    $0x10,%esp
+}
+ 564:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 567:	89 f0                	mov    %esi,%eax
+ 569:	5b                   	pop    %ebx
+ 56a:	5e                   	pop    %esi
+ 56b:	5d                   	pop    %ebp
+ 56c:	c3                   	ret
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 570:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 575:	eb ed                	jmp    564 <stat+0x34>
+ 577:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	56                   	push   %esi
+ 584:	53                   	push   %ebx
+ 585:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 588:	0f b6 02             	movzbl (%edx),%eax
+ 58b:	3c 20                	cmp    $0x20,%al
+ 58d:	75 0c                	jne    59b <atoi+0x1b>
+ 58f:	90                   	nop
+ 590:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 594:	83 c2 01             	add    $0x1,%edx
+ 597:	3c 20                	cmp    $0x20,%al
+ 599:	74 f5                	je     590 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 59b:	3c 2d                	cmp    $0x2d,%al
+ 59d:	74 41                	je     5e0 <atoi+0x60>
+ 59f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 5a4:	3c 2b                	cmp    $0x2b,%al
+ 5a6:	74 3d                	je     5e5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 5a8:	0f be 0a             	movsbl (%edx),%ecx
+ 5ab:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 5ae:	3c 09                	cmp    $0x9,%al
+ 5b0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 5b5:	77 21                	ja     5d8 <atoi+0x58>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5c0:	83 c2 01             	add    $0x1,%edx
+ 5c3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 5c6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 5ca:	0f be 0a             	movsbl (%edx),%ecx
+ 5cd:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 5d0:	80 fb 09             	cmp    $0x9,%bl
+ 5d3:	76 eb                	jbe    5c0 <atoi+0x40>
+  return sign*n;
+ 5d5:	0f af c6             	imul   %esi,%eax
+}
+ 5d8:	5b                   	pop    %ebx
+ 5d9:	5e                   	pop    %esi
+ 5da:	5d                   	pop    %ebp
+ 5db:	c3                   	ret
+ 5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 5e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 5e5:	83 c2 01             	add    $0x1,%edx
+ 5e8:	eb be                	jmp    5a8 <atoi+0x28>
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005f0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	56                   	push   %esi
+ 5f4:	53                   	push   %ebx
+ 5f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 5f8:	0f b6 02             	movzbl (%edx),%eax
+ 5fb:	3c 20                	cmp    $0x20,%al
+ 5fd:	75 0c                	jne    60b <atoo+0x1b>
+ 5ff:	90                   	nop
+ 600:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 604:	83 c2 01             	add    $0x1,%edx
+ 607:	3c 20                	cmp    $0x20,%al
+ 609:	74 f5                	je     600 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 60b:	3c 2d                	cmp    $0x2d,%al
+ 60d:	74 41                	je     650 <atoo+0x60>
+ 60f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 614:	3c 2b                	cmp    $0x2b,%al
+ 616:	74 3d                	je     655 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 618:	0f be 0a             	movsbl (%edx),%ecx
+ 61b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 61e:	3c 07                	cmp    $0x7,%al
+ 620:	b8 00 00 00 00       	mov    $0x0,%eax
+ 625:	77 1e                	ja     645 <atoo+0x55>
+ 627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 630:	83 c2 01             	add    $0x1,%edx
+ 633:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 637:	0f be 0a             	movsbl (%edx),%ecx
+ 63a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 63d:	80 fb 07             	cmp    $0x7,%bl
+ 640:	76 ee                	jbe    630 <atoo+0x40>
+  return sign*n;
+ 642:	0f af c6             	imul   %esi,%eax
+}
+ 645:	5b                   	pop    %ebx
+ 646:	5e                   	pop    %esi
+ 647:	5d                   	pop    %ebp
+ 648:	c3                   	ret
+ 649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 650:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 655:	83 c2 01             	add    $0x1,%edx
+ 658:	eb be                	jmp    618 <atoo+0x28>
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000660 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	8b 45 10             	mov    0x10(%ebp),%eax
+ 668:	8b 55 08             	mov    0x8(%ebp),%edx
+ 66b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 66e:	85 c0                	test   %eax,%eax
+ 670:	7e 13                	jle    685 <memmove+0x25>
+ 672:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 674:	89 d7                	mov    %edx,%edi
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 680:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 681:	39 f8                	cmp    %edi,%eax
+ 683:	75 fb                	jne    680 <memmove+0x20>
+  return vdst;
+}
+ 685:	5e                   	pop    %esi
+ 686:	89 d0                	mov    %edx,%eax
+ 688:	5f                   	pop    %edi
+ 689:	5d                   	pop    %ebp
+ 68a:	c3                   	ret
+
+0000068b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 68b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <exit>:
+SYSCALL(exit)
+ 693:	b8 02 00 00 00       	mov    $0x2,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <wait>:
+SYSCALL(wait)
+ 69b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <pipe>:
+SYSCALL(pipe)
+ 6a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <read>:
+SYSCALL(read)
+ 6ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <write>:
+SYSCALL(write)
+ 6b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <close>:
+SYSCALL(close)
+ 6bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <kill>:
+SYSCALL(kill)
+ 6c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <exec>:
+SYSCALL(exec)
+ 6cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <open>:
+SYSCALL(open)
+ 6d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <mknod>:
+SYSCALL(mknod)
+ 6db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <unlink>:
+SYSCALL(unlink)
+ 6e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <fstat>:
+SYSCALL(fstat)
+ 6eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <link>:
+SYSCALL(link)
+ 6f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <mkdir>:
+SYSCALL(mkdir)
+ 6fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <chdir>:
+SYSCALL(chdir)
+ 703:	b8 09 00 00 00       	mov    $0x9,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <dup>:
+SYSCALL(dup)
+ 70b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <getpid>:
+SYSCALL(getpid)
+ 713:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <sbrk>:
+SYSCALL(sbrk)
+ 71b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <sleep>:
+SYSCALL(sleep)
+ 723:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <uptime>:
+SYSCALL(uptime)
+ 72b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <superpages>:
+SYSCALL(superpages)
+ 733:	b8 23 00 00 00       	mov    $0x23,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <mmap>:
+SYSCALL(mmap)
+ 73b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <munmap>:
+SYSCALL(munmap)
+ 743:	b8 25 00 00 00       	mov    $0x25,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <spawn>:
+SYSCALL(spawn)
+ 74b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <swapstat>:
+SYSCALL(swapstat)
+ 753:	b8 27 00 00 00       	mov    $0x27,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 75b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <iostat>:
+SYSCALL(iostat)
+ 763:	b8 29 00 00 00       	mov    $0x29,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <dropcache>:
+SYSCALL(dropcache)
+ 76b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <iosched>:
+SYSCALL(iosched)
+ 773:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <halt>:
+SYSCALL(halt)
+ 77b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <date>:
+SYSCALL(date)
+ 783:	b8 17 00 00 00       	mov    $0x17,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 78b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <getgid>:
+SYSCALL(getgid)
+ 793:	b8 19 00 00 00       	mov    $0x19,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <getppid>:
+SYSCALL(getppid)
+ 79b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <setuid>:
+SYSCALL(setuid)
+ 7a3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <setgid>:
+SYSCALL(setgid)
+ 7ab:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <getprocs>:
+SYSCALL(getprocs)
+ 7b3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 7bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <getpriority>:
+SYSCALL(getpriority)
+ 7c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 7cb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <chown>:
+SYSCALL(chown)
+ 7d3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <chgrp>:
+SYSCALL(chgrp)
+ 7db:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+ 7e3:	66 90                	xchg   %ax,%ax
+ 7e5:	66 90                	xchg   %ax,%ax
+ 7e7:	66 90                	xchg   %ax,%ax
+ 7e9:	66 90                	xchg   %ax,%ax
+ 7eb:	66 90                	xchg   %ax,%ax
+ 7ed:	66 90                	xchg   %ax,%ax
+ 7ef:	90                   	nop
+
+000007f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7f8:	89 d1                	mov    %edx,%ecx
+{
+ 7fa:	83 ec 3c             	sub    $0x3c,%esp
+ 7fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 800:	85 d2                	test   %edx,%edx
+ 802:	0f 89 80 00 00 00    	jns    888 <printint+0x98>
+ 808:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 80c:	74 7a                	je     888 <printint+0x98>
+    x = -xx;
+ 80e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 810:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 815:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 818:	31 f6                	xor    %esi,%esi
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 820:	89 c8                	mov    %ecx,%eax
+ 822:	31 d2                	xor    %edx,%edx
+ 824:	89 f7                	mov    %esi,%edi
+ 826:	f7 f3                	div    %ebx
+ 828:	8d 76 01             	lea    0x1(%esi),%esi
+ 82b:	0f b6 92 bc 0f 00 00 	movzbl 0xfbc(%edx),%edx
+ 832:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 836:	89 ca                	mov    %ecx,%edx
+ 838:	89 c1                	mov    %eax,%ecx
+ 83a:	39 da                	cmp    %ebx,%edx
+ 83c:	73 e2                	jae    820 <printint+0x30>
+  if(neg)
+ 83e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 841:	85 c0                	test   %eax,%eax
+ 843:	74 07                	je     84c <printint+0x5c>
+    buf[i++] = '-';
+ 845:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 84a:	89 f7                	mov    %esi,%edi
+ 84c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 84f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 852:	01 df                	add    %ebx,%edi
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 858:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 85b:	83 ec 04             	sub    $0x4,%esp
+ 85e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 861:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 864:	6a 01                	push   $0x1
+ 866:	50                   	push   %eax
+ 867:	56                   	push   %esi
+ 868:	e8 46 fe ff ff       	call   6b3 <write>
+  while(--i >= 0)
+ 86d:	89 f8                	mov    %edi,%eax
+ 86f:	83 c4 10             	add    $0x10,%esp
+ 872:	83 ef 01             	sub    $0x1,%edi
+ 875:	39 d8                	cmp    %ebx,%eax
+ 877:	75 df                	jne    858 <printint+0x68>
+}
+ 879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 87c:	5b                   	pop    %ebx
+ 87d:	5e                   	pop    %esi
+ 87e:	5f                   	pop    %edi
+ 87f:	5d                   	pop    %ebp
+ 880:	c3                   	ret
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 888:	31 c0                	xor    %eax,%eax
+ 88a:	eb 89                	jmp    815 <printint+0x25>
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000890 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 899:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 89c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 89f:	0f b6 1e             	movzbl (%esi),%ebx
+ 8a2:	83 c6 01             	add    $0x1,%esi
+ 8a5:	84 db                	test   %bl,%bl
+ 8a7:	74 67                	je     910 <printf+0x80>
+ 8a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8ac:	31 d2                	xor    %edx,%edx
+ 8ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8b1:	eb 34                	jmp    8e7 <printf+0x57>
+ 8b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8b7:	90                   	nop
+ 8b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8c0:	83 f8 25             	cmp    $0x25,%eax
+ 8c3:	74 18                	je     8dd <printf+0x4d>
+  write(fd, &c, 1);
+ 8c5:	83 ec 04             	sub    $0x4,%esp
+ 8c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ce:	6a 01                	push   $0x1
+ 8d0:	50                   	push   %eax
+ 8d1:	57                   	push   %edi
+ 8d2:	e8 dc fd ff ff       	call   6b3 <write>
+ 8d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 8e0:	83 c6 01             	add    $0x1,%esi
+ 8e3:	84 db                	test   %bl,%bl
+ 8e5:	74 29                	je     910 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8ea:	85 d2                	test   %edx,%edx
+ 8ec:	74 ca                	je     8b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8ee:	83 fa 25             	cmp    $0x25,%edx
+ 8f1:	75 ea                	jne    8dd <printf+0x4d>
+      if(c == 'd'){
+ 8f3:	83 f8 25             	cmp    $0x25,%eax
+ 8f6:	0f 84 24 01 00 00    	je     a20 <printf+0x190>
+ 8fc:	83 e8 63             	sub    $0x63,%eax
+ 8ff:	83 f8 15             	cmp    $0x15,%eax
+ 902:	77 1c                	ja     920 <printf+0x90>
+ 904:	ff 24 85 64 0f 00 00 	jmp    *0xf64(,%eax,4)
+ 90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 913:	5b                   	pop    %ebx
+ 914:	5e                   	pop    %esi
+ 915:	5f                   	pop    %edi
+ 916:	5d                   	pop    %ebp
+ 917:	c3                   	ret
+ 918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+  write(fd, &c, 1);
+ 920:	83 ec 04             	sub    $0x4,%esp
+ 923:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 926:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 92a:	6a 01                	push   $0x1
+ 92c:	52                   	push   %edx
+ 92d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 930:	57                   	push   %edi
+ 931:	e8 7d fd ff ff       	call   6b3 <write>
+ 936:	83 c4 0c             	add    $0xc,%esp
+ 939:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 93c:	6a 01                	push   $0x1
+ 93e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 941:	52                   	push   %edx
+ 942:	57                   	push   %edi
+ 943:	e8 6b fd ff ff       	call   6b3 <write>
+        putc(fd, c);
+ 948:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 94b:	31 d2                	xor    %edx,%edx
+ 94d:	eb 8e                	jmp    8dd <printf+0x4d>
+ 94f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 950:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 95b:	8b 13                	mov    (%ebx),%edx
+ 95d:	6a 00                	push   $0x0
+ 95f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 961:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 964:	e8 87 fe ff ff       	call   7f0 <printint>
+        ap++;
+ 969:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 96c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96f:	31 d2                	xor    %edx,%edx
+ 971:	e9 67 ff ff ff       	jmp    8dd <printf+0x4d>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 980:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 983:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 985:	83 c0 04             	add    $0x4,%eax
+ 988:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 98b:	85 db                	test   %ebx,%ebx
+ 98d:	0f 84 9d 00 00 00    	je     a30 <printf+0x1a0>
+        while(*s != 0){
+ 993:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 996:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 998:	84 c0                	test   %al,%al
+ 99a:	0f 84 3d ff ff ff    	je     8dd <printf+0x4d>
+ 9a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9a6:	89 de                	mov    %ebx,%esi
+ 9a8:	89 d3                	mov    %edx,%ebx
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	53                   	push   %ebx
+ 9bc:	57                   	push   %edi
+ 9bd:	e8 f1 fc ff ff       	call   6b3 <write>
+        while(*s != 0){
+ 9c2:	0f b6 06             	movzbl (%esi),%eax
+ 9c5:	83 c4 10             	add    $0x10,%esp
+ 9c8:	84 c0                	test   %al,%al
+ 9ca:	75 e4                	jne    9b0 <printf+0x120>
+      state = 0;
+ 9cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9cf:	31 d2                	xor    %edx,%edx
+ 9d1:	e9 07 ff ff ff       	jmp    8dd <printf+0x4d>
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9eb:	8b 13                	mov    (%ebx),%edx
+ 9ed:	6a 01                	push   $0x1
+ 9ef:	e9 6b ff ff ff       	jmp    95f <printf+0xcf>
+ 9f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9fb:	83 ec 04             	sub    $0x4,%esp
+ 9fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a01:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a03:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a06:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a09:	6a 01                	push   $0x1
+ a0b:	52                   	push   %edx
+ a0c:	57                   	push   %edi
+ a0d:	e8 a1 fc ff ff       	call   6b3 <write>
+        ap++;
+ a12:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a15:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a18:	31 d2                	xor    %edx,%edx
+ a1a:	e9 be fe ff ff       	jmp    8dd <printf+0x4d>
+ a1f:	90                   	nop
+  write(fd, &c, 1);
+ a20:	83 ec 04             	sub    $0x4,%esp
+ a23:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a26:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a29:	6a 01                	push   $0x1
+ a2b:	e9 11 ff ff ff       	jmp    941 <printf+0xb1>
+ a30:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a35:	bb 5a 0f 00 00       	mov    $0xf5a,%ebx
+ a3a:	e9 61 ff ff ff       	jmp    9a0 <printf+0x110>
+ a3f:	90                   	nop
+
+00000a40 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a43:	a1 24 14 00 00       	mov    0x1424,%eax
+{
+ a48:	89 e5                	mov    %esp,%ebp
+ a4a:	56                   	push   %esi
+ a4b:	53                   	push   %ebx
+ a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a50:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a52:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a54:	39 ca                	cmp    %ecx,%edx
+ a56:	73 30                	jae    a88 <lfree+0x48>
+ a58:	39 c1                	cmp    %eax,%ecx
+ a5a:	72 04                	jb     a60 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a5c:	39 c2                	cmp    %eax,%edx
+ a5e:	72 f0                	jb     a50 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a60:	8b 59 04             	mov    0x4(%ecx),%ebx
+ a63:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ a66:	39 f0                	cmp    %esi,%eax
+ a68:	74 26                	je     a90 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a6a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a6c:	8b 42 04             	mov    0x4(%edx),%eax
+ a6f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a72:	39 d9                	cmp    %ebx,%ecx
+ a74:	74 30                	je     aa6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a76:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a78:	5b                   	pop    %ebx
+  freep = p;
+ a79:	89 15 24 14 00 00    	mov    %edx,0x1424
+}
+ a7f:	5e                   	pop    %esi
+ a80:	5d                   	pop    %ebp
+ a81:	c3                   	ret
+ a82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a88:	39 c1                	cmp    %eax,%ecx
+ a8a:	72 d0                	jb     a5c <lfree+0x1c>
+ a8c:	eb c2                	jmp    a50 <lfree+0x10>
+ a8e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ a90:	03 58 04             	add    0x4(%eax),%ebx
+ a93:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a96:	8b 02                	mov    (%edx),%eax
+ a98:	8b 00                	mov    (%eax),%eax
+ a9a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ a9c:	8b 42 04             	mov    0x4(%edx),%eax
+ a9f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ aa2:	39 d9                	cmp    %ebx,%ecx
+ aa4:	75 d0                	jne    a76 <lfree+0x36>
+    p->s.size += bp->s.size;
+ aa6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ aa9:	89 15 24 14 00 00    	mov    %edx,0x1424
+    p->s.size += bp->s.size;
+ aaf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ab2:	8b 09                	mov    (%ecx),%ecx
+ ab4:	89 0a                	mov    %ecx,(%edx)
+}
+ ab6:	5b                   	pop    %ebx
+ ab7:	5e                   	pop    %esi
+ ab8:	5d                   	pop    %ebp
+ ab9:	c3                   	ret
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ac0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	89 c7                	mov    %eax,%edi
+ ac6:	56                   	push   %esi
+ ac7:	53                   	push   %ebx
+ ac8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ acb:	a1 24 14 00 00       	mov    0x1424,%eax
+ ad0:	85 c0                	test   %eax,%eax
+ ad2:	0f 84 88 00 00 00    	je     b60 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ ada:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ add:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ae2:	39 df                	cmp    %ebx,%edi
+ ae4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ae7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ aee:	39 f9                	cmp    %edi,%ecx
+ af0:	72 0f                	jb     b01 <lalloc+0x41>
+ af2:	eb 4c                	jmp    b40 <lalloc+0x80>
+ af4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ afa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ afd:	39 f9                	cmp    %edi,%ecx
+ aff:	73 3f                	jae    b40 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ b01:	89 d0                	mov    %edx,%eax
+ b03:	39 15 24 14 00 00    	cmp    %edx,0x1424
+ b09:	75 ed                	jne    af8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ b0b:	83 ec 0c             	sub    $0xc,%esp
+ b0e:	56                   	push   %esi
+ b0f:	e8 07 fc ff ff       	call   71b <sbrk>
+  if(p == (char*)-1)
+ b14:	83 c4 10             	add    $0x10,%esp
+ b17:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b1a:	74 11                	je     b2d <lalloc+0x6d>
+  hp->s.size = nu;
+ b1c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ b1f:	e8 1c ff ff ff       	call   a40 <lfree>
+  return freep;
+ b24:	a1 24 14 00 00       	mov    0x1424,%eax
+      if((p = morecore(nunits)) == 0)
+ b29:	85 c0                	test   %eax,%eax
+ b2b:	75 cb                	jne    af8 <lalloc+0x38>
+        return 0;
+  }
+}
+ b2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b30:	31 d2                	xor    %edx,%edx
+}
+ b32:	5b                   	pop    %ebx
+ b33:	89 d0                	mov    %edx,%eax
+ b35:	5e                   	pop    %esi
+ b36:	5f                   	pop    %edi
+ b37:	5d                   	pop    %ebp
+ b38:	c3                   	ret
+ b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ b40:	39 cf                	cmp    %ecx,%edi
+ b42:	74 4c                	je     b90 <lalloc+0xd0>
+        p->s.size -= nunits;
+ b44:	29 f9                	sub    %edi,%ecx
+ b46:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ b49:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ b4c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ b4f:	a3 24 14 00 00       	mov    %eax,0x1424
+}
+ b54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b57:	89 d0                	mov    %edx,%eax
+ b59:	5b                   	pop    %ebx
+ b5a:	5e                   	pop    %esi
+ b5b:	5f                   	pop    %edi
+ b5c:	5d                   	pop    %ebp
+ b5d:	c3                   	ret
+ b5e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ b60:	ba 28 14 00 00       	mov    $0x1428,%edx
+ b65:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ b67:	c7 05 24 14 00 00 28 	movl   $0x1428,0x1424
+ b6e:	14 00 00 
+ b71:	c7 05 28 14 00 00 28 	movl   $0x1428,0x1428
+ b78:	14 00 00 
+ b7b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ b7d:	c7 05 2c 14 00 00 00 	movl   $0x0,0x142c
+ b84:	00 00 00 
+ b87:	e9 51 ff ff ff       	jmp    add <lalloc+0x1d>
+ b8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ b90:	8b 0a                	mov    (%edx),%ecx
+ b92:	89 08                	mov    %ecx,(%eax)
+ b94:	eb b9                	jmp    b4f <lalloc+0x8f>
+ b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ba0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+ ba6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ ba9:	85 f6                	test   %esi,%esi
+ bab:	74 42                	je     bef <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ bad:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ bb0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ bb3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ bb9:	77 3d                	ja     bf8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ bbb:	31 c9                	xor    %ecx,%ecx
+ bbd:	bb 01 00 00 00       	mov    $0x1,%ebx
+ bc2:	83 fa 02             	cmp    $0x2,%edx
+ bc5:	74 17                	je     bde <free+0x3e>
+ bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bce:	66 90                	xchg   %ax,%ax
+ bd0:	83 c1 01             	add    $0x1,%ecx
+ bd3:	89 d8                	mov    %ebx,%eax
+ bd5:	d3 e0                	shl    %cl,%eax
+ bd7:	83 c0 01             	add    $0x1,%eax
+ bda:	39 c2                	cmp    %eax,%edx
+ bdc:	75 f2                	jne    bd0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ bde:	8b 04 8d 00 14 00 00 	mov    0x1400(,%ecx,4),%eax
+  classes[c] = bp;
+ be5:	89 3c 8d 00 14 00 00 	mov    %edi,0x1400(,%ecx,4)
+  bp->s.ptr = classes[c];
+ bec:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ bef:	5b                   	pop    %ebx
+ bf0:	5e                   	pop    %esi
+ bf1:	5f                   	pop    %edi
+ bf2:	5d                   	pop    %ebp
+ bf3:	c3                   	ret
+ bf4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bf8:	5b                   	pop    %ebx
+    lfree(bp);
+ bf9:	89 f8                	mov    %edi,%eax
+}
+ bfb:	5e                   	pop    %esi
+ bfc:	5f                   	pop    %edi
+ bfd:	5d                   	pop    %ebp
+    lfree(bp);
+ bfe:	e9 3d fe ff ff       	jmp    a40 <lfree>
+ c03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c10 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c10:	55                   	push   %ebp
+ c11:	89 e5                	mov    %esp,%ebp
+ c13:	57                   	push   %edi
+ c14:	56                   	push   %esi
+ c15:	53                   	push   %ebx
+ c16:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c19:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1c:	83 c0 07             	add    $0x7,%eax
+ c1f:	c1 e8 03             	shr    $0x3,%eax
+ c22:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ c25:	3d 01 01 00 00       	cmp    $0x101,%eax
+ c2a:	77 44                	ja     c70 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ c2c:	31 c9                	xor    %ecx,%ecx
+ c2e:	ba 01 00 00 00       	mov    $0x1,%edx
+ c33:	bb 02 00 00 00       	mov    $0x2,%ebx
+ c38:	83 f8 02             	cmp    $0x2,%eax
+ c3b:	76 11                	jbe    c4e <malloc+0x3e>
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+ c40:	83 c1 01             	add    $0x1,%ecx
+ c43:	89 d3                	mov    %edx,%ebx
+ c45:	d3 e3                	shl    %cl,%ebx
+ c47:	83 c3 01             	add    $0x1,%ebx
+ c4a:	39 c3                	cmp    %eax,%ebx
+ c4c:	72 f2                	jb     c40 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ c4e:	8b 04 8d 00 14 00 00 	mov    0x1400(,%ecx,4),%eax
+ c55:	85 c0                	test   %eax,%eax
+ c57:	74 2f                	je     c88 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ c59:	8b 10                	mov    (%eax),%edx
+ c5b:	89 14 8d 00 14 00 00 	mov    %edx,0x1400(,%ecx,4)
+  return (void*)(p + 1);
+ c62:	83 c0 08             	add    $0x8,%eax
+}
+ c65:	83 c4 1c             	add    $0x1c,%esp
+ c68:	5b                   	pop    %ebx
+ c69:	5e                   	pop    %esi
+ c6a:	5f                   	pop    %edi
+ c6b:	5d                   	pop    %ebp
+ c6c:	c3                   	ret
+ c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ c70:	e8 4b fe ff ff       	call   ac0 <lalloc>
+ c75:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ c77:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ c7a:	85 d2                	test   %edx,%edx
+ c7c:	75 e7                	jne    c65 <malloc+0x55>
+      return 0;
+ c7e:	31 c0                	xor    %eax,%eax
+ c80:	eb e3                	jmp    c65 <malloc+0x55>
+ c82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ c88:	31 d2                	xor    %edx,%edx
+ c8a:	b8 00 02 00 00       	mov    $0x200,%eax
+ c8f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ c92:	f7 f3                	div    %ebx
+  if(n < 4)
+ c94:	ba 04 00 00 00       	mov    $0x4,%edx
+ c99:	89 d6                	mov    %edx,%esi
+ c9b:	39 d0                	cmp    %edx,%eax
+ c9d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ ca0:	0f af f3             	imul   %ebx,%esi
+ ca3:	89 f0                	mov    %esi,%eax
+ ca5:	e8 16 fe ff ff       	call   ac0 <lalloc>
+ caa:	85 c0                	test   %eax,%eax
+ cac:	74 d0                	je     c7e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ cae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ cb1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ cb4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cbb:	8b 14 8d 00 14 00 00 	mov    0x1400(,%ecx,4),%edx
+ cc2:	39 f8                	cmp    %edi,%eax
+ cc4:	73 22                	jae    ce8 <malloc+0xd8>
+ cc6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ cc9:	eb 09                	jmp    cd4 <malloc+0xc4>
+ ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ccf:	90                   	nop
+ cd0:	89 c2                	mov    %eax,%edx
+ cd2:	89 c8                	mov    %ecx,%eax
+ cd4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ cd7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ cda:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ cdc:	39 f9                	cmp    %edi,%ecx
+ cde:	72 f0                	jb     cd0 <malloc+0xc0>
+ ce0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ ce3:	e9 73 ff ff ff       	jmp    c5b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ ce8:	89 d0                	mov    %edx,%eax
+ cea:	8b 12                	mov    (%edx),%edx
+ cec:	e9 6a ff ff ff       	jmp    c5b <malloc+0x4b>
+ cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cff:	90                   	nop
+
+00000d00 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	56                   	push   %esi
+ d04:	53                   	push   %ebx
+ d05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ d08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ d0b:	85 c9                	test   %ecx,%ecx
+ d0d:	74 06                	je     d15 <calloc+0x15>
+ d0f:	89 c8                	mov    %ecx,%eax
+ d11:	f7 e3                	mul    %ebx
+ d13:	70 33                	jo     d48 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ d15:	0f af d9             	imul   %ecx,%ebx
+ d18:	83 ec 0c             	sub    $0xc,%esp
+ d1b:	53                   	push   %ebx
+ d1c:	e8 ef fe ff ff       	call   c10 <malloc>
+ d21:	83 c4 10             	add    $0x10,%esp
+ d24:	89 c6                	mov    %eax,%esi
+ d26:	85 c0                	test   %eax,%eax
+ d28:	74 1e                	je     d48 <calloc+0x48>
+    memset(p, 0, n * size);
+ d2a:	83 ec 04             	sub    $0x4,%esp
+ d2d:	53                   	push   %ebx
+ d2e:	6a 00                	push   $0x0
+ d30:	50                   	push   %eax
+ d31:	e8 3a f7 ff ff       	call   470 <memset>
+ d36:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ d39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d3c:	89 f0                	mov    %esi,%eax
+ d3e:	5b                   	pop    %ebx
+ d3f:	5e                   	pop    %esi
+ d40:	5d                   	pop    %ebp
+ d41:	c3                   	ret
+ d42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ d48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ d4b:	31 f6                	xor    %esi,%esi
+}
+ d4d:	89 f0                	mov    %esi,%eax
+ d4f:	5b                   	pop    %ebx
+ d50:	5e                   	pop    %esi
+ d51:	5d                   	pop    %ebp
+ d52:	c3                   	ret
+ d53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d60 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	57                   	push   %edi
+ d64:	56                   	push   %esi
+ d65:	53                   	push   %ebx
+ d66:	83 ec 0c             	sub    $0xc,%esp
+ d69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ d6f:	85 db                	test   %ebx,%ebx
+ d71:	74 55                	je     dc8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ d73:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ d76:	89 de                	mov    %ebx,%esi
+ d78:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ d7f:	39 c7                	cmp    %eax,%edi
+ d81:	72 0d                	jb     d90 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ d83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d86:	89 f0                	mov    %esi,%eax
+ d88:	5b                   	pop    %ebx
+ d89:	5e                   	pop    %esi
+ d8a:	5f                   	pop    %edi
+ d8b:	5d                   	pop    %ebp
+ d8c:	c3                   	ret
+ d8d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ d90:	83 ec 0c             	sub    $0xc,%esp
+ d93:	50                   	push   %eax
+ d94:	e8 77 fe ff ff       	call   c10 <malloc>
+ d99:	83 c4 10             	add    $0x10,%esp
+ d9c:	89 c6                	mov    %eax,%esi
+ d9e:	85 c0                	test   %eax,%eax
+ da0:	74 e1                	je     d83 <realloc+0x23>
+  memmove(p, ap, have);
+ da2:	83 ec 04             	sub    $0x4,%esp
+ da5:	57                   	push   %edi
+ da6:	53                   	push   %ebx
+ da7:	50                   	push   %eax
+ da8:	e8 b3 f8 ff ff       	call   660 <memmove>
+  free(ap);
+ dad:	89 1c 24             	mov    %ebx,(%esp)
+ db0:	e8 eb fd ff ff       	call   ba0 <free>
+  return p;
+ db5:	83 c4 10             	add    $0x10,%esp
+}
+ db8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dbb:	89 f0                	mov    %esi,%eax
+ dbd:	5b                   	pop    %ebx
+ dbe:	5e                   	pop    %esi
+ dbf:	5f                   	pop    %edi
+ dc0:	5d                   	pop    %ebp
+ dc1:	c3                   	ret
+ dc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ dc8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ dcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dce:	5b                   	pop    %ebx
+ dcf:	5e                   	pop    %esi
+ dd0:	5f                   	pop    %edi
+ dd1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ dd2:	e9 39 fe ff ff       	jmp    c10 <malloc>
@@ -0,0 +1,110 @@
+// Print buffer cache statistics: its size, and how many block
+// reads it satisfied; how many disk commands moved how many
+// blocks; how long disk requests took under the current
+// scheduler policy; and how long log commits took.  With -r, report only what changed while
+// running the given command.  With -s, set the policy, which
+// also starts its latency statistics anew.
+
+#include "types.h"
+#include "user.h"
+#include "iostat.h"
+
+#define NELEM(x) (sizeof(x)/sizeof((x)[0]))
+
+char *policies[] = {
+[IOS_FIFO]     "fifo",
+[IOS_CLOOK]    "c-look",
+[IOS_DEADLINE] "deadline",
+};
+
+static void
+get(struct iostat *st)
+{
+  if(iostat(st) < 0){
+    printf(2, "iostat: iostat failed\n");
+    exit();
+  }
+}
+
+static void
+latency(char *what, uint n, uint tot, uint max)
+{
+  printf(1, "%s\t%d blocks", what, n);
+  if(n > 0)
+    printf(1, ", latency %d avg, %d max Kcycles", tot / n, max);
+  printf(1, "\n");
+}
+
+static void
+print(struct iostat *st)
+{
+  uint n;
+
+  n = st->hits + st->misses;
+  printf(1, "bcache\t%d/%d buffers (%d KB)\n", st->nbuf, st->maxbuf,
+         st->nbuf / 2);
+  printf(1, "reads\t%d: %d hits, %d misses", n, st->hits, st->misses);
+  if(n >= 100)
+    printf(1, ", %d%% hit", st->hits / (n / 100));
+  printf(1, "\nahead\t%d blocks read ahead\n", st->readaheads);
+  printf(1, "writes\t%d\n", st->writes);
+  printf(1, "disk\t%d commands for %d blocks", st->diskreqs, st->diskblocks);
+  if(st->diskreqs > 0)
+    printf(1, ", %d.%d blocks each", st->diskblocks / st->diskreqs,
+           st->diskblocks * 10 / st->diskreqs % 10);
+  printf(1, "\n");
+  printf(1, "sched\t%s\n", st->sched);
+  latency("read", st->nread, st->readlat, st->readmax);
+  latency("write", st->nwrite, st->writelat, st->writemax);
+  printf(1, "log\t%d commits", st->ncommit);
+  if(st->ncommit > 0)
+    printf(1, " of %d blocks avg, %d avg, %d max Kcycles",
+           st->commitblocks / st->ncommit, st->commitlat / st->ncommit,
+           st->commitmax);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat a, b;
+  int i;
+
+  if(argc > 2 && strcmp(argv[1], "-r") == 0){
+    get(&a);
+    if(fork() == 0){
+      exec(argv[2], argv + 2);
+      printf(2, "iostat: exec %s failed\n", argv[2]);
+      exit();
+    }
+    wait();
+    get(&b);
+    b.hits -= a.hits;
+    b.misses -= a.misses;
+    b.writes -= a.writes;
+    b.readaheads -= a.readaheads;
+    b.diskreqs -= a.diskreqs;
+    b.diskblocks -= a.diskblocks;
+    b.nread -= a.nread;
+    b.readlat -= a.readlat;
+    b.nwrite -= a.nwrite;
+    b.writelat -= a.writelat;
+    b.ncommit -= a.ncommit;
+    b.commitblocks -= a.commitblocks;
+    b.commitlat -= a.commitlat;
+    print(&b);
+    exit();
+  }
+  if(argc > 2 && strcmp(argv[1], "-s") == 0){
+    for(i = 0; i < NELEM(policies); i++)
+      if(strcmp(argv[2], policies[i]) == 0)
+        break;
+    if(i == NELEM(policies) || iosched(i) < 0){
+      printf(2, "iostat: no policy %s\n", argv[2]);
+      exit();
+    }
+  }
+  get(&a);
+  print(&a);
+  exit();
+}
@@ -0,0 +1,28 @@
+// Buffer cache and disk statistics, returned by the iostat
+// system call.
+struct iostat {
+  uint nbuf;        // buffers in the cache
+  uint maxbuf;      // most buffers the cache may grow to
+  uint hits;        // bread()s that found the block cached
+  uint misses;      // bread()s that read the disk
+  uint writes;      // bwrite()s
+  uint readaheads;  // blocks read ahead by breada()
+  uint diskreqs;    // disk commands issued
+  uint diskblocks;  // blocks they moved; more than diskreqs if merged
+  char sched[12];   // disk scheduler policy
+  uint nread;       // blocks read from disk since the policy was set
+  uint readlat;     // their total latency, queued to done, in Kcycles
+  uint readmax;     // the longest
+  uint nwrite;      // blocks written, likewise
+  uint writelat;
+  uint writemax;
+  uint ncommit;     // log commits
+  uint commitblocks; // blocks they wrote to the log
+  uint commitlat;   // their total time, in Kcycles
+  uint commitmax;   // the longest
+};
+
+// Disk scheduler policies, for iosched().
+#define IOS_FIFO     0
+#define IOS_CLOOK    1
+#define IOS_DEADLINE 2
@@ -8,11 +8,14 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "meminfo.h"
 
-void freerange(void *vstart, void *vend);
+static void addrange(char *vstart, char *vend);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
 
+uint phystop;      // top of physical memory, set by kinit1
+
 struct run {
   struct run *next;
 };
@@ -21,49 +24,141 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  // Number of references to each physical page.  A page that is
+  // mapped by several address spaces (shared program text) is
+  // only returned to the free list when the last one lets go.
+  // ref and kind have phystop/PGSIZE entries; kinit1 places
+  // them after the kernel.
+  ushort *ref;
+  // Physically contiguous, 4MB-aligned chunks set aside at boot
+  // for user superpages.  kalloc() breaks one up if it runs out
+  // of ordinary pages.
+  char *spg[NSUPERPG];
+  int nspg;
+  // Pages in [lazy, lazyend) have never been allocated.  Rather
+  // than kfree() each of them at boot, kalloc() hands them out
+  // in address order once the free list is empty.
+  char *lazy;
+  char *lazyend;
+  // Accounting: what each allocated page is used for (see
+  // ktag), and how many pages there are of each kind.
+  uchar *kind;
+  uint npages;
+  uint nfree;
+  uint used[NKM];
 } kmem;
 
 // Initialization happens in two phases.
-// 1. main() calls kinit1() while still using entrypgdir to place just
-// the pages mapped by entrypgdir on free list.
+// 1. main() calls kinit1() while still using entrypgdir to make
+// just the pages mapped by entrypgdir available.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Neither touches the pages themselves; see addrange.
 void
 kinit1(void *vstart, void *vend)
 {
+  char *p;
+
   initlock(&kmem.lock, "kmem");
   kmem.use_lock = 0;
-  freerange(vstart, vend);
+
+  // Find out how much memory there is; the kernel maps all of
+  // it at KERNBASE, so it can use at most PHYSMAX.
+  if((phystop = cmosmem()) == 0)
+    phystop = PHYSDEF;
+  if(phystop > PHYSMAX)
+    phystop = PHYSMAX;
+  phystop = PGROUNDDOWN(phystop);
+
+  p = vstart;
+  kmem.ref = (ushort*)p;
+  p += phystop/PGSIZE * sizeof(kmem.ref[0]);
+  kmem.kind = (uchar*)p;
+  p += phystop/PGSIZE * sizeof(kmem.kind[0]);
+  memset(vstart, 0, p - (char*)vstart);
+  addrange(p, vend);
 }
 
 void
 kinit2(void *vstart, void *vend)
 {
-  freerange(vstart, vend);
+  char *top;
+
+  top = (char*)((uint)vend & ~(SPGSIZE-1));
+  while(kmem.nspg < NSUPERPG && top - SPGSIZE >= (char*)vstart){
+    top -= SPGSIZE;
+    kmem.spg[kmem.nspg++] = top;
+    kmem.npages += SPGSIZE/PGSIZE;
+  }
+  addrange(vstart, top);
   kmem.use_lock = 1;
+  cprintf("kalloc: %d MB of memory, %d pages free\n",
+          phystop / (1024*1024), kmem.nfree);
 }
 
-void
-freerange(void *vstart, void *vend)
+// Whether kinit2() has finished.  Until then only the boot cpu
+// may allocate, since kmem is not locked.
+int
+kready(void)
+{
+  return kmem.use_lock;
+}
+
+// Make the pages in [vstart, vend) available.  kinit2's range
+// starts where kinit1's ends, so the two form one lazy range.
+static void
+addrange(char *vstart, char *vend)
 {
   char *p;
-  p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
-    kfree(p);
+  uint n;
+
+  vstart = (char*)PGROUNDUP((uint)vstart);
+  vend = (char*)PGROUNDDOWN((uint)vend);
+  if(vend <= vstart)
+    return;
+  n = (vend - vstart) / PGSIZE;
+  kmem.npages += n;
+  if(kmem.lazy == kmem.lazyend){
+    kmem.lazy = vstart;
+    kmem.lazyend = vend;
+  } else if(vstart == kmem.lazyend){
+    kmem.lazyend = vend;
+  } else {
+    kmem.used[KM_OTHER] += n;  // kfree() uncounts them
+    for(p = vstart; p < vend; p += PGSIZE)
+      kfree(p);
+    return;
+  }
+  kmem.nfree += n;
 }
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
+// Drop a reference to the page of physical memory pointed
+// at by v, which normally should have been returned by a
 // call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// initializing the allocator; see addrange above.)
+// The page is freed when the last reference goes away.
 void
 kfree(char *v)
 {
   struct run *r;
 
-  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+  if((uint)v % PGSIZE || v < end || V2P(v) >= phystop)
     panic("kfree");
 
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(kmem.ref[V2P(v)/PGSIZE] > 1){
+    kmem.ref[V2P(v)/PGSIZE]--;
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return;
+  }
+  kmem.ref[V2P(v)/PGSIZE] = 0;
+  kmem.used[kmem.kind[V2P(v)/PGSIZE]]--;
+  kmem.kind[V2P(v)/PGSIZE] = KM_OTHER;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
@@ -72,6 +167,7 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -86,11 +182,218 @@ kalloc(void)
 
   if(kmem.use_lock)
     acquire(&kmem.lock);
+  if(kmem.freelist == 0 && kmem.lazy < kmem.lazyend){
+    // Take the next never-used page.
+    r = (struct run*)kmem.lazy;
+    kmem.lazy += PGSIZE;
+    r->next = 0;
+    kmem.freelist = r;
+  }
+  if(kmem.freelist == 0 && kmem.nspg > 0){
+    // Out of ordinary pages: give up a superpage.
+    char *s = kmem.spg[--kmem.nspg];
+    char *p;
+    for(p = s + SPGSIZE - PGSIZE; p >= s; p -= PGSIZE){
+      ((struct run*)p)->next = kmem.freelist;
+      kmem.freelist = (struct run*)p;
+      kmem.nfree++;
+    }
+  }
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.ref[V2P(r)/PGSIZE] = 1;
+    kmem.nfree--;
+    kmem.used[KM_OTHER]++;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
   return (char*)r;
 }
 
+// Allocate n physically contiguous pages, or return 0 if there
+// is no such run.  Meant for boot-time tables, which normally
+// come from the never-used range.
+static char*
+kallocn(uint n)
+{
+  struct run *r, *last, **start, **pp;
+  uint len, i;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(kmem.lazyend - kmem.lazy >= n*PGSIZE){
+    r = (struct run*)kmem.lazy;
+    kmem.lazy += n*PGSIZE;
+    goto found;
+  }
+  len = 0;
+  last = 0;
+  start = &kmem.freelist;
+  for(pp = &kmem.freelist; (r = *pp) != 0; pp = &r->next){
+    if(len == 0 || (char*)r != (char*)last - PGSIZE){
+      start = pp;
+      len = 0;
+    }
+    last = r;
+    if(++len == n){
+      *start = r->next;
+      goto found;
+    }
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return 0;
+
+found:
+  for(i = 0; i < n; i++)
+    kmem.ref[V2P(r)/PGSIZE + i] = 1;
+  kmem.nfree -= n;
+  kmem.used[KM_OTHER] += n;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return (char*)r;
+}
+
+// Size a kernel table whose param.h size is meant for 64MB of
+// physical memory: scale n by the memory there is, up to 16x.
+uint
+kscale(uint n)
+{
+  uint m;
+
+  m = phystop / (64*1024*1024);
+  if(m < 1)
+    m = 1;
+  if(m > 16)
+    m = 16;
+  return n * m;
+}
+
+// Like kscale(n), for a table of size-byte entries that is
+// allocated before kinit2() and so must fit in what kinit1() was
+// given, along with the other boot tables and the stacks that
+// startothers() takes.  The table gets at most a quarter of the
+// pages still free there, but never fewer than n entries.
+uint
+kscaleboot(uint n, uint size)
+{
+  uint max;
+
+  max = (kmem.lazyend - kmem.lazy) / 4 / size;
+  if(kscale(n) < max)
+    return kscale(n);
+  return max > n ? max : n;
+}
+
+// Allocate a zeroed boot-time table of n entries of size bytes.
+void*
+ktable(uint n, uint size)
+{
+  char *t;
+
+  if((t = kallocn(PGROUNDUP(n * size) / PGSIZE)) == 0)
+    panic("ktable");
+  memset(t, 0, PGROUNDUP(n * size));
+  return t;
+}
+
+// Allocate one 4MB, 4MB-aligned superpage from the boot-time
+// reserve.  Returns 0 if none is left.
+char*
+kalloc4m(void)
+{
+  char *s;
+
+  s = 0;
+  acquire(&kmem.lock);
+  if(kmem.nspg > 0){
+    s = kmem.spg[--kmem.nspg];
+    kmem.used[KM_USER] += SPGSIZE/PGSIZE;
+  }
+  release(&kmem.lock);
+  return s;
+}
+
+// Return a superpage from kalloc4m() to the reserve.
+void
+kfree4m(char *s)
+{
+  if((uint)s % SPGSIZE || s < end || V2P(s) >= phystop)
+    panic("kfree4m");
+  acquire(&kmem.lock);
+  if(kmem.nspg >= NSUPERPG)
+    panic("kfree4m: overflow");
+  kmem.spg[kmem.nspg++] = s;
+  kmem.used[KM_USER] -= SPGSIZE/PGSIZE;
+  release(&kmem.lock);
+}
+
+// Turn superpage s into 1024 ordinary pages, each of which
+// must later be released with kfree().
+void
+ksplit4m(char *s)
+{
+  uint i;
+
+  if((uint)s % SPGSIZE || s < end || V2P(s) >= phystop)
+    panic("ksplit4m");
+  acquire(&kmem.lock);
+  for(i = 0; i < SPGSIZE/PGSIZE; i++){
+    kmem.ref[V2P(s)/PGSIZE + i] = 1;
+    kmem.kind[V2P(s)/PGSIZE + i] = KM_USER;
+  }
+  release(&kmem.lock);
+}
+
+// Take another reference to the allocated page v.
+void
+kref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= phystop)
+    panic("kref");
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(kmem.ref[V2P(v)/PGSIZE] == 0xFFFF)
+    panic("kref: overflow");
+  kmem.ref[V2P(v)/PGSIZE]++;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Return the number of references to page v.
+int
+krefcnt(char *v)
+{
+  return kmem.ref[V2P(v)/PGSIZE];
+}
+
+// Record that allocated page v is used for kind (KM_*).
+void
+ktag(char *v, int kind)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= phystop || kind >= NKM)
+    panic("ktag");
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  kmem.used[kmem.kind[V2P(v)/PGSIZE]]--;
+  kmem.kind[V2P(v)/PGSIZE] = kind;
+  kmem.used[kind]++;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+void
+kmeminfo(struct meminfo *mi)
+{
+  int i;
+
+  acquire(&kmem.lock);
+  mi->total = kmem.npages;
+  mi->free = kmem.nfree;
+  mi->spfree = kmem.nspg * (SPGSIZE/PGSIZE);
+  mi->physpages = phystop / PGSIZE;
+  for(i = 0; i < NKM; i++)
+    mi->used[i] = kmem.used[i];
+  release(&kmem.lock);
+}
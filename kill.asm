@@ -0,0 +1,1668 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "pdx.h"
+#endif // PDX_XV6
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 27                	jle    4a <main+0x4a>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    kill(atoi(argv[i]));
+  31:	e8 fa 01 00 00       	call   230 <atoi>
+  36:	89 04 24             	mov    %eax,(%esp)
+  39:	e8 35 03 00 00       	call   373 <kill>
+  for(i=1; i<argc; i++)
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	39 de                	cmp    %ebx,%esi
+  43:	75 e3                	jne    28 <main+0x28>
+  exit();
+  45:	e8 f9 02 00 00       	call   343 <exit>
+    printf(2, "usage: kill pid...\n");
+  4a:	50                   	push   %eax
+  4b:	50                   	push   %eax
+  4c:	68 88 0a 00 00       	push   $0xa88
+  51:	6a 02                	push   $0x2
+  53:	e8 e8 04 00 00       	call   540 <printf>
+    exit();
+  58:	e8 e6 02 00 00       	call   343 <exit>
+  5d:	66 90                	xchg   %ax,%ax
+  5f:	90                   	nop
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 be 01 00 00       	call   35b <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 91 01 00 00       	call   383 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 94 01 00 00       	call   39b <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 5a 01 00 00       	call   36b <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	56                   	push   %esi
+ 234:	53                   	push   %ebx
+ 235:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 238:	0f b6 02             	movzbl (%edx),%eax
+ 23b:	3c 20                	cmp    $0x20,%al
+ 23d:	75 0c                	jne    24b <atoi+0x1b>
+ 23f:	90                   	nop
+ 240:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 244:	83 c2 01             	add    $0x1,%edx
+ 247:	3c 20                	cmp    $0x20,%al
+ 249:	74 f5                	je     240 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 24b:	3c 2d                	cmp    $0x2d,%al
+ 24d:	74 41                	je     290 <atoi+0x60>
+ 24f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 254:	3c 2b                	cmp    $0x2b,%al
+ 256:	74 3d                	je     295 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 258:	0f be 0a             	movsbl (%edx),%ecx
+ 25b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 25e:	3c 09                	cmp    $0x9,%al
+ 260:	b8 00 00 00 00       	mov    $0x0,%eax
+ 265:	77 21                	ja     288 <atoi+0x58>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 276:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 0a             	movsbl (%edx),%ecx
+ 27d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x40>
+  return sign*n;
+ 285:	0f af c6             	imul   %esi,%eax
+}
+ 288:	5b                   	pop    %ebx
+ 289:	5e                   	pop    %esi
+ 28a:	5d                   	pop    %ebp
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 290:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 295:	83 c2 01             	add    $0x1,%edx
+ 298:	eb be                	jmp    258 <atoi+0x28>
+ 29a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002a0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+ 2a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2a8:	0f b6 02             	movzbl (%edx),%eax
+ 2ab:	3c 20                	cmp    $0x20,%al
+ 2ad:	75 0c                	jne    2bb <atoo+0x1b>
+ 2af:	90                   	nop
+ 2b0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2b4:	83 c2 01             	add    $0x1,%edx
+ 2b7:	3c 20                	cmp    $0x20,%al
+ 2b9:	74 f5                	je     2b0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2bb:	3c 2d                	cmp    $0x2d,%al
+ 2bd:	74 41                	je     300 <atoo+0x60>
+ 2bf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2c4:	3c 2b                	cmp    $0x2b,%al
+ 2c6:	74 3d                	je     305 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 2c8:	0f be 0a             	movsbl (%edx),%ecx
+ 2cb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2ce:	3c 07                	cmp    $0x7,%al
+ 2d0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2d5:	77 1e                	ja     2f5 <atoo+0x55>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 2e7:	0f be 0a             	movsbl (%edx),%ecx
+ 2ea:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2ed:	80 fb 07             	cmp    $0x7,%bl
+ 2f0:	76 ee                	jbe    2e0 <atoo+0x40>
+  return sign*n;
+ 2f2:	0f af c6             	imul   %esi,%eax
+}
+ 2f5:	5b                   	pop    %ebx
+ 2f6:	5e                   	pop    %esi
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 305:	83 c2 01             	add    $0x1,%edx
+ 308:	eb be                	jmp    2c8 <atoo+0x28>
+ 30a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000310 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+ 315:	8b 45 10             	mov    0x10(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 31e:	85 c0                	test   %eax,%eax
+ 320:	7e 13                	jle    335 <memmove+0x25>
+ 322:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 324:	89 d7                	mov    %edx,%edi
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 330:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 331:	39 f8                	cmp    %edi,%eax
+ 333:	75 fb                	jne    330 <memmove+0x20>
+  return vdst;
+}
+ 335:	5e                   	pop    %esi
+ 336:	89 d0                	mov    %edx,%eax
+ 338:	5f                   	pop    %edi
+ 339:	5d                   	pop    %ebp
+ 33a:	c3                   	ret
+
+0000033b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 33b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <exit>:
+SYSCALL(exit)
+ 343:	b8 02 00 00 00       	mov    $0x2,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <wait>:
+SYSCALL(wait)
+ 34b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <pipe>:
+SYSCALL(pipe)
+ 353:	b8 04 00 00 00       	mov    $0x4,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <read>:
+SYSCALL(read)
+ 35b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <write>:
+SYSCALL(write)
+ 363:	b8 10 00 00 00       	mov    $0x10,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <close>:
+SYSCALL(close)
+ 36b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <kill>:
+SYSCALL(kill)
+ 373:	b8 06 00 00 00       	mov    $0x6,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <exec>:
+SYSCALL(exec)
+ 37b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <open>:
+SYSCALL(open)
+ 383:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mknod>:
+SYSCALL(mknod)
+ 38b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <unlink>:
+SYSCALL(unlink)
+ 393:	b8 12 00 00 00       	mov    $0x12,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <fstat>:
+SYSCALL(fstat)
+ 39b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <link>:
+SYSCALL(link)
+ 3a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mkdir>:
+SYSCALL(mkdir)
+ 3ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <chdir>:
+SYSCALL(chdir)
+ 3b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <dup>:
+SYSCALL(dup)
+ 3bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <getpid>:
+SYSCALL(getpid)
+ 3c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <sbrk>:
+SYSCALL(sbrk)
+ 3cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <sleep>:
+SYSCALL(sleep)
+ 3d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <uptime>:
+SYSCALL(uptime)
+ 3db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <superpages>:
+SYSCALL(superpages)
+ 3e3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mmap>:
+SYSCALL(mmap)
+ 3eb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <munmap>:
+SYSCALL(munmap)
+ 3f3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <spawn>:
+SYSCALL(spawn)
+ 3fb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <swapstat>:
+SYSCALL(swapstat)
+ 403:	b8 27 00 00 00       	mov    $0x27,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 40b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <iostat>:
+SYSCALL(iostat)
+ 413:	b8 29 00 00 00       	mov    $0x29,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <dropcache>:
+SYSCALL(dropcache)
+ 41b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <iosched>:
+SYSCALL(iosched)
+ 423:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <halt>:
+SYSCALL(halt)
+ 42b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <date>:
+SYSCALL(date)
+ 433:	b8 17 00 00 00       	mov    $0x17,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 43b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getgid>:
+SYSCALL(getgid)
+ 443:	b8 19 00 00 00       	mov    $0x19,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <getppid>:
+SYSCALL(getppid)
+ 44b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <setuid>:
+SYSCALL(setuid)
+ 453:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <setgid>:
+SYSCALL(setgid)
+ 45b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <getprocs>:
+SYSCALL(getprocs)
+ 463:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 46b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getpriority>:
+SYSCALL(getpriority)
+ 473:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 47b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <chown>:
+SYSCALL(chown)
+ 483:	b8 21 00 00 00       	mov    $0x21,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <chgrp>:
+SYSCALL(chgrp)
+ 48b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+ 493:	66 90                	xchg   %ax,%ax
+ 495:	66 90                	xchg   %ax,%ax
+ 497:	66 90                	xchg   %ax,%ax
+ 499:	66 90                	xchg   %ax,%ax
+ 49b:	66 90                	xchg   %ax,%ax
+ 49d:	66 90                	xchg   %ax,%ax
+ 49f:	90                   	nop
+
+000004a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4a8:	89 d1                	mov    %edx,%ecx
+{
+ 4aa:	83 ec 3c             	sub    $0x3c,%esp
+ 4ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4b0:	85 d2                	test   %edx,%edx
+ 4b2:	0f 89 80 00 00 00    	jns    538 <printint+0x98>
+ 4b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4bc:	74 7a                	je     538 <printint+0x98>
+    x = -xx;
+ 4be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4c8:	31 f6                	xor    %esi,%esi
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4d0:	89 c8                	mov    %ecx,%eax
+ 4d2:	31 d2                	xor    %edx,%edx
+ 4d4:	89 f7                	mov    %esi,%edi
+ 4d6:	f7 f3                	div    %ebx
+ 4d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4db:	0f b6 92 fc 0a 00 00 	movzbl 0xafc(%edx),%edx
+ 4e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4e6:	89 ca                	mov    %ecx,%edx
+ 4e8:	89 c1                	mov    %eax,%ecx
+ 4ea:	39 da                	cmp    %ebx,%edx
+ 4ec:	73 e2                	jae    4d0 <printint+0x30>
+  if(neg)
+ 4ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4f1:	85 c0                	test   %eax,%eax
+ 4f3:	74 07                	je     4fc <printint+0x5c>
+    buf[i++] = '-';
+ 4f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4fa:	89 f7                	mov    %esi,%edi
+ 4fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 502:	01 df                	add    %ebx,%edi
+ 504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 508:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 50b:	83 ec 04             	sub    $0x4,%esp
+ 50e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 511:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 514:	6a 01                	push   $0x1
+ 516:	50                   	push   %eax
+ 517:	56                   	push   %esi
+ 518:	e8 46 fe ff ff       	call   363 <write>
+  while(--i >= 0)
+ 51d:	89 f8                	mov    %edi,%eax
+ 51f:	83 c4 10             	add    $0x10,%esp
+ 522:	83 ef 01             	sub    $0x1,%edi
+ 525:	39 d8                	cmp    %ebx,%eax
+ 527:	75 df                	jne    508 <printint+0x68>
+}
+ 529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 52c:	5b                   	pop    %ebx
+ 52d:	5e                   	pop    %esi
+ 52e:	5f                   	pop    %edi
+ 52f:	5d                   	pop    %ebp
+ 530:	c3                   	ret
+ 531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 538:	31 c0                	xor    %eax,%eax
+ 53a:	eb 89                	jmp    4c5 <printint+0x25>
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 549:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 54c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 54f:	0f b6 1e             	movzbl (%esi),%ebx
+ 552:	83 c6 01             	add    $0x1,%esi
+ 555:	84 db                	test   %bl,%bl
+ 557:	74 67                	je     5c0 <printf+0x80>
+ 559:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 55c:	31 d2                	xor    %edx,%edx
+ 55e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 561:	eb 34                	jmp    597 <printf+0x57>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+ 568:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 56b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 570:	83 f8 25             	cmp    $0x25,%eax
+ 573:	74 18                	je     58d <printf+0x4d>
+  write(fd, &c, 1);
+ 575:	83 ec 04             	sub    $0x4,%esp
+ 578:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 57b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 57e:	6a 01                	push   $0x1
+ 580:	50                   	push   %eax
+ 581:	57                   	push   %edi
+ 582:	e8 dc fd ff ff       	call   363 <write>
+ 587:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 58a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 58d:	0f b6 1e             	movzbl (%esi),%ebx
+ 590:	83 c6 01             	add    $0x1,%esi
+ 593:	84 db                	test   %bl,%bl
+ 595:	74 29                	je     5c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 597:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 59a:	85 d2                	test   %edx,%edx
+ 59c:	74 ca                	je     568 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 59e:	83 fa 25             	cmp    $0x25,%edx
+ 5a1:	75 ea                	jne    58d <printf+0x4d>
+      if(c == 'd'){
+ 5a3:	83 f8 25             	cmp    $0x25,%eax
+ 5a6:	0f 84 24 01 00 00    	je     6d0 <printf+0x190>
+ 5ac:	83 e8 63             	sub    $0x63,%eax
+ 5af:	83 f8 15             	cmp    $0x15,%eax
+ 5b2:	77 1c                	ja     5d0 <printf+0x90>
+ 5b4:	ff 24 85 a4 0a 00 00 	jmp    *0xaa4(,%eax,4)
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c3:	5b                   	pop    %ebx
+ 5c4:	5e                   	pop    %esi
+ 5c5:	5f                   	pop    %edi
+ 5c6:	5d                   	pop    %ebp
+ 5c7:	c3                   	ret
+ 5c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5da:	6a 01                	push   $0x1
+ 5dc:	52                   	push   %edx
+ 5dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5e0:	57                   	push   %edi
+ 5e1:	e8 7d fd ff ff       	call   363 <write>
+ 5e6:	83 c4 0c             	add    $0xc,%esp
+ 5e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ec:	6a 01                	push   $0x1
+ 5ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5f1:	52                   	push   %edx
+ 5f2:	57                   	push   %edi
+ 5f3:	e8 6b fd ff ff       	call   363 <write>
+        putc(fd, c);
+ 5f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5fb:	31 d2                	xor    %edx,%edx
+ 5fd:	eb 8e                	jmp    58d <printf+0x4d>
+ 5ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 60b:	8b 13                	mov    (%ebx),%edx
+ 60d:	6a 00                	push   $0x0
+ 60f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 611:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 614:	e8 87 fe ff ff       	call   4a0 <printint>
+        ap++;
+ 619:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 61c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61f:	31 d2                	xor    %edx,%edx
+ 621:	e9 67 ff ff ff       	jmp    58d <printf+0x4d>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 630:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 633:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 635:	83 c0 04             	add    $0x4,%eax
+ 638:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 63b:	85 db                	test   %ebx,%ebx
+ 63d:	0f 84 9d 00 00 00    	je     6e0 <printf+0x1a0>
+        while(*s != 0){
+ 643:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 646:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 648:	84 c0                	test   %al,%al
+ 64a:	0f 84 3d ff ff ff    	je     58d <printf+0x4d>
+ 650:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 653:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 656:	89 de                	mov    %ebx,%esi
+ 658:	89 d3                	mov    %edx,%ebx
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 666:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 669:	6a 01                	push   $0x1
+ 66b:	53                   	push   %ebx
+ 66c:	57                   	push   %edi
+ 66d:	e8 f1 fc ff ff       	call   363 <write>
+        while(*s != 0){
+ 672:	0f b6 06             	movzbl (%esi),%eax
+ 675:	83 c4 10             	add    $0x10,%esp
+ 678:	84 c0                	test   %al,%al
+ 67a:	75 e4                	jne    660 <printf+0x120>
+      state = 0;
+ 67c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 67f:	31 d2                	xor    %edx,%edx
+ 681:	e9 07 ff ff ff       	jmp    58d <printf+0x4d>
+ 686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 01                	push   $0x1
+ 69f:	e9 6b ff ff ff       	jmp    60f <printf+0xcf>
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	52                   	push   %edx
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 a1 fc ff ff       	call   363 <write>
+        ap++;
+ 6c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6c8:	31 d2                	xor    %edx,%edx
+ 6ca:	e9 be fe ff ff       	jmp    58d <printf+0x4d>
+ 6cf:	90                   	nop
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d9:	6a 01                	push   $0x1
+ 6db:	e9 11 ff ff ff       	jmp    5f1 <printf+0xb1>
+ 6e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6e5:	bb 9c 0a 00 00       	mov    $0xa9c,%ebx
+ 6ea:	e9 61 ff ff ff       	jmp    650 <printf+0x110>
+ 6ef:	90                   	nop
+
+000006f0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f3:	a1 e4 0e 00 00       	mov    0xee4,%eax
+{
+ 6f8:	89 e5                	mov    %esp,%ebp
+ 6fa:	56                   	push   %esi
+ 6fb:	53                   	push   %ebx
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 700:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 702:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 704:	39 ca                	cmp    %ecx,%edx
+ 706:	73 30                	jae    738 <lfree+0x48>
+ 708:	39 c1                	cmp    %eax,%ecx
+ 70a:	72 04                	jb     710 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 70c:	39 c2                	cmp    %eax,%edx
+ 70e:	72 f0                	jb     700 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 710:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 713:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 716:	39 f0                	cmp    %esi,%eax
+ 718:	74 26                	je     740 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 71a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 71c:	8b 42 04             	mov    0x4(%edx),%eax
+ 71f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 722:	39 d9                	cmp    %ebx,%ecx
+ 724:	74 30                	je     756 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 726:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 728:	5b                   	pop    %ebx
+  freep = p;
+ 729:	89 15 e4 0e 00 00    	mov    %edx,0xee4
+}
+ 72f:	5e                   	pop    %esi
+ 730:	5d                   	pop    %ebp
+ 731:	c3                   	ret
+ 732:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 738:	39 c1                	cmp    %eax,%ecx
+ 73a:	72 d0                	jb     70c <lfree+0x1c>
+ 73c:	eb c2                	jmp    700 <lfree+0x10>
+ 73e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 740:	03 58 04             	add    0x4(%eax),%ebx
+ 743:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 746:	8b 02                	mov    (%edx),%eax
+ 748:	8b 00                	mov    (%eax),%eax
+ 74a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 74c:	8b 42 04             	mov    0x4(%edx),%eax
+ 74f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 752:	39 d9                	cmp    %ebx,%ecx
+ 754:	75 d0                	jne    726 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 756:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 759:	89 15 e4 0e 00 00    	mov    %edx,0xee4
+    p->s.size += bp->s.size;
+ 75f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 762:	8b 09                	mov    (%ecx),%ecx
+ 764:	89 0a                	mov    %ecx,(%edx)
+}
+ 766:	5b                   	pop    %ebx
+ 767:	5e                   	pop    %esi
+ 768:	5d                   	pop    %ebp
+ 769:	c3                   	ret
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000770 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	89 c7                	mov    %eax,%edi
+ 776:	56                   	push   %esi
+ 777:	53                   	push   %ebx
+ 778:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 77b:	a1 e4 0e 00 00       	mov    0xee4,%eax
+ 780:	85 c0                	test   %eax,%eax
+ 782:	0f 84 88 00 00 00    	je     810 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 788:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 78a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 78d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 792:	39 df                	cmp    %ebx,%edi
+ 794:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 797:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 79e:	39 f9                	cmp    %edi,%ecx
+ 7a0:	72 0f                	jb     7b1 <lalloc+0x41>
+ 7a2:	eb 4c                	jmp    7f0 <lalloc+0x80>
+ 7a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 7aa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 7ad:	39 f9                	cmp    %edi,%ecx
+ 7af:	73 3f                	jae    7f0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 7b1:	89 d0                	mov    %edx,%eax
+ 7b3:	39 15 e4 0e 00 00    	cmp    %edx,0xee4
+ 7b9:	75 ed                	jne    7a8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 7bb:	83 ec 0c             	sub    $0xc,%esp
+ 7be:	56                   	push   %esi
+ 7bf:	e8 07 fc ff ff       	call   3cb <sbrk>
+  if(p == (char*)-1)
+ 7c4:	83 c4 10             	add    $0x10,%esp
+ 7c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7ca:	74 11                	je     7dd <lalloc+0x6d>
+  hp->s.size = nu;
+ 7cc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 7cf:	e8 1c ff ff ff       	call   6f0 <lfree>
+  return freep;
+ 7d4:	a1 e4 0e 00 00       	mov    0xee4,%eax
+      if((p = morecore(nunits)) == 0)
+ 7d9:	85 c0                	test   %eax,%eax
+ 7db:	75 cb                	jne    7a8 <lalloc+0x38>
+        return 0;
+  }
+}
+ 7dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7e0:	31 d2                	xor    %edx,%edx
+}
+ 7e2:	5b                   	pop    %ebx
+ 7e3:	89 d0                	mov    %edx,%eax
+ 7e5:	5e                   	pop    %esi
+ 7e6:	5f                   	pop    %edi
+ 7e7:	5d                   	pop    %ebp
+ 7e8:	c3                   	ret
+ 7e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 7f0:	39 cf                	cmp    %ecx,%edi
+ 7f2:	74 4c                	je     840 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 7f4:	29 f9                	sub    %edi,%ecx
+ 7f6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 7f9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 7fc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 7ff:	a3 e4 0e 00 00       	mov    %eax,0xee4
+}
+ 804:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 807:	89 d0                	mov    %edx,%eax
+ 809:	5b                   	pop    %ebx
+ 80a:	5e                   	pop    %esi
+ 80b:	5f                   	pop    %edi
+ 80c:	5d                   	pop    %ebp
+ 80d:	c3                   	ret
+ 80e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 810:	ba e8 0e 00 00       	mov    $0xee8,%edx
+ 815:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 817:	c7 05 e4 0e 00 00 e8 	movl   $0xee8,0xee4
+ 81e:	0e 00 00 
+ 821:	c7 05 e8 0e 00 00 e8 	movl   $0xee8,0xee8
+ 828:	0e 00 00 
+ 82b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 82d:	c7 05 ec 0e 00 00 00 	movl   $0x0,0xeec
+ 834:	00 00 00 
+ 837:	e9 51 ff ff ff       	jmp    78d <lalloc+0x1d>
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 840:	8b 0a                	mov    (%edx),%ecx
+ 842:	89 08                	mov    %ecx,(%eax)
+ 844:	eb b9                	jmp    7ff <lalloc+0x8f>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000850 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 859:	85 f6                	test   %esi,%esi
+ 85b:	74 42                	je     89f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 85d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 860:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 863:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 869:	77 3d                	ja     8a8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 86b:	31 c9                	xor    %ecx,%ecx
+ 86d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 872:	83 fa 02             	cmp    $0x2,%edx
+ 875:	74 17                	je     88e <free+0x3e>
+ 877:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87e:	66 90                	xchg   %ax,%ax
+ 880:	83 c1 01             	add    $0x1,%ecx
+ 883:	89 d8                	mov    %ebx,%eax
+ 885:	d3 e0                	shl    %cl,%eax
+ 887:	83 c0 01             	add    $0x1,%eax
+ 88a:	39 c2                	cmp    %eax,%edx
+ 88c:	75 f2                	jne    880 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 88e:	8b 04 8d c0 0e 00 00 	mov    0xec0(,%ecx,4),%eax
+  classes[c] = bp;
+ 895:	89 3c 8d c0 0e 00 00 	mov    %edi,0xec0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 89c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 89f:	5b                   	pop    %ebx
+ 8a0:	5e                   	pop    %esi
+ 8a1:	5f                   	pop    %edi
+ 8a2:	5d                   	pop    %ebp
+ 8a3:	c3                   	ret
+ 8a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8a8:	5b                   	pop    %ebx
+    lfree(bp);
+ 8a9:	89 f8                	mov    %edi,%eax
+}
+ 8ab:	5e                   	pop    %esi
+ 8ac:	5f                   	pop    %edi
+ 8ad:	5d                   	pop    %ebp
+    lfree(bp);
+ 8ae:	e9 3d fe ff ff       	jmp    6f0 <lfree>
+ 8b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008c0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8cc:	83 c0 07             	add    $0x7,%eax
+ 8cf:	c1 e8 03             	shr    $0x3,%eax
+ 8d2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 8d5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 8da:	77 44                	ja     920 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 8dc:	31 c9                	xor    %ecx,%ecx
+ 8de:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8e3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 8e8:	83 f8 02             	cmp    $0x2,%eax
+ 8eb:	76 11                	jbe    8fe <malloc+0x3e>
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 8f0:	83 c1 01             	add    $0x1,%ecx
+ 8f3:	89 d3                	mov    %edx,%ebx
+ 8f5:	d3 e3                	shl    %cl,%ebx
+ 8f7:	83 c3 01             	add    $0x1,%ebx
+ 8fa:	39 c3                	cmp    %eax,%ebx
+ 8fc:	72 f2                	jb     8f0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 8fe:	8b 04 8d c0 0e 00 00 	mov    0xec0(,%ecx,4),%eax
+ 905:	85 c0                	test   %eax,%eax
+ 907:	74 2f                	je     938 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 909:	8b 10                	mov    (%eax),%edx
+ 90b:	89 14 8d c0 0e 00 00 	mov    %edx,0xec0(,%ecx,4)
+  return (void*)(p + 1);
+ 912:	83 c0 08             	add    $0x8,%eax
+}
+ 915:	83 c4 1c             	add    $0x1c,%esp
+ 918:	5b                   	pop    %ebx
+ 919:	5e                   	pop    %esi
+ 91a:	5f                   	pop    %edi
+ 91b:	5d                   	pop    %ebp
+ 91c:	c3                   	ret
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 920:	e8 4b fe ff ff       	call   770 <lalloc>
+ 925:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 927:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 92a:	85 d2                	test   %edx,%edx
+ 92c:	75 e7                	jne    915 <malloc+0x55>
+      return 0;
+ 92e:	31 c0                	xor    %eax,%eax
+ 930:	eb e3                	jmp    915 <malloc+0x55>
+ 932:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 938:	31 d2                	xor    %edx,%edx
+ 93a:	b8 00 02 00 00       	mov    $0x200,%eax
+ 93f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 942:	f7 f3                	div    %ebx
+  if(n < 4)
+ 944:	ba 04 00 00 00       	mov    $0x4,%edx
+ 949:	89 d6                	mov    %edx,%esi
+ 94b:	39 d0                	cmp    %edx,%eax
+ 94d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 950:	0f af f3             	imul   %ebx,%esi
+ 953:	89 f0                	mov    %esi,%eax
+ 955:	e8 16 fe ff ff       	call   770 <lalloc>
+ 95a:	85 c0                	test   %eax,%eax
+ 95c:	74 d0                	je     92e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 95e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 961:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 964:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 96b:	8b 14 8d c0 0e 00 00 	mov    0xec0(,%ecx,4),%edx
+ 972:	39 f8                	cmp    %edi,%eax
+ 974:	73 22                	jae    998 <malloc+0xd8>
+ 976:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 979:	eb 09                	jmp    984 <malloc+0xc4>
+ 97b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+ 980:	89 c2                	mov    %eax,%edx
+ 982:	89 c8                	mov    %ecx,%eax
+ 984:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ 987:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ 98a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ 98c:	39 f9                	cmp    %edi,%ecx
+ 98e:	72 f0                	jb     980 <malloc+0xc0>
+ 990:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 993:	e9 73 ff ff ff       	jmp    90b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ 998:	89 d0                	mov    %edx,%eax
+ 99a:	8b 12                	mov    (%edx),%edx
+ 99c:	e9 6a ff ff ff       	jmp    90b <malloc+0x4b>
+ 9a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+
+000009b0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	56                   	push   %esi
+ 9b4:	53                   	push   %ebx
+ 9b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ 9bb:	85 c9                	test   %ecx,%ecx
+ 9bd:	74 06                	je     9c5 <calloc+0x15>
+ 9bf:	89 c8                	mov    %ecx,%eax
+ 9c1:	f7 e3                	mul    %ebx
+ 9c3:	70 33                	jo     9f8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ 9c5:	0f af d9             	imul   %ecx,%ebx
+ 9c8:	83 ec 0c             	sub    $0xc,%esp
+ 9cb:	53                   	push   %ebx
+ 9cc:	e8 ef fe ff ff       	call   8c0 <malloc>
+ 9d1:	83 c4 10             	add    $0x10,%esp
+ 9d4:	89 c6                	mov    %eax,%esi
+ 9d6:	85 c0                	test   %eax,%eax
+ 9d8:	74 1e                	je     9f8 <calloc+0x48>
+    memset(p, 0, n * size);
+ 9da:	83 ec 04             	sub    $0x4,%esp
+ 9dd:	53                   	push   %ebx
+ 9de:	6a 00                	push   $0x0
+ 9e0:	50                   	push   %eax
+ 9e1:	e8 3a f7 ff ff       	call   120 <memset>
+ 9e6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ 9e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9ec:	89 f0                	mov    %esi,%eax
+ 9ee:	5b                   	pop    %ebx
+ 9ef:	5e                   	pop    %esi
+ 9f0:	5d                   	pop    %ebp
+ 9f1:	c3                   	ret
+ 9f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 9f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 9fb:	31 f6                	xor    %esi,%esi
+}
+ 9fd:	89 f0                	mov    %esi,%eax
+ 9ff:	5b                   	pop    %ebx
+ a00:	5e                   	pop    %esi
+ a01:	5d                   	pop    %ebp
+ a02:	c3                   	ret
+ a03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a10 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	56                   	push   %esi
+ a15:	53                   	push   %ebx
+ a16:	83 ec 0c             	sub    $0xc,%esp
+ a19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ a1f:	85 db                	test   %ebx,%ebx
+ a21:	74 55                	je     a78 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ a23:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ a26:	89 de                	mov    %ebx,%esi
+ a28:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ a2f:	39 c7                	cmp    %eax,%edi
+ a31:	72 0d                	jb     a40 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ a33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a36:	89 f0                	mov    %esi,%eax
+ a38:	5b                   	pop    %ebx
+ a39:	5e                   	pop    %esi
+ a3a:	5f                   	pop    %edi
+ a3b:	5d                   	pop    %ebp
+ a3c:	c3                   	ret
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ a40:	83 ec 0c             	sub    $0xc,%esp
+ a43:	50                   	push   %eax
+ a44:	e8 77 fe ff ff       	call   8c0 <malloc>
+ a49:	83 c4 10             	add    $0x10,%esp
+ a4c:	89 c6                	mov    %eax,%esi
+ a4e:	85 c0                	test   %eax,%eax
+ a50:	74 e1                	je     a33 <realloc+0x23>
+  memmove(p, ap, have);
+ a52:	83 ec 04             	sub    $0x4,%esp
+ a55:	57                   	push   %edi
+ a56:	53                   	push   %ebx
+ a57:	50                   	push   %eax
+ a58:	e8 b3 f8 ff ff       	call   310 <memmove>
+  free(ap);
+ a5d:	89 1c 24             	mov    %ebx,(%esp)
+ a60:	e8 eb fd ff ff       	call   850 <free>
+  return p;
+ a65:	83 c4 10             	add    $0x10,%esp
+}
+ a68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a6b:	89 f0                	mov    %esi,%eax
+ a6d:	5b                   	pop    %ebx
+ a6e:	5e                   	pop    %esi
+ a6f:	5f                   	pop    %edi
+ a70:	5d                   	pop    %ebp
+ a71:	c3                   	ret
+ a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a78:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a7e:	5b                   	pop    %ebx
+ a7f:	5e                   	pop    %esi
+ a80:	5f                   	pop    %edi
+ a81:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ a82:	e9 39 fe ff ff       	jmp    8c0 <malloc>
@@ -193,6 +193,27 @@ static void fill_rtcdate(struct rtcdate *r)
   r->year   = cmos_read(YEAR);
 }
 
+#define EXTLO   0x30    // KB of memory above 1MB, up to 64MB
+#define EXTHI   0x31
+#define EXT16LO 0x34    // 64KB blocks of memory above 16MB
+#define EXT16HI 0x35
+
+// Size of physical memory in bytes, as the BIOS left it in
+// CMOS, or 0 if it did not.  Counts only memory below 4GB.
+uint
+cmosmem(void)
+{
+  uint n;
+
+  n = cmos_read(EXT16LO) | (cmos_read(EXT16HI) << 8);
+  if(n > 0)
+    return 16*1024*1024 + n*64*1024;
+  n = cmos_read(EXTLO) | (cmos_read(EXTHI) << 8);
+  if(n > 0)
+    return 1024*1024 + n*1024;
+  return 0;
+}
+
 // qemu seems to use 24-hour GWT and the values are BCD encoded
 void cmostime(struct rtcdate *r)
 {
@@ -5,12 +5,14 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "x86.h"
+#include "iostat.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
-// calls. The logging system only commits when there are
-// no FS system calls active. Thus there is never
+// calls. The logging system only closes a transaction when there
+// are no FS system calls active in it. Thus there is never
 // any reasoning required about whether a commit might
 // write an uncommitted system call's updates to disk.
 //
@@ -20,6 +22,15 @@
 // But if it thinks the log is close to running out, it
 // sleeps until the last outstanding end_op() commits.
 //
+// Transactions are double-buffered: one is open to new system
+// calls while the one before it commits.  Closing a transaction
+// copies its blocks to shadow buffers, and the commit writes the
+// copies to the log and then home, so system calls in the open
+// transaction may change the cached blocks meanwhile.  Commits
+// still run one at a time, so one log region does: the last
+// end_op() of a transaction commits it, unless a commit is in
+// flight, which then goes on to commit this one too.
+//
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
 //   header block, containing block #s for block A, B, C, ...
@@ -27,7 +38,9 @@
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// A commit queues all of the transaction's log writes before
+// waiting for them, and likewise its installs, so the disk can
+// merge and order them.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
@@ -42,11 +55,22 @@ struct log {
   int size;
   int outstanding; // how many FS sys calls are executing.
   int committing;  // in commit(), please wait.
+  int closing;     // copying the closed transaction's blocks.
   int dev;
-  struct logheader lh;
+  struct logheader lh;   // the open transaction
+  struct logheader clh;  // the committing one, as on disk
+  uint ncommit;      // statistics, under lock
+  uint commitblocks;
+  uint commitlat;    // Kcycles
+  uint commitmax;
 };
 struct log log;
 
+// Copies of the committing transaction's blocks, for the disk
+// writes.  Not in the buffer cache.
+static struct buf shadow[LOGSIZE];
+static uchar shadowdata[LOGSIZE][BSIZE];
+
 static void recover_from_log(void);
 static void commit();
 
@@ -57,7 +81,13 @@ initlog(int dev)
     panic("initlog: too big logheader");
 
   struct superblock sb;
+  int i;
+
   initlock(&log.lock, "log");
+  for (i = 0; i < LOGSIZE; i++) {
+    initsleeplock(&shadow[i].lock, "shadow");
+    shadow[i].data = shadowdata[i];
+  }
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
@@ -65,19 +95,24 @@ initlog(int dev)
   recover_from_log();
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location,
+// through the buffer cache.  Used for recovery.
 static void
-install_trans(void)
+replay(void)
 {
+  struct buf *dbuf[LOGSIZE];
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
+  for (tail = 0; tail < log.clh.n; tail++) {
     struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
+    dbuf[tail] = bread(log.dev, log.clh.block[tail]); // read dst
+    memmove(dbuf[tail]->data, lbuf->data, BSIZE);  // copy block to dst
+    bsubmit(dbuf[tail]);  // start writing dst to disk
     brelse(lbuf);
-    brelse(dbuf);
+  }
+  for (tail = 0; tail < log.clh.n; tail++) {
+    bwait(dbuf[tail]);
+    brelse(dbuf[tail]);
   }
 }
 
@@ -88,9 +123,9 @@ read_head(void)
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *lh = (struct logheader *) (buf->data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  log.clh.n = lh->n;
+  for (i = 0; i < log.clh.n; i++) {
+    log.clh.block[i] = lh->block[i];
   }
   brelse(buf);
 }
@@ -104,9 +139,9 @@ write_head(void)
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->n = log.clh.n;
+  for (i = 0; i < log.clh.n; i++) {
+    hb->block[i] = log.clh.block[i];
   }
   bwrite(buf);
   brelse(buf);
@@ -116,8 +151,8 @@ static void
 recover_from_log(void)
 {
   read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
+  replay(); // if committed, copy from log to disk
+  log.clh.n = 0;
   write_head(); // clear the log
 }
 
@@ -127,7 +162,7 @@ begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.closing){
       sleep(&log, &log.lock);
     } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
       // this op might exhaust log space; wait for commit.
@@ -141,7 +176,8 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// commits if this was the last outstanding operation
+// and no commit is in flight.
 void
 end_op(void)
 {
@@ -149,9 +185,7 @@ end_op(void)
 
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
+  if(log.outstanding == 0 && !log.committing){
     do_commit = 1;
     log.committing = 1;
   } else {
@@ -166,44 +200,126 @@ end_op(void)
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
     commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Copy the closed transaction's blocks from the cache
+// to the shadow buffers.
+static void
+snapshot(void)
+{
+  struct buf *b;
+  int i;
+
+  for (i = 0; i < log.clh.n; i++) {
+    acquiresleep(&shadow[i].lock);
+    shadow[i].dev = log.dev;
+    b = bread(log.dev, log.clh.block[i]);
+    memmove(shadow[i].data, b->data, BSIZE);
+    brelse(b);
+  }
+}
+
+// Write the shadow buffers to the log.
 static void
 write_log(void)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+  for (tail = 0; tail < log.clh.n; tail++) {
+    shadow[tail].blockno = log.start+tail+1;
+    bsubmit(&shadow[tail]);  // start writing the log
+  }
+  for (tail = 0; tail < log.clh.n; tail++)
+    bwait(&shadow[tail]);
+}
+
+// Write the shadow buffers to their home locations.
+static void
+install_trans(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.clh.n; tail++) {
+    shadow[tail].blockno = log.clh.block[tail];
+    bsubmit(&shadow[tail]);
   }
+  for (tail = 0; tail < log.clh.n; tail++)
+    bwait(&shadow[tail]);
 }
 
+// The committed blocks are home, so the cache may evict them,
+// unless the open transaction has logged them again.  Holding
+// a block's buffer lock means no system call is between
+// changing it and calling log_write().
+static void
+unpin(void)
+{
+  struct buf *b;
+  int i, j;
+
+  for (i = 0; i < log.clh.n; i++) {
+    b = bread(log.dev, log.clh.block[i]);
+    acquire(&log.lock);
+    for (j = 0; j < log.lh.n; j++)
+      if (log.lh.block[j] == b->blockno)
+        break;
+    if (j == log.lh.n)
+      b->flags &= ~B_DIRTY;
+    release(&log.lock);
+    brelse(b);
+    releasesleep(&shadow[i].lock);
+  }
+}
+
+// Commit the open transaction, and the next one as well
+// if its system calls have finished by then.  Clears
+// log.committing in the same critical section as the last
+// check, so no end_op() can leave a transaction behind.
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
+  uint n, t;
+
+  acquire(&log.lock);
+  while (log.outstanding == 0 && log.lh.n > 0) {
+    // Close the transaction.  System calls wait to
+    // start until its blocks are copied.
+    log.clh = log.lh;
+    log.lh.n = 0;
+    log.closing = 1;
+    release(&log.lock);
+    n = log.clh.n;
+    t = rdtsc() >> 10;
+    snapshot();
+    acquire(&log.lock);
+    log.closing = 0;
+    wakeup(&log);
+    release(&log.lock);
+
+    write_log();     // Write copies of modified blocks to log
     write_head();    // Write header to disk -- the real commit
     install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
+    log.clh.n = 0;
     write_head();    // Erase the transaction from the log
+    unpin();
+    t = (rdtsc() >> 10) - t;
+
+    acquire(&log.lock);
+    log.ncommit++;
+    log.commitblocks += n;
+    log.commitlat += t;
+    if(t > log.commitmax)
+      log.commitmax = t;
   }
+  log.committing = 0;
+  wakeup(&log);
+  release(&log.lock);
 }
 
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// commit() copies it when the transaction closes.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -232,3 +348,13 @@ log_write(struct buf *b)
   release(&log.lock);
 }
 
+void
+logstat(struct iostat *st)
+{
+  acquire(&log.lock);
+  st->ncommit = log.ncommit;
+  st->commitblocks = log.commitblocks;
+  st->commitlat = log.commitlat;
+  st->commitmax = log.commitmax;
+  release(&log.lock);
+}
@@ -0,0 +1,1814 @@
+
+_logbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  struct iostat a, b;
+  int i, n, t;
+  uint c;
+
+  n = argc > 1 ? atoi(argv[1]) : NWRITER;
+  17:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1a:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : NWRITER;
+  1d:	0f 8f f7 00 00 00    	jg     11a <main+0x11a>
+  if(n < 1 || n > MAXW)
+    n = NWRITER;
+  iostat(&a);
+  23:	83 ec 0c             	sub    $0xc,%esp
+  26:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+    n = NWRITER;
+  2c:	be 03 00 00 00       	mov    $0x3,%esi
+  iostat(&a);
+  31:	50                   	push   %eax
+  32:	e8 1c 05 00 00       	call   553 <iostat>
+  t = uptime();
+  37:	e8 df 04 00 00       	call   51b <uptime>
+  3c:	83 c4 10             	add    $0x10,%esp
+  3f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+  41:	31 db                	xor    %ebx,%ebx
+  43:	eb 0a                	jmp    4f <main+0x4f>
+  45:	8d 76 00             	lea    0x0(%esi),%esi
+  48:	83 c3 01             	add    $0x1,%ebx
+  4b:	39 f3                	cmp    %esi,%ebx
+  4d:	74 72                	je     c1 <main+0xc1>
+    if(fork() == 0)
+  4f:	e8 27 04 00 00       	call   47b <fork>
+  54:	85 c0                	test   %eax,%eax
+  56:	75 f0                	jne    48 <main+0x48>
+  strcpy(name, "logbench.0");
+  58:	8d 75 94             	lea    -0x6c(%ebp),%esi
+  5b:	51                   	push   %ecx
+  name[9] = '0' + i;
+  5c:	83 c3 30             	add    $0x30,%ebx
+  strcpy(name, "logbench.0");
+  5f:	51                   	push   %ecx
+  60:	68 c8 0b 00 00       	push   $0xbc8
+  65:	56                   	push   %esi
+  66:	e8 35 01 00 00       	call   1a0 <strcpy>
+  name[9] = '0' + i;
+  6b:	88 5d 9d             	mov    %bl,-0x63(%ebp)
+  if((fd = open(name, O_CREATE|O_WRONLY)) < 0){
+  6e:	5b                   	pop    %ebx
+  6f:	bb 16 00 00 00       	mov    $0x16,%ebx
+  74:	5f                   	pop    %edi
+  75:	68 01 02 00 00       	push   $0x201
+  7a:	56                   	push   %esi
+  7b:	e8 43 04 00 00       	call   4c3 <open>
+  80:	83 c4 10             	add    $0x10,%esp
+  83:	89 c7                	mov    %eax,%edi
+  85:	85 c0                	test   %eax,%eax
+  87:	0f 88 f4 00 00 00    	js     181 <main+0x181>
+  8d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(fd, buf, CHUNK);
+  90:	83 ec 04             	sub    $0x4,%esp
+  93:	68 00 06 00 00       	push   $0x600
+  98:	68 60 10 00 00       	push   $0x1060
+  9d:	57                   	push   %edi
+  9e:	e8 00 04 00 00       	call   4a3 <write>
+  for(n = 0; n < FSIZE; n += CHUNK)
+  a3:	83 c4 10             	add    $0x10,%esp
+  a6:	83 eb 01             	sub    $0x1,%ebx
+  a9:	75 e5                	jne    90 <main+0x90>
+  close(fd);
+  ab:	83 ec 0c             	sub    $0xc,%esp
+  ae:	57                   	push   %edi
+  af:	e8 f7 03 00 00       	call   4ab <close>
+  unlink(name);
+  b4:	89 34 24             	mov    %esi,(%esp)
+  b7:	e8 17 04 00 00       	call   4d3 <unlink>
+  exit();
+  bc:	e8 c2 03 00 00       	call   483 <exit>
+      writer(i);
+  for(i = 0; i < n; i++)
+  c1:	31 db                	xor    %ebx,%ebx
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+    wait();
+  c8:	e8 be 03 00 00       	call   48b <wait>
+  for(i = 0; i < n; i++)
+  cd:	83 c3 01             	add    $0x1,%ebx
+  d0:	39 f3                	cmp    %esi,%ebx
+  d2:	75 f4                	jne    c8 <main+0xc8>
+  t = uptime() - t;
+  d4:	e8 42 04 00 00       	call   51b <uptime>
+  iostat(&b);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - t;
+  dc:	29 f8                	sub    %edi,%eax
+  de:	89 c6                	mov    %eax,%esi
+  iostat(&b);
+  e0:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  e3:	50                   	push   %eax
+  e4:	e8 6a 04 00 00       	call   553 <iostat>
+
+  c = b.ncommit - a.ncommit;
+  e9:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  ec:	2b 7d 84             	sub    -0x7c(%ebp),%edi
+  printf(1, "%d writers, %d ms: %d commits", n, t, c);
+  ef:	89 3c 24             	mov    %edi,(%esp)
+  f2:	56                   	push   %esi
+  f3:	53                   	push   %ebx
+  f4:	68 ef 0b 00 00       	push   $0xbef
+  f9:	6a 01                	push   $0x1
+  fb:	e8 80 05 00 00       	call   680 <printf>
+  if(c > 0)
+ 100:	83 c4 20             	add    $0x20,%esp
+ 103:	85 ff                	test   %edi,%edi
+ 105:	75 4d                	jne    154 <main+0x154>
+    printf(1, " of %d blocks avg, %d Kcycles avg, %d max",
+           (b.commitblocks - a.commitblocks) / c,
+           (b.commitlat - a.commitlat) / c, b.commitmax);
+  printf(1, "\n");
+ 107:	50                   	push   %eax
+ 108:	50                   	push   %eax
+ 109:	68 ed 0b 00 00       	push   $0xbed
+ 10e:	6a 01                	push   $0x1
+ 110:	e8 6b 05 00 00       	call   680 <printf>
+  exit();
+ 115:	e8 69 03 00 00       	call   483 <exit>
+  n = argc > 1 ? atoi(argv[1]) : NWRITER;
+ 11a:	83 ec 0c             	sub    $0xc,%esp
+ 11d:	ff 70 04             	push   0x4(%eax)
+ 120:	e8 4b 02 00 00       	call   370 <atoi>
+  if(n < 1 || n > MAXW)
+ 125:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : NWRITER;
+ 128:	89 c6                	mov    %eax,%esi
+  if(n < 1 || n > MAXW)
+ 12a:	8d 40 ff             	lea    -0x1(%eax),%eax
+ 12d:	83 f8 07             	cmp    $0x7,%eax
+ 130:	0f 87 ed fe ff ff    	ja     23 <main+0x23>
+  iostat(&a);
+ 136:	83 ec 0c             	sub    $0xc,%esp
+ 139:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+ 13f:	50                   	push   %eax
+ 140:	e8 0e 04 00 00       	call   553 <iostat>
+  t = uptime();
+ 145:	e8 d1 03 00 00       	call   51b <uptime>
+ 14a:	83 c4 10             	add    $0x10,%esp
+ 14d:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+ 14f:	e9 ed fe ff ff       	jmp    41 <main+0x41>
+    printf(1, " of %d blocks avg, %d Kcycles avg, %d max",
+ 154:	83 ec 0c             	sub    $0xc,%esp
+ 157:	31 d2                	xor    %edx,%edx
+ 159:	ff 75 e4             	push   -0x1c(%ebp)
+           (b.commitlat - a.commitlat) / c, b.commitmax);
+ 15c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 15f:	2b 45 8c             	sub    -0x74(%ebp),%eax
+    printf(1, " of %d blocks avg, %d Kcycles avg, %d max",
+ 162:	f7 f7                	div    %edi
+ 164:	31 d2                	xor    %edx,%edx
+ 166:	50                   	push   %eax
+           (b.commitblocks - a.commitblocks) / c,
+ 167:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 16a:	2b 45 88             	sub    -0x78(%ebp),%eax
+    printf(1, " of %d blocks avg, %d Kcycles avg, %d max",
+ 16d:	f7 f7                	div    %edi
+ 16f:	50                   	push   %eax
+ 170:	68 10 0c 00 00       	push   $0xc10
+ 175:	6a 01                	push   $0x1
+ 177:	e8 04 05 00 00       	call   680 <printf>
+ 17c:	83 c4 20             	add    $0x20,%esp
+ 17f:	eb 86                	jmp    107 <main+0x107>
+    printf(2, "logbench: cannot create %s\n", name);
+ 181:	52                   	push   %edx
+ 182:	56                   	push   %esi
+ 183:	68 d3 0b 00 00       	push   $0xbd3
+ 188:	6a 02                	push   $0x2
+ 18a:	e8 f1 04 00 00       	call   680 <printf>
+    exit();
+ 18f:	e8 ef 02 00 00       	call   483 <exit>
+ 194:	66 90                	xchg   %ax,%ax
+ 196:	66 90                	xchg   %ax,%ax
+ 198:	66 90                	xchg   %ax,%ax
+ 19a:	66 90                	xchg   %ax,%ax
+ 19c:	66 90                	xchg   %ax,%ax
+ 19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1a1:	31 c0                	xor    %eax,%eax
+{
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	53                   	push   %ebx
+ 1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	84 d2                	test   %dl,%dl
+ 1bc:	75 f2                	jne    1b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c1:	89 c8                	mov    %ecx,%eax
+ 1c3:	c9                   	leave
+ 1c4:	c3                   	ret
+ 1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	53                   	push   %ebx
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1da:	0f b6 02             	movzbl (%edx),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 17                	jne    1f8 <strcmp+0x28>
+ 1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ec:	83 c2 01             	add    $0x1,%edx
+ 1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1f2:	84 c0                	test   %al,%al
+ 1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+ 1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1fb:	38 c3                	cmp    %al,%bl
+ 1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ff:	29 d8                	sub    %ebx,%eax
+}
+ 201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 214:	31 c0                	xor    %eax,%eax
+ 216:	29 d8                	sub    %ebx,%eax
+}
+ 218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21b:	c9                   	leave
+ 21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 21d:	0f b6 19             	movzbl (%ecx),%ebx
+ 220:	31 c0                	xor    %eax,%eax
+ 222:	eb db                	jmp    1ff <strcmp+0x2f>
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 236:	80 3a 00             	cmpb   $0x0,(%edx)
+ 239:	74 15                	je     250 <strlen+0x20>
+ 23b:	31 c0                	xor    %eax,%eax
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	83 c0 01             	add    $0x1,%eax
+ 243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 247:	89 c1                	mov    %eax,%ecx
+ 249:	75 f5                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+ 24b:	89 c8                	mov    %ecx,%eax
+ 24d:	5d                   	pop    %ebp
+ 24e:	c3                   	ret
+ 24f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 250:	31 c9                	xor    %ecx,%ecx
+}
+ 252:	5d                   	pop    %ebp
+ 253:	89 c8                	mov    %ecx,%eax
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26d:	89 d7                	mov    %edx,%edi
+ 26f:	fc                   	cld
+ 270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 275:	89 d0                	mov    %edx,%eax
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28a:	0f b6 10             	movzbl (%eax),%edx
+ 28d:	84 d2                	test   %dl,%dl
+ 28f:	75 12                	jne    2a3 <strchr+0x23>
+ 291:	eb 1d                	jmp    2b0 <strchr+0x30>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 29c:	83 c0 01             	add    $0x1,%eax
+ 29f:	84 d2                	test   %dl,%dl
+ 2a1:	74 0d                	je     2b0 <strchr+0x30>
+    if(*s == c)
+ 2a3:	38 d1                	cmp    %dl,%cl
+ 2a5:	75 f1                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2b0:	31 c0                	xor    %eax,%eax
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	c3                   	ret
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2c9:	31 db                	xor    %ebx,%ebx
+{
+ 2cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ce:	eb 27                	jmp    2f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	6a 01                	push   $0x1
+ 2d5:	56                   	push   %esi
+ 2d6:	6a 00                	push   $0x0
+ 2d8:	e8 be 01 00 00       	call   49b <read>
+    if(cc < 1)
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	7e 1d                	jle    301 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ef:	3c 0a                	cmp    $0xa,%al
+ 2f1:	74 10                	je     303 <gets+0x43>
+ 2f3:	3c 0d                	cmp    $0xd,%al
+ 2f5:	74 0c                	je     303 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2f7:	89 df                	mov    %ebx,%edi
+ 2f9:	83 c3 01             	add    $0x1,%ebx
+ 2fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ff:	7c cf                	jl     2d0 <gets+0x10>
+ 301:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 30a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 30d:	5b                   	pop    %ebx
+ 30e:	5e                   	pop    %esi
+ 30f:	5f                   	pop    %edi
+ 310:	5d                   	pop    %ebp
+ 311:	c3                   	ret
+ 312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	6a 00                	push   $0x0
+ 32a:	ff 75 08             	push   0x8(%ebp)
+ 32d:	e8 91 01 00 00       	call   4c3 <open>
+  if(fd < 0)
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	85 c0                	test   %eax,%eax
+ 337:	78 27                	js     360 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 339:	83 ec 08             	sub    $0x8,%esp
+ 33c:	ff 75 0c             	push   0xc(%ebp)
+ 33f:	89 c3                	mov    %eax,%ebx
+ 341:	50                   	push   %eax
+ 342:	e8 94 01 00 00       	call   4db <fstat>
+  close(fd);
+ 347:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 34a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 34c:	e8 5a 01 00 00       	call   4ab <close>
+  return r;
+ 351:	83 c4 10             	add    $0x10,%esp
+}
+ 354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 357:	89 f0                	mov    %esi,%eax
+ 359:	5b                   	pop    %ebx
+ 35a:	5e                   	pop    %esi
+ 35b:	5d                   	pop    %ebp
+ 35c:	c3                   	ret
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 365:	eb ed                	jmp    354 <stat+0x34>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+ 375:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 378:	0f b6 02             	movzbl (%edx),%eax
+ 37b:	3c 20                	cmp    $0x20,%al
+ 37d:	75 0c                	jne    38b <atoi+0x1b>
+ 37f:	90                   	nop
+ 380:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 384:	83 c2 01             	add    $0x1,%edx
+ 387:	3c 20                	cmp    $0x20,%al
+ 389:	74 f5                	je     380 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 38b:	3c 2d                	cmp    $0x2d,%al
+ 38d:	74 41                	je     3d0 <atoi+0x60>
+ 38f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 394:	3c 2b                	cmp    $0x2b,%al
+ 396:	74 3d                	je     3d5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 398:	0f be 0a             	movsbl (%edx),%ecx
+ 39b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 39e:	3c 09                	cmp    $0x9,%al
+ 3a0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3a5:	77 21                	ja     3c8 <atoi+0x58>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 3b6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 3ba:	0f be 0a             	movsbl (%edx),%ecx
+ 3bd:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 3c0:	80 fb 09             	cmp    $0x9,%bl
+ 3c3:	76 eb                	jbe    3b0 <atoi+0x40>
+  return sign*n;
+ 3c5:	0f af c6             	imul   %esi,%eax
+}
+ 3c8:	5b                   	pop    %ebx
+ 3c9:	5e                   	pop    %esi
+ 3ca:	5d                   	pop    %ebp
+ 3cb:	c3                   	ret
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 3d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 3d5:	83 c2 01             	add    $0x1,%edx
+ 3d8:	eb be                	jmp    398 <atoi+0x28>
+ 3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003e0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+ 3e4:	53                   	push   %ebx
+ 3e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 3e8:	0f b6 02             	movzbl (%edx),%eax
+ 3eb:	3c 20                	cmp    $0x20,%al
+ 3ed:	75 0c                	jne    3fb <atoo+0x1b>
+ 3ef:	90                   	nop
+ 3f0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 3f4:	83 c2 01             	add    $0x1,%edx
+ 3f7:	3c 20                	cmp    $0x20,%al
+ 3f9:	74 f5                	je     3f0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 3fb:	3c 2d                	cmp    $0x2d,%al
+ 3fd:	74 41                	je     440 <atoo+0x60>
+ 3ff:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 404:	3c 2b                	cmp    $0x2b,%al
+ 406:	74 3d                	je     445 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 408:	0f be 0a             	movsbl (%edx),%ecx
+ 40b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 40e:	3c 07                	cmp    $0x7,%al
+ 410:	b8 00 00 00 00       	mov    $0x0,%eax
+ 415:	77 1e                	ja     435 <atoo+0x55>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 420:	83 c2 01             	add    $0x1,%edx
+ 423:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 427:	0f be 0a             	movsbl (%edx),%ecx
+ 42a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 42d:	80 fb 07             	cmp    $0x7,%bl
+ 430:	76 ee                	jbe    420 <atoo+0x40>
+  return sign*n;
+ 432:	0f af c6             	imul   %esi,%eax
+}
+ 435:	5b                   	pop    %ebx
+ 436:	5e                   	pop    %esi
+ 437:	5d                   	pop    %ebp
+ 438:	c3                   	ret
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 445:	83 c2 01             	add    $0x1,%edx
+ 448:	eb be                	jmp    408 <atoo+0x28>
+ 44a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000450 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	8b 45 10             	mov    0x10(%ebp),%eax
+ 458:	8b 55 08             	mov    0x8(%ebp),%edx
+ 45b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 45e:	85 c0                	test   %eax,%eax
+ 460:	7e 13                	jle    475 <memmove+0x25>
+ 462:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 464:	89 d7                	mov    %edx,%edi
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 470:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 471:	39 f8                	cmp    %edi,%eax
+ 473:	75 fb                	jne    470 <memmove+0x20>
+  return vdst;
+}
+ 475:	5e                   	pop    %esi
+ 476:	89 d0                	mov    %edx,%eax
+ 478:	5f                   	pop    %edi
+ 479:	5d                   	pop    %ebp
+ 47a:	c3                   	ret
+
+0000047b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 47b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <exit>:
+SYSCALL(exit)
+ 483:	b8 02 00 00 00       	mov    $0x2,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <wait>:
+SYSCALL(wait)
+ 48b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <pipe>:
+SYSCALL(pipe)
+ 493:	b8 04 00 00 00       	mov    $0x4,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <read>:
+SYSCALL(read)
+ 49b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <write>:
+SYSCALL(write)
+ 4a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <close>:
+SYSCALL(close)
+ 4ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <kill>:
+SYSCALL(kill)
+ 4b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <exec>:
+SYSCALL(exec)
+ 4bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <open>:
+SYSCALL(open)
+ 4c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mknod>:
+SYSCALL(mknod)
+ 4cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <unlink>:
+SYSCALL(unlink)
+ 4d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <fstat>:
+SYSCALL(fstat)
+ 4db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <link>:
+SYSCALL(link)
+ 4e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mkdir>:
+SYSCALL(mkdir)
+ 4eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <chdir>:
+SYSCALL(chdir)
+ 4f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <dup>:
+SYSCALL(dup)
+ 4fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <getpid>:
+SYSCALL(getpid)
+ 503:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <sbrk>:
+SYSCALL(sbrk)
+ 50b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <sleep>:
+SYSCALL(sleep)
+ 513:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <uptime>:
+SYSCALL(uptime)
+ 51b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <superpages>:
+SYSCALL(superpages)
+ 523:	b8 23 00 00 00       	mov    $0x23,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mmap>:
+SYSCALL(mmap)
+ 52b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <munmap>:
+SYSCALL(munmap)
+ 533:	b8 25 00 00 00       	mov    $0x25,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <spawn>:
+SYSCALL(spawn)
+ 53b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <swapstat>:
+SYSCALL(swapstat)
+ 543:	b8 27 00 00 00       	mov    $0x27,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 54b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <iostat>:
+SYSCALL(iostat)
+ 553:	b8 29 00 00 00       	mov    $0x29,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <dropcache>:
+SYSCALL(dropcache)
+ 55b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <iosched>:
+SYSCALL(iosched)
+ 563:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <halt>:
+SYSCALL(halt)
+ 56b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <date>:
+SYSCALL(date)
+ 573:	b8 17 00 00 00       	mov    $0x17,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 57b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getgid>:
+SYSCALL(getgid)
+ 583:	b8 19 00 00 00       	mov    $0x19,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <getppid>:
+SYSCALL(getppid)
+ 58b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <setuid>:
+SYSCALL(setuid)
+ 593:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <setgid>:
+SYSCALL(setgid)
+ 59b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <getprocs>:
+SYSCALL(getprocs)
+ 5a3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 5ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getpriority>:
+SYSCALL(getpriority)
+ 5b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 5bb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <chown>:
+SYSCALL(chown)
+ 5c3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <chgrp>:
+SYSCALL(chgrp)
+ 5cb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+ 5d3:	66 90                	xchg   %ax,%ax
+ 5d5:	66 90                	xchg   %ax,%ax
+ 5d7:	66 90                	xchg   %ax,%ax
+ 5d9:	66 90                	xchg   %ax,%ax
+ 5db:	66 90                	xchg   %ax,%ax
+ 5dd:	66 90                	xchg   %ax,%ax
+ 5df:	90                   	nop
+
+000005e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5e8:	89 d1                	mov    %edx,%ecx
+{
+ 5ea:	83 ec 3c             	sub    $0x3c,%esp
+ 5ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5f0:	85 d2                	test   %edx,%edx
+ 5f2:	0f 89 80 00 00 00    	jns    678 <printint+0x98>
+ 5f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5fc:	74 7a                	je     678 <printint+0x98>
+    x = -xx;
+ 5fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 600:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 605:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 608:	31 f6                	xor    %esi,%esi
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 610:	89 c8                	mov    %ecx,%eax
+ 612:	31 d2                	xor    %edx,%edx
+ 614:	89 f7                	mov    %esi,%edi
+ 616:	f7 f3                	div    %ebx
+ 618:	8d 76 01             	lea    0x1(%esi),%esi
+ 61b:	0f b6 92 9c 0c 00 00 	movzbl 0xc9c(%edx),%edx
+ 622:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 626:	89 ca                	mov    %ecx,%edx
+ 628:	89 c1                	mov    %eax,%ecx
+ 62a:	39 da                	cmp    %ebx,%edx
+ 62c:	73 e2                	jae    610 <printint+0x30>
+  if(neg)
+ 62e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 631:	85 c0                	test   %eax,%eax
+ 633:	74 07                	je     63c <printint+0x5c>
+    buf[i++] = '-';
+ 635:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 63a:	89 f7                	mov    %esi,%edi
+ 63c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 63f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 642:	01 df                	add    %ebx,%edi
+ 644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 648:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 64b:	83 ec 04             	sub    $0x4,%esp
+ 64e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 651:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 654:	6a 01                	push   $0x1
+ 656:	50                   	push   %eax
+ 657:	56                   	push   %esi
+ 658:	e8 46 fe ff ff       	call   4a3 <write>
+  while(--i >= 0)
+ 65d:	89 f8                	mov    %edi,%eax
+ 65f:	83 c4 10             	add    $0x10,%esp
+ 662:	83 ef 01             	sub    $0x1,%edi
+ 665:	39 d8                	cmp    %ebx,%eax
+ 667:	75 df                	jne    648 <printint+0x68>
+}
+ 669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 66c:	5b                   	pop    %ebx
+ 66d:	5e                   	pop    %esi
+ 66e:	5f                   	pop    %edi
+ 66f:	5d                   	pop    %ebp
+ 670:	c3                   	ret
+ 671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 678:	31 c0                	xor    %eax,%eax
+ 67a:	eb 89                	jmp    605 <printint+0x25>
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 689:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 68c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 68f:	0f b6 1e             	movzbl (%esi),%ebx
+ 692:	83 c6 01             	add    $0x1,%esi
+ 695:	84 db                	test   %bl,%bl
+ 697:	74 67                	je     700 <printf+0x80>
+ 699:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 69c:	31 d2                	xor    %edx,%edx
+ 69e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6a1:	eb 34                	jmp    6d7 <printf+0x57>
+ 6a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6a7:	90                   	nop
+ 6a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6b0:	83 f8 25             	cmp    $0x25,%eax
+ 6b3:	74 18                	je     6cd <printf+0x4d>
+  write(fd, &c, 1);
+ 6b5:	83 ec 04             	sub    $0x4,%esp
+ 6b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6be:	6a 01                	push   $0x1
+ 6c0:	50                   	push   %eax
+ 6c1:	57                   	push   %edi
+ 6c2:	e8 dc fd ff ff       	call   4a3 <write>
+ 6c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d0:	83 c6 01             	add    $0x1,%esi
+ 6d3:	84 db                	test   %bl,%bl
+ 6d5:	74 29                	je     700 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6da:	85 d2                	test   %edx,%edx
+ 6dc:	74 ca                	je     6a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6de:	83 fa 25             	cmp    $0x25,%edx
+ 6e1:	75 ea                	jne    6cd <printf+0x4d>
+      if(c == 'd'){
+ 6e3:	83 f8 25             	cmp    $0x25,%eax
+ 6e6:	0f 84 24 01 00 00    	je     810 <printf+0x190>
+ 6ec:	83 e8 63             	sub    $0x63,%eax
+ 6ef:	83 f8 15             	cmp    $0x15,%eax
+ 6f2:	77 1c                	ja     710 <printf+0x90>
+ 6f4:	ff 24 85 44 0c 00 00 	jmp    *0xc44(,%eax,4)
+ 6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 700:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 703:	5b                   	pop    %ebx
+ 704:	5e                   	pop    %esi
+ 705:	5f                   	pop    %edi
+ 706:	5d                   	pop    %ebp
+ 707:	c3                   	ret
+ 708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 716:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 71a:	6a 01                	push   $0x1
+ 71c:	52                   	push   %edx
+ 71d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 720:	57                   	push   %edi
+ 721:	e8 7d fd ff ff       	call   4a3 <write>
+ 726:	83 c4 0c             	add    $0xc,%esp
+ 729:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 72c:	6a 01                	push   $0x1
+ 72e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 731:	52                   	push   %edx
+ 732:	57                   	push   %edi
+ 733:	e8 6b fd ff ff       	call   4a3 <write>
+        putc(fd, c);
+ 738:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73b:	31 d2                	xor    %edx,%edx
+ 73d:	eb 8e                	jmp    6cd <printf+0x4d>
+ 73f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 00                	push   $0x0
+ 74f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 751:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 754:	e8 87 fe ff ff       	call   5e0 <printint>
+        ap++;
+ 759:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 75c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 67 ff ff ff       	jmp    6cd <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 770:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 773:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 775:	83 c0 04             	add    $0x4,%eax
+ 778:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 77b:	85 db                	test   %ebx,%ebx
+ 77d:	0f 84 9d 00 00 00    	je     820 <printf+0x1a0>
+        while(*s != 0){
+ 783:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 786:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 788:	84 c0                	test   %al,%al
+ 78a:	0f 84 3d ff ff ff    	je     6cd <printf+0x4d>
+ 790:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 793:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 796:	89 de                	mov    %ebx,%esi
+ 798:	89 d3                	mov    %edx,%ebx
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	53                   	push   %ebx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 f1 fc ff ff       	call   4a3 <write>
+        while(*s != 0){
+ 7b2:	0f b6 06             	movzbl (%esi),%eax
+ 7b5:	83 c4 10             	add    $0x10,%esp
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	75 e4                	jne    7a0 <printf+0x120>
+      state = 0;
+ 7bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 07 ff ff ff       	jmp    6cd <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 01                	push   $0x1
+ 7df:	e9 6b ff ff ff       	jmp    74f <printf+0xcf>
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	52                   	push   %edx
+ 7fc:	57                   	push   %edi
+ 7fd:	e8 a1 fc ff ff       	call   4a3 <write>
+        ap++;
+ 802:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 805:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 808:	31 d2                	xor    %edx,%edx
+ 80a:	e9 be fe ff ff       	jmp    6cd <printf+0x4d>
+ 80f:	90                   	nop
+  write(fd, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 816:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 819:	6a 01                	push   $0x1
+ 81b:	e9 11 ff ff ff       	jmp    731 <printf+0xb1>
+ 820:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 825:	bb 3a 0c 00 00       	mov    $0xc3a,%ebx
+ 82a:	e9 61 ff ff ff       	jmp    790 <printf+0x110>
+ 82f:	90                   	nop
+
+00000830 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 833:	a1 84 16 00 00       	mov    0x1684,%eax
+{
+ 838:	89 e5                	mov    %esp,%ebp
+ 83a:	56                   	push   %esi
+ 83b:	53                   	push   %ebx
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 840:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 842:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 844:	39 ca                	cmp    %ecx,%edx
+ 846:	73 30                	jae    878 <lfree+0x48>
+ 848:	39 c1                	cmp    %eax,%ecx
+ 84a:	72 04                	jb     850 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 84c:	39 c2                	cmp    %eax,%edx
+ 84e:	72 f0                	jb     840 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 850:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 853:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 856:	39 f0                	cmp    %esi,%eax
+ 858:	74 26                	je     880 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 85a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 85c:	8b 42 04             	mov    0x4(%edx),%eax
+ 85f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 862:	39 d9                	cmp    %ebx,%ecx
+ 864:	74 30                	je     896 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 866:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 868:	5b                   	pop    %ebx
+  freep = p;
+ 869:	89 15 84 16 00 00    	mov    %edx,0x1684
+}
+ 86f:	5e                   	pop    %esi
+ 870:	5d                   	pop    %ebp
+ 871:	c3                   	ret
+ 872:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 878:	39 c1                	cmp    %eax,%ecx
+ 87a:	72 d0                	jb     84c <lfree+0x1c>
+ 87c:	eb c2                	jmp    840 <lfree+0x10>
+ 87e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 880:	03 58 04             	add    0x4(%eax),%ebx
+ 883:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 886:	8b 02                	mov    (%edx),%eax
+ 888:	8b 00                	mov    (%eax),%eax
+ 88a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 88c:	8b 42 04             	mov    0x4(%edx),%eax
+ 88f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 892:	39 d9                	cmp    %ebx,%ecx
+ 894:	75 d0                	jne    866 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 896:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 899:	89 15 84 16 00 00    	mov    %edx,0x1684
+    p->s.size += bp->s.size;
+ 89f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8a2:	8b 09                	mov    (%ecx),%ecx
+ 8a4:	89 0a                	mov    %ecx,(%edx)
+}
+ 8a6:	5b                   	pop    %ebx
+ 8a7:	5e                   	pop    %esi
+ 8a8:	5d                   	pop    %ebp
+ 8a9:	c3                   	ret
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008b0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	89 c7                	mov    %eax,%edi
+ 8b6:	56                   	push   %esi
+ 8b7:	53                   	push   %ebx
+ 8b8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 8bb:	a1 84 16 00 00       	mov    0x1684,%eax
+ 8c0:	85 c0                	test   %eax,%eax
+ 8c2:	0f 84 88 00 00 00    	je     950 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 8ca:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 8cd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8d2:	39 df                	cmp    %ebx,%edi
+ 8d4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8d7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 8de:	39 f9                	cmp    %edi,%ecx
+ 8e0:	72 0f                	jb     8f1 <lalloc+0x41>
+ 8e2:	eb 4c                	jmp    930 <lalloc+0x80>
+ 8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 8ea:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 8ed:	39 f9                	cmp    %edi,%ecx
+ 8ef:	73 3f                	jae    930 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 8f1:	89 d0                	mov    %edx,%eax
+ 8f3:	39 15 84 16 00 00    	cmp    %edx,0x1684
+ 8f9:	75 ed                	jne    8e8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 8fb:	83 ec 0c             	sub    $0xc,%esp
+ 8fe:	56                   	push   %esi
+ 8ff:	e8 07 fc ff ff       	call   50b <sbrk>
+  if(p == (char*)-1)
+ 904:	83 c4 10             	add    $0x10,%esp
+ 907:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 90a:	74 11                	je     91d <lalloc+0x6d>
+  hp->s.size = nu;
+ 90c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 90f:	e8 1c ff ff ff       	call   830 <lfree>
+  return freep;
+ 914:	a1 84 16 00 00       	mov    0x1684,%eax
+      if((p = morecore(nunits)) == 0)
+ 919:	85 c0                	test   %eax,%eax
+ 91b:	75 cb                	jne    8e8 <lalloc+0x38>
+        return 0;
+  }
+}
+ 91d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 920:	31 d2                	xor    %edx,%edx
+}
+ 922:	5b                   	pop    %ebx
+ 923:	89 d0                	mov    %edx,%eax
+ 925:	5e                   	pop    %esi
+ 926:	5f                   	pop    %edi
+ 927:	5d                   	pop    %ebp
+ 928:	c3                   	ret
+ 929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 930:	39 cf                	cmp    %ecx,%edi
+ 932:	74 4c                	je     980 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 934:	29 f9                	sub    %edi,%ecx
+ 936:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 939:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 93c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 93f:	a3 84 16 00 00       	mov    %eax,0x1684
+}
+ 944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 947:	89 d0                	mov    %edx,%eax
+ 949:	5b                   	pop    %ebx
+ 94a:	5e                   	pop    %esi
+ 94b:	5f                   	pop    %edi
+ 94c:	5d                   	pop    %ebp
+ 94d:	c3                   	ret
+ 94e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 950:	ba 88 16 00 00       	mov    $0x1688,%edx
+ 955:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 957:	c7 05 84 16 00 00 88 	movl   $0x1688,0x1684
+ 95e:	16 00 00 
+ 961:	c7 05 88 16 00 00 88 	movl   $0x1688,0x1688
+ 968:	16 00 00 
+ 96b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 96d:	c7 05 8c 16 00 00 00 	movl   $0x0,0x168c
+ 974:	00 00 00 
+ 977:	e9 51 ff ff ff       	jmp    8cd <lalloc+0x1d>
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 980:	8b 0a                	mov    (%edx),%ecx
+ 982:	89 08                	mov    %ecx,(%eax)
+ 984:	eb b9                	jmp    93f <lalloc+0x8f>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000990 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 999:	85 f6                	test   %esi,%esi
+ 99b:	74 42                	je     9df <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 99d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 9a0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 9a3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 9a9:	77 3d                	ja     9e8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 9ab:	31 c9                	xor    %ecx,%ecx
+ 9ad:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 9b2:	83 fa 02             	cmp    $0x2,%edx
+ 9b5:	74 17                	je     9ce <free+0x3e>
+ 9b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9be:	66 90                	xchg   %ax,%ax
+ 9c0:	83 c1 01             	add    $0x1,%ecx
+ 9c3:	89 d8                	mov    %ebx,%eax
+ 9c5:	d3 e0                	shl    %cl,%eax
+ 9c7:	83 c0 01             	add    $0x1,%eax
+ 9ca:	39 c2                	cmp    %eax,%edx
+ 9cc:	75 f2                	jne    9c0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 9ce:	8b 04 8d 60 16 00 00 	mov    0x1660(,%ecx,4),%eax
+  classes[c] = bp;
+ 9d5:	89 3c 8d 60 16 00 00 	mov    %edi,0x1660(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 9dc:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 9df:	5b                   	pop    %ebx
+ 9e0:	5e                   	pop    %esi
+ 9e1:	5f                   	pop    %edi
+ 9e2:	5d                   	pop    %ebp
+ 9e3:	c3                   	ret
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9e8:	5b                   	pop    %ebx
+    lfree(bp);
+ 9e9:	89 f8                	mov    %edi,%eax
+}
+ 9eb:	5e                   	pop    %esi
+ 9ec:	5f                   	pop    %edi
+ 9ed:	5d                   	pop    %ebp
+    lfree(bp);
+ 9ee:	e9 3d fe ff ff       	jmp    830 <lfree>
+ 9f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a00 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a09:	8b 45 08             	mov    0x8(%ebp),%eax
+ a0c:	83 c0 07             	add    $0x7,%eax
+ a0f:	c1 e8 03             	shr    $0x3,%eax
+ a12:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ a15:	3d 01 01 00 00       	cmp    $0x101,%eax
+ a1a:	77 44                	ja     a60 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ a1c:	31 c9                	xor    %ecx,%ecx
+ a1e:	ba 01 00 00 00       	mov    $0x1,%edx
+ a23:	bb 02 00 00 00       	mov    $0x2,%ebx
+ a28:	83 f8 02             	cmp    $0x2,%eax
+ a2b:	76 11                	jbe    a3e <malloc+0x3e>
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+ a30:	83 c1 01             	add    $0x1,%ecx
+ a33:	89 d3                	mov    %edx,%ebx
+ a35:	d3 e3                	shl    %cl,%ebx
+ a37:	83 c3 01             	add    $0x1,%ebx
+ a3a:	39 c3                	cmp    %eax,%ebx
+ a3c:	72 f2                	jb     a30 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ a3e:	8b 04 8d 60 16 00 00 	mov    0x1660(,%ecx,4),%eax
+ a45:	85 c0                	test   %eax,%eax
+ a47:	74 2f                	je     a78 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ a49:	8b 10                	mov    (%eax),%edx
+ a4b:	89 14 8d 60 16 00 00 	mov    %edx,0x1660(,%ecx,4)
+  return (void*)(p + 1);
+ a52:	83 c0 08             	add    $0x8,%eax
+}
+ a55:	83 c4 1c             	add    $0x1c,%esp
+ a58:	5b                   	pop    %ebx
+ a59:	5e                   	pop    %esi
+ a5a:	5f                   	pop    %edi
+ a5b:	5d                   	pop    %ebp
+ a5c:	c3                   	ret
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ a60:	e8 4b fe ff ff       	call   8b0 <lalloc>
+ a65:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ a67:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ a6a:	85 d2                	test   %edx,%edx
+ a6c:	75 e7                	jne    a55 <malloc+0x55>
+      return 0;
+ a6e:	31 c0                	xor    %eax,%eax
+ a70:	eb e3                	jmp    a55 <malloc+0x55>
+ a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ a78:	31 d2                	xor    %edx,%edx
+ a7a:	b8 00 02 00 00       	mov    $0x200,%eax
+ a7f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a82:	f7 f3                	div    %ebx
+  if(n < 4)
+ a84:	ba 04 00 00 00       	mov    $0x4,%edx
+ a89:	89 d6                	mov    %edx,%esi
+ a8b:	39 d0                	cmp    %edx,%eax
+ a8d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ a90:	0f af f3             	imul   %ebx,%esi
+ a93:	89 f0                	mov    %esi,%eax
+ a95:	e8 16 fe ff ff       	call   8b0 <lalloc>
+ a9a:	85 c0                	test   %eax,%eax
+ a9c:	74 d0                	je     a6e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ a9e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ aa1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ aa4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ aab:	8b 14 8d 60 16 00 00 	mov    0x1660(,%ecx,4),%edx
+ ab2:	39 f8                	cmp    %edi,%eax
+ ab4:	73 22                	jae    ad8 <malloc+0xd8>
+ ab6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ ab9:	eb 09                	jmp    ac4 <malloc+0xc4>
+ abb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+ ac0:	89 c2                	mov    %eax,%edx
+ ac2:	89 c8                	mov    %ecx,%eax
+ ac4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ ac7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ aca:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ acc:	39 f9                	cmp    %edi,%ecx
+ ace:	72 f0                	jb     ac0 <malloc+0xc0>
+ ad0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ ad3:	e9 73 ff ff ff       	jmp    a4b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ ad8:	89 d0                	mov    %edx,%eax
+ ada:	8b 12                	mov    (%edx),%edx
+ adc:	e9 6a ff ff ff       	jmp    a4b <malloc+0x4b>
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+
+00000af0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	56                   	push   %esi
+ af4:	53                   	push   %ebx
+ af5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ af8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ afb:	85 c9                	test   %ecx,%ecx
+ afd:	74 06                	je     b05 <calloc+0x15>
+ aff:	89 c8                	mov    %ecx,%eax
+ b01:	f7 e3                	mul    %ebx
+ b03:	70 33                	jo     b38 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ b05:	0f af d9             	imul   %ecx,%ebx
+ b08:	83 ec 0c             	sub    $0xc,%esp
+ b0b:	53                   	push   %ebx
+ b0c:	e8 ef fe ff ff       	call   a00 <malloc>
+ b11:	83 c4 10             	add    $0x10,%esp
+ b14:	89 c6                	mov    %eax,%esi
+ b16:	85 c0                	test   %eax,%eax
+ b18:	74 1e                	je     b38 <calloc+0x48>
+    memset(p, 0, n * size);
+ b1a:	83 ec 04             	sub    $0x4,%esp
+ b1d:	53                   	push   %ebx
+ b1e:	6a 00                	push   $0x0
+ b20:	50                   	push   %eax
+ b21:	e8 3a f7 ff ff       	call   260 <memset>
+ b26:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ b29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b2c:	89 f0                	mov    %esi,%eax
+ b2e:	5b                   	pop    %ebx
+ b2f:	5e                   	pop    %esi
+ b30:	5d                   	pop    %ebp
+ b31:	c3                   	ret
+ b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ b3b:	31 f6                	xor    %esi,%esi
+}
+ b3d:	89 f0                	mov    %esi,%eax
+ b3f:	5b                   	pop    %ebx
+ b40:	5e                   	pop    %esi
+ b41:	5d                   	pop    %ebp
+ b42:	c3                   	ret
+ b43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b50 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	57                   	push   %edi
+ b54:	56                   	push   %esi
+ b55:	53                   	push   %ebx
+ b56:	83 ec 0c             	sub    $0xc,%esp
+ b59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ b5f:	85 db                	test   %ebx,%ebx
+ b61:	74 55                	je     bb8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ b63:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ b66:	89 de                	mov    %ebx,%esi
+ b68:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ b6f:	39 c7                	cmp    %eax,%edi
+ b71:	72 0d                	jb     b80 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ b73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b76:	89 f0                	mov    %esi,%eax
+ b78:	5b                   	pop    %ebx
+ b79:	5e                   	pop    %esi
+ b7a:	5f                   	pop    %edi
+ b7b:	5d                   	pop    %ebp
+ b7c:	c3                   	ret
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ b80:	83 ec 0c             	sub    $0xc,%esp
+ b83:	50                   	push   %eax
+ b84:	e8 77 fe ff ff       	call   a00 <malloc>
+ b89:	83 c4 10             	add    $0x10,%esp
+ b8c:	89 c6                	mov    %eax,%esi
+ b8e:	85 c0                	test   %eax,%eax
+ b90:	74 e1                	je     b73 <realloc+0x23>
+  memmove(p, ap, have);
+ b92:	83 ec 04             	sub    $0x4,%esp
+ b95:	57                   	push   %edi
+ b96:	53                   	push   %ebx
+ b97:	50                   	push   %eax
+ b98:	e8 b3 f8 ff ff       	call   450 <memmove>
+  free(ap);
+ b9d:	89 1c 24             	mov    %ebx,(%esp)
+ ba0:	e8 eb fd ff ff       	call   990 <free>
+  return p;
+ ba5:	83 c4 10             	add    $0x10,%esp
+}
+ ba8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bab:	89 f0                	mov    %esi,%eax
+ bad:	5b                   	pop    %ebx
+ bae:	5e                   	pop    %esi
+ baf:	5f                   	pop    %edi
+ bb0:	5d                   	pop    %ebp
+ bb1:	c3                   	ret
+ bb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ bb8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bbe:	5b                   	pop    %ebx
+ bbf:	5e                   	pop    %esi
+ bc0:	5f                   	pop    %edi
+ bc1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ bc2:	e9 39 fe ff ff       	jmp    a00 <malloc>
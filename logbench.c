@@ -0,0 +1,65 @@
+// Measure log commit latency.  NWRITER processes (the argument
+// overrides) write files at the same time, so that their system
+// calls share transactions and commits carry as many blocks as
+// the log allows.  Prints the commits' average size and time.
+
+#include "types.h"
+#include "user.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+#define NWRITER 3
+#define MAXW    8
+#define FSIZE   (32*1024)
+#define CHUNK   1536    // what filewrite() puts in one transaction
+
+char buf[CHUNK];
+
+static void
+writer(int i)
+{
+  char name[16];
+  int fd, n;
+
+  strcpy(name, "logbench.0");
+  name[9] = '0' + i;
+  if((fd = open(name, O_CREATE|O_WRONLY)) < 0){
+    printf(2, "logbench: cannot create %s\n", name);
+    exit();
+  }
+  for(n = 0; n < FSIZE; n += CHUNK)
+    write(fd, buf, CHUNK);
+  close(fd);
+  unlink(name);
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat a, b;
+  int i, n, t;
+  uint c;
+
+  n = argc > 1 ? atoi(argv[1]) : NWRITER;
+  if(n < 1 || n > MAXW)
+    n = NWRITER;
+  iostat(&a);
+  t = uptime();
+  for(i = 0; i < n; i++)
+    if(fork() == 0)
+      writer(i);
+  for(i = 0; i < n; i++)
+    wait();
+  t = uptime() - t;
+  iostat(&b);
+
+  c = b.ncommit - a.ncommit;
+  printf(1, "%d writers, %d ms: %d commits", n, t, c);
+  if(c > 0)
+    printf(1, " of %d blocks avg, %d Kcycles avg, %d max",
+           (b.commitblocks - a.commitblocks) / c,
+           (b.commitlat - a.commitlat) / c, b.commitmax);
+  printf(1, "\n");
+  exit();
+}
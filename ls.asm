@@ -0,0 +1,2210 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+}
+#endif
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	bb 01 00 00 00       	mov    $0x1,%ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 08             	sub    $0x8,%esp
+      19:	8b 31                	mov    (%ecx),%esi
+      1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+      1e:	83 fe 01             	cmp    $0x1,%esi
+      21:	7e 1f                	jle    42 <main+0x42>
+      23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+      28:	83 ec 0c             	sub    $0xc,%esp
+      2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+      2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+      31:	e8 aa 03 00 00       	call   3e0 <ls>
+  for(i=1; i<argc; i++)
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	39 de                	cmp    %ebx,%esi
+      3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+      3d:	e8 21 09 00 00       	call   963 <exit>
+    ls(".");
+      42:	83 ec 0c             	sub    $0xc,%esp
+      45:	68 04 11 00 00       	push   $0x1104
+      4a:	e8 91 03 00 00       	call   3e0 <ls>
+    exit();
+      4f:	e8 0f 09 00 00       	call   963 <exit>
+      54:	66 90                	xchg   %ax,%ax
+      56:	66 90                	xchg   %ax,%ax
+      58:	66 90                	xchg   %ax,%ax
+      5a:	66 90                	xchg   %ax,%ax
+      5c:	66 90                	xchg   %ax,%ax
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <print_mode>:
+#include "print_mode.c"
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	53                   	push   %ebx
+      64:	83 ec 04             	sub    $0x4,%esp
+      67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+
+      6a:	0f b7 03             	movzwl (%ebx),%eax
+      6d:	66 83 f8 02          	cmp    $0x2,%ax
+      71:	0f 84 a9 02 00 00    	je     320 <print_mode+0x2c0>
+      77:	66 83 f8 03          	cmp    $0x3,%ax
+      7b:	0f 84 7f 02 00 00    	je     300 <print_mode+0x2a0>
+      81:	66 83 f8 01          	cmp    $0x1,%ax
+      85:	0f 84 55 02 00 00    	je     2e0 <print_mode+0x280>
+{
+      8b:	83 ec 08             	sub    $0x8,%esp
+      8e:	68 ae 10 00 00       	push   $0x10ae
+      93:	6a 01                	push   $0x1
+      95:	e8 c6 0a 00 00       	call   b60 <printf>
+      9a:	83 c4 10             	add    $0x10,%esp
+
+      9d:	f6 43 19 01          	testb  $0x1,0x19(%ebx)
+      a1:	0f 84 19 01 00 00    	je     1c0 <print_mode+0x160>
+  // Find first character after last slash.
+      a7:	83 ec 08             	sub    $0x8,%esp
+      aa:	68 b0 10 00 00       	push   $0x10b0
+      af:	6a 01                	push   $0x1
+      b1:	e8 aa 0a 00 00       	call   b60 <printf>
+      b6:	83 c4 10             	add    $0x10,%esp
+
+      b9:	80 7b 18 00          	cmpb   $0x0,0x18(%ebx)
+      bd:	0f 88 19 01 00 00    	js     1dc <print_mode+0x17c>
+    return p;
+      c3:	83 ec 08             	sub    $0x8,%esp
+      c6:	68 aa 10 00 00       	push   $0x10aa
+      cb:	6a 01                	push   $0x1
+      cd:	e8 8e 0a 00 00       	call   b60 <printf>
+      d2:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      d5:	0f b6 53 18          	movzbl 0x18(%ebx),%edx
+      d9:	0f b6 43 19          	movzbl 0x19(%ebx),%eax
+      dd:	89 d1                	mov    %edx,%ecx
+      df:	d0 e8                	shr    %al
+      e1:	c0 e9 06             	shr    $0x6,%cl
+      e4:	83 e0 01             	and    $0x1,%eax
+      e7:	84 c1                	test   %al,%cl
+      e9:	0f 85 d1 01 00 00    	jne    2c0 <print_mode+0x260>
+}
+      ef:	83 e2 40             	and    $0x40,%edx
+      f2:	0f 85 00 01 00 00    	jne    1f8 <print_mode+0x198>
+ls(char *path)
+      f8:	83 ec 08             	sub    $0x8,%esp
+      fb:	68 aa 10 00 00       	push   $0x10aa
+     100:	6a 01                	push   $0x1
+     102:	e8 59 0a 00 00       	call   b60 <printf>
+     107:	83 c4 10             	add    $0x10,%esp
+  char buf[512], *p;
+     10a:	f6 43 18 20          	testb  $0x20,0x18(%ebx)
+     10e:	0f 84 00 01 00 00    	je     214 <print_mode+0x1b4>
+  int fd;
+     114:	83 ec 08             	sub    $0x8,%esp
+     117:	68 b0 10 00 00       	push   $0x10b0
+     11c:	6a 01                	push   $0x1
+     11e:	e8 3d 0a 00 00       	call   b60 <printf>
+     123:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(path, 0)) < 0){
+     126:	f6 43 18 10          	testb  $0x10,0x18(%ebx)
+     12a:	0f 84 00 01 00 00    	je     230 <print_mode+0x1d0>
+    printf(2, "ls: cannot open %s\n", path);
+     130:	83 ec 08             	sub    $0x8,%esp
+     133:	68 b2 10 00 00       	push   $0x10b2
+     138:	6a 01                	push   $0x1
+     13a:	e8 21 0a 00 00       	call   b60 <printf>
+     13f:	83 c4 10             	add    $0x10,%esp
+  if(fstat(fd, &st) < 0){
+     142:	f6 43 18 08          	testb  $0x8,0x18(%ebx)
+     146:	0f 84 00 01 00 00    	je     24c <print_mode+0x1ec>
+    printf(2, "ls: cannot stat %s\n", path);
+     14c:	83 ec 08             	sub    $0x8,%esp
+     14f:	68 b6 10 00 00       	push   $0x10b6
+     154:	6a 01                	push   $0x1
+     156:	e8 05 0a 00 00       	call   b60 <printf>
+     15b:	83 c4 10             	add    $0x10,%esp
+#ifdef CS333_P5
+     15e:	f6 43 18 04          	testb  $0x4,0x18(%ebx)
+     162:	0f 84 00 01 00 00    	je     268 <print_mode+0x208>
+  printf(1, "mode\t\tname\t\tuid\tgid\tinode\tsize\n");
+     168:	83 ec 08             	sub    $0x8,%esp
+     16b:	68 b0 10 00 00       	push   $0x10b0
+     170:	6a 01                	push   $0x1
+     172:	e8 e9 09 00 00       	call   b60 <printf>
+     177:	83 c4 10             	add    $0x10,%esp
+    print_mode(&st);
+     17a:	f6 43 18 02          	testb  $0x2,0x18(%ebx)
+     17e:	0f 84 00 01 00 00    	je     284 <print_mode+0x224>
+    printf(1, "\t%s\t%d\t%d\t%d\t%d\n", fmtname(path), st.uid, st.gid, st.ino, st.size);
+     184:	83 ec 08             	sub    $0x8,%esp
+     187:	68 b2 10 00 00       	push   $0x10b2
+     18c:	6a 01                	push   $0x1
+     18e:	e8 cd 09 00 00       	call   b60 <printf>
+     193:	83 c4 10             	add    $0x10,%esp
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     196:	f6 43 18 01          	testb  $0x1,0x18(%ebx)
+     19a:	0f 84 00 01 00 00    	je     2a0 <print_mode+0x240>
+      printf(1, "ls: path too long\n");
+     1a0:	83 ec 08             	sub    $0x8,%esp
+     1a3:	68 b6 10 00 00       	push   $0x10b6
+     1a8:	6a 01                	push   $0x1
+     1aa:	e8 b1 09 00 00       	call   b60 <printf>
+    *p++ = '/';
+     1af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1b2:	83 c4 10             	add    $0x10,%esp
+     1b5:	c9                   	leave
+     1b6:	c3                   	ret
+     1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1be:	66 90                	xchg   %ax,%ax
+    ;
+     1c0:	83 ec 08             	sub    $0x8,%esp
+     1c3:	68 aa 10 00 00       	push   $0x10aa
+     1c8:	6a 01                	push   $0x1
+     1ca:	e8 91 09 00 00       	call   b60 <printf>
+     1cf:	83 c4 10             	add    $0x10,%esp
+
+     1d2:	80 7b 18 00          	cmpb   $0x0,0x18(%ebx)
+     1d6:	0f 89 e7 fe ff ff    	jns    c3 <print_mode+0x63>
+  // Return blank-padded name.
+     1dc:	83 ec 08             	sub    $0x8,%esp
+     1df:	68 b2 10 00 00       	push   $0x10b2
+     1e4:	6a 01                	push   $0x1
+     1e6:	e8 75 09 00 00       	call   b60 <printf>
+     1eb:	83 c4 10             	add    $0x10,%esp
+     1ee:	e9 e2 fe ff ff       	jmp    d5 <print_mode+0x75>
+     1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1f7:	90                   	nop
+
+     1f8:	83 ec 08             	sub    $0x8,%esp
+     1fb:	68 b6 10 00 00       	push   $0x10b6
+     200:	6a 01                	push   $0x1
+     202:	e8 59 09 00 00       	call   b60 <printf>
+     207:	83 c4 10             	add    $0x10,%esp
+  char buf[512], *p;
+     20a:	f6 43 18 20          	testb  $0x20,0x18(%ebx)
+     20e:	0f 85 00 ff ff ff    	jne    114 <print_mode+0xb4>
+  struct stat st;
+     214:	83 ec 08             	sub    $0x8,%esp
+     217:	68 aa 10 00 00       	push   $0x10aa
+     21c:	6a 01                	push   $0x1
+     21e:	e8 3d 09 00 00       	call   b60 <printf>
+     223:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(path, 0)) < 0){
+     226:	f6 43 18 10          	testb  $0x10,0x18(%ebx)
+     22a:	0f 85 00 ff ff ff    	jne    130 <print_mode+0xd0>
+  }
+     230:	83 ec 08             	sub    $0x8,%esp
+     233:	68 aa 10 00 00       	push   $0x10aa
+     238:	6a 01                	push   $0x1
+     23a:	e8 21 09 00 00       	call   b60 <printf>
+     23f:	83 c4 10             	add    $0x10,%esp
+  if(fstat(fd, &st) < 0){
+     242:	f6 43 18 08          	testb  $0x8,0x18(%ebx)
+     246:	0f 85 00 ff ff ff    	jne    14c <print_mode+0xec>
+    return;
+     24c:	83 ec 08             	sub    $0x8,%esp
+     24f:	68 aa 10 00 00       	push   $0x10aa
+     254:	6a 01                	push   $0x1
+     256:	e8 05 09 00 00       	call   b60 <printf>
+     25b:	83 c4 10             	add    $0x10,%esp
+#ifdef CS333_P5
+     25e:	f6 43 18 04          	testb  $0x4,0x18(%ebx)
+     262:	0f 85 00 ff ff ff    	jne    168 <print_mode+0x108>
+  case T_FILE:
+     268:	83 ec 08             	sub    $0x8,%esp
+     26b:	68 aa 10 00 00       	push   $0x10aa
+     270:	6a 01                	push   $0x1
+     272:	e8 e9 08 00 00       	call   b60 <printf>
+     277:	83 c4 10             	add    $0x10,%esp
+    print_mode(&st);
+     27a:	f6 43 18 02          	testb  $0x2,0x18(%ebx)
+     27e:	0f 85 00 ff ff ff    	jne    184 <print_mode+0x124>
+
+     284:	83 ec 08             	sub    $0x8,%esp
+     287:	68 aa 10 00 00       	push   $0x10aa
+     28c:	6a 01                	push   $0x1
+     28e:	e8 cd 08 00 00       	call   b60 <printf>
+     293:	83 c4 10             	add    $0x10,%esp
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     296:	f6 43 18 01          	testb  $0x1,0x18(%ebx)
+     29a:	0f 85 00 ff ff ff    	jne    1a0 <print_mode+0x140>
+    }
+     2a0:	83 ec 08             	sub    $0x8,%esp
+     2a3:	68 aa 10 00 00       	push   $0x10aa
+     2a8:	6a 01                	push   $0x1
+     2aa:	e8 b1 08 00 00       	call   b60 <printf>
+    *p++ = '/';
+     2af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    }
+     2b2:	83 c4 10             	add    $0x10,%esp
+    *p++ = '/';
+     2b5:	c9                   	leave
+     2b6:	c3                   	ret
+     2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2be:	66 90                	xchg   %ax,%ax
+  return buf;
+     2c0:	83 ec 08             	sub    $0x8,%esp
+     2c3:	68 b4 10 00 00       	push   $0x10b4
+     2c8:	6a 01                	push   $0x1
+     2ca:	e8 91 08 00 00       	call   b60 <printf>
+     2cf:	83 c4 10             	add    $0x10,%esp
+     2d2:	e9 33 fe ff ff       	jmp    10a <print_mode+0xaa>
+     2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2de:	66 90                	xchg   %ax,%ax
+
+     2e0:	83 ec 08             	sub    $0x8,%esp
+     2e3:	68 a8 10 00 00       	push   $0x10a8
+     2e8:	6a 01                	push   $0x1
+     2ea:	e8 71 08 00 00       	call   b60 <printf>
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	e9 a6 fd ff ff       	jmp    9d <print_mode+0x3d>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+fmtname(char *path)
+     300:	83 ec 08             	sub    $0x8,%esp
+     303:	68 ac 10 00 00       	push   $0x10ac
+     308:	6a 01                	push   $0x1
+     30a:	e8 51 08 00 00       	call   b60 <printf>
+     30f:	83 c4 10             	add    $0x10,%esp
+     312:	e9 86 fd ff ff       	jmp    9d <print_mode+0x3d>
+     317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31e:	66 90                	xchg   %ax,%ax
+char*
+     320:	83 ec 08             	sub    $0x8,%esp
+     323:	68 aa 10 00 00       	push   $0x10aa
+     328:	6a 01                	push   $0x1
+     32a:	e8 31 08 00 00       	call   b60 <printf>
+     32f:	83 c4 10             	add    $0x10,%esp
+     332:	e9 66 fd ff ff       	jmp    9d <print_mode+0x3d>
+     337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33e:	66 90                	xchg   %ax,%ax
+
+00000340 <fmtname>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	56                   	push   %esi
+     344:	53                   	push   %ebx
+     345:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+     348:	83 ec 0c             	sub    $0xc,%esp
+     34b:	56                   	push   %esi
+     34c:	e8 bf 03 00 00       	call   710 <strlen>
+     351:	83 c4 10             	add    $0x10,%esp
+     354:	01 f0                	add    %esi,%eax
+     356:	89 c3                	mov    %eax,%ebx
+     358:	73 0f                	jae    369 <fmtname+0x29>
+     35a:	eb 12                	jmp    36e <fmtname+0x2e>
+     35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     360:	8d 43 ff             	lea    -0x1(%ebx),%eax
+     363:	39 f0                	cmp    %esi,%eax
+     365:	72 0a                	jb     371 <fmtname+0x31>
+     367:	89 c3                	mov    %eax,%ebx
+     369:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+     36c:	75 f2                	jne    360 <fmtname+0x20>
+  p++;
+     36e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+     371:	83 ec 0c             	sub    $0xc,%esp
+     374:	53                   	push   %ebx
+     375:	e8 96 03 00 00       	call   710 <strlen>
+     37a:	83 c4 10             	add    $0x10,%esp
+     37d:	83 f8 0d             	cmp    $0xd,%eax
+     380:	77 4a                	ja     3cc <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+     382:	83 ec 0c             	sub    $0xc,%esp
+     385:	53                   	push   %ebx
+     386:	e8 85 03 00 00       	call   710 <strlen>
+     38b:	83 c4 0c             	add    $0xc,%esp
+     38e:	50                   	push   %eax
+     38f:	53                   	push   %ebx
+     390:	68 00 16 00 00       	push   $0x1600
+     395:	e8 96 05 00 00       	call   930 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+     39a:	89 1c 24             	mov    %ebx,(%esp)
+     39d:	e8 6e 03 00 00       	call   710 <strlen>
+     3a2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+     3a5:	bb 00 16 00 00       	mov    $0x1600,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+     3aa:	89 c6                	mov    %eax,%esi
+     3ac:	e8 5f 03 00 00       	call   710 <strlen>
+     3b1:	ba 0e 00 00 00       	mov    $0xe,%edx
+     3b6:	83 c4 0c             	add    $0xc,%esp
+     3b9:	29 f2                	sub    %esi,%edx
+     3bb:	05 00 16 00 00       	add    $0x1600,%eax
+     3c0:	52                   	push   %edx
+     3c1:	6a 20                	push   $0x20
+     3c3:	50                   	push   %eax
+     3c4:	e8 77 03 00 00       	call   740 <memset>
+  return buf;
+     3c9:	83 c4 10             	add    $0x10,%esp
+}
+     3cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3cf:	89 d8                	mov    %ebx,%eax
+     3d1:	5b                   	pop    %ebx
+     3d2:	5e                   	pop    %esi
+     3d3:	5d                   	pop    %ebp
+     3d4:	c3                   	ret
+     3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <ls>:
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	57                   	push   %edi
+     3e4:	56                   	push   %esi
+     3e5:	53                   	push   %ebx
+     3e6:	81 ec 64 02 00 00    	sub    $0x264,%esp
+     3ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((fd = open(path, 0)) < 0){
+     3ef:	6a 00                	push   $0x0
+     3f1:	53                   	push   %ebx
+     3f2:	e8 ac 05 00 00       	call   9a3 <open>
+     3f7:	83 c4 10             	add    $0x10,%esp
+     3fa:	85 c0                	test   %eax,%eax
+     3fc:	0f 88 c6 00 00 00    	js     4c8 <ls+0xe8>
+  if(fstat(fd, &st) < 0){
+     402:	83 ec 08             	sub    $0x8,%esp
+     405:	8d bd cc fd ff ff    	lea    -0x234(%ebp),%edi
+     40b:	89 c6                	mov    %eax,%esi
+     40d:	57                   	push   %edi
+     40e:	50                   	push   %eax
+     40f:	e8 a7 05 00 00       	call   9bb <fstat>
+     414:	83 c4 10             	add    $0x10,%esp
+     417:	85 c0                	test   %eax,%eax
+     419:	0f 88 f9 00 00 00    	js     518 <ls+0x138>
+  printf(1, "mode\t\tname\t\tuid\tgid\tinode\tsize\n");
+     41f:	83 ec 08             	sub    $0x8,%esp
+     422:	68 08 11 00 00       	push   $0x1108
+     427:	6a 01                	push   $0x1
+     429:	e8 32 07 00 00       	call   b60 <printf>
+  switch(st.type){
+     42e:	0f b7 85 cc fd ff ff 	movzwl -0x234(%ebp),%eax
+     435:	83 c4 10             	add    $0x10,%esp
+     438:	66 83 f8 01          	cmp    $0x1,%ax
+     43c:	0f 84 a6 00 00 00    	je     4e8 <ls+0x108>
+     442:	83 e8 02             	sub    $0x2,%eax
+     445:	66 83 f8 01          	cmp    $0x1,%ax
+     449:	77 65                	ja     4b0 <ls+0xd0>
+    print_mode(&st);
+     44b:	83 ec 0c             	sub    $0xc,%esp
+     44e:	57                   	push   %edi
+     44f:	e8 0c fc ff ff       	call   60 <print_mode>
+    printf(1, "\t%s\t%d\t%d\t%d\t%d\n", fmtname(path), st.uid, st.gid, st.ino, st.size);
+     454:	8b 8d dc fd ff ff    	mov    -0x224(%ebp),%ecx
+     45a:	8b 95 d4 fd ff ff    	mov    -0x22c(%ebp),%edx
+     460:	0f b7 85 e0 fd ff ff 	movzwl -0x220(%ebp),%eax
+     467:	0f b7 bd e2 fd ff ff 	movzwl -0x21e(%ebp),%edi
+     46e:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+     474:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+     47a:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+     480:	89 1c 24             	mov    %ebx,(%esp)
+     483:	e8 b8 fe ff ff       	call   340 <fmtname>
+     488:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+     48e:	83 c4 0c             	add    $0xc,%esp
+     491:	51                   	push   %ecx
+     492:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+     498:	52                   	push   %edx
+     499:	57                   	push   %edi
+     49a:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     4a0:	50                   	push   %eax
+     4a1:	68 e0 10 00 00       	push   $0x10e0
+     4a6:	6a 01                	push   $0x1
+     4a8:	e8 b3 06 00 00       	call   b60 <printf>
+    break;
+     4ad:	83 c4 20             	add    $0x20,%esp
+  close(fd);
+     4b0:	83 ec 0c             	sub    $0xc,%esp
+     4b3:	56                   	push   %esi
+     4b4:	e8 d2 04 00 00       	call   98b <close>
+     4b9:	83 c4 10             	add    $0x10,%esp
+}
+     4bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4bf:	5b                   	pop    %ebx
+     4c0:	5e                   	pop    %esi
+     4c1:	5f                   	pop    %edi
+     4c2:	5d                   	pop    %ebp
+     4c3:	c3                   	ret
+     4c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(2, "ls: cannot open %s\n", path);
+     4c8:	83 ec 04             	sub    $0x4,%esp
+     4cb:	53                   	push   %ebx
+     4cc:	68 b8 10 00 00       	push   $0x10b8
+     4d1:	6a 02                	push   $0x2
+     4d3:	e8 88 06 00 00       	call   b60 <printf>
+    return;
+     4d8:	83 c4 10             	add    $0x10,%esp
+}
+     4db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4de:	5b                   	pop    %ebx
+     4df:	5e                   	pop    %esi
+     4e0:	5f                   	pop    %edi
+     4e1:	5d                   	pop    %ebp
+     4e2:	c3                   	ret
+     4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4e7:	90                   	nop
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     4e8:	83 ec 0c             	sub    $0xc,%esp
+     4eb:	53                   	push   %ebx
+     4ec:	e8 1f 02 00 00       	call   710 <strlen>
+     4f1:	83 c4 10             	add    $0x10,%esp
+     4f4:	83 c0 10             	add    $0x10,%eax
+     4f7:	3d 00 02 00 00       	cmp    $0x200,%eax
+     4fc:	76 42                	jbe    540 <ls+0x160>
+      printf(1, "ls: path too long\n");
+     4fe:	83 ec 08             	sub    $0x8,%esp
+     501:	68 f1 10 00 00       	push   $0x10f1
+     506:	6a 01                	push   $0x1
+     508:	e8 53 06 00 00       	call   b60 <printf>
+      break;
+     50d:	83 c4 10             	add    $0x10,%esp
+     510:	eb 9e                	jmp    4b0 <ls+0xd0>
+     512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot stat %s\n", path);
+     518:	83 ec 04             	sub    $0x4,%esp
+     51b:	53                   	push   %ebx
+     51c:	68 cc 10 00 00       	push   $0x10cc
+     521:	6a 02                	push   $0x2
+     523:	e8 38 06 00 00       	call   b60 <printf>
+    close(fd);
+     528:	89 34 24             	mov    %esi,(%esp)
+     52b:	e8 5b 04 00 00       	call   98b <close>
+    return;
+     530:	83 c4 10             	add    $0x10,%esp
+}
+     533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     536:	5b                   	pop    %ebx
+     537:	5e                   	pop    %esi
+     538:	5f                   	pop    %edi
+     539:	5d                   	pop    %ebp
+     53a:	c3                   	ret
+     53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     53f:	90                   	nop
+    strcpy(buf, path);
+     540:	83 ec 08             	sub    $0x8,%esp
+     543:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     549:	53                   	push   %ebx
+     54a:	8d 9d bc fd ff ff    	lea    -0x244(%ebp),%ebx
+     550:	50                   	push   %eax
+     551:	e8 2a 01 00 00       	call   680 <strcpy>
+    p = buf+strlen(buf);
+     556:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     55c:	89 04 24             	mov    %eax,(%esp)
+     55f:	e8 ac 01 00 00       	call   710 <strlen>
+     564:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     56a:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     56d:	01 d0                	add    %edx,%eax
+    *p++ = '/';
+     56f:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+     572:	89 85 a4 fd ff ff    	mov    %eax,-0x25c(%ebp)
+    *p++ = '/';
+     578:	89 8d a0 fd ff ff    	mov    %ecx,-0x260(%ebp)
+     57e:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     588:	83 ec 04             	sub    $0x4,%esp
+     58b:	6a 10                	push   $0x10
+     58d:	53                   	push   %ebx
+     58e:	56                   	push   %esi
+     58f:	e8 e7 03 00 00       	call   97b <read>
+     594:	83 c4 10             	add    $0x10,%esp
+     597:	83 f8 10             	cmp    $0x10,%eax
+     59a:	0f 85 10 ff ff ff    	jne    4b0 <ls+0xd0>
+      if(de.inum == 0)
+     5a0:	66 83 bd bc fd ff ff 	cmpw   $0x0,-0x244(%ebp)
+     5a7:	00 
+     5a8:	74 de                	je     588 <ls+0x1a8>
+      memmove(p, de.name, DIRSIZ);
+     5aa:	83 ec 04             	sub    $0x4,%esp
+     5ad:	8d 85 be fd ff ff    	lea    -0x242(%ebp),%eax
+     5b3:	6a 0e                	push   $0xe
+     5b5:	50                   	push   %eax
+     5b6:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+     5bc:	e8 6f 03 00 00       	call   930 <memmove>
+      p[DIRSIZ] = 0;
+     5c1:	8b 85 a4 fd ff ff    	mov    -0x25c(%ebp),%eax
+     5c7:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+     5cb:	58                   	pop    %eax
+     5cc:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     5d2:	5a                   	pop    %edx
+     5d3:	57                   	push   %edi
+     5d4:	50                   	push   %eax
+     5d5:	e8 26 02 00 00       	call   800 <stat>
+     5da:	83 c4 10             	add    $0x10,%esp
+     5dd:	85 c0                	test   %eax,%eax
+     5df:	78 7f                	js     660 <ls+0x280>
+      print_mode(&st);
+     5e1:	83 ec 0c             	sub    $0xc,%esp
+     5e4:	57                   	push   %edi
+     5e5:	e8 76 fa ff ff       	call   60 <print_mode>
+      printf(1, "\t%s\t%d\t%d\t%d\t%d\n", fmtname(buf), st.uid, st.gid, st.ino, st.size);
+     5ea:	8b 95 d4 fd ff ff    	mov    -0x22c(%ebp),%edx
+     5f0:	8b 8d dc fd ff ff    	mov    -0x224(%ebp),%ecx
+     5f6:	0f b7 85 e2 fd ff ff 	movzwl -0x21e(%ebp),%eax
+     5fd:	89 95 ac fd ff ff    	mov    %edx,-0x254(%ebp)
+     603:	0f b7 95 e0 fd ff ff 	movzwl -0x220(%ebp),%edx
+     60a:	89 8d a8 fd ff ff    	mov    %ecx,-0x258(%ebp)
+     610:	8d 8d e8 fd ff ff    	lea    -0x218(%ebp),%ecx
+     616:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+     61c:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+     622:	89 0c 24             	mov    %ecx,(%esp)
+     625:	e8 16 fd ff ff       	call   340 <fmtname>
+     62a:	8b 8d a8 fd ff ff    	mov    -0x258(%ebp),%ecx
+     630:	83 c4 0c             	add    $0xc,%esp
+     633:	51                   	push   %ecx
+     634:	8b 95 ac fd ff ff    	mov    -0x254(%ebp),%edx
+     63a:	52                   	push   %edx
+     63b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     641:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+     647:	50                   	push   %eax
+     648:	68 e0 10 00 00       	push   $0x10e0
+     64d:	6a 01                	push   $0x1
+     64f:	e8 0c 05 00 00       	call   b60 <printf>
+     654:	83 c4 20             	add    $0x20,%esp
+     657:	e9 2c ff ff ff       	jmp    588 <ls+0x1a8>
+     65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "ls: cannot stat %s\n", buf);
+     660:	83 ec 04             	sub    $0x4,%esp
+     663:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     669:	50                   	push   %eax
+     66a:	68 cc 10 00 00       	push   $0x10cc
+     66f:	6a 01                	push   $0x1
+     671:	e8 ea 04 00 00       	call   b60 <printf>
+        continue;
+     676:	83 c4 10             	add    $0x10,%esp
+     679:	e9 0a ff ff ff       	jmp    588 <ls+0x1a8>
+     67e:	66 90                	xchg   %ax,%ax
+
+00000680 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     680:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     681:	31 c0                	xor    %eax,%eax
+{
+     683:	89 e5                	mov    %esp,%ebp
+     685:	53                   	push   %ebx
+     686:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     689:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     690:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     694:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     697:	83 c0 01             	add    $0x1,%eax
+     69a:	84 d2                	test   %dl,%dl
+     69c:	75 f2                	jne    690 <strcpy+0x10>
+    ;
+  return os;
+}
+     69e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6a1:	89 c8                	mov    %ecx,%eax
+     6a3:	c9                   	leave
+     6a4:	c3                   	ret
+     6a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	53                   	push   %ebx
+     6b4:	8b 55 08             	mov    0x8(%ebp),%edx
+     6b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     6ba:	0f b6 02             	movzbl (%edx),%eax
+     6bd:	84 c0                	test   %al,%al
+     6bf:	75 17                	jne    6d8 <strcmp+0x28>
+     6c1:	eb 3a                	jmp    6fd <strcmp+0x4d>
+     6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6c7:	90                   	nop
+     6c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     6cc:	83 c2 01             	add    $0x1,%edx
+     6cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     6d2:	84 c0                	test   %al,%al
+     6d4:	74 1a                	je     6f0 <strcmp+0x40>
+    p++, q++;
+     6d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     6d8:	0f b6 19             	movzbl (%ecx),%ebx
+     6db:	38 c3                	cmp    %al,%bl
+     6dd:	74 e9                	je     6c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     6df:	29 d8                	sub    %ebx,%eax
+}
+     6e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6e4:	c9                   	leave
+     6e5:	c3                   	ret
+     6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     6f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     6f4:	31 c0                	xor    %eax,%eax
+     6f6:	29 d8                	sub    %ebx,%eax
+}
+     6f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6fb:	c9                   	leave
+     6fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     6fd:	0f b6 19             	movzbl (%ecx),%ebx
+     700:	31 c0                	xor    %eax,%eax
+     702:	eb db                	jmp    6df <strcmp+0x2f>
+     704:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     70f:	90                   	nop
+
+00000710 <strlen>:
+
+uint
+strlen(char *s)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     716:	80 3a 00             	cmpb   $0x0,(%edx)
+     719:	74 15                	je     730 <strlen+0x20>
+     71b:	31 c0                	xor    %eax,%eax
+     71d:	8d 76 00             	lea    0x0(%esi),%esi
+     720:	83 c0 01             	add    $0x1,%eax
+     723:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     727:	89 c1                	mov    %eax,%ecx
+     729:	75 f5                	jne    720 <strlen+0x10>
+    ;
+  return n;
+}
+     72b:	89 c8                	mov    %ecx,%eax
+     72d:	5d                   	pop    %ebp
+     72e:	c3                   	ret
+     72f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     730:	31 c9                	xor    %ecx,%ecx
+}
+     732:	5d                   	pop    %ebp
+     733:	89 c8                	mov    %ecx,%eax
+     735:	c3                   	ret
+     736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000740 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	57                   	push   %edi
+     744:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     747:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     74a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     74d:	89 d7                	mov    %edx,%edi
+     74f:	fc                   	cld
+     750:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     752:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     755:	89 d0                	mov    %edx,%eax
+     757:	c9                   	leave
+     758:	c3                   	ret
+     759:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	8b 45 08             	mov    0x8(%ebp),%eax
+     766:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     76a:	0f b6 10             	movzbl (%eax),%edx
+     76d:	84 d2                	test   %dl,%dl
+     76f:	75 12                	jne    783 <strchr+0x23>
+     771:	eb 1d                	jmp    790 <strchr+0x30>
+     773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     777:	90                   	nop
+     778:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     77c:	83 c0 01             	add    $0x1,%eax
+     77f:	84 d2                	test   %dl,%dl
+     781:	74 0d                	je     790 <strchr+0x30>
+    if(*s == c)
+     783:	38 d1                	cmp    %dl,%cl
+     785:	75 f1                	jne    778 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     787:	5d                   	pop    %ebp
+     788:	c3                   	ret
+     789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     790:	31 c0                	xor    %eax,%eax
+}
+     792:	5d                   	pop    %ebp
+     793:	c3                   	ret
+     794:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+
+000007a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     7a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     7a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     7a9:	31 db                	xor    %ebx,%ebx
+{
+     7ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     7ae:	eb 27                	jmp    7d7 <gets+0x37>
+    cc = read(0, &c, 1);
+     7b0:	83 ec 04             	sub    $0x4,%esp
+     7b3:	6a 01                	push   $0x1
+     7b5:	56                   	push   %esi
+     7b6:	6a 00                	push   $0x0
+     7b8:	e8 be 01 00 00       	call   97b <read>
+    if(cc < 1)
+     7bd:	83 c4 10             	add    $0x10,%esp
+     7c0:	85 c0                	test   %eax,%eax
+     7c2:	7e 1d                	jle    7e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     7c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     7c8:	8b 55 08             	mov    0x8(%ebp),%edx
+     7cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     7cf:	3c 0a                	cmp    $0xa,%al
+     7d1:	74 10                	je     7e3 <gets+0x43>
+     7d3:	3c 0d                	cmp    $0xd,%al
+     7d5:	74 0c                	je     7e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     7d7:	89 df                	mov    %ebx,%edi
+     7d9:	83 c3 01             	add    $0x1,%ebx
+     7dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     7df:	7c cf                	jl     7b0 <gets+0x10>
+     7e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     7e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     7ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7ed:	5b                   	pop    %ebx
+     7ee:	5e                   	pop    %esi
+     7ef:	5f                   	pop    %edi
+     7f0:	5d                   	pop    %ebp
+     7f1:	c3                   	ret
+     7f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000800 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	56                   	push   %esi
+     804:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     805:	83 ec 08             	sub    $0x8,%esp
+     808:	6a 00                	push   $0x0
+     80a:	ff 75 08             	push   0x8(%ebp)
+     80d:	e8 91 01 00 00       	call   9a3 <open>
+  if(fd < 0)
+     812:	83 c4 10             	add    $0x10,%esp
+     815:	85 c0                	test   %eax,%eax
+     817:	78 27                	js     840 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     819:	83 ec 08             	sub    $0x8,%esp
+     81c:	ff 75 0c             	push   0xc(%ebp)
+     81f:	89 c3                	mov    %eax,%ebx
+     821:	50                   	push   %eax
+     822:	e8 94 01 00 00       	call   9bb <fstat>
+  close(fd);
+     827:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     82a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     82c:	e8 5a 01 00 00       	call   98b <close>
+  return r;
+     831:	83 c4 10             	add    $0x10,%esp
+}
+     834:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     837:	89 f0                	mov    %esi,%eax
+     839:	5b                   	pop    %ebx
+     83a:	5e                   	pop    %esi
+     83b:	5d                   	pop    %ebp
+     83c:	c3                   	ret
+     83d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     840:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     845:	eb ed                	jmp    834 <stat+0x34>
+     847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84e:	66 90                	xchg   %ax,%ax
+
+00000850 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	56                   	push   %esi
+     854:	53                   	push   %ebx
+     855:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     858:	0f b6 02             	movzbl (%edx),%eax
+     85b:	3c 20                	cmp    $0x20,%al
+     85d:	75 0c                	jne    86b <atoi+0x1b>
+     85f:	90                   	nop
+     860:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+     864:	83 c2 01             	add    $0x1,%edx
+     867:	3c 20                	cmp    $0x20,%al
+     869:	74 f5                	je     860 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     86b:	3c 2d                	cmp    $0x2d,%al
+     86d:	74 41                	je     8b0 <atoi+0x60>
+     86f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     874:	3c 2b                	cmp    $0x2b,%al
+     876:	74 3d                	je     8b5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+     878:	0f be 0a             	movsbl (%edx),%ecx
+     87b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     87e:	3c 09                	cmp    $0x9,%al
+     880:	b8 00 00 00 00       	mov    $0x0,%eax
+     885:	77 21                	ja     8a8 <atoi+0x58>
+     887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     890:	83 c2 01             	add    $0x1,%edx
+     893:	8d 04 80             	lea    (%eax,%eax,4),%eax
+     896:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+     89a:	0f be 0a             	movsbl (%edx),%ecx
+     89d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     8a0:	80 fb 09             	cmp    $0x9,%bl
+     8a3:	76 eb                	jbe    890 <atoi+0x40>
+  return sign*n;
+     8a5:	0f af c6             	imul   %esi,%eax
+}
+     8a8:	5b                   	pop    %ebx
+     8a9:	5e                   	pop    %esi
+     8aa:	5d                   	pop    %ebp
+     8ab:	c3                   	ret
+     8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+     8b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     8b5:	83 c2 01             	add    $0x1,%edx
+     8b8:	eb be                	jmp    878 <atoi+0x28>
+     8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008c0 <atoo>:
+
+int
+atoo(const char *s)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	56                   	push   %esi
+     8c4:	53                   	push   %ebx
+     8c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     8c8:	0f b6 02             	movzbl (%edx),%eax
+     8cb:	3c 20                	cmp    $0x20,%al
+     8cd:	75 0c                	jne    8db <atoo+0x1b>
+     8cf:	90                   	nop
+     8d0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+     8d4:	83 c2 01             	add    $0x1,%edx
+     8d7:	3c 20                	cmp    $0x20,%al
+     8d9:	74 f5                	je     8d0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     8db:	3c 2d                	cmp    $0x2d,%al
+     8dd:	74 41                	je     920 <atoo+0x60>
+     8df:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     8e4:	3c 2b                	cmp    $0x2b,%al
+     8e6:	74 3d                	je     925 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+     8e8:	0f be 0a             	movsbl (%edx),%ecx
+     8eb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     8ee:	3c 07                	cmp    $0x7,%al
+     8f0:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f5:	77 1e                	ja     915 <atoo+0x55>
+     8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fe:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+     900:	83 c2 01             	add    $0x1,%edx
+     903:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+     907:	0f be 0a             	movsbl (%edx),%ecx
+     90a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     90d:	80 fb 07             	cmp    $0x7,%bl
+     910:	76 ee                	jbe    900 <atoo+0x40>
+  return sign*n;
+     912:	0f af c6             	imul   %esi,%eax
+}
+     915:	5b                   	pop    %ebx
+     916:	5e                   	pop    %esi
+     917:	5d                   	pop    %ebp
+     918:	c3                   	ret
+     919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+     920:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     925:	83 c2 01             	add    $0x1,%edx
+     928:	eb be                	jmp    8e8 <atoo+0x28>
+     92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000930 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	57                   	push   %edi
+     934:	56                   	push   %esi
+     935:	8b 45 10             	mov    0x10(%ebp),%eax
+     938:	8b 55 08             	mov    0x8(%ebp),%edx
+     93b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     93e:	85 c0                	test   %eax,%eax
+     940:	7e 13                	jle    955 <memmove+0x25>
+     942:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     944:	89 d7                	mov    %edx,%edi
+     946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     950:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     951:	39 f8                	cmp    %edi,%eax
+     953:	75 fb                	jne    950 <memmove+0x20>
+  return vdst;
+}
+     955:	5e                   	pop    %esi
+     956:	89 d0                	mov    %edx,%eax
+     958:	5f                   	pop    %edi
+     959:	5d                   	pop    %ebp
+     95a:	c3                   	ret
+
+0000095b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     95b:	b8 01 00 00 00       	mov    $0x1,%eax
+     960:	cd 40                	int    $0x40
+     962:	c3                   	ret
+
+00000963 <exit>:
+SYSCALL(exit)
+     963:	b8 02 00 00 00       	mov    $0x2,%eax
+     968:	cd 40                	int    $0x40
+     96a:	c3                   	ret
+
+0000096b <wait>:
+SYSCALL(wait)
+     96b:	b8 03 00 00 00       	mov    $0x3,%eax
+     970:	cd 40                	int    $0x40
+     972:	c3                   	ret
+
+00000973 <pipe>:
+SYSCALL(pipe)
+     973:	b8 04 00 00 00       	mov    $0x4,%eax
+     978:	cd 40                	int    $0x40
+     97a:	c3                   	ret
+
+0000097b <read>:
+SYSCALL(read)
+     97b:	b8 05 00 00 00       	mov    $0x5,%eax
+     980:	cd 40                	int    $0x40
+     982:	c3                   	ret
+
+00000983 <write>:
+SYSCALL(write)
+     983:	b8 10 00 00 00       	mov    $0x10,%eax
+     988:	cd 40                	int    $0x40
+     98a:	c3                   	ret
+
+0000098b <close>:
+SYSCALL(close)
+     98b:	b8 15 00 00 00       	mov    $0x15,%eax
+     990:	cd 40                	int    $0x40
+     992:	c3                   	ret
+
+00000993 <kill>:
+SYSCALL(kill)
+     993:	b8 06 00 00 00       	mov    $0x6,%eax
+     998:	cd 40                	int    $0x40
+     99a:	c3                   	ret
+
+0000099b <exec>:
+SYSCALL(exec)
+     99b:	b8 07 00 00 00       	mov    $0x7,%eax
+     9a0:	cd 40                	int    $0x40
+     9a2:	c3                   	ret
+
+000009a3 <open>:
+SYSCALL(open)
+     9a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+     9a8:	cd 40                	int    $0x40
+     9aa:	c3                   	ret
+
+000009ab <mknod>:
+SYSCALL(mknod)
+     9ab:	b8 11 00 00 00       	mov    $0x11,%eax
+     9b0:	cd 40                	int    $0x40
+     9b2:	c3                   	ret
+
+000009b3 <unlink>:
+SYSCALL(unlink)
+     9b3:	b8 12 00 00 00       	mov    $0x12,%eax
+     9b8:	cd 40                	int    $0x40
+     9ba:	c3                   	ret
+
+000009bb <fstat>:
+SYSCALL(fstat)
+     9bb:	b8 08 00 00 00       	mov    $0x8,%eax
+     9c0:	cd 40                	int    $0x40
+     9c2:	c3                   	ret
+
+000009c3 <link>:
+SYSCALL(link)
+     9c3:	b8 13 00 00 00       	mov    $0x13,%eax
+     9c8:	cd 40                	int    $0x40
+     9ca:	c3                   	ret
+
+000009cb <mkdir>:
+SYSCALL(mkdir)
+     9cb:	b8 14 00 00 00       	mov    $0x14,%eax
+     9d0:	cd 40                	int    $0x40
+     9d2:	c3                   	ret
+
+000009d3 <chdir>:
+SYSCALL(chdir)
+     9d3:	b8 09 00 00 00       	mov    $0x9,%eax
+     9d8:	cd 40                	int    $0x40
+     9da:	c3                   	ret
+
+000009db <dup>:
+SYSCALL(dup)
+     9db:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9e0:	cd 40                	int    $0x40
+     9e2:	c3                   	ret
+
+000009e3 <getpid>:
+SYSCALL(getpid)
+     9e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <sbrk>:
+SYSCALL(sbrk)
+     9eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <sleep>:
+SYSCALL(sleep)
+     9f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9f8:	cd 40                	int    $0x40
+     9fa:	c3                   	ret
+
+000009fb <uptime>:
+SYSCALL(uptime)
+     9fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a00:	cd 40                	int    $0x40
+     a02:	c3                   	ret
+
+00000a03 <superpages>:
+SYSCALL(superpages)
+     a03:	b8 23 00 00 00       	mov    $0x23,%eax
+     a08:	cd 40                	int    $0x40
+     a0a:	c3                   	ret
+
+00000a0b <mmap>:
+SYSCALL(mmap)
+     a0b:	b8 24 00 00 00       	mov    $0x24,%eax
+     a10:	cd 40                	int    $0x40
+     a12:	c3                   	ret
+
+00000a13 <munmap>:
+SYSCALL(munmap)
+     a13:	b8 25 00 00 00       	mov    $0x25,%eax
+     a18:	cd 40                	int    $0x40
+     a1a:	c3                   	ret
+
+00000a1b <spawn>:
+SYSCALL(spawn)
+     a1b:	b8 26 00 00 00       	mov    $0x26,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <swapstat>:
+SYSCALL(swapstat)
+     a23:	b8 27 00 00 00       	mov    $0x27,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <getmeminfo>:
+SYSCALL(getmeminfo)
+     a2b:	b8 28 00 00 00       	mov    $0x28,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <iostat>:
+SYSCALL(iostat)
+     a33:	b8 29 00 00 00       	mov    $0x29,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <dropcache>:
+SYSCALL(dropcache)
+     a3b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <iosched>:
+SYSCALL(iosched)
+     a43:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <halt>:
+SYSCALL(halt)
+     a4b:	b8 16 00 00 00       	mov    $0x16,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <date>:
+SYSCALL(date)
+     a53:	b8 17 00 00 00       	mov    $0x17,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+     a5b:	b8 18 00 00 00       	mov    $0x18,%eax
+     a60:	cd 40                	int    $0x40
+     a62:	c3                   	ret
+
+00000a63 <getgid>:
+SYSCALL(getgid)
+     a63:	b8 19 00 00 00       	mov    $0x19,%eax
+     a68:	cd 40                	int    $0x40
+     a6a:	c3                   	ret
+
+00000a6b <getppid>:
+SYSCALL(getppid)
+     a6b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a70:	cd 40                	int    $0x40
+     a72:	c3                   	ret
+
+00000a73 <setuid>:
+SYSCALL(setuid)
+     a73:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a78:	cd 40                	int    $0x40
+     a7a:	c3                   	ret
+
+00000a7b <setgid>:
+SYSCALL(setgid)
+     a7b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a80:	cd 40                	int    $0x40
+     a82:	c3                   	ret
+
+00000a83 <getprocs>:
+SYSCALL(getprocs)
+     a83:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a88:	cd 40                	int    $0x40
+     a8a:	c3                   	ret
+
+00000a8b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+     a8b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a90:	cd 40                	int    $0x40
+     a92:	c3                   	ret
+
+00000a93 <getpriority>:
+SYSCALL(getpriority)
+     a93:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a98:	cd 40                	int    $0x40
+     a9a:	c3                   	ret
+
+00000a9b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+     a9b:	b8 20 00 00 00       	mov    $0x20,%eax
+     aa0:	cd 40                	int    $0x40
+     aa2:	c3                   	ret
+
+00000aa3 <chown>:
+SYSCALL(chown)
+     aa3:	b8 21 00 00 00       	mov    $0x21,%eax
+     aa8:	cd 40                	int    $0x40
+     aaa:	c3                   	ret
+
+00000aab <chgrp>:
+SYSCALL(chgrp)
+     aab:	b8 22 00 00 00       	mov    $0x22,%eax
+     ab0:	cd 40                	int    $0x40
+     ab2:	c3                   	ret
+     ab3:	66 90                	xchg   %ax,%ax
+     ab5:	66 90                	xchg   %ax,%ax
+     ab7:	66 90                	xchg   %ax,%ax
+     ab9:	66 90                	xchg   %ax,%ax
+     abb:	66 90                	xchg   %ax,%ax
+     abd:	66 90                	xchg   %ax,%ax
+     abf:	90                   	nop
+
+00000ac0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	57                   	push   %edi
+     ac4:	56                   	push   %esi
+     ac5:	53                   	push   %ebx
+     ac6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     ac8:	89 d1                	mov    %edx,%ecx
+{
+     aca:	83 ec 3c             	sub    $0x3c,%esp
+     acd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     ad0:	85 d2                	test   %edx,%edx
+     ad2:	0f 89 80 00 00 00    	jns    b58 <printint+0x98>
+     ad8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     adc:	74 7a                	je     b58 <printint+0x98>
+    x = -xx;
+     ade:	f7 d9                	neg    %ecx
+    neg = 1;
+     ae0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ae5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ae8:	31 f6                	xor    %esi,%esi
+     aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     af0:	89 c8                	mov    %ecx,%eax
+     af2:	31 d2                	xor    %edx,%edx
+     af4:	89 f7                	mov    %esi,%edi
+     af6:	f7 f3                	div    %ebx
+     af8:	8d 76 01             	lea    0x1(%esi),%esi
+     afb:	0f b6 92 88 11 00 00 	movzbl 0x1188(%edx),%edx
+     b02:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b06:	89 ca                	mov    %ecx,%edx
+     b08:	89 c1                	mov    %eax,%ecx
+     b0a:	39 da                	cmp    %ebx,%edx
+     b0c:	73 e2                	jae    af0 <printint+0x30>
+  if(neg)
+     b0e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     b11:	85 c0                	test   %eax,%eax
+     b13:	74 07                	je     b1c <printint+0x5c>
+    buf[i++] = '-';
+     b15:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b1a:	89 f7                	mov    %esi,%edi
+     b1c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     b1f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b22:	01 df                	add    %ebx,%edi
+     b24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     b28:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     b2b:	83 ec 04             	sub    $0x4,%esp
+     b2e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     b31:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     b34:	6a 01                	push   $0x1
+     b36:	50                   	push   %eax
+     b37:	56                   	push   %esi
+     b38:	e8 46 fe ff ff       	call   983 <write>
+  while(--i >= 0)
+     b3d:	89 f8                	mov    %edi,%eax
+     b3f:	83 c4 10             	add    $0x10,%esp
+     b42:	83 ef 01             	sub    $0x1,%edi
+     b45:	39 d8                	cmp    %ebx,%eax
+     b47:	75 df                	jne    b28 <printint+0x68>
+}
+     b49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b4c:	5b                   	pop    %ebx
+     b4d:	5e                   	pop    %esi
+     b4e:	5f                   	pop    %edi
+     b4f:	5d                   	pop    %ebp
+     b50:	c3                   	ret
+     b51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     b58:	31 c0                	xor    %eax,%eax
+     b5a:	eb 89                	jmp    ae5 <printint+0x25>
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b60 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     b69:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     b6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     b6f:	0f b6 1e             	movzbl (%esi),%ebx
+     b72:	83 c6 01             	add    $0x1,%esi
+     b75:	84 db                	test   %bl,%bl
+     b77:	74 67                	je     be0 <printf+0x80>
+     b79:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     b7c:	31 d2                	xor    %edx,%edx
+     b7e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     b81:	eb 34                	jmp    bb7 <printf+0x57>
+     b83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b87:	90                   	nop
+     b88:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     b8b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     b90:	83 f8 25             	cmp    $0x25,%eax
+     b93:	74 18                	je     bad <printf+0x4d>
+  write(fd, &c, 1);
+     b95:	83 ec 04             	sub    $0x4,%esp
+     b98:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     b9b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     b9e:	6a 01                	push   $0x1
+     ba0:	50                   	push   %eax
+     ba1:	57                   	push   %edi
+     ba2:	e8 dc fd ff ff       	call   983 <write>
+     ba7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     baa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     bad:	0f b6 1e             	movzbl (%esi),%ebx
+     bb0:	83 c6 01             	add    $0x1,%esi
+     bb3:	84 db                	test   %bl,%bl
+     bb5:	74 29                	je     be0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     bb7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     bba:	85 d2                	test   %edx,%edx
+     bbc:	74 ca                	je     b88 <printf+0x28>
+      }
+    } else if(state == '%'){
+     bbe:	83 fa 25             	cmp    $0x25,%edx
+     bc1:	75 ea                	jne    bad <printf+0x4d>
+      if(c == 'd'){
+     bc3:	83 f8 25             	cmp    $0x25,%eax
+     bc6:	0f 84 24 01 00 00    	je     cf0 <printf+0x190>
+     bcc:	83 e8 63             	sub    $0x63,%eax
+     bcf:	83 f8 15             	cmp    $0x15,%eax
+     bd2:	77 1c                	ja     bf0 <printf+0x90>
+     bd4:	ff 24 85 30 11 00 00 	jmp    *0x1130(,%eax,4)
+     bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bdf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be3:	5b                   	pop    %ebx
+     be4:	5e                   	pop    %esi
+     be5:	5f                   	pop    %edi
+     be6:	5d                   	pop    %ebp
+     be7:	c3                   	ret
+     be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+  write(fd, &c, 1);
+     bf0:	83 ec 04             	sub    $0x4,%esp
+     bf3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     bf6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     bfa:	6a 01                	push   $0x1
+     bfc:	52                   	push   %edx
+     bfd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     c00:	57                   	push   %edi
+     c01:	e8 7d fd ff ff       	call   983 <write>
+     c06:	83 c4 0c             	add    $0xc,%esp
+     c09:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     c0c:	6a 01                	push   $0x1
+     c0e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     c11:	52                   	push   %edx
+     c12:	57                   	push   %edi
+     c13:	e8 6b fd ff ff       	call   983 <write>
+        putc(fd, c);
+     c18:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c1b:	31 d2                	xor    %edx,%edx
+     c1d:	eb 8e                	jmp    bad <printf+0x4d>
+     c1f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     c20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     c23:	83 ec 0c             	sub    $0xc,%esp
+     c26:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c2b:	8b 13                	mov    (%ebx),%edx
+     c2d:	6a 00                	push   $0x0
+     c2f:	89 f8                	mov    %edi,%eax
+        ap++;
+     c31:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     c34:	e8 87 fe ff ff       	call   ac0 <printint>
+        ap++;
+     c39:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     c3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c3f:	31 d2                	xor    %edx,%edx
+     c41:	e9 67 ff ff ff       	jmp    bad <printf+0x4d>
+     c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     c50:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     c53:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     c55:	83 c0 04             	add    $0x4,%eax
+     c58:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     c5b:	85 db                	test   %ebx,%ebx
+     c5d:	0f 84 9d 00 00 00    	je     d00 <printf+0x1a0>
+        while(*s != 0){
+     c63:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     c66:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     c68:	84 c0                	test   %al,%al
+     c6a:	0f 84 3d ff ff ff    	je     bad <printf+0x4d>
+     c70:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     c73:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     c76:	89 de                	mov    %ebx,%esi
+     c78:	89 d3                	mov    %edx,%ebx
+     c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     c80:	83 ec 04             	sub    $0x4,%esp
+     c83:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     c86:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     c89:	6a 01                	push   $0x1
+     c8b:	53                   	push   %ebx
+     c8c:	57                   	push   %edi
+     c8d:	e8 f1 fc ff ff       	call   983 <write>
+        while(*s != 0){
+     c92:	0f b6 06             	movzbl (%esi),%eax
+     c95:	83 c4 10             	add    $0x10,%esp
+     c98:	84 c0                	test   %al,%al
+     c9a:	75 e4                	jne    c80 <printf+0x120>
+      state = 0;
+     c9c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     c9f:	31 d2                	xor    %edx,%edx
+     ca1:	e9 07 ff ff ff       	jmp    bad <printf+0x4d>
+     ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     cb0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     cb3:	83 ec 0c             	sub    $0xc,%esp
+     cb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     cbb:	8b 13                	mov    (%ebx),%edx
+     cbd:	6a 01                	push   $0x1
+     cbf:	e9 6b ff ff ff       	jmp    c2f <printf+0xcf>
+     cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     cc8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     ccb:	83 ec 04             	sub    $0x4,%esp
+     cce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     cd1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     cd3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     cd6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     cd9:	6a 01                	push   $0x1
+     cdb:	52                   	push   %edx
+     cdc:	57                   	push   %edi
+     cdd:	e8 a1 fc ff ff       	call   983 <write>
+        ap++;
+     ce2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     ce5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ce8:	31 d2                	xor    %edx,%edx
+     cea:	e9 be fe ff ff       	jmp    bad <printf+0x4d>
+     cef:	90                   	nop
+  write(fd, &c, 1);
+     cf0:	83 ec 04             	sub    $0x4,%esp
+     cf3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     cf6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     cf9:	6a 01                	push   $0x1
+     cfb:	e9 11 ff ff ff       	jmp    c11 <printf+0xb1>
+     d00:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     d05:	bb 28 11 00 00       	mov    $0x1128,%ebx
+     d0a:	e9 61 ff ff ff       	jmp    c70 <printf+0x110>
+     d0f:	90                   	nop
+
+00000d10 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d13:	a1 44 16 00 00       	mov    0x1644,%eax
+{
+     d18:	89 e5                	mov    %esp,%ebp
+     d1a:	56                   	push   %esi
+     d1b:	53                   	push   %ebx
+     d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d20:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d22:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d24:	39 ca                	cmp    %ecx,%edx
+     d26:	73 30                	jae    d58 <lfree+0x48>
+     d28:	39 c1                	cmp    %eax,%ecx
+     d2a:	72 04                	jb     d30 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d2c:	39 c2                	cmp    %eax,%edx
+     d2e:	72 f0                	jb     d20 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     d30:	8b 59 04             	mov    0x4(%ecx),%ebx
+     d33:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+     d36:	39 f0                	cmp    %esi,%eax
+     d38:	74 26                	je     d60 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d3a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     d3c:	8b 42 04             	mov    0x4(%edx),%eax
+     d3f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     d42:	39 d9                	cmp    %ebx,%ecx
+     d44:	74 30                	je     d76 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     d46:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     d48:	5b                   	pop    %ebx
+  freep = p;
+     d49:	89 15 44 16 00 00    	mov    %edx,0x1644
+}
+     d4f:	5e                   	pop    %esi
+     d50:	5d                   	pop    %ebp
+     d51:	c3                   	ret
+     d52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d58:	39 c1                	cmp    %eax,%ecx
+     d5a:	72 d0                	jb     d2c <lfree+0x1c>
+     d5c:	eb c2                	jmp    d20 <lfree+0x10>
+     d5e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     d60:	03 58 04             	add    0x4(%eax),%ebx
+     d63:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d66:	8b 02                	mov    (%edx),%eax
+     d68:	8b 00                	mov    (%eax),%eax
+     d6a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+     d6c:	8b 42 04             	mov    0x4(%edx),%eax
+     d6f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+     d72:	39 d9                	cmp    %ebx,%ecx
+     d74:	75 d0                	jne    d46 <lfree+0x36>
+    p->s.size += bp->s.size;
+     d76:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+     d79:	89 15 44 16 00 00    	mov    %edx,0x1644
+    p->s.size += bp->s.size;
+     d7f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     d82:	8b 09                	mov    (%ecx),%ecx
+     d84:	89 0a                	mov    %ecx,(%edx)
+}
+     d86:	5b                   	pop    %ebx
+     d87:	5e                   	pop    %esi
+     d88:	5d                   	pop    %ebp
+     d89:	c3                   	ret
+     d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d90 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	57                   	push   %edi
+     d94:	89 c7                	mov    %eax,%edi
+     d96:	56                   	push   %esi
+     d97:	53                   	push   %ebx
+     d98:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+     d9b:	a1 44 16 00 00       	mov    0x1644,%eax
+     da0:	85 c0                	test   %eax,%eax
+     da2:	0f 84 88 00 00 00    	je     e30 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     da8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     daa:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+     dad:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     db2:	39 df                	cmp    %ebx,%edi
+     db4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     db7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+     dbe:	39 f9                	cmp    %edi,%ecx
+     dc0:	72 0f                	jb     dd1 <lalloc+0x41>
+     dc2:	eb 4c                	jmp    e10 <lalloc+0x80>
+     dc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     dc8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+     dca:	8b 4a 04             	mov    0x4(%edx),%ecx
+     dcd:	39 f9                	cmp    %edi,%ecx
+     dcf:	73 3f                	jae    e10 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+     dd1:	89 d0                	mov    %edx,%eax
+     dd3:	39 15 44 16 00 00    	cmp    %edx,0x1644
+     dd9:	75 ed                	jne    dc8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+     ddb:	83 ec 0c             	sub    $0xc,%esp
+     dde:	56                   	push   %esi
+     ddf:	e8 07 fc ff ff       	call   9eb <sbrk>
+  if(p == (char*)-1)
+     de4:	83 c4 10             	add    $0x10,%esp
+     de7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dea:	74 11                	je     dfd <lalloc+0x6d>
+  hp->s.size = nu;
+     dec:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+     def:	e8 1c ff ff ff       	call   d10 <lfree>
+  return freep;
+     df4:	a1 44 16 00 00       	mov    0x1644,%eax
+      if((p = morecore(nunits)) == 0)
+     df9:	85 c0                	test   %eax,%eax
+     dfb:	75 cb                	jne    dc8 <lalloc+0x38>
+        return 0;
+  }
+}
+     dfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     e00:	31 d2                	xor    %edx,%edx
+}
+     e02:	5b                   	pop    %ebx
+     e03:	89 d0                	mov    %edx,%eax
+     e05:	5e                   	pop    %esi
+     e06:	5f                   	pop    %edi
+     e07:	5d                   	pop    %ebp
+     e08:	c3                   	ret
+     e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+     e10:	39 cf                	cmp    %ecx,%edi
+     e12:	74 4c                	je     e60 <lalloc+0xd0>
+        p->s.size -= nunits;
+     e14:	29 f9                	sub    %edi,%ecx
+     e16:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+     e19:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+     e1c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+     e1f:	a3 44 16 00 00       	mov    %eax,0x1644
+}
+     e24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e27:	89 d0                	mov    %edx,%eax
+     e29:	5b                   	pop    %ebx
+     e2a:	5e                   	pop    %esi
+     e2b:	5f                   	pop    %edi
+     e2c:	5d                   	pop    %ebp
+     e2d:	c3                   	ret
+     e2e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+     e30:	ba 48 16 00 00       	mov    $0x1648,%edx
+     e35:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+     e37:	c7 05 44 16 00 00 48 	movl   $0x1648,0x1644
+     e3e:	16 00 00 
+     e41:	c7 05 48 16 00 00 48 	movl   $0x1648,0x1648
+     e48:	16 00 00 
+     e4b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+     e4d:	c7 05 4c 16 00 00 00 	movl   $0x0,0x164c
+     e54:	00 00 00 
+     e57:	e9 51 ff ff ff       	jmp    dad <lalloc+0x1d>
+     e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+     e60:	8b 0a                	mov    (%edx),%ecx
+     e62:	89 08                	mov    %ecx,(%eax)
+     e64:	eb b9                	jmp    e1f <lalloc+0x8f>
+     e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e70 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	57                   	push   %edi
+     e74:	56                   	push   %esi
+     e75:	53                   	push   %ebx
+     e76:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+     e79:	85 f6                	test   %esi,%esi
+     e7b:	74 42                	je     ebf <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+     e7d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+     e80:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+     e83:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+     e89:	77 3d                	ja     ec8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+     e8b:	31 c9                	xor    %ecx,%ecx
+     e8d:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e92:	83 fa 02             	cmp    $0x2,%edx
+     e95:	74 17                	je     eae <free+0x3e>
+     e97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9e:	66 90                	xchg   %ax,%ax
+     ea0:	83 c1 01             	add    $0x1,%ecx
+     ea3:	89 d8                	mov    %ebx,%eax
+     ea5:	d3 e0                	shl    %cl,%eax
+     ea7:	83 c0 01             	add    $0x1,%eax
+     eaa:	39 c2                	cmp    %eax,%edx
+     eac:	75 f2                	jne    ea0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+     eae:	8b 04 8d 20 16 00 00 	mov    0x1620(,%ecx,4),%eax
+  classes[c] = bp;
+     eb5:	89 3c 8d 20 16 00 00 	mov    %edi,0x1620(,%ecx,4)
+  bp->s.ptr = classes[c];
+     ebc:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+     ebf:	5b                   	pop    %ebx
+     ec0:	5e                   	pop    %esi
+     ec1:	5f                   	pop    %edi
+     ec2:	5d                   	pop    %ebp
+     ec3:	c3                   	ret
+     ec4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ec8:	5b                   	pop    %ebx
+    lfree(bp);
+     ec9:	89 f8                	mov    %edi,%eax
+}
+     ecb:	5e                   	pop    %esi
+     ecc:	5f                   	pop    %edi
+     ecd:	5d                   	pop    %ebp
+    lfree(bp);
+     ece:	e9 3d fe ff ff       	jmp    d10 <lfree>
+     ed3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ee0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	57                   	push   %edi
+     ee4:	56                   	push   %esi
+     ee5:	53                   	push   %ebx
+     ee6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+     eec:	83 c0 07             	add    $0x7,%eax
+     eef:	c1 e8 03             	shr    $0x3,%eax
+     ef2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+     ef5:	3d 01 01 00 00       	cmp    $0x101,%eax
+     efa:	77 44                	ja     f40 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+     efc:	31 c9                	xor    %ecx,%ecx
+     efe:	ba 01 00 00 00       	mov    $0x1,%edx
+     f03:	bb 02 00 00 00       	mov    $0x2,%ebx
+     f08:	83 f8 02             	cmp    $0x2,%eax
+     f0b:	76 11                	jbe    f1e <malloc+0x3e>
+     f0d:	8d 76 00             	lea    0x0(%esi),%esi
+     f10:	83 c1 01             	add    $0x1,%ecx
+     f13:	89 d3                	mov    %edx,%ebx
+     f15:	d3 e3                	shl    %cl,%ebx
+     f17:	83 c3 01             	add    $0x1,%ebx
+     f1a:	39 c3                	cmp    %eax,%ebx
+     f1c:	72 f2                	jb     f10 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+     f1e:	8b 04 8d 20 16 00 00 	mov    0x1620(,%ecx,4),%eax
+     f25:	85 c0                	test   %eax,%eax
+     f27:	74 2f                	je     f58 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+     f29:	8b 10                	mov    (%eax),%edx
+     f2b:	89 14 8d 20 16 00 00 	mov    %edx,0x1620(,%ecx,4)
+  return (void*)(p + 1);
+     f32:	83 c0 08             	add    $0x8,%eax
+}
+     f35:	83 c4 1c             	add    $0x1c,%esp
+     f38:	5b                   	pop    %ebx
+     f39:	5e                   	pop    %esi
+     f3a:	5f                   	pop    %edi
+     f3b:	5d                   	pop    %ebp
+     f3c:	c3                   	ret
+     f3d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+     f40:	e8 4b fe ff ff       	call   d90 <lalloc>
+     f45:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+     f47:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+     f4a:	85 d2                	test   %edx,%edx
+     f4c:	75 e7                	jne    f35 <malloc+0x55>
+      return 0;
+     f4e:	31 c0                	xor    %eax,%eax
+     f50:	eb e3                	jmp    f35 <malloc+0x55>
+     f52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+     f58:	31 d2                	xor    %edx,%edx
+     f5a:	b8 00 02 00 00       	mov    $0x200,%eax
+     f5f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     f62:	f7 f3                	div    %ebx
+  if(n < 4)
+     f64:	ba 04 00 00 00       	mov    $0x4,%edx
+     f69:	89 d6                	mov    %edx,%esi
+     f6b:	39 d0                	cmp    %edx,%eax
+     f6d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+     f70:	0f af f3             	imul   %ebx,%esi
+     f73:	89 f0                	mov    %esi,%eax
+     f75:	e8 16 fe ff ff       	call   d90 <lalloc>
+     f7a:	85 c0                	test   %eax,%eax
+     f7c:	74 d0                	je     f4e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+     f7e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     f81:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+     f84:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f8b:	8b 14 8d 20 16 00 00 	mov    0x1620(,%ecx,4),%edx
+     f92:	39 f8                	cmp    %edi,%eax
+     f94:	73 22                	jae    fb8 <malloc+0xd8>
+     f96:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     f99:	eb 09                	jmp    fa4 <malloc+0xc4>
+     f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f9f:	90                   	nop
+     fa0:	89 c2                	mov    %eax,%edx
+     fa2:	89 c8                	mov    %ecx,%eax
+     fa4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+     fa7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+     faa:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+     fac:	39 f9                	cmp    %edi,%ecx
+     fae:	72 f0                	jb     fa0 <malloc+0xc0>
+     fb0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     fb3:	e9 73 ff ff ff       	jmp    f2b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+     fb8:	89 d0                	mov    %edx,%eax
+     fba:	8b 12                	mov    (%edx),%edx
+     fbc:	e9 6a ff ff ff       	jmp    f2b <malloc+0x4b>
+     fc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+
+00000fd0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	56                   	push   %esi
+     fd4:	53                   	push   %ebx
+     fd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     fd8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+     fdb:	85 c9                	test   %ecx,%ecx
+     fdd:	74 06                	je     fe5 <calloc+0x15>
+     fdf:	89 c8                	mov    %ecx,%eax
+     fe1:	f7 e3                	mul    %ebx
+     fe3:	70 33                	jo     1018 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+     fe5:	0f af d9             	imul   %ecx,%ebx
+     fe8:	83 ec 0c             	sub    $0xc,%esp
+     feb:	53                   	push   %ebx
+     fec:	e8 ef fe ff ff       	call   ee0 <malloc>
+     ff1:	83 c4 10             	add    $0x10,%esp
+     ff4:	89 c6                	mov    %eax,%esi
+     ff6:	85 c0                	test   %eax,%eax
+     ff8:	74 1e                	je     1018 <calloc+0x48>
+    memset(p, 0, n * size);
+     ffa:	83 ec 04             	sub    $0x4,%esp
+     ffd:	53                   	push   %ebx
+     ffe:	6a 00                	push   $0x0
+    1000:	50                   	push   %eax
+    1001:	e8 3a f7 ff ff       	call   740 <memset>
+    1006:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    1009:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    100c:	89 f0                	mov    %esi,%eax
+    100e:	5b                   	pop    %ebx
+    100f:	5e                   	pop    %esi
+    1010:	5d                   	pop    %ebp
+    1011:	c3                   	ret
+    1012:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1018:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    101b:	31 f6                	xor    %esi,%esi
+}
+    101d:	89 f0                	mov    %esi,%eax
+    101f:	5b                   	pop    %ebx
+    1020:	5e                   	pop    %esi
+    1021:	5d                   	pop    %ebp
+    1022:	c3                   	ret
+    1023:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001030 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	57                   	push   %edi
+    1034:	56                   	push   %esi
+    1035:	53                   	push   %ebx
+    1036:	83 ec 0c             	sub    $0xc,%esp
+    1039:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    103c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    103f:	85 db                	test   %ebx,%ebx
+    1041:	74 55                	je     1098 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    1043:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    1046:	89 de                	mov    %ebx,%esi
+    1048:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    104f:	39 c7                	cmp    %eax,%edi
+    1051:	72 0d                	jb     1060 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    1053:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1056:	89 f0                	mov    %esi,%eax
+    1058:	5b                   	pop    %ebx
+    1059:	5e                   	pop    %esi
+    105a:	5f                   	pop    %edi
+    105b:	5d                   	pop    %ebp
+    105c:	c3                   	ret
+    105d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    1060:	83 ec 0c             	sub    $0xc,%esp
+    1063:	50                   	push   %eax
+    1064:	e8 77 fe ff ff       	call   ee0 <malloc>
+    1069:	83 c4 10             	add    $0x10,%esp
+    106c:	89 c6                	mov    %eax,%esi
+    106e:	85 c0                	test   %eax,%eax
+    1070:	74 e1                	je     1053 <realloc+0x23>
+  memmove(p, ap, have);
+    1072:	83 ec 04             	sub    $0x4,%esp
+    1075:	57                   	push   %edi
+    1076:	53                   	push   %ebx
+    1077:	50                   	push   %eax
+    1078:	e8 b3 f8 ff ff       	call   930 <memmove>
+  free(ap);
+    107d:	89 1c 24             	mov    %ebx,(%esp)
+    1080:	e8 eb fd ff ff       	call   e70 <free>
+  return p;
+    1085:	83 c4 10             	add    $0x10,%esp
+}
+    1088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    108b:	89 f0                	mov    %esi,%eax
+    108d:	5b                   	pop    %ebx
+    108e:	5e                   	pop    %esi
+    108f:	5f                   	pop    %edi
+    1090:	5d                   	pop    %ebp
+    1091:	c3                   	ret
+    1092:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    1098:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    109b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    109e:	5b                   	pop    %ebx
+    109f:	5e                   	pop    %esi
+    10a0:	5f                   	pop    %edi
+    10a1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    10a2:	e9 39 fe ff ff       	jmp    ee0 <malloc>
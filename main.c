@@ -17,8 +17,10 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
+  bootmark("start");
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
+  bootmark("vm");
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
   seginit();       // segment descriptors
@@ -26,17 +28,55 @@ main(void)
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
+  bootmark("devices");
   pinit();         // process table
   tvinit();        // trap vectors
-  binit();         // buffer cache
-  fileinit();      // file table
+  textinit();      // shared program pages
   ideinit();       // disk 
+  bootmark("tables");
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  bootmark("cpus");
+  kinit2(P2V(4*1024*1024), P2V(phystop)); // must come after startothers()
+  binit();         // buffer cache
+  fileinit();      // file table
   userinit();      // first user process
+  bootmark("memory");
   mpmain();        // finish this processor's setup
 }
 
+// Boot-phase timestamps, from the boot CPU's time-stamp counter.
+// forkret() adds the last one and prints them once the file
+// system is up.
+static struct {
+  char *name;
+  unsigned long long tsc;
+} boottime[10];
+static int nboottime;
+
+void
+bootmark(char *name)
+{
+  if(nboottime < NELEM(boottime)){
+    boottime[nboottime].name = name;
+    boottime[nboottime].tsc = rdtsc();
+    nboottime++;
+  }
+}
+
+// Print the time each phase took, in units of 1024 cycles.
+void
+bootreport(void)
+{
+  int i;
+
+  cprintf("boot:");
+  for(i = 1; i < nboottime; i++)
+    cprintf(" %s %d", boottime[i].name,
+            (uint)((boottime[i].tsc - boottime[i-1].tsc) >> 10));
+  cprintf(", total %d Kcycles\n",
+          (uint)((boottime[nboottime-1].tsc - boottime[0].tsc) >> 10));
+}
+
 // Other CPUs jump here from entryother.S.
 static void
 mpenter(void)
@@ -64,9 +104,10 @@ static void
 startothers(void)
 {
   extern uchar _binary_entryother_start[], _binary_entryother_size[];
+  static char *stacks[NCPU];
   uchar *code;
   struct cpu *c;
-  char *stack;
+  int n;
 
   // Write entry code to unused memory at 0x7000.
   // The linker has placed the image of entryother.S in
@@ -74,24 +115,29 @@ startothers(void)
   code = P2V(0x7000);
   memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
 
-  for(c = cpus; c < cpus+ncpu; c++){
-    if(c == mycpu())  // We've started already.
-      continue;
-
-    // Tell entryother.S what stack to use, where to enter, and what
-    // pgdir to use. We cannot use kpgdir yet, because the AP processor
-    // is running in low  memory, so we use entrypgdir for the APs too.
-    stack = kalloc();
-    *(void**)(code-4) = stack + KSTACKSIZE;
-    *(void**)(code-8) = mpenter;
-    *(int**)(code-12) = (void *) V2P(entrypgdir);
+  // Tell entryother.S what stacks to use, where to enter, and what
+  // pgdir to use. We cannot use kpgdir yet, because the AP processor
+  // is running in low  memory, so we use entrypgdir for the APs too.
+  // The APs start all at once; each claims the next stack by
+  // incrementing the counter at code-16.
+  n = 0;
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c != mycpu())
+      stacks[n++] = kalloc() + KSTACKSIZE;
+  *(char***)(code-4) = stacks;
+  *(void**)(code-8) = mpenter;
+  *(int**)(code-12) = (void *) V2P(entrypgdir);
+  *(int*)(code-16) = 0;
 
-    lapicstartap(c->apicid, V2P(code));
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c != mycpu())  // We've started already.
+      lapicstartap(c->apicid, V2P(code));
 
-    // wait for cpu to finish mpmain()
-    while(c->started == 0)
-      ;
-  }
+  // wait for each cpu to finish mpmain()
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c != mycpu())
+      while(c->started == 0)
+        ;
 }
 
 // The boot page table used in entry.S and entryother.S.
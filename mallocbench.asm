@@ -0,0 +1,1864 @@
+
+_mallocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "calloc/realloc: %s\n", bad ? "FAILED" : "ok");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  int i, j, t;
+  uint n;
+
+  t = uptime();
+  10:	bb 40 0d 03 00       	mov    $0x30d40,%ebx
+{
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  t = uptime();
+  19:	e8 8d 05 00 00       	call   5ab <uptime>
+  1e:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < N; i++)
+    free(malloc(32));
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	6a 20                	push   $0x20
+  25:	e8 66 0a 00 00       	call   a90 <malloc>
+  2a:	89 04 24             	mov    %eax,(%esp)
+  2d:	e8 ee 09 00 00       	call   a20 <free>
+  for(i = 0; i < N; i++)
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	83 eb 01             	sub    $0x1,%ebx
+  38:	75 e6                	jne    20 <main+0x20>
+  report("small malloc/free", uptime() - t);
+  3a:	e8 6c 05 00 00       	call   5ab <uptime>
+  3f:	29 f0                	sub    %esi,%eax
+
+  t = uptime();
+  41:	be 40 0d 03 00       	mov    $0x30d40,%esi
+  report("small malloc/free", uptime() - t);
+  46:	89 c2                	mov    %eax,%edx
+  48:	b8 a1 0c 00 00       	mov    $0xca1,%eax
+  4d:	e8 9e 01 00 00       	call   1f0 <report>
+  t = uptime();
+  52:	e8 54 05 00 00       	call   5ab <uptime>
+  57:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < N; i++){
+  5a:	eb 45                	jmp    a1 <main+0xa1>
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  randstate = randstate * 1664525 + 1013904223;
+  60:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  66:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    j = rand() % LIVE;
+    free(live[j]);
+    n = rand() % 8 == 0 ? 2048 + rand() % 8192 : 8 + rand() % 256;
+  6b:	89 c3                	mov    %eax,%ebx
+  6d:	81 e3 ff 1f 00 00    	and    $0x1fff,%ebx
+  73:	81 c3 00 08 00 00    	add    $0x800,%ebx
+    if((live[j] = malloc(n)) == 0){
+  79:	83 ec 0c             	sub    $0xc,%esp
+  7c:	a3 1c 11 00 00       	mov    %eax,0x111c
+  81:	53                   	push   %ebx
+  82:	e8 09 0a 00 00       	call   a90 <malloc>
+  87:	83 c4 10             	add    $0x10,%esp
+  8a:	89 04 bd 20 11 00 00 	mov    %eax,0x1120(,%edi,4)
+  91:	85 c0                	test   %eax,%eax
+  93:	74 77                	je     10c <main+0x10c>
+      printf(2, "mallocbench: malloc %d failed\n", n);
+      exit();
+    }
+    *(char*)live[j] = 1;
+  95:	c6 00 01             	movb   $0x1,(%eax)
+  for(i = 0; i < N; i++){
+  98:	83 ee 01             	sub    $0x1,%esi
+  9b:	0f 84 80 00 00 00    	je     121 <main+0x121>
+  randstate = randstate * 1664525 + 1013904223;
+  a1:	69 0d 1c 11 00 00 0d 	imul   $0x19660d,0x111c,%ecx
+  a8:	66 19 00 
+    j = rand() % LIVE;
+  ab:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    free(live[j]);
+  b0:	83 ec 0c             	sub    $0xc,%esp
+  randstate = randstate * 1664525 + 1013904223;
+  b3:	81 c1 5f f3 6e 3c    	add    $0x3c6ef35f,%ecx
+    j = rand() % LIVE;
+  b9:	f7 e1                	mul    %ecx
+  randstate = randstate * 1664525 + 1013904223;
+  bb:	89 0d 1c 11 00 00    	mov    %ecx,0x111c
+    j = rand() % LIVE;
+  c1:	89 d7                	mov    %edx,%edi
+  c3:	c1 ef 06             	shr    $0x6,%edi
+  c6:	69 c7 e8 03 00 00    	imul   $0x3e8,%edi,%eax
+  cc:	89 cf                	mov    %ecx,%edi
+  ce:	29 c7                	sub    %eax,%edi
+    free(live[j]);
+  d0:	ff 34 bd 20 11 00 00 	push   0x1120(,%edi,4)
+  d7:	e8 44 09 00 00       	call   a20 <free>
+    n = rand() % 8 == 0 ? 2048 + rand() % 8192 : 8 + rand() % 256;
+  dc:	83 c4 10             	add    $0x10,%esp
+  randstate = randstate * 1664525 + 1013904223;
+  df:	69 05 1c 11 00 00 0d 	imul   $0x19660d,0x111c,%eax
+  e6:	66 19 00 
+  e9:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    n = rand() % 8 == 0 ? 2048 + rand() % 8192 : 8 + rand() % 256;
+  ee:	a8 07                	test   $0x7,%al
+  f0:	0f 84 6a ff ff ff    	je     60 <main+0x60>
+  randstate = randstate * 1664525 + 1013904223;
+  f6:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  fc:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    n = rand() % 8 == 0 ? 2048 + rand() % 8192 : 8 + rand() % 256;
+ 101:	0f b6 d8             	movzbl %al,%ebx
+ 104:	83 c3 08             	add    $0x8,%ebx
+ 107:	e9 6d ff ff ff       	jmp    79 <main+0x79>
+      printf(2, "mallocbench: malloc %d failed\n", n);
+ 10c:	83 ec 04             	sub    $0x4,%esp
+ 10f:	53                   	push   %ebx
+ 110:	68 78 0c 00 00       	push   $0xc78
+ 115:	6a 02                	push   $0x2
+ 117:	e8 f4 05 00 00       	call   710 <printf>
+      exit();
+ 11c:	e8 f2 03 00 00       	call   513 <exit>
+  }
+  report("mixed, 1000 live", uptime() - t);
+ 121:	e8 85 04 00 00       	call   5ab <uptime>
+ 126:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  for(i = 0; i < LIVE; i++)
+ 129:	31 db                	xor    %ebx,%ebx
+  report("mixed, 1000 live", uptime() - t);
+ 12b:	29 f0                	sub    %esi,%eax
+ 12d:	89 c2                	mov    %eax,%edx
+ 12f:	b8 b3 0c 00 00       	mov    $0xcb3,%eax
+ 134:	e8 b7 00 00 00       	call   1f0 <report>
+  for(i = 0; i < LIVE; i++)
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(live[i]);
+ 140:	83 ec 0c             	sub    $0xc,%esp
+ 143:	ff 34 9d 20 11 00 00 	push   0x1120(,%ebx,4)
+  for(i = 0; i < LIVE; i++)
+ 14a:	83 c3 01             	add    $0x1,%ebx
+    free(live[i]);
+ 14d:	e8 ce 08 00 00       	call   a20 <free>
+  for(i = 0; i < LIVE; i++)
+ 152:	83 c4 10             	add    $0x10,%esp
+ 155:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+ 15b:	75 e3                	jne    140 <main+0x140>
+  p = calloc(100, 10);
+ 15d:	52                   	push   %edx
+  bad = 0;
+ 15e:	31 db                	xor    %ebx,%ebx
+  p = calloc(100, 10);
+ 160:	52                   	push   %edx
+ 161:	6a 0a                	push   $0xa
+ 163:	6a 64                	push   $0x64
+ 165:	e8 16 0a 00 00       	call   b80 <calloc>
+ 16a:	83 c4 10             	add    $0x10,%esp
+      bad = 1;
+ 16d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  p = calloc(100, 10);
+ 172:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < 1000; i++){
+ 174:	31 c0                	xor    %eax,%eax
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+      bad = 1;
+ 180:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    p[i] = i;
+ 184:	88 04 02             	mov    %al,(%edx,%eax,1)
+      bad = 1;
+ 187:	0f 45 d9             	cmovne %ecx,%ebx
+  for(i = 0; i < 1000; i++){
+ 18a:	83 c0 01             	add    $0x1,%eax
+ 18d:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+ 192:	75 ec                	jne    180 <main+0x180>
+  p = realloc(p, 5000);
+ 194:	50                   	push   %eax
+ 195:	50                   	push   %eax
+ 196:	68 88 13 00 00       	push   $0x1388
+ 19b:	52                   	push   %edx
+ 19c:	e8 3f 0a 00 00       	call   be0 <realloc>
+ 1a1:	83 c4 10             	add    $0x10,%esp
+      bad = 1;
+ 1a4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  p = realloc(p, 5000);
+ 1a9:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < 1000; i++)
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+      bad = 1;
+ 1b0:	38 04 02             	cmp    %al,(%edx,%eax,1)
+ 1b3:	0f 45 d9             	cmovne %ecx,%ebx
+  for(i = 0; i < 1000; i++)
+ 1b6:	83 c0 01             	add    $0x1,%eax
+ 1b9:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+ 1be:	75 f0                	jne    1b0 <main+0x1b0>
+  free(p);
+ 1c0:	83 ec 0c             	sub    $0xc,%esp
+ 1c3:	52                   	push   %edx
+ 1c4:	e8 57 08 00 00       	call   a20 <free>
+  printf(1, "calloc/realloc: %s\n", bad ? "FAILED" : "ok");
+ 1c9:	83 c4 0c             	add    $0xc,%esp
+ 1cc:	ba 97 0c 00 00       	mov    $0xc97,%edx
+ 1d1:	85 db                	test   %ebx,%ebx
+ 1d3:	b8 9e 0c 00 00       	mov    $0xc9e,%eax
+ 1d8:	0f 45 c2             	cmovne %edx,%eax
+ 1db:	50                   	push   %eax
+ 1dc:	68 c4 0c 00 00       	push   $0xcc4
+ 1e1:	6a 01                	push   $0x1
+ 1e3:	e8 28 05 00 00       	call   710 <printf>
+
+  check();
+  exit();
+ 1e8:	e8 26 03 00 00       	call   513 <exit>
+ 1ed:	66 90                	xchg   %ax,%ax
+ 1ef:	90                   	nop
+
+000001f0 <report>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 d1                	mov    %edx,%ecx
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	89 c3                	mov    %eax,%ebx
+    t = 1;
+ 1f8:	b8 01 00 00 00       	mov    $0x1,%eax
+{
+ 1fd:	83 ec 0c             	sub    $0xc,%esp
+    t = 1;
+ 200:	85 d2                	test   %edx,%edx
+ 202:	0f 44 c8             	cmove  %eax,%ecx
+  printf(1, "%s: %d ops in %d ms, %d per ms\n", what, N, t, N / t);
+ 205:	b8 40 0d 03 00       	mov    $0x30d40,%eax
+ 20a:	31 d2                	xor    %edx,%edx
+ 20c:	f7 f9                	idiv   %ecx
+ 20e:	50                   	push   %eax
+ 20f:	51                   	push   %ecx
+ 210:	68 40 0d 03 00       	push   $0x30d40
+ 215:	53                   	push   %ebx
+ 216:	68 58 0c 00 00       	push   $0xc58
+ 21b:	6a 01                	push   $0x1
+ 21d:	e8 ee 04 00 00       	call   710 <printf>
+}
+ 222:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 225:	83 c4 20             	add    $0x20,%esp
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+ 22a:	66 90                	xchg   %ax,%ax
+ 22c:	66 90                	xchg   %ax,%ax
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 231:	31 c0                	xor    %eax,%eax
+{
+ 233:	89 e5                	mov    %esp,%ebp
+ 235:	53                   	push   %ebx
+ 236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 247:	83 c0 01             	add    $0x1,%eax
+ 24a:	84 d2                	test   %dl,%dl
+ 24c:	75 f2                	jne    240 <strcpy+0x10>
+    ;
+  return os;
+}
+ 24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 251:	89 c8                	mov    %ecx,%eax
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+ 255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+ 267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 26a:	0f b6 02             	movzbl (%edx),%eax
+ 26d:	84 c0                	test   %al,%al
+ 26f:	75 17                	jne    288 <strcmp+0x28>
+ 271:	eb 3a                	jmp    2ad <strcmp+0x4d>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 27c:	83 c2 01             	add    $0x1,%edx
+ 27f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 282:	84 c0                	test   %al,%al
+ 284:	74 1a                	je     2a0 <strcmp+0x40>
+    p++, q++;
+ 286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 288:	0f b6 19             	movzbl (%ecx),%ebx
+ 28b:	38 c3                	cmp    %al,%bl
+ 28d:	74 e9                	je     278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 28f:	29 d8                	sub    %ebx,%eax
+}
+ 291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 294:	c9                   	leave
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2a4:	31 c0                	xor    %eax,%eax
+ 2a6:	29 d8                	sub    %ebx,%eax
+}
+ 2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 2b0:	31 c0                	xor    %eax,%eax
+ 2b2:	eb db                	jmp    28f <strcmp+0x2f>
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2c9:	74 15                	je     2e0 <strlen+0x20>
+ 2cb:	31 c0                	xor    %eax,%eax
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2d0:	83 c0 01             	add    $0x1,%eax
+ 2d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2d7:	89 c1                	mov    %eax,%ecx
+ 2d9:	75 f5                	jne    2d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2db:	89 c8                	mov    %ecx,%eax
+ 2dd:	5d                   	pop    %ebp
+ 2de:	c3                   	ret
+ 2df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2e0:	31 c9                	xor    %ecx,%ecx
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	89 c8                	mov    %ecx,%eax
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fd:	89 d7                	mov    %edx,%edi
+ 2ff:	fc                   	cld
+ 300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 305:	89 d0                	mov    %edx,%eax
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 31a:	0f b6 10             	movzbl (%eax),%edx
+ 31d:	84 d2                	test   %dl,%dl
+ 31f:	75 12                	jne    333 <strchr+0x23>
+ 321:	eb 1d                	jmp    340 <strchr+0x30>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 32c:	83 c0 01             	add    $0x1,%eax
+ 32f:	84 d2                	test   %dl,%dl
+ 331:	74 0d                	je     340 <strchr+0x30>
+    if(*s == c)
+ 333:	38 d1                	cmp    %dl,%cl
+ 335:	75 f1                	jne    328 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 340:	31 c0                	xor    %eax,%eax
+}
+ 342:	5d                   	pop    %ebp
+ 343:	c3                   	ret
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 355:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 358:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 359:	31 db                	xor    %ebx,%ebx
+{
+ 35b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 35e:	eb 27                	jmp    387 <gets+0x37>
+    cc = read(0, &c, 1);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	6a 01                	push   $0x1
+ 365:	56                   	push   %esi
+ 366:	6a 00                	push   $0x0
+ 368:	e8 be 01 00 00       	call   52b <read>
+    if(cc < 1)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	85 c0                	test   %eax,%eax
+ 372:	7e 1d                	jle    391 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 37f:	3c 0a                	cmp    $0xa,%al
+ 381:	74 10                	je     393 <gets+0x43>
+ 383:	3c 0d                	cmp    $0xd,%al
+ 385:	74 0c                	je     393 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 387:	89 df                	mov    %ebx,%edi
+ 389:	83 c3 01             	add    $0x1,%ebx
+ 38c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 38f:	7c cf                	jl     360 <gets+0x10>
+ 391:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 39a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 39d:	5b                   	pop    %ebx
+ 39e:	5e                   	pop    %esi
+ 39f:	5f                   	pop    %edi
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+ 3a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+ 3b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	6a 00                	push   $0x0
+ 3ba:	ff 75 08             	push   0x8(%ebp)
+ 3bd:	e8 91 01 00 00       	call   553 <open>
+  if(fd < 0)
+ 3c2:	83 c4 10             	add    $0x10,%esp
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	78 27                	js     3f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3c9:	83 ec 08             	sub    $0x8,%esp
+ 3cc:	ff 75 0c             	push   0xc(%ebp)
+ 3cf:	89 c3                	mov    %eax,%ebx
+ 3d1:	50                   	push   %eax
+ 3d2:	e8 94 01 00 00       	call   56b <fstat>
+  close(fd);
+ 3d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3dc:	e8 5a 01 00 00       	call   53b <close>
+  return r;
+ 3e1:	83 c4 10             	add    $0x10,%esp
+}
+ 3e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3e7:	89 f0                	mov    %esi,%eax
+ 3e9:	5b                   	pop    %ebx
+ 3ea:	5e                   	pop    %esi
+ 3eb:	5d                   	pop    %ebp
+ 3ec:	c3                   	ret
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3f5:	eb ed                	jmp    3e4 <stat+0x34>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+ 405:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 408:	0f b6 02             	movzbl (%edx),%eax
+ 40b:	3c 20                	cmp    $0x20,%al
+ 40d:	75 0c                	jne    41b <atoi+0x1b>
+ 40f:	90                   	nop
+ 410:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 414:	83 c2 01             	add    $0x1,%edx
+ 417:	3c 20                	cmp    $0x20,%al
+ 419:	74 f5                	je     410 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 41b:	3c 2d                	cmp    $0x2d,%al
+ 41d:	74 41                	je     460 <atoi+0x60>
+ 41f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 424:	3c 2b                	cmp    $0x2b,%al
+ 426:	74 3d                	je     465 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 428:	0f be 0a             	movsbl (%edx),%ecx
+ 42b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 42e:	3c 09                	cmp    $0x9,%al
+ 430:	b8 00 00 00 00       	mov    $0x0,%eax
+ 435:	77 21                	ja     458 <atoi+0x58>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 440:	83 c2 01             	add    $0x1,%edx
+ 443:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 446:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 44a:	0f be 0a             	movsbl (%edx),%ecx
+ 44d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 450:	80 fb 09             	cmp    $0x9,%bl
+ 453:	76 eb                	jbe    440 <atoi+0x40>
+  return sign*n;
+ 455:	0f af c6             	imul   %esi,%eax
+}
+ 458:	5b                   	pop    %ebx
+ 459:	5e                   	pop    %esi
+ 45a:	5d                   	pop    %ebp
+ 45b:	c3                   	ret
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 460:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 465:	83 c2 01             	add    $0x1,%edx
+ 468:	eb be                	jmp    428 <atoi+0x28>
+ 46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000470 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	56                   	push   %esi
+ 474:	53                   	push   %ebx
+ 475:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 478:	0f b6 02             	movzbl (%edx),%eax
+ 47b:	3c 20                	cmp    $0x20,%al
+ 47d:	75 0c                	jne    48b <atoo+0x1b>
+ 47f:	90                   	nop
+ 480:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 484:	83 c2 01             	add    $0x1,%edx
+ 487:	3c 20                	cmp    $0x20,%al
+ 489:	74 f5                	je     480 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 48b:	3c 2d                	cmp    $0x2d,%al
+ 48d:	74 41                	je     4d0 <atoo+0x60>
+ 48f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 494:	3c 2b                	cmp    $0x2b,%al
+ 496:	74 3d                	je     4d5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 498:	0f be 0a             	movsbl (%edx),%ecx
+ 49b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 49e:	3c 07                	cmp    $0x7,%al
+ 4a0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4a5:	77 1e                	ja     4c5 <atoo+0x55>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 4b0:	83 c2 01             	add    $0x1,%edx
+ 4b3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 4b7:	0f be 0a             	movsbl (%edx),%ecx
+ 4ba:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4bd:	80 fb 07             	cmp    $0x7,%bl
+ 4c0:	76 ee                	jbe    4b0 <atoo+0x40>
+  return sign*n;
+ 4c2:	0f af c6             	imul   %esi,%eax
+}
+ 4c5:	5b                   	pop    %ebx
+ 4c6:	5e                   	pop    %esi
+ 4c7:	5d                   	pop    %ebp
+ 4c8:	c3                   	ret
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 4d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 4d5:	83 c2 01             	add    $0x1,%edx
+ 4d8:	eb be                	jmp    498 <atoo+0x28>
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004e0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ee:	85 c0                	test   %eax,%eax
+ 4f0:	7e 13                	jle    505 <memmove+0x25>
+ 4f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4f4:	89 d7                	mov    %edx,%edi
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 500:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 501:	39 f8                	cmp    %edi,%eax
+ 503:	75 fb                	jne    500 <memmove+0x20>
+  return vdst;
+}
+ 505:	5e                   	pop    %esi
+ 506:	89 d0                	mov    %edx,%eax
+ 508:	5f                   	pop    %edi
+ 509:	5d                   	pop    %ebp
+ 50a:	c3                   	ret
+
+0000050b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 50b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <exit>:
+SYSCALL(exit)
+ 513:	b8 02 00 00 00       	mov    $0x2,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <wait>:
+SYSCALL(wait)
+ 51b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <pipe>:
+SYSCALL(pipe)
+ 523:	b8 04 00 00 00       	mov    $0x4,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <read>:
+SYSCALL(read)
+ 52b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <write>:
+SYSCALL(write)
+ 533:	b8 10 00 00 00       	mov    $0x10,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <close>:
+SYSCALL(close)
+ 53b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <kill>:
+SYSCALL(kill)
+ 543:	b8 06 00 00 00       	mov    $0x6,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <exec>:
+SYSCALL(exec)
+ 54b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <open>:
+SYSCALL(open)
+ 553:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mknod>:
+SYSCALL(mknod)
+ 55b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <unlink>:
+SYSCALL(unlink)
+ 563:	b8 12 00 00 00       	mov    $0x12,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <fstat>:
+SYSCALL(fstat)
+ 56b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <link>:
+SYSCALL(link)
+ 573:	b8 13 00 00 00       	mov    $0x13,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mkdir>:
+SYSCALL(mkdir)
+ 57b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <chdir>:
+SYSCALL(chdir)
+ 583:	b8 09 00 00 00       	mov    $0x9,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <dup>:
+SYSCALL(dup)
+ 58b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getpid>:
+SYSCALL(getpid)
+ 593:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <sbrk>:
+SYSCALL(sbrk)
+ 59b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <sleep>:
+SYSCALL(sleep)
+ 5a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <uptime>:
+SYSCALL(uptime)
+ 5ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <superpages>:
+SYSCALL(superpages)
+ 5b3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <mmap>:
+SYSCALL(mmap)
+ 5bb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <munmap>:
+SYSCALL(munmap)
+ 5c3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <spawn>:
+SYSCALL(spawn)
+ 5cb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <swapstat>:
+SYSCALL(swapstat)
+ 5d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <getmeminfo>:
+SYSCALL(getmeminfo)
+ 5db:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <iostat>:
+SYSCALL(iostat)
+ 5e3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <dropcache>:
+SYSCALL(dropcache)
+ 5eb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <iosched>:
+SYSCALL(iosched)
+ 5f3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <halt>:
+SYSCALL(halt)
+ 5fb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <date>:
+SYSCALL(date)
+ 603:	b8 17 00 00 00       	mov    $0x17,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 60b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <getgid>:
+SYSCALL(getgid)
+ 613:	b8 19 00 00 00       	mov    $0x19,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <getppid>:
+SYSCALL(getppid)
+ 61b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <setuid>:
+SYSCALL(setuid)
+ 623:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <setgid>:
+SYSCALL(setgid)
+ 62b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getprocs>:
+SYSCALL(getprocs)
+ 633:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 63b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <getpriority>:
+SYSCALL(getpriority)
+ 643:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 64b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <chown>:
+SYSCALL(chown)
+ 653:	b8 21 00 00 00       	mov    $0x21,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <chgrp>:
+SYSCALL(chgrp)
+ 65b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+ 663:	66 90                	xchg   %ax,%ax
+ 665:	66 90                	xchg   %ax,%ax
+ 667:	66 90                	xchg   %ax,%ax
+ 669:	66 90                	xchg   %ax,%ax
+ 66b:	66 90                	xchg   %ax,%ax
+ 66d:	66 90                	xchg   %ax,%ax
+ 66f:	90                   	nop
+
+00000670 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 678:	89 d1                	mov    %edx,%ecx
+{
+ 67a:	83 ec 3c             	sub    $0x3c,%esp
+ 67d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 680:	85 d2                	test   %edx,%edx
+ 682:	0f 89 80 00 00 00    	jns    708 <printint+0x98>
+ 688:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 68c:	74 7a                	je     708 <printint+0x98>
+    x = -xx;
+ 68e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 690:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 695:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 698:	31 f6                	xor    %esi,%esi
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6a0:	89 c8                	mov    %ecx,%eax
+ 6a2:	31 d2                	xor    %edx,%edx
+ 6a4:	89 f7                	mov    %esi,%edi
+ 6a6:	f7 f3                	div    %ebx
+ 6a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6ab:	0f b6 92 38 0d 00 00 	movzbl 0xd38(%edx),%edx
+ 6b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6b6:	89 ca                	mov    %ecx,%edx
+ 6b8:	89 c1                	mov    %eax,%ecx
+ 6ba:	39 da                	cmp    %ebx,%edx
+ 6bc:	73 e2                	jae    6a0 <printint+0x30>
+  if(neg)
+ 6be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6c1:	85 c0                	test   %eax,%eax
+ 6c3:	74 07                	je     6cc <printint+0x5c>
+    buf[i++] = '-';
+ 6c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ca:	89 f7                	mov    %esi,%edi
+ 6cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6d2:	01 df                	add    %ebx,%edi
+ 6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6db:	83 ec 04             	sub    $0x4,%esp
+ 6de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6e4:	6a 01                	push   $0x1
+ 6e6:	50                   	push   %eax
+ 6e7:	56                   	push   %esi
+ 6e8:	e8 46 fe ff ff       	call   533 <write>
+  while(--i >= 0)
+ 6ed:	89 f8                	mov    %edi,%eax
+ 6ef:	83 c4 10             	add    $0x10,%esp
+ 6f2:	83 ef 01             	sub    $0x1,%edi
+ 6f5:	39 d8                	cmp    %ebx,%eax
+ 6f7:	75 df                	jne    6d8 <printint+0x68>
+}
+ 6f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6fc:	5b                   	pop    %ebx
+ 6fd:	5e                   	pop    %esi
+ 6fe:	5f                   	pop    %edi
+ 6ff:	5d                   	pop    %ebp
+ 700:	c3                   	ret
+ 701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 708:	31 c0                	xor    %eax,%eax
+ 70a:	eb 89                	jmp    695 <printint+0x25>
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 719:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 71c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 71f:	0f b6 1e             	movzbl (%esi),%ebx
+ 722:	83 c6 01             	add    $0x1,%esi
+ 725:	84 db                	test   %bl,%bl
+ 727:	74 67                	je     790 <printf+0x80>
+ 729:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 72c:	31 d2                	xor    %edx,%edx
+ 72e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 731:	eb 34                	jmp    767 <printf+0x57>
+ 733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 737:	90                   	nop
+ 738:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 73b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 740:	83 f8 25             	cmp    $0x25,%eax
+ 743:	74 18                	je     75d <printf+0x4d>
+  write(fd, &c, 1);
+ 745:	83 ec 04             	sub    $0x4,%esp
+ 748:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 74b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 74e:	6a 01                	push   $0x1
+ 750:	50                   	push   %eax
+ 751:	57                   	push   %edi
+ 752:	e8 dc fd ff ff       	call   533 <write>
+ 757:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 75a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 75d:	0f b6 1e             	movzbl (%esi),%ebx
+ 760:	83 c6 01             	add    $0x1,%esi
+ 763:	84 db                	test   %bl,%bl
+ 765:	74 29                	je     790 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 767:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 76a:	85 d2                	test   %edx,%edx
+ 76c:	74 ca                	je     738 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 76e:	83 fa 25             	cmp    $0x25,%edx
+ 771:	75 ea                	jne    75d <printf+0x4d>
+      if(c == 'd'){
+ 773:	83 f8 25             	cmp    $0x25,%eax
+ 776:	0f 84 24 01 00 00    	je     8a0 <printf+0x190>
+ 77c:	83 e8 63             	sub    $0x63,%eax
+ 77f:	83 f8 15             	cmp    $0x15,%eax
+ 782:	77 1c                	ja     7a0 <printf+0x90>
+ 784:	ff 24 85 e0 0c 00 00 	jmp    *0xce0(,%eax,4)
+ 78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 793:	5b                   	pop    %ebx
+ 794:	5e                   	pop    %esi
+ 795:	5f                   	pop    %edi
+ 796:	5d                   	pop    %ebp
+ 797:	c3                   	ret
+ 798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7aa:	6a 01                	push   $0x1
+ 7ac:	52                   	push   %edx
+ 7ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7b0:	57                   	push   %edi
+ 7b1:	e8 7d fd ff ff       	call   533 <write>
+ 7b6:	83 c4 0c             	add    $0xc,%esp
+ 7b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7bc:	6a 01                	push   $0x1
+ 7be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7c1:	52                   	push   %edx
+ 7c2:	57                   	push   %edi
+ 7c3:	e8 6b fd ff ff       	call   533 <write>
+        putc(fd, c);
+ 7c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7cb:	31 d2                	xor    %edx,%edx
+ 7cd:	eb 8e                	jmp    75d <printf+0x4d>
+ 7cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 00                	push   $0x0
+ 7df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7e4:	e8 87 fe ff ff       	call   670 <printint>
+        ap++;
+ 7e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 67 ff ff ff       	jmp    75d <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 800:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 803:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 805:	83 c0 04             	add    $0x4,%eax
+ 808:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 80b:	85 db                	test   %ebx,%ebx
+ 80d:	0f 84 9d 00 00 00    	je     8b0 <printf+0x1a0>
+        while(*s != 0){
+ 813:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 816:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 818:	84 c0                	test   %al,%al
+ 81a:	0f 84 3d ff ff ff    	je     75d <printf+0x4d>
+ 820:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 823:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 826:	89 de                	mov    %ebx,%esi
+ 828:	89 d3                	mov    %edx,%ebx
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 836:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	53                   	push   %ebx
+ 83c:	57                   	push   %edi
+ 83d:	e8 f1 fc ff ff       	call   533 <write>
+        while(*s != 0){
+ 842:	0f b6 06             	movzbl (%esi),%eax
+ 845:	83 c4 10             	add    $0x10,%esp
+ 848:	84 c0                	test   %al,%al
+ 84a:	75 e4                	jne    830 <printf+0x120>
+      state = 0;
+ 84c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 07 ff ff ff       	jmp    75d <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 86b:	8b 13                	mov    (%ebx),%edx
+ 86d:	6a 01                	push   $0x1
+ 86f:	e9 6b ff ff ff       	jmp    7df <printf+0xcf>
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 878:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 881:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 883:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 886:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 889:	6a 01                	push   $0x1
+ 88b:	52                   	push   %edx
+ 88c:	57                   	push   %edi
+ 88d:	e8 a1 fc ff ff       	call   533 <write>
+        ap++;
+ 892:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 895:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 898:	31 d2                	xor    %edx,%edx
+ 89a:	e9 be fe ff ff       	jmp    75d <printf+0x4d>
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a9:	6a 01                	push   $0x1
+ 8ab:	e9 11 ff ff ff       	jmp    7c1 <printf+0xb1>
+ 8b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8b5:	bb d8 0c 00 00       	mov    $0xcd8,%ebx
+ 8ba:	e9 61 ff ff ff       	jmp    820 <printf+0x110>
+ 8bf:	90                   	nop
+
+000008c0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c3:	a1 e4 20 00 00       	mov    0x20e4,%eax
+{
+ 8c8:	89 e5                	mov    %esp,%ebp
+ 8ca:	56                   	push   %esi
+ 8cb:	53                   	push   %ebx
+ 8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d4:	39 ca                	cmp    %ecx,%edx
+ 8d6:	73 30                	jae    908 <lfree+0x48>
+ 8d8:	39 c1                	cmp    %eax,%ecx
+ 8da:	72 04                	jb     8e0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8dc:	39 c2                	cmp    %eax,%edx
+ 8de:	72 f0                	jb     8d0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8e0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 8e3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 8e6:	39 f0                	cmp    %esi,%eax
+ 8e8:	74 26                	je     910 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8ea:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8ec:	8b 42 04             	mov    0x4(%edx),%eax
+ 8ef:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 8f2:	39 d9                	cmp    %ebx,%ecx
+ 8f4:	74 30                	je     926 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8f6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8f8:	5b                   	pop    %ebx
+  freep = p;
+ 8f9:	89 15 e4 20 00 00    	mov    %edx,0x20e4
+}
+ 8ff:	5e                   	pop    %esi
+ 900:	5d                   	pop    %ebp
+ 901:	c3                   	ret
+ 902:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 908:	39 c1                	cmp    %eax,%ecx
+ 90a:	72 d0                	jb     8dc <lfree+0x1c>
+ 90c:	eb c2                	jmp    8d0 <lfree+0x10>
+ 90e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 910:	03 58 04             	add    0x4(%eax),%ebx
+ 913:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 916:	8b 02                	mov    (%edx),%eax
+ 918:	8b 00                	mov    (%eax),%eax
+ 91a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 91c:	8b 42 04             	mov    0x4(%edx),%eax
+ 91f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 922:	39 d9                	cmp    %ebx,%ecx
+ 924:	75 d0                	jne    8f6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 926:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 929:	89 15 e4 20 00 00    	mov    %edx,0x20e4
+    p->s.size += bp->s.size;
+ 92f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 932:	8b 09                	mov    (%ecx),%ecx
+ 934:	89 0a                	mov    %ecx,(%edx)
+}
+ 936:	5b                   	pop    %ebx
+ 937:	5e                   	pop    %esi
+ 938:	5d                   	pop    %ebp
+ 939:	c3                   	ret
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000940 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	89 c7                	mov    %eax,%edi
+ 946:	56                   	push   %esi
+ 947:	53                   	push   %ebx
+ 948:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 94b:	a1 e4 20 00 00       	mov    0x20e4,%eax
+ 950:	85 c0                	test   %eax,%eax
+ 952:	0f 84 88 00 00 00    	je     9e0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 958:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 95a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 95d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 962:	39 df                	cmp    %ebx,%edi
+ 964:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 967:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 96e:	39 f9                	cmp    %edi,%ecx
+ 970:	72 0f                	jb     981 <lalloc+0x41>
+ 972:	eb 4c                	jmp    9c0 <lalloc+0x80>
+ 974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 978:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 97a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 97d:	39 f9                	cmp    %edi,%ecx
+ 97f:	73 3f                	jae    9c0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 981:	89 d0                	mov    %edx,%eax
+ 983:	39 15 e4 20 00 00    	cmp    %edx,0x20e4
+ 989:	75 ed                	jne    978 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 98b:	83 ec 0c             	sub    $0xc,%esp
+ 98e:	56                   	push   %esi
+ 98f:	e8 07 fc ff ff       	call   59b <sbrk>
+  if(p == (char*)-1)
+ 994:	83 c4 10             	add    $0x10,%esp
+ 997:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 99a:	74 11                	je     9ad <lalloc+0x6d>
+  hp->s.size = nu;
+ 99c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 99f:	e8 1c ff ff ff       	call   8c0 <lfree>
+  return freep;
+ 9a4:	a1 e4 20 00 00       	mov    0x20e4,%eax
+      if((p = morecore(nunits)) == 0)
+ 9a9:	85 c0                	test   %eax,%eax
+ 9ab:	75 cb                	jne    978 <lalloc+0x38>
+        return 0;
+  }
+}
+ 9ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9b0:	31 d2                	xor    %edx,%edx
+}
+ 9b2:	5b                   	pop    %ebx
+ 9b3:	89 d0                	mov    %edx,%eax
+ 9b5:	5e                   	pop    %esi
+ 9b6:	5f                   	pop    %edi
+ 9b7:	5d                   	pop    %ebp
+ 9b8:	c3                   	ret
+ 9b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 9c0:	39 cf                	cmp    %ecx,%edi
+ 9c2:	74 4c                	je     a10 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 9c4:	29 f9                	sub    %edi,%ecx
+ 9c6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 9c9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 9cc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 9cf:	a3 e4 20 00 00       	mov    %eax,0x20e4
+}
+ 9d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9d7:	89 d0                	mov    %edx,%eax
+ 9d9:	5b                   	pop    %ebx
+ 9da:	5e                   	pop    %esi
+ 9db:	5f                   	pop    %edi
+ 9dc:	5d                   	pop    %ebp
+ 9dd:	c3                   	ret
+ 9de:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 9e0:	ba e8 20 00 00       	mov    $0x20e8,%edx
+ 9e5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 9e7:	c7 05 e4 20 00 00 e8 	movl   $0x20e8,0x20e4
+ 9ee:	20 00 00 
+ 9f1:	c7 05 e8 20 00 00 e8 	movl   $0x20e8,0x20e8
+ 9f8:	20 00 00 
+ 9fb:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 9fd:	c7 05 ec 20 00 00 00 	movl   $0x0,0x20ec
+ a04:	00 00 00 
+ a07:	e9 51 ff ff ff       	jmp    95d <lalloc+0x1d>
+ a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ a10:	8b 0a                	mov    (%edx),%ecx
+ a12:	89 08                	mov    %ecx,(%eax)
+ a14:	eb b9                	jmp    9cf <lalloc+0x8f>
+ a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a20 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ a29:	85 f6                	test   %esi,%esi
+ a2b:	74 42                	je     a6f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ a2d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ a30:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ a33:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ a39:	77 3d                	ja     a78 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ a3b:	31 c9                	xor    %ecx,%ecx
+ a3d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ a42:	83 fa 02             	cmp    $0x2,%edx
+ a45:	74 17                	je     a5e <free+0x3e>
+ a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4e:	66 90                	xchg   %ax,%ax
+ a50:	83 c1 01             	add    $0x1,%ecx
+ a53:	89 d8                	mov    %ebx,%eax
+ a55:	d3 e0                	shl    %cl,%eax
+ a57:	83 c0 01             	add    $0x1,%eax
+ a5a:	39 c2                	cmp    %eax,%edx
+ a5c:	75 f2                	jne    a50 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ a5e:	8b 04 8d c0 20 00 00 	mov    0x20c0(,%ecx,4),%eax
+  classes[c] = bp;
+ a65:	89 3c 8d c0 20 00 00 	mov    %edi,0x20c0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ a6c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ a6f:	5b                   	pop    %ebx
+ a70:	5e                   	pop    %esi
+ a71:	5f                   	pop    %edi
+ a72:	5d                   	pop    %ebp
+ a73:	c3                   	ret
+ a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a78:	5b                   	pop    %ebx
+    lfree(bp);
+ a79:	89 f8                	mov    %edi,%eax
+}
+ a7b:	5e                   	pop    %esi
+ a7c:	5f                   	pop    %edi
+ a7d:	5d                   	pop    %ebp
+    lfree(bp);
+ a7e:	e9 3d fe ff ff       	jmp    8c0 <lfree>
+ a83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a90 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a99:	8b 45 08             	mov    0x8(%ebp),%eax
+ a9c:	83 c0 07             	add    $0x7,%eax
+ a9f:	c1 e8 03             	shr    $0x3,%eax
+ aa2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ aa5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ aaa:	77 44                	ja     af0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ aac:	31 c9                	xor    %ecx,%ecx
+ aae:	ba 01 00 00 00       	mov    $0x1,%edx
+ ab3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ ab8:	83 f8 02             	cmp    $0x2,%eax
+ abb:	76 11                	jbe    ace <malloc+0x3e>
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+ ac0:	83 c1 01             	add    $0x1,%ecx
+ ac3:	89 d3                	mov    %edx,%ebx
+ ac5:	d3 e3                	shl    %cl,%ebx
+ ac7:	83 c3 01             	add    $0x1,%ebx
+ aca:	39 c3                	cmp    %eax,%ebx
+ acc:	72 f2                	jb     ac0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ ace:	8b 04 8d c0 20 00 00 	mov    0x20c0(,%ecx,4),%eax
+ ad5:	85 c0                	test   %eax,%eax
+ ad7:	74 2f                	je     b08 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ ad9:	8b 10                	mov    (%eax),%edx
+ adb:	89 14 8d c0 20 00 00 	mov    %edx,0x20c0(,%ecx,4)
+  return (void*)(p + 1);
+ ae2:	83 c0 08             	add    $0x8,%eax
+}
+ ae5:	83 c4 1c             	add    $0x1c,%esp
+ ae8:	5b                   	pop    %ebx
+ ae9:	5e                   	pop    %esi
+ aea:	5f                   	pop    %edi
+ aeb:	5d                   	pop    %ebp
+ aec:	c3                   	ret
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ af0:	e8 4b fe ff ff       	call   940 <lalloc>
+ af5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ af7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ afa:	85 d2                	test   %edx,%edx
+ afc:	75 e7                	jne    ae5 <malloc+0x55>
+      return 0;
+ afe:	31 c0                	xor    %eax,%eax
+ b00:	eb e3                	jmp    ae5 <malloc+0x55>
+ b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ b08:	31 d2                	xor    %edx,%edx
+ b0a:	b8 00 02 00 00       	mov    $0x200,%eax
+ b0f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b12:	f7 f3                	div    %ebx
+  if(n < 4)
+ b14:	ba 04 00 00 00       	mov    $0x4,%edx
+ b19:	89 d6                	mov    %edx,%esi
+ b1b:	39 d0                	cmp    %edx,%eax
+ b1d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ b20:	0f af f3             	imul   %ebx,%esi
+ b23:	89 f0                	mov    %esi,%eax
+ b25:	e8 16 fe ff ff       	call   940 <lalloc>
+ b2a:	85 c0                	test   %eax,%eax
+ b2c:	74 d0                	je     afe <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ b2e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b31:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ b34:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b3b:	8b 14 8d c0 20 00 00 	mov    0x20c0(,%ecx,4),%edx
+ b42:	39 f8                	cmp    %edi,%eax
+ b44:	73 22                	jae    b68 <malloc+0xd8>
+ b46:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b49:	eb 09                	jmp    b54 <malloc+0xc4>
+ b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+ b50:	89 c2                	mov    %eax,%edx
+ b52:	89 c8                	mov    %ecx,%eax
+ b54:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ b57:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ b5a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ b5c:	39 f9                	cmp    %edi,%ecx
+ b5e:	72 f0                	jb     b50 <malloc+0xc0>
+ b60:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b63:	e9 73 ff ff ff       	jmp    adb <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ b68:	89 d0                	mov    %edx,%eax
+ b6a:	8b 12                	mov    (%edx),%edx
+ b6c:	e9 6a ff ff ff       	jmp    adb <malloc+0x4b>
+ b71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+
+00000b80 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	56                   	push   %esi
+ b84:	53                   	push   %ebx
+ b85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ b88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ b8b:	85 c9                	test   %ecx,%ecx
+ b8d:	74 06                	je     b95 <calloc+0x15>
+ b8f:	89 c8                	mov    %ecx,%eax
+ b91:	f7 e3                	mul    %ebx
+ b93:	70 33                	jo     bc8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ b95:	0f af d9             	imul   %ecx,%ebx
+ b98:	83 ec 0c             	sub    $0xc,%esp
+ b9b:	53                   	push   %ebx
+ b9c:	e8 ef fe ff ff       	call   a90 <malloc>
+ ba1:	83 c4 10             	add    $0x10,%esp
+ ba4:	89 c6                	mov    %eax,%esi
+ ba6:	85 c0                	test   %eax,%eax
+ ba8:	74 1e                	je     bc8 <calloc+0x48>
+    memset(p, 0, n * size);
+ baa:	83 ec 04             	sub    $0x4,%esp
+ bad:	53                   	push   %ebx
+ bae:	6a 00                	push   $0x0
+ bb0:	50                   	push   %eax
+ bb1:	e8 3a f7 ff ff       	call   2f0 <memset>
+ bb6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ bb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bbc:	89 f0                	mov    %esi,%eax
+ bbe:	5b                   	pop    %ebx
+ bbf:	5e                   	pop    %esi
+ bc0:	5d                   	pop    %ebp
+ bc1:	c3                   	ret
+ bc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ bc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ bcb:	31 f6                	xor    %esi,%esi
+}
+ bcd:	89 f0                	mov    %esi,%eax
+ bcf:	5b                   	pop    %ebx
+ bd0:	5e                   	pop    %esi
+ bd1:	5d                   	pop    %ebp
+ bd2:	c3                   	ret
+ bd3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000be0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	56                   	push   %esi
+ be5:	53                   	push   %ebx
+ be6:	83 ec 0c             	sub    $0xc,%esp
+ be9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ bec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ bef:	85 db                	test   %ebx,%ebx
+ bf1:	74 55                	je     c48 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ bf3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ bf6:	89 de                	mov    %ebx,%esi
+ bf8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ bff:	39 c7                	cmp    %eax,%edi
+ c01:	72 0d                	jb     c10 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ c03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c06:	89 f0                	mov    %esi,%eax
+ c08:	5b                   	pop    %ebx
+ c09:	5e                   	pop    %esi
+ c0a:	5f                   	pop    %edi
+ c0b:	5d                   	pop    %ebp
+ c0c:	c3                   	ret
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ c10:	83 ec 0c             	sub    $0xc,%esp
+ c13:	50                   	push   %eax
+ c14:	e8 77 fe ff ff       	call   a90 <malloc>
+ c19:	83 c4 10             	add    $0x10,%esp
+ c1c:	89 c6                	mov    %eax,%esi
+ c1e:	85 c0                	test   %eax,%eax
+ c20:	74 e1                	je     c03 <realloc+0x23>
+  memmove(p, ap, have);
+ c22:	83 ec 04             	sub    $0x4,%esp
+ c25:	57                   	push   %edi
+ c26:	53                   	push   %ebx
+ c27:	50                   	push   %eax
+ c28:	e8 b3 f8 ff ff       	call   4e0 <memmove>
+  free(ap);
+ c2d:	89 1c 24             	mov    %ebx,(%esp)
+ c30:	e8 eb fd ff ff       	call   a20 <free>
+  return p;
+ c35:	83 c4 10             	add    $0x10,%esp
+}
+ c38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c3b:	89 f0                	mov    %esi,%eax
+ c3d:	5b                   	pop    %ebx
+ c3e:	5e                   	pop    %esi
+ c3f:	5f                   	pop    %edi
+ c40:	5d                   	pop    %ebp
+ c41:	c3                   	ret
+ c42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ c48:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ c4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c4e:	5b                   	pop    %ebx
+ c4f:	5e                   	pop    %esi
+ c50:	5f                   	pop    %edi
+ c51:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ c52:	e9 39 fe ff ff       	jmp    a90 <malloc>
@@ -0,0 +1,79 @@
+// Measure malloc and free: a LIFO loop of small blocks, then a
+// random mix of small and large blocks with many live at once,
+// which is where a single first-fit free list gets slow.  Also
+// checks that calloc zeroes and realloc keeps the contents.
+
+#include "types.h"
+#include "user.h"
+
+#define N     200000
+#define LIVE  1000
+
+static void *live[LIVE];
+static uint randstate = 1;
+
+static uint
+rand(void)
+{
+  randstate = randstate * 1664525 + 1013904223;
+  return randstate;
+}
+
+static void
+report(char *what, int t)
+{
+  if(t == 0)
+    t = 1;
+  printf(1, "%s: %d ops in %d ms, %d per ms\n", what, N, t, N / t);
+}
+
+static void
+check(void)
+{
+  char *p;
+  int i, bad;
+
+  bad = 0;
+  p = calloc(100, 10);
+  for(i = 0; i < 1000; i++){
+    if(p[i] != 0)
+      bad = 1;
+    p[i] = i;
+  }
+  p = realloc(p, 5000);
+  for(i = 0; i < 1000; i++)
+    if(p[i] != (char)i)
+      bad = 1;
+  free(p);
+  printf(1, "calloc/realloc: %s\n", bad ? "FAILED" : "ok");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, t;
+  uint n;
+
+  t = uptime();
+  for(i = 0; i < N; i++)
+    free(malloc(32));
+  report("small malloc/free", uptime() - t);
+
+  t = uptime();
+  for(i = 0; i < N; i++){
+    j = rand() % LIVE;
+    free(live[j]);
+    n = rand() % 8 == 0 ? 2048 + rand() % 8192 : 8 + rand() % 256;
+    if((live[j] = malloc(n)) == 0){
+      printf(2, "mallocbench: malloc %d failed\n", n);
+      exit();
+    }
+    *(char*)live[j] = 1;
+  }
+  report("mixed, 1000 live", uptime() - t);
+  for(i = 0; i < LIVE; i++)
+    free(live[i]);
+
+  check();
+  exit();
+}
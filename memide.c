@@ -12,11 +12,13 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
 
 extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
 
 static int disksize;
 static uchar *memdisk;
+static uint nreqs;
 
 void
 ideinit(void)
@@ -35,6 +37,7 @@ ideintr(void)
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_READA is set, release the buf when done.
 void
 iderw(struct buf *b)
 {
@@ -50,6 +53,7 @@ iderw(struct buf *b)
     panic("iderw: block out of range");
 
   p = memdisk + b->blockno*BSIZE;
+  nreqs++;
 
   if(b->flags & B_DIRTY){
     b->flags &= ~B_DIRTY;
@@ -57,4 +61,31 @@ iderw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  b->flags &= ~B_ASYNC;
+  if(b->flags & B_READA){
+    b->flags &= ~B_READA;
+    bdone(b);
+  }
+}
+
+// iderw() is done by the time it returns.
+void
+ideawait(struct buf *b)
+{
+}
+
+void
+idestat(struct iostat *st)
+{
+  st->diskreqs = nreqs;
+  st->diskblocks = nreqs;
+  safestrcpy(st->sched, "none", sizeof(st->sched));
+  st->nread = st->readlat = st->readmax = 0;
+  st->nwrite = st->writelat = st->writemax = 0;
+}
+
+int
+idesched(int n)
+{
+  return -1;
 }
@@ -0,0 +1,18 @@
+// Kinds of kernel page allocations, for accounting.
+#define KM_OTHER   0   // anything not listed below
+#define KM_USER    1   // user memory, including superpages
+#define KM_PGTBL   2   // page directories and page tables
+#define KM_KSTACK  3   // per-process kernel stacks
+#define KM_PIPE    4   // pipe buffers
+#define KM_BCACHE  5   // buffer cache data and headers
+#define NKM        6
+
+// Memory statistics, returned by the getmeminfo system call.
+// All counts are in 4KB pages.
+struct meminfo {
+  uint total;        // pages managed by kalloc
+  uint free;         // pages on the free list
+  uint spfree;       // pages in unused reserved superpages
+  uint physpages;    // pages of physical memory the kernel maps
+  uint used[NKM];    // pages allocated, by KM_* kind
+};
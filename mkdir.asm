@@ -0,0 +1,1684 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 87 03 00 00       	call   3cb <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 bf 0a 00 00       	push   $0xabf
+  53:	6a 02                	push   $0x2
+  55:	e8 06 05 00 00       	call   560 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 01 03 00 00       	call   363 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 a8 0a 00 00       	push   $0xaa8
+  69:	6a 02                	push   $0x2
+  6b:	e8 f0 04 00 00       	call   560 <printf>
+    exit();
+  70:	e8 ee 02 00 00       	call   363 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 be 01 00 00       	call   37b <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 91 01 00 00       	call   3a3 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 94 01 00 00       	call   3bb <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 5a 01 00 00       	call   38b <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	56                   	push   %esi
+ 254:	53                   	push   %ebx
+ 255:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 258:	0f b6 02             	movzbl (%edx),%eax
+ 25b:	3c 20                	cmp    $0x20,%al
+ 25d:	75 0c                	jne    26b <atoi+0x1b>
+ 25f:	90                   	nop
+ 260:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 264:	83 c2 01             	add    $0x1,%edx
+ 267:	3c 20                	cmp    $0x20,%al
+ 269:	74 f5                	je     260 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 26b:	3c 2d                	cmp    $0x2d,%al
+ 26d:	74 41                	je     2b0 <atoi+0x60>
+ 26f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 274:	3c 2b                	cmp    $0x2b,%al
+ 276:	74 3d                	je     2b5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 278:	0f be 0a             	movsbl (%edx),%ecx
+ 27b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 27e:	3c 09                	cmp    $0x9,%al
+ 280:	b8 00 00 00 00       	mov    $0x0,%eax
+ 285:	77 21                	ja     2a8 <atoi+0x58>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 290:	83 c2 01             	add    $0x1,%edx
+ 293:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 296:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 29a:	0f be 0a             	movsbl (%edx),%ecx
+ 29d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2a0:	80 fb 09             	cmp    $0x9,%bl
+ 2a3:	76 eb                	jbe    290 <atoi+0x40>
+  return sign*n;
+ 2a5:	0f af c6             	imul   %esi,%eax
+}
+ 2a8:	5b                   	pop    %ebx
+ 2a9:	5e                   	pop    %esi
+ 2aa:	5d                   	pop    %ebp
+ 2ab:	c3                   	ret
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2b5:	83 c2 01             	add    $0x1,%edx
+ 2b8:	eb be                	jmp    278 <atoi+0x28>
+ 2ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002c0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+ 2c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2c8:	0f b6 02             	movzbl (%edx),%eax
+ 2cb:	3c 20                	cmp    $0x20,%al
+ 2cd:	75 0c                	jne    2db <atoo+0x1b>
+ 2cf:	90                   	nop
+ 2d0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2d4:	83 c2 01             	add    $0x1,%edx
+ 2d7:	3c 20                	cmp    $0x20,%al
+ 2d9:	74 f5                	je     2d0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2db:	3c 2d                	cmp    $0x2d,%al
+ 2dd:	74 41                	je     320 <atoo+0x60>
+ 2df:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2e4:	3c 2b                	cmp    $0x2b,%al
+ 2e6:	74 3d                	je     325 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 2e8:	0f be 0a             	movsbl (%edx),%ecx
+ 2eb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2ee:	3c 07                	cmp    $0x7,%al
+ 2f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2f5:	77 1e                	ja     315 <atoo+0x55>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 307:	0f be 0a             	movsbl (%edx),%ecx
+ 30a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 30d:	80 fb 07             	cmp    $0x7,%bl
+ 310:	76 ee                	jbe    300 <atoo+0x40>
+  return sign*n;
+ 312:	0f af c6             	imul   %esi,%eax
+}
+ 315:	5b                   	pop    %ebx
+ 316:	5e                   	pop    %esi
+ 317:	5d                   	pop    %ebp
+ 318:	c3                   	ret
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 320:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 325:	83 c2 01             	add    $0x1,%edx
+ 328:	eb be                	jmp    2e8 <atoo+0x28>
+ 32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000330 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+
+0000035b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <exit>:
+SYSCALL(exit)
+ 363:	b8 02 00 00 00       	mov    $0x2,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <wait>:
+SYSCALL(wait)
+ 36b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <pipe>:
+SYSCALL(pipe)
+ 373:	b8 04 00 00 00       	mov    $0x4,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <read>:
+SYSCALL(read)
+ 37b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <write>:
+SYSCALL(write)
+ 383:	b8 10 00 00 00       	mov    $0x10,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <close>:
+SYSCALL(close)
+ 38b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <kill>:
+SYSCALL(kill)
+ 393:	b8 06 00 00 00       	mov    $0x6,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <exec>:
+SYSCALL(exec)
+ 39b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <open>:
+SYSCALL(open)
+ 3a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mknod>:
+SYSCALL(mknod)
+ 3ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <unlink>:
+SYSCALL(unlink)
+ 3b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <fstat>:
+SYSCALL(fstat)
+ 3bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <link>:
+SYSCALL(link)
+ 3c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mkdir>:
+SYSCALL(mkdir)
+ 3cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <chdir>:
+SYSCALL(chdir)
+ 3d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <dup>:
+SYSCALL(dup)
+ 3db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <getpid>:
+SYSCALL(getpid)
+ 3e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <sbrk>:
+SYSCALL(sbrk)
+ 3eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <sleep>:
+SYSCALL(sleep)
+ 3f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <uptime>:
+SYSCALL(uptime)
+ 3fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <superpages>:
+SYSCALL(superpages)
+ 403:	b8 23 00 00 00       	mov    $0x23,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mmap>:
+SYSCALL(mmap)
+ 40b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <munmap>:
+SYSCALL(munmap)
+ 413:	b8 25 00 00 00       	mov    $0x25,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <spawn>:
+SYSCALL(spawn)
+ 41b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <swapstat>:
+SYSCALL(swapstat)
+ 423:	b8 27 00 00 00       	mov    $0x27,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 42b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <iostat>:
+SYSCALL(iostat)
+ 433:	b8 29 00 00 00       	mov    $0x29,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <dropcache>:
+SYSCALL(dropcache)
+ 43b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <iosched>:
+SYSCALL(iosched)
+ 443:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <halt>:
+SYSCALL(halt)
+ 44b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <date>:
+SYSCALL(date)
+ 453:	b8 17 00 00 00       	mov    $0x17,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 45b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <getgid>:
+SYSCALL(getgid)
+ 463:	b8 19 00 00 00       	mov    $0x19,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <getppid>:
+SYSCALL(getppid)
+ 46b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <setuid>:
+SYSCALL(setuid)
+ 473:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <setgid>:
+SYSCALL(setgid)
+ 47b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getprocs>:
+SYSCALL(getprocs)
+ 483:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 48b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getpriority>:
+SYSCALL(getpriority)
+ 493:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 49b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <chown>:
+SYSCALL(chown)
+ 4a3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <chgrp>:
+SYSCALL(chgrp)
+ 4ab:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+ 4b3:	66 90                	xchg   %ax,%ax
+ 4b5:	66 90                	xchg   %ax,%ax
+ 4b7:	66 90                	xchg   %ax,%ax
+ 4b9:	66 90                	xchg   %ax,%ax
+ 4bb:	66 90                	xchg   %ax,%ax
+ 4bd:	66 90                	xchg   %ax,%ax
+ 4bf:	90                   	nop
+
+000004c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4c8:	89 d1                	mov    %edx,%ecx
+{
+ 4ca:	83 ec 3c             	sub    $0x3c,%esp
+ 4cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4d0:	85 d2                	test   %edx,%edx
+ 4d2:	0f 89 80 00 00 00    	jns    558 <printint+0x98>
+ 4d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4dc:	74 7a                	je     558 <printint+0x98>
+    x = -xx;
+ 4de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4e8:	31 f6                	xor    %esi,%esi
+ 4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4f0:	89 c8                	mov    %ecx,%eax
+ 4f2:	31 d2                	xor    %edx,%edx
+ 4f4:	89 f7                	mov    %esi,%edi
+ 4f6:	f7 f3                	div    %ebx
+ 4f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4fb:	0f b6 92 3c 0b 00 00 	movzbl 0xb3c(%edx),%edx
+ 502:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 506:	89 ca                	mov    %ecx,%edx
+ 508:	89 c1                	mov    %eax,%ecx
+ 50a:	39 da                	cmp    %ebx,%edx
+ 50c:	73 e2                	jae    4f0 <printint+0x30>
+  if(neg)
+ 50e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 511:	85 c0                	test   %eax,%eax
+ 513:	74 07                	je     51c <printint+0x5c>
+    buf[i++] = '-';
+ 515:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 51a:	89 f7                	mov    %esi,%edi
+ 51c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 51f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 522:	01 df                	add    %ebx,%edi
+ 524:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 528:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 52b:	83 ec 04             	sub    $0x4,%esp
+ 52e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 531:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 534:	6a 01                	push   $0x1
+ 536:	50                   	push   %eax
+ 537:	56                   	push   %esi
+ 538:	e8 46 fe ff ff       	call   383 <write>
+  while(--i >= 0)
+ 53d:	89 f8                	mov    %edi,%eax
+ 53f:	83 c4 10             	add    $0x10,%esp
+ 542:	83 ef 01             	sub    $0x1,%edi
+ 545:	39 d8                	cmp    %ebx,%eax
+ 547:	75 df                	jne    528 <printint+0x68>
+}
+ 549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 54c:	5b                   	pop    %ebx
+ 54d:	5e                   	pop    %esi
+ 54e:	5f                   	pop    %edi
+ 54f:	5d                   	pop    %ebp
+ 550:	c3                   	ret
+ 551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 558:	31 c0                	xor    %eax,%eax
+ 55a:	eb 89                	jmp    4e5 <printint+0x25>
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 569:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 56c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 56f:	0f b6 1e             	movzbl (%esi),%ebx
+ 572:	83 c6 01             	add    $0x1,%esi
+ 575:	84 db                	test   %bl,%bl
+ 577:	74 67                	je     5e0 <printf+0x80>
+ 579:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 57c:	31 d2                	xor    %edx,%edx
+ 57e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 581:	eb 34                	jmp    5b7 <printf+0x57>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 58b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 590:	83 f8 25             	cmp    $0x25,%eax
+ 593:	74 18                	je     5ad <printf+0x4d>
+  write(fd, &c, 1);
+ 595:	83 ec 04             	sub    $0x4,%esp
+ 598:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 59b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 59e:	6a 01                	push   $0x1
+ 5a0:	50                   	push   %eax
+ 5a1:	57                   	push   %edi
+ 5a2:	e8 dc fd ff ff       	call   383 <write>
+ 5a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 5b0:	83 c6 01             	add    $0x1,%esi
+ 5b3:	84 db                	test   %bl,%bl
+ 5b5:	74 29                	je     5e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ba:	85 d2                	test   %edx,%edx
+ 5bc:	74 ca                	je     588 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5be:	83 fa 25             	cmp    $0x25,%edx
+ 5c1:	75 ea                	jne    5ad <printf+0x4d>
+      if(c == 'd'){
+ 5c3:	83 f8 25             	cmp    $0x25,%eax
+ 5c6:	0f 84 24 01 00 00    	je     6f0 <printf+0x190>
+ 5cc:	83 e8 63             	sub    $0x63,%eax
+ 5cf:	83 f8 15             	cmp    $0x15,%eax
+ 5d2:	77 1c                	ja     5f0 <printf+0x90>
+ 5d4:	ff 24 85 e4 0a 00 00 	jmp    *0xae4(,%eax,4)
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5e3:	5b                   	pop    %ebx
+ 5e4:	5e                   	pop    %esi
+ 5e5:	5f                   	pop    %edi
+ 5e6:	5d                   	pop    %ebp
+ 5e7:	c3                   	ret
+ 5e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5fa:	6a 01                	push   $0x1
+ 5fc:	52                   	push   %edx
+ 5fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 600:	57                   	push   %edi
+ 601:	e8 7d fd ff ff       	call   383 <write>
+ 606:	83 c4 0c             	add    $0xc,%esp
+ 609:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60c:	6a 01                	push   $0x1
+ 60e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 611:	52                   	push   %edx
+ 612:	57                   	push   %edi
+ 613:	e8 6b fd ff ff       	call   383 <write>
+        putc(fd, c);
+ 618:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61b:	31 d2                	xor    %edx,%edx
+ 61d:	eb 8e                	jmp    5ad <printf+0x4d>
+ 61f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 620:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 62b:	8b 13                	mov    (%ebx),%edx
+ 62d:	6a 00                	push   $0x0
+ 62f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 631:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 634:	e8 87 fe ff ff       	call   4c0 <printint>
+        ap++;
+ 639:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 63c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63f:	31 d2                	xor    %edx,%edx
+ 641:	e9 67 ff ff ff       	jmp    5ad <printf+0x4d>
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 650:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 653:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 655:	83 c0 04             	add    $0x4,%eax
+ 658:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 65b:	85 db                	test   %ebx,%ebx
+ 65d:	0f 84 9d 00 00 00    	je     700 <printf+0x1a0>
+        while(*s != 0){
+ 663:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 666:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 668:	84 c0                	test   %al,%al
+ 66a:	0f 84 3d ff ff ff    	je     5ad <printf+0x4d>
+ 670:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 673:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 676:	89 de                	mov    %ebx,%esi
+ 678:	89 d3                	mov    %edx,%ebx
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 686:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 689:	6a 01                	push   $0x1
+ 68b:	53                   	push   %ebx
+ 68c:	57                   	push   %edi
+ 68d:	e8 f1 fc ff ff       	call   383 <write>
+        while(*s != 0){
+ 692:	0f b6 06             	movzbl (%esi),%eax
+ 695:	83 c4 10             	add    $0x10,%esp
+ 698:	84 c0                	test   %al,%al
+ 69a:	75 e4                	jne    680 <printf+0x120>
+      state = 0;
+ 69c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 07 ff ff ff       	jmp    5ad <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 01                	push   $0x1
+ 6bf:	e9 6b ff ff ff       	jmp    62f <printf+0xcf>
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6d9:	6a 01                	push   $0x1
+ 6db:	52                   	push   %edx
+ 6dc:	57                   	push   %edi
+ 6dd:	e8 a1 fc ff ff       	call   383 <write>
+        ap++;
+ 6e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6e8:	31 d2                	xor    %edx,%edx
+ 6ea:	e9 be fe ff ff       	jmp    5ad <printf+0x4d>
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	e9 11 ff ff ff       	jmp    611 <printf+0xb1>
+ 700:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 705:	bb db 0a 00 00       	mov    $0xadb,%ebx
+ 70a:	e9 61 ff ff ff       	jmp    670 <printf+0x110>
+ 70f:	90                   	nop
+
+00000710 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 713:	a1 24 0f 00 00       	mov    0xf24,%eax
+{
+ 718:	89 e5                	mov    %esp,%ebp
+ 71a:	56                   	push   %esi
+ 71b:	53                   	push   %ebx
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 720:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 722:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 724:	39 ca                	cmp    %ecx,%edx
+ 726:	73 30                	jae    758 <lfree+0x48>
+ 728:	39 c1                	cmp    %eax,%ecx
+ 72a:	72 04                	jb     730 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 72c:	39 c2                	cmp    %eax,%edx
+ 72e:	72 f0                	jb     720 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 730:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 733:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 736:	39 f0                	cmp    %esi,%eax
+ 738:	74 26                	je     760 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 73a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 73c:	8b 42 04             	mov    0x4(%edx),%eax
+ 73f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 742:	39 d9                	cmp    %ebx,%ecx
+ 744:	74 30                	je     776 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 746:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 748:	5b                   	pop    %ebx
+  freep = p;
+ 749:	89 15 24 0f 00 00    	mov    %edx,0xf24
+}
+ 74f:	5e                   	pop    %esi
+ 750:	5d                   	pop    %ebp
+ 751:	c3                   	ret
+ 752:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 758:	39 c1                	cmp    %eax,%ecx
+ 75a:	72 d0                	jb     72c <lfree+0x1c>
+ 75c:	eb c2                	jmp    720 <lfree+0x10>
+ 75e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 760:	03 58 04             	add    0x4(%eax),%ebx
+ 763:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 766:	8b 02                	mov    (%edx),%eax
+ 768:	8b 00                	mov    (%eax),%eax
+ 76a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 76c:	8b 42 04             	mov    0x4(%edx),%eax
+ 76f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 772:	39 d9                	cmp    %ebx,%ecx
+ 774:	75 d0                	jne    746 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 776:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 779:	89 15 24 0f 00 00    	mov    %edx,0xf24
+    p->s.size += bp->s.size;
+ 77f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 782:	8b 09                	mov    (%ecx),%ecx
+ 784:	89 0a                	mov    %ecx,(%edx)
+}
+ 786:	5b                   	pop    %ebx
+ 787:	5e                   	pop    %esi
+ 788:	5d                   	pop    %ebp
+ 789:	c3                   	ret
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000790 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	89 c7                	mov    %eax,%edi
+ 796:	56                   	push   %esi
+ 797:	53                   	push   %ebx
+ 798:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 79b:	a1 24 0f 00 00       	mov    0xf24,%eax
+ 7a0:	85 c0                	test   %eax,%eax
+ 7a2:	0f 84 88 00 00 00    	je     830 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 7aa:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 7ad:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7b2:	39 df                	cmp    %ebx,%edi
+ 7b4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7b7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 7be:	39 f9                	cmp    %edi,%ecx
+ 7c0:	72 0f                	jb     7d1 <lalloc+0x41>
+ 7c2:	eb 4c                	jmp    810 <lalloc+0x80>
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7c8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 7ca:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 7cd:	39 f9                	cmp    %edi,%ecx
+ 7cf:	73 3f                	jae    810 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 7d1:	89 d0                	mov    %edx,%eax
+ 7d3:	39 15 24 0f 00 00    	cmp    %edx,0xf24
+ 7d9:	75 ed                	jne    7c8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 7db:	83 ec 0c             	sub    $0xc,%esp
+ 7de:	56                   	push   %esi
+ 7df:	e8 07 fc ff ff       	call   3eb <sbrk>
+  if(p == (char*)-1)
+ 7e4:	83 c4 10             	add    $0x10,%esp
+ 7e7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7ea:	74 11                	je     7fd <lalloc+0x6d>
+  hp->s.size = nu;
+ 7ec:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 7ef:	e8 1c ff ff ff       	call   710 <lfree>
+  return freep;
+ 7f4:	a1 24 0f 00 00       	mov    0xf24,%eax
+      if((p = morecore(nunits)) == 0)
+ 7f9:	85 c0                	test   %eax,%eax
+ 7fb:	75 cb                	jne    7c8 <lalloc+0x38>
+        return 0;
+  }
+}
+ 7fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 800:	31 d2                	xor    %edx,%edx
+}
+ 802:	5b                   	pop    %ebx
+ 803:	89 d0                	mov    %edx,%eax
+ 805:	5e                   	pop    %esi
+ 806:	5f                   	pop    %edi
+ 807:	5d                   	pop    %ebp
+ 808:	c3                   	ret
+ 809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 810:	39 cf                	cmp    %ecx,%edi
+ 812:	74 4c                	je     860 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 814:	29 f9                	sub    %edi,%ecx
+ 816:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 819:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 81c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 81f:	a3 24 0f 00 00       	mov    %eax,0xf24
+}
+ 824:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 827:	89 d0                	mov    %edx,%eax
+ 829:	5b                   	pop    %ebx
+ 82a:	5e                   	pop    %esi
+ 82b:	5f                   	pop    %edi
+ 82c:	5d                   	pop    %ebp
+ 82d:	c3                   	ret
+ 82e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 830:	ba 28 0f 00 00       	mov    $0xf28,%edx
+ 835:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 837:	c7 05 24 0f 00 00 28 	movl   $0xf28,0xf24
+ 83e:	0f 00 00 
+ 841:	c7 05 28 0f 00 00 28 	movl   $0xf28,0xf28
+ 848:	0f 00 00 
+ 84b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 84d:	c7 05 2c 0f 00 00 00 	movl   $0x0,0xf2c
+ 854:	00 00 00 
+ 857:	e9 51 ff ff ff       	jmp    7ad <lalloc+0x1d>
+ 85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 860:	8b 0a                	mov    (%edx),%ecx
+ 862:	89 08                	mov    %ecx,(%eax)
+ 864:	eb b9                	jmp    81f <lalloc+0x8f>
+ 866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000870 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 879:	85 f6                	test   %esi,%esi
+ 87b:	74 42                	je     8bf <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 87d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 880:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 883:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 889:	77 3d                	ja     8c8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 88b:	31 c9                	xor    %ecx,%ecx
+ 88d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 892:	83 fa 02             	cmp    $0x2,%edx
+ 895:	74 17                	je     8ae <free+0x3e>
+ 897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89e:	66 90                	xchg   %ax,%ax
+ 8a0:	83 c1 01             	add    $0x1,%ecx
+ 8a3:	89 d8                	mov    %ebx,%eax
+ 8a5:	d3 e0                	shl    %cl,%eax
+ 8a7:	83 c0 01             	add    $0x1,%eax
+ 8aa:	39 c2                	cmp    %eax,%edx
+ 8ac:	75 f2                	jne    8a0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 8ae:	8b 04 8d 00 0f 00 00 	mov    0xf00(,%ecx,4),%eax
+  classes[c] = bp;
+ 8b5:	89 3c 8d 00 0f 00 00 	mov    %edi,0xf00(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 8bc:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 8bf:	5b                   	pop    %ebx
+ 8c0:	5e                   	pop    %esi
+ 8c1:	5f                   	pop    %edi
+ 8c2:	5d                   	pop    %ebp
+ 8c3:	c3                   	ret
+ 8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8c8:	5b                   	pop    %ebx
+    lfree(bp);
+ 8c9:	89 f8                	mov    %edi,%eax
+}
+ 8cb:	5e                   	pop    %esi
+ 8cc:	5f                   	pop    %edi
+ 8cd:	5d                   	pop    %ebp
+    lfree(bp);
+ 8ce:	e9 3d fe ff ff       	jmp    710 <lfree>
+ 8d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ec:	83 c0 07             	add    $0x7,%eax
+ 8ef:	c1 e8 03             	shr    $0x3,%eax
+ 8f2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 8f5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 8fa:	77 44                	ja     940 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 8fc:	31 c9                	xor    %ecx,%ecx
+ 8fe:	ba 01 00 00 00       	mov    $0x1,%edx
+ 903:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 908:	83 f8 02             	cmp    $0x2,%eax
+ 90b:	76 11                	jbe    91e <malloc+0x3e>
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+ 910:	83 c1 01             	add    $0x1,%ecx
+ 913:	89 d3                	mov    %edx,%ebx
+ 915:	d3 e3                	shl    %cl,%ebx
+ 917:	83 c3 01             	add    $0x1,%ebx
+ 91a:	39 c3                	cmp    %eax,%ebx
+ 91c:	72 f2                	jb     910 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 91e:	8b 04 8d 00 0f 00 00 	mov    0xf00(,%ecx,4),%eax
+ 925:	85 c0                	test   %eax,%eax
+ 927:	74 2f                	je     958 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 929:	8b 10                	mov    (%eax),%edx
+ 92b:	89 14 8d 00 0f 00 00 	mov    %edx,0xf00(,%ecx,4)
+  return (void*)(p + 1);
+ 932:	83 c0 08             	add    $0x8,%eax
+}
+ 935:	83 c4 1c             	add    $0x1c,%esp
+ 938:	5b                   	pop    %ebx
+ 939:	5e                   	pop    %esi
+ 93a:	5f                   	pop    %edi
+ 93b:	5d                   	pop    %ebp
+ 93c:	c3                   	ret
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 940:	e8 4b fe ff ff       	call   790 <lalloc>
+ 945:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 947:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 94a:	85 d2                	test   %edx,%edx
+ 94c:	75 e7                	jne    935 <malloc+0x55>
+      return 0;
+ 94e:	31 c0                	xor    %eax,%eax
+ 950:	eb e3                	jmp    935 <malloc+0x55>
+ 952:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 958:	31 d2                	xor    %edx,%edx
+ 95a:	b8 00 02 00 00       	mov    $0x200,%eax
+ 95f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 962:	f7 f3                	div    %ebx
+  if(n < 4)
+ 964:	ba 04 00 00 00       	mov    $0x4,%edx
+ 969:	89 d6                	mov    %edx,%esi
+ 96b:	39 d0                	cmp    %edx,%eax
+ 96d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 970:	0f af f3             	imul   %ebx,%esi
+ 973:	89 f0                	mov    %esi,%eax
+ 975:	e8 16 fe ff ff       	call   790 <lalloc>
+ 97a:	85 c0                	test   %eax,%eax
+ 97c:	74 d0                	je     94e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 97e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 981:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 984:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 98b:	8b 14 8d 00 0f 00 00 	mov    0xf00(,%ecx,4),%edx
+ 992:	39 f8                	cmp    %edi,%eax
+ 994:	73 22                	jae    9b8 <malloc+0xd8>
+ 996:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 999:	eb 09                	jmp    9a4 <malloc+0xc4>
+ 99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+ 9a0:	89 c2                	mov    %eax,%edx
+ 9a2:	89 c8                	mov    %ecx,%eax
+ 9a4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ 9a7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ 9aa:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ 9ac:	39 f9                	cmp    %edi,%ecx
+ 9ae:	72 f0                	jb     9a0 <malloc+0xc0>
+ 9b0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9b3:	e9 73 ff ff ff       	jmp    92b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ 9b8:	89 d0                	mov    %edx,%eax
+ 9ba:	8b 12                	mov    (%edx),%edx
+ 9bc:	e9 6a ff ff ff       	jmp    92b <malloc+0x4b>
+ 9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+
+000009d0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	56                   	push   %esi
+ 9d4:	53                   	push   %ebx
+ 9d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ 9db:	85 c9                	test   %ecx,%ecx
+ 9dd:	74 06                	je     9e5 <calloc+0x15>
+ 9df:	89 c8                	mov    %ecx,%eax
+ 9e1:	f7 e3                	mul    %ebx
+ 9e3:	70 33                	jo     a18 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ 9e5:	0f af d9             	imul   %ecx,%ebx
+ 9e8:	83 ec 0c             	sub    $0xc,%esp
+ 9eb:	53                   	push   %ebx
+ 9ec:	e8 ef fe ff ff       	call   8e0 <malloc>
+ 9f1:	83 c4 10             	add    $0x10,%esp
+ 9f4:	89 c6                	mov    %eax,%esi
+ 9f6:	85 c0                	test   %eax,%eax
+ 9f8:	74 1e                	je     a18 <calloc+0x48>
+    memset(p, 0, n * size);
+ 9fa:	83 ec 04             	sub    $0x4,%esp
+ 9fd:	53                   	push   %ebx
+ 9fe:	6a 00                	push   $0x0
+ a00:	50                   	push   %eax
+ a01:	e8 3a f7 ff ff       	call   140 <memset>
+ a06:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ a09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a0c:	89 f0                	mov    %esi,%eax
+ a0e:	5b                   	pop    %ebx
+ a0f:	5e                   	pop    %esi
+ a10:	5d                   	pop    %ebp
+ a11:	c3                   	ret
+ a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a1b:	31 f6                	xor    %esi,%esi
+}
+ a1d:	89 f0                	mov    %esi,%eax
+ a1f:	5b                   	pop    %ebx
+ a20:	5e                   	pop    %esi
+ a21:	5d                   	pop    %ebp
+ a22:	c3                   	ret
+ a23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a30 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	83 ec 0c             	sub    $0xc,%esp
+ a39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ a3f:	85 db                	test   %ebx,%ebx
+ a41:	74 55                	je     a98 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ a43:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ a46:	89 de                	mov    %ebx,%esi
+ a48:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ a4f:	39 c7                	cmp    %eax,%edi
+ a51:	72 0d                	jb     a60 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ a53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a56:	89 f0                	mov    %esi,%eax
+ a58:	5b                   	pop    %ebx
+ a59:	5e                   	pop    %esi
+ a5a:	5f                   	pop    %edi
+ a5b:	5d                   	pop    %ebp
+ a5c:	c3                   	ret
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ a60:	83 ec 0c             	sub    $0xc,%esp
+ a63:	50                   	push   %eax
+ a64:	e8 77 fe ff ff       	call   8e0 <malloc>
+ a69:	83 c4 10             	add    $0x10,%esp
+ a6c:	89 c6                	mov    %eax,%esi
+ a6e:	85 c0                	test   %eax,%eax
+ a70:	74 e1                	je     a53 <realloc+0x23>
+  memmove(p, ap, have);
+ a72:	83 ec 04             	sub    $0x4,%esp
+ a75:	57                   	push   %edi
+ a76:	53                   	push   %ebx
+ a77:	50                   	push   %eax
+ a78:	e8 b3 f8 ff ff       	call   330 <memmove>
+  free(ap);
+ a7d:	89 1c 24             	mov    %ebx,(%esp)
+ a80:	e8 eb fd ff ff       	call   870 <free>
+  return p;
+ a85:	83 c4 10             	add    $0x10,%esp
+}
+ a88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a8b:	89 f0                	mov    %esi,%eax
+ a8d:	5b                   	pop    %ebx
+ a8e:	5e                   	pop    %esi
+ a8f:	5f                   	pop    %edi
+ a90:	5d                   	pop    %ebp
+ a91:	c3                   	ret
+ a92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a98:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a9e:	5b                   	pop    %ebx
+ a9f:	5e                   	pop    %esi
+ aa0:	5f                   	pop    %edi
+ aa1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ aa2:	e9 39 fe ff ff       	jmp    8e0 <malloc>
@@ -101,6 +101,8 @@ main(int argc, char *argv[])
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.swapstart = xint(FSSIZE);
+  sb.nswap = xint(SWAPSIZE);
 
   printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
          nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
@@ -109,6 +111,11 @@ main(int argc, char *argv[])
 
   for(i = 0; i < FSSIZE; i++)
     wsect(i, zeroes);
+  // Swap space: leave it as a hole in the image.
+  if(ftruncate(fsfd, (off_t)(FSSIZE + SWAPSIZE) * BSIZE) < 0){
+    perror("ftruncate");
+    exit(1);
+  }
 
   memset(buf, 0, sizeof(buf));
   memmove(buf, &sb, sizeof(sb));
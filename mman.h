@@ -0,0 +1,10 @@
+// mmap() protection bits
+#define PROT_READ   0x1
+#define PROT_WRITE  0x2
+
+// mmap() flags
+#define MAP_SHARED  0x1   // stores reach the file
+#define MAP_PRIVATE 0x2   // stores go to a private copy
+#define MAP_ANON    0x4   // zero-filled memory, no file
+
+#define MAP_FAILED  ((void*)-1)
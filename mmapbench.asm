@@ -0,0 +1,1973 @@
+
+_mmapbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         buf[5000 % sizeof(buf)] == 'x' ? "ok" : "FAILED");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 20             	sub    $0x20,%esp
+  if((fd = open(FILE, O_CREATE|O_RDWR)) < 0){
+  14:	68 02 02 00 00       	push   $0x202
+  19:	68 92 0d 00 00       	push   $0xd92
+  1e:	e8 60 06 00 00       	call   683 <open>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	85 c0                	test   %eax,%eax
+  28:	0f 88 7c 02 00 00    	js     2aa <main+0x2aa>
+  2e:	89 c6                	mov    %eax,%esi
+  30:	bb 80 00 00 00       	mov    $0x80,%ebx
+  35:	8d 76 00             	lea    0x0(%esi),%esi
+    for(j = 0; j < sizeof(buf); j++)
+  38:	31 c0                	xor    %eax,%eax
+  3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      buf[j] = i + j;
+  40:	88 80 e0 12 00 00    	mov    %al,0x12e0(%eax)
+    for(j = 0; j < sizeof(buf); j++)
+  46:	83 c0 01             	add    $0x1,%eax
+  49:	3d 00 02 00 00       	cmp    $0x200,%eax
+  4e:	75 f0                	jne    40 <main+0x40>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+  50:	83 ec 04             	sub    $0x4,%esp
+  53:	68 00 02 00 00       	push   $0x200
+  58:	68 e0 12 00 00       	push   $0x12e0
+  5d:	56                   	push   %esi
+  5e:	e8 00 06 00 00       	call   663 <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	3d 00 02 00 00       	cmp    $0x200,%eax
+  6b:	0f 85 d2 02 00 00    	jne    343 <main+0x343>
+  for(i = 0; i < SIZE; i += sizeof(buf)){
+  71:	83 eb 01             	sub    $0x1,%ebx
+  74:	75 c2                	jne    38 <main+0x38>
+  close(fd);
+  76:	83 ec 0c             	sub    $0xc,%esp
+  uint rsum, msum;
+  int i, t0, t1, t2;
+
+  mkfile();
+  rsum = msum = 0;
+  t0 = uptime();
+  79:	bb 32 00 00 00       	mov    $0x32,%ebx
+  close(fd);
+  7e:	56                   	push   %esi
+  7f:	e8 e7 05 00 00       	call   66b <close>
+  t0 = uptime();
+  84:	e8 52 06 00 00       	call   6db <uptime>
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  fd = open(FILE, O_RDONLY);
+  8f:	83 ec 08             	sub    $0x8,%esp
+  sum = 0;
+  92:	31 f6                	xor    %esi,%esi
+  fd = open(FILE, O_RDONLY);
+  94:	6a 00                	push   $0x0
+  96:	68 92 0d 00 00       	push   $0xd92
+  9b:	e8 e3 05 00 00       	call   683 <open>
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  a0:	83 c4 10             	add    $0x10,%esp
+  fd = open(FILE, O_RDONLY);
+  a3:	89 c7                	mov    %eax,%edi
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  a5:	8d 76 00             	lea    0x0(%esi),%esi
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	68 e0 12 00 00       	push   $0x12e0
+  b5:	57                   	push   %edi
+  b6:	e8 a0 05 00 00       	call   65b <read>
+  bb:	83 c4 10             	add    $0x10,%esp
+  be:	85 c0                	test   %eax,%eax
+  c0:	7e 18                	jle    da <main+0xda>
+    for(i = 0; i < n; i++)
+  c2:	31 d2                	xor    %edx,%edx
+  c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      sum += (uchar)buf[i];
+  c8:	0f b6 8a e0 12 00 00 	movzbl 0x12e0(%edx),%ecx
+    for(i = 0; i < n; i++)
+  cf:	83 c2 01             	add    $0x1,%edx
+      sum += (uchar)buf[i];
+  d2:	01 ce                	add    %ecx,%esi
+    for(i = 0; i < n; i++)
+  d4:	39 c2                	cmp    %eax,%edx
+  d6:	75 f0                	jne    c8 <main+0xc8>
+  d8:	eb ce                	jmp    a8 <main+0xa8>
+  close(fd);
+  da:	83 ec 0c             	sub    $0xc,%esp
+  dd:	57                   	push   %edi
+  de:	e8 88 05 00 00       	call   66b <close>
+  for(i = 0; i < PASSES; i++)
+  e3:	83 c4 10             	add    $0x10,%esp
+  e6:	83 eb 01             	sub    $0x1,%ebx
+  e9:	75 a4                	jne    8f <main+0x8f>
+    rsum = readscan();
+  t1 = uptime();
+  eb:	e8 eb 05 00 00       	call   6db <uptime>
+  f0:	c7 45 e4 32 00 00 00 	movl   $0x32,-0x1c(%ebp)
+  f7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  fa:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  fd = open(FILE, O_RDONLY);
+  fd:	83 ec 08             	sub    $0x8,%esp
+ 100:	6a 00                	push   $0x0
+ 102:	68 92 0d 00 00       	push   $0xd92
+ 107:	e8 77 05 00 00       	call   683 <open>
+ 10c:	89 c6                	mov    %eax,%esi
+  p = mmap(0, SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+ 10e:	58                   	pop    %eax
+ 10f:	5a                   	pop    %edx
+ 110:	6a 00                	push   $0x0
+ 112:	56                   	push   %esi
+ 113:	6a 02                	push   $0x2
+ 115:	6a 01                	push   $0x1
+ 117:	68 00 00 01 00       	push   $0x10000
+ 11c:	6a 00                	push   $0x0
+ 11e:	e8 c8 05 00 00       	call   6eb <mmap>
+  if(p == MAP_FAILED){
+ 123:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+ 126:	89 c7                	mov    %eax,%edi
+  if(p == MAP_FAILED){
+ 128:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 12b:	0f 84 ff 01 00 00    	je     330 <main+0x330>
+ 131:	8d 88 00 00 01 00    	lea    0x10000(%eax),%ecx
+  sum = 0;
+ 137:	31 db                	xor    %ebx,%ebx
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sum += p[i];
+ 140:	0f b6 10             	movzbl (%eax),%edx
+  for(i = 0; i < SIZE; i++)
+ 143:	83 c0 01             	add    $0x1,%eax
+    sum += p[i];
+ 146:	01 d3                	add    %edx,%ebx
+  for(i = 0; i < SIZE; i++)
+ 148:	39 c1                	cmp    %eax,%ecx
+ 14a:	75 f4                	jne    140 <main+0x140>
+  munmap(p, SIZE);
+ 14c:	83 ec 08             	sub    $0x8,%esp
+ 14f:	68 00 00 01 00       	push   $0x10000
+ 154:	57                   	push   %edi
+ 155:	e8 99 05 00 00       	call   6f3 <munmap>
+  close(fd);
+ 15a:	89 34 24             	mov    %esi,(%esp)
+ 15d:	e8 09 05 00 00       	call   66b <close>
+  for(i = 0; i < PASSES; i++)
+ 162:	83 c4 10             	add    $0x10,%esp
+ 165:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 169:	75 92                	jne    fd <main+0xfd>
+    msum = mmapscan();
+  t2 = uptime();
+ 16b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+ 16e:	8b 75 d8             	mov    -0x28(%ebp),%esi
+ 171:	e8 65 05 00 00       	call   6db <uptime>
+  printf(1, "%d scans of %d KB: read() %d ms, mmap %d ms\n",
+ 176:	83 ec 08             	sub    $0x8,%esp
+ 179:	29 f8                	sub    %edi,%eax
+ 17b:	50                   	push   %eax
+ 17c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 17f:	29 c7                	sub    %eax,%edi
+ 181:	57                   	push   %edi
+ 182:	6a 40                	push   $0x40
+ 184:	6a 32                	push   $0x32
+ 186:	68 f0 0d 00 00       	push   $0xdf0
+ 18b:	6a 01                	push   $0x1
+ 18d:	e8 ae 06 00 00       	call   840 <printf>
+         PASSES, SIZE/1024, t1 - t0, t2 - t1);
+  if(rsum != msum)
+ 192:	83 c4 20             	add    $0x20,%esp
+ 195:	39 de                	cmp    %ebx,%esi
+ 197:	0f 85 f7 00 00 00    	jne    294 <main+0x294>
+  fd = open(FILE, O_RDWR);
+ 19d:	83 ec 08             	sub    $0x8,%esp
+ 1a0:	6a 02                	push   $0x2
+ 1a2:	68 92 0d 00 00       	push   $0xd92
+ 1a7:	e8 d7 04 00 00       	call   683 <open>
+  p = mmap(0, SIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+ 1ac:	5b                   	pop    %ebx
+ 1ad:	5f                   	pop    %edi
+ 1ae:	6a 00                	push   $0x0
+ 1b0:	50                   	push   %eax
+  fd = open(FILE, O_RDWR);
+ 1b1:	89 c6                	mov    %eax,%esi
+  p = mmap(0, SIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	6a 03                	push   $0x3
+ 1b7:	68 00 00 01 00       	push   $0x10000
+ 1bc:	6a 00                	push   $0x0
+ 1be:	e8 28 05 00 00       	call   6eb <mmap>
+  if(p == MAP_FAILED){
+ 1c3:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, SIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+ 1c6:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED){
+ 1c8:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 1cb:	0f 84 4c 01 00 00    	je     31d <main+0x31d>
+  p[5000] = 'x';
+ 1d1:	c6 80 88 13 00 00 78 	movb   $0x78,0x1388(%eax)
+  if(fork() == 0)
+ 1d8:	e8 5e 04 00 00       	call   63b <fork>
+ 1dd:	85 c0                	test   %eax,%eax
+ 1df:	0f 84 dc 00 00 00    	je     2c1 <main+0x2c1>
+  wait();
+ 1e5:	e8 61 04 00 00       	call   64b <wait>
+  printf(1, "shared mapping between processes: %s\n",
+ 1ea:	ba 88 0d 00 00       	mov    $0xd88,%edx
+ 1ef:	b8 8b 0d 00 00       	mov    $0xd8b,%eax
+ 1f4:	80 bb 89 13 00 00 79 	cmpb   $0x79,0x1389(%ebx)
+ 1fb:	0f 44 c2             	cmove  %edx,%eax
+ 1fe:	83 ec 04             	sub    $0x4,%esp
+ 201:	50                   	push   %eax
+ 202:	68 64 0e 00 00       	push   $0xe64
+ 207:	6a 01                	push   $0x1
+ 209:	e8 32 06 00 00       	call   840 <printf>
+  munmap(p, SIZE);
+ 20e:	58                   	pop    %eax
+ 20f:	5a                   	pop    %edx
+ 210:	68 00 00 01 00       	push   $0x10000
+ 215:	53                   	push   %ebx
+ 216:	e8 d8 04 00 00       	call   6f3 <munmap>
+  close(fd);
+ 21b:	89 34 24             	mov    %esi,(%esp)
+  fd = open(FILE, O_RDONLY);
+ 21e:	be 0a 00 00 00       	mov    $0xa,%esi
+  close(fd);
+ 223:	e8 43 04 00 00       	call   66b <close>
+  fd = open(FILE, O_RDONLY);
+ 228:	59                   	pop    %ecx
+ 229:	5b                   	pop    %ebx
+ 22a:	6a 00                	push   $0x0
+ 22c:	68 92 0d 00 00       	push   $0xd92
+ 231:	e8 4d 04 00 00       	call   683 <open>
+ 236:	83 c4 10             	add    $0x10,%esp
+ 239:	89 c3                	mov    %eax,%ebx
+    read(fd, buf, sizeof(buf));
+ 23b:	83 ec 04             	sub    $0x4,%esp
+ 23e:	68 00 02 00 00       	push   $0x200
+ 243:	68 e0 12 00 00       	push   $0x12e0
+ 248:	53                   	push   %ebx
+ 249:	e8 0d 04 00 00       	call   65b <read>
+  for(i = 0; i <= 5000 / sizeof(buf); i++)
+ 24e:	83 c4 10             	add    $0x10,%esp
+ 251:	83 ee 01             	sub    $0x1,%esi
+ 254:	75 e5                	jne    23b <main+0x23b>
+  close(fd);
+ 256:	83 ec 0c             	sub    $0xc,%esp
+ 259:	53                   	push   %ebx
+ 25a:	e8 0c 04 00 00       	call   66b <close>
+  printf(1, "shared mapping write-back: %s\n",
+ 25f:	83 c4 0c             	add    $0xc,%esp
+ 262:	ba 88 0d 00 00       	mov    $0xd88,%edx
+ 267:	80 3d 68 14 00 00 78 	cmpb   $0x78,0x1468
+ 26e:	b8 8b 0d 00 00       	mov    $0xd8b,%eax
+ 273:	0f 44 c2             	cmove  %edx,%eax
+ 276:	50                   	push   %eax
+ 277:	68 8c 0e 00 00       	push   $0xe8c
+ 27c:	6a 01                	push   $0x1
+ 27e:	e8 bd 05 00 00       	call   840 <printf>
+    printf(1, "mmapbench: checksums differ: %x %x\n", rsum, msum);
+  sharedtest();
+  unlink(FILE);
+ 283:	c7 04 24 92 0d 00 00 	movl   $0xd92,(%esp)
+ 28a:	e8 04 04 00 00       	call   693 <unlink>
+  exit();
+ 28f:	e8 af 03 00 00       	call   643 <exit>
+    printf(1, "mmapbench: checksums differ: %x %x\n", rsum, msum);
+ 294:	53                   	push   %ebx
+ 295:	56                   	push   %esi
+ 296:	68 20 0e 00 00       	push   $0xe20
+ 29b:	6a 01                	push   $0x1
+ 29d:	e8 9e 05 00 00       	call   840 <printf>
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	e9 f3 fe ff ff       	jmp    19d <main+0x19d>
+    printf(2, "mmapbench: cannot create %s\n", FILE);
+ 2aa:	53                   	push   %ebx
+ 2ab:	68 92 0d 00 00       	push   $0xd92
+ 2b0:	68 a0 0d 00 00       	push   $0xda0
+ 2b5:	6a 02                	push   $0x2
+ 2b7:	e8 84 05 00 00       	call   840 <printf>
+    exit();
+ 2bc:	e8 82 03 00 00       	call   643 <exit>
+  fd = open(FILE, O_RDWR);
+ 2c1:	57                   	push   %edi
+ 2c2:	57                   	push   %edi
+ 2c3:	6a 02                	push   $0x2
+ 2c5:	68 92 0d 00 00       	push   $0xd92
+ 2ca:	e8 b4 03 00 00       	call   683 <open>
+ 2cf:	89 c3                	mov    %eax,%ebx
+  q = mmap(0, SIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+ 2d1:	58                   	pop    %eax
+ 2d2:	5a                   	pop    %edx
+ 2d3:	6a 00                	push   $0x0
+ 2d5:	53                   	push   %ebx
+ 2d6:	6a 01                	push   $0x1
+ 2d8:	6a 03                	push   $0x3
+ 2da:	68 00 00 01 00       	push   $0x10000
+ 2df:	6a 00                	push   $0x0
+ 2e1:	e8 05 04 00 00       	call   6eb <mmap>
+  if(q == MAP_FAILED)
+ 2e6:	83 c4 20             	add    $0x20,%esp
+ 2e9:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 2ec:	74 2a                	je     318 <main+0x318>
+  if(q[5000] == 'x')
+ 2ee:	80 b8 88 13 00 00 78 	cmpb   $0x78,0x1388(%eax)
+ 2f5:	75 07                	jne    2fe <main+0x2fe>
+    q[5001] = 'y';
+ 2f7:	c6 80 89 13 00 00 79 	movb   $0x79,0x1389(%eax)
+  munmap(q, SIZE);
+ 2fe:	56                   	push   %esi
+ 2ff:	56                   	push   %esi
+ 300:	68 00 00 01 00       	push   $0x10000
+ 305:	50                   	push   %eax
+ 306:	e8 e8 03 00 00       	call   6f3 <munmap>
+  close(fd);
+ 30b:	89 1c 24             	mov    %ebx,(%esp)
+ 30e:	e8 58 03 00 00       	call   66b <close>
+  exit();
+ 313:	e8 2b 03 00 00       	call   643 <exit>
+    exit();
+ 318:	e8 26 03 00 00       	call   643 <exit>
+    printf(2, "mmapbench: shared mmap failed\n");
+ 31d:	51                   	push   %ecx
+ 31e:	51                   	push   %ecx
+ 31f:	68 44 0e 00 00       	push   $0xe44
+ 324:	6a 02                	push   $0x2
+ 326:	e8 15 05 00 00       	call   840 <printf>
+    exit();
+ 32b:	e8 13 03 00 00       	call   643 <exit>
+    printf(2, "mmapbench: mmap failed\n");
+ 330:	50                   	push   %eax
+ 331:	50                   	push   %eax
+ 332:	68 d6 0d 00 00       	push   $0xdd6
+ 337:	6a 02                	push   $0x2
+ 339:	e8 02 05 00 00       	call   840 <printf>
+    exit();
+ 33e:	e8 00 03 00 00       	call   643 <exit>
+      printf(2, "mmapbench: write failed\n");
+ 343:	51                   	push   %ecx
+ 344:	51                   	push   %ecx
+ 345:	68 bd 0d 00 00       	push   $0xdbd
+ 34a:	6a 02                	push   $0x2
+ 34c:	e8 ef 04 00 00       	call   840 <printf>
+      exit();
+ 351:	e8 ed 02 00 00       	call   643 <exit>
+ 356:	66 90                	xchg   %ax,%ax
+ 358:	66 90                	xchg   %ax,%ax
+ 35a:	66 90                	xchg   %ax,%ax
+ 35c:	66 90                	xchg   %ax,%ax
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 360:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 361:	31 c0                	xor    %eax,%eax
+{
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	53                   	push   %ebx
+ 366:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 369:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 370:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 374:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 377:	83 c0 01             	add    $0x1,%eax
+ 37a:	84 d2                	test   %dl,%dl
+ 37c:	75 f2                	jne    370 <strcpy+0x10>
+    ;
+  return os;
+}
+ 37e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 381:	89 c8                	mov    %ecx,%eax
+ 383:	c9                   	leave
+ 384:	c3                   	ret
+ 385:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+ 397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 39a:	0f b6 02             	movzbl (%edx),%eax
+ 39d:	84 c0                	test   %al,%al
+ 39f:	75 17                	jne    3b8 <strcmp+0x28>
+ 3a1:	eb 3a                	jmp    3dd <strcmp+0x4d>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+ 3a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ac:	83 c2 01             	add    $0x1,%edx
+ 3af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3b2:	84 c0                	test   %al,%al
+ 3b4:	74 1a                	je     3d0 <strcmp+0x40>
+    p++, q++;
+ 3b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3bb:	38 c3                	cmp    %al,%bl
+ 3bd:	74 e9                	je     3a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3bf:	29 d8                	sub    %ebx,%eax
+}
+ 3c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c4:	c9                   	leave
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3d4:	31 c0                	xor    %eax,%eax
+ 3d6:	29 d8                	sub    %ebx,%eax
+}
+ 3d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3db:	c9                   	leave
+ 3dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3e0:	31 c0                	xor    %eax,%eax
+ 3e2:	eb db                	jmp    3bf <strcmp+0x2f>
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3f9:	74 15                	je     410 <strlen+0x20>
+ 3fb:	31 c0                	xor    %eax,%eax
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 400:	83 c0 01             	add    $0x1,%eax
+ 403:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 407:	89 c1                	mov    %eax,%ecx
+ 409:	75 f5                	jne    400 <strlen+0x10>
+    ;
+  return n;
+}
+ 40b:	89 c8                	mov    %ecx,%eax
+ 40d:	5d                   	pop    %ebp
+ 40e:	c3                   	ret
+ 40f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 410:	31 c9                	xor    %ecx,%ecx
+}
+ 412:	5d                   	pop    %ebp
+ 413:	89 c8                	mov    %ecx,%eax
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000420 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 427:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 42a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 42d:	89 d7                	mov    %edx,%edi
+ 42f:	fc                   	cld
+ 430:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 432:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 435:	89 d0                	mov    %edx,%eax
+ 437:	c9                   	leave
+ 438:	c3                   	ret
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 44a:	0f b6 10             	movzbl (%eax),%edx
+ 44d:	84 d2                	test   %dl,%dl
+ 44f:	75 12                	jne    463 <strchr+0x23>
+ 451:	eb 1d                	jmp    470 <strchr+0x30>
+ 453:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 457:	90                   	nop
+ 458:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 45c:	83 c0 01             	add    $0x1,%eax
+ 45f:	84 d2                	test   %dl,%dl
+ 461:	74 0d                	je     470 <strchr+0x30>
+    if(*s == c)
+ 463:	38 d1                	cmp    %dl,%cl
+ 465:	75 f1                	jne    458 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 467:	5d                   	pop    %ebp
+ 468:	c3                   	ret
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 470:	31 c0                	xor    %eax,%eax
+}
+ 472:	5d                   	pop    %ebp
+ 473:	c3                   	ret
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 485:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 488:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 489:	31 db                	xor    %ebx,%ebx
+{
+ 48b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 48e:	eb 27                	jmp    4b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 490:	83 ec 04             	sub    $0x4,%esp
+ 493:	6a 01                	push   $0x1
+ 495:	56                   	push   %esi
+ 496:	6a 00                	push   $0x0
+ 498:	e8 be 01 00 00       	call   65b <read>
+    if(cc < 1)
+ 49d:	83 c4 10             	add    $0x10,%esp
+ 4a0:	85 c0                	test   %eax,%eax
+ 4a2:	7e 1d                	jle    4c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4af:	3c 0a                	cmp    $0xa,%al
+ 4b1:	74 10                	je     4c3 <gets+0x43>
+ 4b3:	3c 0d                	cmp    $0xd,%al
+ 4b5:	74 0c                	je     4c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4b7:	89 df                	mov    %ebx,%edi
+ 4b9:	83 c3 01             	add    $0x1,%ebx
+ 4bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4bf:	7c cf                	jl     490 <gets+0x10>
+ 4c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4cd:	5b                   	pop    %ebx
+ 4ce:	5e                   	pop    %esi
+ 4cf:	5f                   	pop    %edi
+ 4d0:	5d                   	pop    %ebp
+ 4d1:	c3                   	ret
+ 4d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	56                   	push   %esi
+ 4e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4e5:	83 ec 08             	sub    $0x8,%esp
+ 4e8:	6a 00                	push   $0x0
+ 4ea:	ff 75 08             	push   0x8(%ebp)
+ 4ed:	e8 91 01 00 00       	call   683 <open>
+  if(fd < 0)
+ 4f2:	83 c4 10             	add    $0x10,%esp
+ 4f5:	85 c0                	test   %eax,%eax
+ 4f7:	78 27                	js     520 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4f9:	83 ec 08             	sub    $0x8,%esp
+ 4fc:	ff 75 0c             	push   0xc(%ebp)
+ 4ff:	89 c3                	mov    %eax,%ebx
+ 501:	50                   	push   %eax
+ 502:	e8 94 01 00 00       	call   69b <fstat>
+  close(fd);
+ 507:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 50a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 50c:	e8 5a 01 00 00       	call   66b <close>
+  return r;
+ 511:	83 c4 10             	add    $0x10,%esp
+}
+ 514:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 517:	89 f0                	mov    %esi,%eax
+ 519:	5b                   	pop    %ebx
+ 51a:	5e                   	pop    %esi
+ 51b:	5d                   	pop    %ebp
+ 51c:	c3                   	ret
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 520:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 525:	eb ed                	jmp    514 <stat+0x34>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+
+00000530 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	56                   	push   %esi
+ 534:	53                   	push   %ebx
+ 535:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 538:	0f b6 02             	movzbl (%edx),%eax
+ 53b:	3c 20                	cmp    $0x20,%al
+ 53d:	75 0c                	jne    54b <atoi+0x1b>
+ 53f:	90                   	nop
+ 540:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 544:	83 c2 01             	add    $0x1,%edx
+ 547:	3c 20                	cmp    $0x20,%al
+ 549:	74 f5                	je     540 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 54b:	3c 2d                	cmp    $0x2d,%al
+ 54d:	74 41                	je     590 <atoi+0x60>
+ 54f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 554:	3c 2b                	cmp    $0x2b,%al
+ 556:	74 3d                	je     595 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 558:	0f be 0a             	movsbl (%edx),%ecx
+ 55b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 55e:	3c 09                	cmp    $0x9,%al
+ 560:	b8 00 00 00 00       	mov    $0x0,%eax
+ 565:	77 21                	ja     588 <atoi+0x58>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 570:	83 c2 01             	add    $0x1,%edx
+ 573:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 576:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 57a:	0f be 0a             	movsbl (%edx),%ecx
+ 57d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 580:	80 fb 09             	cmp    $0x9,%bl
+ 583:	76 eb                	jbe    570 <atoi+0x40>
+  return sign*n;
+ 585:	0f af c6             	imul   %esi,%eax
+}
+ 588:	5b                   	pop    %ebx
+ 589:	5e                   	pop    %esi
+ 58a:	5d                   	pop    %ebp
+ 58b:	c3                   	ret
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 590:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 595:	83 c2 01             	add    $0x1,%edx
+ 598:	eb be                	jmp    558 <atoi+0x28>
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005a0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	56                   	push   %esi
+ 5a4:	53                   	push   %ebx
+ 5a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 5a8:	0f b6 02             	movzbl (%edx),%eax
+ 5ab:	3c 20                	cmp    $0x20,%al
+ 5ad:	75 0c                	jne    5bb <atoo+0x1b>
+ 5af:	90                   	nop
+ 5b0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 5b4:	83 c2 01             	add    $0x1,%edx
+ 5b7:	3c 20                	cmp    $0x20,%al
+ 5b9:	74 f5                	je     5b0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 5bb:	3c 2d                	cmp    $0x2d,%al
+ 5bd:	74 41                	je     600 <atoo+0x60>
+ 5bf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 5c4:	3c 2b                	cmp    $0x2b,%al
+ 5c6:	74 3d                	je     605 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 5c8:	0f be 0a             	movsbl (%edx),%ecx
+ 5cb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 5ce:	3c 07                	cmp    $0x7,%al
+ 5d0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 5d5:	77 1e                	ja     5f5 <atoo+0x55>
+ 5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5de:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 5e0:	83 c2 01             	add    $0x1,%edx
+ 5e3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 5e7:	0f be 0a             	movsbl (%edx),%ecx
+ 5ea:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 5ed:	80 fb 07             	cmp    $0x7,%bl
+ 5f0:	76 ee                	jbe    5e0 <atoo+0x40>
+  return sign*n;
+ 5f2:	0f af c6             	imul   %esi,%eax
+}
+ 5f5:	5b                   	pop    %ebx
+ 5f6:	5e                   	pop    %esi
+ 5f7:	5d                   	pop    %ebp
+ 5f8:	c3                   	ret
+ 5f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 600:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 605:	83 c2 01             	add    $0x1,%edx
+ 608:	eb be                	jmp    5c8 <atoo+0x28>
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000610 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	8b 45 10             	mov    0x10(%ebp),%eax
+ 618:	8b 55 08             	mov    0x8(%ebp),%edx
+ 61b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 61e:	85 c0                	test   %eax,%eax
+ 620:	7e 13                	jle    635 <memmove+0x25>
+ 622:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 624:	89 d7                	mov    %edx,%edi
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 630:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 631:	39 f8                	cmp    %edi,%eax
+ 633:	75 fb                	jne    630 <memmove+0x20>
+  return vdst;
+}
+ 635:	5e                   	pop    %esi
+ 636:	89 d0                	mov    %edx,%eax
+ 638:	5f                   	pop    %edi
+ 639:	5d                   	pop    %ebp
+ 63a:	c3                   	ret
+
+0000063b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 63b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <exit>:
+SYSCALL(exit)
+ 643:	b8 02 00 00 00       	mov    $0x2,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <wait>:
+SYSCALL(wait)
+ 64b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <pipe>:
+SYSCALL(pipe)
+ 653:	b8 04 00 00 00       	mov    $0x4,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <read>:
+SYSCALL(read)
+ 65b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <write>:
+SYSCALL(write)
+ 663:	b8 10 00 00 00       	mov    $0x10,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <close>:
+SYSCALL(close)
+ 66b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <kill>:
+SYSCALL(kill)
+ 673:	b8 06 00 00 00       	mov    $0x6,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <exec>:
+SYSCALL(exec)
+ 67b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <open>:
+SYSCALL(open)
+ 683:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <mknod>:
+SYSCALL(mknod)
+ 68b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <unlink>:
+SYSCALL(unlink)
+ 693:	b8 12 00 00 00       	mov    $0x12,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <fstat>:
+SYSCALL(fstat)
+ 69b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <link>:
+SYSCALL(link)
+ 6a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <mkdir>:
+SYSCALL(mkdir)
+ 6ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <chdir>:
+SYSCALL(chdir)
+ 6b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <dup>:
+SYSCALL(dup)
+ 6bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <getpid>:
+SYSCALL(getpid)
+ 6c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <sbrk>:
+SYSCALL(sbrk)
+ 6cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <sleep>:
+SYSCALL(sleep)
+ 6d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <uptime>:
+SYSCALL(uptime)
+ 6db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <superpages>:
+SYSCALL(superpages)
+ 6e3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <mmap>:
+SYSCALL(mmap)
+ 6eb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <munmap>:
+SYSCALL(munmap)
+ 6f3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <spawn>:
+SYSCALL(spawn)
+ 6fb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <swapstat>:
+SYSCALL(swapstat)
+ 703:	b8 27 00 00 00       	mov    $0x27,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 70b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <iostat>:
+SYSCALL(iostat)
+ 713:	b8 29 00 00 00       	mov    $0x29,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <dropcache>:
+SYSCALL(dropcache)
+ 71b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <iosched>:
+SYSCALL(iosched)
+ 723:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <halt>:
+SYSCALL(halt)
+ 72b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <date>:
+SYSCALL(date)
+ 733:	b8 17 00 00 00       	mov    $0x17,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 73b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <getgid>:
+SYSCALL(getgid)
+ 743:	b8 19 00 00 00       	mov    $0x19,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <getppid>:
+SYSCALL(getppid)
+ 74b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <setuid>:
+SYSCALL(setuid)
+ 753:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <setgid>:
+SYSCALL(setgid)
+ 75b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <getprocs>:
+SYSCALL(getprocs)
+ 763:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 76b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <getpriority>:
+SYSCALL(getpriority)
+ 773:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 77b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <chown>:
+SYSCALL(chown)
+ 783:	b8 21 00 00 00       	mov    $0x21,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <chgrp>:
+SYSCALL(chgrp)
+ 78b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+ 793:	66 90                	xchg   %ax,%ax
+ 795:	66 90                	xchg   %ax,%ax
+ 797:	66 90                	xchg   %ax,%ax
+ 799:	66 90                	xchg   %ax,%ax
+ 79b:	66 90                	xchg   %ax,%ax
+ 79d:	66 90                	xchg   %ax,%ax
+ 79f:	90                   	nop
+
+000007a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7a8:	89 d1                	mov    %edx,%ecx
+{
+ 7aa:	83 ec 3c             	sub    $0x3c,%esp
+ 7ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7b0:	85 d2                	test   %edx,%edx
+ 7b2:	0f 89 80 00 00 00    	jns    838 <printint+0x98>
+ 7b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7bc:	74 7a                	je     838 <printint+0x98>
+    x = -xx;
+ 7be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7c8:	31 f6                	xor    %esi,%esi
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7d0:	89 c8                	mov    %ecx,%eax
+ 7d2:	31 d2                	xor    %edx,%edx
+ 7d4:	89 f7                	mov    %esi,%edi
+ 7d6:	f7 f3                	div    %ebx
+ 7d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7db:	0f b6 92 0c 0f 00 00 	movzbl 0xf0c(%edx),%edx
+ 7e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7e6:	89 ca                	mov    %ecx,%edx
+ 7e8:	89 c1                	mov    %eax,%ecx
+ 7ea:	39 da                	cmp    %ebx,%edx
+ 7ec:	73 e2                	jae    7d0 <printint+0x30>
+  if(neg)
+ 7ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7f1:	85 c0                	test   %eax,%eax
+ 7f3:	74 07                	je     7fc <printint+0x5c>
+    buf[i++] = '-';
+ 7f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7fa:	89 f7                	mov    %esi,%edi
+ 7fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 802:	01 df                	add    %ebx,%edi
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 808:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 80b:	83 ec 04             	sub    $0x4,%esp
+ 80e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 811:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 814:	6a 01                	push   $0x1
+ 816:	50                   	push   %eax
+ 817:	56                   	push   %esi
+ 818:	e8 46 fe ff ff       	call   663 <write>
+  while(--i >= 0)
+ 81d:	89 f8                	mov    %edi,%eax
+ 81f:	83 c4 10             	add    $0x10,%esp
+ 822:	83 ef 01             	sub    $0x1,%edi
+ 825:	39 d8                	cmp    %ebx,%eax
+ 827:	75 df                	jne    808 <printint+0x68>
+}
+ 829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 82c:	5b                   	pop    %ebx
+ 82d:	5e                   	pop    %esi
+ 82e:	5f                   	pop    %edi
+ 82f:	5d                   	pop    %ebp
+ 830:	c3                   	ret
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 838:	31 c0                	xor    %eax,%eax
+ 83a:	eb 89                	jmp    7c5 <printint+0x25>
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000840 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 849:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 84c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 84f:	0f b6 1e             	movzbl (%esi),%ebx
+ 852:	83 c6 01             	add    $0x1,%esi
+ 855:	84 db                	test   %bl,%bl
+ 857:	74 67                	je     8c0 <printf+0x80>
+ 859:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 85c:	31 d2                	xor    %edx,%edx
+ 85e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 861:	eb 34                	jmp    897 <printf+0x57>
+ 863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 867:	90                   	nop
+ 868:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 86b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 870:	83 f8 25             	cmp    $0x25,%eax
+ 873:	74 18                	je     88d <printf+0x4d>
+  write(fd, &c, 1);
+ 875:	83 ec 04             	sub    $0x4,%esp
+ 878:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 87b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87e:	6a 01                	push   $0x1
+ 880:	50                   	push   %eax
+ 881:	57                   	push   %edi
+ 882:	e8 dc fd ff ff       	call   663 <write>
+ 887:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 88a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 88d:	0f b6 1e             	movzbl (%esi),%ebx
+ 890:	83 c6 01             	add    $0x1,%esi
+ 893:	84 db                	test   %bl,%bl
+ 895:	74 29                	je     8c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 897:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 89a:	85 d2                	test   %edx,%edx
+ 89c:	74 ca                	je     868 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 89e:	83 fa 25             	cmp    $0x25,%edx
+ 8a1:	75 ea                	jne    88d <printf+0x4d>
+      if(c == 'd'){
+ 8a3:	83 f8 25             	cmp    $0x25,%eax
+ 8a6:	0f 84 24 01 00 00    	je     9d0 <printf+0x190>
+ 8ac:	83 e8 63             	sub    $0x63,%eax
+ 8af:	83 f8 15             	cmp    $0x15,%eax
+ 8b2:	77 1c                	ja     8d0 <printf+0x90>
+ 8b4:	ff 24 85 b4 0e 00 00 	jmp    *0xeb4(,%eax,4)
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8c3:	5b                   	pop    %ebx
+ 8c4:	5e                   	pop    %esi
+ 8c5:	5f                   	pop    %edi
+ 8c6:	5d                   	pop    %ebp
+ 8c7:	c3                   	ret
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8da:	6a 01                	push   $0x1
+ 8dc:	52                   	push   %edx
+ 8dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8e0:	57                   	push   %edi
+ 8e1:	e8 7d fd ff ff       	call   663 <write>
+ 8e6:	83 c4 0c             	add    $0xc,%esp
+ 8e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ec:	6a 01                	push   $0x1
+ 8ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8f1:	52                   	push   %edx
+ 8f2:	57                   	push   %edi
+ 8f3:	e8 6b fd ff ff       	call   663 <write>
+        putc(fd, c);
+ 8f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8fb:	31 d2                	xor    %edx,%edx
+ 8fd:	eb 8e                	jmp    88d <printf+0x4d>
+ 8ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 00                	push   $0x0
+ 90f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 911:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 914:	e8 87 fe ff ff       	call   7a0 <printint>
+        ap++;
+ 919:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 91c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 91f:	31 d2                	xor    %edx,%edx
+ 921:	e9 67 ff ff ff       	jmp    88d <printf+0x4d>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 930:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 933:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 935:	83 c0 04             	add    $0x4,%eax
+ 938:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 93b:	85 db                	test   %ebx,%ebx
+ 93d:	0f 84 9d 00 00 00    	je     9e0 <printf+0x1a0>
+        while(*s != 0){
+ 943:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 946:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 948:	84 c0                	test   %al,%al
+ 94a:	0f 84 3d ff ff ff    	je     88d <printf+0x4d>
+ 950:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 953:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 956:	89 de                	mov    %ebx,%esi
+ 958:	89 d3                	mov    %edx,%ebx
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 966:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	53                   	push   %ebx
+ 96c:	57                   	push   %edi
+ 96d:	e8 f1 fc ff ff       	call   663 <write>
+        while(*s != 0){
+ 972:	0f b6 06             	movzbl (%esi),%eax
+ 975:	83 c4 10             	add    $0x10,%esp
+ 978:	84 c0                	test   %al,%al
+ 97a:	75 e4                	jne    960 <printf+0x120>
+      state = 0;
+ 97c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 97f:	31 d2                	xor    %edx,%edx
+ 981:	e9 07 ff ff ff       	jmp    88d <printf+0x4d>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 990:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 99b:	8b 13                	mov    (%ebx),%edx
+ 99d:	6a 01                	push   $0x1
+ 99f:	e9 6b ff ff ff       	jmp    90f <printf+0xcf>
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9ab:	83 ec 04             	sub    $0x4,%esp
+ 9ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	52                   	push   %edx
+ 9bc:	57                   	push   %edi
+ 9bd:	e8 a1 fc ff ff       	call   663 <write>
+        ap++;
+ 9c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9c8:	31 d2                	xor    %edx,%edx
+ 9ca:	e9 be fe ff ff       	jmp    88d <printf+0x4d>
+ 9cf:	90                   	nop
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d9:	6a 01                	push   $0x1
+ 9db:	e9 11 ff ff ff       	jmp    8f1 <printf+0xb1>
+ 9e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9e5:	bb ab 0e 00 00       	mov    $0xeab,%ebx
+ 9ea:	e9 61 ff ff ff       	jmp    950 <printf+0x110>
+ 9ef:	90                   	nop
+
+000009f0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f3:	a1 04 15 00 00       	mov    0x1504,%eax
+{
+ 9f8:	89 e5                	mov    %esp,%ebp
+ 9fa:	56                   	push   %esi
+ 9fb:	53                   	push   %ebx
+ 9fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a00:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a02:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a04:	39 ca                	cmp    %ecx,%edx
+ a06:	73 30                	jae    a38 <lfree+0x48>
+ a08:	39 c1                	cmp    %eax,%ecx
+ a0a:	72 04                	jb     a10 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a0c:	39 c2                	cmp    %eax,%edx
+ a0e:	72 f0                	jb     a00 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a10:	8b 59 04             	mov    0x4(%ecx),%ebx
+ a13:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ a16:	39 f0                	cmp    %esi,%eax
+ a18:	74 26                	je     a40 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a1a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a1c:	8b 42 04             	mov    0x4(%edx),%eax
+ a1f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a22:	39 d9                	cmp    %ebx,%ecx
+ a24:	74 30                	je     a56 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a26:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a28:	5b                   	pop    %ebx
+  freep = p;
+ a29:	89 15 04 15 00 00    	mov    %edx,0x1504
+}
+ a2f:	5e                   	pop    %esi
+ a30:	5d                   	pop    %ebp
+ a31:	c3                   	ret
+ a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a38:	39 c1                	cmp    %eax,%ecx
+ a3a:	72 d0                	jb     a0c <lfree+0x1c>
+ a3c:	eb c2                	jmp    a00 <lfree+0x10>
+ a3e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ a40:	03 58 04             	add    0x4(%eax),%ebx
+ a43:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a46:	8b 02                	mov    (%edx),%eax
+ a48:	8b 00                	mov    (%eax),%eax
+ a4a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ a4c:	8b 42 04             	mov    0x4(%edx),%eax
+ a4f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ a52:	39 d9                	cmp    %ebx,%ecx
+ a54:	75 d0                	jne    a26 <lfree+0x36>
+    p->s.size += bp->s.size;
+ a56:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ a59:	89 15 04 15 00 00    	mov    %edx,0x1504
+    p->s.size += bp->s.size;
+ a5f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a62:	8b 09                	mov    (%ecx),%ecx
+ a64:	89 0a                	mov    %ecx,(%edx)
+}
+ a66:	5b                   	pop    %ebx
+ a67:	5e                   	pop    %esi
+ a68:	5d                   	pop    %ebp
+ a69:	c3                   	ret
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a70 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	89 c7                	mov    %eax,%edi
+ a76:	56                   	push   %esi
+ a77:	53                   	push   %ebx
+ a78:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ a7b:	a1 04 15 00 00       	mov    0x1504,%eax
+ a80:	85 c0                	test   %eax,%eax
+ a82:	0f 84 88 00 00 00    	je     b10 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a88:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a8a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ a8d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a92:	39 df                	cmp    %ebx,%edi
+ a94:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a97:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ a9e:	39 f9                	cmp    %edi,%ecx
+ aa0:	72 0f                	jb     ab1 <lalloc+0x41>
+ aa2:	eb 4c                	jmp    af0 <lalloc+0x80>
+ aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ aaa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ aad:	39 f9                	cmp    %edi,%ecx
+ aaf:	73 3f                	jae    af0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ ab1:	89 d0                	mov    %edx,%eax
+ ab3:	39 15 04 15 00 00    	cmp    %edx,0x1504
+ ab9:	75 ed                	jne    aa8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ abb:	83 ec 0c             	sub    $0xc,%esp
+ abe:	56                   	push   %esi
+ abf:	e8 07 fc ff ff       	call   6cb <sbrk>
+  if(p == (char*)-1)
+ ac4:	83 c4 10             	add    $0x10,%esp
+ ac7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ aca:	74 11                	je     add <lalloc+0x6d>
+  hp->s.size = nu;
+ acc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ acf:	e8 1c ff ff ff       	call   9f0 <lfree>
+  return freep;
+ ad4:	a1 04 15 00 00       	mov    0x1504,%eax
+      if((p = morecore(nunits)) == 0)
+ ad9:	85 c0                	test   %eax,%eax
+ adb:	75 cb                	jne    aa8 <lalloc+0x38>
+        return 0;
+  }
+}
+ add:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ae0:	31 d2                	xor    %edx,%edx
+}
+ ae2:	5b                   	pop    %ebx
+ ae3:	89 d0                	mov    %edx,%eax
+ ae5:	5e                   	pop    %esi
+ ae6:	5f                   	pop    %edi
+ ae7:	5d                   	pop    %ebp
+ ae8:	c3                   	ret
+ ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ af0:	39 cf                	cmp    %ecx,%edi
+ af2:	74 4c                	je     b40 <lalloc+0xd0>
+        p->s.size -= nunits;
+ af4:	29 f9                	sub    %edi,%ecx
+ af6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ af9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ afc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ aff:	a3 04 15 00 00       	mov    %eax,0x1504
+}
+ b04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b07:	89 d0                	mov    %edx,%eax
+ b09:	5b                   	pop    %ebx
+ b0a:	5e                   	pop    %esi
+ b0b:	5f                   	pop    %edi
+ b0c:	5d                   	pop    %ebp
+ b0d:	c3                   	ret
+ b0e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ b10:	ba 08 15 00 00       	mov    $0x1508,%edx
+ b15:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ b17:	c7 05 04 15 00 00 08 	movl   $0x1508,0x1504
+ b1e:	15 00 00 
+ b21:	c7 05 08 15 00 00 08 	movl   $0x1508,0x1508
+ b28:	15 00 00 
+ b2b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ b2d:	c7 05 0c 15 00 00 00 	movl   $0x0,0x150c
+ b34:	00 00 00 
+ b37:	e9 51 ff ff ff       	jmp    a8d <lalloc+0x1d>
+ b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ b40:	8b 0a                	mov    (%edx),%ecx
+ b42:	89 08                	mov    %ecx,(%eax)
+ b44:	eb b9                	jmp    aff <lalloc+0x8f>
+ b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b50 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	57                   	push   %edi
+ b54:	56                   	push   %esi
+ b55:	53                   	push   %ebx
+ b56:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ b59:	85 f6                	test   %esi,%esi
+ b5b:	74 42                	je     b9f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ b5d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ b60:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ b63:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ b69:	77 3d                	ja     ba8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ b6b:	31 c9                	xor    %ecx,%ecx
+ b6d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ b72:	83 fa 02             	cmp    $0x2,%edx
+ b75:	74 17                	je     b8e <free+0x3e>
+ b77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7e:	66 90                	xchg   %ax,%ax
+ b80:	83 c1 01             	add    $0x1,%ecx
+ b83:	89 d8                	mov    %ebx,%eax
+ b85:	d3 e0                	shl    %cl,%eax
+ b87:	83 c0 01             	add    $0x1,%eax
+ b8a:	39 c2                	cmp    %eax,%edx
+ b8c:	75 f2                	jne    b80 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ b8e:	8b 04 8d e0 14 00 00 	mov    0x14e0(,%ecx,4),%eax
+  classes[c] = bp;
+ b95:	89 3c 8d e0 14 00 00 	mov    %edi,0x14e0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ b9c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ b9f:	5b                   	pop    %ebx
+ ba0:	5e                   	pop    %esi
+ ba1:	5f                   	pop    %edi
+ ba2:	5d                   	pop    %ebp
+ ba3:	c3                   	ret
+ ba4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ba8:	5b                   	pop    %ebx
+    lfree(bp);
+ ba9:	89 f8                	mov    %edi,%eax
+}
+ bab:	5e                   	pop    %esi
+ bac:	5f                   	pop    %edi
+ bad:	5d                   	pop    %ebp
+    lfree(bp);
+ bae:	e9 3d fe ff ff       	jmp    9f0 <lfree>
+ bb3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000bc0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	57                   	push   %edi
+ bc4:	56                   	push   %esi
+ bc5:	53                   	push   %ebx
+ bc6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+ bcc:	83 c0 07             	add    $0x7,%eax
+ bcf:	c1 e8 03             	shr    $0x3,%eax
+ bd2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ bd5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ bda:	77 44                	ja     c20 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ bdc:	31 c9                	xor    %ecx,%ecx
+ bde:	ba 01 00 00 00       	mov    $0x1,%edx
+ be3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ be8:	83 f8 02             	cmp    $0x2,%eax
+ beb:	76 11                	jbe    bfe <malloc+0x3e>
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+ bf0:	83 c1 01             	add    $0x1,%ecx
+ bf3:	89 d3                	mov    %edx,%ebx
+ bf5:	d3 e3                	shl    %cl,%ebx
+ bf7:	83 c3 01             	add    $0x1,%ebx
+ bfa:	39 c3                	cmp    %eax,%ebx
+ bfc:	72 f2                	jb     bf0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ bfe:	8b 04 8d e0 14 00 00 	mov    0x14e0(,%ecx,4),%eax
+ c05:	85 c0                	test   %eax,%eax
+ c07:	74 2f                	je     c38 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ c09:	8b 10                	mov    (%eax),%edx
+ c0b:	89 14 8d e0 14 00 00 	mov    %edx,0x14e0(,%ecx,4)
+  return (void*)(p + 1);
+ c12:	83 c0 08             	add    $0x8,%eax
+}
+ c15:	83 c4 1c             	add    $0x1c,%esp
+ c18:	5b                   	pop    %ebx
+ c19:	5e                   	pop    %esi
+ c1a:	5f                   	pop    %edi
+ c1b:	5d                   	pop    %ebp
+ c1c:	c3                   	ret
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ c20:	e8 4b fe ff ff       	call   a70 <lalloc>
+ c25:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ c27:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ c2a:	85 d2                	test   %edx,%edx
+ c2c:	75 e7                	jne    c15 <malloc+0x55>
+      return 0;
+ c2e:	31 c0                	xor    %eax,%eax
+ c30:	eb e3                	jmp    c15 <malloc+0x55>
+ c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ c38:	31 d2                	xor    %edx,%edx
+ c3a:	b8 00 02 00 00       	mov    $0x200,%eax
+ c3f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ c42:	f7 f3                	div    %ebx
+  if(n < 4)
+ c44:	ba 04 00 00 00       	mov    $0x4,%edx
+ c49:	89 d6                	mov    %edx,%esi
+ c4b:	39 d0                	cmp    %edx,%eax
+ c4d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ c50:	0f af f3             	imul   %ebx,%esi
+ c53:	89 f0                	mov    %esi,%eax
+ c55:	e8 16 fe ff ff       	call   a70 <lalloc>
+ c5a:	85 c0                	test   %eax,%eax
+ c5c:	74 d0                	je     c2e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ c5e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c61:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ c64:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c6b:	8b 14 8d e0 14 00 00 	mov    0x14e0(,%ecx,4),%edx
+ c72:	39 f8                	cmp    %edi,%eax
+ c74:	73 22                	jae    c98 <malloc+0xd8>
+ c76:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ c79:	eb 09                	jmp    c84 <malloc+0xc4>
+ c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c7f:	90                   	nop
+ c80:	89 c2                	mov    %eax,%edx
+ c82:	89 c8                	mov    %ecx,%eax
+ c84:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ c87:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ c8a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ c8c:	39 f9                	cmp    %edi,%ecx
+ c8e:	72 f0                	jb     c80 <malloc+0xc0>
+ c90:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c93:	e9 73 ff ff ff       	jmp    c0b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ c98:	89 d0                	mov    %edx,%eax
+ c9a:	8b 12                	mov    (%edx),%edx
+ c9c:	e9 6a ff ff ff       	jmp    c0b <malloc+0x4b>
+ ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ caf:	90                   	nop
+
+00000cb0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	56                   	push   %esi
+ cb4:	53                   	push   %ebx
+ cb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ cb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ cbb:	85 c9                	test   %ecx,%ecx
+ cbd:	74 06                	je     cc5 <calloc+0x15>
+ cbf:	89 c8                	mov    %ecx,%eax
+ cc1:	f7 e3                	mul    %ebx
+ cc3:	70 33                	jo     cf8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ cc5:	0f af d9             	imul   %ecx,%ebx
+ cc8:	83 ec 0c             	sub    $0xc,%esp
+ ccb:	53                   	push   %ebx
+ ccc:	e8 ef fe ff ff       	call   bc0 <malloc>
+ cd1:	83 c4 10             	add    $0x10,%esp
+ cd4:	89 c6                	mov    %eax,%esi
+ cd6:	85 c0                	test   %eax,%eax
+ cd8:	74 1e                	je     cf8 <calloc+0x48>
+    memset(p, 0, n * size);
+ cda:	83 ec 04             	sub    $0x4,%esp
+ cdd:	53                   	push   %ebx
+ cde:	6a 00                	push   $0x0
+ ce0:	50                   	push   %eax
+ ce1:	e8 3a f7 ff ff       	call   420 <memset>
+ ce6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ ce9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cec:	89 f0                	mov    %esi,%eax
+ cee:	5b                   	pop    %ebx
+ cef:	5e                   	pop    %esi
+ cf0:	5d                   	pop    %ebp
+ cf1:	c3                   	ret
+ cf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ cf8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ cfb:	31 f6                	xor    %esi,%esi
+}
+ cfd:	89 f0                	mov    %esi,%eax
+ cff:	5b                   	pop    %ebx
+ d00:	5e                   	pop    %esi
+ d01:	5d                   	pop    %ebp
+ d02:	c3                   	ret
+ d03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d10 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 0c             	sub    $0xc,%esp
+ d19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ d1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ d1f:	85 db                	test   %ebx,%ebx
+ d21:	74 55                	je     d78 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ d23:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ d26:	89 de                	mov    %ebx,%esi
+ d28:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ d2f:	39 c7                	cmp    %eax,%edi
+ d31:	72 0d                	jb     d40 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d36:	89 f0                	mov    %esi,%eax
+ d38:	5b                   	pop    %ebx
+ d39:	5e                   	pop    %esi
+ d3a:	5f                   	pop    %edi
+ d3b:	5d                   	pop    %ebp
+ d3c:	c3                   	ret
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ d40:	83 ec 0c             	sub    $0xc,%esp
+ d43:	50                   	push   %eax
+ d44:	e8 77 fe ff ff       	call   bc0 <malloc>
+ d49:	83 c4 10             	add    $0x10,%esp
+ d4c:	89 c6                	mov    %eax,%esi
+ d4e:	85 c0                	test   %eax,%eax
+ d50:	74 e1                	je     d33 <realloc+0x23>
+  memmove(p, ap, have);
+ d52:	83 ec 04             	sub    $0x4,%esp
+ d55:	57                   	push   %edi
+ d56:	53                   	push   %ebx
+ d57:	50                   	push   %eax
+ d58:	e8 b3 f8 ff ff       	call   610 <memmove>
+  free(ap);
+ d5d:	89 1c 24             	mov    %ebx,(%esp)
+ d60:	e8 eb fd ff ff       	call   b50 <free>
+  return p;
+ d65:	83 c4 10             	add    $0x10,%esp
+}
+ d68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d6b:	89 f0                	mov    %esi,%eax
+ d6d:	5b                   	pop    %ebx
+ d6e:	5e                   	pop    %esi
+ d6f:	5f                   	pop    %edi
+ d70:	5d                   	pop    %ebp
+ d71:	c3                   	ret
+ d72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ d78:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ d7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d7e:	5b                   	pop    %ebx
+ d7f:	5e                   	pop    %esi
+ d80:	5f                   	pop    %edi
+ d81:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ d82:	e9 39 fe ff ff       	jmp    bc0 <malloc>
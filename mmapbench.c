@@ -0,0 +1,144 @@
+// Compare scanning a file through mmap with scanning it through
+// read(), then check that stores to a MAP_SHARED mapping reach
+// the file, and that another process mapping the file sees them
+// at once.
+
+#include "types.h"
+#include "user.h"
+#include "fcntl.h"
+#include "mman.h"
+
+#define FILE   "mmapbench.tmp"
+#define SIZE   (64*1024)
+#define PASSES 50
+
+char buf[512];
+
+static void
+mkfile(void)
+{
+  int fd, i, j;
+
+  if((fd = open(FILE, O_CREATE|O_RDWR)) < 0){
+    printf(2, "mmapbench: cannot create %s\n", FILE);
+    exit();
+  }
+  for(i = 0; i < SIZE; i += sizeof(buf)){
+    for(j = 0; j < sizeof(buf); j++)
+      buf[j] = i + j;
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "mmapbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+}
+
+static uint
+readscan(void)
+{
+  int fd, n, i;
+  uint sum;
+
+  sum = 0;
+  fd = open(FILE, O_RDONLY);
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    for(i = 0; i < n; i++)
+      sum += (uchar)buf[i];
+  close(fd);
+  return sum;
+}
+
+static uint
+mmapscan(void)
+{
+  int fd, i;
+  uchar *p;
+  uint sum;
+
+  sum = 0;
+  fd = open(FILE, O_RDONLY);
+  p = mmap(0, SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED){
+    printf(2, "mmapbench: mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < SIZE; i++)
+    sum += p[i];
+  munmap(p, SIZE);
+  close(fd);
+  return sum;
+}
+
+// In a child, map the file on its own (not through fork) and
+// check the parent's store at 5000; store at 5001 in return.
+static void
+sharedchild(void)
+{
+  int fd;
+  char *q;
+
+  fd = open(FILE, O_RDWR);
+  q = mmap(0, SIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(q == MAP_FAILED)
+    exit();
+  if(q[5000] == 'x')
+    q[5001] = 'y';
+  munmap(q, SIZE);
+  close(fd);
+  exit();
+}
+
+static void
+sharedtest(void)
+{
+  int fd, i;
+  char *p;
+
+  fd = open(FILE, O_RDWR);
+  p = mmap(0, SIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED){
+    printf(2, "mmapbench: shared mmap failed\n");
+    exit();
+  }
+  p[5000] = 'x';
+  if(fork() == 0)
+    sharedchild();
+  wait();
+  printf(1, "shared mapping between processes: %s\n",
+         p[5001] == 'y' ? "ok" : "FAILED");
+  munmap(p, SIZE);
+  close(fd);
+
+  // Read up to the chunk holding byte 5000.
+  fd = open(FILE, O_RDONLY);
+  for(i = 0; i <= 5000 / sizeof(buf); i++)
+    read(fd, buf, sizeof(buf));
+  close(fd);
+  printf(1, "shared mapping write-back: %s\n",
+         buf[5000 % sizeof(buf)] == 'x' ? "ok" : "FAILED");
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint rsum, msum;
+  int i, t0, t1, t2;
+
+  mkfile();
+  rsum = msum = 0;
+  t0 = uptime();
+  for(i = 0; i < PASSES; i++)
+    rsum = readscan();
+  t1 = uptime();
+  for(i = 0; i < PASSES; i++)
+    msum = mmapscan();
+  t2 = uptime();
+  printf(1, "%d scans of %d KB: read() %d ms, mmap %d ms\n",
+         PASSES, SIZE/1024, t1 - t0, t2 - t1);
+  if(rsum != msum)
+    printf(1, "mmapbench: checksums differ: %x %x\n", rsum, msum);
+  sharedtest();
+  unlink(FILE);
+  exit();
+}
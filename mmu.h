@@ -45,9 +45,10 @@
 #define SEG_UCODE 3  // user code
 #define SEG_UDATA 4  // user data+stack
 #define SEG_TSS   5  // this process's task state
+#define SEG_KCPU  6  // this cpu's struct cpu, through %gs
 
 // cpu->gdt[NSEGS] holds the above segments.
-#define NSEGS     6
+#define NSEGS     7
 
 #ifndef __ASSEMBLER__
 // Segment Descriptor
@@ -123,6 +124,7 @@ struct segdesc {
 #define NPDENTRIES      1024    // # directory entries per page directory
 #define NPTENTRIES      1024    // # PTEs per page table
 #define PGSIZE          4096    // bytes mapped by a page
+#define SPGSIZE     0x400000    // bytes mapped by a superpage (PTE_PS)
 
 #define PGSHIFT         12      // log2(PGSIZE)
 #define PTXSHIFT        12      // offset of PTX in a linear address
@@ -141,6 +143,13 @@ struct segdesc {
 #define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
 #define PTE_MBZ         0x180   // Bits must be zero
+#define PTE_SWAP        0x200   // Not present: page is in swap slot PTE_ADDR>>PGSHIFT
+#define PTE_PIN         0x400   // Present: a system call is using the page; don't swap it
+
+// Page fault error code bits (trapframe err for T_PGFLT)
+#define FEC_PR          0x1     // Fault caused by protection violation
+#define FEC_WR          0x2     // Fault caused by a write
+#define FEC_U           0x4     // Fault occurred in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
@@ -0,0 +1,2755 @@
+
+_p2-test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+}
+#endif
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 20             	sub    $0x20,%esp
+      14:	8b 41 04             	mov    0x4(%ecx),%eax
+  #ifdef CPUTIME_TEST
+  testcputime(argv[0]);
+      17:	8b 38                	mov    (%eax),%edi
+  printf(1, "\n----------\nRunning CPU Time Test\n----------\n");
+      19:	68 ec 16 00 00       	push   $0x16ec
+      1e:	6a 01                	push   $0x1
+      20:	e8 2b 0f 00 00       	call   f50 <printf>
+  table = malloc(sizeof(struct uproc) * 64);
+      25:	c7 04 24 00 1a 00 00 	movl   $0x1a00,(%esp)
+      2c:	e8 9f 12 00 00       	call   12d0 <malloc>
+  if (!table) {
+      31:	83 c4 10             	add    $0x10,%esp
+      34:	85 c0                	test   %eax,%eax
+      36:	0f 84 28 04 00 00    	je     464 <main+0x464>
+  printf(1, "This will take a couple seconds\n");
+      3c:	83 ec 08             	sub    $0x8,%esp
+      3f:	89 c6                	mov    %eax,%esi
+  for(i = 0, num = 0; i < 1000000; ++i){
+      41:	31 db                	xor    %ebx,%ebx
+  printf(1, "This will take a couple seconds\n");
+      43:	68 1c 17 00 00       	push   $0x171c
+      48:	6a 01                	push   $0x1
+      4a:	e8 01 0f 00 00       	call   f50 <printf>
+  time1 = getcputime(name, table);
+      4f:	89 f2                	mov    %esi,%edx
+      51:	89 f8                	mov    %edi,%eax
+      53:	e8 e8 06 00 00       	call   740 <getcputime>
+  int success = 0;
+      58:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  time1 = getcputime(name, table);
+      5f:	83 c4 10             	add    $0x10,%esp
+      62:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(i = 0, num = 0; i < 1000000; ++i){
+      65:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      68:	eb 0e                	jmp    78 <main+0x78>
+      6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      70:	81 fb 40 42 0f 00    	cmp    $0xf4240,%ebx
+      76:	74 61                	je     d9 <main+0xd9>
+    ++num;
+      78:	83 c3 01             	add    $0x1,%ebx
+      7b:	69 c3 1d e6 cb 0b    	imul   $0xbcbe61d,%ebx,%eax
+      81:	c1 c8 05             	ror    $0x5,%eax
+    if(num % 100000 == 0){
+      84:	3d c5 a7 00 00       	cmp    $0xa7c5,%eax
+      89:	77 e5                	ja     70 <main+0x70>
+      pre_sleep = getcputime(name, table);
+      8b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      8e:	89 f8                	mov    %edi,%eax
+      90:	e8 ab 06 00 00       	call   740 <getcputime>
+      sleep(200);
+      95:	83 ec 0c             	sub    $0xc,%esp
+      98:	68 c8 00 00 00       	push   $0xc8
+      pre_sleep = getcputime(name, table);
+      9d:	89 c6                	mov    %eax,%esi
+      sleep(200);
+      9f:	e8 3f 0d 00 00       	call   de3 <sleep>
+      post_sleep = getcputime(name, table);
+      a4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      a7:	89 f8                	mov    %edi,%eax
+      a9:	e8 92 06 00 00       	call   740 <getcputime>
+      if((post_sleep - pre_sleep) >= 100){
+      ae:	83 c4 10             	add    $0x10,%esp
+      b1:	29 f0                	sub    %esi,%eax
+      b3:	83 f8 63             	cmp    $0x63,%eax
+      b6:	76 b8                	jbe    70 <main+0x70>
+        printf(2, "FAILED: CPU_total_ticks changed by 100+ milliseconds while process was asleep\n");
+      b8:	83 ec 08             	sub    $0x8,%esp
+      bb:	68 40 17 00 00       	push   $0x1740
+      c0:	6a 02                	push   $0x2
+      c2:	e8 89 0e 00 00       	call   f50 <printf>
+        success = -1;
+      c7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+        printf(2, "FAILED: CPU_total_ticks changed by 100+ milliseconds while process was asleep\n");
+      ce:	83 c4 10             	add    $0x10,%esp
+  for(i = 0, num = 0; i < 1000000; ++i){
+      d1:	81 fb 40 42 0f 00    	cmp    $0xf4240,%ebx
+      d7:	75 9f                	jne    78 <main+0x78>
+  time2 = getcputime(name, table);
+      d9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+      dc:	89 f8                	mov    %edi,%eax
+      de:	89 f2                	mov    %esi,%edx
+      e0:	e8 5b 06 00 00       	call   740 <getcputime>
+  if((time2 - time1) > 400){
+      e5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      e8:	29 c8                	sub    %ecx,%eax
+      ea:	89 c3                	mov    %eax,%ebx
+      ec:	3d 90 01 00 00       	cmp    $0x190,%eax
+      f1:	0f 87 89 02 00 00    	ja     380 <main+0x380>
+  printf(1, "T2 - T1 = %d milliseconds\n", (time2 - time1));
+      f7:	83 ec 04             	sub    $0x4,%esp
+      fa:	50                   	push   %eax
+      fb:	68 44 1a 00 00       	push   $0x1a44
+     100:	6a 01                	push   $0x1
+     102:	e8 49 0e 00 00       	call   f50 <printf>
+  free(table);
+     107:	89 34 24             	mov    %esi,(%esp)
+     10a:	e8 51 11 00 00       	call   1260 <free>
+  if(success == 0)
+     10f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	75 11                	jne    12a <main+0x12a>
+    printf(1, "** All Tests Passed! **\n");
+     119:	50                   	push   %eax
+     11a:	50                   	push   %eax
+     11b:	68 5f 1a 00 00       	push   $0x1a5f
+     120:	6a 01                	push   $0x1
+     122:	e8 29 0e 00 00       	call   f50 <printf>
+     127:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n----------\nRunning UID / GID Tests\n----------\n");
+     12a:	83 ec 08             	sub    $0x8,%esp
+  int success = 0;
+     12d:	31 db                	xor    %ebx,%ebx
+  printf(1, "\n----------\nRunning UID / GID Tests\n----------\n");
+     12f:	68 d0 17 00 00       	push   $0x17d0
+     134:	6a 01                	push   $0x1
+     136:	e8 15 0e 00 00       	call   f50 <printf>
+  uid = getuid();
+     13b:	e8 0b 0d 00 00       	call   e4b <getuid>
+  if(uid < 0 || uid > 32767){
+     140:	83 c4 10             	add    $0x10,%esp
+     143:	3d ff 7f 00 00       	cmp    $0x7fff,%eax
+     148:	0f 87 60 02 00 00    	ja     3ae <main+0x3ae>
+  if (testuid(0, 0, 0))
+     14e:	31 c9                	xor    %ecx,%ecx
+     150:	31 d2                	xor    %edx,%edx
+     152:	31 c0                	xor    %eax,%eax
+    success = -1;
+     154:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  if (testuid(0, 0, 0))
+     159:	e8 c2 04 00 00       	call   620 <testuid>
+  if (testuid(5, 5, 0))
+     15e:	ba 05 00 00 00       	mov    $0x5,%edx
+    success = -1;
+     163:	85 c0                	test   %eax,%eax
+  if (testuid(5, 5, 0))
+     165:	b8 05 00 00 00       	mov    $0x5,%eax
+    success = -1;
+     16a:	0f 45 de             	cmovne %esi,%ebx
+  if (testuid(5, 5, 0))
+     16d:	31 c9                	xor    %ecx,%ecx
+     16f:	e8 ac 04 00 00       	call   620 <testuid>
+  if (testuid(32767, 32767, 0))
+     174:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+    success = -1;
+     179:	85 c0                	test   %eax,%eax
+  if (testuid(32767, 32767, 0))
+     17b:	b8 ff 7f 00 00       	mov    $0x7fff,%eax
+    success = -1;
+     180:	0f 45 de             	cmovne %esi,%ebx
+  if (testuid(32767, 32767, 0))
+     183:	31 c9                	xor    %ecx,%ecx
+     185:	e8 96 04 00 00       	call   620 <testuid>
+  if (testuid(32768, 32767, -1))
+     18a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     18f:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+    success = -1;
+     194:	85 c0                	test   %eax,%eax
+  if (testuid(32768, 32767, -1))
+     196:	b8 00 80 00 00       	mov    $0x8000,%eax
+    success = -1;
+     19b:	0f 45 de             	cmovne %esi,%ebx
+  if (testuid(32768, 32767, -1))
+     19e:	e8 7d 04 00 00       	call   620 <testuid>
+  if (testuid(-1, 32767, -1))
+     1a3:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     1a8:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+    success = -1;
+     1ad:	85 c0                	test   %eax,%eax
+  if (testuid(-1, 32767, -1))
+     1af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    success = -1;
+     1b4:	0f 45 de             	cmovne %esi,%ebx
+  if (testuid(-1, 32767, -1))
+     1b7:	e8 64 04 00 00       	call   620 <testuid>
+    success = -1;
+     1bc:	85 c0                	test   %eax,%eax
+     1be:	0f 45 de             	cmovne %esi,%ebx
+  gid = getgid();
+     1c1:	e8 8d 0c 00 00       	call   e53 <getgid>
+  if(gid < 0 || gid > 32767){
+     1c6:	3d ff 7f 00 00       	cmp    $0x7fff,%eax
+     1cb:	0f 87 96 01 00 00    	ja     367 <main+0x367>
+  if (testgid(0, 0, 0))
+     1d1:	31 c9                	xor    %ecx,%ecx
+     1d3:	31 d2                	xor    %edx,%edx
+     1d5:	31 c0                	xor    %eax,%eax
+    success = -1;
+     1d7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  if (testgid(0, 0, 0))
+     1dc:	e8 cf 04 00 00       	call   6b0 <testgid>
+  if (testgid(5, 5, 0))
+     1e1:	ba 05 00 00 00       	mov    $0x5,%edx
+    success = -1;
+     1e6:	85 c0                	test   %eax,%eax
+  if (testgid(5, 5, 0))
+     1e8:	b8 05 00 00 00       	mov    $0x5,%eax
+    success = -1;
+     1ed:	0f 45 de             	cmovne %esi,%ebx
+  if (testgid(5, 5, 0))
+     1f0:	31 c9                	xor    %ecx,%ecx
+     1f2:	e8 b9 04 00 00       	call   6b0 <testgid>
+  if (testgid(32767, 32767, 0))
+     1f7:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+    success = -1;
+     1fc:	85 c0                	test   %eax,%eax
+  if (testgid(32767, 32767, 0))
+     1fe:	b8 ff 7f 00 00       	mov    $0x7fff,%eax
+    success = -1;
+     203:	0f 45 de             	cmovne %esi,%ebx
+  if (testgid(32767, 32767, 0))
+     206:	31 c9                	xor    %ecx,%ecx
+     208:	e8 a3 04 00 00       	call   6b0 <testgid>
+  if (testgid(-1, 32767, -1))
+     20d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     212:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+  if (testgid(32767, 32767, 0))
+     217:	85 c0                	test   %eax,%eax
+  if (testgid(-1, 32767, -1))
+     219:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (testgid(32767, 32767, 0))
+     21e:	0f 84 c5 00 00 00    	je     2e9 <main+0x2e9>
+  if (testgid(-1, 32767, -1))
+     224:	e8 87 04 00 00       	call   6b0 <testgid>
+  if (testgid(32768, 32767, -1))
+     229:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     22e:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     233:	b8 00 80 00 00       	mov    $0x8000,%eax
+     238:	e8 73 04 00 00       	call   6b0 <testgid>
+  printf(1, "\n----------\nRunning UID / GID Inheritance Test\n----------\n");
+     23d:	83 ec 08             	sub    $0x8,%esp
+     240:	68 50 18 00 00       	push   $0x1850
+     245:	6a 01                	push   $0x1
+     247:	e8 04 0d 00 00       	call   f50 <printf>
+  if (testuid(12345, 12345, 0))
+     24c:	31 c9                	xor    %ecx,%ecx
+     24e:	ba 39 30 00 00       	mov    $0x3039,%edx
+     253:	b8 39 30 00 00       	mov    $0x3039,%eax
+     258:	e8 c3 03 00 00       	call   620 <testuid>
+     25d:	83 c4 10             	add    $0x10,%esp
+  if (testgid(12345, 12345, 0))
+     260:	31 c9                	xor    %ecx,%ecx
+     262:	ba 39 30 00 00       	mov    $0x3039,%edx
+  if (testuid(12345, 12345, 0))
+     267:	85 c0                	test   %eax,%eax
+  if (testgid(12345, 12345, 0))
+     269:	b8 39 30 00 00       	mov    $0x3039,%eax
+  if (testuid(12345, 12345, 0))
+     26e:	0f 84 b2 00 00 00    	je     326 <main+0x326>
+  if (testgid(12345, 12345, 0))
+     274:	e8 37 04 00 00       	call   6b0 <testgid>
+  printf(1, "\n----------\nRunning PPID Test\n----------\n");
+     279:	83 ec 08             	sub    $0x8,%esp
+     27c:	68 ec 18 00 00       	push   $0x18ec
+     281:	6a 01                	push   $0x1
+     283:	e8 c8 0c 00 00       	call   f50 <printf>
+  pid = getpid();
+     288:	e8 46 0b 00 00       	call   dd3 <getpid>
+     28d:	89 c3                	mov    %eax,%ebx
+  ret = fork();
+     28f:	e8 b7 0a 00 00       	call   d4b <fork>
+  if(ret == 0){
+     294:	83 c4 10             	add    $0x10,%esp
+     297:	85 c0                	test   %eax,%eax
+     299:	0f 84 e0 01 00 00    	je     47f <main+0x47f>
+    wait();
+     29f:	e8 b7 0a 00 00       	call   d5b <wait>
+  printf(1, "\n----------\nRunning GetProcs Test\n----------\n");
+     2a4:	83 ec 08             	sub    $0x8,%esp
+     2a7:	68 48 19 00 00       	push   $0x1948
+     2ac:	6a 01                	push   $0x1
+     2ae:	e8 9d 0c 00 00       	call   f50 <printf>
+  printf(1, "Filling the proc[] array with dummy processes\n");
+     2b3:	5f                   	pop    %edi
+     2b4:	58                   	pop    %eax
+     2b5:	68 78 19 00 00       	push   $0x1978
+     2ba:	6a 01                	push   $0x1
+     2bc:	e8 8f 0c 00 00       	call   f50 <printf>
+  ret = fork();
+     2c1:	e8 85 0a 00 00       	call   d4b <fork>
+  if (ret == 0){
+     2c6:	83 c4 10             	add    $0x10,%esp
+     2c9:	85 c0                	test   %eax,%eax
+     2cb:	75 7d                	jne    34a <main+0x34a>
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    while((ret = fork()) == 0);
+     2d0:	e8 76 0a 00 00       	call   d4b <fork>
+     2d5:	85 c0                	test   %eax,%eax
+     2d7:	74 f7                	je     2d0 <main+0x2d0>
+    if(ret > 0){
+     2d9:	0f 8e e8 00 00 00    	jle    3c7 <main+0x3c7>
+      wait();
+     2df:	e8 77 0a 00 00       	call   d5b <wait>
+      exit();
+     2e4:	e8 6a 0a 00 00       	call   d53 <exit>
+  if (testgid(-1, 32767, -1))
+     2e9:	e8 c2 03 00 00       	call   6b0 <testgid>
+     2ee:	85 c0                	test   %eax,%eax
+     2f0:	0f 85 33 ff ff ff    	jne    229 <main+0x229>
+  if (testgid(32768, 32767, -1))
+     2f6:	83 c9 ff             	or     $0xffffffff,%ecx
+     2f9:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     2fe:	b8 00 80 00 00       	mov    $0x8000,%eax
+     303:	e8 a8 03 00 00       	call   6b0 <testgid>
+  if (success == 0)
+     308:	09 d8                	or     %ebx,%eax
+     30a:	0f 85 2d ff ff ff    	jne    23d <main+0x23d>
+    printf(1, "** All tests passed! **\n");
+     310:	53                   	push   %ebx
+     311:	53                   	push   %ebx
+     312:	68 78 1a 00 00       	push   $0x1a78
+     317:	6a 01                	push   $0x1
+     319:	e8 32 0c 00 00       	call   f50 <printf>
+     31e:	83 c4 10             	add    $0x10,%esp
+     321:	e9 17 ff ff ff       	jmp    23d <main+0x23d>
+  if (testgid(12345, 12345, 0))
+     326:	e8 85 03 00 00       	call   6b0 <testgid>
+     32b:	85 c0                	test   %eax,%eax
+     32d:	0f 85 46 ff ff ff    	jne    279 <main+0x279>
+  ret = fork();
+     333:	e8 13 0a 00 00       	call   d4b <fork>
+  if(ret == 0){
+     338:	85 c0                	test   %eax,%eax
+     33a:	0f 84 5e 01 00 00    	je     49e <main+0x49e>
+    wait();
+     340:	e8 16 0a 00 00       	call   d5b <wait>
+     345:	e9 2f ff ff ff       	jmp    279 <main+0x279>
+  wait();
+     34a:	e8 0c 0a 00 00       	call   d5b <wait>
+  #endif
+  #ifdef GETPROCS_TEST
+  testgetprocs();  // no need to pass argv[0]
+  #endif
+  #ifdef TIME_TEST
+  testtime();
+     34f:	e8 cc 04 00 00       	call   820 <testtime>
+  #endif
+  printf(1, "\n** End of Tests **\n");
+     354:	50                   	push   %eax
+     355:	50                   	push   %eax
+     356:	68 d1 1a 00 00       	push   $0x1ad1
+     35b:	6a 01                	push   $0x1
+     35d:	e8 ee 0b 00 00       	call   f50 <printf>
+  exit();
+     362:	e8 ec 09 00 00       	call   d53 <exit>
+    printf(1, "FAILED: Default GID %d, out of range\n", gid);
+     367:	56                   	push   %esi
+    success = -1;
+     368:	83 cb ff             	or     $0xffffffff,%ebx
+    printf(1, "FAILED: Default GID %d, out of range\n", gid);
+     36b:	50                   	push   %eax
+     36c:	68 28 18 00 00       	push   $0x1828
+     371:	6a 01                	push   $0x1
+     373:	e8 d8 0b 00 00       	call   f50 <printf>
+     378:	83 c4 10             	add    $0x10,%esp
+     37b:	e9 51 fe ff ff       	jmp    1d1 <main+0x1d1>
+    printf(2, "ABNORMALLY HIGH: T2 - T1 = %d milliseconds.  Run test again\n", (time2 - time1));
+     380:	50                   	push   %eax
+     381:	53                   	push   %ebx
+     382:	68 90 17 00 00       	push   $0x1790
+     387:	6a 02                	push   $0x2
+     389:	e8 c2 0b 00 00       	call   f50 <printf>
+  printf(1, "T2 - T1 = %d milliseconds\n", (time2 - time1));
+     38e:	83 c4 0c             	add    $0xc,%esp
+     391:	53                   	push   %ebx
+     392:	68 44 1a 00 00       	push   $0x1a44
+     397:	6a 01                	push   $0x1
+     399:	e8 b2 0b 00 00       	call   f50 <printf>
+  free(table);
+     39e:	89 34 24             	mov    %esi,(%esp)
+     3a1:	e8 ba 0e 00 00       	call   1260 <free>
+     3a6:	83 c4 10             	add    $0x10,%esp
+     3a9:	e9 7c fd ff ff       	jmp    12a <main+0x12a>
+    printf(1, "FAILED: Default UID %d, out of range\n", uid);
+     3ae:	57                   	push   %edi
+    success = -1;
+     3af:	83 cb ff             	or     $0xffffffff,%ebx
+    printf(1, "FAILED: Default UID %d, out of range\n", uid);
+     3b2:	50                   	push   %eax
+     3b3:	68 00 18 00 00       	push   $0x1800
+     3b8:	6a 01                	push   $0x1
+     3ba:	e8 91 0b 00 00       	call   f50 <printf>
+     3bf:	83 c4 10             	add    $0x10,%esp
+     3c2:	e9 87 fd ff ff       	jmp    14e <main+0x14e>
+  table = malloc(sizeof(struct uproc));
+     3c7:	83 ec 0c             	sub    $0xc,%esp
+     3ca:	6a 68                	push   $0x68
+     3cc:	e8 ff 0e 00 00       	call   12d0 <malloc>
+  if (!table) {
+     3d1:	83 c4 10             	add    $0x10,%esp
+  table = malloc(sizeof(struct uproc));
+     3d4:	89 c3                	mov    %eax,%ebx
+  if (!table) {
+     3d6:	85 c0                	test   %eax,%eax
+     3d8:	0f 84 21 01 00 00    	je     4ff <main+0x4ff>
+  ret = getprocs(1024, table);
+     3de:	56                   	push   %esi
+     3df:	56                   	push   %esi
+     3e0:	50                   	push   %eax
+     3e1:	68 00 04 00 00       	push   $0x400
+     3e6:	e8 88 0a 00 00       	call   e73 <getprocs>
+  free(table);
+     3eb:	89 1c 24             	mov    %ebx,(%esp)
+  ret = getprocs(1024, table);
+     3ee:	89 c6                	mov    %eax,%esi
+  free(table);
+     3f0:	e8 6b 0e 00 00       	call   1260 <free>
+  if(ret >= 0){
+     3f5:	83 c4 10             	add    $0x10,%esp
+     3f8:	85 f6                	test   %esi,%esi
+     3fa:	0f 89 1a 01 00 00    	jns    51a <main+0x51a>
+    success |= testprocarray( 1,  1);
+     400:	ba 01 00 00 00       	mov    $0x1,%edx
+     405:	b8 01 00 00 00       	mov    $0x1,%eax
+     40a:	e8 81 01 00 00       	call   590 <testprocarray>
+    success |= testprocarray(16, 16);
+     40f:	ba 10 00 00 00       	mov    $0x10,%edx
+    success |= testprocarray( 1,  1);
+     414:	89 c6                	mov    %eax,%esi
+    success |= testprocarray(16, 16);
+     416:	b8 10 00 00 00       	mov    $0x10,%eax
+     41b:	e8 70 01 00 00       	call   590 <testprocarray>
+    success |= testprocarray(64, 64);
+     420:	ba 40 00 00 00       	mov    $0x40,%edx
+    success |= testprocarray(16, 16);
+     425:	89 c7                	mov    %eax,%edi
+    success |= testprocarray(64, 64);
+     427:	b8 40 00 00 00       	mov    $0x40,%eax
+     42c:	e8 5f 01 00 00       	call   590 <testprocarray>
+     431:	09 fe                	or     %edi,%esi
+    success |= testprocarray(72, 64);
+     433:	ba 40 00 00 00       	mov    $0x40,%edx
+    success |= testprocarray(64, 64);
+     438:	89 c3                	mov    %eax,%ebx
+    success |= testprocarray(72, 64);
+     43a:	b8 48 00 00 00       	mov    $0x48,%eax
+     43f:	e8 4c 01 00 00       	call   590 <testprocarray>
+     444:	09 f3                	or     %esi,%ebx
+    if (success == 0)
+     446:	09 c3                	or     %eax,%ebx
+     448:	0f 85 96 fe ff ff    	jne    2e4 <main+0x2e4>
+      printf(1, "** All Tests Passed **\n");
+     44e:	52                   	push   %edx
+     44f:	52                   	push   %edx
+     450:	68 b9 1a 00 00       	push   $0x1ab9
+     455:	6a 01                	push   $0x1
+     457:	e8 f4 0a 00 00       	call   f50 <printf>
+     45c:	83 c4 10             	add    $0x10,%esp
+     45f:	e9 80 fe ff ff       	jmp    2e4 <main+0x2e4>
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+     464:	68 c2 00 00 00       	push   $0xc2
+     469:	68 0c 1b 00 00       	push   $0x1b0c
+     46e:	68 98 14 00 00       	push   $0x1498
+     473:	6a 02                	push   $0x2
+     475:	e8 d6 0a 00 00       	call   f50 <printf>
+    exit();
+     47a:	e8 d4 08 00 00       	call   d53 <exit>
+    ppid = getppid();
+     47f:	e8 d7 09 00 00       	call   e5b <getppid>
+    if(ppid != pid)
+     484:	39 c3                	cmp    %eax,%ebx
+     486:	74 40                	je     4c8 <main+0x4c8>
+      printf(2, "FAILED: Parent PID is %d, Child's PPID is %d\n", pid, ppid);
+     488:	50                   	push   %eax
+     489:	53                   	push   %ebx
+     48a:	68 18 19 00 00       	push   $0x1918
+     48f:	6a 02                	push   $0x2
+     491:	e8 ba 0a 00 00       	call   f50 <printf>
+     496:	83 c4 10             	add    $0x10,%esp
+     499:	e9 46 fe ff ff       	jmp    2e4 <main+0x2e4>
+    uid = getuid();
+     49e:	e8 a8 09 00 00       	call   e4b <getuid>
+     4a3:	89 c3                	mov    %eax,%ebx
+    gid = getgid();
+     4a5:	e8 a9 09 00 00       	call   e53 <getgid>
+    if(uid != 12345){
+     4aa:	81 fb 39 30 00 00    	cmp    $0x3039,%ebx
+     4b0:	74 2c                	je     4de <main+0x4de>
+      printf(2, "FAILED: Parent UID is 12345, child UID is %d\n", uid);
+     4b2:	51                   	push   %ecx
+     4b3:	53                   	push   %ebx
+     4b4:	68 8c 18 00 00       	push   $0x188c
+     4b9:	6a 02                	push   $0x2
+     4bb:	e8 90 0a 00 00       	call   f50 <printf>
+     4c0:	83 c4 10             	add    $0x10,%esp
+     4c3:	e9 1c fe ff ff       	jmp    2e4 <main+0x2e4>
+      printf(1, "** Test passed! **\n");
+     4c8:	50                   	push   %eax
+     4c9:	50                   	push   %eax
+     4ca:	68 a5 1a 00 00       	push   $0x1aa5
+     4cf:	6a 01                	push   $0x1
+     4d1:	e8 7a 0a 00 00       	call   f50 <printf>
+     4d6:	83 c4 10             	add    $0x10,%esp
+     4d9:	e9 06 fe ff ff       	jmp    2e4 <main+0x2e4>
+    else if(gid != 12345){
+     4de:	3d 39 30 00 00       	cmp    $0x3039,%eax
+     4e3:	0f 84 83 00 00 00    	je     56c <main+0x56c>
+      printf(2, "FAILED: Parent GID is 12345, child GID is %d\n", gid);
+     4e9:	52                   	push   %edx
+     4ea:	50                   	push   %eax
+     4eb:	68 bc 18 00 00       	push   $0x18bc
+     4f0:	6a 02                	push   $0x2
+     4f2:	e8 59 0a 00 00       	call   f50 <printf>
+     4f7:	83 c4 10             	add    $0x10,%esp
+     4fa:	e9 e5 fd ff ff       	jmp    2e4 <main+0x2e4>
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+     4ff:	68 06 01 00 00       	push   $0x106
+     504:	68 f8 1a 00 00       	push   $0x1af8
+     509:	68 98 14 00 00       	push   $0x1498
+     50e:	6a 02                	push   $0x2
+     510:	e8 3b 0a 00 00       	call   f50 <printf>
+    exit();
+     515:	e8 39 08 00 00       	call   d53 <exit>
+    printf(2, "FAILED: called getprocs with max way larger than table and returned %d, not error\n", ret);
+     51a:	51                   	push   %ecx
+     51b:	56                   	push   %esi
+     51c:	68 a8 19 00 00       	push   $0x19a8
+     521:	6a 02                	push   $0x2
+     523:	e8 28 0a 00 00       	call   f50 <printf>
+    success |= testprocarray( 1,  1);
+     528:	ba 01 00 00 00       	mov    $0x1,%edx
+     52d:	b8 01 00 00 00       	mov    $0x1,%eax
+     532:	e8 59 00 00 00       	call   590 <testprocarray>
+    success |= testprocarray(16, 16);
+     537:	ba 10 00 00 00       	mov    $0x10,%edx
+     53c:	b8 10 00 00 00       	mov    $0x10,%eax
+     541:	e8 4a 00 00 00       	call   590 <testprocarray>
+    success |= testprocarray(64, 64);
+     546:	ba 40 00 00 00       	mov    $0x40,%edx
+     54b:	b8 40 00 00 00       	mov    $0x40,%eax
+     550:	e8 3b 00 00 00       	call   590 <testprocarray>
+    success |= testprocarray(72, 64);
+     555:	ba 40 00 00 00       	mov    $0x40,%edx
+     55a:	b8 48 00 00 00       	mov    $0x48,%eax
+     55f:	e8 2c 00 00 00       	call   590 <testprocarray>
+     564:	83 c4 10             	add    $0x10,%esp
+     567:	e9 78 fd ff ff       	jmp    2e4 <main+0x2e4>
+      printf(1, "** Test Passed! **\n");
+     56c:	50                   	push   %eax
+     56d:	50                   	push   %eax
+     56e:	68 91 1a 00 00       	push   $0x1a91
+     573:	6a 01                	push   $0x1
+     575:	e8 d6 09 00 00       	call   f50 <printf>
+     57a:	83 c4 10             	add    $0x10,%esp
+    exit();
+     57d:	e9 62 fd ff ff       	jmp    2e4 <main+0x2e4>
+     582:	66 90                	xchg   %ax,%ax
+     584:	66 90                	xchg   %ax,%ax
+     586:	66 90                	xchg   %ax,%ax
+     588:	66 90                	xchg   %ax,%ax
+     58a:	66 90                	xchg   %ax,%ax
+     58c:	66 90                	xchg   %ax,%ax
+     58e:	66 90                	xchg   %ax,%ax
+
+00000590 <testprocarray>:
+testprocarray(int max, int expected_ret){
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	89 d7                	mov    %edx,%edi
+     596:	56                   	push   %esi
+     597:	89 c6                	mov    %eax,%esi
+  table = malloc(sizeof(struct uproc) * max);  // bad code, assumes success
+     599:	6b c0 68             	imul   $0x68,%eax,%eax
+testprocarray(int max, int expected_ret){
+     59c:	53                   	push   %ebx
+     59d:	83 ec 18             	sub    $0x18,%esp
+  table = malloc(sizeof(struct uproc) * max);  // bad code, assumes success
+     5a0:	50                   	push   %eax
+     5a1:	e8 2a 0d 00 00       	call   12d0 <malloc>
+  if (!table) {
+     5a6:	83 c4 10             	add    $0x10,%esp
+     5a9:	85 c0                	test   %eax,%eax
+     5ab:	74 53                	je     600 <testprocarray+0x70>
+  ret = getprocs(max, table);
+     5ad:	83 ec 08             	sub    $0x8,%esp
+     5b0:	89 c3                	mov    %eax,%ebx
+     5b2:	50                   	push   %eax
+     5b3:	56                   	push   %esi
+     5b4:	e8 ba 08 00 00       	call   e73 <getprocs>
+  if (ret != expected_ret){
+     5b9:	83 c4 10             	add    $0x10,%esp
+     5bc:	39 f8                	cmp    %edi,%eax
+     5be:	75 26                	jne    5e6 <testprocarray+0x56>
+    printf(2, "getprocs() was asked for %d processes and returned %d. SUCCESS\n", max, expected_ret);
+     5c0:	50                   	push   %eax
+     5c1:	56                   	push   %esi
+  int ret, success = 0;
+     5c2:	31 f6                	xor    %esi,%esi
+    printf(2, "getprocs() was asked for %d processes and returned %d. SUCCESS\n", max, expected_ret);
+     5c4:	68 f4 14 00 00       	push   $0x14f4
+     5c9:	6a 02                	push   $0x2
+     5cb:	e8 80 09 00 00       	call   f50 <printf>
+     5d0:	83 c4 10             	add    $0x10,%esp
+  free(table);
+     5d3:	83 ec 0c             	sub    $0xc,%esp
+     5d6:	53                   	push   %ebx
+     5d7:	e8 84 0c 00 00       	call   1260 <free>
+}
+     5dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5df:	89 f0                	mov    %esi,%eax
+     5e1:	5b                   	pop    %ebx
+     5e2:	5e                   	pop    %esi
+     5e3:	5f                   	pop    %edi
+     5e4:	5d                   	pop    %ebp
+     5e5:	c3                   	ret
+    printf(2, "FAILED: getprocs(%d) returned %d, expected %d\n", max, ret, expected_ret);
+     5e6:	83 ec 0c             	sub    $0xc,%esp
+     5e9:	57                   	push   %edi
+     5ea:	50                   	push   %eax
+     5eb:	56                   	push   %esi
+    success = -1;
+     5ec:	83 ce ff             	or     $0xffffffff,%esi
+    printf(2, "FAILED: getprocs(%d) returned %d, expected %d\n", max, ret, expected_ret);
+     5ef:	68 c4 14 00 00       	push   $0x14c4
+     5f4:	6a 02                	push   $0x2
+     5f6:	e8 55 09 00 00       	call   f50 <printf>
+    success = -1;
+     5fb:	83 c4 20             	add    $0x20,%esp
+     5fe:	eb d3                	jmp    5d3 <testprocarray+0x43>
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+     600:	68 f1 00 00 00       	push   $0xf1
+     605:	68 e8 1a 00 00       	push   $0x1ae8
+     60a:	68 98 14 00 00       	push   $0x1498
+     60f:	6a 02                	push   $0x2
+     611:	e8 3a 09 00 00       	call   f50 <printf>
+    exit();
+     616:	e8 38 07 00 00       	call   d53 <exit>
+     61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     61f:	90                   	nop
+
+00000620 <testuid>:
+testuid(uint new_val, uint expected_get_val, int expected_set_ret){
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	57                   	push   %edi
+     624:	89 cf                	mov    %ecx,%edi
+     626:	56                   	push   %esi
+     627:	89 d6                	mov    %edx,%esi
+     629:	53                   	push   %ebx
+     62a:	89 c3                	mov    %eax,%ebx
+     62c:	83 ec 1c             	sub    $0x1c,%esp
+  pre_uid = getuid();
+     62f:	e8 17 08 00 00       	call   e4b <getuid>
+  ret = setuid(new_val);
+     634:	83 ec 0c             	sub    $0xc,%esp
+  pre_uid = getuid();
+     637:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  ret = setuid(new_val);
+     63a:	53                   	push   %ebx
+     63b:	e8 23 08 00 00       	call   e63 <setuid>
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     640:	83 c4 10             	add    $0x10,%esp
+  int success = 0;
+     643:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     64a:	89 c2                	mov    %eax,%edx
+     64c:	31 fa                	xor    %edi,%edx
+     64e:	78 14                	js     664 <testuid+0x44>
+  post_uid = getuid();
+     650:	e8 f6 07 00 00       	call   e4b <getuid>
+  if(post_uid != expected_get_val){
+     655:	39 f0                	cmp    %esi,%eax
+     657:	75 29                	jne    682 <testuid+0x62>
+}
+     659:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     65c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     65f:	5b                   	pop    %ebx
+     660:	5e                   	pop    %esi
+     661:	5f                   	pop    %edi
+     662:	5d                   	pop    %ebp
+     663:	c3                   	ret
+    printf(2, "FAILED: setuid(%d) returned %d, expected %d\n", new_val, ret, expected_set_ret);
+     664:	83 ec 0c             	sub    $0xc,%esp
+     667:	57                   	push   %edi
+     668:	50                   	push   %eax
+     669:	53                   	push   %ebx
+     66a:	68 34 15 00 00       	push   $0x1534
+     66f:	6a 02                	push   $0x2
+     671:	e8 da 08 00 00       	call   f50 <printf>
+    success = -1;
+     676:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+    printf(2, "FAILED: setuid(%d) returned %d, expected %d\n", new_val, ret, expected_set_ret);
+     67d:	83 c4 20             	add    $0x20,%esp
+     680:	eb ce                	jmp    650 <testuid+0x30>
+    printf(2, "FAILED: UID was %d. After setuid(%d), getuid() returned %d, expected %d\n",
+     682:	52                   	push   %edx
+     683:	52                   	push   %edx
+     684:	56                   	push   %esi
+     685:	50                   	push   %eax
+     686:	53                   	push   %ebx
+     687:	ff 75 e0             	push   -0x20(%ebp)
+     68a:	68 64 15 00 00       	push   $0x1564
+     68f:	6a 02                	push   $0x2
+     691:	e8 ba 08 00 00       	call   f50 <printf>
+    success = -1;
+     696:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+    printf(2, "FAILED: UID was %d. After setuid(%d), getuid() returned %d, expected %d\n",
+     69d:	83 c4 20             	add    $0x20,%esp
+  return success;
+     6a0:	eb b7                	jmp    659 <testuid+0x39>
+     6a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <testgid>:
+testgid(uint new_val, uint expected_get_val, int expected_set_ret){
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	57                   	push   %edi
+     6b4:	89 cf                	mov    %ecx,%edi
+     6b6:	56                   	push   %esi
+     6b7:	89 d6                	mov    %edx,%esi
+     6b9:	53                   	push   %ebx
+     6ba:	89 c3                	mov    %eax,%ebx
+     6bc:	83 ec 1c             	sub    $0x1c,%esp
+  pre_gid = getgid();
+     6bf:	e8 8f 07 00 00       	call   e53 <getgid>
+  ret = setgid(new_val);
+     6c4:	83 ec 0c             	sub    $0xc,%esp
+  pre_gid = getgid();
+     6c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  ret = setgid(new_val);
+     6ca:	53                   	push   %ebx
+     6cb:	e8 9b 07 00 00       	call   e6b <setgid>
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     6d0:	83 c4 10             	add    $0x10,%esp
+  int success = 0;
+     6d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     6da:	89 c2                	mov    %eax,%edx
+     6dc:	31 fa                	xor    %edi,%edx
+     6de:	78 14                	js     6f4 <testgid+0x44>
+  post_gid = getgid();
+     6e0:	e8 6e 07 00 00       	call   e53 <getgid>
+  if(post_gid != expected_get_val){
+     6e5:	39 f0                	cmp    %esi,%eax
+     6e7:	75 29                	jne    712 <testgid+0x62>
+}
+     6e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     6ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6ef:	5b                   	pop    %ebx
+     6f0:	5e                   	pop    %esi
+     6f1:	5f                   	pop    %edi
+     6f2:	5d                   	pop    %ebp
+     6f3:	c3                   	ret
+    printf(2, "FAILED: setgid(%d) returned %d, expected %d\n", new_val, ret, expected_set_ret);
+     6f4:	83 ec 0c             	sub    $0xc,%esp
+     6f7:	57                   	push   %edi
+     6f8:	50                   	push   %eax
+     6f9:	53                   	push   %ebx
+     6fa:	68 b0 15 00 00       	push   $0x15b0
+     6ff:	6a 02                	push   $0x2
+     701:	e8 4a 08 00 00       	call   f50 <printf>
+    success = -1;
+     706:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+    printf(2, "FAILED: setgid(%d) returned %d, expected %d\n", new_val, ret, expected_set_ret);
+     70d:	83 c4 20             	add    $0x20,%esp
+     710:	eb ce                	jmp    6e0 <testgid+0x30>
+    printf(2, "FAILED: UID was %d. After setgid(%d), getgid() returned %d, expected %d\n",
+     712:	52                   	push   %edx
+     713:	52                   	push   %edx
+     714:	56                   	push   %esi
+     715:	50                   	push   %eax
+     716:	53                   	push   %ebx
+     717:	ff 75 e0             	push   -0x20(%ebp)
+     71a:	68 e0 15 00 00       	push   $0x15e0
+     71f:	6a 02                	push   $0x2
+     721:	e8 2a 08 00 00       	call   f50 <printf>
+    success = -1;
+     726:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+    printf(2, "FAILED: UID was %d. After setgid(%d), getgid() returned %d, expected %d\n",
+     72d:	83 c4 20             	add    $0x20,%esp
+  return success;
+     730:	eb b7                	jmp    6e9 <testgid+0x39>
+     732:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <getcputime>:
+getcputime(char * name, struct uproc * table){
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	57                   	push   %edi
+     744:	89 c7                	mov    %eax,%edi
+     746:	56                   	push   %esi
+     747:	53                   	push   %ebx
+     748:	89 d3                	mov    %edx,%ebx
+     74a:	83 ec 24             	sub    $0x24,%esp
+  size = getprocs(64, table);
+     74d:	52                   	push   %edx
+     74e:	6a 40                	push   $0x40
+     750:	e8 1e 07 00 00       	call   e73 <getprocs>
+  for(int i = 0; i < size; ++i){
+     755:	83 c4 10             	add    $0x10,%esp
+  size = getprocs(64, table);
+     758:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(int i = 0; i < size; ++i){
+     75b:	85 c0                	test   %eax,%eax
+     75d:	7e 41                	jle    7a0 <getcputime+0x60>
+     75f:	31 f6                	xor    %esi,%esi
+     761:	eb 10                	jmp    773 <getcputime+0x33>
+     763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     767:	90                   	nop
+     768:	83 c6 01             	add    $0x1,%esi
+     76b:	83 c3 68             	add    $0x68,%ebx
+     76e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+     771:	74 2d                	je     7a0 <getcputime+0x60>
+    if(strcmp(table[i].name, name) == 0){
+     773:	83 ec 08             	sub    $0x8,%esp
+     776:	8d 43 48             	lea    0x48(%ebx),%eax
+     779:	57                   	push   %edi
+     77a:	50                   	push   %eax
+     77b:	e8 20 03 00 00       	call   aa0 <strcmp>
+     780:	83 c4 10             	add    $0x10,%esp
+     783:	85 c0                	test   %eax,%eax
+     785:	75 e1                	jne    768 <getcputime+0x28>
+  if(p == 0){
+     787:	85 db                	test   %ebx,%ebx
+     789:	74 15                	je     7a0 <getcputime+0x60>
+    return p->CPU_total_ticks;
+     78b:	8b 43 18             	mov    0x18(%ebx),%eax
+}
+     78e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     791:	5b                   	pop    %ebx
+     792:	5e                   	pop    %esi
+     793:	5f                   	pop    %edi
+     794:	5d                   	pop    %ebp
+     795:	c3                   	ret
+     796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "FAILED: Test program \"%s\" not found in table returned by getprocs\n", name);
+     7a0:	83 ec 04             	sub    $0x4,%esp
+     7a3:	57                   	push   %edi
+     7a4:	68 2c 16 00 00       	push   $0x162c
+     7a9:	6a 02                	push   $0x2
+     7ab:	e8 a0 07 00 00       	call   f50 <printf>
+     7b0:	83 c4 10             	add    $0x10,%esp
+     7b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7b8:	eb d4                	jmp    78e <getcputime+0x4e>
+     7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007c0 <testtimewitharg>:
+testtimewitharg(char **arg){
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	53                   	push   %ebx
+     7c4:	83 ec 04             	sub    $0x4,%esp
+     7c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  ret = fork();
+     7ca:	e8 7c 05 00 00       	call   d4b <fork>
+  if (ret == 0){
+     7cf:	85 c0                	test   %eax,%eax
+     7d1:	74 2c                	je     7ff <testtimewitharg+0x3f>
+  else if(ret == -1){
+     7d3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     7d6:	74 10                	je     7e8 <testtimewitharg+0x28>
+}
+     7d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7db:	c9                   	leave
+    wait();
+     7dc:	e9 7a 05 00 00       	jmp    d5b <wait>
+     7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(2, "FAILED: fork failed\n");
+     7e8:	83 ec 08             	sub    $0x8,%esp
+     7eb:	68 fb 19 00 00       	push   $0x19fb
+     7f0:	6a 02                	push   $0x2
+     7f2:	e8 59 07 00 00       	call   f50 <printf>
+}
+     7f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7fa:	83 c4 10             	add    $0x10,%esp
+     7fd:	c9                   	leave
+     7fe:	c3                   	ret
+    exec(arg[0], arg);
+     7ff:	50                   	push   %eax
+     800:	50                   	push   %eax
+     801:	53                   	push   %ebx
+     802:	ff 33                	push   (%ebx)
+     804:	e8 82 05 00 00       	call   d8b <exec>
+    printf(2, "FAILED: exec failed to execute %s\n", arg[0]);
+     809:	83 c4 0c             	add    $0xc,%esp
+     80c:	ff 33                	push   (%ebx)
+     80e:	68 70 16 00 00       	push   $0x1670
+     813:	6a 02                	push   $0x2
+     815:	e8 36 07 00 00       	call   f50 <printf>
+    exit();
+     81a:	e8 34 05 00 00       	call   d53 <exit>
+     81f:	90                   	nop
+
+00000820 <testtime>:
+testtime(void){
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	57                   	push   %edi
+     824:	56                   	push   %esi
+     825:	53                   	push   %ebx
+     826:	83 ec 28             	sub    $0x28,%esp
+  char **arg1 = malloc(sizeof(char *));
+     829:	6a 04                	push   $0x4
+     82b:	e8 a0 0a 00 00       	call   12d0 <malloc>
+     830:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  char **arg2 = malloc(sizeof(char *)*2);
+     833:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     83a:	e8 91 0a 00 00       	call   12d0 <malloc>
+  char **arg3 = malloc(sizeof(char *)*2);
+     83f:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+  char **arg2 = malloc(sizeof(char *)*2);
+     846:	89 c7                	mov    %eax,%edi
+  char **arg3 = malloc(sizeof(char *)*2);
+     848:	e8 83 0a 00 00       	call   12d0 <malloc>
+  char **arg4 = malloc(sizeof(char *)*4);
+     84d:	c7 04 24 10 00 00 00 	movl   $0x10,(%esp)
+  char **arg3 = malloc(sizeof(char *)*2);
+     854:	89 c6                	mov    %eax,%esi
+  char **arg4 = malloc(sizeof(char *)*4);
+     856:	e8 75 0a 00 00       	call   12d0 <malloc>
+  arg1[0] = malloc(sizeof(char) * 5);
+     85b:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+  char **arg4 = malloc(sizeof(char *)*4);
+     862:	89 c3                	mov    %eax,%ebx
+  arg1[0] = malloc(sizeof(char) * 5);
+     864:	e8 67 0a 00 00       	call   12d0 <malloc>
+     869:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     86c:	89 02                	mov    %eax,(%edx)
+  strcpy(arg1[0], "time");
+     86e:	5a                   	pop    %edx
+     86f:	59                   	pop    %ecx
+     870:	68 10 1a 00 00       	push   $0x1a10
+     875:	50                   	push   %eax
+     876:	e8 f5 01 00 00       	call   a70 <strcpy>
+  arg2[0] = malloc(sizeof(char) * 5);
+     87b:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     882:	e8 49 0a 00 00       	call   12d0 <malloc>
+     887:	89 07                	mov    %eax,(%edi)
+  strcpy(arg2[0], "time");
+     889:	5a                   	pop    %edx
+     88a:	59                   	pop    %ecx
+     88b:	68 10 1a 00 00       	push   $0x1a10
+     890:	50                   	push   %eax
+     891:	e8 da 01 00 00       	call   a70 <strcpy>
+  arg2[1] = malloc(sizeof(char) * 4);
+     896:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+     89d:	e8 2e 0a 00 00       	call   12d0 <malloc>
+     8a2:	89 47 04             	mov    %eax,0x4(%edi)
+  strcpy(arg2[1], "abc");
+     8a5:	5a                   	pop    %edx
+     8a6:	59                   	pop    %ecx
+     8a7:	68 15 1a 00 00       	push   $0x1a15
+     8ac:	50                   	push   %eax
+     8ad:	e8 be 01 00 00       	call   a70 <strcpy>
+  arg3[0] = malloc(sizeof(char) * 5);
+     8b2:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     8b9:	e8 12 0a 00 00       	call   12d0 <malloc>
+     8be:	89 06                	mov    %eax,(%esi)
+  strcpy(arg3[0], "time");
+     8c0:	5a                   	pop    %edx
+     8c1:	59                   	pop    %ecx
+     8c2:	68 10 1a 00 00       	push   $0x1a10
+     8c7:	50                   	push   %eax
+     8c8:	e8 a3 01 00 00       	call   a70 <strcpy>
+  arg3[1] = malloc(sizeof(char) * 5);
+     8cd:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     8d4:	e8 f7 09 00 00       	call   12d0 <malloc>
+     8d9:	89 46 04             	mov    %eax,0x4(%esi)
+  strcpy(arg3[1], "date");
+     8dc:	5a                   	pop    %edx
+     8dd:	59                   	pop    %ecx
+     8de:	68 19 1a 00 00       	push   $0x1a19
+     8e3:	50                   	push   %eax
+     8e4:	e8 87 01 00 00       	call   a70 <strcpy>
+  arg4[0] = malloc(sizeof(char) * 5);
+     8e9:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     8f0:	e8 db 09 00 00       	call   12d0 <malloc>
+     8f5:	89 03                	mov    %eax,(%ebx)
+  strcpy(arg4[0], "time");
+     8f7:	5a                   	pop    %edx
+     8f8:	59                   	pop    %ecx
+     8f9:	68 10 1a 00 00       	push   $0x1a10
+     8fe:	50                   	push   %eax
+     8ff:	e8 6c 01 00 00       	call   a70 <strcpy>
+  arg4[1] = malloc(sizeof(char) * 5);
+     904:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     90b:	e8 c0 09 00 00       	call   12d0 <malloc>
+     910:	89 43 04             	mov    %eax,0x4(%ebx)
+  strcpy(arg4[1], "time");
+     913:	5a                   	pop    %edx
+     914:	59                   	pop    %ecx
+     915:	68 10 1a 00 00       	push   $0x1a10
+     91a:	50                   	push   %eax
+     91b:	e8 50 01 00 00       	call   a70 <strcpy>
+  arg4[2] = malloc(sizeof(char) * 5);
+     920:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     927:	e8 a4 09 00 00       	call   12d0 <malloc>
+     92c:	89 43 08             	mov    %eax,0x8(%ebx)
+  strcpy(arg4[2], "echo");
+     92f:	5a                   	pop    %edx
+     930:	59                   	pop    %ecx
+     931:	68 1e 1a 00 00       	push   $0x1a1e
+     936:	50                   	push   %eax
+     937:	e8 34 01 00 00       	call   a70 <strcpy>
+  arg4[3] = malloc(sizeof(char) * 6);
+     93c:	c7 04 24 06 00 00 00 	movl   $0x6,(%esp)
+     943:	e8 88 09 00 00       	call   12d0 <malloc>
+     948:	89 43 0c             	mov    %eax,0xc(%ebx)
+  strcpy(arg4[3], "\"abc\"");
+     94b:	5a                   	pop    %edx
+     94c:	59                   	pop    %ecx
+     94d:	68 23 1a 00 00       	push   $0x1a23
+     952:	50                   	push   %eax
+     953:	e8 18 01 00 00       	call   a70 <strcpy>
+  printf(1, "\n----------\nRunning Time Test\n----------\n");
+     958:	58                   	pop    %eax
+     959:	5a                   	pop    %edx
+     95a:	68 94 16 00 00       	push   $0x1694
+     95f:	6a 01                	push   $0x1
+     961:	e8 ea 05 00 00       	call   f50 <printf>
+  printf(1, "You will need to verify these tests passed\n");
+     966:	59                   	pop    %ecx
+     967:	58                   	pop    %eax
+     968:	68 c0 16 00 00       	push   $0x16c0
+     96d:	6a 01                	push   $0x1
+     96f:	e8 dc 05 00 00       	call   f50 <printf>
+  printf(1,"\n%s\n", arg1[0]);
+     974:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     977:	83 c4 0c             	add    $0xc,%esp
+     97a:	ff 32                	push   (%edx)
+     97c:	68 29 1a 00 00       	push   $0x1a29
+     981:	6a 01                	push   $0x1
+     983:	e8 c8 05 00 00       	call   f50 <printf>
+  testtimewitharg(arg1);
+     988:	58                   	pop    %eax
+     989:	ff 75 e4             	push   -0x1c(%ebp)
+     98c:	e8 2f fe ff ff       	call   7c0 <testtimewitharg>
+  printf(1,"\n%s %s\n", arg2[0], arg2[1]);
+     991:	ff 77 04             	push   0x4(%edi)
+     994:	ff 37                	push   (%edi)
+     996:	68 2e 1a 00 00       	push   $0x1a2e
+     99b:	6a 01                	push   $0x1
+     99d:	e8 ae 05 00 00       	call   f50 <printf>
+  testtimewitharg(arg2);
+     9a2:	83 c4 14             	add    $0x14,%esp
+     9a5:	57                   	push   %edi
+     9a6:	e8 15 fe ff ff       	call   7c0 <testtimewitharg>
+  printf(1,"\n%s %s\n", arg3[0], arg3[1]);
+     9ab:	ff 76 04             	push   0x4(%esi)
+     9ae:	ff 36                	push   (%esi)
+     9b0:	68 2e 1a 00 00       	push   $0x1a2e
+     9b5:	6a 01                	push   $0x1
+     9b7:	e8 94 05 00 00       	call   f50 <printf>
+  testtimewitharg(arg3);
+     9bc:	83 c4 14             	add    $0x14,%esp
+     9bf:	56                   	push   %esi
+     9c0:	e8 fb fd ff ff       	call   7c0 <testtimewitharg>
+  printf(1,"\n%s %s %s %s\n", arg4[0], arg4[1], arg4[2], arg4[3]);
+     9c5:	58                   	pop    %eax
+     9c6:	5a                   	pop    %edx
+     9c7:	ff 73 0c             	push   0xc(%ebx)
+     9ca:	ff 73 08             	push   0x8(%ebx)
+     9cd:	ff 73 04             	push   0x4(%ebx)
+     9d0:	ff 33                	push   (%ebx)
+     9d2:	68 36 1a 00 00       	push   $0x1a36
+     9d7:	6a 01                	push   $0x1
+     9d9:	e8 72 05 00 00       	call   f50 <printf>
+  testtimewitharg(arg4);
+     9de:	83 c4 14             	add    $0x14,%esp
+     9e1:	53                   	push   %ebx
+     9e2:	e8 d9 fd ff ff       	call   7c0 <testtimewitharg>
+  free(arg1[0]);
+     9e7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     9ea:	59                   	pop    %ecx
+     9eb:	ff 32                	push   (%edx)
+     9ed:	e8 6e 08 00 00       	call   1260 <free>
+  free(arg1);
+     9f2:	58                   	pop    %eax
+     9f3:	ff 75 e4             	push   -0x1c(%ebp)
+     9f6:	e8 65 08 00 00       	call   1260 <free>
+  free(arg2[0]); free(arg2[1]);
+     9fb:	58                   	pop    %eax
+     9fc:	ff 37                	push   (%edi)
+     9fe:	e8 5d 08 00 00       	call   1260 <free>
+     a03:	58                   	pop    %eax
+     a04:	ff 77 04             	push   0x4(%edi)
+     a07:	e8 54 08 00 00       	call   1260 <free>
+  free(arg2);
+     a0c:	89 3c 24             	mov    %edi,(%esp)
+     a0f:	e8 4c 08 00 00       	call   1260 <free>
+  free(arg3[0]); free(arg3[1]);
+     a14:	58                   	pop    %eax
+     a15:	ff 36                	push   (%esi)
+     a17:	e8 44 08 00 00       	call   1260 <free>
+     a1c:	58                   	pop    %eax
+     a1d:	ff 76 04             	push   0x4(%esi)
+     a20:	e8 3b 08 00 00       	call   1260 <free>
+  free(arg3);
+     a25:	89 34 24             	mov    %esi,(%esp)
+     a28:	e8 33 08 00 00       	call   1260 <free>
+  free(arg4[0]); free(arg4[1]); free(arg4[2]); free(arg4[3]);
+     a2d:	5a                   	pop    %edx
+     a2e:	ff 33                	push   (%ebx)
+     a30:	e8 2b 08 00 00       	call   1260 <free>
+     a35:	59                   	pop    %ecx
+     a36:	ff 73 04             	push   0x4(%ebx)
+     a39:	e8 22 08 00 00       	call   1260 <free>
+     a3e:	5e                   	pop    %esi
+     a3f:	ff 73 08             	push   0x8(%ebx)
+     a42:	e8 19 08 00 00       	call   1260 <free>
+     a47:	5f                   	pop    %edi
+     a48:	ff 73 0c             	push   0xc(%ebx)
+     a4b:	e8 10 08 00 00       	call   1260 <free>
+  free(arg4);
+     a50:	89 1c 24             	mov    %ebx,(%esp)
+     a53:	e8 08 08 00 00       	call   1260 <free>
+}
+     a58:	83 c4 10             	add    $0x10,%esp
+     a5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a5e:	5b                   	pop    %ebx
+     a5f:	5e                   	pop    %esi
+     a60:	5f                   	pop    %edi
+     a61:	5d                   	pop    %ebp
+     a62:	c3                   	ret
+     a63:	66 90                	xchg   %ax,%ax
+     a65:	66 90                	xchg   %ax,%ax
+     a67:	66 90                	xchg   %ax,%ax
+     a69:	66 90                	xchg   %ax,%ax
+     a6b:	66 90                	xchg   %ax,%ax
+     a6d:	66 90                	xchg   %ax,%ax
+     a6f:	90                   	nop
+
+00000a70 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     a70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     a71:	31 c0                	xor    %eax,%eax
+{
+     a73:	89 e5                	mov    %esp,%ebp
+     a75:	53                   	push   %ebx
+     a76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     a79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     a80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     a84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     a87:	83 c0 01             	add    $0x1,%eax
+     a8a:	84 d2                	test   %dl,%dl
+     a8c:	75 f2                	jne    a80 <strcpy+0x10>
+    ;
+  return os;
+}
+     a8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a91:	89 c8                	mov    %ecx,%eax
+     a93:	c9                   	leave
+     a94:	c3                   	ret
+     a95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000aa0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	53                   	push   %ebx
+     aa4:	8b 55 08             	mov    0x8(%ebp),%edx
+     aa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     aaa:	0f b6 02             	movzbl (%edx),%eax
+     aad:	84 c0                	test   %al,%al
+     aaf:	75 17                	jne    ac8 <strcmp+0x28>
+     ab1:	eb 3a                	jmp    aed <strcmp+0x4d>
+     ab3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ab7:	90                   	nop
+     ab8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     abc:	83 c2 01             	add    $0x1,%edx
+     abf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     ac2:	84 c0                	test   %al,%al
+     ac4:	74 1a                	je     ae0 <strcmp+0x40>
+    p++, q++;
+     ac6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     ac8:	0f b6 19             	movzbl (%ecx),%ebx
+     acb:	38 c3                	cmp    %al,%bl
+     acd:	74 e9                	je     ab8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     acf:	29 d8                	sub    %ebx,%eax
+}
+     ad1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ad4:	c9                   	leave
+     ad5:	c3                   	ret
+     ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     add:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     ae0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     ae4:	31 c0                	xor    %eax,%eax
+     ae6:	29 d8                	sub    %ebx,%eax
+}
+     ae8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     aeb:	c9                   	leave
+     aec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     aed:	0f b6 19             	movzbl (%ecx),%ebx
+     af0:	31 c0                	xor    %eax,%eax
+     af2:	eb db                	jmp    acf <strcmp+0x2f>
+     af4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aff:	90                   	nop
+
+00000b00 <strlen>:
+
+uint
+strlen(char *s)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     b06:	80 3a 00             	cmpb   $0x0,(%edx)
+     b09:	74 15                	je     b20 <strlen+0x20>
+     b0b:	31 c0                	xor    %eax,%eax
+     b0d:	8d 76 00             	lea    0x0(%esi),%esi
+     b10:	83 c0 01             	add    $0x1,%eax
+     b13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     b17:	89 c1                	mov    %eax,%ecx
+     b19:	75 f5                	jne    b10 <strlen+0x10>
+    ;
+  return n;
+}
+     b1b:	89 c8                	mov    %ecx,%eax
+     b1d:	5d                   	pop    %ebp
+     b1e:	c3                   	ret
+     b1f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     b20:	31 c9                	xor    %ecx,%ecx
+}
+     b22:	5d                   	pop    %ebp
+     b23:	89 c8                	mov    %ecx,%eax
+     b25:	c3                   	ret
+     b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b30 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	57                   	push   %edi
+     b34:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     b37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b3d:	89 d7                	mov    %edx,%edi
+     b3f:	fc                   	cld
+     b40:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     b42:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     b45:	89 d0                	mov    %edx,%eax
+     b47:	c9                   	leave
+     b48:	c3                   	ret
+     b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b50 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	8b 45 08             	mov    0x8(%ebp),%eax
+     b56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     b5a:	0f b6 10             	movzbl (%eax),%edx
+     b5d:	84 d2                	test   %dl,%dl
+     b5f:	75 12                	jne    b73 <strchr+0x23>
+     b61:	eb 1d                	jmp    b80 <strchr+0x30>
+     b63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b67:	90                   	nop
+     b68:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     b6c:	83 c0 01             	add    $0x1,%eax
+     b6f:	84 d2                	test   %dl,%dl
+     b71:	74 0d                	je     b80 <strchr+0x30>
+    if(*s == c)
+     b73:	38 d1                	cmp    %dl,%cl
+     b75:	75 f1                	jne    b68 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     b77:	5d                   	pop    %ebp
+     b78:	c3                   	ret
+     b79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     b80:	31 c0                	xor    %eax,%eax
+}
+     b82:	5d                   	pop    %ebp
+     b83:	c3                   	ret
+     b84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b8f:	90                   	nop
+
+00000b90 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     b90:	55                   	push   %ebp
+     b91:	89 e5                	mov    %esp,%ebp
+     b93:	57                   	push   %edi
+     b94:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     b95:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     b98:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     b99:	31 db                	xor    %ebx,%ebx
+{
+     b9b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     b9e:	eb 27                	jmp    bc7 <gets+0x37>
+    cc = read(0, &c, 1);
+     ba0:	83 ec 04             	sub    $0x4,%esp
+     ba3:	6a 01                	push   $0x1
+     ba5:	56                   	push   %esi
+     ba6:	6a 00                	push   $0x0
+     ba8:	e8 be 01 00 00       	call   d6b <read>
+    if(cc < 1)
+     bad:	83 c4 10             	add    $0x10,%esp
+     bb0:	85 c0                	test   %eax,%eax
+     bb2:	7e 1d                	jle    bd1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     bb4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     bb8:	8b 55 08             	mov    0x8(%ebp),%edx
+     bbb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     bbf:	3c 0a                	cmp    $0xa,%al
+     bc1:	74 10                	je     bd3 <gets+0x43>
+     bc3:	3c 0d                	cmp    $0xd,%al
+     bc5:	74 0c                	je     bd3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     bc7:	89 df                	mov    %ebx,%edi
+     bc9:	83 c3 01             	add    $0x1,%ebx
+     bcc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     bcf:	7c cf                	jl     ba0 <gets+0x10>
+     bd1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     bda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bdd:	5b                   	pop    %ebx
+     bde:	5e                   	pop    %esi
+     bdf:	5f                   	pop    %edi
+     be0:	5d                   	pop    %ebp
+     be1:	c3                   	ret
+     be2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bf0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	56                   	push   %esi
+     bf4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     bf5:	83 ec 08             	sub    $0x8,%esp
+     bf8:	6a 00                	push   $0x0
+     bfa:	ff 75 08             	push   0x8(%ebp)
+     bfd:	e8 91 01 00 00       	call   d93 <open>
+  if(fd < 0)
+     c02:	83 c4 10             	add    $0x10,%esp
+     c05:	85 c0                	test   %eax,%eax
+     c07:	78 27                	js     c30 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     c09:	83 ec 08             	sub    $0x8,%esp
+     c0c:	ff 75 0c             	push   0xc(%ebp)
+     c0f:	89 c3                	mov    %eax,%ebx
+     c11:	50                   	push   %eax
+     c12:	e8 94 01 00 00       	call   dab <fstat>
+  close(fd);
+     c17:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     c1a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     c1c:	e8 5a 01 00 00       	call   d7b <close>
+  return r;
+     c21:	83 c4 10             	add    $0x10,%esp
+}
+     c24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c27:	89 f0                	mov    %esi,%eax
+     c29:	5b                   	pop    %ebx
+     c2a:	5e                   	pop    %esi
+     c2b:	5d                   	pop    %ebp
+     c2c:	c3                   	ret
+     c2d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     c30:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     c35:	eb ed                	jmp    c24 <stat+0x34>
+     c37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3e:	66 90                	xchg   %ax,%ax
+
+00000c40 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	56                   	push   %esi
+     c44:	53                   	push   %ebx
+     c45:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     c48:	0f b6 02             	movzbl (%edx),%eax
+     c4b:	3c 20                	cmp    $0x20,%al
+     c4d:	75 0c                	jne    c5b <atoi+0x1b>
+     c4f:	90                   	nop
+     c50:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+     c54:	83 c2 01             	add    $0x1,%edx
+     c57:	3c 20                	cmp    $0x20,%al
+     c59:	74 f5                	je     c50 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     c5b:	3c 2d                	cmp    $0x2d,%al
+     c5d:	74 41                	je     ca0 <atoi+0x60>
+     c5f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     c64:	3c 2b                	cmp    $0x2b,%al
+     c66:	74 3d                	je     ca5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+     c68:	0f be 0a             	movsbl (%edx),%ecx
+     c6b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     c6e:	3c 09                	cmp    $0x9,%al
+     c70:	b8 00 00 00 00       	mov    $0x0,%eax
+     c75:	77 21                	ja     c98 <atoi+0x58>
+     c77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     c80:	83 c2 01             	add    $0x1,%edx
+     c83:	8d 04 80             	lea    (%eax,%eax,4),%eax
+     c86:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+     c8a:	0f be 0a             	movsbl (%edx),%ecx
+     c8d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     c90:	80 fb 09             	cmp    $0x9,%bl
+     c93:	76 eb                	jbe    c80 <atoi+0x40>
+  return sign*n;
+     c95:	0f af c6             	imul   %esi,%eax
+}
+     c98:	5b                   	pop    %ebx
+     c99:	5e                   	pop    %esi
+     c9a:	5d                   	pop    %ebp
+     c9b:	c3                   	ret
+     c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+     ca0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     ca5:	83 c2 01             	add    $0x1,%edx
+     ca8:	eb be                	jmp    c68 <atoi+0x28>
+     caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cb0 <atoo>:
+
+int
+atoo(const char *s)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	56                   	push   %esi
+     cb4:	53                   	push   %ebx
+     cb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     cb8:	0f b6 02             	movzbl (%edx),%eax
+     cbb:	3c 20                	cmp    $0x20,%al
+     cbd:	75 0c                	jne    ccb <atoo+0x1b>
+     cbf:	90                   	nop
+     cc0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+     cc4:	83 c2 01             	add    $0x1,%edx
+     cc7:	3c 20                	cmp    $0x20,%al
+     cc9:	74 f5                	je     cc0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     ccb:	3c 2d                	cmp    $0x2d,%al
+     ccd:	74 41                	je     d10 <atoo+0x60>
+     ccf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     cd4:	3c 2b                	cmp    $0x2b,%al
+     cd6:	74 3d                	je     d15 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+     cd8:	0f be 0a             	movsbl (%edx),%ecx
+     cdb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     cde:	3c 07                	cmp    $0x7,%al
+     ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ce5:	77 1e                	ja     d05 <atoo+0x55>
+     ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cee:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+     cf0:	83 c2 01             	add    $0x1,%edx
+     cf3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+     cf7:	0f be 0a             	movsbl (%edx),%ecx
+     cfa:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     cfd:	80 fb 07             	cmp    $0x7,%bl
+     d00:	76 ee                	jbe    cf0 <atoo+0x40>
+  return sign*n;
+     d02:	0f af c6             	imul   %esi,%eax
+}
+     d05:	5b                   	pop    %ebx
+     d06:	5e                   	pop    %esi
+     d07:	5d                   	pop    %ebp
+     d08:	c3                   	ret
+     d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+     d10:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     d15:	83 c2 01             	add    $0x1,%edx
+     d18:	eb be                	jmp    cd8 <atoo+0x28>
+     d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d20 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	57                   	push   %edi
+     d24:	56                   	push   %esi
+     d25:	8b 45 10             	mov    0x10(%ebp),%eax
+     d28:	8b 55 08             	mov    0x8(%ebp),%edx
+     d2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     d2e:	85 c0                	test   %eax,%eax
+     d30:	7e 13                	jle    d45 <memmove+0x25>
+     d32:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     d34:	89 d7                	mov    %edx,%edi
+     d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     d40:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     d41:	39 f8                	cmp    %edi,%eax
+     d43:	75 fb                	jne    d40 <memmove+0x20>
+  return vdst;
+}
+     d45:	5e                   	pop    %esi
+     d46:	89 d0                	mov    %edx,%eax
+     d48:	5f                   	pop    %edi
+     d49:	5d                   	pop    %ebp
+     d4a:	c3                   	ret
+
+00000d4b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     d4b:	b8 01 00 00 00       	mov    $0x1,%eax
+     d50:	cd 40                	int    $0x40
+     d52:	c3                   	ret
+
+00000d53 <exit>:
+SYSCALL(exit)
+     d53:	b8 02 00 00 00       	mov    $0x2,%eax
+     d58:	cd 40                	int    $0x40
+     d5a:	c3                   	ret
+
+00000d5b <wait>:
+SYSCALL(wait)
+     d5b:	b8 03 00 00 00       	mov    $0x3,%eax
+     d60:	cd 40                	int    $0x40
+     d62:	c3                   	ret
+
+00000d63 <pipe>:
+SYSCALL(pipe)
+     d63:	b8 04 00 00 00       	mov    $0x4,%eax
+     d68:	cd 40                	int    $0x40
+     d6a:	c3                   	ret
+
+00000d6b <read>:
+SYSCALL(read)
+     d6b:	b8 05 00 00 00       	mov    $0x5,%eax
+     d70:	cd 40                	int    $0x40
+     d72:	c3                   	ret
+
+00000d73 <write>:
+SYSCALL(write)
+     d73:	b8 10 00 00 00       	mov    $0x10,%eax
+     d78:	cd 40                	int    $0x40
+     d7a:	c3                   	ret
+
+00000d7b <close>:
+SYSCALL(close)
+     d7b:	b8 15 00 00 00       	mov    $0x15,%eax
+     d80:	cd 40                	int    $0x40
+     d82:	c3                   	ret
+
+00000d83 <kill>:
+SYSCALL(kill)
+     d83:	b8 06 00 00 00       	mov    $0x6,%eax
+     d88:	cd 40                	int    $0x40
+     d8a:	c3                   	ret
+
+00000d8b <exec>:
+SYSCALL(exec)
+     d8b:	b8 07 00 00 00       	mov    $0x7,%eax
+     d90:	cd 40                	int    $0x40
+     d92:	c3                   	ret
+
+00000d93 <open>:
+SYSCALL(open)
+     d93:	b8 0f 00 00 00       	mov    $0xf,%eax
+     d98:	cd 40                	int    $0x40
+     d9a:	c3                   	ret
+
+00000d9b <mknod>:
+SYSCALL(mknod)
+     d9b:	b8 11 00 00 00       	mov    $0x11,%eax
+     da0:	cd 40                	int    $0x40
+     da2:	c3                   	ret
+
+00000da3 <unlink>:
+SYSCALL(unlink)
+     da3:	b8 12 00 00 00       	mov    $0x12,%eax
+     da8:	cd 40                	int    $0x40
+     daa:	c3                   	ret
+
+00000dab <fstat>:
+SYSCALL(fstat)
+     dab:	b8 08 00 00 00       	mov    $0x8,%eax
+     db0:	cd 40                	int    $0x40
+     db2:	c3                   	ret
+
+00000db3 <link>:
+SYSCALL(link)
+     db3:	b8 13 00 00 00       	mov    $0x13,%eax
+     db8:	cd 40                	int    $0x40
+     dba:	c3                   	ret
+
+00000dbb <mkdir>:
+SYSCALL(mkdir)
+     dbb:	b8 14 00 00 00       	mov    $0x14,%eax
+     dc0:	cd 40                	int    $0x40
+     dc2:	c3                   	ret
+
+00000dc3 <chdir>:
+SYSCALL(chdir)
+     dc3:	b8 09 00 00 00       	mov    $0x9,%eax
+     dc8:	cd 40                	int    $0x40
+     dca:	c3                   	ret
+
+00000dcb <dup>:
+SYSCALL(dup)
+     dcb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     dd0:	cd 40                	int    $0x40
+     dd2:	c3                   	ret
+
+00000dd3 <getpid>:
+SYSCALL(getpid)
+     dd3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     dd8:	cd 40                	int    $0x40
+     dda:	c3                   	ret
+
+00000ddb <sbrk>:
+SYSCALL(sbrk)
+     ddb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     de0:	cd 40                	int    $0x40
+     de2:	c3                   	ret
+
+00000de3 <sleep>:
+SYSCALL(sleep)
+     de3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     de8:	cd 40                	int    $0x40
+     dea:	c3                   	ret
+
+00000deb <uptime>:
+SYSCALL(uptime)
+     deb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     df0:	cd 40                	int    $0x40
+     df2:	c3                   	ret
+
+00000df3 <superpages>:
+SYSCALL(superpages)
+     df3:	b8 23 00 00 00       	mov    $0x23,%eax
+     df8:	cd 40                	int    $0x40
+     dfa:	c3                   	ret
+
+00000dfb <mmap>:
+SYSCALL(mmap)
+     dfb:	b8 24 00 00 00       	mov    $0x24,%eax
+     e00:	cd 40                	int    $0x40
+     e02:	c3                   	ret
+
+00000e03 <munmap>:
+SYSCALL(munmap)
+     e03:	b8 25 00 00 00       	mov    $0x25,%eax
+     e08:	cd 40                	int    $0x40
+     e0a:	c3                   	ret
+
+00000e0b <spawn>:
+SYSCALL(spawn)
+     e0b:	b8 26 00 00 00       	mov    $0x26,%eax
+     e10:	cd 40                	int    $0x40
+     e12:	c3                   	ret
+
+00000e13 <swapstat>:
+SYSCALL(swapstat)
+     e13:	b8 27 00 00 00       	mov    $0x27,%eax
+     e18:	cd 40                	int    $0x40
+     e1a:	c3                   	ret
+
+00000e1b <getmeminfo>:
+SYSCALL(getmeminfo)
+     e1b:	b8 28 00 00 00       	mov    $0x28,%eax
+     e20:	cd 40                	int    $0x40
+     e22:	c3                   	ret
+
+00000e23 <iostat>:
+SYSCALL(iostat)
+     e23:	b8 29 00 00 00       	mov    $0x29,%eax
+     e28:	cd 40                	int    $0x40
+     e2a:	c3                   	ret
+
+00000e2b <dropcache>:
+SYSCALL(dropcache)
+     e2b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     e30:	cd 40                	int    $0x40
+     e32:	c3                   	ret
+
+00000e33 <iosched>:
+SYSCALL(iosched)
+     e33:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     e38:	cd 40                	int    $0x40
+     e3a:	c3                   	ret
+
+00000e3b <halt>:
+SYSCALL(halt)
+     e3b:	b8 16 00 00 00       	mov    $0x16,%eax
+     e40:	cd 40                	int    $0x40
+     e42:	c3                   	ret
+
+00000e43 <date>:
+SYSCALL(date)
+     e43:	b8 17 00 00 00       	mov    $0x17,%eax
+     e48:	cd 40                	int    $0x40
+     e4a:	c3                   	ret
+
+00000e4b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+     e4b:	b8 18 00 00 00       	mov    $0x18,%eax
+     e50:	cd 40                	int    $0x40
+     e52:	c3                   	ret
+
+00000e53 <getgid>:
+SYSCALL(getgid)
+     e53:	b8 19 00 00 00       	mov    $0x19,%eax
+     e58:	cd 40                	int    $0x40
+     e5a:	c3                   	ret
+
+00000e5b <getppid>:
+SYSCALL(getppid)
+     e5b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     e60:	cd 40                	int    $0x40
+     e62:	c3                   	ret
+
+00000e63 <setuid>:
+SYSCALL(setuid)
+     e63:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     e68:	cd 40                	int    $0x40
+     e6a:	c3                   	ret
+
+00000e6b <setgid>:
+SYSCALL(setgid)
+     e6b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     e70:	cd 40                	int    $0x40
+     e72:	c3                   	ret
+
+00000e73 <getprocs>:
+SYSCALL(getprocs)
+     e73:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     e78:	cd 40                	int    $0x40
+     e7a:	c3                   	ret
+
+00000e7b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+     e7b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     e80:	cd 40                	int    $0x40
+     e82:	c3                   	ret
+
+00000e83 <getpriority>:
+SYSCALL(getpriority)
+     e83:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     e88:	cd 40                	int    $0x40
+     e8a:	c3                   	ret
+
+00000e8b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+     e8b:	b8 20 00 00 00       	mov    $0x20,%eax
+     e90:	cd 40                	int    $0x40
+     e92:	c3                   	ret
+
+00000e93 <chown>:
+SYSCALL(chown)
+     e93:	b8 21 00 00 00       	mov    $0x21,%eax
+     e98:	cd 40                	int    $0x40
+     e9a:	c3                   	ret
+
+00000e9b <chgrp>:
+SYSCALL(chgrp)
+     e9b:	b8 22 00 00 00       	mov    $0x22,%eax
+     ea0:	cd 40                	int    $0x40
+     ea2:	c3                   	ret
+     ea3:	66 90                	xchg   %ax,%ax
+     ea5:	66 90                	xchg   %ax,%ax
+     ea7:	66 90                	xchg   %ax,%ax
+     ea9:	66 90                	xchg   %ax,%ax
+     eab:	66 90                	xchg   %ax,%ax
+     ead:	66 90                	xchg   %ax,%ax
+     eaf:	90                   	nop
+
+00000eb0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	57                   	push   %edi
+     eb4:	56                   	push   %esi
+     eb5:	53                   	push   %ebx
+     eb6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     eb8:	89 d1                	mov    %edx,%ecx
+{
+     eba:	83 ec 3c             	sub    $0x3c,%esp
+     ebd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     ec0:	85 d2                	test   %edx,%edx
+     ec2:	0f 89 80 00 00 00    	jns    f48 <printint+0x98>
+     ec8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     ecc:	74 7a                	je     f48 <printint+0x98>
+    x = -xx;
+     ece:	f7 d9                	neg    %ecx
+    neg = 1;
+     ed0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ed5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     ed8:	31 f6                	xor    %esi,%esi
+     eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     ee0:	89 c8                	mov    %ecx,%eax
+     ee2:	31 d2                	xor    %edx,%edx
+     ee4:	89 f7                	mov    %esi,%edi
+     ee6:	f7 f3                	div    %ebx
+     ee8:	8d 76 01             	lea    0x1(%esi),%esi
+     eeb:	0f b6 92 78 1b 00 00 	movzbl 0x1b78(%edx),%edx
+     ef2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     ef6:	89 ca                	mov    %ecx,%edx
+     ef8:	89 c1                	mov    %eax,%ecx
+     efa:	39 da                	cmp    %ebx,%edx
+     efc:	73 e2                	jae    ee0 <printint+0x30>
+  if(neg)
+     efe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     f01:	85 c0                	test   %eax,%eax
+     f03:	74 07                	je     f0c <printint+0x5c>
+    buf[i++] = '-';
+     f05:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     f0a:	89 f7                	mov    %esi,%edi
+     f0c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     f0f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     f12:	01 df                	add    %ebx,%edi
+     f14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     f18:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     f1b:	83 ec 04             	sub    $0x4,%esp
+     f1e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     f21:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     f24:	6a 01                	push   $0x1
+     f26:	50                   	push   %eax
+     f27:	56                   	push   %esi
+     f28:	e8 46 fe ff ff       	call   d73 <write>
+  while(--i >= 0)
+     f2d:	89 f8                	mov    %edi,%eax
+     f2f:	83 c4 10             	add    $0x10,%esp
+     f32:	83 ef 01             	sub    $0x1,%edi
+     f35:	39 d8                	cmp    %ebx,%eax
+     f37:	75 df                	jne    f18 <printint+0x68>
+}
+     f39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f3c:	5b                   	pop    %ebx
+     f3d:	5e                   	pop    %esi
+     f3e:	5f                   	pop    %edi
+     f3f:	5d                   	pop    %ebp
+     f40:	c3                   	ret
+     f41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     f48:	31 c0                	xor    %eax,%eax
+     f4a:	eb 89                	jmp    ed5 <printint+0x25>
+     f4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f50 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	57                   	push   %edi
+     f54:	56                   	push   %esi
+     f55:	53                   	push   %ebx
+     f56:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     f59:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     f5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     f5f:	0f b6 1e             	movzbl (%esi),%ebx
+     f62:	83 c6 01             	add    $0x1,%esi
+     f65:	84 db                	test   %bl,%bl
+     f67:	74 67                	je     fd0 <printf+0x80>
+     f69:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     f6c:	31 d2                	xor    %edx,%edx
+     f6e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     f71:	eb 34                	jmp    fa7 <printf+0x57>
+     f73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f77:	90                   	nop
+     f78:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     f7b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     f80:	83 f8 25             	cmp    $0x25,%eax
+     f83:	74 18                	je     f9d <printf+0x4d>
+  write(fd, &c, 1);
+     f85:	83 ec 04             	sub    $0x4,%esp
+     f88:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     f8b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f8e:	6a 01                	push   $0x1
+     f90:	50                   	push   %eax
+     f91:	57                   	push   %edi
+     f92:	e8 dc fd ff ff       	call   d73 <write>
+     f97:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     f9a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     f9d:	0f b6 1e             	movzbl (%esi),%ebx
+     fa0:	83 c6 01             	add    $0x1,%esi
+     fa3:	84 db                	test   %bl,%bl
+     fa5:	74 29                	je     fd0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     fa7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     faa:	85 d2                	test   %edx,%edx
+     fac:	74 ca                	je     f78 <printf+0x28>
+      }
+    } else if(state == '%'){
+     fae:	83 fa 25             	cmp    $0x25,%edx
+     fb1:	75 ea                	jne    f9d <printf+0x4d>
+      if(c == 'd'){
+     fb3:	83 f8 25             	cmp    $0x25,%eax
+     fb6:	0f 84 24 01 00 00    	je     10e0 <printf+0x190>
+     fbc:	83 e8 63             	sub    $0x63,%eax
+     fbf:	83 f8 15             	cmp    $0x15,%eax
+     fc2:	77 1c                	ja     fe0 <printf+0x90>
+     fc4:	ff 24 85 20 1b 00 00 	jmp    *0x1b20(,%eax,4)
+     fcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fd3:	5b                   	pop    %ebx
+     fd4:	5e                   	pop    %esi
+     fd5:	5f                   	pop    %edi
+     fd6:	5d                   	pop    %ebp
+     fd7:	c3                   	ret
+     fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdf:	90                   	nop
+  write(fd, &c, 1);
+     fe0:	83 ec 04             	sub    $0x4,%esp
+     fe3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     fe6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     fea:	6a 01                	push   $0x1
+     fec:	52                   	push   %edx
+     fed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     ff0:	57                   	push   %edi
+     ff1:	e8 7d fd ff ff       	call   d73 <write>
+     ff6:	83 c4 0c             	add    $0xc,%esp
+     ff9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     ffc:	6a 01                	push   $0x1
+     ffe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1001:	52                   	push   %edx
+    1002:	57                   	push   %edi
+    1003:	e8 6b fd ff ff       	call   d73 <write>
+        putc(fd, c);
+    1008:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    100b:	31 d2                	xor    %edx,%edx
+    100d:	eb 8e                	jmp    f9d <printf+0x4d>
+    100f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1010:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1013:	83 ec 0c             	sub    $0xc,%esp
+    1016:	b9 10 00 00 00       	mov    $0x10,%ecx
+    101b:	8b 13                	mov    (%ebx),%edx
+    101d:	6a 00                	push   $0x0
+    101f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1021:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1024:	e8 87 fe ff ff       	call   eb0 <printint>
+        ap++;
+    1029:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    102c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    102f:	31 d2                	xor    %edx,%edx
+    1031:	e9 67 ff ff ff       	jmp    f9d <printf+0x4d>
+    1036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1040:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1043:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1045:	83 c0 04             	add    $0x4,%eax
+    1048:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    104b:	85 db                	test   %ebx,%ebx
+    104d:	0f 84 9d 00 00 00    	je     10f0 <printf+0x1a0>
+        while(*s != 0){
+    1053:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1056:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1058:	84 c0                	test   %al,%al
+    105a:	0f 84 3d ff ff ff    	je     f9d <printf+0x4d>
+    1060:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1063:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1066:	89 de                	mov    %ebx,%esi
+    1068:	89 d3                	mov    %edx,%ebx
+    106a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1070:	83 ec 04             	sub    $0x4,%esp
+    1073:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1076:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1079:	6a 01                	push   $0x1
+    107b:	53                   	push   %ebx
+    107c:	57                   	push   %edi
+    107d:	e8 f1 fc ff ff       	call   d73 <write>
+        while(*s != 0){
+    1082:	0f b6 06             	movzbl (%esi),%eax
+    1085:	83 c4 10             	add    $0x10,%esp
+    1088:	84 c0                	test   %al,%al
+    108a:	75 e4                	jne    1070 <printf+0x120>
+      state = 0;
+    108c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    108f:	31 d2                	xor    %edx,%edx
+    1091:	e9 07 ff ff ff       	jmp    f9d <printf+0x4d>
+    1096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    10a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    10a3:	83 ec 0c             	sub    $0xc,%esp
+    10a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    10ab:	8b 13                	mov    (%ebx),%edx
+    10ad:	6a 01                	push   $0x1
+    10af:	e9 6b ff ff ff       	jmp    101f <printf+0xcf>
+    10b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    10b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    10bb:	83 ec 04             	sub    $0x4,%esp
+    10be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    10c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    10c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    10c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    10c9:	6a 01                	push   $0x1
+    10cb:	52                   	push   %edx
+    10cc:	57                   	push   %edi
+    10cd:	e8 a1 fc ff ff       	call   d73 <write>
+        ap++;
+    10d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    10d8:	31 d2                	xor    %edx,%edx
+    10da:	e9 be fe ff ff       	jmp    f9d <printf+0x4d>
+    10df:	90                   	nop
+  write(fd, &c, 1);
+    10e0:	83 ec 04             	sub    $0x4,%esp
+    10e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    10e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    10e9:	6a 01                	push   $0x1
+    10eb:	e9 11 ff ff ff       	jmp    1001 <printf+0xb1>
+    10f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    10f5:	bb 18 1b 00 00       	mov    $0x1b18,%ebx
+    10fa:	e9 61 ff ff ff       	jmp    1060 <printf+0x110>
+    10ff:	90                   	nop
+
+00001100 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1103:	a1 84 20 00 00       	mov    0x2084,%eax
+{
+    1108:	89 e5                	mov    %esp,%ebp
+    110a:	56                   	push   %esi
+    110b:	53                   	push   %ebx
+    110c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1110:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1112:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1114:	39 ca                	cmp    %ecx,%edx
+    1116:	73 30                	jae    1148 <lfree+0x48>
+    1118:	39 c1                	cmp    %eax,%ecx
+    111a:	72 04                	jb     1120 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    111c:	39 c2                	cmp    %eax,%edx
+    111e:	72 f0                	jb     1110 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1120:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1123:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1126:	39 f0                	cmp    %esi,%eax
+    1128:	74 26                	je     1150 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    112a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    112c:	8b 42 04             	mov    0x4(%edx),%eax
+    112f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    1132:	39 d9                	cmp    %ebx,%ecx
+    1134:	74 30                	je     1166 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1136:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1138:	5b                   	pop    %ebx
+  freep = p;
+    1139:	89 15 84 20 00 00    	mov    %edx,0x2084
+}
+    113f:	5e                   	pop    %esi
+    1140:	5d                   	pop    %ebp
+    1141:	c3                   	ret
+    1142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1148:	39 c1                	cmp    %eax,%ecx
+    114a:	72 d0                	jb     111c <lfree+0x1c>
+    114c:	eb c2                	jmp    1110 <lfree+0x10>
+    114e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1150:	03 58 04             	add    0x4(%eax),%ebx
+    1153:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1156:	8b 02                	mov    (%edx),%eax
+    1158:	8b 00                	mov    (%eax),%eax
+    115a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+    115c:	8b 42 04             	mov    0x4(%edx),%eax
+    115f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    1162:	39 d9                	cmp    %ebx,%ecx
+    1164:	75 d0                	jne    1136 <lfree+0x36>
+    p->s.size += bp->s.size;
+    1166:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+    1169:	89 15 84 20 00 00    	mov    %edx,0x2084
+    p->s.size += bp->s.size;
+    116f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1172:	8b 09                	mov    (%ecx),%ecx
+    1174:	89 0a                	mov    %ecx,(%edx)
+}
+    1176:	5b                   	pop    %ebx
+    1177:	5e                   	pop    %esi
+    1178:	5d                   	pop    %ebp
+    1179:	c3                   	ret
+    117a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001180 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	57                   	push   %edi
+    1184:	89 c7                	mov    %eax,%edi
+    1186:	56                   	push   %esi
+    1187:	53                   	push   %ebx
+    1188:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    118b:	a1 84 20 00 00       	mov    0x2084,%eax
+    1190:	85 c0                	test   %eax,%eax
+    1192:	0f 84 88 00 00 00    	je     1220 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1198:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    119a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+    119d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    11a2:	39 df                	cmp    %ebx,%edi
+    11a4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    11a7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+    11ae:	39 f9                	cmp    %edi,%ecx
+    11b0:	72 0f                	jb     11c1 <lalloc+0x41>
+    11b2:	eb 4c                	jmp    1200 <lalloc+0x80>
+    11b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    11b8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    11ba:	8b 4a 04             	mov    0x4(%edx),%ecx
+    11bd:	39 f9                	cmp    %edi,%ecx
+    11bf:	73 3f                	jae    1200 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    11c1:	89 d0                	mov    %edx,%eax
+    11c3:	39 15 84 20 00 00    	cmp    %edx,0x2084
+    11c9:	75 ed                	jne    11b8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    11cb:	83 ec 0c             	sub    $0xc,%esp
+    11ce:	56                   	push   %esi
+    11cf:	e8 07 fc ff ff       	call   ddb <sbrk>
+  if(p == (char*)-1)
+    11d4:	83 c4 10             	add    $0x10,%esp
+    11d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11da:	74 11                	je     11ed <lalloc+0x6d>
+  hp->s.size = nu;
+    11dc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+    11df:	e8 1c ff ff ff       	call   1100 <lfree>
+  return freep;
+    11e4:	a1 84 20 00 00       	mov    0x2084,%eax
+      if((p = morecore(nunits)) == 0)
+    11e9:	85 c0                	test   %eax,%eax
+    11eb:	75 cb                	jne    11b8 <lalloc+0x38>
+        return 0;
+  }
+}
+    11ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    11f0:	31 d2                	xor    %edx,%edx
+}
+    11f2:	5b                   	pop    %ebx
+    11f3:	89 d0                	mov    %edx,%eax
+    11f5:	5e                   	pop    %esi
+    11f6:	5f                   	pop    %edi
+    11f7:	5d                   	pop    %ebp
+    11f8:	c3                   	ret
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+    1200:	39 cf                	cmp    %ecx,%edi
+    1202:	74 4c                	je     1250 <lalloc+0xd0>
+        p->s.size -= nunits;
+    1204:	29 f9                	sub    %edi,%ecx
+    1206:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1209:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    120c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    120f:	a3 84 20 00 00       	mov    %eax,0x2084
+}
+    1214:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1217:	89 d0                	mov    %edx,%eax
+    1219:	5b                   	pop    %ebx
+    121a:	5e                   	pop    %esi
+    121b:	5f                   	pop    %edi
+    121c:	5d                   	pop    %ebp
+    121d:	c3                   	ret
+    121e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+    1220:	ba 88 20 00 00       	mov    $0x2088,%edx
+    1225:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+    1227:	c7 05 84 20 00 00 88 	movl   $0x2088,0x2084
+    122e:	20 00 00 
+    1231:	c7 05 88 20 00 00 88 	movl   $0x2088,0x2088
+    1238:	20 00 00 
+    123b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+    123d:	c7 05 8c 20 00 00 00 	movl   $0x0,0x208c
+    1244:	00 00 00 
+    1247:	e9 51 ff ff ff       	jmp    119d <lalloc+0x1d>
+    124c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+    1250:	8b 0a                	mov    (%edx),%ecx
+    1252:	89 08                	mov    %ecx,(%eax)
+    1254:	eb b9                	jmp    120f <lalloc+0x8f>
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001260 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	56                   	push   %esi
+    1265:	53                   	push   %ebx
+    1266:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+    1269:	85 f6                	test   %esi,%esi
+    126b:	74 42                	je     12af <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+    126d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+    1270:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+    1273:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+    1279:	77 3d                	ja     12b8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+    127b:	31 c9                	xor    %ecx,%ecx
+    127d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1282:	83 fa 02             	cmp    $0x2,%edx
+    1285:	74 17                	je     129e <free+0x3e>
+    1287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128e:	66 90                	xchg   %ax,%ax
+    1290:	83 c1 01             	add    $0x1,%ecx
+    1293:	89 d8                	mov    %ebx,%eax
+    1295:	d3 e0                	shl    %cl,%eax
+    1297:	83 c0 01             	add    $0x1,%eax
+    129a:	39 c2                	cmp    %eax,%edx
+    129c:	75 f2                	jne    1290 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+    129e:	8b 04 8d 60 20 00 00 	mov    0x2060(,%ecx,4),%eax
+  classes[c] = bp;
+    12a5:	89 3c 8d 60 20 00 00 	mov    %edi,0x2060(,%ecx,4)
+  bp->s.ptr = classes[c];
+    12ac:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+    12af:	5b                   	pop    %ebx
+    12b0:	5e                   	pop    %esi
+    12b1:	5f                   	pop    %edi
+    12b2:	5d                   	pop    %ebp
+    12b3:	c3                   	ret
+    12b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12b8:	5b                   	pop    %ebx
+    lfree(bp);
+    12b9:	89 f8                	mov    %edi,%eax
+}
+    12bb:	5e                   	pop    %esi
+    12bc:	5f                   	pop    %edi
+    12bd:	5d                   	pop    %ebp
+    lfree(bp);
+    12be:	e9 3d fe ff ff       	jmp    1100 <lfree>
+    12c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000012d0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	56                   	push   %esi
+    12d5:	53                   	push   %ebx
+    12d6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    12d9:	8b 45 08             	mov    0x8(%ebp),%eax
+    12dc:	83 c0 07             	add    $0x7,%eax
+    12df:	c1 e8 03             	shr    $0x3,%eax
+    12e2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+    12e5:	3d 01 01 00 00       	cmp    $0x101,%eax
+    12ea:	77 44                	ja     1330 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+    12ec:	31 c9                	xor    %ecx,%ecx
+    12ee:	ba 01 00 00 00       	mov    $0x1,%edx
+    12f3:	bb 02 00 00 00       	mov    $0x2,%ebx
+    12f8:	83 f8 02             	cmp    $0x2,%eax
+    12fb:	76 11                	jbe    130e <malloc+0x3e>
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+    1300:	83 c1 01             	add    $0x1,%ecx
+    1303:	89 d3                	mov    %edx,%ebx
+    1305:	d3 e3                	shl    %cl,%ebx
+    1307:	83 c3 01             	add    $0x1,%ebx
+    130a:	39 c3                	cmp    %eax,%ebx
+    130c:	72 f2                	jb     1300 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+    130e:	8b 04 8d 60 20 00 00 	mov    0x2060(,%ecx,4),%eax
+    1315:	85 c0                	test   %eax,%eax
+    1317:	74 2f                	je     1348 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+    1319:	8b 10                	mov    (%eax),%edx
+    131b:	89 14 8d 60 20 00 00 	mov    %edx,0x2060(,%ecx,4)
+  return (void*)(p + 1);
+    1322:	83 c0 08             	add    $0x8,%eax
+}
+    1325:	83 c4 1c             	add    $0x1c,%esp
+    1328:	5b                   	pop    %ebx
+    1329:	5e                   	pop    %esi
+    132a:	5f                   	pop    %edi
+    132b:	5d                   	pop    %ebp
+    132c:	c3                   	ret
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+    1330:	e8 4b fe ff ff       	call   1180 <lalloc>
+    1335:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+    1337:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+    133a:	85 d2                	test   %edx,%edx
+    133c:	75 e7                	jne    1325 <malloc+0x55>
+      return 0;
+    133e:	31 c0                	xor    %eax,%eax
+    1340:	eb e3                	jmp    1325 <malloc+0x55>
+    1342:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+    1348:	31 d2                	xor    %edx,%edx
+    134a:	b8 00 02 00 00       	mov    $0x200,%eax
+    134f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1352:	f7 f3                	div    %ebx
+  if(n < 4)
+    1354:	ba 04 00 00 00       	mov    $0x4,%edx
+    1359:	89 d6                	mov    %edx,%esi
+    135b:	39 d0                	cmp    %edx,%eax
+    135d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+    1360:	0f af f3             	imul   %ebx,%esi
+    1363:	89 f0                	mov    %esi,%eax
+    1365:	e8 16 fe ff ff       	call   1180 <lalloc>
+    136a:	85 c0                	test   %eax,%eax
+    136c:	74 d0                	je     133e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+    136e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1371:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+    1374:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    137b:	8b 14 8d 60 20 00 00 	mov    0x2060(,%ecx,4),%edx
+    1382:	39 f8                	cmp    %edi,%eax
+    1384:	73 22                	jae    13a8 <malloc+0xd8>
+    1386:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1389:	eb 09                	jmp    1394 <malloc+0xc4>
+    138b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    138f:	90                   	nop
+    1390:	89 c2                	mov    %eax,%edx
+    1392:	89 c8                	mov    %ecx,%eax
+    1394:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+    1397:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+    139a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+    139c:	39 f9                	cmp    %edi,%ecx
+    139e:	72 f0                	jb     1390 <malloc+0xc0>
+    13a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    13a3:	e9 73 ff ff ff       	jmp    131b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+    13a8:	89 d0                	mov    %edx,%eax
+    13aa:	8b 12                	mov    (%edx),%edx
+    13ac:	e9 6a ff ff ff       	jmp    131b <malloc+0x4b>
+    13b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13bf:	90                   	nop
+
+000013c0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	56                   	push   %esi
+    13c4:	53                   	push   %ebx
+    13c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    13c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+    13cb:	85 c9                	test   %ecx,%ecx
+    13cd:	74 06                	je     13d5 <calloc+0x15>
+    13cf:	89 c8                	mov    %ecx,%eax
+    13d1:	f7 e3                	mul    %ebx
+    13d3:	70 33                	jo     1408 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+    13d5:	0f af d9             	imul   %ecx,%ebx
+    13d8:	83 ec 0c             	sub    $0xc,%esp
+    13db:	53                   	push   %ebx
+    13dc:	e8 ef fe ff ff       	call   12d0 <malloc>
+    13e1:	83 c4 10             	add    $0x10,%esp
+    13e4:	89 c6                	mov    %eax,%esi
+    13e6:	85 c0                	test   %eax,%eax
+    13e8:	74 1e                	je     1408 <calloc+0x48>
+    memset(p, 0, n * size);
+    13ea:	83 ec 04             	sub    $0x4,%esp
+    13ed:	53                   	push   %ebx
+    13ee:	6a 00                	push   $0x0
+    13f0:	50                   	push   %eax
+    13f1:	e8 3a f7 ff ff       	call   b30 <memset>
+    13f6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    13f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13fc:	89 f0                	mov    %esi,%eax
+    13fe:	5b                   	pop    %ebx
+    13ff:	5e                   	pop    %esi
+    1400:	5d                   	pop    %ebp
+    1401:	c3                   	ret
+    1402:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1408:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    140b:	31 f6                	xor    %esi,%esi
+}
+    140d:	89 f0                	mov    %esi,%eax
+    140f:	5b                   	pop    %ebx
+    1410:	5e                   	pop    %esi
+    1411:	5d                   	pop    %ebp
+    1412:	c3                   	ret
+    1413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001420 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	57                   	push   %edi
+    1424:	56                   	push   %esi
+    1425:	53                   	push   %ebx
+    1426:	83 ec 0c             	sub    $0xc,%esp
+    1429:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    142c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    142f:	85 db                	test   %ebx,%ebx
+    1431:	74 55                	je     1488 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    1433:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    1436:	89 de                	mov    %ebx,%esi
+    1438:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    143f:	39 c7                	cmp    %eax,%edi
+    1441:	72 0d                	jb     1450 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    1443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1446:	89 f0                	mov    %esi,%eax
+    1448:	5b                   	pop    %ebx
+    1449:	5e                   	pop    %esi
+    144a:	5f                   	pop    %edi
+    144b:	5d                   	pop    %ebp
+    144c:	c3                   	ret
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    1450:	83 ec 0c             	sub    $0xc,%esp
+    1453:	50                   	push   %eax
+    1454:	e8 77 fe ff ff       	call   12d0 <malloc>
+    1459:	83 c4 10             	add    $0x10,%esp
+    145c:	89 c6                	mov    %eax,%esi
+    145e:	85 c0                	test   %eax,%eax
+    1460:	74 e1                	je     1443 <realloc+0x23>
+  memmove(p, ap, have);
+    1462:	83 ec 04             	sub    $0x4,%esp
+    1465:	57                   	push   %edi
+    1466:	53                   	push   %ebx
+    1467:	50                   	push   %eax
+    1468:	e8 b3 f8 ff ff       	call   d20 <memmove>
+  free(ap);
+    146d:	89 1c 24             	mov    %ebx,(%esp)
+    1470:	e8 eb fd ff ff       	call   1260 <free>
+  return p;
+    1475:	83 c4 10             	add    $0x10,%esp
+}
+    1478:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    147b:	89 f0                	mov    %esi,%eax
+    147d:	5b                   	pop    %ebx
+    147e:	5e                   	pop    %esi
+    147f:	5f                   	pop    %edi
+    1480:	5d                   	pop    %ebp
+    1481:	c3                   	ret
+    1482:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    1488:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    148b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    148e:	5b                   	pop    %ebx
+    148f:	5e                   	pop    %esi
+    1490:	5f                   	pop    %edi
+    1491:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    1492:	e9 39 fe ff ff       	jmp    12d0 <malloc>
@@ -0,0 +1,1611 @@
+
+_p4-test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+   0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+   1:	31 c0                	xor    %eax,%eax
+{
+   3:	89 e5                	mov    %esp,%ebp
+   5:	53                   	push   %ebx
+   6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+   9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+   c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  10:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  14:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  17:	83 c0 01             	add    $0x1,%eax
+  1a:	84 d2                	test   %dl,%dl
+  1c:	75 f2                	jne    10 <strcpy+0x10>
+    ;
+  return os;
+}
+  1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  21:	89 c8                	mov    %ecx,%eax
+  23:	c9                   	leave
+  24:	c3                   	ret
+  25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000030 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  30:	55                   	push   %ebp
+  31:	89 e5                	mov    %esp,%ebp
+  33:	53                   	push   %ebx
+  34:	8b 55 08             	mov    0x8(%ebp),%edx
+  37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  3a:	0f b6 02             	movzbl (%edx),%eax
+  3d:	84 c0                	test   %al,%al
+  3f:	75 17                	jne    58 <strcmp+0x28>
+  41:	eb 3a                	jmp    7d <strcmp+0x4d>
+  43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  47:	90                   	nop
+  48:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  4c:	83 c2 01             	add    $0x1,%edx
+  4f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  52:	84 c0                	test   %al,%al
+  54:	74 1a                	je     70 <strcmp+0x40>
+    p++, q++;
+  56:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  58:	0f b6 19             	movzbl (%ecx),%ebx
+  5b:	38 c3                	cmp    %al,%bl
+  5d:	74 e9                	je     48 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  5f:	29 d8                	sub    %ebx,%eax
+}
+  61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  64:	c9                   	leave
+  65:	c3                   	ret
+  66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  70:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  74:	31 c0                	xor    %eax,%eax
+  76:	29 d8                	sub    %ebx,%eax
+}
+  78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  7b:	c9                   	leave
+  7c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  7d:	0f b6 19             	movzbl (%ecx),%ebx
+  80:	31 c0                	xor    %eax,%eax
+  82:	eb db                	jmp    5f <strcmp+0x2f>
+  84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8f:	90                   	nop
+
+00000090 <strlen>:
+
+uint
+strlen(char *s)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  96:	80 3a 00             	cmpb   $0x0,(%edx)
+  99:	74 15                	je     b0 <strlen+0x20>
+  9b:	31 c0                	xor    %eax,%eax
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  a0:	83 c0 01             	add    $0x1,%eax
+  a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  a7:	89 c1                	mov    %eax,%ecx
+  a9:	75 f5                	jne    a0 <strlen+0x10>
+    ;
+  return n;
+}
+  ab:	89 c8                	mov    %ecx,%eax
+  ad:	5d                   	pop    %ebp
+  ae:	c3                   	ret
+  af:	90                   	nop
+  for(n = 0; s[n]; n++)
+  b0:	31 c9                	xor    %ecx,%ecx
+}
+  b2:	5d                   	pop    %ebp
+  b3:	89 c8                	mov    %ecx,%eax
+  b5:	c3                   	ret
+  b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  cd:	89 d7                	mov    %edx,%edi
+  cf:	fc                   	cld
+  d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  d5:	89 d0                	mov    %edx,%eax
+  d7:	c9                   	leave
+  d8:	c3                   	ret
+  d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  ea:	0f b6 10             	movzbl (%eax),%edx
+  ed:	84 d2                	test   %dl,%dl
+  ef:	75 12                	jne    103 <strchr+0x23>
+  f1:	eb 1d                	jmp    110 <strchr+0x30>
+  f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  f7:	90                   	nop
+  f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+  fc:	83 c0 01             	add    $0x1,%eax
+  ff:	84 d2                	test   %dl,%dl
+ 101:	74 0d                	je     110 <strchr+0x30>
+    if(*s == c)
+ 103:	38 d1                	cmp    %dl,%cl
+ 105:	75 f1                	jne    f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 107:	5d                   	pop    %ebp
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 110:	31 c0                	xor    %eax,%eax
+}
+ 112:	5d                   	pop    %ebp
+ 113:	c3                   	ret
+ 114:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+
+00000120 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 125:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 128:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 129:	31 db                	xor    %ebx,%ebx
+{
+ 12b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 12e:	eb 27                	jmp    157 <gets+0x37>
+    cc = read(0, &c, 1);
+ 130:	83 ec 04             	sub    $0x4,%esp
+ 133:	6a 01                	push   $0x1
+ 135:	56                   	push   %esi
+ 136:	6a 00                	push   $0x0
+ 138:	e8 be 01 00 00       	call   2fb <read>
+    if(cc < 1)
+ 13d:	83 c4 10             	add    $0x10,%esp
+ 140:	85 c0                	test   %eax,%eax
+ 142:	7e 1d                	jle    161 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 144:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 148:	8b 55 08             	mov    0x8(%ebp),%edx
+ 14b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 14f:	3c 0a                	cmp    $0xa,%al
+ 151:	74 10                	je     163 <gets+0x43>
+ 153:	3c 0d                	cmp    $0xd,%al
+ 155:	74 0c                	je     163 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 157:	89 df                	mov    %ebx,%edi
+ 159:	83 c3 01             	add    $0x1,%ebx
+ 15c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 15f:	7c cf                	jl     130 <gets+0x10>
+ 161:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 16a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 16d:	5b                   	pop    %ebx
+ 16e:	5e                   	pop    %esi
+ 16f:	5f                   	pop    %edi
+ 170:	5d                   	pop    %ebp
+ 171:	c3                   	ret
+ 172:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	56                   	push   %esi
+ 184:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 185:	83 ec 08             	sub    $0x8,%esp
+ 188:	6a 00                	push   $0x0
+ 18a:	ff 75 08             	push   0x8(%ebp)
+ 18d:	e8 91 01 00 00       	call   323 <open>
+  if(fd < 0)
+ 192:	83 c4 10             	add    $0x10,%esp
+ 195:	85 c0                	test   %eax,%eax
+ 197:	78 27                	js     1c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 199:	83 ec 08             	sub    $0x8,%esp
+ 19c:	ff 75 0c             	push   0xc(%ebp)
+ 19f:	89 c3                	mov    %eax,%ebx
+ 1a1:	50                   	push   %eax
+ 1a2:	e8 94 01 00 00       	call   33b <fstat>
+  close(fd);
+ 1a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1ac:	e8 5a 01 00 00       	call   30b <close>
+  return r;
+ 1b1:	83 c4 10             	add    $0x10,%esp
+}
+ 1b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1b7:	89 f0                	mov    %esi,%eax
+ 1b9:	5b                   	pop    %ebx
+ 1ba:	5e                   	pop    %esi
+ 1bb:	5d                   	pop    %ebp
+ 1bc:	c3                   	ret
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1c5:	eb ed                	jmp    1b4 <stat+0x34>
+ 1c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ce:	66 90                	xchg   %ax,%ax
+
+000001d0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	56                   	push   %esi
+ 1d4:	53                   	push   %ebx
+ 1d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1d8:	0f b6 02             	movzbl (%edx),%eax
+ 1db:	3c 20                	cmp    $0x20,%al
+ 1dd:	75 0c                	jne    1eb <atoi+0x1b>
+ 1df:	90                   	nop
+ 1e0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 1e4:	83 c2 01             	add    $0x1,%edx
+ 1e7:	3c 20                	cmp    $0x20,%al
+ 1e9:	74 f5                	je     1e0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 1eb:	3c 2d                	cmp    $0x2d,%al
+ 1ed:	74 41                	je     230 <atoi+0x60>
+ 1ef:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1f4:	3c 2b                	cmp    $0x2b,%al
+ 1f6:	74 3d                	je     235 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 1f8:	0f be 0a             	movsbl (%edx),%ecx
+ 1fb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 1fe:	3c 09                	cmp    $0x9,%al
+ 200:	b8 00 00 00 00       	mov    $0x0,%eax
+ 205:	77 21                	ja     228 <atoi+0x58>
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 210:	83 c2 01             	add    $0x1,%edx
+ 213:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 216:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 21a:	0f be 0a             	movsbl (%edx),%ecx
+ 21d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 220:	80 fb 09             	cmp    $0x9,%bl
+ 223:	76 eb                	jbe    210 <atoi+0x40>
+  return sign*n;
+ 225:	0f af c6             	imul   %esi,%eax
+}
+ 228:	5b                   	pop    %ebx
+ 229:	5e                   	pop    %esi
+ 22a:	5d                   	pop    %ebp
+ 22b:	c3                   	ret
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 235:	83 c2 01             	add    $0x1,%edx
+ 238:	eb be                	jmp    1f8 <atoi+0x28>
+ 23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000240 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+ 245:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 248:	0f b6 02             	movzbl (%edx),%eax
+ 24b:	3c 20                	cmp    $0x20,%al
+ 24d:	75 0c                	jne    25b <atoo+0x1b>
+ 24f:	90                   	nop
+ 250:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 254:	83 c2 01             	add    $0x1,%edx
+ 257:	3c 20                	cmp    $0x20,%al
+ 259:	74 f5                	je     250 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 25b:	3c 2d                	cmp    $0x2d,%al
+ 25d:	74 41                	je     2a0 <atoo+0x60>
+ 25f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 264:	3c 2b                	cmp    $0x2b,%al
+ 266:	74 3d                	je     2a5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 268:	0f be 0a             	movsbl (%edx),%ecx
+ 26b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 26e:	3c 07                	cmp    $0x7,%al
+ 270:	b8 00 00 00 00       	mov    $0x0,%eax
+ 275:	77 1e                	ja     295 <atoo+0x55>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 280:	83 c2 01             	add    $0x1,%edx
+ 283:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 287:	0f be 0a             	movsbl (%edx),%ecx
+ 28a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 28d:	80 fb 07             	cmp    $0x7,%bl
+ 290:	76 ee                	jbe    280 <atoo+0x40>
+  return sign*n;
+ 292:	0f af c6             	imul   %esi,%eax
+}
+ 295:	5b                   	pop    %ebx
+ 296:	5e                   	pop    %esi
+ 297:	5d                   	pop    %ebp
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2a5:	83 c2 01             	add    $0x1,%edx
+ 2a8:	eb be                	jmp    268 <atoo+0x28>
+ 2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002b0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+ 2b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2be:	85 c0                	test   %eax,%eax
+ 2c0:	7e 13                	jle    2d5 <memmove+0x25>
+ 2c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2c4:	89 d7                	mov    %edx,%edi
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2d1:	39 f8                	cmp    %edi,%eax
+ 2d3:	75 fb                	jne    2d0 <memmove+0x20>
+  return vdst;
+}
+ 2d5:	5e                   	pop    %esi
+ 2d6:	89 d0                	mov    %edx,%eax
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+
+000002db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <exit>:
+SYSCALL(exit)
+ 2e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <wait>:
+SYSCALL(wait)
+ 2eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <pipe>:
+SYSCALL(pipe)
+ 2f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <read>:
+SYSCALL(read)
+ 2fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <write>:
+SYSCALL(write)
+ 303:	b8 10 00 00 00       	mov    $0x10,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <close>:
+SYSCALL(close)
+ 30b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <kill>:
+SYSCALL(kill)
+ 313:	b8 06 00 00 00       	mov    $0x6,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <exec>:
+SYSCALL(exec)
+ 31b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <open>:
+SYSCALL(open)
+ 323:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <mknod>:
+SYSCALL(mknod)
+ 32b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <unlink>:
+SYSCALL(unlink)
+ 333:	b8 12 00 00 00       	mov    $0x12,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <fstat>:
+SYSCALL(fstat)
+ 33b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <link>:
+SYSCALL(link)
+ 343:	b8 13 00 00 00       	mov    $0x13,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <mkdir>:
+SYSCALL(mkdir)
+ 34b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <chdir>:
+SYSCALL(chdir)
+ 353:	b8 09 00 00 00       	mov    $0x9,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <dup>:
+SYSCALL(dup)
+ 35b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <getpid>:
+SYSCALL(getpid)
+ 363:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <sbrk>:
+SYSCALL(sbrk)
+ 36b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <sleep>:
+SYSCALL(sleep)
+ 373:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <uptime>:
+SYSCALL(uptime)
+ 37b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <superpages>:
+SYSCALL(superpages)
+ 383:	b8 23 00 00 00       	mov    $0x23,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mmap>:
+SYSCALL(mmap)
+ 38b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <munmap>:
+SYSCALL(munmap)
+ 393:	b8 25 00 00 00       	mov    $0x25,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <spawn>:
+SYSCALL(spawn)
+ 39b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <swapstat>:
+SYSCALL(swapstat)
+ 3a3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <getmeminfo>:
+SYSCALL(getmeminfo)
+ 3ab:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <iostat>:
+SYSCALL(iostat)
+ 3b3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <dropcache>:
+SYSCALL(dropcache)
+ 3bb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <iosched>:
+SYSCALL(iosched)
+ 3c3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <halt>:
+SYSCALL(halt)
+ 3cb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <date>:
+SYSCALL(date)
+ 3d3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 3db:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <getgid>:
+SYSCALL(getgid)
+ 3e3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <getppid>:
+SYSCALL(getppid)
+ 3eb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <setuid>:
+SYSCALL(setuid)
+ 3f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <setgid>:
+SYSCALL(setgid)
+ 3fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getprocs>:
+SYSCALL(getprocs)
+ 403:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 40b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getpriority>:
+SYSCALL(getpriority)
+ 413:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 41b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <chown>:
+SYSCALL(chown)
+ 423:	b8 21 00 00 00       	mov    $0x21,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <chgrp>:
+SYSCALL(chgrp)
+ 42b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+ 433:	66 90                	xchg   %ax,%ax
+ 435:	66 90                	xchg   %ax,%ax
+ 437:	66 90                	xchg   %ax,%ax
+ 439:	66 90                	xchg   %ax,%ax
+ 43b:	66 90                	xchg   %ax,%ax
+ 43d:	66 90                	xchg   %ax,%ax
+ 43f:	90                   	nop
+
+00000440 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 448:	89 d1                	mov    %edx,%ecx
+{
+ 44a:	83 ec 3c             	sub    $0x3c,%esp
+ 44d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 450:	85 d2                	test   %edx,%edx
+ 452:	0f 89 80 00 00 00    	jns    4d8 <printint+0x98>
+ 458:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 45c:	74 7a                	je     4d8 <printint+0x98>
+    x = -xx;
+ 45e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 460:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 465:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 468:	31 f6                	xor    %esi,%esi
+ 46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 470:	89 c8                	mov    %ecx,%eax
+ 472:	31 d2                	xor    %edx,%edx
+ 474:	89 f7                	mov    %esi,%edi
+ 476:	f7 f3                	div    %ebx
+ 478:	8d 76 01             	lea    0x1(%esi),%esi
+ 47b:	0f b6 92 88 0a 00 00 	movzbl 0xa88(%edx),%edx
+ 482:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 486:	89 ca                	mov    %ecx,%edx
+ 488:	89 c1                	mov    %eax,%ecx
+ 48a:	39 da                	cmp    %ebx,%edx
+ 48c:	73 e2                	jae    470 <printint+0x30>
+  if(neg)
+ 48e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 491:	85 c0                	test   %eax,%eax
+ 493:	74 07                	je     49c <printint+0x5c>
+    buf[i++] = '-';
+ 495:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 49a:	89 f7                	mov    %esi,%edi
+ 49c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 49f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4a2:	01 df                	add    %ebx,%edi
+ 4a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4ab:	83 ec 04             	sub    $0x4,%esp
+ 4ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4b4:	6a 01                	push   $0x1
+ 4b6:	50                   	push   %eax
+ 4b7:	56                   	push   %esi
+ 4b8:	e8 46 fe ff ff       	call   303 <write>
+  while(--i >= 0)
+ 4bd:	89 f8                	mov    %edi,%eax
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	83 ef 01             	sub    $0x1,%edi
+ 4c5:	39 d8                	cmp    %ebx,%eax
+ 4c7:	75 df                	jne    4a8 <printint+0x68>
+}
+ 4c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4cc:	5b                   	pop    %ebx
+ 4cd:	5e                   	pop    %esi
+ 4ce:	5f                   	pop    %edi
+ 4cf:	5d                   	pop    %ebp
+ 4d0:	c3                   	ret
+ 4d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4d8:	31 c0                	xor    %eax,%eax
+ 4da:	eb 89                	jmp    465 <printint+0x25>
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 4f2:	83 c6 01             	add    $0x1,%esi
+ 4f5:	84 db                	test   %bl,%bl
+ 4f7:	74 67                	je     560 <printf+0x80>
+ 4f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4fc:	31 d2                	xor    %edx,%edx
+ 4fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 501:	eb 34                	jmp    537 <printf+0x57>
+ 503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 507:	90                   	nop
+ 508:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 50b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 510:	83 f8 25             	cmp    $0x25,%eax
+ 513:	74 18                	je     52d <printf+0x4d>
+  write(fd, &c, 1);
+ 515:	83 ec 04             	sub    $0x4,%esp
+ 518:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 51b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 51e:	6a 01                	push   $0x1
+ 520:	50                   	push   %eax
+ 521:	57                   	push   %edi
+ 522:	e8 dc fd ff ff       	call   303 <write>
+ 527:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 52a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 52d:	0f b6 1e             	movzbl (%esi),%ebx
+ 530:	83 c6 01             	add    $0x1,%esi
+ 533:	84 db                	test   %bl,%bl
+ 535:	74 29                	je     560 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 537:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 53a:	85 d2                	test   %edx,%edx
+ 53c:	74 ca                	je     508 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 53e:	83 fa 25             	cmp    $0x25,%edx
+ 541:	75 ea                	jne    52d <printf+0x4d>
+      if(c == 'd'){
+ 543:	83 f8 25             	cmp    $0x25,%eax
+ 546:	0f 84 24 01 00 00    	je     670 <printf+0x190>
+ 54c:	83 e8 63             	sub    $0x63,%eax
+ 54f:	83 f8 15             	cmp    $0x15,%eax
+ 552:	77 1c                	ja     570 <printf+0x90>
+ 554:	ff 24 85 30 0a 00 00 	jmp    *0xa30(,%eax,4)
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 563:	5b                   	pop    %ebx
+ 564:	5e                   	pop    %esi
+ 565:	5f                   	pop    %edi
+ 566:	5d                   	pop    %ebp
+ 567:	c3                   	ret
+ 568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+  write(fd, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 576:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 57a:	6a 01                	push   $0x1
+ 57c:	52                   	push   %edx
+ 57d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 580:	57                   	push   %edi
+ 581:	e8 7d fd ff ff       	call   303 <write>
+ 586:	83 c4 0c             	add    $0xc,%esp
+ 589:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 58c:	6a 01                	push   $0x1
+ 58e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 591:	52                   	push   %edx
+ 592:	57                   	push   %edi
+ 593:	e8 6b fd ff ff       	call   303 <write>
+        putc(fd, c);
+ 598:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 59b:	31 d2                	xor    %edx,%edx
+ 59d:	eb 8e                	jmp    52d <printf+0x4d>
+ 59f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5a3:	83 ec 0c             	sub    $0xc,%esp
+ 5a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5ab:	8b 13                	mov    (%ebx),%edx
+ 5ad:	6a 00                	push   $0x0
+ 5af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5b4:	e8 87 fe ff ff       	call   440 <printint>
+        ap++;
+ 5b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5bf:	31 d2                	xor    %edx,%edx
+ 5c1:	e9 67 ff ff ff       	jmp    52d <printf+0x4d>
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5d5:	83 c0 04             	add    $0x4,%eax
+ 5d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5db:	85 db                	test   %ebx,%ebx
+ 5dd:	0f 84 9d 00 00 00    	je     680 <printf+0x1a0>
+        while(*s != 0){
+ 5e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5e8:	84 c0                	test   %al,%al
+ 5ea:	0f 84 3d ff ff ff    	je     52d <printf+0x4d>
+ 5f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5f6:	89 de                	mov    %ebx,%esi
+ 5f8:	89 d3                	mov    %edx,%ebx
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 606:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 609:	6a 01                	push   $0x1
+ 60b:	53                   	push   %ebx
+ 60c:	57                   	push   %edi
+ 60d:	e8 f1 fc ff ff       	call   303 <write>
+        while(*s != 0){
+ 612:	0f b6 06             	movzbl (%esi),%eax
+ 615:	83 c4 10             	add    $0x10,%esp
+ 618:	84 c0                	test   %al,%al
+ 61a:	75 e4                	jne    600 <printf+0x120>
+      state = 0;
+ 61c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 61f:	31 d2                	xor    %edx,%edx
+ 621:	e9 07 ff ff ff       	jmp    52d <printf+0x4d>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 630:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 633:	83 ec 0c             	sub    $0xc,%esp
+ 636:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 63b:	8b 13                	mov    (%ebx),%edx
+ 63d:	6a 01                	push   $0x1
+ 63f:	e9 6b ff ff ff       	jmp    5af <printf+0xcf>
+ 644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 648:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 64b:	83 ec 04             	sub    $0x4,%esp
+ 64e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 651:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 653:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 656:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 659:	6a 01                	push   $0x1
+ 65b:	52                   	push   %edx
+ 65c:	57                   	push   %edi
+ 65d:	e8 a1 fc ff ff       	call   303 <write>
+        ap++;
+ 662:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 665:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 668:	31 d2                	xor    %edx,%edx
+ 66a:	e9 be fe ff ff       	jmp    52d <printf+0x4d>
+ 66f:	90                   	nop
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 676:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 679:	6a 01                	push   $0x1
+ 67b:	e9 11 ff ff ff       	jmp    591 <printf+0xb1>
+ 680:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 685:	bb 28 0a 00 00       	mov    $0xa28,%ebx
+ 68a:	e9 61 ff ff ff       	jmp    5f0 <printf+0x110>
+ 68f:	90                   	nop
+
+00000690 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 693:	a1 44 0e 00 00       	mov    0xe44,%eax
+{
+ 698:	89 e5                	mov    %esp,%ebp
+ 69a:	56                   	push   %esi
+ 69b:	53                   	push   %ebx
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a4:	39 ca                	cmp    %ecx,%edx
+ 6a6:	73 30                	jae    6d8 <lfree+0x48>
+ 6a8:	39 c1                	cmp    %eax,%ecx
+ 6aa:	72 04                	jb     6b0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6ac:	39 c2                	cmp    %eax,%edx
+ 6ae:	72 f0                	jb     6a0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6b0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 6b3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 6b6:	39 f0                	cmp    %esi,%eax
+ 6b8:	74 26                	je     6e0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6ba:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6bc:	8b 42 04             	mov    0x4(%edx),%eax
+ 6bf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 6c2:	39 d9                	cmp    %ebx,%ecx
+ 6c4:	74 30                	je     6f6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6c6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6c8:	5b                   	pop    %ebx
+  freep = p;
+ 6c9:	89 15 44 0e 00 00    	mov    %edx,0xe44
+}
+ 6cf:	5e                   	pop    %esi
+ 6d0:	5d                   	pop    %ebp
+ 6d1:	c3                   	ret
+ 6d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6d8:	39 c1                	cmp    %eax,%ecx
+ 6da:	72 d0                	jb     6ac <lfree+0x1c>
+ 6dc:	eb c2                	jmp    6a0 <lfree+0x10>
+ 6de:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 6e0:	03 58 04             	add    0x4(%eax),%ebx
+ 6e3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6e6:	8b 02                	mov    (%edx),%eax
+ 6e8:	8b 00                	mov    (%eax),%eax
+ 6ea:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 6ec:	8b 42 04             	mov    0x4(%edx),%eax
+ 6ef:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 6f2:	39 d9                	cmp    %ebx,%ecx
+ 6f4:	75 d0                	jne    6c6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 6f6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 6f9:	89 15 44 0e 00 00    	mov    %edx,0xe44
+    p->s.size += bp->s.size;
+ 6ff:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 702:	8b 09                	mov    (%ecx),%ecx
+ 704:	89 0a                	mov    %ecx,(%edx)
+}
+ 706:	5b                   	pop    %ebx
+ 707:	5e                   	pop    %esi
+ 708:	5d                   	pop    %ebp
+ 709:	c3                   	ret
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000710 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	89 c7                	mov    %eax,%edi
+ 716:	56                   	push   %esi
+ 717:	53                   	push   %ebx
+ 718:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 71b:	a1 44 0e 00 00       	mov    0xe44,%eax
+ 720:	85 c0                	test   %eax,%eax
+ 722:	0f 84 88 00 00 00    	je     7b0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 728:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 72a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 72d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 732:	39 df                	cmp    %ebx,%edi
+ 734:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 737:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 73e:	39 f9                	cmp    %edi,%ecx
+ 740:	72 0f                	jb     751 <lalloc+0x41>
+ 742:	eb 4c                	jmp    790 <lalloc+0x80>
+ 744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 748:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 74a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 74d:	39 f9                	cmp    %edi,%ecx
+ 74f:	73 3f                	jae    790 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 751:	89 d0                	mov    %edx,%eax
+ 753:	39 15 44 0e 00 00    	cmp    %edx,0xe44
+ 759:	75 ed                	jne    748 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 75b:	83 ec 0c             	sub    $0xc,%esp
+ 75e:	56                   	push   %esi
+ 75f:	e8 07 fc ff ff       	call   36b <sbrk>
+  if(p == (char*)-1)
+ 764:	83 c4 10             	add    $0x10,%esp
+ 767:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 76a:	74 11                	je     77d <lalloc+0x6d>
+  hp->s.size = nu;
+ 76c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 76f:	e8 1c ff ff ff       	call   690 <lfree>
+  return freep;
+ 774:	a1 44 0e 00 00       	mov    0xe44,%eax
+      if((p = morecore(nunits)) == 0)
+ 779:	85 c0                	test   %eax,%eax
+ 77b:	75 cb                	jne    748 <lalloc+0x38>
+        return 0;
+  }
+}
+ 77d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 780:	31 d2                	xor    %edx,%edx
+}
+ 782:	5b                   	pop    %ebx
+ 783:	89 d0                	mov    %edx,%eax
+ 785:	5e                   	pop    %esi
+ 786:	5f                   	pop    %edi
+ 787:	5d                   	pop    %ebp
+ 788:	c3                   	ret
+ 789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 790:	39 cf                	cmp    %ecx,%edi
+ 792:	74 4c                	je     7e0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 794:	29 f9                	sub    %edi,%ecx
+ 796:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 799:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 79c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 79f:	a3 44 0e 00 00       	mov    %eax,0xe44
+}
+ 7a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7a7:	89 d0                	mov    %edx,%eax
+ 7a9:	5b                   	pop    %ebx
+ 7aa:	5e                   	pop    %esi
+ 7ab:	5f                   	pop    %edi
+ 7ac:	5d                   	pop    %ebp
+ 7ad:	c3                   	ret
+ 7ae:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 7b0:	ba 48 0e 00 00       	mov    $0xe48,%edx
+ 7b5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 7b7:	c7 05 44 0e 00 00 48 	movl   $0xe48,0xe44
+ 7be:	0e 00 00 
+ 7c1:	c7 05 48 0e 00 00 48 	movl   $0xe48,0xe48
+ 7c8:	0e 00 00 
+ 7cb:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 7cd:	c7 05 4c 0e 00 00 00 	movl   $0x0,0xe4c
+ 7d4:	00 00 00 
+ 7d7:	e9 51 ff ff ff       	jmp    72d <lalloc+0x1d>
+ 7dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 7e0:	8b 0a                	mov    (%edx),%ecx
+ 7e2:	89 08                	mov    %ecx,(%eax)
+ 7e4:	eb b9                	jmp    79f <lalloc+0x8f>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007f0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 7f9:	85 f6                	test   %esi,%esi
+ 7fb:	74 42                	je     83f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 7fd:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 800:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 803:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 809:	77 3d                	ja     848 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 80b:	31 c9                	xor    %ecx,%ecx
+ 80d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 812:	83 fa 02             	cmp    $0x2,%edx
+ 815:	74 17                	je     82e <free+0x3e>
+ 817:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81e:	66 90                	xchg   %ax,%ax
+ 820:	83 c1 01             	add    $0x1,%ecx
+ 823:	89 d8                	mov    %ebx,%eax
+ 825:	d3 e0                	shl    %cl,%eax
+ 827:	83 c0 01             	add    $0x1,%eax
+ 82a:	39 c2                	cmp    %eax,%edx
+ 82c:	75 f2                	jne    820 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 82e:	8b 04 8d 20 0e 00 00 	mov    0xe20(,%ecx,4),%eax
+  classes[c] = bp;
+ 835:	89 3c 8d 20 0e 00 00 	mov    %edi,0xe20(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 83c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 83f:	5b                   	pop    %ebx
+ 840:	5e                   	pop    %esi
+ 841:	5f                   	pop    %edi
+ 842:	5d                   	pop    %ebp
+ 843:	c3                   	ret
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 848:	5b                   	pop    %ebx
+    lfree(bp);
+ 849:	89 f8                	mov    %edi,%eax
+}
+ 84b:	5e                   	pop    %esi
+ 84c:	5f                   	pop    %edi
+ 84d:	5d                   	pop    %ebp
+    lfree(bp);
+ 84e:	e9 3d fe ff ff       	jmp    690 <lfree>
+ 853:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000860 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 869:	8b 45 08             	mov    0x8(%ebp),%eax
+ 86c:	83 c0 07             	add    $0x7,%eax
+ 86f:	c1 e8 03             	shr    $0x3,%eax
+ 872:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 875:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 87a:	77 44                	ja     8c0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 87c:	31 c9                	xor    %ecx,%ecx
+ 87e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 883:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 888:	83 f8 02             	cmp    $0x2,%eax
+ 88b:	76 11                	jbe    89e <malloc+0x3e>
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+ 890:	83 c1 01             	add    $0x1,%ecx
+ 893:	89 d3                	mov    %edx,%ebx
+ 895:	d3 e3                	shl    %cl,%ebx
+ 897:	83 c3 01             	add    $0x1,%ebx
+ 89a:	39 c3                	cmp    %eax,%ebx
+ 89c:	72 f2                	jb     890 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 89e:	8b 04 8d 20 0e 00 00 	mov    0xe20(,%ecx,4),%eax
+ 8a5:	85 c0                	test   %eax,%eax
+ 8a7:	74 2f                	je     8d8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 8a9:	8b 10                	mov    (%eax),%edx
+ 8ab:	89 14 8d 20 0e 00 00 	mov    %edx,0xe20(,%ecx,4)
+  return (void*)(p + 1);
+ 8b2:	83 c0 08             	add    $0x8,%eax
+}
+ 8b5:	83 c4 1c             	add    $0x1c,%esp
+ 8b8:	5b                   	pop    %ebx
+ 8b9:	5e                   	pop    %esi
+ 8ba:	5f                   	pop    %edi
+ 8bb:	5d                   	pop    %ebp
+ 8bc:	c3                   	ret
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 8c0:	e8 4b fe ff ff       	call   710 <lalloc>
+ 8c5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 8c7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 8ca:	85 d2                	test   %edx,%edx
+ 8cc:	75 e7                	jne    8b5 <malloc+0x55>
+      return 0;
+ 8ce:	31 c0                	xor    %eax,%eax
+ 8d0:	eb e3                	jmp    8b5 <malloc+0x55>
+ 8d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 8d8:	31 d2                	xor    %edx,%edx
+ 8da:	b8 00 02 00 00       	mov    $0x200,%eax
+ 8df:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 8e2:	f7 f3                	div    %ebx
+  if(n < 4)
+ 8e4:	ba 04 00 00 00       	mov    $0x4,%edx
+ 8e9:	89 d6                	mov    %edx,%esi
+ 8eb:	39 d0                	cmp    %edx,%eax
+ 8ed:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 8f0:	0f af f3             	imul   %ebx,%esi
+ 8f3:	89 f0                	mov    %esi,%eax
+ 8f5:	e8 16 fe ff ff       	call   710 <lalloc>
+ 8fa:	85 c0                	test   %eax,%eax
+ 8fc:	74 d0                	je     8ce <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 8fe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 901:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 904:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 90b:	8b 14 8d 20 0e 00 00 	mov    0xe20(,%ecx,4),%edx
+ 912:	39 f8                	cmp    %edi,%eax
+ 914:	73 22                	jae    938 <malloc+0xd8>
+ 916:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 919:	eb 09                	jmp    924 <malloc+0xc4>
+ 91b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+ 920:	89 c2                	mov    %eax,%edx
+ 922:	89 c8                	mov    %ecx,%eax
+ 924:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ 927:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ 92a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ 92c:	39 f9                	cmp    %edi,%ecx
+ 92e:	72 f0                	jb     920 <malloc+0xc0>
+ 930:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 933:	e9 73 ff ff ff       	jmp    8ab <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ 938:	89 d0                	mov    %edx,%eax
+ 93a:	8b 12                	mov    (%edx),%edx
+ 93c:	e9 6a ff ff ff       	jmp    8ab <malloc+0x4b>
+ 941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+
+00000950 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	56                   	push   %esi
+ 954:	53                   	push   %ebx
+ 955:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 958:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ 95b:	85 c9                	test   %ecx,%ecx
+ 95d:	74 06                	je     965 <calloc+0x15>
+ 95f:	89 c8                	mov    %ecx,%eax
+ 961:	f7 e3                	mul    %ebx
+ 963:	70 33                	jo     998 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ 965:	0f af d9             	imul   %ecx,%ebx
+ 968:	83 ec 0c             	sub    $0xc,%esp
+ 96b:	53                   	push   %ebx
+ 96c:	e8 ef fe ff ff       	call   860 <malloc>
+ 971:	83 c4 10             	add    $0x10,%esp
+ 974:	89 c6                	mov    %eax,%esi
+ 976:	85 c0                	test   %eax,%eax
+ 978:	74 1e                	je     998 <calloc+0x48>
+    memset(p, 0, n * size);
+ 97a:	83 ec 04             	sub    $0x4,%esp
+ 97d:	53                   	push   %ebx
+ 97e:	6a 00                	push   $0x0
+ 980:	50                   	push   %eax
+ 981:	e8 3a f7 ff ff       	call   c0 <memset>
+ 986:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ 989:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 98c:	89 f0                	mov    %esi,%eax
+ 98e:	5b                   	pop    %ebx
+ 98f:	5e                   	pop    %esi
+ 990:	5d                   	pop    %ebp
+ 991:	c3                   	ret
+ 992:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 998:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 99b:	31 f6                	xor    %esi,%esi
+}
+ 99d:	89 f0                	mov    %esi,%eax
+ 99f:	5b                   	pop    %ebx
+ 9a0:	5e                   	pop    %esi
+ 9a1:	5d                   	pop    %ebp
+ 9a2:	c3                   	ret
+ 9a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009b0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	83 ec 0c             	sub    $0xc,%esp
+ 9b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 9bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ 9bf:	85 db                	test   %ebx,%ebx
+ 9c1:	74 55                	je     a18 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ 9c3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ 9c6:	89 de                	mov    %ebx,%esi
+ 9c8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ 9cf:	39 c7                	cmp    %eax,%edi
+ 9d1:	72 0d                	jb     9e0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ 9d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9d6:	89 f0                	mov    %esi,%eax
+ 9d8:	5b                   	pop    %ebx
+ 9d9:	5e                   	pop    %esi
+ 9da:	5f                   	pop    %edi
+ 9db:	5d                   	pop    %ebp
+ 9dc:	c3                   	ret
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ 9e0:	83 ec 0c             	sub    $0xc,%esp
+ 9e3:	50                   	push   %eax
+ 9e4:	e8 77 fe ff ff       	call   860 <malloc>
+ 9e9:	83 c4 10             	add    $0x10,%esp
+ 9ec:	89 c6                	mov    %eax,%esi
+ 9ee:	85 c0                	test   %eax,%eax
+ 9f0:	74 e1                	je     9d3 <realloc+0x23>
+  memmove(p, ap, have);
+ 9f2:	83 ec 04             	sub    $0x4,%esp
+ 9f5:	57                   	push   %edi
+ 9f6:	53                   	push   %ebx
+ 9f7:	50                   	push   %eax
+ 9f8:	e8 b3 f8 ff ff       	call   2b0 <memmove>
+  free(ap);
+ 9fd:	89 1c 24             	mov    %ebx,(%esp)
+ a00:	e8 eb fd ff ff       	call   7f0 <free>
+  return p;
+ a05:	83 c4 10             	add    $0x10,%esp
+}
+ a08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a0b:	89 f0                	mov    %esi,%eax
+ a0d:	5b                   	pop    %ebx
+ a0e:	5e                   	pop    %esi
+ a0f:	5f                   	pop    %edi
+ a10:	5d                   	pop    %ebp
+ a11:	c3                   	ret
+ a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a18:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a1e:	5b                   	pop    %ebx
+ a1f:	5e                   	pop    %esi
+ a20:	5f                   	pop    %edi
+ a21:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ a22:	e9 39 fe ff ff       	jmp    860 <malloc>
@@ -0,0 +1,2687 @@
+
+_p5-test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d. setuid\n", i++);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	8d 75 af             	lea    -0x51(%ebp),%esi
+      12:	53                   	push   %ebx
+      13:	51                   	push   %ecx
+      14:	83 ec 58             	sub    $0x58,%esp
+  int rc, select, done;
+  char buf[5];
+
+  // test strings
+  char *t0[] = {'\0'}; // dummy
+  char *t1[] = {"testsetuid", '\0'};
+      17:	c7 45 b4 e5 15 00 00 	movl   $0x15e5,-0x4c(%ebp)
+      1e:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+      25:	8d 76 00             	lea    0x0(%esi),%esi
+
+  while (1) {
+    done = FALSE;
+    printMenu();
+      28:	e8 83 0a 00 00       	call   ab0 <printMenu>
+    printf(1, "Enter test number: ");
+      2d:	83 ec 08             	sub    $0x8,%esp
+      30:	68 f0 15 00 00       	push   $0x15f0
+      35:	6a 01                	push   $0x1
+      37:	e8 f4 0f 00 00       	call   1030 <printf>
+    gets(buf, 5);
+      3c:	5f                   	pop    %edi
+      3d:	58                   	pop    %eax
+      3e:	6a 05                	push   $0x5
+      40:	56                   	push   %esi
+      41:	e8 2a 0c 00 00       	call   c70 <gets>
+    if ((buf[0] == '\n') || (buf[0] == '\0')) continue;
+      46:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	3c 0a                	cmp    $0xa,%al
+      4f:	74 d7                	je     28 <main+0x28>
+      51:	84 c0                	test   %al,%al
+      53:	74 d3                	je     28 <main+0x28>
+    select = atoi(buf);
+      55:	83 ec 0c             	sub    $0xc,%esp
+      58:	56                   	push   %esi
+      59:	e8 c2 0c 00 00       	call   d20 <atoi>
+    switch (select) {
+      5e:	83 c4 10             	add    $0x10,%esp
+      61:	83 f8 07             	cmp    $0x7,%eax
+      64:	0f 87 e6 05 00 00    	ja     650 <main+0x650>
+      6a:	ff 24 85 5c 1e 00 00 	jmp    *0x1e5c(,%eax,4)
+      71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "\nExecuting exec test.\n\n");
+      78:	83 ec 08             	sub    $0x8,%esp
+      7b:	68 43 17 00 00       	push   $0x1743
+      80:	6a 01                	push   $0x1
+      82:	e8 a9 0f 00 00       	call   1030 <printf>
+  if (!canRun(cmd[0])) {
+      87:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  uid = getuid();
+      8a:	e8 9c 0e 00 00       	call   f2b <getuid>
+      8f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  gid = getgid();
+      92:	e8 9c 0e 00 00       	call   f33 <getgid>
+      97:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  check(stat(name, &st));
+      9a:	5f                   	pop    %edi
+      9b:	8d 7d cc             	lea    -0x34(%ebp),%edi
+      9e:	58                   	pop    %eax
+      9f:	57                   	push   %edi
+      a0:	53                   	push   %ebx
+      a1:	e8 2a 0c 00 00       	call   cd0 <stat>
+      a6:	83 c4 10             	add    $0x10,%esp
+      a9:	85 c0                	test   %eax,%eax
+      ab:	0f 85 61 07 00 00    	jne    812 <main+0x812>
+  if (uid == st.uid) {
+      b1:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+      b5:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    if (st.mode.flags.u_x)
+      b8:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+  if (uid == st.uid) {
+      bc:	39 c8                	cmp    %ecx,%eax
+      be:	0f 84 a3 05 00 00    	je     667 <main+0x667>
+  if (gid == st.gid) {
+      c4:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+      c8:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+      cb:	39 c8                	cmp    %ecx,%eax
+      cd:	0f 84 83 07 00 00    	je     856 <main+0x856>
+  if (st.mode.flags.o_x) {
+      d3:	80 e2 01             	and    $0x1,%dl
+      d6:	0f 84 cf 06 00 00    	je     7ab <main+0x7ab>
+  check(stat(cmd[0], &st));
+      dc:	50                   	push   %eax
+      dd:	50                   	push   %eax
+      de:	57                   	push   %edi
+      df:	ff 75 b4             	push   -0x4c(%ebp)
+      e2:	e8 e9 0b 00 00       	call   cd0 <stat>
+      e7:	83 c4 10             	add    $0x10,%esp
+      ea:	89 c7                	mov    %eax,%edi
+      ec:	85 c0                	test   %eax,%eax
+      ee:	0f 85 ff 07 00 00    	jne    8f3 <main+0x8f3>
+  uid = st.uid;
+      f4:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+  for (i=0; i<NUMPERMSTOCHECK; i++) {
+      f8:	83 3d 10 23 00 00 00 	cmpl   $0x0,0x2310
+      ff:	bb c0 22 00 00       	mov    $0x22c0,%ebx
+  uid = st.uid;
+     104:	66 89 45 a4          	mov    %ax,-0x5c(%ebp)
+  gid = st.gid;
+     108:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     10c:	66 89 45 a0          	mov    %ax,-0x60(%ebp)
+  for (i=0; i<NUMPERMSTOCHECK; i++) {
+     110:	7f 4a                	jg     15c <main+0x15c>
+     112:	e9 f6 07 00 00       	jmp    90d <main+0x90d>
+     117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     11e:	66 90                	xchg   %ax,%ax
+      printf(2, "The following test should not produce an error.\n");
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 68 1d 00 00       	push   $0x1d68
+     128:	6a 02                	push   $0x2
+     12a:	e8 01 0f 00 00       	call   1030 <printf>
+     12f:	83 c4 10             	add    $0x10,%esp
+    rc = fork();
+     132:	e8 f4 0c 00 00       	call   e2b <fork>
+    if (rc < 0) {    // fork failed
+     137:	85 c0                	test   %eax,%eax
+     139:	0f 88 93 08 00 00    	js     9d2 <main+0x9d2>
+    if (rc == 0) {   // child
+     13f:	0f 84 19 09 00 00    	je     a5e <main+0xa5e>
+    wait();
+     145:	e8 f1 0c 00 00       	call   e3b <wait>
+  for (i=0; i<NUMPERMSTOCHECK; i++) {
+     14a:	83 c7 01             	add    $0x1,%edi
+     14d:	83 c3 10             	add    $0x10,%ebx
+     150:	3b 3d 10 23 00 00    	cmp    0x2310,%edi
+     156:	0f 8d b1 07 00 00    	jge    90d <main+0x90d>
+    check(setuid(testperms[i][procuid]));
+     15c:	83 ec 0c             	sub    $0xc,%esp
+     15f:	ff 33                	push   (%ebx)
+     161:	e8 dd 0d 00 00       	call   f43 <setuid>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	85 c0                	test   %eax,%eax
+     16b:	0f 85 df 07 00 00    	jne    950 <main+0x950>
+    check(setgid(testperms[i][procgid]));
+     171:	83 ec 0c             	sub    $0xc,%esp
+     174:	ff 73 04             	push   0x4(%ebx)
+     177:	e8 cf 0d 00 00       	call   f4b <setgid>
+     17c:	83 c4 10             	add    $0x10,%esp
+     17f:	85 c0                	test   %eax,%eax
+     181:	0f 85 e3 07 00 00    	jne    96a <main+0x96a>
+    check(chown(cmd[0], testperms[i][fileuid]));
+     187:	83 ec 08             	sub    $0x8,%esp
+     18a:	ff 73 08             	push   0x8(%ebx)
+     18d:	ff 75 b4             	push   -0x4c(%ebp)
+     190:	e8 de 0d 00 00       	call   f73 <chown>
+     195:	83 c4 10             	add    $0x10,%esp
+     198:	85 c0                	test   %eax,%eax
+     19a:	0f 85 e4 07 00 00    	jne    984 <main+0x984>
+    check(chgrp(cmd[0], testperms[i][filegid]));
+     1a0:	83 ec 08             	sub    $0x8,%esp
+     1a3:	ff 73 0c             	push   0xc(%ebx)
+     1a6:	ff 75 b4             	push   -0x4c(%ebp)
+     1a9:	e8 cd 0d 00 00       	call   f7b <chgrp>
+     1ae:	83 c4 10             	add    $0x10,%esp
+     1b1:	85 c0                	test   %eax,%eax
+     1b3:	0f 85 e5 07 00 00    	jne    99e <main+0x99e>
+    check(chmod(cmd[0], perms[i]));
+     1b9:	83 ec 08             	sub    $0x8,%esp
+     1bc:	ff 34 bd 00 23 00 00 	push   0x2300(,%edi,4)
+     1c3:	ff 75 b4             	push   -0x4c(%ebp)
+     1c6:	e8 a0 0d 00 00       	call   f6b <chmod>
+     1cb:	83 c4 10             	add    $0x10,%esp
+     1ce:	85 c0                	test   %eax,%eax
+     1d0:	0f 85 e2 07 00 00    	jne    9b8 <main+0x9b8>
+    if (i != NUMPERMSTOCHECK-1)
+     1d6:	a1 10 23 00 00       	mov    0x2310,%eax
+     1db:	83 e8 01             	sub    $0x1,%eax
+     1de:	39 f8                	cmp    %edi,%eax
+     1e0:	0f 85 3a ff ff ff    	jne    120 <main+0x120>
+      printf(2, "The following test should fail.\n");
+     1e6:	83 ec 08             	sub    $0x8,%esp
+     1e9:	68 9c 1d 00 00       	push   $0x1d9c
+     1ee:	6a 02                	push   $0x2
+     1f0:	e8 3b 0e 00 00       	call   1030 <printf>
+     1f5:	83 c4 10             	add    $0x10,%esp
+     1f8:	e9 35 ff ff ff       	jmp    132 <main+0x132>
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "\nExecuting chgrp test.\n\n");
+     200:	83 ec 08             	sub    $0x8,%esp
+  stat(cmd[0], &st);
+     203:	8d 7d cc             	lea    -0x34(%ebp),%edi
+  printf(1, "\nExecuting chgrp test.\n\n");
+     206:	68 1e 17 00 00       	push   $0x171e
+     20b:	6a 01                	push   $0x1
+     20d:	e8 1e 0e 00 00       	call   1030 <printf>
+  stat(cmd[0], &st);
+     212:	5a                   	pop    %edx
+     213:	59                   	pop    %ecx
+     214:	57                   	push   %edi
+     215:	ff 75 b4             	push   -0x4c(%ebp)
+     218:	e8 b3 0a 00 00       	call   cd0 <stat>
+  gid1 = st.gid;
+     21d:	0f b7 5d e2          	movzwl -0x1e(%ebp),%ebx
+  rc = chgrp(cmd[0], gid1+1);
+     221:	58                   	pop    %eax
+     222:	5a                   	pop    %edx
+     223:	8d 43 01             	lea    0x1(%ebx),%eax
+     226:	50                   	push   %eax
+     227:	ff 75 b4             	push   -0x4c(%ebp)
+     22a:	e8 4c 0d 00 00       	call   f7b <chgrp>
+  if (rc != 0) {
+     22f:	83 c4 10             	add    $0x10,%esp
+     232:	85 c0                	test   %eax,%eax
+     234:	0f 85 8c 04 00 00    	jne    6c6 <main+0x6c6>
+  stat(cmd[0], &st);
+     23a:	50                   	push   %eax
+     23b:	50                   	push   %eax
+     23c:	57                   	push   %edi
+     23d:	ff 75 b4             	push   -0x4c(%ebp)
+     240:	e8 8b 0a 00 00       	call   cd0 <stat>
+  gid2 = st.gid;
+     245:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+  if (gid1 == gid2) {
+     249:	83 c4 10             	add    $0x10,%esp
+     24c:	39 c3                	cmp    %eax,%ebx
+     24e:	0f 84 a8 05 00 00    	je     7fc <main+0x7fc>
+  chgrp(cmd[0], gid1);  // put back the original
+     254:	50                   	push   %eax
+     255:	50                   	push   %eax
+     256:	53                   	push   %ebx
+     257:	ff 75 b4             	push   -0x4c(%ebp)
+     25a:	e8 1c 0d 00 00       	call   f7b <chgrp>
+  printf(1, "Test Passed\n");
+     25f:	eb 66                	jmp    2c7 <main+0x2c7>
+     261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "\nExecuting chown test.\n\n");
+     268:	83 ec 08             	sub    $0x8,%esp
+  stat(cmd[0], &st);
+     26b:	8d 7d cc             	lea    -0x34(%ebp),%edi
+  printf(1, "\nExecuting chown test.\n\n");
+     26e:	68 f9 16 00 00       	push   $0x16f9
+     273:	6a 01                	push   $0x1
+     275:	e8 b6 0d 00 00       	call   1030 <printf>
+  stat(cmd[0], &st);
+     27a:	59                   	pop    %ecx
+     27b:	5b                   	pop    %ebx
+     27c:	57                   	push   %edi
+     27d:	ff 75 b4             	push   -0x4c(%ebp)
+     280:	e8 4b 0a 00 00       	call   cd0 <stat>
+  uid1 = st.uid;
+     285:	0f b7 5d e0          	movzwl -0x20(%ebp),%ebx
+  rc = chown(cmd[0], uid1+1);
+     289:	58                   	pop    %eax
+     28a:	5a                   	pop    %edx
+     28b:	8d 43 01             	lea    0x1(%ebx),%eax
+     28e:	50                   	push   %eax
+     28f:	ff 75 b4             	push   -0x4c(%ebp)
+     292:	e8 dc 0c 00 00       	call   f73 <chown>
+  if (rc != 0) {
+     297:	83 c4 10             	add    $0x10,%esp
+     29a:	85 c0                	test   %eax,%eax
+     29c:	0f 85 74 04 00 00    	jne    716 <main+0x716>
+  stat(cmd[0], &st);
+     2a2:	50                   	push   %eax
+     2a3:	50                   	push   %eax
+     2a4:	57                   	push   %edi
+     2a5:	ff 75 b4             	push   -0x4c(%ebp)
+     2a8:	e8 23 0a 00 00       	call   cd0 <stat>
+  uid2 = st.uid;
+     2ad:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+  if (uid1 == uid2) {
+     2b1:	83 c4 10             	add    $0x10,%esp
+     2b4:	39 c3                	cmp    %eax,%ebx
+     2b6:	0f 84 2a 05 00 00    	je     7e6 <main+0x7e6>
+  chown(cmd[0], uid1);  // put back the original
+     2bc:	57                   	push   %edi
+     2bd:	57                   	push   %edi
+     2be:	53                   	push   %ebx
+     2bf:	ff 75 b4             	push   -0x4c(%ebp)
+     2c2:	e8 ac 0c 00 00       	call   f73 <chown>
+  printf(1, "Test Passed\n");
+     2c7:	5a                   	pop    %edx
+     2c8:	59                   	pop    %ecx
+     2c9:	68 2f 16 00 00       	push   $0x162f
+     2ce:	6a 01                	push   $0x1
+     2d0:	e8 5b 0d 00 00       	call   1030 <printf>
+      case 2: doTest(doGidTest,    t0); break;
+      case 3: doTest(doChmodTest,  t1); break;
+      case 4: doTest(doChownTest,  t1); break;
+      case 5: doTest(doChgrpTest,  t1); break;
+      case 6: doTest(doExecTest,   t1); break;
+      case 7: doTest(doSetuidTest, t1); break;
+     2d5:	83 c4 10             	add    $0x10,%esp
+     2d8:	e9 4b fd ff ff       	jmp    28 <main+0x28>
+     2dd:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "\nExecuting chmod() test.\n\n");
+     2e0:	83 ec 08             	sub    $0x8,%esp
+  check(stat(cmd[0], &st));
+     2e3:	8d 7d cc             	lea    -0x34(%ebp),%edi
+  printf(1, "\nExecuting chmod() test.\n\n");
+     2e6:	68 7e 16 00 00       	push   $0x167e
+     2eb:	6a 01                	push   $0x1
+     2ed:	e8 3e 0d 00 00       	call   1030 <printf>
+  check(stat(cmd[0], &st));
+     2f2:	58                   	pop    %eax
+     2f3:	5a                   	pop    %edx
+     2f4:	57                   	push   %edi
+     2f5:	ff 75 b4             	push   -0x4c(%ebp)
+     2f8:	e8 d3 09 00 00       	call   cd0 <stat>
+     2fd:	83 c4 10             	add    $0x10,%esp
+     300:	89 c3                	mov    %eax,%ebx
+     302:	85 c0                	test   %eax,%eax
+     304:	0f 85 7c 03 00 00    	jne    686 <main+0x686>
+  mode = st.mode.asInt;
+     30a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     30d:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  for (i=0; i<NUMPERMSTOCHECK; i++) {
+     310:	a1 10 23 00 00       	mov    0x2310,%eax
+     315:	85 c0                	test   %eax,%eax
+     317:	7f 39                	jg     352 <main+0x352>
+     319:	e9 94 03 00 00       	jmp    6b2 <main+0x6b2>
+     31e:	66 90                	xchg   %ax,%ax
+    check(stat(cmd[0], &st));
+     320:	83 ec 08             	sub    $0x8,%esp
+     323:	57                   	push   %edi
+     324:	ff 75 b4             	push   -0x4c(%ebp)
+     327:	e8 a4 09 00 00       	call   cd0 <stat>
+     32c:	83 c4 10             	add    $0x10,%esp
+     32f:	85 c0                	test   %eax,%eax
+     331:	0f 85 4f 03 00 00    	jne    686 <main+0x686>
+    if (mode == testmode) {
+     337:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     33a:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     33d:	0f 84 e6 04 00 00    	je     829 <main+0x829>
+  for (i=0; i<NUMPERMSTOCHECK; i++) {
+     343:	83 c3 01             	add    $0x1,%ebx
+     346:	3b 1d 10 23 00 00    	cmp    0x2310,%ebx
+     34c:	0f 8d 60 03 00 00    	jge    6b2 <main+0x6b2>
+    check(chmod(cmd[0], perms[i]));
+     352:	83 ec 08             	sub    $0x8,%esp
+     355:	ff 34 9d 00 23 00 00 	push   0x2300(,%ebx,4)
+     35c:	ff 75 b4             	push   -0x4c(%ebp)
+     35f:	e8 07 0c 00 00       	call   f6b <chmod>
+     364:	83 c4 10             	add    $0x10,%esp
+     367:	85 c0                	test   %eax,%eax
+     369:	74 b5                	je     320 <main+0x320>
+     36b:	50                   	push   %eax
+     36c:	68 bd 16 00 00       	push   $0x16bd
+     371:	68 ab 16 00 00       	push   $0x16ab
+     376:	6a 02                	push   $0x2
+     378:	e8 b3 0c 00 00       	call   1030 <printf>
+     37d:	83 c4 10             	add    $0x10,%esp
+     380:	e9 16 03 00 00       	jmp    69b <main+0x69b>
+     385:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "\nExecuting setgid() test.\n\n");
+     388:	83 ec 08             	sub    $0x8,%esp
+  int badgids[] = {32767+5, -41, ~0};  // 32767 is max value
+     38b:	c7 45 cc 04 80 00 00 	movl   $0x8004,-0x34(%ebp)
+     392:	c7 45 d0 d7 ff ff ff 	movl   $0xffffffd7,-0x30(%ebp)
+     399:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  printf(1, "\nExecuting setgid() test.\n\n");
+     3a0:	68 58 16 00 00       	push   $0x1658
+     3a5:	6a 01                	push   $0x1
+     3a7:	e8 84 0c 00 00       	call   1030 <printf>
+  startgid = gid = getgid();
+     3ac:	e8 82 0b 00 00       	call   f33 <getgid>
+  testgid = ++gid;
+     3b1:	8d 58 01             	lea    0x1(%eax),%ebx
+  startgid = gid = getgid();
+     3b4:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  rc = setgid(testgid);
+     3b7:	89 1c 24             	mov    %ebx,(%esp)
+     3ba:	e8 8c 0b 00 00       	call   f4b <setgid>
+  if (rc) {
+     3bf:	83 c4 10             	add    $0x10,%esp
+     3c2:	85 c0                	test   %eax,%eax
+     3c4:	0f 85 74 03 00 00    	jne    73e <main+0x73e>
+  gid = getgid();
+     3ca:	e8 64 0b 00 00       	call   f33 <getgid>
+     3cf:	89 c7                	mov    %eax,%edi
+  if (gid != testgid) {
+     3d1:	39 c3                	cmp    %eax,%ebx
+     3d3:	0f 85 8d 03 00 00    	jne    766 <main+0x766>
+     3d9:	8d 5d cc             	lea    -0x34(%ebp),%ebx
+    rc = setgid(badgids[i]);
+     3dc:	8b 3b                	mov    (%ebx),%edi
+     3de:	83 ec 0c             	sub    $0xc,%esp
+     3e1:	57                   	push   %edi
+     3e2:	e8 64 0b 00 00       	call   f4b <setgid>
+    if (rc == 0) {
+     3e7:	83 c4 10             	add    $0x10,%esp
+     3ea:	85 c0                	test   %eax,%eax
+     3ec:	0f 84 0d 06 00 00    	je     9ff <main+0x9ff>
+    rc = getgid();
+     3f2:	e8 3c 0b 00 00       	call   f33 <getgid>
+    if (badgids[i] == rc) {
+     3f7:	39 c7                	cmp    %eax,%edi
+     3f9:	0f 84 3b 06 00 00    	je     a3a <main+0xa3a>
+  for (i=0; i<badgidcount; i++) {
+     3ff:	83 c3 04             	add    $0x4,%ebx
+     402:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     405:	39 c3                	cmp    %eax,%ebx
+     407:	75 d3                	jne    3dc <main+0x3dc>
+  setgid(startgid);
+     409:	83 ec 0c             	sub    $0xc,%esp
+     40c:	ff 75 a4             	push   -0x5c(%ebp)
+     40f:	e8 37 0b 00 00       	call   f4b <setgid>
+  printf(1, "Test Passed\n");
+     414:	e9 ae fe ff ff       	jmp    2c7 <main+0x2c7>
+     419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "\nExecuting setuid() test.\n\n");
+     420:	83 ec 08             	sub    $0x8,%esp
+  int baduids[] = {32767+5, -41, ~0};  // 32767 is max value
+     423:	c7 45 cc 04 80 00 00 	movl   $0x8004,-0x34(%ebp)
+     42a:	c7 45 d0 d7 ff ff ff 	movl   $0xffffffd7,-0x30(%ebp)
+     431:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  printf(1, "\nExecuting setuid() test.\n\n");
+     438:	68 13 16 00 00       	push   $0x1613
+     43d:	6a 01                	push   $0x1
+     43f:	e8 ec 0b 00 00       	call   1030 <printf>
+  startuid = uid = getuid();
+     444:	e8 e2 0a 00 00       	call   f2b <getuid>
+  testuid = ++uid;
+     449:	8d 58 01             	lea    0x1(%eax),%ebx
+  startuid = uid = getuid();
+     44c:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  rc = setuid(testuid);
+     44f:	89 1c 24             	mov    %ebx,(%esp)
+     452:	e8 ec 0a 00 00       	call   f43 <setuid>
+  if (rc) {
+     457:	83 c4 10             	add    $0x10,%esp
+     45a:	85 c0                	test   %eax,%eax
+     45c:	0f 85 8c 02 00 00    	jne    6ee <main+0x6ee>
+  uid = getuid();
+     462:	e8 c4 0a 00 00       	call   f2b <getuid>
+     467:	89 c7                	mov    %eax,%edi
+  if (uid != testuid) {
+     469:	39 c3                	cmp    %eax,%ebx
+     46b:	0f 85 16 03 00 00    	jne    787 <main+0x787>
+     471:	8d 5d cc             	lea    -0x34(%ebp),%ebx
+    rc = setuid(baduids[i]);
+     474:	8b 3b                	mov    (%ebx),%edi
+     476:	83 ec 0c             	sub    $0xc,%esp
+     479:	57                   	push   %edi
+     47a:	e8 c4 0a 00 00       	call   f43 <setuid>
+    if (rc == 0) {
+     47f:	83 c4 10             	add    $0x10,%esp
+     482:	85 c0                	test   %eax,%eax
+     484:	0f 84 5e 05 00 00    	je     9e8 <main+0x9e8>
+    rc = getuid();
+     48a:	e8 9c 0a 00 00       	call   f2b <getuid>
+    if (baduids[i] == rc) {
+     48f:	39 c7                	cmp    %eax,%edi
+     491:	0f 84 7f 05 00 00    	je     a16 <main+0xa16>
+  for (i=0; i<baduidcount; i++) {
+     497:	83 c3 04             	add    $0x4,%ebx
+     49a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     49d:	39 c3                	cmp    %eax,%ebx
+     49f:	75 d3                	jne    474 <main+0x474>
+  setuid(startuid);
+     4a1:	83 ec 0c             	sub    $0xc,%esp
+     4a4:	ff 75 a4             	push   -0x5c(%ebp)
+     4a7:	e8 97 0a 00 00       	call   f43 <setuid>
+  printf(1, "Test Passed\n");
+     4ac:	e9 16 fe ff ff       	jmp    2c7 <main+0x2c7>
+     4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+
+    if (done) break;
+  }
+
+  printf(1, "\nDone for now\n");
+     4b8:	83 ec 08             	sub    $0x8,%esp
+     4bb:	68 04 16 00 00       	push   $0x1604
+     4c0:	6a 01                	push   $0x1
+     4c2:	e8 69 0b 00 00       	call   1030 <printf>
+  free(buf);
+     4c7:	89 34 24             	mov    %esi,(%esp)
+     4ca:	e8 71 0e 00 00       	call   1340 <free>
+  exit();
+     4cf:	e8 5f 09 00 00       	call   e33 <exit>
+     4d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "\nTesting the set uid bit.\n\n");
+     4d8:	83 ec 08             	sub    $0x8,%esp
+  char *test[] = {"UID match", "GID match", "Other", "Should Fail"};
+     4db:	c7 45 bc b2 17 00 00 	movl   $0x17b2,-0x44(%ebp)
+     4e2:	c7 45 c0 bc 17 00 00 	movl   $0x17bc,-0x40(%ebp)
+     4e9:	c7 45 c4 c6 17 00 00 	movl   $0x17c6,-0x3c(%ebp)
+     4f0:	c7 45 c8 cc 17 00 00 	movl   $0x17cc,-0x38(%ebp)
+  printf(1, "\nTesting the set uid bit.\n\n");
+     4f7:	68 d8 17 00 00       	push   $0x17d8
+     4fc:	6a 01                	push   $0x1
+     4fe:	e8 2d 0b 00 00       	call   1030 <printf>
+  for (i=0; i<NUMPERMSTOCHECK; i++) {
+     503:	a1 10 23 00 00       	mov    0x2310,%eax
+     508:	83 c4 10             	add    $0x10,%esp
+     50b:	85 c0                	test   %eax,%eax
+     50d:	0f 8e 9f 01 00 00    	jle    6b2 <main+0x6b2>
+     513:	bb c0 22 00 00       	mov    $0x22c0,%ebx
+     518:	31 ff                	xor    %edi,%edi
+     51a:	e9 d7 00 00 00       	jmp    5f6 <main+0x5f6>
+     51f:	90                   	nop
+    check(setgid(testperms[i][procgid]));
+     520:	83 ec 0c             	sub    $0xc,%esp
+     523:	ff 73 04             	push   0x4(%ebx)
+     526:	e8 20 0a 00 00       	call   f4b <setgid>
+     52b:	83 c4 10             	add    $0x10,%esp
+     52e:	85 c0                	test   %eax,%eax
+     530:	0f 85 3f 03 00 00    	jne    875 <main+0x875>
+    printf(1, "Process uid: %d, gid: %d\n", getuid(), getgid());
+     536:	e8 f8 09 00 00       	call   f33 <getgid>
+     53b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+     53e:	e8 e8 09 00 00       	call   f2b <getuid>
+     543:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+     546:	52                   	push   %edx
+     547:	50                   	push   %eax
+     548:	68 08 18 00 00       	push   $0x1808
+     54d:	6a 01                	push   $0x1
+     54f:	e8 dc 0a 00 00       	call   1030 <printf>
+    check(chown(cmd[0], testperms[i][fileuid]));
+     554:	58                   	pop    %eax
+     555:	5a                   	pop    %edx
+     556:	ff 73 08             	push   0x8(%ebx)
+     559:	ff 75 b4             	push   -0x4c(%ebp)
+     55c:	e8 12 0a 00 00       	call   f73 <chown>
+     561:	83 c4 10             	add    $0x10,%esp
+     564:	85 c0                	test   %eax,%eax
+     566:	0f 85 23 03 00 00    	jne    88f <main+0x88f>
+    check(chgrp(cmd[0], testperms[i][filegid]));
+     56c:	83 ec 08             	sub    $0x8,%esp
+     56f:	ff 73 0c             	push   0xc(%ebx)
+     572:	ff 75 b4             	push   -0x4c(%ebp)
+     575:	e8 01 0a 00 00       	call   f7b <chgrp>
+     57a:	83 c4 10             	add    $0x10,%esp
+     57d:	85 c0                	test   %eax,%eax
+     57f:	0f 85 24 03 00 00    	jne    8a9 <main+0x8a9>
+    printf(1, "File uid: %d, gid: %d\n",
+     585:	ff 73 0c             	push   0xc(%ebx)
+     588:	ff 73 08             	push   0x8(%ebx)
+     58b:	68 22 18 00 00       	push   $0x1822
+     590:	6a 01                	push   $0x1
+     592:	e8 99 0a 00 00       	call   1030 <printf>
+    check(chmod(cmd[0], perms[i]));
+     597:	58                   	pop    %eax
+     598:	5a                   	pop    %edx
+     599:	ff 34 bd 00 23 00 00 	push   0x2300(,%edi,4)
+     5a0:	ff 75 b4             	push   -0x4c(%ebp)
+     5a3:	e8 c3 09 00 00       	call   f6b <chmod>
+     5a8:	83 c4 10             	add    $0x10,%esp
+     5ab:	85 c0                	test   %eax,%eax
+     5ad:	0f 85 10 03 00 00    	jne    8c3 <main+0x8c3>
+    printf(1, "perms set to %d for %s\n", perms[i], cmd[0]);
+     5b3:	ff 75 b4             	push   -0x4c(%ebp)
+     5b6:	ff 34 bd 00 23 00 00 	push   0x2300(,%edi,4)
+     5bd:	68 39 18 00 00       	push   $0x1839
+     5c2:	6a 01                	push   $0x1
+     5c4:	e8 67 0a 00 00       	call   1030 <printf>
+    rc = fork();
+     5c9:	e8 5d 08 00 00       	call   e2b <fork>
+    if (rc < 0) {    // fork failed
+     5ce:	83 c4 10             	add    $0x10,%esp
+     5d1:	85 c0                	test   %eax,%eax
+     5d3:	0f 88 04 03 00 00    	js     8dd <main+0x8dd>
+    if (rc == 0) {   // child
+     5d9:	0f 84 7f 04 00 00    	je     a5e <main+0xa5e>
+    wait();
+     5df:	e8 57 08 00 00       	call   e3b <wait>
+  for (i=0; i<NUMPERMSTOCHECK; i++) {
+     5e4:	83 c7 01             	add    $0x1,%edi
+     5e7:	83 c3 10             	add    $0x10,%ebx
+     5ea:	3b 3d 10 23 00 00    	cmp    0x2310,%edi
+     5f0:	0f 8d bc 00 00 00    	jge    6b2 <main+0x6b2>
+    printf(1, "Starting test: %s.\n", test[i]);
+     5f6:	83 ec 04             	sub    $0x4,%esp
+     5f9:	ff 74 bd bc          	push   -0x44(%ebp,%edi,4)
+     5fd:	68 f4 17 00 00       	push   $0x17f4
+     602:	6a 01                	push   $0x1
+     604:	e8 27 0a 00 00       	call   1030 <printf>
+    check(setuid(testperms[i][procuid]));
+     609:	58                   	pop    %eax
+     60a:	ff 33                	push   (%ebx)
+     60c:	e8 32 09 00 00       	call   f43 <setuid>
+     611:	83 c4 10             	add    $0x10,%esp
+     614:	85 c0                	test   %eax,%eax
+     616:	0f 84 04 ff ff ff    	je     520 <main+0x520>
+     61c:	53                   	push   %ebx
+     61d:	68 6b 17 00 00       	push   $0x176b
+     622:	68 ab 16 00 00       	push   $0x16ab
+     627:	6a 02                	push   $0x2
+     629:	e8 02 0a 00 00       	call   1030 <printf>
+     62e:	83 c4 10             	add    $0x10,%esp
+      case 7: doTest(doSetuidTest, t1); break;
+     631:	50                   	push   %eax
+     632:	68 51 18 00 00       	push   $0x1851
+     637:	68 46 16 00 00       	push   $0x1646
+     63c:	6a 02                	push   $0x2
+     63e:	e8 ed 09 00 00       	call   1030 <printf>
+     643:	e8 eb 07 00 00       	call   e33 <exit>
+     648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+        printf(1, "Error:invalid test number.\n");
+     650:	83 ec 08             	sub    $0x8,%esp
+     653:	68 5e 18 00 00       	push   $0x185e
+     658:	6a 01                	push   $0x1
+     65a:	e8 d1 09 00 00       	call   1030 <printf>
+     65f:	83 c4 10             	add    $0x10,%esp
+     662:	e9 c1 f9 ff ff       	jmp    28 <main+0x28>
+    if (st.mode.flags.u_x)
+     667:	80 e2 40             	and    $0x40,%dl
+     66a:	0f 85 6c fa ff ff    	jne    dc <main+0xdc>
+      printf(2, "UID match. Execute permission for user not set.\n");
+     670:	51                   	push   %ecx
+     671:	51                   	push   %ecx
+     672:	68 38 1c 00 00       	push   $0x1c38
+     677:	6a 02                	push   $0x2
+     679:	e8 b2 09 00 00       	call   1030 <printf>
+     67e:	83 c4 10             	add    $0x10,%esp
+     681:	e9 36 01 00 00       	jmp    7bc <main+0x7bc>
+  check(stat(cmd[0], &st));
+     686:	50                   	push   %eax
+     687:	68 99 16 00 00       	push   $0x1699
+     68c:	68 ab 16 00 00       	push   $0x16ab
+     691:	6a 02                	push   $0x2
+     693:	e8 98 09 00 00       	call   1030 <printf>
+     698:	83 c4 10             	add    $0x10,%esp
+      case 3: doTest(doChmodTest,  t1); break;
+     69b:	51                   	push   %ecx
+     69c:	68 ed 16 00 00       	push   $0x16ed
+     6a1:	68 46 16 00 00       	push   $0x1646
+     6a6:	6a 02                	push   $0x2
+     6a8:	e8 83 09 00 00       	call   1030 <printf>
+     6ad:	e8 81 07 00 00       	call   e33 <exit>
+  chmod(cmd[0], 00755);  // total hack but necessary. sigh
+     6b2:	53                   	push   %ebx
+     6b3:	53                   	push   %ebx
+     6b4:	68 ed 01 00 00       	push   $0x1ed
+     6b9:	ff 75 b4             	push   -0x4c(%ebp)
+     6bc:	e8 aa 08 00 00       	call   f6b <chmod>
+     6c1:	e9 01 fc ff ff       	jmp    2c7 <main+0x2c7>
+    printf(2, "Error! chgrp() failed on setting new group.\n");
+     6c6:	50                   	push   %eax
+     6c7:	50                   	push   %eax
+     6c8:	68 c8 1b 00 00       	push   $0x1bc8
+     6cd:	6a 02                	push   $0x2
+     6cf:	e8 5c 09 00 00       	call   1030 <printf>
+     6d4:	83 c4 10             	add    $0x10,%esp
+      case 5: doTest(doChgrpTest,  t1); break;
+     6d7:	50                   	push   %eax
+     6d8:	68 37 17 00 00       	push   $0x1737
+     6dd:	68 46 16 00 00       	push   $0x1646
+     6e2:	6a 02                	push   $0x2
+     6e4:	e8 47 09 00 00       	call   1030 <printf>
+     6e9:	e8 45 07 00 00       	call   e33 <exit>
+    printf(2, "setuid system call reports an error.\n");
+     6ee:	53                   	push   %ebx
+     6ef:	53                   	push   %ebx
+     6f0:	68 7c 18 00 00       	push   $0x187c
+     6f5:	6a 02                	push   $0x2
+     6f7:	e8 34 09 00 00       	call   1030 <printf>
+     6fc:	83 c4 10             	add    $0x10,%esp
+      case 1: doTest(doUidTest,    t0); break;
+     6ff:	50                   	push   %eax
+     700:	68 3c 16 00 00       	push   $0x163c
+     705:	68 46 16 00 00       	push   $0x1646
+     70a:	6a 02                	push   $0x2
+     70c:	e8 1f 09 00 00       	call   1030 <printf>
+     711:	e8 1d 07 00 00       	call   e33 <exit>
+    printf(2, "Error! chown() failed on setting new owner. %d as rc.\n", rc);
+     716:	52                   	push   %edx
+     717:	50                   	push   %eax
+     718:	68 50 1b 00 00       	push   $0x1b50
+     71d:	6a 02                	push   $0x2
+     71f:	e8 0c 09 00 00       	call   1030 <printf>
+     724:	83 c4 10             	add    $0x10,%esp
+      case 4: doTest(doChownTest,  t1); break;
+     727:	51                   	push   %ecx
+     728:	68 12 17 00 00       	push   $0x1712
+     72d:	68 46 16 00 00       	push   $0x1646
+     732:	6a 02                	push   $0x2
+     734:	e8 f7 08 00 00       	call   1030 <printf>
+     739:	e8 f5 06 00 00       	call   e33 <exit>
+    printf(2, "setgid system call reports an error.\n");
+     73e:	50                   	push   %eax
+     73f:	50                   	push   %eax
+     740:	68 c8 19 00 00       	push   $0x19c8
+     745:	6a 02                	push   $0x2
+     747:	e8 e4 08 00 00       	call   1030 <printf>
+     74c:	83 c4 10             	add    $0x10,%esp
+      case 2: doTest(doGidTest,    t0); break;
+     74f:	51                   	push   %ecx
+     750:	68 74 16 00 00       	push   $0x1674
+     755:	68 46 16 00 00       	push   $0x1646
+     75a:	6a 02                	push   $0x2
+     75c:	e8 cf 08 00 00       	call   1030 <printf>
+     761:	e8 cd 06 00 00       	call   e33 <exit>
+    printf(2, "ERROR! setgid claims to have worked but really didn't!\n");
+     766:	50                   	push   %eax
+     767:	50                   	push   %eax
+     768:	68 f0 19 00 00       	push   $0x19f0
+     76d:	6a 02                	push   $0x2
+     76f:	e8 bc 08 00 00       	call   1030 <printf>
+    printf(2, "gid should be %d but is instead %d\n", testgid, gid);
+     774:	57                   	push   %edi
+     775:	53                   	push   %ebx
+     776:	68 28 1a 00 00       	push   $0x1a28
+     77b:	6a 02                	push   $0x2
+     77d:	e8 ae 08 00 00       	call   1030 <printf>
+     782:	83 c4 20             	add    $0x20,%esp
+     785:	eb c8                	jmp    74f <main+0x74f>
+    printf(2, "ERROR! setuid claims to have worked but really didn't!\n");
+     787:	51                   	push   %ecx
+     788:	51                   	push   %ecx
+     789:	68 a4 18 00 00       	push   $0x18a4
+     78e:	6a 02                	push   $0x2
+     790:	e8 9b 08 00 00       	call   1030 <printf>
+    printf(2, "uid should be %d but is instead %d\n", testuid, uid);
+     795:	57                   	push   %edi
+     796:	53                   	push   %ebx
+     797:	68 dc 18 00 00       	push   $0x18dc
+     79c:	6a 02                	push   $0x2
+     79e:	e8 8d 08 00 00       	call   1030 <printf>
+     7a3:	83 c4 20             	add    $0x20,%esp
+     7a6:	e9 54 ff ff ff       	jmp    6ff <main+0x6ff>
+  printf(2, "Execute permission for other not set.\n");
+     7ab:	50                   	push   %eax
+     7ac:	50                   	push   %eax
+     7ad:	68 a0 1c 00 00       	push   $0x1ca0
+     7b2:	6a 02                	push   $0x2
+     7b4:	e8 77 08 00 00       	call   1030 <printf>
+     7b9:	83 c4 10             	add    $0x10,%esp
+    printf(2, "Unable to run %s. test aborted.\n", cmd[0]);
+     7bc:	50                   	push   %eax
+     7bd:	ff 75 b4             	push   -0x4c(%ebp)
+     7c0:	68 c8 1c 00 00       	push   $0x1cc8
+     7c5:	6a 02                	push   $0x2
+     7c7:	e8 64 08 00 00       	call   1030 <printf>
+     7cc:	83 c4 10             	add    $0x10,%esp
+      case 6: doTest(doExecTest,   t1); break;
+     7cf:	50                   	push   %eax
+     7d0:	68 a7 17 00 00       	push   $0x17a7
+     7d5:	68 46 16 00 00       	push   $0x1646
+     7da:	6a 02                	push   $0x2
+     7dc:	e8 4f 08 00 00       	call   1030 <printf>
+     7e1:	e8 4d 06 00 00       	call   e33 <exit>
+    printf(2, "Error! test failed. Old uid: %d, new uid: uid2, should differ\n",
+     7e6:	53                   	push   %ebx
+     7e7:	53                   	push   %ebx
+     7e8:	68 88 1b 00 00       	push   $0x1b88
+     7ed:	6a 02                	push   $0x2
+     7ef:	e8 3c 08 00 00       	call   1030 <printf>
+     7f4:	83 c4 10             	add    $0x10,%esp
+     7f7:	e9 2b ff ff ff       	jmp    727 <main+0x727>
+    printf(2, "Error! test failed. Old gid: %d, new gid: gid2, should differ\n",
+     7fc:	53                   	push   %ebx
+     7fd:	53                   	push   %ebx
+     7fe:	68 f8 1b 00 00       	push   $0x1bf8
+     803:	6a 02                	push   $0x2
+     805:	e8 26 08 00 00       	call   1030 <printf>
+     80a:	83 c4 10             	add    $0x10,%esp
+     80d:	e9 c5 fe ff ff       	jmp    6d7 <main+0x6d7>
+  check(stat(name, &st));
+     812:	53                   	push   %ebx
+     813:	68 5b 17 00 00       	push   $0x175b
+     818:	68 ab 16 00 00       	push   $0x16ab
+     81d:	6a 02                	push   $0x2
+     81f:	e8 0c 08 00 00       	call   1030 <printf>
+     824:	83 c4 10             	add    $0x10,%esp
+     827:	eb 93                	jmp    7bc <main+0x7bc>
+      printf(2, "Error! Unable to test.\n");
+     829:	56                   	push   %esi
+     82a:	56                   	push   %esi
+     82b:	68 d5 16 00 00       	push   $0x16d5
+     830:	6a 02                	push   $0x2
+     832:	e8 f9 07 00 00       	call   1030 <printf>
+      printf(2, "\tfile mode (%d) == testmode (%d) for file (%s) in test %d\n",
+     837:	5f                   	pop    %edi
+     838:	58                   	pop    %eax
+     839:	53                   	push   %ebx
+     83a:	ff 75 b4             	push   -0x4c(%ebp)
+     83d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     840:	50                   	push   %eax
+     841:	50                   	push   %eax
+     842:	68 14 1b 00 00       	push   $0x1b14
+     847:	6a 02                	push   $0x2
+     849:	e8 e2 07 00 00       	call   1030 <printf>
+     84e:	83 c4 20             	add    $0x20,%esp
+     851:	e9 45 fe ff ff       	jmp    69b <main+0x69b>
+    if (st.mode.flags.g_x)
+     856:	80 e2 08             	and    $0x8,%dl
+     859:	0f 85 7d f8 ff ff    	jne    dc <main+0xdc>
+      printf(2, "GID match. Execute permission for group not set.\n");
+     85f:	52                   	push   %edx
+     860:	52                   	push   %edx
+     861:	68 6c 1c 00 00       	push   $0x1c6c
+     866:	6a 02                	push   $0x2
+     868:	e8 c3 07 00 00       	call   1030 <printf>
+     86d:	83 c4 10             	add    $0x10,%esp
+     870:	e9 47 ff ff ff       	jmp    7bc <main+0x7bc>
+    check(setgid(testperms[i][procgid]));
+     875:	51                   	push   %ecx
+     876:	68 89 17 00 00       	push   $0x1789
+     87b:	68 ab 16 00 00       	push   $0x16ab
+     880:	6a 02                	push   $0x2
+     882:	e8 a9 07 00 00       	call   1030 <printf>
+     887:	83 c4 10             	add    $0x10,%esp
+     88a:	e9 a2 fd ff ff       	jmp    631 <main+0x631>
+    check(chown(cmd[0], testperms[i][fileuid]));
+     88f:	53                   	push   %ebx
+     890:	68 18 1d 00 00       	push   $0x1d18
+     895:	68 ab 16 00 00       	push   $0x16ab
+     89a:	6a 02                	push   $0x2
+     89c:	e8 8f 07 00 00       	call   1030 <printf>
+     8a1:	83 c4 10             	add    $0x10,%esp
+     8a4:	e9 88 fd ff ff       	jmp    631 <main+0x631>
+    check(chgrp(cmd[0], testperms[i][filegid]));
+     8a9:	51                   	push   %ecx
+     8aa:	68 40 1d 00 00       	push   $0x1d40
+     8af:	68 ab 16 00 00       	push   $0x16ab
+     8b4:	6a 02                	push   $0x2
+     8b6:	e8 75 07 00 00       	call   1030 <printf>
+     8bb:	83 c4 10             	add    $0x10,%esp
+     8be:	e9 6e fd ff ff       	jmp    631 <main+0x631>
+    check(chmod(cmd[0], perms[i]));
+     8c3:	50                   	push   %eax
+     8c4:	68 bd 16 00 00       	push   $0x16bd
+     8c9:	68 ab 16 00 00       	push   $0x16ab
+     8ce:	6a 02                	push   $0x2
+     8d0:	e8 5b 07 00 00       	call   1030 <printf>
+     8d5:	83 c4 10             	add    $0x10,%esp
+     8d8:	e9 54 fd ff ff       	jmp    631 <main+0x631>
+      printf(2, "The fork() system call failed. That's pretty catastrophic. Ending test\n");
+     8dd:	50                   	push   %eax
+     8de:	50                   	push   %eax
+     8df:	68 c0 1d 00 00       	push   $0x1dc0
+     8e4:	6a 02                	push   $0x2
+     8e6:	e8 45 07 00 00       	call   1030 <printf>
+     8eb:	83 c4 10             	add    $0x10,%esp
+     8ee:	e9 3e fd ff ff       	jmp    631 <main+0x631>
+  check(stat(cmd[0], &st));
+     8f3:	50                   	push   %eax
+     8f4:	68 99 16 00 00       	push   $0x1699
+     8f9:	68 ab 16 00 00       	push   $0x16ab
+     8fe:	6a 02                	push   $0x2
+     900:	e8 2b 07 00 00       	call   1030 <printf>
+     905:	83 c4 10             	add    $0x10,%esp
+     908:	e9 c2 fe ff ff       	jmp    7cf <main+0x7cf>
+  chown(cmd[0], uid);
+     90d:	50                   	push   %eax
+     90e:	50                   	push   %eax
+  uid = st.uid;
+     90f:	0f b7 45 a4          	movzwl -0x5c(%ebp),%eax
+  chown(cmd[0], uid);
+     913:	50                   	push   %eax
+     914:	ff 75 b4             	push   -0x4c(%ebp)
+     917:	e8 57 06 00 00       	call   f73 <chown>
+  chgrp(cmd[0], gid);
+     91c:	58                   	pop    %eax
+  gid = st.gid;
+     91d:	0f b7 45 a0          	movzwl -0x60(%ebp),%eax
+  chgrp(cmd[0], gid);
+     921:	5a                   	pop    %edx
+     922:	50                   	push   %eax
+     923:	ff 75 b4             	push   -0x4c(%ebp)
+     926:	e8 50 06 00 00       	call   f7b <chgrp>
+  chmod(cmd[0], 00755);
+     92b:	59                   	pop    %ecx
+     92c:	5b                   	pop    %ebx
+     92d:	68 ed 01 00 00       	push   $0x1ed
+     932:	ff 75 b4             	push   -0x4c(%ebp)
+     935:	e8 31 06 00 00       	call   f6b <chmod>
+  printf(1, "Requires user visually confirms PASS/FAIL\n");
+     93a:	5f                   	pop    %edi
+     93b:	58                   	pop    %eax
+     93c:	68 ec 1c 00 00       	push   $0x1cec
+     941:	6a 01                	push   $0x1
+     943:	e8 e8 06 00 00       	call   1030 <printf>
+      case 6: doTest(doExecTest,   t1); break;
+     948:	83 c4 10             	add    $0x10,%esp
+     94b:	e9 d8 f6 ff ff       	jmp    28 <main+0x28>
+    check(setuid(testperms[i][procuid]));
+     950:	57                   	push   %edi
+     951:	68 6b 17 00 00       	push   $0x176b
+     956:	68 ab 16 00 00       	push   $0x16ab
+     95b:	6a 02                	push   $0x2
+     95d:	e8 ce 06 00 00       	call   1030 <printf>
+     962:	83 c4 10             	add    $0x10,%esp
+     965:	e9 65 fe ff ff       	jmp    7cf <main+0x7cf>
+    check(setgid(testperms[i][procgid]));
+     96a:	56                   	push   %esi
+     96b:	68 89 17 00 00       	push   $0x1789
+     970:	68 ab 16 00 00       	push   $0x16ab
+     975:	6a 02                	push   $0x2
+     977:	e8 b4 06 00 00       	call   1030 <printf>
+     97c:	83 c4 10             	add    $0x10,%esp
+     97f:	e9 4b fe ff ff       	jmp    7cf <main+0x7cf>
+    check(chown(cmd[0], testperms[i][fileuid]));
+     984:	53                   	push   %ebx
+     985:	68 18 1d 00 00       	push   $0x1d18
+     98a:	68 ab 16 00 00       	push   $0x16ab
+     98f:	6a 02                	push   $0x2
+     991:	e8 9a 06 00 00       	call   1030 <printf>
+     996:	83 c4 10             	add    $0x10,%esp
+     999:	e9 31 fe ff ff       	jmp    7cf <main+0x7cf>
+    check(chgrp(cmd[0], testperms[i][filegid]));
+     99e:	51                   	push   %ecx
+     99f:	68 40 1d 00 00       	push   $0x1d40
+     9a4:	68 ab 16 00 00       	push   $0x16ab
+     9a9:	6a 02                	push   $0x2
+     9ab:	e8 80 06 00 00       	call   1030 <printf>
+     9b0:	83 c4 10             	add    $0x10,%esp
+     9b3:	e9 17 fe ff ff       	jmp    7cf <main+0x7cf>
+    check(chmod(cmd[0], perms[i]));
+     9b8:	52                   	push   %edx
+     9b9:	68 bd 16 00 00       	push   $0x16bd
+     9be:	68 ab 16 00 00       	push   $0x16ab
+     9c3:	6a 02                	push   $0x2
+     9c5:	e8 66 06 00 00       	call   1030 <printf>
+     9ca:	83 c4 10             	add    $0x10,%esp
+     9cd:	e9 fd fd ff ff       	jmp    7cf <main+0x7cf>
+      printf(2, "The fork() system call failed. That's pretty catastrophic. Ending test\n");
+     9d2:	50                   	push   %eax
+     9d3:	50                   	push   %eax
+     9d4:	68 c0 1d 00 00       	push   $0x1dc0
+     9d9:	6a 02                	push   $0x2
+     9db:	e8 50 06 00 00       	call   1030 <printf>
+     9e0:	83 c4 10             	add    $0x10,%esp
+     9e3:	e9 e7 fd ff ff       	jmp    7cf <main+0x7cf>
+      printf(2, "Tried to set the uid to a bad value (%d) and setuid()failed to fail. rc == %d\n",
+     9e8:	6a 00                	push   $0x0
+     9ea:	57                   	push   %edi
+     9eb:	68 00 19 00 00       	push   $0x1900
+     9f0:	6a 02                	push   $0x2
+     9f2:	e8 39 06 00 00       	call   1030 <printf>
+     9f7:	83 c4 10             	add    $0x10,%esp
+     9fa:	e9 00 fd ff ff       	jmp    6ff <main+0x6ff>
+      printf(2, "Tried to set the gid to a bad value (%d) and setgid()failed to fail. rc == %d\n",
+     9ff:	6a 00                	push   $0x0
+     a01:	57                   	push   %edi
+     a02:	68 4c 1a 00 00       	push   $0x1a4c
+     a07:	6a 02                	push   $0x2
+     a09:	e8 22 06 00 00       	call   1030 <printf>
+     a0e:	83 c4 10             	add    $0x10,%esp
+     a11:	e9 39 fd ff ff       	jmp    74f <main+0x74f>
+      printf(2, "ERROR! Gave setuid() a bad value (%d) and it failed to fail. gid: %d\n",
+     a16:	57                   	push   %edi
+     a17:	57                   	push   %edi
+     a18:	68 50 19 00 00       	push   $0x1950
+     a1d:	6a 02                	push   $0x2
+     a1f:	e8 0c 06 00 00       	call   1030 <printf>
+      printf(2, "Valid UIDs are in the range [0, 32767] only!\n");
+     a24:	58                   	pop    %eax
+     a25:	5a                   	pop    %edx
+     a26:	68 98 19 00 00       	push   $0x1998
+     a2b:	6a 02                	push   $0x2
+     a2d:	e8 fe 05 00 00       	call   1030 <printf>
+     a32:	83 c4 10             	add    $0x10,%esp
+     a35:	e9 c5 fc ff ff       	jmp    6ff <main+0x6ff>
+      printf(2, "ERROR! Gave setgid() a bad value (%d) and it failed to fail. gid: %d\n",
+     a3a:	57                   	push   %edi
+     a3b:	57                   	push   %edi
+     a3c:	68 9c 1a 00 00       	push   $0x1a9c
+     a41:	6a 02                	push   $0x2
+     a43:	e8 e8 05 00 00       	call   1030 <printf>
+      printf(2, "Valid GIDs are in the range [0, 32767] only!\n");
+     a48:	5b                   	pop    %ebx
+     a49:	5e                   	pop    %esi
+     a4a:	68 e4 1a 00 00       	push   $0x1ae4
+     a4f:	6a 02                	push   $0x2
+     a51:	e8 da 05 00 00       	call   1030 <printf>
+     a56:	83 c4 10             	add    $0x10,%esp
+     a59:	e9 f1 fc ff ff       	jmp    74f <main+0x74f>
+      exec(cmd[0], cmd);
+     a5e:	50                   	push   %eax
+     a5f:	50                   	push   %eax
+     a60:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+     a63:	50                   	push   %eax
+     a64:	ff 75 b4             	push   -0x4c(%ebp)
+     a67:	e8 ff 03 00 00       	call   e6b <exec>
+      if (i != NUMPERMSTOCHECK-1) printf(2, "**** exec call for %s **FAILED**.\n",  cmd[0]);
+     a6c:	a1 10 23 00 00       	mov    0x2310,%eax
+     a71:	83 c4 10             	add    $0x10,%esp
+     a74:	83 e8 01             	sub    $0x1,%eax
+     a77:	39 f8                	cmp    %edi,%eax
+     a79:	74 18                	je     a93 <main+0xa93>
+     a7b:	56                   	push   %esi
+     a7c:	ff 75 b4             	push   -0x4c(%ebp)
+     a7f:	68 08 1e 00 00       	push   $0x1e08
+     a84:	6a 02                	push   $0x2
+     a86:	e8 a5 05 00 00       	call   1030 <printf>
+     a8b:	83 c4 10             	add    $0x10,%esp
+      exit();
+     a8e:	e8 a0 03 00 00       	call   e33 <exit>
+      else printf(2, "**** exec call for %s **FAILED as expected.\n", cmd[0]);
+     a93:	50                   	push   %eax
+     a94:	ff 75 b4             	push   -0x4c(%ebp)
+     a97:	68 2c 1e 00 00       	push   $0x1e2c
+     a9c:	6a 02                	push   $0x2
+     a9e:	e8 8d 05 00 00       	call   1030 <printf>
+     aa3:	83 c4 10             	add    $0x10,%esp
+     aa6:	eb e6                	jmp    a8e <main+0xa8e>
+     aa8:	66 90                	xchg   %ax,%ax
+     aaa:	66 90                	xchg   %ax,%ax
+     aac:	66 90                	xchg   %ax,%ax
+     aae:	66 90                	xchg   %ax,%ax
+
+00000ab0 <printMenu>:
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "\n");
+     ab6:	68 f2 17 00 00       	push   $0x17f2
+     abb:	6a 01                	push   $0x1
+     abd:	e8 6e 05 00 00       	call   1030 <printf>
+  printf(1, "%d. exit program\n", i++);
+     ac2:	83 c4 0c             	add    $0xc,%esp
+     ac5:	6a 00                	push   $0x0
+     ac7:	68 78 15 00 00       	push   $0x1578
+     acc:	6a 01                	push   $0x1
+     ace:	e8 5d 05 00 00       	call   1030 <printf>
+  printf(1, "%d. Proc UID\n", i++);
+     ad3:	83 c4 0c             	add    $0xc,%esp
+     ad6:	6a 01                	push   $0x1
+     ad8:	68 8a 15 00 00       	push   $0x158a
+     add:	6a 01                	push   $0x1
+     adf:	e8 4c 05 00 00       	call   1030 <printf>
+  printf(1, "%d. Proc GID\n", i++);
+     ae4:	83 c4 0c             	add    $0xc,%esp
+     ae7:	6a 02                	push   $0x2
+     ae9:	68 98 15 00 00       	push   $0x1598
+     aee:	6a 01                	push   $0x1
+     af0:	e8 3b 05 00 00       	call   1030 <printf>
+  printf(1, "%d. chmod()\n", i++);
+     af5:	83 c4 0c             	add    $0xc,%esp
+     af8:	6a 03                	push   $0x3
+     afa:	68 a6 15 00 00       	push   $0x15a6
+     aff:	6a 01                	push   $0x1
+     b01:	e8 2a 05 00 00       	call   1030 <printf>
+  printf(1, "%d. chown()\n", i++);
+     b06:	83 c4 0c             	add    $0xc,%esp
+     b09:	6a 04                	push   $0x4
+     b0b:	68 b3 15 00 00       	push   $0x15b3
+     b10:	6a 01                	push   $0x1
+     b12:	e8 19 05 00 00       	call   1030 <printf>
+  printf(1, "%d. chgrp()\n", i++);
+     b17:	83 c4 0c             	add    $0xc,%esp
+     b1a:	6a 05                	push   $0x5
+     b1c:	68 c0 15 00 00       	push   $0x15c0
+     b21:	6a 01                	push   $0x1
+     b23:	e8 08 05 00 00       	call   1030 <printf>
+  printf(1, "%d. exec()\n", i++);
+     b28:	83 c4 0c             	add    $0xc,%esp
+     b2b:	6a 06                	push   $0x6
+     b2d:	68 cd 15 00 00       	push   $0x15cd
+     b32:	6a 01                	push   $0x1
+     b34:	e8 f7 04 00 00       	call   1030 <printf>
+  printf(1, "%d. setuid\n", i++);
+     b39:	83 c4 0c             	add    $0xc,%esp
+     b3c:	6a 07                	push   $0x7
+     b3e:	68 d9 15 00 00       	push   $0x15d9
+     b43:	6a 01                	push   $0x1
+     b45:	e8 e6 04 00 00       	call   1030 <printf>
+}
+     b4a:	83 c4 10             	add    $0x10,%esp
+     b4d:	c9                   	leave
+     b4e:	c3                   	ret
+     b4f:	90                   	nop
+
+00000b50 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     b50:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     b51:	31 c0                	xor    %eax,%eax
+{
+     b53:	89 e5                	mov    %esp,%ebp
+     b55:	53                   	push   %ebx
+     b56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     b59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     b60:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     b64:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     b67:	83 c0 01             	add    $0x1,%eax
+     b6a:	84 d2                	test   %dl,%dl
+     b6c:	75 f2                	jne    b60 <strcpy+0x10>
+    ;
+  return os;
+}
+     b6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b71:	89 c8                	mov    %ecx,%eax
+     b73:	c9                   	leave
+     b74:	c3                   	ret
+     b75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b80 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	53                   	push   %ebx
+     b84:	8b 55 08             	mov    0x8(%ebp),%edx
+     b87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     b8a:	0f b6 02             	movzbl (%edx),%eax
+     b8d:	84 c0                	test   %al,%al
+     b8f:	75 17                	jne    ba8 <strcmp+0x28>
+     b91:	eb 3a                	jmp    bcd <strcmp+0x4d>
+     b93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b97:	90                   	nop
+     b98:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     b9c:	83 c2 01             	add    $0x1,%edx
+     b9f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     ba2:	84 c0                	test   %al,%al
+     ba4:	74 1a                	je     bc0 <strcmp+0x40>
+    p++, q++;
+     ba6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     ba8:	0f b6 19             	movzbl (%ecx),%ebx
+     bab:	38 c3                	cmp    %al,%bl
+     bad:	74 e9                	je     b98 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     baf:	29 d8                	sub    %ebx,%eax
+}
+     bb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bb4:	c9                   	leave
+     bb5:	c3                   	ret
+     bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     bc0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     bc4:	31 c0                	xor    %eax,%eax
+     bc6:	29 d8                	sub    %ebx,%eax
+}
+     bc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bcb:	c9                   	leave
+     bcc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     bcd:	0f b6 19             	movzbl (%ecx),%ebx
+     bd0:	31 c0                	xor    %eax,%eax
+     bd2:	eb db                	jmp    baf <strcmp+0x2f>
+     bd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bdf:	90                   	nop
+
+00000be0 <strlen>:
+
+uint
+strlen(char *s)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     be6:	80 3a 00             	cmpb   $0x0,(%edx)
+     be9:	74 15                	je     c00 <strlen+0x20>
+     beb:	31 c0                	xor    %eax,%eax
+     bed:	8d 76 00             	lea    0x0(%esi),%esi
+     bf0:	83 c0 01             	add    $0x1,%eax
+     bf3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     bf7:	89 c1                	mov    %eax,%ecx
+     bf9:	75 f5                	jne    bf0 <strlen+0x10>
+    ;
+  return n;
+}
+     bfb:	89 c8                	mov    %ecx,%eax
+     bfd:	5d                   	pop    %ebp
+     bfe:	c3                   	ret
+     bff:	90                   	nop
+  for(n = 0; s[n]; n++)
+     c00:	31 c9                	xor    %ecx,%ecx
+}
+     c02:	5d                   	pop    %ebp
+     c03:	89 c8                	mov    %ecx,%eax
+     c05:	c3                   	ret
+     c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c10 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	57                   	push   %edi
+     c14:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     c17:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c1d:	89 d7                	mov    %edx,%edi
+     c1f:	fc                   	cld
+     c20:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     c22:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     c25:	89 d0                	mov    %edx,%eax
+     c27:	c9                   	leave
+     c28:	c3                   	ret
+     c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c30 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     c30:	55                   	push   %ebp
+     c31:	89 e5                	mov    %esp,%ebp
+     c33:	8b 45 08             	mov    0x8(%ebp),%eax
+     c36:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     c3a:	0f b6 10             	movzbl (%eax),%edx
+     c3d:	84 d2                	test   %dl,%dl
+     c3f:	75 12                	jne    c53 <strchr+0x23>
+     c41:	eb 1d                	jmp    c60 <strchr+0x30>
+     c43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c47:	90                   	nop
+     c48:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     c4c:	83 c0 01             	add    $0x1,%eax
+     c4f:	84 d2                	test   %dl,%dl
+     c51:	74 0d                	je     c60 <strchr+0x30>
+    if(*s == c)
+     c53:	38 d1                	cmp    %dl,%cl
+     c55:	75 f1                	jne    c48 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     c57:	5d                   	pop    %ebp
+     c58:	c3                   	ret
+     c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     c60:	31 c0                	xor    %eax,%eax
+}
+     c62:	5d                   	pop    %ebp
+     c63:	c3                   	ret
+     c64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c6f:	90                   	nop
+
+00000c70 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	57                   	push   %edi
+     c74:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     c75:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     c78:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     c79:	31 db                	xor    %ebx,%ebx
+{
+     c7b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     c7e:	eb 27                	jmp    ca7 <gets+0x37>
+    cc = read(0, &c, 1);
+     c80:	83 ec 04             	sub    $0x4,%esp
+     c83:	6a 01                	push   $0x1
+     c85:	56                   	push   %esi
+     c86:	6a 00                	push   $0x0
+     c88:	e8 be 01 00 00       	call   e4b <read>
+    if(cc < 1)
+     c8d:	83 c4 10             	add    $0x10,%esp
+     c90:	85 c0                	test   %eax,%eax
+     c92:	7e 1d                	jle    cb1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     c94:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     c98:	8b 55 08             	mov    0x8(%ebp),%edx
+     c9b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     c9f:	3c 0a                	cmp    $0xa,%al
+     ca1:	74 10                	je     cb3 <gets+0x43>
+     ca3:	3c 0d                	cmp    $0xd,%al
+     ca5:	74 0c                	je     cb3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     ca7:	89 df                	mov    %ebx,%edi
+     ca9:	83 c3 01             	add    $0x1,%ebx
+     cac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     caf:	7c cf                	jl     c80 <gets+0x10>
+     cb1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     cba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cbd:	5b                   	pop    %ebx
+     cbe:	5e                   	pop    %esi
+     cbf:	5f                   	pop    %edi
+     cc0:	5d                   	pop    %ebp
+     cc1:	c3                   	ret
+     cc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cd0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	56                   	push   %esi
+     cd4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     cd5:	83 ec 08             	sub    $0x8,%esp
+     cd8:	6a 00                	push   $0x0
+     cda:	ff 75 08             	push   0x8(%ebp)
+     cdd:	e8 91 01 00 00       	call   e73 <open>
+  if(fd < 0)
+     ce2:	83 c4 10             	add    $0x10,%esp
+     ce5:	85 c0                	test   %eax,%eax
+     ce7:	78 27                	js     d10 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     ce9:	83 ec 08             	sub    $0x8,%esp
+     cec:	ff 75 0c             	push   0xc(%ebp)
+     cef:	89 c3                	mov    %eax,%ebx
+     cf1:	50                   	push   %eax
+     cf2:	e8 94 01 00 00       	call   e8b <fstat>
+  close(fd);
+     cf7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     cfa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     cfc:	e8 5a 01 00 00       	call   e5b <close>
+  return r;
+     d01:	83 c4 10             	add    $0x10,%esp
+}
+     d04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d07:	89 f0                	mov    %esi,%eax
+     d09:	5b                   	pop    %ebx
+     d0a:	5e                   	pop    %esi
+     d0b:	5d                   	pop    %ebp
+     d0c:	c3                   	ret
+     d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     d10:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     d15:	eb ed                	jmp    d04 <stat+0x34>
+     d17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1e:	66 90                	xchg   %ax,%ax
+
+00000d20 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	56                   	push   %esi
+     d24:	53                   	push   %ebx
+     d25:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     d28:	0f b6 02             	movzbl (%edx),%eax
+     d2b:	3c 20                	cmp    $0x20,%al
+     d2d:	75 0c                	jne    d3b <atoi+0x1b>
+     d2f:	90                   	nop
+     d30:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+     d34:	83 c2 01             	add    $0x1,%edx
+     d37:	3c 20                	cmp    $0x20,%al
+     d39:	74 f5                	je     d30 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     d3b:	3c 2d                	cmp    $0x2d,%al
+     d3d:	74 41                	je     d80 <atoi+0x60>
+     d3f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     d44:	3c 2b                	cmp    $0x2b,%al
+     d46:	74 3d                	je     d85 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+     d48:	0f be 0a             	movsbl (%edx),%ecx
+     d4b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     d4e:	3c 09                	cmp    $0x9,%al
+     d50:	b8 00 00 00 00       	mov    $0x0,%eax
+     d55:	77 21                	ja     d78 <atoi+0x58>
+     d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     d60:	83 c2 01             	add    $0x1,%edx
+     d63:	8d 04 80             	lea    (%eax,%eax,4),%eax
+     d66:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+     d6a:	0f be 0a             	movsbl (%edx),%ecx
+     d6d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     d70:	80 fb 09             	cmp    $0x9,%bl
+     d73:	76 eb                	jbe    d60 <atoi+0x40>
+  return sign*n;
+     d75:	0f af c6             	imul   %esi,%eax
+}
+     d78:	5b                   	pop    %ebx
+     d79:	5e                   	pop    %esi
+     d7a:	5d                   	pop    %ebp
+     d7b:	c3                   	ret
+     d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+     d80:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     d85:	83 c2 01             	add    $0x1,%edx
+     d88:	eb be                	jmp    d48 <atoi+0x28>
+     d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d90 <atoo>:
+
+int
+atoo(const char *s)
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	56                   	push   %esi
+     d94:	53                   	push   %ebx
+     d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     d98:	0f b6 02             	movzbl (%edx),%eax
+     d9b:	3c 20                	cmp    $0x20,%al
+     d9d:	75 0c                	jne    dab <atoo+0x1b>
+     d9f:	90                   	nop
+     da0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+     da4:	83 c2 01             	add    $0x1,%edx
+     da7:	3c 20                	cmp    $0x20,%al
+     da9:	74 f5                	je     da0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+     dab:	3c 2d                	cmp    $0x2d,%al
+     dad:	74 41                	je     df0 <atoo+0x60>
+     daf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     db4:	3c 2b                	cmp    $0x2b,%al
+     db6:	74 3d                	je     df5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+     db8:	0f be 0a             	movsbl (%edx),%ecx
+     dbb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     dbe:	3c 07                	cmp    $0x7,%al
+     dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc5:	77 1e                	ja     de5 <atoo+0x55>
+     dc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dce:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+     dd0:	83 c2 01             	add    $0x1,%edx
+     dd3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+     dd7:	0f be 0a             	movsbl (%edx),%ecx
+     dda:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     ddd:	80 fb 07             	cmp    $0x7,%bl
+     de0:	76 ee                	jbe    dd0 <atoo+0x40>
+  return sign*n;
+     de2:	0f af c6             	imul   %esi,%eax
+}
+     de5:	5b                   	pop    %ebx
+     de6:	5e                   	pop    %esi
+     de7:	5d                   	pop    %ebp
+     de8:	c3                   	ret
+     de9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+     df0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+     df5:	83 c2 01             	add    $0x1,%edx
+     df8:	eb be                	jmp    db8 <atoo+0x28>
+     dfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000e00 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	57                   	push   %edi
+     e04:	56                   	push   %esi
+     e05:	8b 45 10             	mov    0x10(%ebp),%eax
+     e08:	8b 55 08             	mov    0x8(%ebp),%edx
+     e0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     e0e:	85 c0                	test   %eax,%eax
+     e10:	7e 13                	jle    e25 <memmove+0x25>
+     e12:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     e14:	89 d7                	mov    %edx,%edi
+     e16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     e20:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     e21:	39 f8                	cmp    %edi,%eax
+     e23:	75 fb                	jne    e20 <memmove+0x20>
+  return vdst;
+}
+     e25:	5e                   	pop    %esi
+     e26:	89 d0                	mov    %edx,%eax
+     e28:	5f                   	pop    %edi
+     e29:	5d                   	pop    %ebp
+     e2a:	c3                   	ret
+
+00000e2b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     e2b:	b8 01 00 00 00       	mov    $0x1,%eax
+     e30:	cd 40                	int    $0x40
+     e32:	c3                   	ret
+
+00000e33 <exit>:
+SYSCALL(exit)
+     e33:	b8 02 00 00 00       	mov    $0x2,%eax
+     e38:	cd 40                	int    $0x40
+     e3a:	c3                   	ret
+
+00000e3b <wait>:
+SYSCALL(wait)
+     e3b:	b8 03 00 00 00       	mov    $0x3,%eax
+     e40:	cd 40                	int    $0x40
+     e42:	c3                   	ret
+
+00000e43 <pipe>:
+SYSCALL(pipe)
+     e43:	b8 04 00 00 00       	mov    $0x4,%eax
+     e48:	cd 40                	int    $0x40
+     e4a:	c3                   	ret
+
+00000e4b <read>:
+SYSCALL(read)
+     e4b:	b8 05 00 00 00       	mov    $0x5,%eax
+     e50:	cd 40                	int    $0x40
+     e52:	c3                   	ret
+
+00000e53 <write>:
+SYSCALL(write)
+     e53:	b8 10 00 00 00       	mov    $0x10,%eax
+     e58:	cd 40                	int    $0x40
+     e5a:	c3                   	ret
+
+00000e5b <close>:
+SYSCALL(close)
+     e5b:	b8 15 00 00 00       	mov    $0x15,%eax
+     e60:	cd 40                	int    $0x40
+     e62:	c3                   	ret
+
+00000e63 <kill>:
+SYSCALL(kill)
+     e63:	b8 06 00 00 00       	mov    $0x6,%eax
+     e68:	cd 40                	int    $0x40
+     e6a:	c3                   	ret
+
+00000e6b <exec>:
+SYSCALL(exec)
+     e6b:	b8 07 00 00 00       	mov    $0x7,%eax
+     e70:	cd 40                	int    $0x40
+     e72:	c3                   	ret
+
+00000e73 <open>:
+SYSCALL(open)
+     e73:	b8 0f 00 00 00       	mov    $0xf,%eax
+     e78:	cd 40                	int    $0x40
+     e7a:	c3                   	ret
+
+00000e7b <mknod>:
+SYSCALL(mknod)
+     e7b:	b8 11 00 00 00       	mov    $0x11,%eax
+     e80:	cd 40                	int    $0x40
+     e82:	c3                   	ret
+
+00000e83 <unlink>:
+SYSCALL(unlink)
+     e83:	b8 12 00 00 00       	mov    $0x12,%eax
+     e88:	cd 40                	int    $0x40
+     e8a:	c3                   	ret
+
+00000e8b <fstat>:
+SYSCALL(fstat)
+     e8b:	b8 08 00 00 00       	mov    $0x8,%eax
+     e90:	cd 40                	int    $0x40
+     e92:	c3                   	ret
+
+00000e93 <link>:
+SYSCALL(link)
+     e93:	b8 13 00 00 00       	mov    $0x13,%eax
+     e98:	cd 40                	int    $0x40
+     e9a:	c3                   	ret
+
+00000e9b <mkdir>:
+SYSCALL(mkdir)
+     e9b:	b8 14 00 00 00       	mov    $0x14,%eax
+     ea0:	cd 40                	int    $0x40
+     ea2:	c3                   	ret
+
+00000ea3 <chdir>:
+SYSCALL(chdir)
+     ea3:	b8 09 00 00 00       	mov    $0x9,%eax
+     ea8:	cd 40                	int    $0x40
+     eaa:	c3                   	ret
+
+00000eab <dup>:
+SYSCALL(dup)
+     eab:	b8 0a 00 00 00       	mov    $0xa,%eax
+     eb0:	cd 40                	int    $0x40
+     eb2:	c3                   	ret
+
+00000eb3 <getpid>:
+SYSCALL(getpid)
+     eb3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     eb8:	cd 40                	int    $0x40
+     eba:	c3                   	ret
+
+00000ebb <sbrk>:
+SYSCALL(sbrk)
+     ebb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ec0:	cd 40                	int    $0x40
+     ec2:	c3                   	ret
+
+00000ec3 <sleep>:
+SYSCALL(sleep)
+     ec3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ec8:	cd 40                	int    $0x40
+     eca:	c3                   	ret
+
+00000ecb <uptime>:
+SYSCALL(uptime)
+     ecb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ed0:	cd 40                	int    $0x40
+     ed2:	c3                   	ret
+
+00000ed3 <superpages>:
+SYSCALL(superpages)
+     ed3:	b8 23 00 00 00       	mov    $0x23,%eax
+     ed8:	cd 40                	int    $0x40
+     eda:	c3                   	ret
+
+00000edb <mmap>:
+SYSCALL(mmap)
+     edb:	b8 24 00 00 00       	mov    $0x24,%eax
+     ee0:	cd 40                	int    $0x40
+     ee2:	c3                   	ret
+
+00000ee3 <munmap>:
+SYSCALL(munmap)
+     ee3:	b8 25 00 00 00       	mov    $0x25,%eax
+     ee8:	cd 40                	int    $0x40
+     eea:	c3                   	ret
+
+00000eeb <spawn>:
+SYSCALL(spawn)
+     eeb:	b8 26 00 00 00       	mov    $0x26,%eax
+     ef0:	cd 40                	int    $0x40
+     ef2:	c3                   	ret
+
+00000ef3 <swapstat>:
+SYSCALL(swapstat)
+     ef3:	b8 27 00 00 00       	mov    $0x27,%eax
+     ef8:	cd 40                	int    $0x40
+     efa:	c3                   	ret
+
+00000efb <getmeminfo>:
+SYSCALL(getmeminfo)
+     efb:	b8 28 00 00 00       	mov    $0x28,%eax
+     f00:	cd 40                	int    $0x40
+     f02:	c3                   	ret
+
+00000f03 <iostat>:
+SYSCALL(iostat)
+     f03:	b8 29 00 00 00       	mov    $0x29,%eax
+     f08:	cd 40                	int    $0x40
+     f0a:	c3                   	ret
+
+00000f0b <dropcache>:
+SYSCALL(dropcache)
+     f0b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     f10:	cd 40                	int    $0x40
+     f12:	c3                   	ret
+
+00000f13 <iosched>:
+SYSCALL(iosched)
+     f13:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     f18:	cd 40                	int    $0x40
+     f1a:	c3                   	ret
+
+00000f1b <halt>:
+SYSCALL(halt)
+     f1b:	b8 16 00 00 00       	mov    $0x16,%eax
+     f20:	cd 40                	int    $0x40
+     f22:	c3                   	ret
+
+00000f23 <date>:
+SYSCALL(date)
+     f23:	b8 17 00 00 00       	mov    $0x17,%eax
+     f28:	cd 40                	int    $0x40
+     f2a:	c3                   	ret
+
+00000f2b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+     f2b:	b8 18 00 00 00       	mov    $0x18,%eax
+     f30:	cd 40                	int    $0x40
+     f32:	c3                   	ret
+
+00000f33 <getgid>:
+SYSCALL(getgid)
+     f33:	b8 19 00 00 00       	mov    $0x19,%eax
+     f38:	cd 40                	int    $0x40
+     f3a:	c3                   	ret
+
+00000f3b <getppid>:
+SYSCALL(getppid)
+     f3b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     f40:	cd 40                	int    $0x40
+     f42:	c3                   	ret
+
+00000f43 <setuid>:
+SYSCALL(setuid)
+     f43:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     f48:	cd 40                	int    $0x40
+     f4a:	c3                   	ret
+
+00000f4b <setgid>:
+SYSCALL(setgid)
+     f4b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     f50:	cd 40                	int    $0x40
+     f52:	c3                   	ret
+
+00000f53 <getprocs>:
+SYSCALL(getprocs)
+     f53:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f58:	cd 40                	int    $0x40
+     f5a:	c3                   	ret
+
+00000f5b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+     f5b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f60:	cd 40                	int    $0x40
+     f62:	c3                   	ret
+
+00000f63 <getpriority>:
+SYSCALL(getpriority)
+     f63:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f68:	cd 40                	int    $0x40
+     f6a:	c3                   	ret
+
+00000f6b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+     f6b:	b8 20 00 00 00       	mov    $0x20,%eax
+     f70:	cd 40                	int    $0x40
+     f72:	c3                   	ret
+
+00000f73 <chown>:
+SYSCALL(chown)
+     f73:	b8 21 00 00 00       	mov    $0x21,%eax
+     f78:	cd 40                	int    $0x40
+     f7a:	c3                   	ret
+
+00000f7b <chgrp>:
+SYSCALL(chgrp)
+     f7b:	b8 22 00 00 00       	mov    $0x22,%eax
+     f80:	cd 40                	int    $0x40
+     f82:	c3                   	ret
+     f83:	66 90                	xchg   %ax,%ax
+     f85:	66 90                	xchg   %ax,%ax
+     f87:	66 90                	xchg   %ax,%ax
+     f89:	66 90                	xchg   %ax,%ax
+     f8b:	66 90                	xchg   %ax,%ax
+     f8d:	66 90                	xchg   %ax,%ax
+     f8f:	90                   	nop
+
+00000f90 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	57                   	push   %edi
+     f94:	56                   	push   %esi
+     f95:	53                   	push   %ebx
+     f96:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     f98:	89 d1                	mov    %edx,%ecx
+{
+     f9a:	83 ec 3c             	sub    $0x3c,%esp
+     f9d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     fa0:	85 d2                	test   %edx,%edx
+     fa2:	0f 89 80 00 00 00    	jns    1028 <printint+0x98>
+     fa8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     fac:	74 7a                	je     1028 <printint+0x98>
+    x = -xx;
+     fae:	f7 d9                	neg    %ecx
+    neg = 1;
+     fb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     fb5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     fb8:	31 f6                	xor    %esi,%esi
+     fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     fc0:	89 c8                	mov    %ecx,%eax
+     fc2:	31 d2                	xor    %edx,%edx
+     fc4:	89 f7                	mov    %esi,%edi
+     fc6:	f7 f3                	div    %ebx
+     fc8:	8d 76 01             	lea    0x1(%esi),%esi
+     fcb:	0f b6 92 dc 1e 00 00 	movzbl 0x1edc(%edx),%edx
+     fd2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     fd6:	89 ca                	mov    %ecx,%edx
+     fd8:	89 c1                	mov    %eax,%ecx
+     fda:	39 da                	cmp    %ebx,%edx
+     fdc:	73 e2                	jae    fc0 <printint+0x30>
+  if(neg)
+     fde:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     fe1:	85 c0                	test   %eax,%eax
+     fe3:	74 07                	je     fec <printint+0x5c>
+    buf[i++] = '-';
+     fe5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     fea:	89 f7                	mov    %esi,%edi
+     fec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     fef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     ff2:	01 df                	add    %ebx,%edi
+     ff4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     ff8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     ffb:	83 ec 04             	sub    $0x4,%esp
+     ffe:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1001:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1004:	6a 01                	push   $0x1
+    1006:	50                   	push   %eax
+    1007:	56                   	push   %esi
+    1008:	e8 46 fe ff ff       	call   e53 <write>
+  while(--i >= 0)
+    100d:	89 f8                	mov    %edi,%eax
+    100f:	83 c4 10             	add    $0x10,%esp
+    1012:	83 ef 01             	sub    $0x1,%edi
+    1015:	39 d8                	cmp    %ebx,%eax
+    1017:	75 df                	jne    ff8 <printint+0x68>
+}
+    1019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    101c:	5b                   	pop    %ebx
+    101d:	5e                   	pop    %esi
+    101e:	5f                   	pop    %edi
+    101f:	5d                   	pop    %ebp
+    1020:	c3                   	ret
+    1021:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1028:	31 c0                	xor    %eax,%eax
+    102a:	eb 89                	jmp    fb5 <printint+0x25>
+    102c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001030 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	57                   	push   %edi
+    1034:	56                   	push   %esi
+    1035:	53                   	push   %ebx
+    1036:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1039:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    103c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    103f:	0f b6 1e             	movzbl (%esi),%ebx
+    1042:	83 c6 01             	add    $0x1,%esi
+    1045:	84 db                	test   %bl,%bl
+    1047:	74 67                	je     10b0 <printf+0x80>
+    1049:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    104c:	31 d2                	xor    %edx,%edx
+    104e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1051:	eb 34                	jmp    1087 <printf+0x57>
+    1053:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1057:	90                   	nop
+    1058:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    105b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1060:	83 f8 25             	cmp    $0x25,%eax
+    1063:	74 18                	je     107d <printf+0x4d>
+  write(fd, &c, 1);
+    1065:	83 ec 04             	sub    $0x4,%esp
+    1068:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    106b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    106e:	6a 01                	push   $0x1
+    1070:	50                   	push   %eax
+    1071:	57                   	push   %edi
+    1072:	e8 dc fd ff ff       	call   e53 <write>
+    1077:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    107a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    107d:	0f b6 1e             	movzbl (%esi),%ebx
+    1080:	83 c6 01             	add    $0x1,%esi
+    1083:	84 db                	test   %bl,%bl
+    1085:	74 29                	je     10b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1087:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    108a:	85 d2                	test   %edx,%edx
+    108c:	74 ca                	je     1058 <printf+0x28>
+      }
+    } else if(state == '%'){
+    108e:	83 fa 25             	cmp    $0x25,%edx
+    1091:	75 ea                	jne    107d <printf+0x4d>
+      if(c == 'd'){
+    1093:	83 f8 25             	cmp    $0x25,%eax
+    1096:	0f 84 24 01 00 00    	je     11c0 <printf+0x190>
+    109c:	83 e8 63             	sub    $0x63,%eax
+    109f:	83 f8 15             	cmp    $0x15,%eax
+    10a2:	77 1c                	ja     10c0 <printf+0x90>
+    10a4:	ff 24 85 84 1e 00 00 	jmp    *0x1e84(,%eax,4)
+    10ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    10b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10b3:	5b                   	pop    %ebx
+    10b4:	5e                   	pop    %esi
+    10b5:	5f                   	pop    %edi
+    10b6:	5d                   	pop    %ebp
+    10b7:	c3                   	ret
+    10b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+  write(fd, &c, 1);
+    10c0:	83 ec 04             	sub    $0x4,%esp
+    10c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    10c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    10ca:	6a 01                	push   $0x1
+    10cc:	52                   	push   %edx
+    10cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    10d0:	57                   	push   %edi
+    10d1:	e8 7d fd ff ff       	call   e53 <write>
+    10d6:	83 c4 0c             	add    $0xc,%esp
+    10d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    10dc:	6a 01                	push   $0x1
+    10de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    10e1:	52                   	push   %edx
+    10e2:	57                   	push   %edi
+    10e3:	e8 6b fd ff ff       	call   e53 <write>
+        putc(fd, c);
+    10e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    10eb:	31 d2                	xor    %edx,%edx
+    10ed:	eb 8e                	jmp    107d <printf+0x4d>
+    10ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    10f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    10f3:	83 ec 0c             	sub    $0xc,%esp
+    10f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    10fb:	8b 13                	mov    (%ebx),%edx
+    10fd:	6a 00                	push   $0x0
+    10ff:	89 f8                	mov    %edi,%eax
+        ap++;
+    1101:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1104:	e8 87 fe ff ff       	call   f90 <printint>
+        ap++;
+    1109:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    110c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    110f:	31 d2                	xor    %edx,%edx
+    1111:	e9 67 ff ff ff       	jmp    107d <printf+0x4d>
+    1116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1120:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1123:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1125:	83 c0 04             	add    $0x4,%eax
+    1128:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    112b:	85 db                	test   %ebx,%ebx
+    112d:	0f 84 9d 00 00 00    	je     11d0 <printf+0x1a0>
+        while(*s != 0){
+    1133:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1136:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1138:	84 c0                	test   %al,%al
+    113a:	0f 84 3d ff ff ff    	je     107d <printf+0x4d>
+    1140:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1143:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1146:	89 de                	mov    %ebx,%esi
+    1148:	89 d3                	mov    %edx,%ebx
+    114a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1150:	83 ec 04             	sub    $0x4,%esp
+    1153:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1156:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1159:	6a 01                	push   $0x1
+    115b:	53                   	push   %ebx
+    115c:	57                   	push   %edi
+    115d:	e8 f1 fc ff ff       	call   e53 <write>
+        while(*s != 0){
+    1162:	0f b6 06             	movzbl (%esi),%eax
+    1165:	83 c4 10             	add    $0x10,%esp
+    1168:	84 c0                	test   %al,%al
+    116a:	75 e4                	jne    1150 <printf+0x120>
+      state = 0;
+    116c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    116f:	31 d2                	xor    %edx,%edx
+    1171:	e9 07 ff ff ff       	jmp    107d <printf+0x4d>
+    1176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1180:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1183:	83 ec 0c             	sub    $0xc,%esp
+    1186:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    118b:	8b 13                	mov    (%ebx),%edx
+    118d:	6a 01                	push   $0x1
+    118f:	e9 6b ff ff ff       	jmp    10ff <printf+0xcf>
+    1194:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1198:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    119b:	83 ec 04             	sub    $0x4,%esp
+    119e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    11a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    11a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    11a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    11a9:	6a 01                	push   $0x1
+    11ab:	52                   	push   %edx
+    11ac:	57                   	push   %edi
+    11ad:	e8 a1 fc ff ff       	call   e53 <write>
+        ap++;
+    11b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    11b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11b8:	31 d2                	xor    %edx,%edx
+    11ba:	e9 be fe ff ff       	jmp    107d <printf+0x4d>
+    11bf:	90                   	nop
+  write(fd, &c, 1);
+    11c0:	83 ec 04             	sub    $0x4,%esp
+    11c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    11c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    11c9:	6a 01                	push   $0x1
+    11cb:	e9 11 ff ff ff       	jmp    10e1 <printf+0xb1>
+    11d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    11d5:	bb 7c 1e 00 00       	mov    $0x1e7c,%ebx
+    11da:	e9 61 ff ff ff       	jmp    1140 <printf+0x110>
+    11df:	90                   	nop
+
+000011e0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11e3:	a1 44 23 00 00       	mov    0x2344,%eax
+{
+    11e8:	89 e5                	mov    %esp,%ebp
+    11ea:	56                   	push   %esi
+    11eb:	53                   	push   %ebx
+    11ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11f0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11f2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11f4:	39 ca                	cmp    %ecx,%edx
+    11f6:	73 30                	jae    1228 <lfree+0x48>
+    11f8:	39 c1                	cmp    %eax,%ecx
+    11fa:	72 04                	jb     1200 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11fc:	39 c2                	cmp    %eax,%edx
+    11fe:	72 f0                	jb     11f0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1200:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1203:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1206:	39 f0                	cmp    %esi,%eax
+    1208:	74 26                	je     1230 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    120a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    120c:	8b 42 04             	mov    0x4(%edx),%eax
+    120f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    1212:	39 d9                	cmp    %ebx,%ecx
+    1214:	74 30                	je     1246 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1216:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1218:	5b                   	pop    %ebx
+  freep = p;
+    1219:	89 15 44 23 00 00    	mov    %edx,0x2344
+}
+    121f:	5e                   	pop    %esi
+    1220:	5d                   	pop    %ebp
+    1221:	c3                   	ret
+    1222:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1228:	39 c1                	cmp    %eax,%ecx
+    122a:	72 d0                	jb     11fc <lfree+0x1c>
+    122c:	eb c2                	jmp    11f0 <lfree+0x10>
+    122e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1230:	03 58 04             	add    0x4(%eax),%ebx
+    1233:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1236:	8b 02                	mov    (%edx),%eax
+    1238:	8b 00                	mov    (%eax),%eax
+    123a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+    123c:	8b 42 04             	mov    0x4(%edx),%eax
+    123f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    1242:	39 d9                	cmp    %ebx,%ecx
+    1244:	75 d0                	jne    1216 <lfree+0x36>
+    p->s.size += bp->s.size;
+    1246:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+    1249:	89 15 44 23 00 00    	mov    %edx,0x2344
+    p->s.size += bp->s.size;
+    124f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1252:	8b 09                	mov    (%ecx),%ecx
+    1254:	89 0a                	mov    %ecx,(%edx)
+}
+    1256:	5b                   	pop    %ebx
+    1257:	5e                   	pop    %esi
+    1258:	5d                   	pop    %ebp
+    1259:	c3                   	ret
+    125a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001260 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	89 c7                	mov    %eax,%edi
+    1266:	56                   	push   %esi
+    1267:	53                   	push   %ebx
+    1268:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    126b:	a1 44 23 00 00       	mov    0x2344,%eax
+    1270:	85 c0                	test   %eax,%eax
+    1272:	0f 84 88 00 00 00    	je     1300 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1278:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    127a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+    127d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1282:	39 df                	cmp    %ebx,%edi
+    1284:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1287:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+    128e:	39 f9                	cmp    %edi,%ecx
+    1290:	72 0f                	jb     12a1 <lalloc+0x41>
+    1292:	eb 4c                	jmp    12e0 <lalloc+0x80>
+    1294:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1298:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    129a:	8b 4a 04             	mov    0x4(%edx),%ecx
+    129d:	39 f9                	cmp    %edi,%ecx
+    129f:	73 3f                	jae    12e0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    12a1:	89 d0                	mov    %edx,%eax
+    12a3:	39 15 44 23 00 00    	cmp    %edx,0x2344
+    12a9:	75 ed                	jne    1298 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    12ab:	83 ec 0c             	sub    $0xc,%esp
+    12ae:	56                   	push   %esi
+    12af:	e8 07 fc ff ff       	call   ebb <sbrk>
+  if(p == (char*)-1)
+    12b4:	83 c4 10             	add    $0x10,%esp
+    12b7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12ba:	74 11                	je     12cd <lalloc+0x6d>
+  hp->s.size = nu;
+    12bc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+    12bf:	e8 1c ff ff ff       	call   11e0 <lfree>
+  return freep;
+    12c4:	a1 44 23 00 00       	mov    0x2344,%eax
+      if((p = morecore(nunits)) == 0)
+    12c9:	85 c0                	test   %eax,%eax
+    12cb:	75 cb                	jne    1298 <lalloc+0x38>
+        return 0;
+  }
+}
+    12cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    12d0:	31 d2                	xor    %edx,%edx
+}
+    12d2:	5b                   	pop    %ebx
+    12d3:	89 d0                	mov    %edx,%eax
+    12d5:	5e                   	pop    %esi
+    12d6:	5f                   	pop    %edi
+    12d7:	5d                   	pop    %ebp
+    12d8:	c3                   	ret
+    12d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+    12e0:	39 cf                	cmp    %ecx,%edi
+    12e2:	74 4c                	je     1330 <lalloc+0xd0>
+        p->s.size -= nunits;
+    12e4:	29 f9                	sub    %edi,%ecx
+    12e6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    12e9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    12ec:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    12ef:	a3 44 23 00 00       	mov    %eax,0x2344
+}
+    12f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12f7:	89 d0                	mov    %edx,%eax
+    12f9:	5b                   	pop    %ebx
+    12fa:	5e                   	pop    %esi
+    12fb:	5f                   	pop    %edi
+    12fc:	5d                   	pop    %ebp
+    12fd:	c3                   	ret
+    12fe:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+    1300:	ba 48 23 00 00       	mov    $0x2348,%edx
+    1305:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+    1307:	c7 05 44 23 00 00 48 	movl   $0x2348,0x2344
+    130e:	23 00 00 
+    1311:	c7 05 48 23 00 00 48 	movl   $0x2348,0x2348
+    1318:	23 00 00 
+    131b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+    131d:	c7 05 4c 23 00 00 00 	movl   $0x0,0x234c
+    1324:	00 00 00 
+    1327:	e9 51 ff ff ff       	jmp    127d <lalloc+0x1d>
+    132c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+    1330:	8b 0a                	mov    (%edx),%ecx
+    1332:	89 08                	mov    %ecx,(%eax)
+    1334:	eb b9                	jmp    12ef <lalloc+0x8f>
+    1336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001340 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	57                   	push   %edi
+    1344:	56                   	push   %esi
+    1345:	53                   	push   %ebx
+    1346:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+    1349:	85 f6                	test   %esi,%esi
+    134b:	74 42                	je     138f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+    134d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+    1350:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+    1353:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+    1359:	77 3d                	ja     1398 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+    135b:	31 c9                	xor    %ecx,%ecx
+    135d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1362:	83 fa 02             	cmp    $0x2,%edx
+    1365:	74 17                	je     137e <free+0x3e>
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+    1370:	83 c1 01             	add    $0x1,%ecx
+    1373:	89 d8                	mov    %ebx,%eax
+    1375:	d3 e0                	shl    %cl,%eax
+    1377:	83 c0 01             	add    $0x1,%eax
+    137a:	39 c2                	cmp    %eax,%edx
+    137c:	75 f2                	jne    1370 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+    137e:	8b 04 8d 20 23 00 00 	mov    0x2320(,%ecx,4),%eax
+  classes[c] = bp;
+    1385:	89 3c 8d 20 23 00 00 	mov    %edi,0x2320(,%ecx,4)
+  bp->s.ptr = classes[c];
+    138c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+    138f:	5b                   	pop    %ebx
+    1390:	5e                   	pop    %esi
+    1391:	5f                   	pop    %edi
+    1392:	5d                   	pop    %ebp
+    1393:	c3                   	ret
+    1394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1398:	5b                   	pop    %ebx
+    lfree(bp);
+    1399:	89 f8                	mov    %edi,%eax
+}
+    139b:	5e                   	pop    %esi
+    139c:	5f                   	pop    %edi
+    139d:	5d                   	pop    %ebp
+    lfree(bp);
+    139e:	e9 3d fe ff ff       	jmp    11e0 <lfree>
+    13a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000013b0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    13b0:	55                   	push   %ebp
+    13b1:	89 e5                	mov    %esp,%ebp
+    13b3:	57                   	push   %edi
+    13b4:	56                   	push   %esi
+    13b5:	53                   	push   %ebx
+    13b6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    13b9:	8b 45 08             	mov    0x8(%ebp),%eax
+    13bc:	83 c0 07             	add    $0x7,%eax
+    13bf:	c1 e8 03             	shr    $0x3,%eax
+    13c2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+    13c5:	3d 01 01 00 00       	cmp    $0x101,%eax
+    13ca:	77 44                	ja     1410 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+    13cc:	31 c9                	xor    %ecx,%ecx
+    13ce:	ba 01 00 00 00       	mov    $0x1,%edx
+    13d3:	bb 02 00 00 00       	mov    $0x2,%ebx
+    13d8:	83 f8 02             	cmp    $0x2,%eax
+    13db:	76 11                	jbe    13ee <malloc+0x3e>
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+    13e0:	83 c1 01             	add    $0x1,%ecx
+    13e3:	89 d3                	mov    %edx,%ebx
+    13e5:	d3 e3                	shl    %cl,%ebx
+    13e7:	83 c3 01             	add    $0x1,%ebx
+    13ea:	39 c3                	cmp    %eax,%ebx
+    13ec:	72 f2                	jb     13e0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+    13ee:	8b 04 8d 20 23 00 00 	mov    0x2320(,%ecx,4),%eax
+    13f5:	85 c0                	test   %eax,%eax
+    13f7:	74 2f                	je     1428 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+    13f9:	8b 10                	mov    (%eax),%edx
+    13fb:	89 14 8d 20 23 00 00 	mov    %edx,0x2320(,%ecx,4)
+  return (void*)(p + 1);
+    1402:	83 c0 08             	add    $0x8,%eax
+}
+    1405:	83 c4 1c             	add    $0x1c,%esp
+    1408:	5b                   	pop    %ebx
+    1409:	5e                   	pop    %esi
+    140a:	5f                   	pop    %edi
+    140b:	5d                   	pop    %ebp
+    140c:	c3                   	ret
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+    1410:	e8 4b fe ff ff       	call   1260 <lalloc>
+    1415:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+    1417:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+    141a:	85 d2                	test   %edx,%edx
+    141c:	75 e7                	jne    1405 <malloc+0x55>
+      return 0;
+    141e:	31 c0                	xor    %eax,%eax
+    1420:	eb e3                	jmp    1405 <malloc+0x55>
+    1422:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+    1428:	31 d2                	xor    %edx,%edx
+    142a:	b8 00 02 00 00       	mov    $0x200,%eax
+    142f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1432:	f7 f3                	div    %ebx
+  if(n < 4)
+    1434:	ba 04 00 00 00       	mov    $0x4,%edx
+    1439:	89 d6                	mov    %edx,%esi
+    143b:	39 d0                	cmp    %edx,%eax
+    143d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+    1440:	0f af f3             	imul   %ebx,%esi
+    1443:	89 f0                	mov    %esi,%eax
+    1445:	e8 16 fe ff ff       	call   1260 <lalloc>
+    144a:	85 c0                	test   %eax,%eax
+    144c:	74 d0                	je     141e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+    144e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1451:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+    1454:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    145b:	8b 14 8d 20 23 00 00 	mov    0x2320(,%ecx,4),%edx
+    1462:	39 f8                	cmp    %edi,%eax
+    1464:	73 22                	jae    1488 <malloc+0xd8>
+    1466:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1469:	eb 09                	jmp    1474 <malloc+0xc4>
+    146b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    146f:	90                   	nop
+    1470:	89 c2                	mov    %eax,%edx
+    1472:	89 c8                	mov    %ecx,%eax
+    1474:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+    1477:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+    147a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+    147c:	39 f9                	cmp    %edi,%ecx
+    147e:	72 f0                	jb     1470 <malloc+0xc0>
+    1480:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1483:	e9 73 ff ff ff       	jmp    13fb <malloc+0x4b>
+  classes[c] = p->s.ptr;
+    1488:	89 d0                	mov    %edx,%eax
+    148a:	8b 12                	mov    (%edx),%edx
+    148c:	e9 6a ff ff ff       	jmp    13fb <malloc+0x4b>
+    1491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    149f:	90                   	nop
+
+000014a0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+    14a0:	55                   	push   %ebp
+    14a1:	89 e5                	mov    %esp,%ebp
+    14a3:	56                   	push   %esi
+    14a4:	53                   	push   %ebx
+    14a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    14a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+    14ab:	85 c9                	test   %ecx,%ecx
+    14ad:	74 06                	je     14b5 <calloc+0x15>
+    14af:	89 c8                	mov    %ecx,%eax
+    14b1:	f7 e3                	mul    %ebx
+    14b3:	70 33                	jo     14e8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+    14b5:	0f af d9             	imul   %ecx,%ebx
+    14b8:	83 ec 0c             	sub    $0xc,%esp
+    14bb:	53                   	push   %ebx
+    14bc:	e8 ef fe ff ff       	call   13b0 <malloc>
+    14c1:	83 c4 10             	add    $0x10,%esp
+    14c4:	89 c6                	mov    %eax,%esi
+    14c6:	85 c0                	test   %eax,%eax
+    14c8:	74 1e                	je     14e8 <calloc+0x48>
+    memset(p, 0, n * size);
+    14ca:	83 ec 04             	sub    $0x4,%esp
+    14cd:	53                   	push   %ebx
+    14ce:	6a 00                	push   $0x0
+    14d0:	50                   	push   %eax
+    14d1:	e8 3a f7 ff ff       	call   c10 <memset>
+    14d6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    14d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14dc:	89 f0                	mov    %esi,%eax
+    14de:	5b                   	pop    %ebx
+    14df:	5e                   	pop    %esi
+    14e0:	5d                   	pop    %ebp
+    14e1:	c3                   	ret
+    14e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    14e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    14eb:	31 f6                	xor    %esi,%esi
+}
+    14ed:	89 f0                	mov    %esi,%eax
+    14ef:	5b                   	pop    %ebx
+    14f0:	5e                   	pop    %esi
+    14f1:	5d                   	pop    %ebp
+    14f2:	c3                   	ret
+    14f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001500 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+    1500:	55                   	push   %ebp
+    1501:	89 e5                	mov    %esp,%ebp
+    1503:	57                   	push   %edi
+    1504:	56                   	push   %esi
+    1505:	53                   	push   %ebx
+    1506:	83 ec 0c             	sub    $0xc,%esp
+    1509:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    150c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    150f:	85 db                	test   %ebx,%ebx
+    1511:	74 55                	je     1568 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    1513:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    1516:	89 de                	mov    %ebx,%esi
+    1518:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    151f:	39 c7                	cmp    %eax,%edi
+    1521:	72 0d                	jb     1530 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    1523:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1526:	89 f0                	mov    %esi,%eax
+    1528:	5b                   	pop    %ebx
+    1529:	5e                   	pop    %esi
+    152a:	5f                   	pop    %edi
+    152b:	5d                   	pop    %ebp
+    152c:	c3                   	ret
+    152d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    1530:	83 ec 0c             	sub    $0xc,%esp
+    1533:	50                   	push   %eax
+    1534:	e8 77 fe ff ff       	call   13b0 <malloc>
+    1539:	83 c4 10             	add    $0x10,%esp
+    153c:	89 c6                	mov    %eax,%esi
+    153e:	85 c0                	test   %eax,%eax
+    1540:	74 e1                	je     1523 <realloc+0x23>
+  memmove(p, ap, have);
+    1542:	83 ec 04             	sub    $0x4,%esp
+    1545:	57                   	push   %edi
+    1546:	53                   	push   %ebx
+    1547:	50                   	push   %eax
+    1548:	e8 b3 f8 ff ff       	call   e00 <memmove>
+  free(ap);
+    154d:	89 1c 24             	mov    %ebx,(%esp)
+    1550:	e8 eb fd ff ff       	call   1340 <free>
+  return p;
+    1555:	83 c4 10             	add    $0x10,%esp
+}
+    1558:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    155b:	89 f0                	mov    %esi,%eax
+    155d:	5b                   	pop    %ebx
+    155e:	5e                   	pop    %esi
+    155f:	5f                   	pop    %edi
+    1560:	5d                   	pop    %ebp
+    1561:	c3                   	ret
+    1562:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    1568:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    156b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    156e:	5b                   	pop    %ebx
+    156f:	5e                   	pop    %esi
+    1570:	5f                   	pop    %edi
+    1571:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    1572:	e9 39 fe ff ff       	jmp    13b0 <malloc>
@@ -1,20 +1,32 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC        64  // maximum number of processes per 64MB of memory
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define CACHELINE    64  // bytes per cache line
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NVMA          8  // demand-paged regions per process
+#define NPIN          4  // user ranges a system call can pin
+#define NTEXTPG     256  // cached program pages shared between processes
+#define NSHMPG      128  // pages of MAP_SHARED file mappings
+#define NSUPERPG      4  // 4MB pages set aside for user superpages
+#define NFORKPOOL     8  // kernel stacks and page directories kept ready for fork
+#define NFILE       100  // open files per system, per 64MB of memory
+#define NINODE       50  // maximum number of active i-nodes, per 64MB
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (MAXOPBLOCKS*3)  // initial size of disk block cache
+#define BCACHEPCT     5  // percent of memory the disk block cache may grow to
+#define RAMIN         4  // blocks to read ahead once a file is read sequentially
+#define RAMAX        64  // most blocks to read ahead
+#define IDEMAXMERGE  16  // most blocks per disk command; a power of 2, at most 16
 #ifdef PDX_XV6
-#define FSSIZE       2000  // size of file system in blocks
+#define FSSIZE       4000  // size of file system in blocks
 #else
 #define FSSIZE       1000  // size of file system in blocks
 #endif // PDX_XV6
+#define SWAPSIZE    65536  // blocks of swap space mkfs reserves after the file system
 
 #ifdef CS333_P2
 // DEFAULT_UID is the default value for both the first process and files
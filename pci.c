@@ -0,0 +1,127 @@
+// PCI configuration space access, through I/O ports 0xcf8
+// and 0xcfc ("configuration mechanism #1").  Only bus 0 is
+// searched, which is where QEMU puts its devices.
+//
+// A driver may also claim its device's interrupt line with
+// pciintr(); trap() passes interrupts that no one else handles
+// to pcitrap().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "pci.h"
+
+#define CONFADDR 0xcf8
+#define CONFDATA 0xcfc
+#define NIRQ     16
+
+static void (*handler[NIRQ])(void);
+
+static uint
+confaddr(struct pcidev *d, int off)
+{
+  return 0x80000000 | (d->bus << 16) | (d->dev << 11) | (d->func << 8) |
+         (off & 0xfc);
+}
+
+uint
+pciread(struct pcidev *d, int off)
+{
+  outl(CONFADDR, confaddr(d, off));
+  return inl(CONFDATA);
+}
+
+void
+pciwrite(struct pcidev *d, int off, uint v)
+{
+  outl(CONFADDR, confaddr(d, off));
+  outl(CONFDATA, v);
+}
+
+// Find the n'th device (counting from 0) whose class and
+// subclass, or vendor and device ID, are a and b, and fill in
+// d.  Returns 0, or -1 if there is none.
+static int
+find(int byid, uint a, uint b, int n, struct pcidev *d)
+{
+  uint id, c;
+  int i, nfn;
+
+  d->bus = 0;
+  for(d->dev = 0; d->dev < 32; d->dev++){
+    nfn = 1;
+    for(d->func = 0; d->func < nfn; d->func++){
+      id = pciread(d, PCI_ID);
+      if((id & 0xffff) == 0xffff)
+        continue;
+      if(d->func == 0 && (pciread(d, PCI_HDR) & PCI_MULTIFN))
+        nfn = 8;
+      c = pciread(d, PCI_CLASS);
+      if(byid && ((id & 0xffff) != a || (id >> 16) != b))
+        continue;
+      if(!byid && ((c >> 24) != a || ((c >> 16) & 0xff) != b))
+        continue;
+      if(n-- > 0)
+        continue;
+      d->vendor = id & 0xffff;
+      d->device = id >> 16;
+      d->class = c >> 24;
+      d->subclass = (c >> 16) & 0xff;
+      d->progif = (c >> 8) & 0xff;
+      d->irq = pciread(d, PCI_IRQ) & 0xff;
+      for(i = 0; i < 6; i++)
+        d->bar[i] = pciread(d, PCI_BAR0 + 4*i);
+      return 0;
+    }
+  }
+  return -1;
+}
+
+int
+pcifind(int class, int subclass, int n, struct pcidev *d)
+{
+  return find(0, class, subclass, n, d);
+}
+
+int
+pcifindid(int vendor, int device, int n, struct pcidev *d)
+{
+  return find(1, vendor, device, n, d);
+}
+
+// Let d decode I/O or memory accesses and act as bus master.
+void
+pcienable(struct pcidev *d, uint cmd)
+{
+  pciwrite(d, PCI_CMD, (pciread(d, PCI_CMD) & 0xffff) | cmd);
+}
+
+// Call fn on d's interrupts.  Returns -1 if d has no usable
+// interrupt line.
+int
+pciintr(struct pcidev *d, void (*fn)(void))
+{
+  if(d->irq == 0 || d->irq >= NIRQ)
+    return -1;
+  handler[d->irq] = fn;
+  ioapicenable(d->irq, ncpu - 1);
+  return 0;
+}
+
+// Handle interrupt trapno if a PCI driver claimed it.
+// Returns 1 if so.
+int
+pcitrap(int trapno)
+{
+  int irq;
+
+  irq = trapno - T_IRQ0;
+  if(irq < 0 || irq >= NIRQ || handler[irq] == 0)
+    return 0;
+  handler[irq]();
+  return 1;
+}
@@ -0,0 +1,29 @@
+// PCI configuration space.
+
+#define PCI_ID       0x00  // vendor, device
+#define PCI_CMD      0x04  // command, status
+#define PCI_CLASS    0x08  // revision, prog if, subclass, class
+#define PCI_HDR      0x0c  // header type in bits 16-23
+#define PCI_BAR0     0x10  // base address registers 0-5
+#define PCI_IRQ      0x3c  // interrupt line
+
+#define PCI_CMD_IO     0x1  // respond to I/O space accesses
+#define PCI_CMD_MEM    0x2  // respond to memory space accesses
+#define PCI_CMD_MASTER 0x4  // may act as bus master (DMA)
+
+#define PCI_MULTIFN  0x800000  // in PCI_HDR: device has functions 1-7
+
+#define PCI_STORAGE  0x01  // mass storage class
+#define PCI_IDE      0x01  //   subclasses
+#define PCI_SATA     0x06
+
+struct pcidev {
+  uint bus, dev, func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uchar progif;
+  uchar irq;
+  uint bar[6];
+};
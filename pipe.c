@@ -7,6 +7,7 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "meminfo.h"
 
 #define PIPESIZE 512
 
@@ -30,6 +31,7 @@ pipealloc(struct file **f0, struct file **f1)
     goto bad;
   if((p = (struct pipe*)kalloc()) == 0)
     goto bad;
+  ktag((char*)p, KM_PIPE);
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
@@ -7,6 +7,7 @@
 #include "proc.h"
 #include "spinlock.h"
 #include "uproc.h"
+#include "meminfo.h"
 
 static char *states[] = {
 [UNUSED]    "unused",
@@ -30,7 +31,7 @@ struct ptrs {
 
 static struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *proc;    // nproc entries
   #ifdef CS333_P3
   struct ptrs list[statecount];
   #endif
@@ -42,6 +43,16 @@ static struct {
 
 static struct proc *initproc;
 
+// Kernel stacks kept ready for allocproc(), so that fork need
+// not call kalloc.  Idle cpus refill the pool (see fillpools).
+static struct {
+  struct spinlock lock;
+  char *stack[NFORKPOOL];
+  int n;
+} kstackpool;
+
+static int nproc;     // size of ptable.proc
+
 uint nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
@@ -59,6 +70,9 @@ void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  initlock(&kstackpool.lock, "kstackpool");
+  nproc = kscaleboot(NPROC, sizeof(struct proc));
+  ptable.proc = ktable(nproc, sizeof(struct proc));
 }
 
 // Must be called with interrupts disabled
@@ -68,39 +82,80 @@ cpuid() {
 }
 
 // Must be called with interrupts disabled to avoid the caller being
-// rescheduled between reading lapicid and running through the loop.
+// rescheduled to another cpu and using the wrong struct cpu.
+// seginit() points %gs at this cpu's struct cpu.
 struct cpu*
 mycpu(void)
 {
-  int apicid, i;
+  struct cpu *c;
 
-  if(readeflags()&FL_IF)
-    panic("mycpu called with interrupts enabled\n");
-
-  apicid = lapicid();
-  // APIC IDs are not guaranteed to be contiguous. Maybe we should have
-  // a reverse map, or reserve a register to store &cpus[i].
-  for (i = 0; i < ncpu; ++i) {
-    if (cpus[i].apicid == apicid) {
-      return &cpus[i];
-    }
-  }
-  panic("unknown apicid\n");
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+  return c;
 }
 
-// Disable interrupts so that we are not rescheduled
-// while reading proc from the cpu structure
+// A single load from %gs cannot be split by a reschedule, and
+// whichever cpu runs the caller has it as its proc, so no
+// pushcli is needed.
 struct proc*
 myproc(void) {
-  struct cpu *c;
   struct proc *p;
-  pushcli();
-  c = mycpu();
-  p = c->proc;
-  popcli();
+
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
   return p;
 }
 
+static char*
+kstackalloc(void)
+{
+  char *s;
+
+  s = 0;
+  acquire(&kstackpool.lock);
+  if(kstackpool.n > 0)
+    s = kstackpool.stack[--kstackpool.n];
+  release(&kstackpool.lock);
+  if(s == 0 && (s = kallocsw()) != 0)
+    ktag(s, KM_KSTACK);
+  return s;
+}
+
+// Put kernel stack s in the pool, or free it if the pool is full.
+static void
+kstackfree(char *s)
+{
+  acquire(&kstackpool.lock);
+  if(kstackpool.n < NFORKPOOL){
+    kstackpool.stack[kstackpool.n++] = s;
+    s = 0;
+  }
+  release(&kstackpool.lock);
+  if(s)
+    kfree(s);
+}
+
+// Top up the kernel stack and page directory pools.  Called by
+// idle cpus, which may get here before the boot cpu has run
+// kinit2().  Returns the number of entries added.
+static int
+fillpools(void)
+{
+  char *s;
+  int n, full;
+
+  if(!kready())
+    return 0;
+  for(n = 0; ; n++){
+    acquire(&kstackpool.lock);
+    full = kstackpool.n >= NFORKPOOL;
+    release(&kstackpool.lock);
+    if(full || (s = kalloc()) == 0)
+      break;
+    ktag(s, KM_KSTACK);
+    kstackfree(s);
+  }
+  return n + fillpgdirs();
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -134,7 +189,7 @@ allocproc(void)
     p->pid = nextpid++;
     release(&ptable.lock);
   }
-  if((p->kstack = kalloc()) == 0){
+  if((p->kstack = kstackalloc()) == 0){
     acquire(&ptable.lock);
     int check = stateListRemove(&ptable.list[p->state], p);
     if(check == -1){
@@ -152,7 +207,7 @@ allocproc(void)
   #else
 
   int found = 0;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.proc; p < &ptable.proc[nproc]; p++)
     if(p->state == UNUSED) {
       found = 1;
       break;
@@ -167,7 +222,7 @@ allocproc(void)
 
 
   // Allocate kernel stack.
-  if((p->kstack = kalloc()) == 0){
+  if((p->kstack = kstackalloc()) == 0){
     p->state = UNUSED;
     return 0;
   }
@@ -189,6 +244,7 @@ allocproc(void)
   p->context->eip = (uint)forkret;
   
   p->start_ticks = ticks;
+  p->npin = 0;  // exit() never returned through syscall()
   
   #ifdef CS333_P2
   p->cpu_ticks_total = 0;
@@ -276,6 +332,8 @@ userinit(void)
 }
 
 // Grow current process's memory by n bytes.
+// Growth only reserves the address range; pages are filled
+// in on first touch by pgfault().
 // Return 0 on success, -1 on failure.
 int
 growproc(int n)
@@ -285,8 +343,11 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if(sz + n >= KERNBASE || sz + n < sz)
       return -1;
+    if(vmaoverlap(curproc, sz, sz + n))
+      return -1;  // would run into an mmap region
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -314,8 +375,8 @@ fork(void)
 
   // Copy process state from proc.
  #ifdef CS333_P3   
-   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
+   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz, curproc->vma)) == 0){
+    kstackfree(np->kstack);
     np->kstack = 0;
     acquire(&ptable.lock);
     int check = stateListRemove(&ptable.list[np->state], np);
@@ -330,8 +391,8 @@ fork(void)
   }
   
   #else
-   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
+   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz, curproc->vma)) == 0){
+    kstackfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
     return -1;
@@ -352,6 +413,8 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  dupvmas(np->vma, curproc->vma);
+  np->superpg = curproc->superpg;
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -387,6 +450,126 @@ fork(void)
   return pid;
 }
 
+// Create a new process running the program at path, without
+// copying the caller's memory as fork()+exec() would.  The child
+// gets descriptor i = the caller's descriptor fdmap[i] for each
+// i < nfd with fdmap[i] >= 0, and no others.
+// Returns the child's pid, or -1.
+int
+spawn(char *path, char **argv, int *fdmap, int nfd)
+{
+  int i;
+  uint pid;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  for(i = 0; i < nfd; i++)
+    if(fdmap[i] >= NOFILE || (fdmap[i] >= 0 && curproc->ofile[fdmap[i]] == 0))
+      return -1;
+
+  if((np = allocproc()) == 0){
+    return -1;
+  }
+  np->pgdir = 0;
+  np->sz = 0;
+  memset(np->vma, 0, sizeof(np->vma));
+  np->superpg = 0;
+  np->parent = curproc;
+  *np->tf = *curproc->tf;
+  #ifdef CS333_P2
+  np->uid = curproc->uid;
+  np->gid = curproc->gid;
+  #endif
+
+  if(loadimage(np, path, argv) < 0){
+    kstackfree(np->kstack);
+    np->kstack = 0;
+  #ifdef CS333_P3
+    acquire(&ptable.lock);
+    int check = stateListRemove(&ptable.list[np->state], np);
+    if(check == -1){
+      panic("stateListRemove failed!");
+    }
+    assertState(np, EMBRYO);
+    np->state = UNUSED;
+    stateListAdd(&ptable.list[np->state], np);
+    release(&ptable.lock);
+  #else
+    np->state = UNUSED;
+  #endif
+    return -1;
+  }
+
+  for(i = 0; i < nfd; i++)
+    if(fdmap[i] >= 0)
+      np->ofile[i] = filedup(curproc->ofile[fdmap[i]]);
+  np->cwd = idup(curproc->cwd);
+
+  pid = np->pid;
+  #ifdef CS333_P4
+  acquire(&ptable.lock);
+  int check = stateListRemove(&ptable.list[np->state], np);
+  if(check == -1){
+    panic("stateListRemove failed!");
+  }
+  assertState(np, EMBRYO);
+  np->state = RUNNABLE;
+  stateListAdd(&ptable.ready[np->priority], np);
+  release(&ptable.lock);
+
+  #elif defined(CS333_P3)
+  acquire(&ptable.lock);
+  int check = stateListRemove(&ptable.list[np->state], np);
+  if(check == -1){
+    panic("stateListRemove failed!");
+  }
+  assertState(np, EMBRYO);
+  np->state = RUNNABLE;
+  stateListAdd(&ptable.list[np->state], np);
+  release(&ptable.lock);
+
+  #else
+  acquire(&ptable.lock);
+  np->state = RUNNABLE;
+  release(&ptable.lock);
+  #endif
+
+  return pid;
+}
+
+// Pick a user page to swap out, scanning the processes' pages
+// clock-style: replace its PTE with a swap entry for slot and
+// return the page.  Pages of a process that is running on another
+// CPU are left alone, as are the pages a system call has pinned
+// (see uvmtouch), which it may use with a spinlock held.  Returns
+// 0 if nothing can be evicted.
+char*
+swapvictim(uint slot)
+{
+  static int hand;   // process the clock hand is on
+  static uint va;    // and the next address in it
+  struct proc *p;
+  char *mem;
+  int n;
+
+  acquire(&ptable.lock);
+  // Two trips round: the first may only clear accessed bits.
+  for(n = 0; n < 2*nproc + 1; n++){
+    p = &ptable.proc[hand];
+    if(p->pgdir && (p->state == RUNNABLE || p->state == SLEEPING ||
+                    (p->state == RUNNING && p == myproc()))){
+      if((mem = pgevict(p, &va, slot)) != 0){
+        release(&ptable.lock);
+        return mem;
+      }
+    }
+    hand = (hand + 1) % nproc;
+    va = 0;
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -409,8 +592,10 @@ exit(void)
     }
   }
 
+  syncvmas(curproc->pgdir, curproc->vma);
   begin_op();
   iput(curproc->cwd);
+  freevmas(curproc->vma);
   end_op();
   curproc->cwd = 0;
 
@@ -472,8 +657,10 @@ exit(void)
     }
   }
 
+  syncvmas(curproc->pgdir, curproc->vma);
   begin_op();
   iput(curproc->cwd);
+  freevmas(curproc->vma);
   end_op();
   curproc->cwd = 0;
 
@@ -526,8 +713,10 @@ exit(void)
     }
   }
 
+  syncvmas(curproc->pgdir, curproc->vma);
   begin_op();
   iput(curproc->cwd);
+  freevmas(curproc->vma);
   end_op();
   curproc->cwd = 0;
 
@@ -537,7 +726,7 @@ exit(void)
   wakeup1(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.proc; p < &ptable.proc[nproc]; p++){
     if(p->parent == curproc){
       p->parent = initproc;
       if(p->state == ZOMBIE){
@@ -579,7 +768,7 @@ wait(void)
         if(p->state == ZOMBIE){
           // Found one.
           pid = p->pid;
-          kfree(p->kstack);
+          kstackfree(p->kstack);
           p->kstack = 0;
           freevm(p->pgdir);
           p->pid = 0;
@@ -610,7 +799,7 @@ wait(void)
         if(p->state == ZOMBIE){
           // Found one.
           pid = p->pid;
-          kfree(p->kstack);
+          kstackfree(p->kstack);
           p->kstack = 0;
           freevm(p->pgdir);
           p->pid = 0;
@@ -665,7 +854,7 @@ wait(void)
         if(p->state == ZOMBIE){
           // Found one.
           pid = p->pid;
-          kfree(p->kstack);
+          kstackfree(p->kstack);
           p->kstack = 0;
           freevm(p->pgdir);
           p->pid = 0;
@@ -710,14 +899,14 @@ wait(void)
   for(;;){
     // Scan through table looking for exited children.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.proc; p < &ptable.proc[nproc]; p++){
       if(p->parent != curproc)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
+        kstackfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
         p->pid = 0;
@@ -845,8 +1034,9 @@ scheduler(void)
       release(&ptable.lock);
       
 #ifdef PDX_XV6
-    // if idle, wait for next interrupt
-    if (idle) {
+    // if idle, refill the fork pools, or if they are full,
+    // wait for next interrupt
+    if (idle && fillpools() == 0) {
       sti();
       hlt();
     }
@@ -904,8 +1094,9 @@ scheduler(void)
       release(&ptable.lock);
       
 #ifdef PDX_XV6
-    // if idle, wait for next interrupt
-    if (idle) {
+    // if idle, refill the fork pools, or if they are full,
+    // wait for next interrupt
+    if (idle && fillpools() == 0) {
       sti();
       hlt();
     }
@@ -934,7 +1125,7 @@ scheduler(void)
 #endif // PDX_XV6
     // Loop over process table looking for process to run.
     acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.proc; p < &ptable.proc[nproc]; p++){
       if(p->state != RUNNABLE)
         continue;
 
@@ -958,8 +1149,9 @@ scheduler(void)
     }
     release(&ptable.lock);
 #ifdef PDX_XV6
-    // if idle, wait for next interrupt
-    if (idle) {
+    // if idle, refill the fork pools, or if they are full,
+    // wait for next interrupt
+    if (idle && fillpools() == 0) {
       sti();
       hlt();
     }
@@ -1069,6 +1261,9 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    swapinit(ROOTDEV);
+    bootmark("fs");
+    bootreport();
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -1224,7 +1419,7 @@ wakeup1(void *chan)
 {
   struct proc *p;
   
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.proc; p < &ptable.proc[nproc]; p++)
     if(p->state == SLEEPING && p->chan == chan)
       p->state = RUNNABLE;
 }
@@ -1325,7 +1520,7 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.proc; p < &ptable.proc[nproc]; p++){
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
@@ -1355,7 +1550,7 @@ procdump(void)
   
  cprintf("\nPID\tName\tUID\tGID\tPPID\tPRIO\tElapsed\tCPU\tState\tSize\t PCs\n");
   
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.proc; p < &ptable.proc[nproc]; p++){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -1397,7 +1592,7 @@ procdump(void)
   
  cprintf("\nPID\tName\tUID\tGID\tPPID\tElapsed\tCPU\tState\tSize\t PCs\n");
   
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.proc; p < &ptable.proc[nproc]; p++){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -1440,7 +1635,7 @@ procdump(void)
   
   cprintf("\nPID\tName\t\tElapsed\t\tState\tSize\t PCs\n");
   
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.proc; p < &ptable.proc[nproc]; p++){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -1473,7 +1668,7 @@ getprocs(uint max, struct uproc* tab)
   int i = 0;
   struct proc *p;
   
-  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < max; p++){
+  for(p = ptable.proc; p < &ptable.proc[nproc] && i < max; p++){
       	  
     if(p->state == UNUSED || p->state == EMBRYO)
       continue;
@@ -1505,6 +1700,8 @@ getprocs(uint max, struct uproc* tab)
         safestrcpy(tab[i].state, "zombie", STRMAX);
       
       tab[i].size = p->sz;                               //Size
+      tab[i].rss = uvmrss(p->pgdir, p->sz) * PGSIZE;     //Resident
+      tab[i].ptpages = uvmptpages(p->pgdir);
     }
     i++;
   } 
@@ -1596,7 +1793,7 @@ initFreeList(void)
 {
   struct proc* p;
   
-  for(p = ptable.proc; p < ptable.proc + NPROC; ++p){
+  for(p = ptable.proc; p < ptable.proc + nproc; ++p){
     p->state = UNUSED;
     stateListAdd(&ptable.list[UNUSED], p);
   }
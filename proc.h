@@ -1,5 +1,10 @@
-// Per-CPU state
+// Per-CPU state.  The SEG_KCPU segment that %gs selects in the
+// kernel starts at self, so mycpu() is %gs:0 and myproc() is
+// %gs:4.  Each struct cpu takes whole cache lines, so CPUs do not
+// share a line when they update ncli and intena.
 struct cpu {
+  struct cpu *self;            // %gs:0; must be first
+  struct proc *proc;           // %gs:4; The process running on this cpu or null
   uchar apicid;                // Local APIC ID
   struct context *scheduler;   // swtch() here to enter scheduler
   struct taskstate ts;         // Used by x86 to find stack for interrupt
@@ -7,8 +12,7 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
-  struct proc *proc;           // The process running on this cpu or null
-};
+} __attribute__((aligned(CACHELINE)));
 
 extern struct cpu cpus[NCPU];
 extern int ncpu;
@@ -36,6 +40,21 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A region of user memory whose pages are filled in on first
+// touch (see pgfault in vm.c).  exec() creates one per ELF
+// segment, below sz; mmap() creates them above the heap.  A
+// file-backed region holds a reference to ip for as long as it
+// exists.
+struct vma {
+  uint start;                  // First address, page aligned
+  uint end;                    // One past the last address; 0 if slot unused
+  uint off;                    // File offset of start
+  uint filesz;                 // Bytes backed by the file; rest is zero
+  int perm;                    // PTE_W if writable, else 0
+  int flags;                   // MAP_* for mmap regions, 0 for exec's
+  struct inode *ip;            // Backing inode; 0 if anonymous
+};
+
 // Per-process state
 struct proc {
   #ifdef CS333_P3
@@ -56,6 +75,12 @@ struct proc {
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
+  struct vma vma[NVMA];        // Demand-paged regions
+  int superpg;                 // If non-zero, back aligned heap with superpages
+  struct {                     // User ranges pinned by uvmtouch() for
+    uint start, end;           //   the current system call
+  } pin[NPIN];
+  int npin;
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
   uint start_ticks;
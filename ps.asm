@@ -0,0 +1,1810 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#elif defined(CS333_P2)
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 24             	sub    $0x24,%esp
+  int max = 72;
+
+  struct uproc* tab = malloc(max * sizeof(struct uproc));
+  14:	68 40 1d 00 00       	push   $0x1d40
+  19:	e8 b2 09 00 00       	call   9d0 <malloc>
+  int tabSize = getprocs(max, tab);
+  1e:	5b                   	pop    %ebx
+  1f:	5f                   	pop    %edi
+  20:	50                   	push   %eax
+  struct uproc* tab = malloc(max * sizeof(struct uproc));
+  21:	89 c6                	mov    %eax,%esi
+  int tabSize = getprocs(max, tab);
+  23:	6a 48                	push   $0x48
+  25:	e8 49 05 00 00       	call   573 <getprocs>
+ 
+  if(tabSize == -1){
+  2a:	83 c4 10             	add    $0x10,%esp
+  int tabSize = getprocs(max, tab);
+  2d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(tabSize == -1){
+  30:	83 f8 ff             	cmp    $0xffffffff,%eax
+  33:	0f 84 22 01 00 00    	je     15b <main+0x15b>
+  int elap2;
+  int elap3;
+  int cpu1;
+  int cpu2;
+  int cpu3;
+  printf(1, "PID\tName\tUID\tGID\tPPID\tElapsed\tCPU\tState\tSize\tRSS\tPT\n");
+  39:	52                   	push   %edx
+  3a:	52                   	push   %edx
+  3b:	68 b4 0b 00 00       	push   $0xbb4
+  40:	6a 01                	push   $0x1
+  42:	e8 09 06 00 00       	call   650 <printf>
+  
+  for(int i = 0; i < tabSize; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  4e:	0f 8e f9 00 00 00    	jle    14d <main+0x14d>
+  54:	31 c0                	xor    %eax,%eax
+    elap1 = ((tab[i].elapsed_ticks)/100)%10;
+    elap2 = ((tab[i].elapsed_ticks)/10)%10;
+    elap3 = (tab[i].elapsed_ticks)%10;
+    cpu1  = ((tab[i].CPU_total_ticks)/100)%10;
+  56:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  59:	8d 5e 48             	lea    0x48(%esi),%ebx
+    cpu2  = ((tab[i].CPU_total_ticks)/10)%10;
+    cpu3  = (tab[i].CPU_total_ticks)%10;
+  5c:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+  for(int i = 0; i < tabSize; i++){
+  61:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    elap1 = ((tab[i].elapsed_ticks)/100)%10;
+  68:	8b 43 cc             	mov    -0x34(%ebx),%eax
+    cpu1  = ((tab[i].CPU_total_ticks)/100)%10;
+  6b:	8b 4b d0             	mov    -0x30(%ebx),%ecx
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+  6e:	83 ec 04             	sub    $0x4,%esp
+    elap1 = ((tab[i].elapsed_ticks)/100)%10;
+  71:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+  74:	8d 43 d4             	lea    -0x2c(%ebx),%eax
+  77:	ff 73 fc             	push   -0x4(%ebx)
+  7a:	ff 73 f8             	push   -0x8(%ebx)
+  7d:	ff 73 f4             	push   -0xc(%ebx)
+  80:	50                   	push   %eax
+    cpu3  = (tab[i].CPU_total_ticks)%10;
+  81:	89 c8                	mov    %ecx,%eax
+  83:	f7 e7                	mul    %edi
+  85:	89 d6                	mov    %edx,%esi
+  87:	89 ca                	mov    %ecx,%edx
+  89:	c1 ee 03             	shr    $0x3,%esi
+  8c:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+  8f:	01 c0                	add    %eax,%eax
+  91:	29 c2                	sub    %eax,%edx
+    cpu2  = ((tab[i].CPU_total_ticks)/10)%10;
+  93:	89 f0                	mov    %esi,%eax
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+  95:	52                   	push   %edx
+    cpu2  = ((tab[i].CPU_total_ticks)/10)%10;
+  96:	f7 e7                	mul    %edi
+  98:	c1 ea 03             	shr    $0x3,%edx
+  9b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  9e:	01 c0                	add    %eax,%eax
+  a0:	29 c6                	sub    %eax,%esi
+    cpu1  = ((tab[i].CPU_total_ticks)/100)%10;
+  a2:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  a7:	f7 e1                	mul    %ecx
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+  a9:	56                   	push   %esi
+    cpu1  = ((tab[i].CPU_total_ticks)/100)%10;
+  aa:	89 d6                	mov    %edx,%esi
+  ac:	c1 ee 05             	shr    $0x5,%esi
+  af:	89 f0                	mov    %esi,%eax
+  b1:	f7 e7                	mul    %edi
+  b3:	c1 ea 03             	shr    $0x3,%edx
+  b6:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  b9:	01 c0                	add    %eax,%eax
+  bb:	29 c6                	sub    %eax,%esi
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+  bd:	89 c8                	mov    %ecx,%eax
+  bf:	56                   	push   %esi
+  c0:	be d3 4d 62 10       	mov    $0x10624dd3,%esi
+  c5:	f7 e6                	mul    %esi
+  c7:	89 d1                	mov    %edx,%ecx
+  c9:	c1 e9 06             	shr    $0x6,%ecx
+  cc:	51                   	push   %ecx
+    elap3 = (tab[i].elapsed_ticks)%10;
+  cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  d0:	f7 e7                	mul    %edi
+  d2:	89 d1                	mov    %edx,%ecx
+  d4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  d7:	c1 e9 03             	shr    $0x3,%ecx
+  da:	8d 04 89             	lea    (%ecx,%ecx,4),%eax
+  dd:	01 c0                	add    %eax,%eax
+  df:	29 c2                	sub    %eax,%edx
+    elap2 = ((tab[i].elapsed_ticks)/10)%10;
+  e1:	89 c8                	mov    %ecx,%eax
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+  e3:	52                   	push   %edx
+    elap2 = ((tab[i].elapsed_ticks)/10)%10;
+  e4:	f7 e7                	mul    %edi
+  e6:	c1 ea 03             	shr    $0x3,%edx
+  e9:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  ec:	01 c0                	add    %eax,%eax
+  ee:	29 c1                	sub    %eax,%ecx
+    elap1 = ((tab[i].elapsed_ticks)/100)%10;
+  f0:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+  f5:	51                   	push   %ecx
+    elap1 = ((tab[i].elapsed_ticks)/100)%10;
+  f6:	f7 65 e4             	mull   -0x1c(%ebp)
+  f9:	89 d1                	mov    %edx,%ecx
+  fb:	c1 e9 05             	shr    $0x5,%ecx
+  fe:	89 c8                	mov    %ecx,%eax
+ 100:	f7 e7                	mul    %edi
+ 102:	c1 ea 03             	shr    $0x3,%edx
+ 105:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 108:	01 c0                	add    %eax,%eax
+ 10a:	29 c1                	sub    %eax,%ecx
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+ 10c:	51                   	push   %ecx
+ 10d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 110:	f7 e6                	mul    %esi
+ 112:	89 d6                	mov    %edx,%esi
+ 114:	c1 ee 06             	shr    $0x6,%esi
+ 117:	56                   	push   %esi
+ 118:	ff 73 c4             	push   -0x3c(%ebx)
+ 11b:	ff 73 c0             	push   -0x40(%ebx)
+ 11e:	ff 73 bc             	push   -0x44(%ebx)
+ 121:	53                   	push   %ebx
+  for(int i = 0; i < tabSize; i++){
+ 122:	83 c3 68             	add    $0x68,%ebx
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
+ 125:	ff b3 50 ff ff ff    	push   -0xb0(%ebx)
+ 12b:	68 ec 0b 00 00       	push   $0xbec
+ 130:	6a 01                	push   $0x1
+ 132:	e8 19 05 00 00       	call   650 <printf>
+  for(int i = 0; i < tabSize; i++){
+ 137:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 13b:	83 c4 50             	add    $0x50,%esp
+ 13e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 141:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+ 144:	0f 85 1e ff ff ff    	jne    68 <main+0x68>
+ 14a:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  }
+
+  free(tab);
+ 14d:	83 ec 0c             	sub    $0xc,%esp
+ 150:	56                   	push   %esi
+ 151:	e8 0a 08 00 00       	call   960 <free>
+  exit();
+ 156:	e8 f8 02 00 00       	call   453 <exit>
+    printf(1, "Table size error, exiting!\n");
+ 15b:	51                   	push   %ecx
+ 15c:	51                   	push   %ecx
+ 15d:	68 98 0b 00 00       	push   $0xb98
+ 162:	6a 01                	push   $0x1
+ 164:	e8 e7 04 00 00       	call   650 <printf>
+    exit();
+ 169:	e8 e5 02 00 00       	call   453 <exit>
+ 16e:	66 90                	xchg   %ax,%ax
+
+00000170 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 170:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 171:	31 c0                	xor    %eax,%eax
+{
+ 173:	89 e5                	mov    %esp,%ebp
+ 175:	53                   	push   %ebx
+ 176:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 179:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 180:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 184:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 187:	83 c0 01             	add    $0x1,%eax
+ 18a:	84 d2                	test   %dl,%dl
+ 18c:	75 f2                	jne    180 <strcpy+0x10>
+    ;
+  return os;
+}
+ 18e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 191:	89 c8                	mov    %ecx,%eax
+ 193:	c9                   	leave
+ 194:	c3                   	ret
+ 195:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	53                   	push   %ebx
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1aa:	0f b6 02             	movzbl (%edx),%eax
+ 1ad:	84 c0                	test   %al,%al
+ 1af:	75 17                	jne    1c8 <strcmp+0x28>
+ 1b1:	eb 3a                	jmp    1ed <strcmp+0x4d>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1bc:	83 c2 01             	add    $0x1,%edx
+ 1bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	74 1a                	je     1e0 <strcmp+0x40>
+    p++, q++;
+ 1c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1cb:	38 c3                	cmp    %al,%bl
+ 1cd:	74 e9                	je     1b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1cf:	29 d8                	sub    %ebx,%eax
+}
+ 1d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1d4:	c9                   	leave
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1e4:	31 c0                	xor    %eax,%eax
+ 1e6:	29 d8                	sub    %ebx,%eax
+}
+ 1e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1eb:	c9                   	leave
+ 1ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 1f0:	31 c0                	xor    %eax,%eax
+ 1f2:	eb db                	jmp    1cf <strcmp+0x2f>
+ 1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 206:	80 3a 00             	cmpb   $0x0,(%edx)
+ 209:	74 15                	je     220 <strlen+0x20>
+ 20b:	31 c0                	xor    %eax,%eax
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+ 210:	83 c0 01             	add    $0x1,%eax
+ 213:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 217:	89 c1                	mov    %eax,%ecx
+ 219:	75 f5                	jne    210 <strlen+0x10>
+    ;
+  return n;
+}
+ 21b:	89 c8                	mov    %ecx,%eax
+ 21d:	5d                   	pop    %ebp
+ 21e:	c3                   	ret
+ 21f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 220:	31 c9                	xor    %ecx,%ecx
+}
+ 222:	5d                   	pop    %ebp
+ 223:	89 c8                	mov    %ecx,%eax
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 237:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 23a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 23d:	89 d7                	mov    %edx,%edi
+ 23f:	fc                   	cld
+ 240:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 242:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 245:	89 d0                	mov    %edx,%eax
+ 247:	c9                   	leave
+ 248:	c3                   	ret
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 25a:	0f b6 10             	movzbl (%eax),%edx
+ 25d:	84 d2                	test   %dl,%dl
+ 25f:	75 12                	jne    273 <strchr+0x23>
+ 261:	eb 1d                	jmp    280 <strchr+0x30>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 26c:	83 c0 01             	add    $0x1,%eax
+ 26f:	84 d2                	test   %dl,%dl
+ 271:	74 0d                	je     280 <strchr+0x30>
+    if(*s == c)
+ 273:	38 d1                	cmp    %dl,%cl
+ 275:	75 f1                	jne    268 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 277:	5d                   	pop    %ebp
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 280:	31 c0                	xor    %eax,%eax
+}
+ 282:	5d                   	pop    %ebp
+ 283:	c3                   	ret
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 295:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 298:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 299:	31 db                	xor    %ebx,%ebx
+{
+ 29b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 29e:	eb 27                	jmp    2c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2a0:	83 ec 04             	sub    $0x4,%esp
+ 2a3:	6a 01                	push   $0x1
+ 2a5:	56                   	push   %esi
+ 2a6:	6a 00                	push   $0x0
+ 2a8:	e8 be 01 00 00       	call   46b <read>
+    if(cc < 1)
+ 2ad:	83 c4 10             	add    $0x10,%esp
+ 2b0:	85 c0                	test   %eax,%eax
+ 2b2:	7e 1d                	jle    2d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2bf:	3c 0a                	cmp    $0xa,%al
+ 2c1:	74 10                	je     2d3 <gets+0x43>
+ 2c3:	3c 0d                	cmp    $0xd,%al
+ 2c5:	74 0c                	je     2d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2c7:	89 df                	mov    %ebx,%edi
+ 2c9:	83 c3 01             	add    $0x1,%ebx
+ 2cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2cf:	7c cf                	jl     2a0 <gets+0x10>
+ 2d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2dd:	5b                   	pop    %ebx
+ 2de:	5e                   	pop    %esi
+ 2df:	5f                   	pop    %edi
+ 2e0:	5d                   	pop    %ebp
+ 2e1:	c3                   	ret
+ 2e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	56                   	push   %esi
+ 2f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2f5:	83 ec 08             	sub    $0x8,%esp
+ 2f8:	6a 00                	push   $0x0
+ 2fa:	ff 75 08             	push   0x8(%ebp)
+ 2fd:	e8 91 01 00 00       	call   493 <open>
+  if(fd < 0)
+ 302:	83 c4 10             	add    $0x10,%esp
+ 305:	85 c0                	test   %eax,%eax
+ 307:	78 27                	js     330 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 309:	83 ec 08             	sub    $0x8,%esp
+ 30c:	ff 75 0c             	push   0xc(%ebp)
+ 30f:	89 c3                	mov    %eax,%ebx
+ 311:	50                   	push   %eax
+ 312:	e8 94 01 00 00       	call   4ab <fstat>
+  close(fd);
+ 317:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 31a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 31c:	e8 5a 01 00 00       	call   47b <close>
+  return r;
+ 321:	83 c4 10             	add    $0x10,%esp
+}
+ 324:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 327:	89 f0                	mov    %esi,%eax
+ 329:	5b                   	pop    %ebx
+ 32a:	5e                   	pop    %esi
+ 32b:	5d                   	pop    %ebp
+ 32c:	c3                   	ret
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 330:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 335:	eb ed                	jmp    324 <stat+0x34>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+ 345:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 348:	0f b6 02             	movzbl (%edx),%eax
+ 34b:	3c 20                	cmp    $0x20,%al
+ 34d:	75 0c                	jne    35b <atoi+0x1b>
+ 34f:	90                   	nop
+ 350:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 354:	83 c2 01             	add    $0x1,%edx
+ 357:	3c 20                	cmp    $0x20,%al
+ 359:	74 f5                	je     350 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 35b:	3c 2d                	cmp    $0x2d,%al
+ 35d:	74 41                	je     3a0 <atoi+0x60>
+ 35f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 364:	3c 2b                	cmp    $0x2b,%al
+ 366:	74 3d                	je     3a5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 368:	0f be 0a             	movsbl (%edx),%ecx
+ 36b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 36e:	3c 09                	cmp    $0x9,%al
+ 370:	b8 00 00 00 00       	mov    $0x0,%eax
+ 375:	77 21                	ja     398 <atoi+0x58>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 380:	83 c2 01             	add    $0x1,%edx
+ 383:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 386:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 38a:	0f be 0a             	movsbl (%edx),%ecx
+ 38d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 390:	80 fb 09             	cmp    $0x9,%bl
+ 393:	76 eb                	jbe    380 <atoi+0x40>
+  return sign*n;
+ 395:	0f af c6             	imul   %esi,%eax
+}
+ 398:	5b                   	pop    %ebx
+ 399:	5e                   	pop    %esi
+ 39a:	5d                   	pop    %ebp
+ 39b:	c3                   	ret
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 3a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 3a5:	83 c2 01             	add    $0x1,%edx
+ 3a8:	eb be                	jmp    368 <atoi+0x28>
+ 3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003b0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+ 3b4:	53                   	push   %ebx
+ 3b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 3b8:	0f b6 02             	movzbl (%edx),%eax
+ 3bb:	3c 20                	cmp    $0x20,%al
+ 3bd:	75 0c                	jne    3cb <atoo+0x1b>
+ 3bf:	90                   	nop
+ 3c0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 3c4:	83 c2 01             	add    $0x1,%edx
+ 3c7:	3c 20                	cmp    $0x20,%al
+ 3c9:	74 f5                	je     3c0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 3cb:	3c 2d                	cmp    $0x2d,%al
+ 3cd:	74 41                	je     410 <atoo+0x60>
+ 3cf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 3d4:	3c 2b                	cmp    $0x2b,%al
+ 3d6:	74 3d                	je     415 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 3d8:	0f be 0a             	movsbl (%edx),%ecx
+ 3db:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 3de:	3c 07                	cmp    $0x7,%al
+ 3e0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3e5:	77 1e                	ja     405 <atoo+0x55>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 3f0:	83 c2 01             	add    $0x1,%edx
+ 3f3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 3f7:	0f be 0a             	movsbl (%edx),%ecx
+ 3fa:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 3fd:	80 fb 07             	cmp    $0x7,%bl
+ 400:	76 ee                	jbe    3f0 <atoo+0x40>
+  return sign*n;
+ 402:	0f af c6             	imul   %esi,%eax
+}
+ 405:	5b                   	pop    %ebx
+ 406:	5e                   	pop    %esi
+ 407:	5d                   	pop    %ebp
+ 408:	c3                   	ret
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 415:	83 c2 01             	add    $0x1,%edx
+ 418:	eb be                	jmp    3d8 <atoo+0x28>
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+ 425:	8b 45 10             	mov    0x10(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 42e:	85 c0                	test   %eax,%eax
+ 430:	7e 13                	jle    445 <memmove+0x25>
+ 432:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 434:	89 d7                	mov    %edx,%edi
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 440:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 441:	39 f8                	cmp    %edi,%eax
+ 443:	75 fb                	jne    440 <memmove+0x20>
+  return vdst;
+}
+ 445:	5e                   	pop    %esi
+ 446:	89 d0                	mov    %edx,%eax
+ 448:	5f                   	pop    %edi
+ 449:	5d                   	pop    %ebp
+ 44a:	c3                   	ret
+
+0000044b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 44b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <exit>:
+SYSCALL(exit)
+ 453:	b8 02 00 00 00       	mov    $0x2,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <wait>:
+SYSCALL(wait)
+ 45b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <pipe>:
+SYSCALL(pipe)
+ 463:	b8 04 00 00 00       	mov    $0x4,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <read>:
+SYSCALL(read)
+ 46b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <write>:
+SYSCALL(write)
+ 473:	b8 10 00 00 00       	mov    $0x10,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <close>:
+SYSCALL(close)
+ 47b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <kill>:
+SYSCALL(kill)
+ 483:	b8 06 00 00 00       	mov    $0x6,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <exec>:
+SYSCALL(exec)
+ 48b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <open>:
+SYSCALL(open)
+ 493:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mknod>:
+SYSCALL(mknod)
+ 49b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <unlink>:
+SYSCALL(unlink)
+ 4a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <fstat>:
+SYSCALL(fstat)
+ 4ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <link>:
+SYSCALL(link)
+ 4b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mkdir>:
+SYSCALL(mkdir)
+ 4bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <chdir>:
+SYSCALL(chdir)
+ 4c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <dup>:
+SYSCALL(dup)
+ 4cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <getpid>:
+SYSCALL(getpid)
+ 4d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <sbrk>:
+SYSCALL(sbrk)
+ 4db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <sleep>:
+SYSCALL(sleep)
+ 4e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <uptime>:
+SYSCALL(uptime)
+ 4eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <superpages>:
+SYSCALL(superpages)
+ 4f3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mmap>:
+SYSCALL(mmap)
+ 4fb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <munmap>:
+SYSCALL(munmap)
+ 503:	b8 25 00 00 00       	mov    $0x25,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <spawn>:
+SYSCALL(spawn)
+ 50b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <swapstat>:
+SYSCALL(swapstat)
+ 513:	b8 27 00 00 00       	mov    $0x27,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 51b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <iostat>:
+SYSCALL(iostat)
+ 523:	b8 29 00 00 00       	mov    $0x29,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <dropcache>:
+SYSCALL(dropcache)
+ 52b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <iosched>:
+SYSCALL(iosched)
+ 533:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <halt>:
+SYSCALL(halt)
+ 53b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <date>:
+SYSCALL(date)
+ 543:	b8 17 00 00 00       	mov    $0x17,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 54b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <getgid>:
+SYSCALL(getgid)
+ 553:	b8 19 00 00 00       	mov    $0x19,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <getppid>:
+SYSCALL(getppid)
+ 55b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <setuid>:
+SYSCALL(setuid)
+ 563:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <setgid>:
+SYSCALL(setgid)
+ 56b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <getprocs>:
+SYSCALL(getprocs)
+ 573:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 57b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getpriority>:
+SYSCALL(getpriority)
+ 583:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 58b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <chown>:
+SYSCALL(chown)
+ 593:	b8 21 00 00 00       	mov    $0x21,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <chgrp>:
+SYSCALL(chgrp)
+ 59b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+ 5a3:	66 90                	xchg   %ax,%ax
+ 5a5:	66 90                	xchg   %ax,%ax
+ 5a7:	66 90                	xchg   %ax,%ax
+ 5a9:	66 90                	xchg   %ax,%ax
+ 5ab:	66 90                	xchg   %ax,%ax
+ 5ad:	66 90                	xchg   %ax,%ax
+ 5af:	90                   	nop
+
+000005b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5b8:	89 d1                	mov    %edx,%ecx
+{
+ 5ba:	83 ec 3c             	sub    $0x3c,%esp
+ 5bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5c0:	85 d2                	test   %edx,%edx
+ 5c2:	0f 89 80 00 00 00    	jns    648 <printint+0x98>
+ 5c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5cc:	74 7a                	je     648 <printint+0x98>
+    x = -xx;
+ 5ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5d8:	31 f6                	xor    %esi,%esi
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5e0:	89 c8                	mov    %ecx,%eax
+ 5e2:	31 d2                	xor    %edx,%edx
+ 5e4:	89 f7                	mov    %esi,%edi
+ 5e6:	f7 f3                	div    %ebx
+ 5e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5eb:	0f b6 92 7c 0c 00 00 	movzbl 0xc7c(%edx),%edx
+ 5f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5f6:	89 ca                	mov    %ecx,%edx
+ 5f8:	89 c1                	mov    %eax,%ecx
+ 5fa:	39 da                	cmp    %ebx,%edx
+ 5fc:	73 e2                	jae    5e0 <printint+0x30>
+  if(neg)
+ 5fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 601:	85 c0                	test   %eax,%eax
+ 603:	74 07                	je     60c <printint+0x5c>
+    buf[i++] = '-';
+ 605:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 60a:	89 f7                	mov    %esi,%edi
+ 60c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 60f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 612:	01 df                	add    %ebx,%edi
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 618:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 621:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 624:	6a 01                	push   $0x1
+ 626:	50                   	push   %eax
+ 627:	56                   	push   %esi
+ 628:	e8 46 fe ff ff       	call   473 <write>
+  while(--i >= 0)
+ 62d:	89 f8                	mov    %edi,%eax
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	83 ef 01             	sub    $0x1,%edi
+ 635:	39 d8                	cmp    %ebx,%eax
+ 637:	75 df                	jne    618 <printint+0x68>
+}
+ 639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63c:	5b                   	pop    %ebx
+ 63d:	5e                   	pop    %esi
+ 63e:	5f                   	pop    %edi
+ 63f:	5d                   	pop    %ebp
+ 640:	c3                   	ret
+ 641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 648:	31 c0                	xor    %eax,%eax
+ 64a:	eb 89                	jmp    5d5 <printint+0x25>
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 659:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 65c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 65f:	0f b6 1e             	movzbl (%esi),%ebx
+ 662:	83 c6 01             	add    $0x1,%esi
+ 665:	84 db                	test   %bl,%bl
+ 667:	74 67                	je     6d0 <printf+0x80>
+ 669:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 66c:	31 d2                	xor    %edx,%edx
+ 66e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 671:	eb 34                	jmp    6a7 <printf+0x57>
+ 673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 677:	90                   	nop
+ 678:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 67b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 680:	83 f8 25             	cmp    $0x25,%eax
+ 683:	74 18                	je     69d <printf+0x4d>
+  write(fd, &c, 1);
+ 685:	83 ec 04             	sub    $0x4,%esp
+ 688:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 68b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68e:	6a 01                	push   $0x1
+ 690:	50                   	push   %eax
+ 691:	57                   	push   %edi
+ 692:	e8 dc fd ff ff       	call   473 <write>
+ 697:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 69a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 69d:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a0:	83 c6 01             	add    $0x1,%esi
+ 6a3:	84 db                	test   %bl,%bl
+ 6a5:	74 29                	je     6d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6aa:	85 d2                	test   %edx,%edx
+ 6ac:	74 ca                	je     678 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ae:	83 fa 25             	cmp    $0x25,%edx
+ 6b1:	75 ea                	jne    69d <printf+0x4d>
+      if(c == 'd'){
+ 6b3:	83 f8 25             	cmp    $0x25,%eax
+ 6b6:	0f 84 24 01 00 00    	je     7e0 <printf+0x190>
+ 6bc:	83 e8 63             	sub    $0x63,%eax
+ 6bf:	83 f8 15             	cmp    $0x15,%eax
+ 6c2:	77 1c                	ja     6e0 <printf+0x90>
+ 6c4:	ff 24 85 24 0c 00 00 	jmp    *0xc24(,%eax,4)
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d3:	5b                   	pop    %ebx
+ 6d4:	5e                   	pop    %esi
+ 6d5:	5f                   	pop    %edi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ea:	6a 01                	push   $0x1
+ 6ec:	52                   	push   %edx
+ 6ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6f0:	57                   	push   %edi
+ 6f1:	e8 7d fd ff ff       	call   473 <write>
+ 6f6:	83 c4 0c             	add    $0xc,%esp
+ 6f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fc:	6a 01                	push   $0x1
+ 6fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 701:	52                   	push   %edx
+ 702:	57                   	push   %edi
+ 703:	e8 6b fd ff ff       	call   473 <write>
+        putc(fd, c);
+ 708:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70b:	31 d2                	xor    %edx,%edx
+ 70d:	eb 8e                	jmp    69d <printf+0x4d>
+ 70f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 00                	push   $0x0
+ 71f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 721:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 724:	e8 87 fe ff ff       	call   5b0 <printint>
+        ap++;
+ 729:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 72c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 67 ff ff ff       	jmp    69d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 740:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 743:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 745:	83 c0 04             	add    $0x4,%eax
+ 748:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 74b:	85 db                	test   %ebx,%ebx
+ 74d:	0f 84 9d 00 00 00    	je     7f0 <printf+0x1a0>
+        while(*s != 0){
+ 753:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 756:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 758:	84 c0                	test   %al,%al
+ 75a:	0f 84 3d ff ff ff    	je     69d <printf+0x4d>
+ 760:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 763:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 766:	89 de                	mov    %ebx,%esi
+ 768:	89 d3                	mov    %edx,%ebx
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 776:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	53                   	push   %ebx
+ 77c:	57                   	push   %edi
+ 77d:	e8 f1 fc ff ff       	call   473 <write>
+        while(*s != 0){
+ 782:	0f b6 06             	movzbl (%esi),%eax
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	84 c0                	test   %al,%al
+ 78a:	75 e4                	jne    770 <printf+0x120>
+      state = 0;
+ 78c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 07 ff ff ff       	jmp    69d <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 01                	push   $0x1
+ 7af:	e9 6b ff ff ff       	jmp    71f <printf+0xcf>
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	52                   	push   %edx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 a1 fc ff ff       	call   473 <write>
+        ap++;
+ 7d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7d8:	31 d2                	xor    %edx,%edx
+ 7da:	e9 be fe ff ff       	jmp    69d <printf+0x4d>
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	e9 11 ff ff ff       	jmp    701 <printf+0xb1>
+ 7f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7f5:	bb 1c 0c 00 00       	mov    $0xc1c,%ebx
+ 7fa:	e9 61 ff ff ff       	jmp    760 <printf+0x110>
+ 7ff:	90                   	nop
+
+00000800 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 803:	a1 64 10 00 00       	mov    0x1064,%eax
+{
+ 808:	89 e5                	mov    %esp,%ebp
+ 80a:	56                   	push   %esi
+ 80b:	53                   	push   %ebx
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 810:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 812:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 814:	39 ca                	cmp    %ecx,%edx
+ 816:	73 30                	jae    848 <lfree+0x48>
+ 818:	39 c1                	cmp    %eax,%ecx
+ 81a:	72 04                	jb     820 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 81c:	39 c2                	cmp    %eax,%edx
+ 81e:	72 f0                	jb     810 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 820:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 823:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 826:	39 f0                	cmp    %esi,%eax
+ 828:	74 26                	je     850 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 82a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 82c:	8b 42 04             	mov    0x4(%edx),%eax
+ 82f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 832:	39 d9                	cmp    %ebx,%ecx
+ 834:	74 30                	je     866 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 836:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 838:	5b                   	pop    %ebx
+  freep = p;
+ 839:	89 15 64 10 00 00    	mov    %edx,0x1064
+}
+ 83f:	5e                   	pop    %esi
+ 840:	5d                   	pop    %ebp
+ 841:	c3                   	ret
+ 842:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 848:	39 c1                	cmp    %eax,%ecx
+ 84a:	72 d0                	jb     81c <lfree+0x1c>
+ 84c:	eb c2                	jmp    810 <lfree+0x10>
+ 84e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 850:	03 58 04             	add    0x4(%eax),%ebx
+ 853:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 856:	8b 02                	mov    (%edx),%eax
+ 858:	8b 00                	mov    (%eax),%eax
+ 85a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 85c:	8b 42 04             	mov    0x4(%edx),%eax
+ 85f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 862:	39 d9                	cmp    %ebx,%ecx
+ 864:	75 d0                	jne    836 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 866:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 869:	89 15 64 10 00 00    	mov    %edx,0x1064
+    p->s.size += bp->s.size;
+ 86f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 872:	8b 09                	mov    (%ecx),%ecx
+ 874:	89 0a                	mov    %ecx,(%edx)
+}
+ 876:	5b                   	pop    %ebx
+ 877:	5e                   	pop    %esi
+ 878:	5d                   	pop    %ebp
+ 879:	c3                   	ret
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000880 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	89 c7                	mov    %eax,%edi
+ 886:	56                   	push   %esi
+ 887:	53                   	push   %ebx
+ 888:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 88b:	a1 64 10 00 00       	mov    0x1064,%eax
+ 890:	85 c0                	test   %eax,%eax
+ 892:	0f 84 88 00 00 00    	je     920 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 898:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 89a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 89d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8a2:	39 df                	cmp    %ebx,%edi
+ 8a4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8a7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 8ae:	39 f9                	cmp    %edi,%ecx
+ 8b0:	72 0f                	jb     8c1 <lalloc+0x41>
+ 8b2:	eb 4c                	jmp    900 <lalloc+0x80>
+ 8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 8ba:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 8bd:	39 f9                	cmp    %edi,%ecx
+ 8bf:	73 3f                	jae    900 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 8c1:	89 d0                	mov    %edx,%eax
+ 8c3:	39 15 64 10 00 00    	cmp    %edx,0x1064
+ 8c9:	75 ed                	jne    8b8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 8cb:	83 ec 0c             	sub    $0xc,%esp
+ 8ce:	56                   	push   %esi
+ 8cf:	e8 07 fc ff ff       	call   4db <sbrk>
+  if(p == (char*)-1)
+ 8d4:	83 c4 10             	add    $0x10,%esp
+ 8d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8da:	74 11                	je     8ed <lalloc+0x6d>
+  hp->s.size = nu;
+ 8dc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 8df:	e8 1c ff ff ff       	call   800 <lfree>
+  return freep;
+ 8e4:	a1 64 10 00 00       	mov    0x1064,%eax
+      if((p = morecore(nunits)) == 0)
+ 8e9:	85 c0                	test   %eax,%eax
+ 8eb:	75 cb                	jne    8b8 <lalloc+0x38>
+        return 0;
+  }
+}
+ 8ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8f0:	31 d2                	xor    %edx,%edx
+}
+ 8f2:	5b                   	pop    %ebx
+ 8f3:	89 d0                	mov    %edx,%eax
+ 8f5:	5e                   	pop    %esi
+ 8f6:	5f                   	pop    %edi
+ 8f7:	5d                   	pop    %ebp
+ 8f8:	c3                   	ret
+ 8f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 900:	39 cf                	cmp    %ecx,%edi
+ 902:	74 4c                	je     950 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 904:	29 f9                	sub    %edi,%ecx
+ 906:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 909:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 90c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 90f:	a3 64 10 00 00       	mov    %eax,0x1064
+}
+ 914:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 917:	89 d0                	mov    %edx,%eax
+ 919:	5b                   	pop    %ebx
+ 91a:	5e                   	pop    %esi
+ 91b:	5f                   	pop    %edi
+ 91c:	5d                   	pop    %ebp
+ 91d:	c3                   	ret
+ 91e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 920:	ba 68 10 00 00       	mov    $0x1068,%edx
+ 925:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 927:	c7 05 64 10 00 00 68 	movl   $0x1068,0x1064
+ 92e:	10 00 00 
+ 931:	c7 05 68 10 00 00 68 	movl   $0x1068,0x1068
+ 938:	10 00 00 
+ 93b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 93d:	c7 05 6c 10 00 00 00 	movl   $0x0,0x106c
+ 944:	00 00 00 
+ 947:	e9 51 ff ff ff       	jmp    89d <lalloc+0x1d>
+ 94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 950:	8b 0a                	mov    (%edx),%ecx
+ 952:	89 08                	mov    %ecx,(%eax)
+ 954:	eb b9                	jmp    90f <lalloc+0x8f>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000960 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 969:	85 f6                	test   %esi,%esi
+ 96b:	74 42                	je     9af <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 96d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 970:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 973:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 979:	77 3d                	ja     9b8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 97b:	31 c9                	xor    %ecx,%ecx
+ 97d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 982:	83 fa 02             	cmp    $0x2,%edx
+ 985:	74 17                	je     99e <free+0x3e>
+ 987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98e:	66 90                	xchg   %ax,%ax
+ 990:	83 c1 01             	add    $0x1,%ecx
+ 993:	89 d8                	mov    %ebx,%eax
+ 995:	d3 e0                	shl    %cl,%eax
+ 997:	83 c0 01             	add    $0x1,%eax
+ 99a:	39 c2                	cmp    %eax,%edx
+ 99c:	75 f2                	jne    990 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 99e:	8b 04 8d 40 10 00 00 	mov    0x1040(,%ecx,4),%eax
+  classes[c] = bp;
+ 9a5:	89 3c 8d 40 10 00 00 	mov    %edi,0x1040(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 9ac:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 9af:	5b                   	pop    %ebx
+ 9b0:	5e                   	pop    %esi
+ 9b1:	5f                   	pop    %edi
+ 9b2:	5d                   	pop    %ebp
+ 9b3:	c3                   	ret
+ 9b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9b8:	5b                   	pop    %ebx
+    lfree(bp);
+ 9b9:	89 f8                	mov    %edi,%eax
+}
+ 9bb:	5e                   	pop    %esi
+ 9bc:	5f                   	pop    %edi
+ 9bd:	5d                   	pop    %ebp
+    lfree(bp);
+ 9be:	e9 3d fe ff ff       	jmp    800 <lfree>
+ 9c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009d0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+ 9d6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9dc:	83 c0 07             	add    $0x7,%eax
+ 9df:	c1 e8 03             	shr    $0x3,%eax
+ 9e2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 9e5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 9ea:	77 44                	ja     a30 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 9ec:	31 c9                	xor    %ecx,%ecx
+ 9ee:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9f3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 9f8:	83 f8 02             	cmp    $0x2,%eax
+ 9fb:	76 11                	jbe    a0e <malloc+0x3e>
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+ a00:	83 c1 01             	add    $0x1,%ecx
+ a03:	89 d3                	mov    %edx,%ebx
+ a05:	d3 e3                	shl    %cl,%ebx
+ a07:	83 c3 01             	add    $0x1,%ebx
+ a0a:	39 c3                	cmp    %eax,%ebx
+ a0c:	72 f2                	jb     a00 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ a0e:	8b 04 8d 40 10 00 00 	mov    0x1040(,%ecx,4),%eax
+ a15:	85 c0                	test   %eax,%eax
+ a17:	74 2f                	je     a48 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ a19:	8b 10                	mov    (%eax),%edx
+ a1b:	89 14 8d 40 10 00 00 	mov    %edx,0x1040(,%ecx,4)
+  return (void*)(p + 1);
+ a22:	83 c0 08             	add    $0x8,%eax
+}
+ a25:	83 c4 1c             	add    $0x1c,%esp
+ a28:	5b                   	pop    %ebx
+ a29:	5e                   	pop    %esi
+ a2a:	5f                   	pop    %edi
+ a2b:	5d                   	pop    %ebp
+ a2c:	c3                   	ret
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ a30:	e8 4b fe ff ff       	call   880 <lalloc>
+ a35:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ a37:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ a3a:	85 d2                	test   %edx,%edx
+ a3c:	75 e7                	jne    a25 <malloc+0x55>
+      return 0;
+ a3e:	31 c0                	xor    %eax,%eax
+ a40:	eb e3                	jmp    a25 <malloc+0x55>
+ a42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ a48:	31 d2                	xor    %edx,%edx
+ a4a:	b8 00 02 00 00       	mov    $0x200,%eax
+ a4f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a52:	f7 f3                	div    %ebx
+  if(n < 4)
+ a54:	ba 04 00 00 00       	mov    $0x4,%edx
+ a59:	89 d6                	mov    %edx,%esi
+ a5b:	39 d0                	cmp    %edx,%eax
+ a5d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ a60:	0f af f3             	imul   %ebx,%esi
+ a63:	89 f0                	mov    %esi,%eax
+ a65:	e8 16 fe ff ff       	call   880 <lalloc>
+ a6a:	85 c0                	test   %eax,%eax
+ a6c:	74 d0                	je     a3e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ a6e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a71:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ a74:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a7b:	8b 14 8d 40 10 00 00 	mov    0x1040(,%ecx,4),%edx
+ a82:	39 f8                	cmp    %edi,%eax
+ a84:	73 22                	jae    aa8 <malloc+0xd8>
+ a86:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a89:	eb 09                	jmp    a94 <malloc+0xc4>
+ a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+ a90:	89 c2                	mov    %eax,%edx
+ a92:	89 c8                	mov    %ecx,%eax
+ a94:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ a97:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ a9a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ a9c:	39 f9                	cmp    %edi,%ecx
+ a9e:	72 f0                	jb     a90 <malloc+0xc0>
+ aa0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ aa3:	e9 73 ff ff ff       	jmp    a1b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ aa8:	89 d0                	mov    %edx,%eax
+ aaa:	8b 12                	mov    (%edx),%edx
+ aac:	e9 6a ff ff ff       	jmp    a1b <malloc+0x4b>
+ ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+
+00000ac0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	56                   	push   %esi
+ ac4:	53                   	push   %ebx
+ ac5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ ac8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ acb:	85 c9                	test   %ecx,%ecx
+ acd:	74 06                	je     ad5 <calloc+0x15>
+ acf:	89 c8                	mov    %ecx,%eax
+ ad1:	f7 e3                	mul    %ebx
+ ad3:	70 33                	jo     b08 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ ad5:	0f af d9             	imul   %ecx,%ebx
+ ad8:	83 ec 0c             	sub    $0xc,%esp
+ adb:	53                   	push   %ebx
+ adc:	e8 ef fe ff ff       	call   9d0 <malloc>
+ ae1:	83 c4 10             	add    $0x10,%esp
+ ae4:	89 c6                	mov    %eax,%esi
+ ae6:	85 c0                	test   %eax,%eax
+ ae8:	74 1e                	je     b08 <calloc+0x48>
+    memset(p, 0, n * size);
+ aea:	83 ec 04             	sub    $0x4,%esp
+ aed:	53                   	push   %ebx
+ aee:	6a 00                	push   $0x0
+ af0:	50                   	push   %eax
+ af1:	e8 3a f7 ff ff       	call   230 <memset>
+ af6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ af9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ afc:	89 f0                	mov    %esi,%eax
+ afe:	5b                   	pop    %ebx
+ aff:	5e                   	pop    %esi
+ b00:	5d                   	pop    %ebp
+ b01:	c3                   	ret
+ b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ b0b:	31 f6                	xor    %esi,%esi
+}
+ b0d:	89 f0                	mov    %esi,%eax
+ b0f:	5b                   	pop    %ebx
+ b10:	5e                   	pop    %esi
+ b11:	5d                   	pop    %ebp
+ b12:	c3                   	ret
+ b13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b20 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	57                   	push   %edi
+ b24:	56                   	push   %esi
+ b25:	53                   	push   %ebx
+ b26:	83 ec 0c             	sub    $0xc,%esp
+ b29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ b2f:	85 db                	test   %ebx,%ebx
+ b31:	74 55                	je     b88 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ b33:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ b36:	89 de                	mov    %ebx,%esi
+ b38:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ b3f:	39 c7                	cmp    %eax,%edi
+ b41:	72 0d                	jb     b50 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ b43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b46:	89 f0                	mov    %esi,%eax
+ b48:	5b                   	pop    %ebx
+ b49:	5e                   	pop    %esi
+ b4a:	5f                   	pop    %edi
+ b4b:	5d                   	pop    %ebp
+ b4c:	c3                   	ret
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ b50:	83 ec 0c             	sub    $0xc,%esp
+ b53:	50                   	push   %eax
+ b54:	e8 77 fe ff ff       	call   9d0 <malloc>
+ b59:	83 c4 10             	add    $0x10,%esp
+ b5c:	89 c6                	mov    %eax,%esi
+ b5e:	85 c0                	test   %eax,%eax
+ b60:	74 e1                	je     b43 <realloc+0x23>
+  memmove(p, ap, have);
+ b62:	83 ec 04             	sub    $0x4,%esp
+ b65:	57                   	push   %edi
+ b66:	53                   	push   %ebx
+ b67:	50                   	push   %eax
+ b68:	e8 b3 f8 ff ff       	call   420 <memmove>
+  free(ap);
+ b6d:	89 1c 24             	mov    %ebx,(%esp)
+ b70:	e8 eb fd ff ff       	call   960 <free>
+  return p;
+ b75:	83 c4 10             	add    $0x10,%esp
+}
+ b78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b7b:	89 f0                	mov    %esi,%eax
+ b7d:	5b                   	pop    %ebx
+ b7e:	5e                   	pop    %esi
+ b7f:	5f                   	pop    %edi
+ b80:	5d                   	pop    %ebp
+ b81:	c3                   	ret
+ b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b88:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b8e:	5b                   	pop    %ebx
+ b8f:	5e                   	pop    %esi
+ b90:	5f                   	pop    %edi
+ b91:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b92:	e9 39 fe ff ff       	jmp    9d0 <malloc>
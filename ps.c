@@ -22,7 +22,7 @@ main(int argc, char *argv[])
   int cpu1;
   int cpu2;
   int cpu3;
-  printf(1, "PID\tName\tUID\tGID\tPPID\tPRIO\tElapsed\tCPU\tState\tSize\n");
+  printf(1, "PID\tName\tUID\tGID\tPPID\tPRIO\tElapsed\tCPU\tState\tSize\tRSS\tPT\n");
   
   for(int i = 0; i < tabSize; i++){
     elap1 = ((tab[i].elapsed_ticks)/100)%10;
@@ -31,7 +31,7 @@ main(int argc, char *argv[])
     cpu1  = ((tab[i].CPU_total_ticks)/100)%10;
     cpu2  = ((tab[i].CPU_total_ticks)/10)%10;
     cpu3  = (tab[i].CPU_total_ticks)%10;
-    printf(1, "%d\t%s\t%d\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, tab[i].priority, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size);
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, tab[i].priority, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
   }
 
   free(tab);
@@ -60,7 +60,7 @@ main(int argc, char *argv[])
   int cpu1;
   int cpu2;
   int cpu3;
-  printf(1, "PID\tName\tUID\tGID\tPPID\tElapsed\tCPU\tState\tSize\n");
+  printf(1, "PID\tName\tUID\tGID\tPPID\tElapsed\tCPU\tState\tSize\tRSS\tPT\n");
   
   for(int i = 0; i < tabSize; i++){
     elap1 = ((tab[i].elapsed_ticks)/100)%10;
@@ -69,7 +69,7 @@ main(int argc, char *argv[])
     cpu1  = ((tab[i].CPU_total_ticks)/100)%10;
     cpu2  = ((tab[i].CPU_total_ticks)/10)%10;
     cpu3  = (tab[i].CPU_total_ticks)%10;
-    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size);
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d.%d%d%d\t%d.%d%d%d\t%s\t%d\t%d\t%d\n", tab[i].pid, tab[i].name, tab[i].uid, tab[i].gid, tab[i].ppid, (tab[i].elapsed_ticks)/1000, elap1, elap2, elap3, (tab[i].CPU_total_ticks)/1000, cpu1, cpu2, cpu3,tab[i].state, tab[i].size, tab[i].rss, tab[i].ptpages);
   }
 
   free(tab);
@@ -0,0 +1,120 @@
+// Measure random-read throughput.  NREADER processes (the
+// argument overrides) each fault in NREAD pages picked at random
+// from the files in /, through mmap, after the buffer cache is
+// dropped.  Each fault is a synchronous read of one page, so
+// the disk sees up to NREADER requests at a time.  Compare
+// drivers by running it under make qemu, qemu-virtio and
+// qemu-ahci.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "mman.h"
+#include "iostat.h"
+
+#define NREADER 8
+#define MAXR    16
+#define NREAD   100
+#define PGSIZE  4096
+#define MAXF    64
+
+struct {
+  char name[DIRSIZ+2];
+  int npage;
+} files[MAXF];
+int nfiles;
+uint seed;
+
+static uint
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static void
+findfiles(void)
+{
+  struct dirent de;
+  struct stat st;
+  int dfd;
+
+  dfd = open("/", O_RDONLY);
+  while(nfiles < MAXF && read(dfd, &de, sizeof(de)) == sizeof(de)){
+    if(de.inum == 0)
+      continue;
+    files[nfiles].name[0] = '/';
+    memmove(files[nfiles].name + 1, de.name, DIRSIZ);
+    files[nfiles].name[DIRSIZ+1] = 0;
+    if(stat(files[nfiles].name, &st) == 0 && st.type == T_FILE &&
+       st.size >= PGSIZE){
+      files[nfiles].npage = st.size / PGSIZE;
+      nfiles++;
+    }
+  }
+  close(dfd);
+}
+
+static void
+reader(int id)
+{
+  char *p;
+  int i, f, fd;
+  volatile char c;
+
+  seed = id * 7919 + 1;
+  for(i = 0; i < NREAD; i++){
+    f = rand() % nfiles;
+    if((fd = open(files[f].name, O_RDONLY)) < 0)
+      continue;
+    p = mmap(0, PGSIZE, PROT_READ, MAP_PRIVATE, fd,
+             (rand() % files[f].npage) * PGSIZE);
+    if(p != MAP_FAILED){
+      c = *p;
+      munmap(p, PGSIZE);
+    }
+    close(fd);
+  }
+  (void)c;
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat a, b;
+  int i, n, t;
+  uint kb, r;
+
+  n = argc > 1 ? atoi(argv[1]) : NREADER;
+  if(n < 1 || n > MAXR)
+    n = NREADER;
+  findfiles();
+  if(nfiles == 0){
+    printf(2, "randbench: no files\n");
+    exit();
+  }
+
+  dropcache();
+  iostat(&a);
+  t = uptime();
+  for(i = 0; i < n; i++)
+    if(fork() == 0)
+      reader(i);
+  for(i = 0; i < n; i++)
+    wait();
+  t = uptime() - t;
+  iostat(&b);
+  if(t == 0)
+    t = 1;
+
+  kb = (b.diskblocks - a.diskblocks) * BSIZE / 1024;
+  printf(1, "%d readers, %d pages each: %d ms, %d KB from disk, %d KB/s\n",
+         n, NREAD, t, kb, kb * 1000 / t);
+  r = b.nread - a.nread;
+  printf(1, "%d disk requests, %d Kcycles avg read latency\n",
+         b.diskreqs - a.diskreqs, r ? (b.readlat - a.readlat) / r : 0);
+  exit();
+}
@@ -0,0 +1,1843 @@
+
+_scanbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         b.diskreqs - a.diskreqs);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	bb a3 0c 00 00       	mov    $0xca3,%ebx
+   9:	83 e4 f0             	and    $0xfffffff0,%esp
+  char *dir;
+
+  dir = argc > 1 ? argv[1] : "/";
+   c:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  10:	7e 06                	jle    18 <main+0x18>
+  12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  15:	8b 58 04             	mov    0x4(%eax),%ebx
+  pass("first pass", dir);
+  18:	89 da                	mov    %ebx,%edx
+  1a:	b8 a5 0c 00 00       	mov    $0xca5,%eax
+  1f:	e8 1c 00 00 00       	call   40 <pass>
+  pass("second pass", dir);
+  24:	89 da                	mov    %ebx,%edx
+  26:	b8 b0 0c 00 00       	mov    $0xcb0,%eax
+  2b:	e8 10 00 00 00       	call   40 <pass>
+  exit();
+  30:	e8 0e 05 00 00       	call   543 <exit>
+  35:	66 90                	xchg   %ax,%ax
+  37:	66 90                	xchg   %ax,%ax
+  39:	66 90                	xchg   %ax,%ax
+  3b:	66 90                	xchg   %ax,%ax
+  3d:	66 90                	xchg   %ax,%ax
+  3f:	90                   	nop
+
+00000040 <pass>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	57                   	push   %edi
+  44:	56                   	push   %esi
+  45:	53                   	push   %ebx
+  46:	89 d3                	mov    %edx,%ebx
+  48:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  4e:	89 85 f8 fe ff ff    	mov    %eax,-0x108(%ebp)
+  iostat(&a);
+  54:	8d 85 40 ff ff ff    	lea    -0xc0(%ebp),%eax
+  5a:	50                   	push   %eax
+  5b:	e8 b3 05 00 00       	call   613 <iostat>
+  t = uptime();
+  60:	e8 76 05 00 00       	call   5db <uptime>
+  65:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+  if((dfd = open(dir, O_RDONLY)) < 0){
+  6b:	5e                   	pop    %esi
+  6c:	5f                   	pop    %edi
+  6d:	6a 00                	push   $0x0
+  6f:	53                   	push   %ebx
+  70:	e8 0e 05 00 00       	call   583 <open>
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	85 c0                	test   %eax,%eax
+  7a:	0f 88 c5 01 00 00    	js     245 <pass+0x205>
+  tot = 0;
+  80:	c7 85 04 ff ff ff 00 	movl   $0x0,-0xfc(%ebp)
+  87:	00 00 00 
+  8a:	89 c6                	mov    %eax,%esi
+  8c:	8d bd 14 ff ff ff    	lea    -0xec(%ebp),%edi
+  92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  while(read(dfd, &de, sizeof(de)) == sizeof(de)){
+  98:	83 ec 04             	sub    $0x4,%esp
+  9b:	6a 10                	push   $0x10
+  9d:	57                   	push   %edi
+  9e:	56                   	push   %esi
+  9f:	e8 b7 04 00 00       	call   55b <read>
+  a4:	83 c4 10             	add    $0x10,%esp
+  a7:	83 f8 10             	cmp    $0x10,%eax
+  aa:	0f 85 c0 00 00 00    	jne    170 <pass+0x130>
+    if(de.inum == 0 || strlen(dir) + 1 + DIRSIZ + 1 > sizeof(path))
+  b0:	66 83 bd 14 ff ff ff 	cmpw   $0x0,-0xec(%ebp)
+  b7:	00 
+  b8:	74 de                	je     98 <pass+0x58>
+  ba:	83 ec 0c             	sub    $0xc,%esp
+  bd:	53                   	push   %ebx
+  be:	e8 2d 02 00 00       	call   2f0 <strlen>
+  c3:	83 c4 10             	add    $0x10,%esp
+  c6:	83 c0 10             	add    $0x10,%eax
+  c9:	83 f8 40             	cmp    $0x40,%eax
+  cc:	77 ca                	ja     98 <pass+0x58>
+    strcpy(path, dir);
+  ce:	83 ec 08             	sub    $0x8,%esp
+  d1:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  d4:	53                   	push   %ebx
+  d5:	50                   	push   %eax
+  d6:	e8 85 01 00 00       	call   260 <strcpy>
+    path[strlen(dir)] = '/';
+  db:	89 1c 24             	mov    %ebx,(%esp)
+  de:	e8 0d 02 00 00       	call   2f0 <strlen>
+  e3:	c6 44 05 94 2f       	movb   $0x2f,-0x6c(%ebp,%eax,1)
+    memmove(path + strlen(dir) + 1, de.name, DIRSIZ);
+  e8:	89 1c 24             	mov    %ebx,(%esp)
+  eb:	e8 00 02 00 00       	call   2f0 <strlen>
+  f0:	83 c4 0c             	add    $0xc,%esp
+  f3:	8d 8d 16 ff ff ff    	lea    -0xea(%ebp),%ecx
+  f9:	8d 44 05 95          	lea    -0x6b(%ebp,%eax,1),%eax
+  fd:	6a 0e                	push   $0xe
+  ff:	51                   	push   %ecx
+ 100:	50                   	push   %eax
+ 101:	e8 0a 04 00 00       	call   510 <memmove>
+    path[strlen(dir) + 1 + DIRSIZ] = 0;
+ 106:	89 1c 24             	mov    %ebx,(%esp)
+ 109:	e8 e2 01 00 00       	call   2f0 <strlen>
+ 10e:	c6 44 05 a3 00       	movb   $0x0,-0x5d(%ebp,%eax,1)
+    if((fd = open(path, O_RDONLY)) < 0)
+ 113:	58                   	pop    %eax
+ 114:	8d 45 94             	lea    -0x6c(%ebp),%eax
+ 117:	5a                   	pop    %edx
+ 118:	6a 00                	push   $0x0
+ 11a:	50                   	push   %eax
+ 11b:	e8 63 04 00 00       	call   583 <open>
+ 120:	83 c4 10             	add    $0x10,%esp
+ 123:	89 c2                	mov    %eax,%edx
+ 125:	85 c0                	test   %eax,%eax
+ 127:	0f 88 6b ff ff ff    	js     98 <pass+0x58>
+    if(fstat(fd, &st) == 0 && st.type == T_FILE)
+ 12d:	83 ec 08             	sub    $0x8,%esp
+ 130:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+ 136:	50                   	push   %eax
+ 137:	52                   	push   %edx
+ 138:	89 95 00 ff ff ff    	mov    %edx,-0x100(%ebp)
+ 13e:	e8 58 04 00 00       	call   59b <fstat>
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	8b 95 00 ff ff ff    	mov    -0x100(%ebp),%edx
+ 14c:	85 c0                	test   %eax,%eax
+ 14e:	75 0e                	jne    15e <pass+0x11e>
+ 150:	66 83 bd 24 ff ff ff 	cmpw   $0x2,-0xdc(%ebp)
+ 157:	02 
+ 158:	0f 84 9b 00 00 00    	je     1f9 <pass+0x1b9>
+    close(fd);
+ 15e:	83 ec 0c             	sub    $0xc,%esp
+ 161:	52                   	push   %edx
+ 162:	e8 04 04 00 00       	call   56b <close>
+ 167:	83 c4 10             	add    $0x10,%esp
+ 16a:	e9 29 ff ff ff       	jmp    98 <pass+0x58>
+ 16f:	90                   	nop
+  close(dfd);
+ 170:	83 ec 0c             	sub    $0xc,%esp
+ 173:	56                   	push   %esi
+ 174:	e8 f2 03 00 00       	call   56b <close>
+  t = uptime() - t;
+ 179:	e8 5d 04 00 00       	call   5db <uptime>
+ 17e:	8b 8d fc fe ff ff    	mov    -0x104(%ebp),%ecx
+ 184:	29 c8                	sub    %ecx,%eax
+ 186:	89 c3                	mov    %eax,%ebx
+  iostat(&b);
+ 188:	8d 45 94             	lea    -0x6c(%ebp),%eax
+ 18b:	89 04 24             	mov    %eax,(%esp)
+ 18e:	e8 80 04 00 00       	call   613 <iostat>
+    t = 1;
+ 193:	85 db                	test   %ebx,%ebx
+ 195:	b8 01 00 00 00       	mov    $0x1,%eax
+ 19a:	0f 44 d8             	cmove  %eax,%ebx
+  printf(1, "%s: %d KB in %d ms, %d KB/s; %d misses, %d read ahead, "
+ 19d:	8b 45 ac             	mov    -0x54(%ebp),%eax
+ 1a0:	2b 85 58 ff ff ff    	sub    -0xa8(%ebp),%eax
+         "%d disk commands\n", what, tot / 1024, t, tot / t * 1000 / 1024,
+ 1a6:	31 d2                	xor    %edx,%edx
+  printf(1, "%s: %d KB in %d ms, %d KB/s; %d misses, %d read ahead, "
+ 1a8:	89 04 24             	mov    %eax,(%esp)
+ 1ab:	8b 45 a8             	mov    -0x58(%ebp),%eax
+ 1ae:	2b 85 54 ff ff ff    	sub    -0xac(%ebp),%eax
+ 1b4:	50                   	push   %eax
+ 1b5:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 1b8:	2b 85 4c ff ff ff    	sub    -0xb4(%ebp),%eax
+ 1be:	50                   	push   %eax
+         "%d disk commands\n", what, tot / 1024, t, tot / t * 1000 / 1024,
+ 1bf:	8b 85 04 ff ff ff    	mov    -0xfc(%ebp),%eax
+ 1c5:	f7 f3                	div    %ebx
+ 1c7:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  printf(1, "%s: %d KB in %d ms, %d KB/s; %d misses, %d read ahead, "
+ 1cd:	c1 e8 0a             	shr    $0xa,%eax
+ 1d0:	50                   	push   %eax
+ 1d1:	53                   	push   %ebx
+ 1d2:	8b 85 04 ff ff ff    	mov    -0xfc(%ebp),%eax
+ 1d8:	c1 e8 0a             	shr    $0xa,%eax
+ 1db:	50                   	push   %eax
+ 1dc:	ff b5 f8 fe ff ff    	push   -0x108(%ebp)
+ 1e2:	68 bc 0c 00 00       	push   $0xcbc
+ 1e7:	6a 01                	push   $0x1
+ 1e9:	e8 52 05 00 00       	call   740 <printf>
+}
+ 1ee:	83 c4 30             	add    $0x30,%esp
+ 1f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1f4:	5b                   	pop    %ebx
+ 1f5:	5e                   	pop    %esi
+ 1f6:	5f                   	pop    %edi
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	89 b5 00 ff ff ff    	mov    %esi,-0x100(%ebp)
+ 1ff:	89 d6                	mov    %edx,%esi
+ 201:	89 9d f4 fe ff ff    	mov    %ebx,-0x10c(%ebp)
+ 207:	8b 9d 04 ff ff ff    	mov    -0xfc(%ebp),%ebx
+ 20d:	eb 03                	jmp    212 <pass+0x1d2>
+ 20f:	90                   	nop
+        tot += n;
+ 210:	01 c3                	add    %eax,%ebx
+      while((n = read(fd, buf, sizeof(buf))) > 0)
+ 212:	83 ec 04             	sub    $0x4,%esp
+ 215:	68 00 02 00 00       	push   $0x200
+ 21a:	68 40 11 00 00       	push   $0x1140
+ 21f:	56                   	push   %esi
+ 220:	e8 36 03 00 00       	call   55b <read>
+ 225:	83 c4 10             	add    $0x10,%esp
+ 228:	85 c0                	test   %eax,%eax
+ 22a:	7f e4                	jg     210 <pass+0x1d0>
+ 22c:	89 9d 04 ff ff ff    	mov    %ebx,-0xfc(%ebp)
+ 232:	89 f2                	mov    %esi,%edx
+ 234:	8b 9d f4 fe ff ff    	mov    -0x10c(%ebp),%ebx
+ 23a:	8b b5 00 ff ff ff    	mov    -0x100(%ebp),%esi
+ 240:	e9 19 ff ff ff       	jmp    15e <pass+0x11e>
+    printf(2, "scanbench: cannot open %s\n", dir);
+ 245:	51                   	push   %ecx
+ 246:	53                   	push   %ebx
+ 247:	68 88 0c 00 00       	push   $0xc88
+ 24c:	6a 02                	push   $0x2
+ 24e:	e8 ed 04 00 00       	call   740 <printf>
+    exit();
+ 253:	e8 eb 02 00 00       	call   543 <exit>
+ 258:	66 90                	xchg   %ax,%ax
+ 25a:	66 90                	xchg   %ax,%ax
+ 25c:	66 90                	xchg   %ax,%ax
+ 25e:	66 90                	xchg   %ax,%ax
+
+00000260 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 260:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 261:	31 c0                	xor    %eax,%eax
+{
+ 263:	89 e5                	mov    %esp,%ebp
+ 265:	53                   	push   %ebx
+ 266:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 269:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 270:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 274:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 277:	83 c0 01             	add    $0x1,%eax
+ 27a:	84 d2                	test   %dl,%dl
+ 27c:	75 f2                	jne    270 <strcpy+0x10>
+    ;
+  return os;
+}
+ 27e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 281:	89 c8                	mov    %ecx,%eax
+ 283:	c9                   	leave
+ 284:	c3                   	ret
+ 285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+ 297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 29a:	0f b6 02             	movzbl (%edx),%eax
+ 29d:	84 c0                	test   %al,%al
+ 29f:	75 17                	jne    2b8 <strcmp+0x28>
+ 2a1:	eb 3a                	jmp    2dd <strcmp+0x4d>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2ac:	83 c2 01             	add    $0x1,%edx
+ 2af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2b2:	84 c0                	test   %al,%al
+ 2b4:	74 1a                	je     2d0 <strcmp+0x40>
+    p++, q++;
+ 2b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2bb:	38 c3                	cmp    %al,%bl
+ 2bd:	74 e9                	je     2a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2bf:	29 d8                	sub    %ebx,%eax
+}
+ 2c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2d4:	31 c0                	xor    %eax,%eax
+ 2d6:	29 d8                	sub    %ebx,%eax
+}
+ 2d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2e0:	31 c0                	xor    %eax,%eax
+ 2e2:	eb db                	jmp    2bf <strcmp+0x2f>
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2f9:	74 15                	je     310 <strlen+0x20>
+ 2fb:	31 c0                	xor    %eax,%eax
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 300:	83 c0 01             	add    $0x1,%eax
+ 303:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 307:	89 c1                	mov    %eax,%ecx
+ 309:	75 f5                	jne    300 <strlen+0x10>
+    ;
+  return n;
+}
+ 30b:	89 c8                	mov    %ecx,%eax
+ 30d:	5d                   	pop    %ebp
+ 30e:	c3                   	ret
+ 30f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 310:	31 c9                	xor    %ecx,%ecx
+}
+ 312:	5d                   	pop    %ebp
+ 313:	89 c8                	mov    %ecx,%eax
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 327:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 32a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32d:	89 d7                	mov    %edx,%edi
+ 32f:	fc                   	cld
+ 330:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 332:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 335:	89 d0                	mov    %edx,%eax
+ 337:	c9                   	leave
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 34a:	0f b6 10             	movzbl (%eax),%edx
+ 34d:	84 d2                	test   %dl,%dl
+ 34f:	75 12                	jne    363 <strchr+0x23>
+ 351:	eb 1d                	jmp    370 <strchr+0x30>
+ 353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 357:	90                   	nop
+ 358:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 35c:	83 c0 01             	add    $0x1,%eax
+ 35f:	84 d2                	test   %dl,%dl
+ 361:	74 0d                	je     370 <strchr+0x30>
+    if(*s == c)
+ 363:	38 d1                	cmp    %dl,%cl
+ 365:	75 f1                	jne    358 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 367:	5d                   	pop    %ebp
+ 368:	c3                   	ret
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 370:	31 c0                	xor    %eax,%eax
+}
+ 372:	5d                   	pop    %ebp
+ 373:	c3                   	ret
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 385:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 388:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 389:	31 db                	xor    %ebx,%ebx
+{
+ 38b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 38e:	eb 27                	jmp    3b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 390:	83 ec 04             	sub    $0x4,%esp
+ 393:	6a 01                	push   $0x1
+ 395:	56                   	push   %esi
+ 396:	6a 00                	push   $0x0
+ 398:	e8 be 01 00 00       	call   55b <read>
+    if(cc < 1)
+ 39d:	83 c4 10             	add    $0x10,%esp
+ 3a0:	85 c0                	test   %eax,%eax
+ 3a2:	7e 1d                	jle    3c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3af:	3c 0a                	cmp    $0xa,%al
+ 3b1:	74 10                	je     3c3 <gets+0x43>
+ 3b3:	3c 0d                	cmp    $0xd,%al
+ 3b5:	74 0c                	je     3c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3b7:	89 df                	mov    %ebx,%edi
+ 3b9:	83 c3 01             	add    $0x1,%ebx
+ 3bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3bf:	7c cf                	jl     390 <gets+0x10>
+ 3c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3cd:	5b                   	pop    %ebx
+ 3ce:	5e                   	pop    %esi
+ 3cf:	5f                   	pop    %edi
+ 3d0:	5d                   	pop    %ebp
+ 3d1:	c3                   	ret
+ 3d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+ 3e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3e5:	83 ec 08             	sub    $0x8,%esp
+ 3e8:	6a 00                	push   $0x0
+ 3ea:	ff 75 08             	push   0x8(%ebp)
+ 3ed:	e8 91 01 00 00       	call   583 <open>
+  if(fd < 0)
+ 3f2:	83 c4 10             	add    $0x10,%esp
+ 3f5:	85 c0                	test   %eax,%eax
+ 3f7:	78 27                	js     420 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3f9:	83 ec 08             	sub    $0x8,%esp
+ 3fc:	ff 75 0c             	push   0xc(%ebp)
+ 3ff:	89 c3                	mov    %eax,%ebx
+ 401:	50                   	push   %eax
+ 402:	e8 94 01 00 00       	call   59b <fstat>
+  close(fd);
+ 407:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 40a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 40c:	e8 5a 01 00 00       	call   56b <close>
+  return r;
+ 411:	83 c4 10             	add    $0x10,%esp
+}
+ 414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 417:	89 f0                	mov    %esi,%eax
+ 419:	5b                   	pop    %ebx
+ 41a:	5e                   	pop    %esi
+ 41b:	5d                   	pop    %ebp
+ 41c:	c3                   	ret
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 425:	eb ed                	jmp    414 <stat+0x34>
+ 427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	56                   	push   %esi
+ 434:	53                   	push   %ebx
+ 435:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 438:	0f b6 02             	movzbl (%edx),%eax
+ 43b:	3c 20                	cmp    $0x20,%al
+ 43d:	75 0c                	jne    44b <atoi+0x1b>
+ 43f:	90                   	nop
+ 440:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 444:	83 c2 01             	add    $0x1,%edx
+ 447:	3c 20                	cmp    $0x20,%al
+ 449:	74 f5                	je     440 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 44b:	3c 2d                	cmp    $0x2d,%al
+ 44d:	74 41                	je     490 <atoi+0x60>
+ 44f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 454:	3c 2b                	cmp    $0x2b,%al
+ 456:	74 3d                	je     495 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 458:	0f be 0a             	movsbl (%edx),%ecx
+ 45b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 45e:	3c 09                	cmp    $0x9,%al
+ 460:	b8 00 00 00 00       	mov    $0x0,%eax
+ 465:	77 21                	ja     488 <atoi+0x58>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 476:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 0a             	movsbl (%edx),%ecx
+ 47d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x40>
+  return sign*n;
+ 485:	0f af c6             	imul   %esi,%eax
+}
+ 488:	5b                   	pop    %ebx
+ 489:	5e                   	pop    %esi
+ 48a:	5d                   	pop    %ebp
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 490:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 495:	83 c2 01             	add    $0x1,%edx
+ 498:	eb be                	jmp    458 <atoi+0x28>
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004a0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	56                   	push   %esi
+ 4a4:	53                   	push   %ebx
+ 4a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4a8:	0f b6 02             	movzbl (%edx),%eax
+ 4ab:	3c 20                	cmp    $0x20,%al
+ 4ad:	75 0c                	jne    4bb <atoo+0x1b>
+ 4af:	90                   	nop
+ 4b0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 4b4:	83 c2 01             	add    $0x1,%edx
+ 4b7:	3c 20                	cmp    $0x20,%al
+ 4b9:	74 f5                	je     4b0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4bb:	3c 2d                	cmp    $0x2d,%al
+ 4bd:	74 41                	je     500 <atoo+0x60>
+ 4bf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4c4:	3c 2b                	cmp    $0x2b,%al
+ 4c6:	74 3d                	je     505 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 4c8:	0f be 0a             	movsbl (%edx),%ecx
+ 4cb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4ce:	3c 07                	cmp    $0x7,%al
+ 4d0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4d5:	77 1e                	ja     4f5 <atoo+0x55>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 4e0:	83 c2 01             	add    $0x1,%edx
+ 4e3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 4e7:	0f be 0a             	movsbl (%edx),%ecx
+ 4ea:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4ed:	80 fb 07             	cmp    $0x7,%bl
+ 4f0:	76 ee                	jbe    4e0 <atoo+0x40>
+  return sign*n;
+ 4f2:	0f af c6             	imul   %esi,%eax
+}
+ 4f5:	5b                   	pop    %ebx
+ 4f6:	5e                   	pop    %esi
+ 4f7:	5d                   	pop    %ebp
+ 4f8:	c3                   	ret
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 505:	83 c2 01             	add    $0x1,%edx
+ 508:	eb be                	jmp    4c8 <atoo+0x28>
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000510 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	8b 45 10             	mov    0x10(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 51e:	85 c0                	test   %eax,%eax
+ 520:	7e 13                	jle    535 <memmove+0x25>
+ 522:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 524:	89 d7                	mov    %edx,%edi
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 530:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 531:	39 f8                	cmp    %edi,%eax
+ 533:	75 fb                	jne    530 <memmove+0x20>
+  return vdst;
+}
+ 535:	5e                   	pop    %esi
+ 536:	89 d0                	mov    %edx,%eax
+ 538:	5f                   	pop    %edi
+ 539:	5d                   	pop    %ebp
+ 53a:	c3                   	ret
+
+0000053b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 53b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <exit>:
+SYSCALL(exit)
+ 543:	b8 02 00 00 00       	mov    $0x2,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <wait>:
+SYSCALL(wait)
+ 54b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <pipe>:
+SYSCALL(pipe)
+ 553:	b8 04 00 00 00       	mov    $0x4,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <read>:
+SYSCALL(read)
+ 55b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <write>:
+SYSCALL(write)
+ 563:	b8 10 00 00 00       	mov    $0x10,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <close>:
+SYSCALL(close)
+ 56b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <kill>:
+SYSCALL(kill)
+ 573:	b8 06 00 00 00       	mov    $0x6,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <exec>:
+SYSCALL(exec)
+ 57b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <open>:
+SYSCALL(open)
+ 583:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <mknod>:
+SYSCALL(mknod)
+ 58b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <unlink>:
+SYSCALL(unlink)
+ 593:	b8 12 00 00 00       	mov    $0x12,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <fstat>:
+SYSCALL(fstat)
+ 59b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <link>:
+SYSCALL(link)
+ 5a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <mkdir>:
+SYSCALL(mkdir)
+ 5ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <chdir>:
+SYSCALL(chdir)
+ 5b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <dup>:
+SYSCALL(dup)
+ 5bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <getpid>:
+SYSCALL(getpid)
+ 5c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <sbrk>:
+SYSCALL(sbrk)
+ 5cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <sleep>:
+SYSCALL(sleep)
+ 5d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <uptime>:
+SYSCALL(uptime)
+ 5db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <superpages>:
+SYSCALL(superpages)
+ 5e3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <mmap>:
+SYSCALL(mmap)
+ 5eb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <munmap>:
+SYSCALL(munmap)
+ 5f3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <spawn>:
+SYSCALL(spawn)
+ 5fb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <swapstat>:
+SYSCALL(swapstat)
+ 603:	b8 27 00 00 00       	mov    $0x27,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 60b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <iostat>:
+SYSCALL(iostat)
+ 613:	b8 29 00 00 00       	mov    $0x29,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <dropcache>:
+SYSCALL(dropcache)
+ 61b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <iosched>:
+SYSCALL(iosched)
+ 623:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <halt>:
+SYSCALL(halt)
+ 62b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <date>:
+SYSCALL(date)
+ 633:	b8 17 00 00 00       	mov    $0x17,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 63b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <getgid>:
+SYSCALL(getgid)
+ 643:	b8 19 00 00 00       	mov    $0x19,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <getppid>:
+SYSCALL(getppid)
+ 64b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <setuid>:
+SYSCALL(setuid)
+ 653:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <setgid>:
+SYSCALL(setgid)
+ 65b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getprocs>:
+SYSCALL(getprocs)
+ 663:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 66b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <getpriority>:
+SYSCALL(getpriority)
+ 673:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 67b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <chown>:
+SYSCALL(chown)
+ 683:	b8 21 00 00 00       	mov    $0x21,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <chgrp>:
+SYSCALL(chgrp)
+ 68b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+ 693:	66 90                	xchg   %ax,%ax
+ 695:	66 90                	xchg   %ax,%ax
+ 697:	66 90                	xchg   %ax,%ax
+ 699:	66 90                	xchg   %ax,%ax
+ 69b:	66 90                	xchg   %ax,%ax
+ 69d:	66 90                	xchg   %ax,%ax
+ 69f:	90                   	nop
+
+000006a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6a8:	89 d1                	mov    %edx,%ecx
+{
+ 6aa:	83 ec 3c             	sub    $0x3c,%esp
+ 6ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6b0:	85 d2                	test   %edx,%edx
+ 6b2:	0f 89 80 00 00 00    	jns    738 <printint+0x98>
+ 6b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6bc:	74 7a                	je     738 <printint+0x98>
+    x = -xx;
+ 6be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6c8:	31 f6                	xor    %esi,%esi
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6d0:	89 c8                	mov    %ecx,%eax
+ 6d2:	31 d2                	xor    %edx,%edx
+ 6d4:	89 f7                	mov    %esi,%edi
+ 6d6:	f7 f3                	div    %ebx
+ 6d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6db:	0f b6 92 64 0d 00 00 	movzbl 0xd64(%edx),%edx
+ 6e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6e6:	89 ca                	mov    %ecx,%edx
+ 6e8:	89 c1                	mov    %eax,%ecx
+ 6ea:	39 da                	cmp    %ebx,%edx
+ 6ec:	73 e2                	jae    6d0 <printint+0x30>
+  if(neg)
+ 6ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6f1:	85 c0                	test   %eax,%eax
+ 6f3:	74 07                	je     6fc <printint+0x5c>
+    buf[i++] = '-';
+ 6f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6fa:	89 f7                	mov    %esi,%edi
+ 6fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 702:	01 df                	add    %ebx,%edi
+ 704:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 708:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 70b:	83 ec 04             	sub    $0x4,%esp
+ 70e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 711:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 714:	6a 01                	push   $0x1
+ 716:	50                   	push   %eax
+ 717:	56                   	push   %esi
+ 718:	e8 46 fe ff ff       	call   563 <write>
+  while(--i >= 0)
+ 71d:	89 f8                	mov    %edi,%eax
+ 71f:	83 c4 10             	add    $0x10,%esp
+ 722:	83 ef 01             	sub    $0x1,%edi
+ 725:	39 d8                	cmp    %ebx,%eax
+ 727:	75 df                	jne    708 <printint+0x68>
+}
+ 729:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 72c:	5b                   	pop    %ebx
+ 72d:	5e                   	pop    %esi
+ 72e:	5f                   	pop    %edi
+ 72f:	5d                   	pop    %ebp
+ 730:	c3                   	ret
+ 731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 738:	31 c0                	xor    %eax,%eax
+ 73a:	eb 89                	jmp    6c5 <printint+0x25>
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	53                   	push   %ebx
+ 746:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 749:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 74c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 74f:	0f b6 1e             	movzbl (%esi),%ebx
+ 752:	83 c6 01             	add    $0x1,%esi
+ 755:	84 db                	test   %bl,%bl
+ 757:	74 67                	je     7c0 <printf+0x80>
+ 759:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 75c:	31 d2                	xor    %edx,%edx
+ 75e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 761:	eb 34                	jmp    797 <printf+0x57>
+ 763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 767:	90                   	nop
+ 768:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 76b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 770:	83 f8 25             	cmp    $0x25,%eax
+ 773:	74 18                	je     78d <printf+0x4d>
+  write(fd, &c, 1);
+ 775:	83 ec 04             	sub    $0x4,%esp
+ 778:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 77b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 77e:	6a 01                	push   $0x1
+ 780:	50                   	push   %eax
+ 781:	57                   	push   %edi
+ 782:	e8 dc fd ff ff       	call   563 <write>
+ 787:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 78a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 78d:	0f b6 1e             	movzbl (%esi),%ebx
+ 790:	83 c6 01             	add    $0x1,%esi
+ 793:	84 db                	test   %bl,%bl
+ 795:	74 29                	je     7c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 797:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 79a:	85 d2                	test   %edx,%edx
+ 79c:	74 ca                	je     768 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 79e:	83 fa 25             	cmp    $0x25,%edx
+ 7a1:	75 ea                	jne    78d <printf+0x4d>
+      if(c == 'd'){
+ 7a3:	83 f8 25             	cmp    $0x25,%eax
+ 7a6:	0f 84 24 01 00 00    	je     8d0 <printf+0x190>
+ 7ac:	83 e8 63             	sub    $0x63,%eax
+ 7af:	83 f8 15             	cmp    $0x15,%eax
+ 7b2:	77 1c                	ja     7d0 <printf+0x90>
+ 7b4:	ff 24 85 0c 0d 00 00 	jmp    *0xd0c(,%eax,4)
+ 7bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7c3:	5b                   	pop    %ebx
+ 7c4:	5e                   	pop    %esi
+ 7c5:	5f                   	pop    %edi
+ 7c6:	5d                   	pop    %ebp
+ 7c7:	c3                   	ret
+ 7c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7da:	6a 01                	push   $0x1
+ 7dc:	52                   	push   %edx
+ 7dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7e0:	57                   	push   %edi
+ 7e1:	e8 7d fd ff ff       	call   563 <write>
+ 7e6:	83 c4 0c             	add    $0xc,%esp
+ 7e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ec:	6a 01                	push   $0x1
+ 7ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7f1:	52                   	push   %edx
+ 7f2:	57                   	push   %edi
+ 7f3:	e8 6b fd ff ff       	call   563 <write>
+        putc(fd, c);
+ 7f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7fb:	31 d2                	xor    %edx,%edx
+ 7fd:	eb 8e                	jmp    78d <printf+0x4d>
+ 7ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 800:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 80b:	8b 13                	mov    (%ebx),%edx
+ 80d:	6a 00                	push   $0x0
+ 80f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 811:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 814:	e8 87 fe ff ff       	call   6a0 <printint>
+        ap++;
+ 819:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 81c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 81f:	31 d2                	xor    %edx,%edx
+ 821:	e9 67 ff ff ff       	jmp    78d <printf+0x4d>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 830:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 833:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 835:	83 c0 04             	add    $0x4,%eax
+ 838:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 83b:	85 db                	test   %ebx,%ebx
+ 83d:	0f 84 9d 00 00 00    	je     8e0 <printf+0x1a0>
+        while(*s != 0){
+ 843:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 846:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 848:	84 c0                	test   %al,%al
+ 84a:	0f 84 3d ff ff ff    	je     78d <printf+0x4d>
+ 850:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 853:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 856:	89 de                	mov    %ebx,%esi
+ 858:	89 d3                	mov    %edx,%ebx
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 866:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 869:	6a 01                	push   $0x1
+ 86b:	53                   	push   %ebx
+ 86c:	57                   	push   %edi
+ 86d:	e8 f1 fc ff ff       	call   563 <write>
+        while(*s != 0){
+ 872:	0f b6 06             	movzbl (%esi),%eax
+ 875:	83 c4 10             	add    $0x10,%esp
+ 878:	84 c0                	test   %al,%al
+ 87a:	75 e4                	jne    860 <printf+0x120>
+      state = 0;
+ 87c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 87f:	31 d2                	xor    %edx,%edx
+ 881:	e9 07 ff ff ff       	jmp    78d <printf+0x4d>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 89b:	8b 13                	mov    (%ebx),%edx
+ 89d:	6a 01                	push   $0x1
+ 89f:	e9 6b ff ff ff       	jmp    80f <printf+0xcf>
+ 8a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8ab:	83 ec 04             	sub    $0x4,%esp
+ 8ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8b9:	6a 01                	push   $0x1
+ 8bb:	52                   	push   %edx
+ 8bc:	57                   	push   %edi
+ 8bd:	e8 a1 fc ff ff       	call   563 <write>
+        ap++;
+ 8c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8c8:	31 d2                	xor    %edx,%edx
+ 8ca:	e9 be fe ff ff       	jmp    78d <printf+0x4d>
+ 8cf:	90                   	nop
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d9:	6a 01                	push   $0x1
+ 8db:	e9 11 ff ff ff       	jmp    7f1 <printf+0xb1>
+ 8e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8e5:	bb 05 0d 00 00       	mov    $0xd05,%ebx
+ 8ea:	e9 61 ff ff ff       	jmp    850 <printf+0x110>
+ 8ef:	90                   	nop
+
+000008f0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f3:	a1 64 13 00 00       	mov    0x1364,%eax
+{
+ 8f8:	89 e5                	mov    %esp,%ebp
+ 8fa:	56                   	push   %esi
+ 8fb:	53                   	push   %ebx
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 900:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 902:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 904:	39 ca                	cmp    %ecx,%edx
+ 906:	73 30                	jae    938 <lfree+0x48>
+ 908:	39 c1                	cmp    %eax,%ecx
+ 90a:	72 04                	jb     910 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 90c:	39 c2                	cmp    %eax,%edx
+ 90e:	72 f0                	jb     900 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 910:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 913:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 916:	39 f0                	cmp    %esi,%eax
+ 918:	74 26                	je     940 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 91a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 91c:	8b 42 04             	mov    0x4(%edx),%eax
+ 91f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 922:	39 d9                	cmp    %ebx,%ecx
+ 924:	74 30                	je     956 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 926:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 928:	5b                   	pop    %ebx
+  freep = p;
+ 929:	89 15 64 13 00 00    	mov    %edx,0x1364
+}
+ 92f:	5e                   	pop    %esi
+ 930:	5d                   	pop    %ebp
+ 931:	c3                   	ret
+ 932:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 938:	39 c1                	cmp    %eax,%ecx
+ 93a:	72 d0                	jb     90c <lfree+0x1c>
+ 93c:	eb c2                	jmp    900 <lfree+0x10>
+ 93e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 940:	03 58 04             	add    0x4(%eax),%ebx
+ 943:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 946:	8b 02                	mov    (%edx),%eax
+ 948:	8b 00                	mov    (%eax),%eax
+ 94a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 94c:	8b 42 04             	mov    0x4(%edx),%eax
+ 94f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 952:	39 d9                	cmp    %ebx,%ecx
+ 954:	75 d0                	jne    926 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 956:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 959:	89 15 64 13 00 00    	mov    %edx,0x1364
+    p->s.size += bp->s.size;
+ 95f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 962:	8b 09                	mov    (%ecx),%ecx
+ 964:	89 0a                	mov    %ecx,(%edx)
+}
+ 966:	5b                   	pop    %ebx
+ 967:	5e                   	pop    %esi
+ 968:	5d                   	pop    %ebp
+ 969:	c3                   	ret
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000970 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	89 c7                	mov    %eax,%edi
+ 976:	56                   	push   %esi
+ 977:	53                   	push   %ebx
+ 978:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 97b:	a1 64 13 00 00       	mov    0x1364,%eax
+ 980:	85 c0                	test   %eax,%eax
+ 982:	0f 84 88 00 00 00    	je     a10 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 988:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 98a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 98d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 992:	39 df                	cmp    %ebx,%edi
+ 994:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 997:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 99e:	39 f9                	cmp    %edi,%ecx
+ 9a0:	72 0f                	jb     9b1 <lalloc+0x41>
+ 9a2:	eb 4c                	jmp    9f0 <lalloc+0x80>
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 9aa:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 9ad:	39 f9                	cmp    %edi,%ecx
+ 9af:	73 3f                	jae    9f0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 9b1:	89 d0                	mov    %edx,%eax
+ 9b3:	39 15 64 13 00 00    	cmp    %edx,0x1364
+ 9b9:	75 ed                	jne    9a8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 9bb:	83 ec 0c             	sub    $0xc,%esp
+ 9be:	56                   	push   %esi
+ 9bf:	e8 07 fc ff ff       	call   5cb <sbrk>
+  if(p == (char*)-1)
+ 9c4:	83 c4 10             	add    $0x10,%esp
+ 9c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9ca:	74 11                	je     9dd <lalloc+0x6d>
+  hp->s.size = nu;
+ 9cc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 9cf:	e8 1c ff ff ff       	call   8f0 <lfree>
+  return freep;
+ 9d4:	a1 64 13 00 00       	mov    0x1364,%eax
+      if((p = morecore(nunits)) == 0)
+ 9d9:	85 c0                	test   %eax,%eax
+ 9db:	75 cb                	jne    9a8 <lalloc+0x38>
+        return 0;
+  }
+}
+ 9dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9e0:	31 d2                	xor    %edx,%edx
+}
+ 9e2:	5b                   	pop    %ebx
+ 9e3:	89 d0                	mov    %edx,%eax
+ 9e5:	5e                   	pop    %esi
+ 9e6:	5f                   	pop    %edi
+ 9e7:	5d                   	pop    %ebp
+ 9e8:	c3                   	ret
+ 9e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 9f0:	39 cf                	cmp    %ecx,%edi
+ 9f2:	74 4c                	je     a40 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 9f4:	29 f9                	sub    %edi,%ecx
+ 9f6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 9f9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 9fc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 9ff:	a3 64 13 00 00       	mov    %eax,0x1364
+}
+ a04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a07:	89 d0                	mov    %edx,%eax
+ a09:	5b                   	pop    %ebx
+ a0a:	5e                   	pop    %esi
+ a0b:	5f                   	pop    %edi
+ a0c:	5d                   	pop    %ebp
+ a0d:	c3                   	ret
+ a0e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ a10:	ba 68 13 00 00       	mov    $0x1368,%edx
+ a15:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ a17:	c7 05 64 13 00 00 68 	movl   $0x1368,0x1364
+ a1e:	13 00 00 
+ a21:	c7 05 68 13 00 00 68 	movl   $0x1368,0x1368
+ a28:	13 00 00 
+ a2b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ a2d:	c7 05 6c 13 00 00 00 	movl   $0x0,0x136c
+ a34:	00 00 00 
+ a37:	e9 51 ff ff ff       	jmp    98d <lalloc+0x1d>
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ a40:	8b 0a                	mov    (%edx),%ecx
+ a42:	89 08                	mov    %ecx,(%eax)
+ a44:	eb b9                	jmp    9ff <lalloc+0x8f>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ a59:	85 f6                	test   %esi,%esi
+ a5b:	74 42                	je     a9f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ a5d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ a60:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ a63:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ a69:	77 3d                	ja     aa8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ a6b:	31 c9                	xor    %ecx,%ecx
+ a6d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ a72:	83 fa 02             	cmp    $0x2,%edx
+ a75:	74 17                	je     a8e <free+0x3e>
+ a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7e:	66 90                	xchg   %ax,%ax
+ a80:	83 c1 01             	add    $0x1,%ecx
+ a83:	89 d8                	mov    %ebx,%eax
+ a85:	d3 e0                	shl    %cl,%eax
+ a87:	83 c0 01             	add    $0x1,%eax
+ a8a:	39 c2                	cmp    %eax,%edx
+ a8c:	75 f2                	jne    a80 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ a8e:	8b 04 8d 40 13 00 00 	mov    0x1340(,%ecx,4),%eax
+  classes[c] = bp;
+ a95:	89 3c 8d 40 13 00 00 	mov    %edi,0x1340(,%ecx,4)
+  bp->s.ptr = classes[c];
+ a9c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ a9f:	5b                   	pop    %ebx
+ aa0:	5e                   	pop    %esi
+ aa1:	5f                   	pop    %edi
+ aa2:	5d                   	pop    %ebp
+ aa3:	c3                   	ret
+ aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aa8:	5b                   	pop    %ebx
+    lfree(bp);
+ aa9:	89 f8                	mov    %edi,%eax
+}
+ aab:	5e                   	pop    %esi
+ aac:	5f                   	pop    %edi
+ aad:	5d                   	pop    %ebp
+    lfree(bp);
+ aae:	e9 3d fe ff ff       	jmp    8f0 <lfree>
+ ab3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ac0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	56                   	push   %esi
+ ac5:	53                   	push   %ebx
+ ac6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+ acc:	83 c0 07             	add    $0x7,%eax
+ acf:	c1 e8 03             	shr    $0x3,%eax
+ ad2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ ad5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ ada:	77 44                	ja     b20 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ adc:	31 c9                	xor    %ecx,%ecx
+ ade:	ba 01 00 00 00       	mov    $0x1,%edx
+ ae3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ ae8:	83 f8 02             	cmp    $0x2,%eax
+ aeb:	76 11                	jbe    afe <malloc+0x3e>
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+ af0:	83 c1 01             	add    $0x1,%ecx
+ af3:	89 d3                	mov    %edx,%ebx
+ af5:	d3 e3                	shl    %cl,%ebx
+ af7:	83 c3 01             	add    $0x1,%ebx
+ afa:	39 c3                	cmp    %eax,%ebx
+ afc:	72 f2                	jb     af0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ afe:	8b 04 8d 40 13 00 00 	mov    0x1340(,%ecx,4),%eax
+ b05:	85 c0                	test   %eax,%eax
+ b07:	74 2f                	je     b38 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ b09:	8b 10                	mov    (%eax),%edx
+ b0b:	89 14 8d 40 13 00 00 	mov    %edx,0x1340(,%ecx,4)
+  return (void*)(p + 1);
+ b12:	83 c0 08             	add    $0x8,%eax
+}
+ b15:	83 c4 1c             	add    $0x1c,%esp
+ b18:	5b                   	pop    %ebx
+ b19:	5e                   	pop    %esi
+ b1a:	5f                   	pop    %edi
+ b1b:	5d                   	pop    %ebp
+ b1c:	c3                   	ret
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ b20:	e8 4b fe ff ff       	call   970 <lalloc>
+ b25:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ b27:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ b2a:	85 d2                	test   %edx,%edx
+ b2c:	75 e7                	jne    b15 <malloc+0x55>
+      return 0;
+ b2e:	31 c0                	xor    %eax,%eax
+ b30:	eb e3                	jmp    b15 <malloc+0x55>
+ b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ b38:	31 d2                	xor    %edx,%edx
+ b3a:	b8 00 02 00 00       	mov    $0x200,%eax
+ b3f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b42:	f7 f3                	div    %ebx
+  if(n < 4)
+ b44:	ba 04 00 00 00       	mov    $0x4,%edx
+ b49:	89 d6                	mov    %edx,%esi
+ b4b:	39 d0                	cmp    %edx,%eax
+ b4d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ b50:	0f af f3             	imul   %ebx,%esi
+ b53:	89 f0                	mov    %esi,%eax
+ b55:	e8 16 fe ff ff       	call   970 <lalloc>
+ b5a:	85 c0                	test   %eax,%eax
+ b5c:	74 d0                	je     b2e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ b5e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b61:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ b64:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b6b:	8b 14 8d 40 13 00 00 	mov    0x1340(,%ecx,4),%edx
+ b72:	39 f8                	cmp    %edi,%eax
+ b74:	73 22                	jae    b98 <malloc+0xd8>
+ b76:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ b79:	eb 09                	jmp    b84 <malloc+0xc4>
+ b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+ b80:	89 c2                	mov    %eax,%edx
+ b82:	89 c8                	mov    %ecx,%eax
+ b84:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ b87:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ b8a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ b8c:	39 f9                	cmp    %edi,%ecx
+ b8e:	72 f0                	jb     b80 <malloc+0xc0>
+ b90:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b93:	e9 73 ff ff ff       	jmp    b0b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ b98:	89 d0                	mov    %edx,%eax
+ b9a:	8b 12                	mov    (%edx),%edx
+ b9c:	e9 6a ff ff ff       	jmp    b0b <malloc+0x4b>
+ ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+
+00000bb0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	56                   	push   %esi
+ bb4:	53                   	push   %ebx
+ bb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ bb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ bbb:	85 c9                	test   %ecx,%ecx
+ bbd:	74 06                	je     bc5 <calloc+0x15>
+ bbf:	89 c8                	mov    %ecx,%eax
+ bc1:	f7 e3                	mul    %ebx
+ bc3:	70 33                	jo     bf8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ bc5:	0f af d9             	imul   %ecx,%ebx
+ bc8:	83 ec 0c             	sub    $0xc,%esp
+ bcb:	53                   	push   %ebx
+ bcc:	e8 ef fe ff ff       	call   ac0 <malloc>
+ bd1:	83 c4 10             	add    $0x10,%esp
+ bd4:	89 c6                	mov    %eax,%esi
+ bd6:	85 c0                	test   %eax,%eax
+ bd8:	74 1e                	je     bf8 <calloc+0x48>
+    memset(p, 0, n * size);
+ bda:	83 ec 04             	sub    $0x4,%esp
+ bdd:	53                   	push   %ebx
+ bde:	6a 00                	push   $0x0
+ be0:	50                   	push   %eax
+ be1:	e8 3a f7 ff ff       	call   320 <memset>
+ be6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ be9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bec:	89 f0                	mov    %esi,%eax
+ bee:	5b                   	pop    %ebx
+ bef:	5e                   	pop    %esi
+ bf0:	5d                   	pop    %ebp
+ bf1:	c3                   	ret
+ bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ bf8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ bfb:	31 f6                	xor    %esi,%esi
+}
+ bfd:	89 f0                	mov    %esi,%eax
+ bff:	5b                   	pop    %ebx
+ c00:	5e                   	pop    %esi
+ c01:	5d                   	pop    %ebp
+ c02:	c3                   	ret
+ c03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c10 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ c10:	55                   	push   %ebp
+ c11:	89 e5                	mov    %esp,%ebp
+ c13:	57                   	push   %edi
+ c14:	56                   	push   %esi
+ c15:	53                   	push   %ebx
+ c16:	83 ec 0c             	sub    $0xc,%esp
+ c19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ c1f:	85 db                	test   %ebx,%ebx
+ c21:	74 55                	je     c78 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ c23:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ c26:	89 de                	mov    %ebx,%esi
+ c28:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ c2f:	39 c7                	cmp    %eax,%edi
+ c31:	72 0d                	jb     c40 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ c33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c36:	89 f0                	mov    %esi,%eax
+ c38:	5b                   	pop    %ebx
+ c39:	5e                   	pop    %esi
+ c3a:	5f                   	pop    %edi
+ c3b:	5d                   	pop    %ebp
+ c3c:	c3                   	ret
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ c40:	83 ec 0c             	sub    $0xc,%esp
+ c43:	50                   	push   %eax
+ c44:	e8 77 fe ff ff       	call   ac0 <malloc>
+ c49:	83 c4 10             	add    $0x10,%esp
+ c4c:	89 c6                	mov    %eax,%esi
+ c4e:	85 c0                	test   %eax,%eax
+ c50:	74 e1                	je     c33 <realloc+0x23>
+  memmove(p, ap, have);
+ c52:	83 ec 04             	sub    $0x4,%esp
+ c55:	57                   	push   %edi
+ c56:	53                   	push   %ebx
+ c57:	50                   	push   %eax
+ c58:	e8 b3 f8 ff ff       	call   510 <memmove>
+  free(ap);
+ c5d:	89 1c 24             	mov    %ebx,(%esp)
+ c60:	e8 eb fd ff ff       	call   a50 <free>
+  return p;
+ c65:	83 c4 10             	add    $0x10,%esp
+}
+ c68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c6b:	89 f0                	mov    %esi,%eax
+ c6d:	5b                   	pop    %ebx
+ c6e:	5e                   	pop    %esi
+ c6f:	5f                   	pop    %edi
+ c70:	5d                   	pop    %ebp
+ c71:	c3                   	ret
+ c72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ c78:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ c7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c7e:	5b                   	pop    %ebx
+ c7f:	5e                   	pop    %esi
+ c80:	5f                   	pop    %edi
+ c81:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ c82:	e9 39 fe ff ff       	jmp    ac0 <malloc>
@@ -0,0 +1,78 @@
+// Measure sequential file reads: read every file in a directory
+// (/ by default) 512 bytes at a time, as cat, wc and grep do,
+// twice.  Run right after boot, the first pass finds the blocks
+// on disk and shows what read-ahead buys; the second finds them
+// cached.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+char buf[512];
+
+// Read every regular file in dir; return the bytes read.
+static uint
+scan(char *dir)
+{
+  char path[64];
+  struct dirent de;
+  struct stat st;
+  int dfd, fd, n;
+  uint tot;
+
+  if((dfd = open(dir, O_RDONLY)) < 0){
+    printf(2, "scanbench: cannot open %s\n", dir);
+    exit();
+  }
+  tot = 0;
+  while(read(dfd, &de, sizeof(de)) == sizeof(de)){
+    if(de.inum == 0 || strlen(dir) + 1 + DIRSIZ + 1 > sizeof(path))
+      continue;
+    strcpy(path, dir);
+    path[strlen(dir)] = '/';
+    memmove(path + strlen(dir) + 1, de.name, DIRSIZ);
+    path[strlen(dir) + 1 + DIRSIZ] = 0;
+    if((fd = open(path, O_RDONLY)) < 0)
+      continue;
+    if(fstat(fd, &st) == 0 && st.type == T_FILE)
+      while((n = read(fd, buf, sizeof(buf))) > 0)
+        tot += n;
+    close(fd);
+  }
+  close(dfd);
+  return tot;
+}
+
+static void
+pass(char *what, char *dir)
+{
+  struct iostat a, b;
+  uint tot;
+  int t;
+
+  iostat(&a);
+  t = uptime();
+  tot = scan(dir);
+  t = uptime() - t;
+  iostat(&b);
+  if(t == 0)
+    t = 1;
+  printf(1, "%s: %d KB in %d ms, %d KB/s; %d misses, %d read ahead, "
+         "%d disk commands\n", what, tot / 1024, t, tot / t * 1000 / 1024,
+         b.misses - a.misses, b.readaheads - a.readaheads,
+         b.diskreqs - a.diskreqs);
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *dir;
+
+  dir = argc > 1 ? argv[1] : "/";
+  pass("first pass", dir);
+  pass("second pass", dir);
+  exit();
+}
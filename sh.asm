@@ -0,0 +1,4028 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// ***** processing for shell builtins ends here *****
+#endif
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 08             	sub    $0x8,%esp
+  static char buf[100];
+  struct cmd *cmd;
+  int fd;
+
+  // Assumes three file descriptors open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      14:	eb 13                	jmp    29 <main+0x29>
+      16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(fd >= 3){
+      20:	83 f8 02             	cmp    $0x2,%eax
+      23:	0f 8f 6b 01 00 00    	jg     194 <main+0x194>
+  while((fd = open("console", O_RDWR)) >= 0){
+      29:	83 ec 08             	sub    $0x8,%esp
+      2c:	6a 02                	push   $0x2
+      2e:	68 b3 1e 00 00       	push   $0x1eb3
+      33:	e8 7b 16 00 00       	call   16b3 <open>
+      38:	83 c4 10             	add    $0x10,%esp
+      3b:	85 c0                	test   %eax,%eax
+      3d:	79 e1                	jns    20 <main+0x20>
+      3f:	90                   	nop
+  printf(2, "$ ");
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	68 fe 1d 00 00       	push   $0x1dfe
+      48:	6a 02                	push   $0x2
+      4a:	e8 21 18 00 00       	call   1870 <printf>
+  memset(buf, 0, nbuf);
+      4f:	83 c4 0c             	add    $0xc,%esp
+      52:	6a 64                	push   $0x64
+      54:	6a 00                	push   $0x0
+      56:	68 e0 27 00 00       	push   $0x27e0
+      5b:	e8 f0 13 00 00       	call   1450 <memset>
+  gets(buf, nbuf);
+      60:	58                   	pop    %eax
+      61:	5a                   	pop    %edx
+      62:	6a 64                	push   $0x64
+      64:	68 e0 27 00 00       	push   $0x27e0
+      69:	e8 42 14 00 00       	call   14b0 <gets>
+  if(buf[0] == 0) // EOF
+      6e:	0f b6 05 e0 27 00 00 	movzbl 0x27e0,%eax
+      75:	83 c4 10             	add    $0x10,%esp
+      78:	84 c0                	test   %al,%al
+      7a:	0f 84 e5 00 00 00    	je     165 <main+0x165>
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+// add support for built-ins here. cd is a built-in
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      80:	3c 63                	cmp    $0x63,%al
+      82:	74 44                	je     c8 <main+0xc8>
+      if(chdir(buf+3) < 0)
+        printf(2, "cannot cd %s\n", buf+3);
+      continue;
+    }
+#ifdef USE_BUILTINS
+    if (buf[0]=='_') {     // assume it is a builtin command
+      84:	3c 5f                	cmp    $0x5f,%al
+      86:	0f 84 c4 00 00 00    	je     150 <main+0x150>
+      dobuiltin(buf);
+      continue;
+    }
+#endif
+    if(simpleline(buf)){
+      8c:	83 ec 0c             	sub    $0xc,%esp
+      8f:	68 e0 27 00 00       	push   $0x27e0
+      94:	e8 87 0f 00 00       	call   1020 <simpleline>
+      99:	83 c4 10             	add    $0x10,%esp
+      9c:	85 c0                	test   %eax,%eax
+      9e:	0f 85 7c 00 00 00    	jne    120 <main+0x120>
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      a4:	e8 c2 15 00 00       	call   166b <fork>
+  if(pid == -1)
+      a9:	83 f8 ff             	cmp    $0xffffffff,%eax
+      ac:	0f 84 cd 01 00 00    	je     27f <main+0x27f>
+    if(fork1() == 0)
+      b2:	85 c0                	test   %eax,%eax
+      b4:	0f 84 eb 00 00 00    	je     1a5 <main+0x1a5>
+    wait();
+      ba:	e8 bc 15 00 00       	call   167b <wait>
+      bf:	e9 7c ff ff ff       	jmp    40 <main+0x40>
+      c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      c8:	80 3d e1 27 00 00 64 	cmpb   $0x64,0x27e1
+      cf:	75 bb                	jne    8c <main+0x8c>
+      d1:	80 3d e2 27 00 00 20 	cmpb   $0x20,0x27e2
+      d8:	75 b2                	jne    8c <main+0x8c>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	68 e0 27 00 00       	push   $0x27e0
+      e2:	e8 39 13 00 00       	call   1420 <strlen>
+      if(chdir(buf+3) < 0)
+      e7:	c7 04 24 e3 27 00 00 	movl   $0x27e3,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      ee:	c6 80 df 27 00 00 00 	movb   $0x0,0x27df(%eax)
+      if(chdir(buf+3) < 0)
+      f5:	e8 e9 15 00 00       	call   16e3 <chdir>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	0f 89 3b ff ff ff    	jns    40 <main+0x40>
+        printf(2, "cannot cd %s\n", buf+3);
+     105:	50                   	push   %eax
+     106:	68 e3 27 00 00       	push   $0x27e3
+     10b:	68 bb 1e 00 00       	push   $0x1ebb
+     110:	6a 02                	push   $0x2
+     112:	e8 59 17 00 00       	call   1870 <printf>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	e9 21 ff ff ff       	jmp    40 <main+0x40>
+     11f:	90                   	nop
+      cmd = parsecmd(buf);
+     120:	83 ec 0c             	sub    $0xc,%esp
+     123:	68 e0 27 00 00       	push   $0x27e0
+     128:	e8 83 0e 00 00       	call   fb0 <parsecmd>
+     12d:	89 c3                	mov    %eax,%ebx
+      spawncmd(cmd);
+     12f:	89 04 24             	mov    %eax,(%esp)
+     132:	e8 09 10 00 00       	call   1140 <spawncmd>
+
+// Free a command parsed from a simple line.
+void
+freecmd(struct cmd *cmd)
+{
+  if(cmd->type == PIPE){
+     137:	83 c4 10             	add    $0x10,%esp
+     13a:	83 3b 03             	cmpl   $0x3,(%ebx)
+     13d:	74 2b                	je     16a <main+0x16a>
+    freecmd(((struct pipecmd*)cmd)->left);
+    freecmd(((struct pipecmd*)cmd)->right);
+  }
+  free(cmd);
+     13f:	83 ec 0c             	sub    $0xc,%esp
+     142:	53                   	push   %ebx
+     143:	e8 38 1a 00 00       	call   1b80 <free>
+      continue;
+     148:	83 c4 10             	add    $0x10,%esp
+     14b:	e9 f0 fe ff ff       	jmp    40 <main+0x40>
+      dobuiltin(buf);
+     150:	83 ec 0c             	sub    $0xc,%esp
+     153:	68 e0 27 00 00       	push   $0x27e0
+     158:	e8 e3 03 00 00       	call   540 <dobuiltin>
+      continue;
+     15d:	83 c4 10             	add    $0x10,%esp
+     160:	e9 db fe ff ff       	jmp    40 <main+0x40>
+  exit();
+     165:	e8 09 15 00 00       	call   1673 <exit>
+    freecmd(((struct pipecmd*)cmd)->left);
+     16a:	8b 73 04             	mov    0x4(%ebx),%esi
+  if(cmd->type == PIPE){
+     16d:	83 3e 03             	cmpl   $0x3,(%esi)
+     170:	74 48                	je     1ba <main+0x1ba>
+  free(cmd);
+     172:	83 ec 0c             	sub    $0xc,%esp
+     175:	56                   	push   %esi
+     176:	e8 05 1a 00 00       	call   1b80 <free>
+    freecmd(((struct pipecmd*)cmd)->right);
+     17b:	8b 73 08             	mov    0x8(%ebx),%esi
+  if(cmd->type == PIPE){
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	83 3e 03             	cmpl   $0x3,(%esi)
+     184:	74 62                	je     1e8 <main+0x1e8>
+  free(cmd);
+     186:	83 ec 0c             	sub    $0xc,%esp
+     189:	56                   	push   %esi
+     18a:	e8 f1 19 00 00       	call   1b80 <free>
+}
+     18f:	83 c4 10             	add    $0x10,%esp
+     192:	eb ab                	jmp    13f <main+0x13f>
+      close(fd);
+     194:	83 ec 0c             	sub    $0xc,%esp
+     197:	50                   	push   %eax
+     198:	e8 fe 14 00 00       	call   169b <close>
+      break;
+     19d:	83 c4 10             	add    $0x10,%esp
+     1a0:	e9 9b fe ff ff       	jmp    40 <main+0x40>
+      runcmd(parsecmd(buf));
+     1a5:	83 ec 0c             	sub    $0xc,%esp
+     1a8:	68 e0 27 00 00       	push   $0x27e0
+     1ad:	e8 fe 0d 00 00       	call   fb0 <parsecmd>
+     1b2:	89 04 24             	mov    %eax,(%esp)
+     1b5:	e8 46 04 00 00       	call   600 <runcmd>
+    freecmd(((struct pipecmd*)cmd)->left);
+     1ba:	8b 7e 04             	mov    0x4(%esi),%edi
+  if(cmd->type == PIPE){
+     1bd:	83 3f 03             	cmpl   $0x3,(%edi)
+     1c0:	0f 84 9d 00 00 00    	je     263 <main+0x263>
+  free(cmd);
+     1c6:	83 ec 0c             	sub    $0xc,%esp
+     1c9:	57                   	push   %edi
+     1ca:	e8 b1 19 00 00       	call   1b80 <free>
+    freecmd(((struct pipecmd*)cmd)->right);
+     1cf:	8b 7e 08             	mov    0x8(%esi),%edi
+  if(cmd->type == PIPE){
+     1d2:	83 c4 10             	add    $0x10,%esp
+     1d5:	83 3f 03             	cmpl   $0x3,(%edi)
+     1d8:	74 6d                	je     247 <main+0x247>
+  free(cmd);
+     1da:	83 ec 0c             	sub    $0xc,%esp
+     1dd:	57                   	push   %edi
+     1de:	e8 9d 19 00 00       	call   1b80 <free>
+}
+     1e3:	83 c4 10             	add    $0x10,%esp
+     1e6:	eb 8a                	jmp    172 <main+0x172>
+    freecmd(((struct pipecmd*)cmd)->left);
+     1e8:	8b 7e 04             	mov    0x4(%esi),%edi
+  if(cmd->type == PIPE){
+     1eb:	83 3f 03             	cmpl   $0x3,(%edi)
+     1ee:	74 3e                	je     22e <main+0x22e>
+  free(cmd);
+     1f0:	83 ec 0c             	sub    $0xc,%esp
+     1f3:	57                   	push   %edi
+     1f4:	e8 87 19 00 00       	call   1b80 <free>
+    freecmd(((struct pipecmd*)cmd)->right);
+     1f9:	8b 7e 08             	mov    0x8(%esi),%edi
+  if(cmd->type == PIPE){
+     1fc:	83 c4 10             	add    $0x10,%esp
+     1ff:	83 3f 03             	cmpl   $0x3,(%edi)
+     202:	74 11                	je     215 <main+0x215>
+  free(cmd);
+     204:	83 ec 0c             	sub    $0xc,%esp
+     207:	57                   	push   %edi
+     208:	e8 73 19 00 00       	call   1b80 <free>
+}
+     20d:	83 c4 10             	add    $0x10,%esp
+     210:	e9 71 ff ff ff       	jmp    186 <main+0x186>
+    freecmd(((struct pipecmd*)cmd)->left);
+     215:	83 ec 0c             	sub    $0xc,%esp
+     218:	ff 77 04             	push   0x4(%edi)
+     21b:	e8 d0 10 00 00       	call   12f0 <freecmd>
+    freecmd(((struct pipecmd*)cmd)->right);
+     220:	59                   	pop    %ecx
+     221:	ff 77 08             	push   0x8(%edi)
+     224:	e8 c7 10 00 00       	call   12f0 <freecmd>
+     229:	83 c4 10             	add    $0x10,%esp
+     22c:	eb d6                	jmp    204 <main+0x204>
+    freecmd(((struct pipecmd*)cmd)->left);
+     22e:	83 ec 0c             	sub    $0xc,%esp
+     231:	ff 77 04             	push   0x4(%edi)
+     234:	e8 b7 10 00 00       	call   12f0 <freecmd>
+    freecmd(((struct pipecmd*)cmd)->right);
+     239:	58                   	pop    %eax
+     23a:	ff 77 08             	push   0x8(%edi)
+     23d:	e8 ae 10 00 00       	call   12f0 <freecmd>
+     242:	83 c4 10             	add    $0x10,%esp
+     245:	eb a9                	jmp    1f0 <main+0x1f0>
+    freecmd(((struct pipecmd*)cmd)->left);
+     247:	83 ec 0c             	sub    $0xc,%esp
+     24a:	ff 77 04             	push   0x4(%edi)
+     24d:	e8 9e 10 00 00       	call   12f0 <freecmd>
+    freecmd(((struct pipecmd*)cmd)->right);
+     252:	58                   	pop    %eax
+     253:	ff 77 08             	push   0x8(%edi)
+     256:	e8 95 10 00 00       	call   12f0 <freecmd>
+     25b:	83 c4 10             	add    $0x10,%esp
+     25e:	e9 77 ff ff ff       	jmp    1da <main+0x1da>
+    freecmd(((struct pipecmd*)cmd)->left);
+     263:	83 ec 0c             	sub    $0xc,%esp
+     266:	ff 77 04             	push   0x4(%edi)
+     269:	e8 82 10 00 00       	call   12f0 <freecmd>
+    freecmd(((struct pipecmd*)cmd)->right);
+     26e:	58                   	pop    %eax
+     26f:	ff 77 08             	push   0x8(%edi)
+     272:	e8 79 10 00 00       	call   12f0 <freecmd>
+     277:	83 c4 10             	add    $0x10,%esp
+     27a:	e9 47 ff ff ff       	jmp    1c6 <main+0x1c6>
+    panic("fork");
+     27f:	83 ec 0c             	sub    $0xc,%esp
+     282:	68 01 1e 00 00       	push   $0x1e01
+     287:	e8 34 03 00 00       	call   5c0 <panic>
+     28c:	66 90                	xchg   %ax,%ax
+     28e:	66 90                	xchg   %ax,%ax
+
+00000290 <getbuiltin>:
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	53                   	push   %ebx
+     294:	83 ec 10             	sub    $0x10,%esp
+  p += strlen("_get");
+     297:	68 c0 1d 00 00       	push   $0x1dc0
+     29c:	e8 7f 11 00 00       	call   1420 <strlen>
+     2a1:	03 45 08             	add    0x8(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+     2a4:	83 c4 10             	add    $0x10,%esp
+     2a7:	80 38 20             	cmpb   $0x20,(%eax)
+     2aa:	75 0c                	jne    2b8 <getbuiltin+0x28>
+     2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     2b0:	83 c0 01             	add    $0x1,%eax
+    while(n > 0 && *p && *p == *q)
+     2b3:	80 38 20             	cmpb   $0x20,(%eax)
+     2b6:	74 f8                	je     2b0 <getbuiltin+0x20>
+{
+     2b8:	89 c1                	mov    %eax,%ecx
+     2ba:	ba b8 1d 00 00       	mov    $0x1db8,%edx
+     2bf:	eb 19                	jmp    2da <getbuiltin+0x4a>
+     2c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    while(n > 0 && *p && *p == *q)
+     2c8:	3a 19                	cmp    (%ecx),%bl
+     2ca:	75 15                	jne    2e1 <getbuiltin+0x51>
+      n--, p++, q++;
+     2cc:	83 c2 01             	add    $0x1,%edx
+     2cf:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+     2d2:	81 fa bb 1d 00 00    	cmp    $0x1dbb,%edx
+     2d8:	74 6d                	je     347 <getbuiltin+0xb7>
+     2da:	0f b6 1a             	movzbl (%edx),%ebx
+     2dd:	84 db                	test   %bl,%bl
+     2df:	75 e7                	jne    2c8 <getbuiltin+0x38>
+    if(n == 0)
+     2e1:	81 fa bb 1d 00 00    	cmp    $0x1dbb,%edx
+     2e7:	74 5e                	je     347 <getbuiltin+0xb7>
+  if (strncmp("uid", p, 3) == 0) {
+     2e9:	0f b6 09             	movzbl (%ecx),%ecx
+     2ec:	bb bc 1d 00 00       	mov    $0x1dbc,%ebx
+     2f1:	38 0a                	cmp    %cl,(%edx)
+     2f3:	75 1d                	jne    312 <getbuiltin+0x82>
+     2f5:	eb 50                	jmp    347 <getbuiltin+0xb7>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+    while(n > 0 && *p && *p == *q)
+     300:	3a 10                	cmp    (%eax),%dl
+     302:	75 15                	jne    319 <getbuiltin+0x89>
+      n--, p++, q++;
+     304:	83 c3 01             	add    $0x1,%ebx
+     307:	83 c0 01             	add    $0x1,%eax
+    while(n > 0 && *p && *p == *q)
+     30a:	81 fb bf 1d 00 00    	cmp    $0x1dbf,%ebx
+     310:	74 16                	je     328 <getbuiltin+0x98>
+     312:	0f b6 13             	movzbl (%ebx),%edx
+     315:	84 d2                	test   %dl,%dl
+     317:	75 e7                	jne    300 <getbuiltin+0x70>
+    if(n == 0)
+     319:	81 fb bf 1d 00 00    	cmp    $0x1dbf,%ebx
+     31f:	74 07                	je     328 <getbuiltin+0x98>
+  if (strncmp("gid", p, 3) == 0) {
+     321:	0f b6 00             	movzbl (%eax),%eax
+     324:	38 03                	cmp    %al,(%ebx)
+     326:	75 26                	jne    34e <getbuiltin+0xbe>
+    printf(2, "%d\n", getgid());
+     328:	e8 46 14 00 00       	call   1773 <getgid>
+     32d:	83 ec 04             	sub    $0x4,%esp
+     330:	50                   	push   %eax
+     331:	68 c5 1d 00 00       	push   $0x1dc5
+     336:	6a 02                	push   $0x2
+     338:	e8 33 15 00 00       	call   1870 <printf>
+    return 0;
+     33d:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     340:	31 c0                	xor    %eax,%eax
+}
+     342:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     345:	c9                   	leave
+     346:	c3                   	ret
+    printf(2, "%d\n", getuid());
+     347:	e8 1f 14 00 00       	call   176b <getuid>
+     34c:	eb df                	jmp    32d <getbuiltin+0x9d>
+  printf(2, "Invalid _get parameter\n");
+     34e:	83 ec 08             	sub    $0x8,%esp
+     351:	68 c9 1d 00 00       	push   $0x1dc9
+     356:	6a 02                	push   $0x2
+     358:	e8 13 15 00 00       	call   1870 <printf>
+  return -1;
+     35d:	83 c4 10             	add    $0x10,%esp
+     360:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     365:	eb db                	jmp    342 <getbuiltin+0xb2>
+     367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36e:	66 90                	xchg   %ax,%ax
+
+00000370 <setbuiltin>:
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	57                   	push   %edi
+     374:	56                   	push   %esi
+     375:	53                   	push   %ebx
+     376:	83 ec 18             	sub    $0x18,%esp
+  p += strlen("_set");
+     379:	68 e1 1d 00 00       	push   $0x1de1
+     37e:	e8 9d 10 00 00       	call   1420 <strlen>
+     383:	03 45 08             	add    0x8(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+     386:	83 c4 10             	add    $0x10,%esp
+     389:	80 38 20             	cmpb   $0x20,(%eax)
+  p += strlen("_set");
+     38c:	89 c3                	mov    %eax,%ebx
+    while(n > 0 && *p && *p == *q)
+     38e:	75 08                	jne    398 <setbuiltin+0x28>
+  while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     390:	83 c3 01             	add    $0x1,%ebx
+    while(n > 0 && *p && *p == *q)
+     393:	80 3b 20             	cmpb   $0x20,(%ebx)
+     396:	74 f8                	je     390 <setbuiltin+0x20>
+{
+     398:	89 da                	mov    %ebx,%edx
+     39a:	b8 b8 1d 00 00       	mov    $0x1db8,%eax
+     39f:	eb 1c                	jmp    3bd <setbuiltin+0x4d>
+     3a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    while(n > 0 && *p && *p == *q)
+     3a8:	3a 0a                	cmp    (%edx),%cl
+     3aa:	75 18                	jne    3c4 <setbuiltin+0x54>
+      n--, p++, q++;
+     3ac:	83 c0 01             	add    $0x1,%eax
+     3af:	83 c2 01             	add    $0x1,%edx
+    while(n > 0 && *p && *p == *q)
+     3b2:	3d bb 1d 00 00       	cmp    $0x1dbb,%eax
+     3b7:	0f 84 8d 00 00 00    	je     44a <setbuiltin+0xda>
+     3bd:	0f b6 08             	movzbl (%eax),%ecx
+     3c0:	84 c9                	test   %cl,%cl
+     3c2:	75 e4                	jne    3a8 <setbuiltin+0x38>
+    if(n == 0)
+     3c4:	3d bb 1d 00 00       	cmp    $0x1dbb,%eax
+     3c9:	74 7f                	je     44a <setbuiltin+0xda>
+  if (strncmp("uid", p, 3) == 0) {
+     3cb:	0f b6 12             	movzbl (%edx),%edx
+     3ce:	89 de                	mov    %ebx,%esi
+     3d0:	b9 bc 1d 00 00       	mov    $0x1dbc,%ecx
+     3d5:	bf 03 00 00 00       	mov    $0x3,%edi
+     3da:	38 10                	cmp    %dl,(%eax)
+     3dc:	75 11                	jne    3ef <setbuiltin+0x7f>
+     3de:	eb 6a                	jmp    44a <setbuiltin+0xda>
+    while(n > 0 && *p && *p == *q)
+     3e0:	3a 06                	cmp    (%esi),%al
+     3e2:	75 12                	jne    3f6 <setbuiltin+0x86>
+      n--, p++, q++;
+     3e4:	83 c1 01             	add    $0x1,%ecx
+     3e7:	83 c6 01             	add    $0x1,%esi
+    while(n > 0 && *p && *p == *q)
+     3ea:	83 ef 01             	sub    $0x1,%edi
+     3ed:	74 12                	je     401 <setbuiltin+0x91>
+     3ef:	0f b6 01             	movzbl (%ecx),%eax
+     3f2:	84 c0                	test   %al,%al
+     3f4:	75 ea                	jne    3e0 <setbuiltin+0x70>
+  if (strncmp("gid", p, 3) == 0) {
+     3f6:	0f b6 06             	movzbl (%esi),%eax
+     3f9:	38 01                	cmp    %al,(%ecx)
+     3fb:	0f 85 87 00 00 00    	jne    488 <setbuiltin+0x118>
+    p += strlen("gid");
+     401:	83 ec 0c             	sub    $0xc,%esp
+     404:	68 bc 1d 00 00       	push   $0x1dbc
+     409:	e8 12 10 00 00       	call   1420 <strlen>
+    while(n > 0 && *p && *p == *q)
+     40e:	83 c4 10             	add    $0x10,%esp
+    p += strlen("gid");
+     411:	01 c3                	add    %eax,%ebx
+    while(n > 0 && *p && *p == *q)
+     413:	80 3b 20             	cmpb   $0x20,(%ebx)
+     416:	75 10                	jne    428 <setbuiltin+0xb8>
+     418:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41f:	90                   	nop
+    while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     420:	83 c3 01             	add    $0x1,%ebx
+    while(n > 0 && *p && *p == *q)
+     423:	80 3b 20             	cmpb   $0x20,(%ebx)
+     426:	74 f8                	je     420 <setbuiltin+0xb0>
+    i = atoi(p);
+     428:	83 ec 0c             	sub    $0xc,%esp
+     42b:	53                   	push   %ebx
+     42c:	e8 2f 11 00 00       	call   1560 <atoi>
+    rc = (setgid(i));
+     431:	89 04 24             	mov    %eax,(%esp)
+     434:	e8 52 13 00 00       	call   178b <setgid>
+    if (rc == 0)
+     439:	83 c4 10             	add    $0x10,%esp
+     43c:	85 c0                	test   %eax,%eax
+     43e:	75 48                	jne    488 <setbuiltin+0x118>
+}
+     440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+     443:	31 c0                	xor    %eax,%eax
+}
+     445:	5b                   	pop    %ebx
+     446:	5e                   	pop    %esi
+     447:	5f                   	pop    %edi
+     448:	5d                   	pop    %ebp
+     449:	c3                   	ret
+    p += strlen("uid");
+     44a:	83 ec 0c             	sub    $0xc,%esp
+     44d:	68 b8 1d 00 00       	push   $0x1db8
+     452:	e8 c9 0f 00 00       	call   1420 <strlen>
+    while(n > 0 && *p && *p == *q)
+     457:	83 c4 10             	add    $0x10,%esp
+    p += strlen("uid");
+     45a:	01 d8                	add    %ebx,%eax
+    while(n > 0 && *p && *p == *q)
+     45c:	80 38 20             	cmpb   $0x20,(%eax)
+     45f:	75 0f                	jne    470 <setbuiltin+0x100>
+     461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     468:	83 c0 01             	add    $0x1,%eax
+    while(n > 0 && *p && *p == *q)
+     46b:	80 38 20             	cmpb   $0x20,(%eax)
+     46e:	74 f8                	je     468 <setbuiltin+0xf8>
+    i = atoi(p);
+     470:	83 ec 0c             	sub    $0xc,%esp
+     473:	50                   	push   %eax
+     474:	e8 e7 10 00 00       	call   1560 <atoi>
+    rc = (setuid(i));
+     479:	89 04 24             	mov    %eax,(%esp)
+     47c:	e8 02 13 00 00       	call   1783 <setuid>
+    if (rc == 0)
+     481:	83 c4 10             	add    $0x10,%esp
+     484:	85 c0                	test   %eax,%eax
+     486:	74 b8                	je     440 <setbuiltin+0xd0>
+  printf(2, "Invalid _set parameter\n");
+     488:	83 ec 08             	sub    $0x8,%esp
+     48b:	68 e6 1d 00 00       	push   $0x1de6
+     490:	6a 02                	push   $0x2
+     492:	e8 d9 13 00 00       	call   1870 <printf>
+  return -1;
+     497:	83 c4 10             	add    $0x10,%esp
+}
+     49a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return -1;
+     49d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     4a2:	5b                   	pop    %ebx
+     4a3:	5e                   	pop    %esi
+     4a4:	5f                   	pop    %edi
+     4a5:	5d                   	pop    %ebp
+     4a6:	c3                   	ret
+     4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <getcmd>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	56                   	push   %esi
+     4b4:	53                   	push   %ebx
+     4b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     4bb:	83 ec 08             	sub    $0x8,%esp
+     4be:	68 fe 1d 00 00       	push   $0x1dfe
+     4c3:	6a 02                	push   $0x2
+     4c5:	e8 a6 13 00 00       	call   1870 <printf>
+  memset(buf, 0, nbuf);
+     4ca:	83 c4 0c             	add    $0xc,%esp
+     4cd:	56                   	push   %esi
+     4ce:	6a 00                	push   $0x0
+     4d0:	53                   	push   %ebx
+     4d1:	e8 7a 0f 00 00       	call   1450 <memset>
+  gets(buf, nbuf);
+     4d6:	58                   	pop    %eax
+     4d7:	5a                   	pop    %edx
+     4d8:	56                   	push   %esi
+     4d9:	53                   	push   %ebx
+     4da:	e8 d1 0f 00 00       	call   14b0 <gets>
+  if(buf[0] == 0) // EOF
+     4df:	83 c4 10             	add    $0x10,%esp
+     4e2:	80 3b 01             	cmpb   $0x1,(%ebx)
+     4e5:	19 c0                	sbb    %eax,%eax
+}
+     4e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4ea:	5b                   	pop    %ebx
+     4eb:	5e                   	pop    %esi
+     4ec:	5d                   	pop    %ebp
+     4ed:	c3                   	ret
+     4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <strncmp>:
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	53                   	push   %ebx
+     4f4:	8b 55 10             	mov    0x10(%ebp),%edx
+     4f7:	8b 45 08             	mov    0x8(%ebp),%eax
+     4fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    while(n > 0 && *p && *p == *q)
+     4fd:	85 d2                	test   %edx,%edx
+     4ff:	75 16                	jne    517 <strncmp+0x27>
+     501:	eb 2d                	jmp    530 <strncmp+0x40>
+     503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     507:	90                   	nop
+     508:	3a 19                	cmp    (%ecx),%bl
+     50a:	75 12                	jne    51e <strncmp+0x2e>
+      n--, p++, q++;
+     50c:	83 c0 01             	add    $0x1,%eax
+     50f:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+     512:	83 ea 01             	sub    $0x1,%edx
+     515:	74 19                	je     530 <strncmp+0x40>
+     517:	0f b6 18             	movzbl (%eax),%ebx
+     51a:	84 db                	test   %bl,%bl
+     51c:	75 ea                	jne    508 <strncmp+0x18>
+    return (uchar)*p - (uchar)*q;
+     51e:	0f b6 00             	movzbl (%eax),%eax
+     521:	0f b6 11             	movzbl (%ecx),%edx
+}
+     524:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     527:	c9                   	leave
+    return (uchar)*p - (uchar)*q;
+     528:	29 d0                	sub    %edx,%eax
+}
+     52a:	c3                   	ret
+     52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+     530:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return 0;
+     533:	31 c0                	xor    %eax,%eax
+}
+     535:	c9                   	leave
+     536:	c3                   	ret
+     537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53e:	66 90                	xchg   %ax,%ax
+
+00000540 <dobuiltin>:
+dobuiltin(char *cmd) {
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	57                   	push   %edi
+     544:	56                   	push   %esi
+     545:	53                   	push   %ebx
+     546:	83 ec 0c             	sub    $0xc,%esp
+  for (i=0; i<FDTcount; i++)
+     549:	a1 cc 27 00 00       	mov    0x27cc,%eax
+dobuiltin(char *cmd) {
+     54e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for (i=0; i<FDTcount; i++)
+     551:	85 c0                	test   %eax,%eax
+     553:	7e 53                	jle    5a8 <dobuiltin+0x68>
+     555:	31 f6                	xor    %esi,%esi
+    if (strncmp(cmd, fdt[i].cmd, strlen(fdt[i].cmd)) == 0)
+     557:	83 ec 0c             	sub    $0xc,%esp
+     55a:	ff 34 f5 d0 27 00 00 	push   0x27d0(,%esi,8)
+     561:	e8 ba 0e 00 00       	call   1420 <strlen>
+     566:	8b 0c f5 d0 27 00 00 	mov    0x27d0(,%esi,8),%ecx
+    while(n > 0 && *p && *p == *q)
+     56d:	83 c4 10             	add    $0x10,%esp
+     570:	89 fa                	mov    %edi,%edx
+     572:	85 c0                	test   %eax,%eax
+     574:	75 19                	jne    58f <dobuiltin+0x4f>
+     576:	eb 38                	jmp    5b0 <dobuiltin+0x70>
+     578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57f:	90                   	nop
+     580:	3a 19                	cmp    (%ecx),%bl
+     582:	75 12                	jne    596 <dobuiltin+0x56>
+      n--, p++, q++;
+     584:	83 c2 01             	add    $0x1,%edx
+     587:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+     58a:	83 e8 01             	sub    $0x1,%eax
+     58d:	74 21                	je     5b0 <dobuiltin+0x70>
+     58f:	0f b6 1a             	movzbl (%edx),%ebx
+     592:	84 db                	test   %bl,%bl
+     594:	75 ea                	jne    580 <dobuiltin+0x40>
+    if (strncmp(cmd, fdt[i].cmd, strlen(fdt[i].cmd)) == 0)
+     596:	0f b6 01             	movzbl (%ecx),%eax
+     599:	38 02                	cmp    %al,(%edx)
+     59b:	74 13                	je     5b0 <dobuiltin+0x70>
+  for (i=0; i<FDTcount; i++)
+     59d:	83 c6 01             	add    $0x1,%esi
+     5a0:	39 35 cc 27 00 00    	cmp    %esi,0x27cc
+     5a6:	7f af                	jg     557 <dobuiltin+0x17>
+}
+     5a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5ab:	5b                   	pop    %ebx
+     5ac:	5e                   	pop    %esi
+     5ad:	5f                   	pop    %edi
+     5ae:	5d                   	pop    %ebp
+     5af:	c3                   	ret
+     (*fdt[i].name)(cmd);
+     5b0:	83 ec 0c             	sub    $0xc,%esp
+     5b3:	57                   	push   %edi
+     5b4:	ff 14 f5 d4 27 00 00 	call   *0x27d4(,%esi,8)
+     5bb:	83 c4 10             	add    $0x10,%esp
+     5be:	eb dd                	jmp    59d <dobuiltin+0x5d>
+
+000005c0 <panic>:
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     5c6:	ff 75 08             	push   0x8(%ebp)
+     5c9:	68 9b 1e 00 00       	push   $0x1e9b
+     5ce:	6a 02                	push   $0x2
+     5d0:	e8 9b 12 00 00       	call   1870 <printf>
+  exit();
+     5d5:	e8 99 10 00 00       	call   1673 <exit>
+     5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005e0 <fork1>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     5e6:	e8 80 10 00 00       	call   166b <fork>
+  if(pid == -1)
+     5eb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     5ee:	74 02                	je     5f2 <fork1+0x12>
+}
+     5f0:	c9                   	leave
+     5f1:	c3                   	ret
+    panic("fork");
+     5f2:	83 ec 0c             	sub    $0xc,%esp
+     5f5:	68 01 1e 00 00       	push   $0x1e01
+     5fa:	e8 c1 ff ff ff       	call   5c0 <panic>
+     5ff:	90                   	nop
+
+00000600 <runcmd>:
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	53                   	push   %ebx
+     604:	83 ec 14             	sub    $0x14,%esp
+     607:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     60a:	85 db                	test   %ebx,%ebx
+     60c:	74 42                	je     650 <runcmd+0x50>
+  switch(cmd->type){
+     60e:	83 3b 05             	cmpl   $0x5,(%ebx)
+     611:	0f 87 e3 00 00 00    	ja     6fa <runcmd+0xfa>
+     617:	8b 03                	mov    (%ebx),%eax
+     619:	ff 24 85 cc 1e 00 00 	jmp    *0x1ecc(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     620:	8b 43 04             	mov    0x4(%ebx),%eax
+     623:	85 c0                	test   %eax,%eax
+     625:	74 29                	je     650 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     627:	8d 53 04             	lea    0x4(%ebx),%edx
+     62a:	51                   	push   %ecx
+     62b:	51                   	push   %ecx
+     62c:	52                   	push   %edx
+     62d:	50                   	push   %eax
+     62e:	e8 78 10 00 00       	call   16ab <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     633:	83 c4 0c             	add    $0xc,%esp
+     636:	ff 73 04             	push   0x4(%ebx)
+     639:	68 0d 1e 00 00       	push   $0x1e0d
+     63e:	6a 02                	push   $0x2
+     640:	e8 2b 12 00 00       	call   1870 <printf>
+    break;
+     645:	83 c4 10             	add    $0x10,%esp
+     648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+    exit();
+     650:	e8 1e 10 00 00       	call   1673 <exit>
+    if(fork1() == 0)
+     655:	e8 86 ff ff ff       	call   5e0 <fork1>
+     65a:	85 c0                	test   %eax,%eax
+     65c:	75 f2                	jne    650 <runcmd+0x50>
+     65e:	e9 8c 00 00 00       	jmp    6ef <runcmd+0xef>
+    if(pipe(p) < 0)
+     663:	83 ec 0c             	sub    $0xc,%esp
+     666:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     669:	50                   	push   %eax
+     66a:	e8 14 10 00 00       	call   1683 <pipe>
+     66f:	83 c4 10             	add    $0x10,%esp
+     672:	85 c0                	test   %eax,%eax
+     674:	0f 88 a2 00 00 00    	js     71c <runcmd+0x11c>
+    if(fork1() == 0){
+     67a:	e8 61 ff ff ff       	call   5e0 <fork1>
+     67f:	85 c0                	test   %eax,%eax
+     681:	0f 84 a2 00 00 00    	je     729 <runcmd+0x129>
+    if(fork1() == 0){
+     687:	e8 54 ff ff ff       	call   5e0 <fork1>
+     68c:	85 c0                	test   %eax,%eax
+     68e:	0f 84 c3 00 00 00    	je     757 <runcmd+0x157>
+    close(p[0]);
+     694:	83 ec 0c             	sub    $0xc,%esp
+     697:	ff 75 f0             	push   -0x10(%ebp)
+     69a:	e8 fc 0f 00 00       	call   169b <close>
+    close(p[1]);
+     69f:	58                   	pop    %eax
+     6a0:	ff 75 f4             	push   -0xc(%ebp)
+     6a3:	e8 f3 0f 00 00       	call   169b <close>
+    wait();
+     6a8:	e8 ce 0f 00 00       	call   167b <wait>
+    wait();
+     6ad:	e8 c9 0f 00 00       	call   167b <wait>
+    break;
+     6b2:	83 c4 10             	add    $0x10,%esp
+     6b5:	eb 99                	jmp    650 <runcmd+0x50>
+    if(fork1() == 0)
+     6b7:	e8 24 ff ff ff       	call   5e0 <fork1>
+     6bc:	85 c0                	test   %eax,%eax
+     6be:	74 2f                	je     6ef <runcmd+0xef>
+    wait();
+     6c0:	e8 b6 0f 00 00       	call   167b <wait>
+    runcmd(lcmd->right);
+     6c5:	83 ec 0c             	sub    $0xc,%esp
+     6c8:	ff 73 08             	push   0x8(%ebx)
+     6cb:	e8 30 ff ff ff       	call   600 <runcmd>
+    close(rcmd->fd);
+     6d0:	83 ec 0c             	sub    $0xc,%esp
+     6d3:	ff 73 14             	push   0x14(%ebx)
+     6d6:	e8 c0 0f 00 00       	call   169b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     6db:	58                   	pop    %eax
+     6dc:	5a                   	pop    %edx
+     6dd:	ff 73 10             	push   0x10(%ebx)
+     6e0:	ff 73 08             	push   0x8(%ebx)
+     6e3:	e8 cb 0f 00 00       	call   16b3 <open>
+     6e8:	83 c4 10             	add    $0x10,%esp
+     6eb:	85 c0                	test   %eax,%eax
+     6ed:	78 18                	js     707 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     6ef:	83 ec 0c             	sub    $0xc,%esp
+     6f2:	ff 73 04             	push   0x4(%ebx)
+     6f5:	e8 06 ff ff ff       	call   600 <runcmd>
+    panic("runcmd");
+     6fa:	83 ec 0c             	sub    $0xc,%esp
+     6fd:	68 06 1e 00 00       	push   $0x1e06
+     702:	e8 b9 fe ff ff       	call   5c0 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     707:	51                   	push   %ecx
+     708:	ff 73 08             	push   0x8(%ebx)
+     70b:	68 1d 1e 00 00       	push   $0x1e1d
+     710:	6a 02                	push   $0x2
+     712:	e8 59 11 00 00       	call   1870 <printf>
+      exit();
+     717:	e8 57 0f 00 00       	call   1673 <exit>
+      panic("pipe");
+     71c:	83 ec 0c             	sub    $0xc,%esp
+     71f:	68 2d 1e 00 00       	push   $0x1e2d
+     724:	e8 97 fe ff ff       	call   5c0 <panic>
+      close(1);
+     729:	83 ec 0c             	sub    $0xc,%esp
+     72c:	6a 01                	push   $0x1
+     72e:	e8 68 0f 00 00       	call   169b <close>
+      dup(p[1]);
+     733:	58                   	pop    %eax
+     734:	ff 75 f4             	push   -0xc(%ebp)
+     737:	e8 af 0f 00 00       	call   16eb <dup>
+      close(p[0]);
+     73c:	58                   	pop    %eax
+     73d:	ff 75 f0             	push   -0x10(%ebp)
+     740:	e8 56 0f 00 00       	call   169b <close>
+      close(p[1]);
+     745:	58                   	pop    %eax
+     746:	ff 75 f4             	push   -0xc(%ebp)
+     749:	e8 4d 0f 00 00       	call   169b <close>
+      runcmd(pcmd->left);
+     74e:	5a                   	pop    %edx
+     74f:	ff 73 04             	push   0x4(%ebx)
+     752:	e8 a9 fe ff ff       	call   600 <runcmd>
+      close(0);
+     757:	83 ec 0c             	sub    $0xc,%esp
+     75a:	6a 00                	push   $0x0
+     75c:	e8 3a 0f 00 00       	call   169b <close>
+      dup(p[0]);
+     761:	5a                   	pop    %edx
+     762:	ff 75 f0             	push   -0x10(%ebp)
+     765:	e8 81 0f 00 00       	call   16eb <dup>
+      close(p[0]);
+     76a:	59                   	pop    %ecx
+     76b:	ff 75 f0             	push   -0x10(%ebp)
+     76e:	e8 28 0f 00 00       	call   169b <close>
+      close(p[1]);
+     773:	58                   	pop    %eax
+     774:	ff 75 f4             	push   -0xc(%ebp)
+     777:	e8 1f 0f 00 00       	call   169b <close>
+      runcmd(pcmd->right);
+     77c:	58                   	pop    %eax
+     77d:	ff 73 08             	push   0x8(%ebx)
+     780:	e8 7b fe ff ff       	call   600 <runcmd>
+     785:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <execcmd>:
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	53                   	push   %ebx
+     794:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     797:	6a 54                	push   $0x54
+     799:	e8 52 14 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     79e:	83 c4 0c             	add    $0xc,%esp
+     7a1:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     7a3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     7a5:	6a 00                	push   $0x0
+     7a7:	50                   	push   %eax
+     7a8:	e8 a3 0c 00 00       	call   1450 <memset>
+  cmd->type = EXEC;
+     7ad:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+}
+     7b3:	89 d8                	mov    %ebx,%eax
+     7b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7b8:	c9                   	leave
+     7b9:	c3                   	ret
+     7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007c0 <redircmd>:
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	53                   	push   %ebx
+     7c4:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     7c7:	6a 18                	push   $0x18
+     7c9:	e8 22 14 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7ce:	83 c4 0c             	add    $0xc,%esp
+     7d1:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     7d3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     7d5:	6a 00                	push   $0x0
+     7d7:	50                   	push   %eax
+     7d8:	e8 73 0c 00 00       	call   1450 <memset>
+  cmd->cmd = subcmd;
+     7dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     7e0:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     7e6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     7e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7ec:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     7ef:	8b 45 10             	mov    0x10(%ebp),%eax
+     7f2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     7f5:	8b 45 14             	mov    0x14(%ebp),%eax
+     7f8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     7fb:	8b 45 18             	mov    0x18(%ebp),%eax
+     7fe:	89 43 14             	mov    %eax,0x14(%ebx)
+}
+     801:	89 d8                	mov    %ebx,%eax
+     803:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     806:	c9                   	leave
+     807:	c3                   	ret
+     808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+
+00000810 <pipecmd>:
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	53                   	push   %ebx
+     814:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     817:	6a 0c                	push   $0xc
+     819:	e8 d2 13 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     81e:	83 c4 0c             	add    $0xc,%esp
+     821:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     823:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     825:	6a 00                	push   $0x0
+     827:	50                   	push   %eax
+     828:	e8 23 0c 00 00       	call   1450 <memset>
+  cmd->left = left;
+     82d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     830:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     836:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     839:	8b 45 0c             	mov    0xc(%ebp),%eax
+     83c:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+     83f:	89 d8                	mov    %ebx,%eax
+     841:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     844:	c9                   	leave
+     845:	c3                   	ret
+     846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000850 <listcmd>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+     854:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     857:	6a 0c                	push   $0xc
+     859:	e8 92 13 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     85e:	83 c4 0c             	add    $0xc,%esp
+     861:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     863:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     865:	6a 00                	push   $0x0
+     867:	50                   	push   %eax
+     868:	e8 e3 0b 00 00       	call   1450 <memset>
+  cmd->left = left;
+     86d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     870:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     876:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     879:	8b 45 0c             	mov    0xc(%ebp),%eax
+     87c:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+     87f:	89 d8                	mov    %ebx,%eax
+     881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     884:	c9                   	leave
+     885:	c3                   	ret
+     886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000890 <backcmd>:
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	53                   	push   %ebx
+     894:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     897:	6a 08                	push   $0x8
+     899:	e8 52 13 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     89e:	83 c4 0c             	add    $0xc,%esp
+     8a1:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     8a3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     8a5:	6a 00                	push   $0x0
+     8a7:	50                   	push   %eax
+     8a8:	e8 a3 0b 00 00       	call   1450 <memset>
+  cmd->cmd = subcmd;
+     8ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     8b0:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     8b6:	89 43 04             	mov    %eax,0x4(%ebx)
+}
+     8b9:	89 d8                	mov    %ebx,%eax
+     8bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8be:	c9                   	leave
+     8bf:	c3                   	ret
+
+000008c0 <gettoken>:
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 0c             	sub    $0xc,%esp
+  s = *ps;
+     8c9:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     8cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     8cf:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     8d2:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     8d4:	39 df                	cmp    %ebx,%edi
+     8d6:	72 0f                	jb     8e7 <gettoken+0x27>
+     8d8:	eb 25                	jmp    8ff <gettoken+0x3f>
+     8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     8e0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     8e3:	39 fb                	cmp    %edi,%ebx
+     8e5:	74 18                	je     8ff <gettoken+0x3f>
+     8e7:	0f be 07             	movsbl (%edi),%eax
+     8ea:	83 ec 08             	sub    $0x8,%esp
+     8ed:	50                   	push   %eax
+     8ee:	68 c4 27 00 00       	push   $0x27c4
+     8f3:	e8 78 0b 00 00       	call   1470 <strchr>
+     8f8:	83 c4 10             	add    $0x10,%esp
+     8fb:	85 c0                	test   %eax,%eax
+     8fd:	75 e1                	jne    8e0 <gettoken+0x20>
+  if(q)
+     8ff:	85 f6                	test   %esi,%esi
+     901:	74 02                	je     905 <gettoken+0x45>
+    *q = s;
+     903:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     905:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     908:	3c 3c                	cmp    $0x3c,%al
+     90a:	0f 8f d0 00 00 00    	jg     9e0 <gettoken+0x120>
+     910:	3c 3a                	cmp    $0x3a,%al
+     912:	0f 8f bc 00 00 00    	jg     9d4 <gettoken+0x114>
+     918:	84 c0                	test   %al,%al
+     91a:	75 44                	jne    960 <gettoken+0xa0>
+     91c:	31 f6                	xor    %esi,%esi
+  if(eq)
+     91e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     921:	85 c9                	test   %ecx,%ecx
+     923:	74 05                	je     92a <gettoken+0x6a>
+    *eq = s;
+     925:	8b 45 14             	mov    0x14(%ebp),%eax
+     928:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     92a:	39 df                	cmp    %ebx,%edi
+     92c:	72 09                	jb     937 <gettoken+0x77>
+     92e:	eb 1f                	jmp    94f <gettoken+0x8f>
+    s++;
+     930:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     933:	39 fb                	cmp    %edi,%ebx
+     935:	74 18                	je     94f <gettoken+0x8f>
+     937:	0f be 07             	movsbl (%edi),%eax
+     93a:	83 ec 08             	sub    $0x8,%esp
+     93d:	50                   	push   %eax
+     93e:	68 c4 27 00 00       	push   $0x27c4
+     943:	e8 28 0b 00 00       	call   1470 <strchr>
+     948:	83 c4 10             	add    $0x10,%esp
+     94b:	85 c0                	test   %eax,%eax
+     94d:	75 e1                	jne    930 <gettoken+0x70>
+  *ps = s;
+     94f:	8b 45 08             	mov    0x8(%ebp),%eax
+     952:	89 38                	mov    %edi,(%eax)
+}
+     954:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     957:	89 f0                	mov    %esi,%eax
+     959:	5b                   	pop    %ebx
+     95a:	5e                   	pop    %esi
+     95b:	5f                   	pop    %edi
+     95c:	5d                   	pop    %ebp
+     95d:	c3                   	ret
+     95e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     960:	79 66                	jns    9c8 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     962:	39 df                	cmp    %ebx,%edi
+     964:	72 39                	jb     99f <gettoken+0xdf>
+  if(eq)
+     966:	8b 55 14             	mov    0x14(%ebp),%edx
+     969:	85 d2                	test   %edx,%edx
+     96b:	0f 84 b3 00 00 00    	je     a24 <gettoken+0x164>
+    *eq = s;
+     971:	8b 45 14             	mov    0x14(%ebp),%eax
+     974:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     976:	e9 a9 00 00 00       	jmp    a24 <gettoken+0x164>
+     97b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     97f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     980:	0f be 07             	movsbl (%edi),%eax
+     983:	83 ec 08             	sub    $0x8,%esp
+     986:	50                   	push   %eax
+     987:	68 bc 27 00 00       	push   $0x27bc
+     98c:	e8 df 0a 00 00       	call   1470 <strchr>
+     991:	83 c4 10             	add    $0x10,%esp
+     994:	85 c0                	test   %eax,%eax
+     996:	75 1f                	jne    9b7 <gettoken+0xf7>
+      s++;
+     998:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     99b:	39 fb                	cmp    %edi,%ebx
+     99d:	74 77                	je     a16 <gettoken+0x156>
+     99f:	0f be 07             	movsbl (%edi),%eax
+     9a2:	83 ec 08             	sub    $0x8,%esp
+     9a5:	50                   	push   %eax
+     9a6:	68 c4 27 00 00       	push   $0x27c4
+     9ab:	e8 c0 0a 00 00       	call   1470 <strchr>
+     9b0:	83 c4 10             	add    $0x10,%esp
+     9b3:	85 c0                	test   %eax,%eax
+     9b5:	74 c9                	je     980 <gettoken+0xc0>
+    ret = 'a';
+     9b7:	be 61 00 00 00       	mov    $0x61,%esi
+     9bc:	e9 5d ff ff ff       	jmp    91e <gettoken+0x5e>
+     9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     9c8:	3c 26                	cmp    $0x26,%al
+     9ca:	74 08                	je     9d4 <gettoken+0x114>
+     9cc:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     9cf:	80 f9 01             	cmp    $0x1,%cl
+     9d2:	77 8e                	ja     962 <gettoken+0xa2>
+  ret = *s;
+     9d4:	0f be f0             	movsbl %al,%esi
+    s++;
+     9d7:	83 c7 01             	add    $0x1,%edi
+    break;
+     9da:	e9 3f ff ff ff       	jmp    91e <gettoken+0x5e>
+     9df:	90                   	nop
+  switch(*s){
+     9e0:	3c 3e                	cmp    $0x3e,%al
+     9e2:	75 1c                	jne    a00 <gettoken+0x140>
+    if(*s == '>'){
+     9e4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     9e8:	74 1f                	je     a09 <gettoken+0x149>
+    s++;
+     9ea:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     9ed:	be 3e 00 00 00       	mov    $0x3e,%esi
+     9f2:	e9 27 ff ff ff       	jmp    91e <gettoken+0x5e>
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     a00:	3c 7c                	cmp    $0x7c,%al
+     a02:	74 d0                	je     9d4 <gettoken+0x114>
+     a04:	e9 59 ff ff ff       	jmp    962 <gettoken+0xa2>
+      s++;
+     a09:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     a0c:	be 2b 00 00 00       	mov    $0x2b,%esi
+     a11:	e9 08 ff ff ff       	jmp    91e <gettoken+0x5e>
+  if(eq)
+     a16:	8b 45 14             	mov    0x14(%ebp),%eax
+     a19:	85 c0                	test   %eax,%eax
+     a1b:	74 05                	je     a22 <gettoken+0x162>
+    *eq = s;
+     a1d:	8b 45 14             	mov    0x14(%ebp),%eax
+     a20:	89 18                	mov    %ebx,(%eax)
+      s++;
+     a22:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     a24:	be 61 00 00 00       	mov    $0x61,%esi
+     a29:	e9 21 ff ff ff       	jmp    94f <gettoken+0x8f>
+     a2e:	66 90                	xchg   %ax,%ax
+
+00000a30 <peek>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+     a35:	53                   	push   %ebx
+     a36:	83 ec 0c             	sub    $0xc,%esp
+     a39:	8b 7d 08             	mov    0x8(%ebp),%edi
+     a3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  s = *ps;
+     a3f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     a41:	39 f3                	cmp    %esi,%ebx
+     a43:	72 12                	jb     a57 <peek+0x27>
+     a45:	eb 28                	jmp    a6f <peek+0x3f>
+     a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4e:	66 90                	xchg   %ax,%ax
+    s++;
+     a50:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     a53:	39 de                	cmp    %ebx,%esi
+     a55:	74 18                	je     a6f <peek+0x3f>
+     a57:	0f be 03             	movsbl (%ebx),%eax
+     a5a:	83 ec 08             	sub    $0x8,%esp
+     a5d:	50                   	push   %eax
+     a5e:	68 c4 27 00 00       	push   $0x27c4
+     a63:	e8 08 0a 00 00       	call   1470 <strchr>
+     a68:	83 c4 10             	add    $0x10,%esp
+     a6b:	85 c0                	test   %eax,%eax
+     a6d:	75 e1                	jne    a50 <peek+0x20>
+  *ps = s;
+     a6f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     a71:	0f be 03             	movsbl (%ebx),%eax
+     a74:	31 d2                	xor    %edx,%edx
+     a76:	84 c0                	test   %al,%al
+     a78:	75 0e                	jne    a88 <peek+0x58>
+}
+     a7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a7d:	89 d0                	mov    %edx,%eax
+     a7f:	5b                   	pop    %ebx
+     a80:	5e                   	pop    %esi
+     a81:	5f                   	pop    %edi
+     a82:	5d                   	pop    %ebp
+     a83:	c3                   	ret
+     a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     a88:	83 ec 08             	sub    $0x8,%esp
+     a8b:	50                   	push   %eax
+     a8c:	ff 75 10             	push   0x10(%ebp)
+     a8f:	e8 dc 09 00 00       	call   1470 <strchr>
+     a94:	83 c4 10             	add    $0x10,%esp
+     a97:	31 d2                	xor    %edx,%edx
+     a99:	85 c0                	test   %eax,%eax
+     a9b:	0f 95 c2             	setne  %dl
+}
+     a9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aa1:	5b                   	pop    %ebx
+     aa2:	89 d0                	mov    %edx,%eax
+     aa4:	5e                   	pop    %esi
+     aa5:	5f                   	pop    %edi
+     aa6:	5d                   	pop    %ebp
+     aa7:	c3                   	ret
+     aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aaf:	90                   	nop
+
+00000ab0 <parseredirs>:
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	57                   	push   %edi
+     ab4:	56                   	push   %esi
+     ab5:	53                   	push   %ebx
+     ab6:	83 ec 2c             	sub    $0x2c,%esp
+     ab9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     abc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  while(peek(ps, es, "<>")){
+     abf:	90                   	nop
+     ac0:	83 ec 04             	sub    $0x4,%esp
+     ac3:	68 4f 1e 00 00       	push   $0x1e4f
+     ac8:	53                   	push   %ebx
+     ac9:	56                   	push   %esi
+     aca:	e8 61 ff ff ff       	call   a30 <peek>
+     acf:	83 c4 10             	add    $0x10,%esp
+     ad2:	85 c0                	test   %eax,%eax
+     ad4:	0f 84 f6 00 00 00    	je     bd0 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     ada:	6a 00                	push   $0x0
+     adc:	6a 00                	push   $0x0
+     ade:	53                   	push   %ebx
+     adf:	56                   	push   %esi
+     ae0:	e8 db fd ff ff       	call   8c0 <gettoken>
+     ae5:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     ae7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     aea:	50                   	push   %eax
+     aeb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     aee:	50                   	push   %eax
+     aef:	53                   	push   %ebx
+     af0:	56                   	push   %esi
+     af1:	e8 ca fd ff ff       	call   8c0 <gettoken>
+     af6:	83 c4 20             	add    $0x20,%esp
+     af9:	83 f8 61             	cmp    $0x61,%eax
+     afc:	0f 85 d9 00 00 00    	jne    bdb <parseredirs+0x12b>
+    switch(tok){
+     b02:	83 ff 3c             	cmp    $0x3c,%edi
+     b05:	74 69                	je     b70 <parseredirs+0xc0>
+     b07:	83 ff 3e             	cmp    $0x3e,%edi
+     b0a:	74 05                	je     b11 <parseredirs+0x61>
+     b0c:	83 ff 2b             	cmp    $0x2b,%edi
+     b0f:	75 af                	jne    ac0 <parseredirs+0x10>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     b11:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     b14:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     b17:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     b1a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     b1d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     b20:	6a 18                	push   $0x18
+     b22:	e8 c9 10 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b27:	83 c4 0c             	add    $0xc,%esp
+     b2a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     b2c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     b2e:	6a 00                	push   $0x0
+     b30:	50                   	push   %eax
+     b31:	e8 1a 09 00 00       	call   1450 <memset>
+  cmd->type = REDIR;
+     b36:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     b3c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     b3f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     b42:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     b45:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     b48:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     b4b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     b4e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     b55:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     b58:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     b5f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     b62:	e9 59 ff ff ff       	jmp    ac0 <parseredirs+0x10>
+     b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     b70:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     b73:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     b76:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     b79:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     b7c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     b7f:	6a 18                	push   $0x18
+     b81:	e8 6a 10 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b86:	83 c4 0c             	add    $0xc,%esp
+     b89:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     b8b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     b8d:	6a 00                	push   $0x0
+     b8f:	50                   	push   %eax
+     b90:	e8 bb 08 00 00       	call   1450 <memset>
+  cmd->cmd = subcmd;
+     b95:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     b98:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     b9b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     b9e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     ba1:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     ba7:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     baa:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     bad:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     bb0:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     bb3:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     bba:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     bc1:	e9 fa fe ff ff       	jmp    ac0 <parseredirs+0x10>
+     bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcd:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bd6:	5b                   	pop    %ebx
+     bd7:	5e                   	pop    %esi
+     bd8:	5f                   	pop    %edi
+     bd9:	5d                   	pop    %ebp
+     bda:	c3                   	ret
+      panic("missing file for redirection");
+     bdb:	83 ec 0c             	sub    $0xc,%esp
+     bde:	68 32 1e 00 00       	push   $0x1e32
+     be3:	e8 d8 f9 ff ff       	call   5c0 <panic>
+     be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <parseexec>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+     bf5:	53                   	push   %ebx
+     bf6:	83 ec 30             	sub    $0x30,%esp
+     bf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     bfc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(peek(ps, es, "("))
+     bff:	68 52 1e 00 00       	push   $0x1e52
+     c04:	56                   	push   %esi
+     c05:	53                   	push   %ebx
+     c06:	e8 25 fe ff ff       	call   a30 <peek>
+     c0b:	83 c4 10             	add    $0x10,%esp
+     c0e:	85 c0                	test   %eax,%eax
+     c10:	0f 85 aa 00 00 00    	jne    cc0 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     c16:	83 ec 0c             	sub    $0xc,%esp
+     c19:	89 c7                	mov    %eax,%edi
+     c1b:	6a 54                	push   $0x54
+     c1d:	e8 ce 0f 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     c22:	83 c4 0c             	add    $0xc,%esp
+     c25:	6a 54                	push   $0x54
+     c27:	6a 00                	push   $0x0
+     c29:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     c2c:	50                   	push   %eax
+     c2d:	e8 1e 08 00 00       	call   1450 <memset>
+  cmd->type = EXEC;
+     c32:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  ret = parseredirs(ret, ps, es);
+     c35:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     c38:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     c3e:	56                   	push   %esi
+     c3f:	53                   	push   %ebx
+     c40:	50                   	push   %eax
+     c41:	e8 6a fe ff ff       	call   ab0 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     c46:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     c49:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     c4c:	eb 15                	jmp    c63 <parseexec+0x73>
+     c4e:	66 90                	xchg   %ax,%ax
+    ret = parseredirs(ret, ps, es);
+     c50:	83 ec 04             	sub    $0x4,%esp
+     c53:	56                   	push   %esi
+     c54:	53                   	push   %ebx
+     c55:	ff 75 d4             	push   -0x2c(%ebp)
+     c58:	e8 53 fe ff ff       	call   ab0 <parseredirs>
+     c5d:	83 c4 10             	add    $0x10,%esp
+     c60:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     c63:	83 ec 04             	sub    $0x4,%esp
+     c66:	68 69 1e 00 00       	push   $0x1e69
+     c6b:	56                   	push   %esi
+     c6c:	53                   	push   %ebx
+     c6d:	e8 be fd ff ff       	call   a30 <peek>
+     c72:	83 c4 10             	add    $0x10,%esp
+     c75:	85 c0                	test   %eax,%eax
+     c77:	75 5f                	jne    cd8 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     c79:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     c7c:	50                   	push   %eax
+     c7d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c80:	50                   	push   %eax
+     c81:	56                   	push   %esi
+     c82:	53                   	push   %ebx
+     c83:	e8 38 fc ff ff       	call   8c0 <gettoken>
+     c88:	83 c4 10             	add    $0x10,%esp
+     c8b:	85 c0                	test   %eax,%eax
+     c8d:	74 49                	je     cd8 <parseexec+0xe8>
+    if(tok != 'a')
+     c8f:	83 f8 61             	cmp    $0x61,%eax
+     c92:	75 62                	jne    cf6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     c94:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     c97:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     c9a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     c9e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ca1:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     ca5:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     ca8:	83 ff 0a             	cmp    $0xa,%edi
+     cab:	75 a3                	jne    c50 <parseexec+0x60>
+      panic("too many args");
+     cad:	83 ec 0c             	sub    $0xc,%esp
+     cb0:	68 5b 1e 00 00       	push   $0x1e5b
+     cb5:	e8 06 f9 ff ff       	call   5c0 <panic>
+     cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     cc0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     cc3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     cc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc9:	5b                   	pop    %ebx
+     cca:	5e                   	pop    %esi
+     ccb:	5f                   	pop    %edi
+     ccc:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     ccd:	e9 ae 01 00 00       	jmp    e80 <parseblock>
+     cd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     cd8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     cdb:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     ce2:	00 
+  cmd->eargv[argc] = 0;
+     ce3:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     cea:	00 
+}
+     ceb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cf1:	5b                   	pop    %ebx
+     cf2:	5e                   	pop    %esi
+     cf3:	5f                   	pop    %edi
+     cf4:	5d                   	pop    %ebp
+     cf5:	c3                   	ret
+      panic("syntax");
+     cf6:	83 ec 0c             	sub    $0xc,%esp
+     cf9:	68 54 1e 00 00       	push   $0x1e54
+     cfe:	e8 bd f8 ff ff       	call   5c0 <panic>
+     d03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d10 <parsepipe>:
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	57                   	push   %edi
+     d14:	56                   	push   %esi
+     d15:	53                   	push   %ebx
+     d16:	83 ec 14             	sub    $0x14,%esp
+     d19:	8b 75 08             	mov    0x8(%ebp),%esi
+     d1c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     d1f:	57                   	push   %edi
+     d20:	56                   	push   %esi
+     d21:	e8 ca fe ff ff       	call   bf0 <parseexec>
+  if(peek(ps, es, "|")){
+     d26:	83 c4 0c             	add    $0xc,%esp
+     d29:	68 6e 1e 00 00       	push   $0x1e6e
+  cmd = parseexec(ps, es);
+     d2e:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     d30:	57                   	push   %edi
+     d31:	56                   	push   %esi
+     d32:	e8 f9 fc ff ff       	call   a30 <peek>
+     d37:	83 c4 10             	add    $0x10,%esp
+     d3a:	85 c0                	test   %eax,%eax
+     d3c:	75 12                	jne    d50 <parsepipe+0x40>
+}
+     d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d41:	89 d8                	mov    %ebx,%eax
+     d43:	5b                   	pop    %ebx
+     d44:	5e                   	pop    %esi
+     d45:	5f                   	pop    %edi
+     d46:	5d                   	pop    %ebp
+     d47:	c3                   	ret
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     d50:	6a 00                	push   $0x0
+     d52:	6a 00                	push   $0x0
+     d54:	57                   	push   %edi
+     d55:	56                   	push   %esi
+     d56:	e8 65 fb ff ff       	call   8c0 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     d5b:	58                   	pop    %eax
+     d5c:	5a                   	pop    %edx
+     d5d:	57                   	push   %edi
+     d5e:	56                   	push   %esi
+     d5f:	e8 ac ff ff ff       	call   d10 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     d64:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     d6b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     d6d:	e8 7e 0e 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     d72:	83 c4 0c             	add    $0xc,%esp
+     d75:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     d77:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     d79:	6a 00                	push   $0x0
+     d7b:	50                   	push   %eax
+     d7c:	e8 cf 06 00 00       	call   1450 <memset>
+  cmd->left = left;
+     d81:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     d84:	83 c4 10             	add    $0x10,%esp
+     d87:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     d89:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     d8f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     d91:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     d94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d97:	5b                   	pop    %ebx
+     d98:	5e                   	pop    %esi
+     d99:	5f                   	pop    %edi
+     d9a:	5d                   	pop    %ebp
+     d9b:	c3                   	ret
+     d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000da0 <parseline>:
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	57                   	push   %edi
+     da4:	56                   	push   %esi
+     da5:	53                   	push   %ebx
+     da6:	83 ec 24             	sub    $0x24,%esp
+     da9:	8b 75 08             	mov    0x8(%ebp),%esi
+     dac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     daf:	57                   	push   %edi
+     db0:	56                   	push   %esi
+     db1:	e8 5a ff ff ff       	call   d10 <parsepipe>
+  while(peek(ps, es, "&")){
+     db6:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     db9:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     dbb:	eb 3b                	jmp    df8 <parseline+0x58>
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     dc0:	6a 00                	push   $0x0
+     dc2:	6a 00                	push   $0x0
+     dc4:	57                   	push   %edi
+     dc5:	56                   	push   %esi
+     dc6:	e8 f5 fa ff ff       	call   8c0 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     dcb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     dd2:	e8 19 0e 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     dd7:	83 c4 0c             	add    $0xc,%esp
+     dda:	6a 08                	push   $0x8
+     ddc:	6a 00                	push   $0x0
+     dde:	50                   	push   %eax
+     ddf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     de2:	e8 69 06 00 00       	call   1450 <memset>
+  cmd->type = BACK;
+     de7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     dea:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     ded:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     df3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     df6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     df8:	83 ec 04             	sub    $0x4,%esp
+     dfb:	68 70 1e 00 00       	push   $0x1e70
+     e00:	57                   	push   %edi
+     e01:	56                   	push   %esi
+     e02:	e8 29 fc ff ff       	call   a30 <peek>
+     e07:	83 c4 10             	add    $0x10,%esp
+     e0a:	85 c0                	test   %eax,%eax
+     e0c:	75 b2                	jne    dc0 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     e0e:	83 ec 04             	sub    $0x4,%esp
+     e11:	68 6c 1e 00 00       	push   $0x1e6c
+     e16:	57                   	push   %edi
+     e17:	56                   	push   %esi
+     e18:	e8 13 fc ff ff       	call   a30 <peek>
+     e1d:	83 c4 10             	add    $0x10,%esp
+     e20:	85 c0                	test   %eax,%eax
+     e22:	75 0c                	jne    e30 <parseline+0x90>
+}
+     e24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e27:	89 d8                	mov    %ebx,%eax
+     e29:	5b                   	pop    %ebx
+     e2a:	5e                   	pop    %esi
+     e2b:	5f                   	pop    %edi
+     e2c:	5d                   	pop    %ebp
+     e2d:	c3                   	ret
+     e2e:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     e30:	6a 00                	push   $0x0
+     e32:	6a 00                	push   $0x0
+     e34:	57                   	push   %edi
+     e35:	56                   	push   %esi
+     e36:	e8 85 fa ff ff       	call   8c0 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     e3b:	58                   	pop    %eax
+     e3c:	5a                   	pop    %edx
+     e3d:	57                   	push   %edi
+     e3e:	56                   	push   %esi
+     e3f:	e8 5c ff ff ff       	call   da0 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     e44:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     e4b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     e4d:	e8 9e 0d 00 00       	call   1bf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     e52:	83 c4 0c             	add    $0xc,%esp
+     e55:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     e57:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     e59:	6a 00                	push   $0x0
+     e5b:	50                   	push   %eax
+     e5c:	e8 ef 05 00 00       	call   1450 <memset>
+  cmd->left = left;
+     e61:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     e64:	83 c4 10             	add    $0x10,%esp
+     e67:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     e69:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     e6f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     e71:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     e74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e77:	5b                   	pop    %ebx
+     e78:	5e                   	pop    %esi
+     e79:	5f                   	pop    %edi
+     e7a:	5d                   	pop    %ebp
+     e7b:	c3                   	ret
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <parseblock>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	57                   	push   %edi
+     e84:	56                   	push   %esi
+     e85:	53                   	push   %ebx
+     e86:	83 ec 10             	sub    $0x10,%esp
+     e89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e8c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     e8f:	68 52 1e 00 00       	push   $0x1e52
+     e94:	56                   	push   %esi
+     e95:	53                   	push   %ebx
+     e96:	e8 95 fb ff ff       	call   a30 <peek>
+     e9b:	83 c4 10             	add    $0x10,%esp
+     e9e:	85 c0                	test   %eax,%eax
+     ea0:	74 4a                	je     eec <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     ea2:	6a 00                	push   $0x0
+     ea4:	6a 00                	push   $0x0
+     ea6:	56                   	push   %esi
+     ea7:	53                   	push   %ebx
+     ea8:	e8 13 fa ff ff       	call   8c0 <gettoken>
+  cmd = parseline(ps, es);
+     ead:	58                   	pop    %eax
+     eae:	5a                   	pop    %edx
+     eaf:	56                   	push   %esi
+     eb0:	53                   	push   %ebx
+     eb1:	e8 ea fe ff ff       	call   da0 <parseline>
+  if(!peek(ps, es, ")"))
+     eb6:	83 c4 0c             	add    $0xc,%esp
+     eb9:	68 8e 1e 00 00       	push   $0x1e8e
+  cmd = parseline(ps, es);
+     ebe:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     ec0:	56                   	push   %esi
+     ec1:	53                   	push   %ebx
+     ec2:	e8 69 fb ff ff       	call   a30 <peek>
+     ec7:	83 c4 10             	add    $0x10,%esp
+     eca:	85 c0                	test   %eax,%eax
+     ecc:	74 2b                	je     ef9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     ece:	6a 00                	push   $0x0
+     ed0:	6a 00                	push   $0x0
+     ed2:	56                   	push   %esi
+     ed3:	53                   	push   %ebx
+     ed4:	e8 e7 f9 ff ff       	call   8c0 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     ed9:	83 c4 0c             	add    $0xc,%esp
+     edc:	56                   	push   %esi
+     edd:	53                   	push   %ebx
+     ede:	57                   	push   %edi
+     edf:	e8 cc fb ff ff       	call   ab0 <parseredirs>
+}
+     ee4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ee7:	5b                   	pop    %ebx
+     ee8:	5e                   	pop    %esi
+     ee9:	5f                   	pop    %edi
+     eea:	5d                   	pop    %ebp
+     eeb:	c3                   	ret
+    panic("parseblock");
+     eec:	83 ec 0c             	sub    $0xc,%esp
+     eef:	68 72 1e 00 00       	push   $0x1e72
+     ef4:	e8 c7 f6 ff ff       	call   5c0 <panic>
+    panic("syntax - missing )");
+     ef9:	83 ec 0c             	sub    $0xc,%esp
+     efc:	68 7d 1e 00 00       	push   $0x1e7d
+     f01:	e8 ba f6 ff ff       	call   5c0 <panic>
+     f06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f10 <nulterminate>:
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	53                   	push   %ebx
+     f14:	83 ec 04             	sub    $0x4,%esp
+     f17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     f1a:	85 db                	test   %ebx,%ebx
+     f1c:	0f 84 7e 00 00 00    	je     fa0 <nulterminate+0x90>
+  switch(cmd->type){
+     f22:	83 3b 05             	cmpl   $0x5,(%ebx)
+     f25:	77 20                	ja     f47 <nulterminate+0x37>
+     f27:	8b 03                	mov    (%ebx),%eax
+     f29:	ff 24 85 e4 1e 00 00 	jmp    *0x1ee4(,%eax,4)
+    nulterminate(lcmd->left);
+     f30:	83 ec 0c             	sub    $0xc,%esp
+     f33:	ff 73 04             	push   0x4(%ebx)
+     f36:	e8 d5 ff ff ff       	call   f10 <nulterminate>
+    nulterminate(lcmd->right);
+     f3b:	58                   	pop    %eax
+     f3c:	ff 73 08             	push   0x8(%ebx)
+     f3f:	e8 cc ff ff ff       	call   f10 <nulterminate>
+    break;
+     f44:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     f47:	89 d8                	mov    %ebx,%eax
+}
+     f49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f4c:	c9                   	leave
+     f4d:	c3                   	ret
+     f4e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     f50:	83 ec 0c             	sub    $0xc,%esp
+     f53:	ff 73 04             	push   0x4(%ebx)
+     f56:	e8 b5 ff ff ff       	call   f10 <nulterminate>
+    break;
+     f5b:	83 c4 10             	add    $0x10,%esp
+     f5e:	eb e7                	jmp    f47 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     f60:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     f63:	8d 43 08             	lea    0x8(%ebx),%eax
+     f66:	85 c9                	test   %ecx,%ecx
+     f68:	74 dd                	je     f47 <nulterminate+0x37>
+     f6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     f70:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     f73:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     f76:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     f79:	8b 50 fc             	mov    -0x4(%eax),%edx
+     f7c:	85 d2                	test   %edx,%edx
+     f7e:	75 f0                	jne    f70 <nulterminate+0x60>
+     f80:	eb c5                	jmp    f47 <nulterminate+0x37>
+     f82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     f88:	83 ec 0c             	sub    $0xc,%esp
+     f8b:	ff 73 04             	push   0x4(%ebx)
+     f8e:	e8 7d ff ff ff       	call   f10 <nulterminate>
+    *rcmd->efile = 0;
+     f93:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     f96:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     f99:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     f9c:	eb a9                	jmp    f47 <nulterminate+0x37>
+     f9e:	66 90                	xchg   %ax,%ax
+    return 0;
+     fa0:	31 c0                	xor    %eax,%eax
+     fa2:	eb a5                	jmp    f49 <nulterminate+0x39>
+     fa4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+
+00000fb0 <parsecmd>:
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	57                   	push   %edi
+     fb4:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     fb5:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     fb8:	53                   	push   %ebx
+     fb9:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     fbc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     fbf:	53                   	push   %ebx
+     fc0:	e8 5b 04 00 00       	call   1420 <strlen>
+  cmd = parseline(&s, es);
+     fc5:	59                   	pop    %ecx
+     fc6:	5e                   	pop    %esi
+  es = s + strlen(s);
+     fc7:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     fc9:	53                   	push   %ebx
+     fca:	57                   	push   %edi
+     fcb:	e8 d0 fd ff ff       	call   da0 <parseline>
+  peek(&s, es, "");
+     fd0:	83 c4 0c             	add    $0xc,%esp
+     fd3:	68 c8 1d 00 00       	push   $0x1dc8
+  cmd = parseline(&s, es);
+     fd8:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     fda:	53                   	push   %ebx
+     fdb:	57                   	push   %edi
+     fdc:	e8 4f fa ff ff       	call   a30 <peek>
+  if(s != es){
+     fe1:	8b 45 08             	mov    0x8(%ebp),%eax
+     fe4:	83 c4 10             	add    $0x10,%esp
+     fe7:	39 d8                	cmp    %ebx,%eax
+     fe9:	75 13                	jne    ffe <parsecmd+0x4e>
+  nulterminate(cmd);
+     feb:	83 ec 0c             	sub    $0xc,%esp
+     fee:	56                   	push   %esi
+     fef:	e8 1c ff ff ff       	call   f10 <nulterminate>
+}
+     ff4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ff7:	89 f0                	mov    %esi,%eax
+     ff9:	5b                   	pop    %ebx
+     ffa:	5e                   	pop    %esi
+     ffb:	5f                   	pop    %edi
+     ffc:	5d                   	pop    %ebp
+     ffd:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     ffe:	52                   	push   %edx
+     fff:	50                   	push   %eax
+    1000:	68 90 1e 00 00       	push   $0x1e90
+    1005:	6a 02                	push   $0x2
+    1007:	e8 64 08 00 00       	call   1870 <printf>
+    panic("syntax");
+    100c:	c7 04 24 54 1e 00 00 	movl   $0x1e54,(%esp)
+    1013:	e8 a8 f5 ff ff       	call   5c0 <panic>
+    1018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+
+00001020 <simpleline>:
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	57                   	push   %edi
+    1024:	56                   	push   %esi
+    1025:	53                   	push   %ebx
+    1026:	83 ec 0c             	sub    $0xc,%esp
+    1029:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(s = buf; *s; s++){
+    102c:	0f be 07             	movsbl (%edi),%eax
+    102f:	84 c0                	test   %al,%al
+    1031:	74 5a                	je     108d <simpleline+0x6d>
+  words = inword = 0;
+    1033:	31 db                	xor    %ebx,%ebx
+    1035:	31 f6                	xor    %esi,%esi
+    1037:	eb 29                	jmp    1062 <simpleline+0x42>
+    1039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(strchr(whitespace, *s)){
+    1040:	83 ec 08             	sub    $0x8,%esp
+    1043:	50                   	push   %eax
+    1044:	68 c4 27 00 00       	push   $0x27c4
+    1049:	e8 22 04 00 00       	call   1470 <strchr>
+    104e:	83 c4 10             	add    $0x10,%esp
+    1051:	85 c0                	test   %eax,%eax
+    1053:	74 4b                	je     10a0 <simpleline+0x80>
+      inword = 0;
+    1055:	31 db                	xor    %ebx,%ebx
+  for(s = buf; *s; s++){
+    1057:	0f be 47 01          	movsbl 0x1(%edi),%eax
+    105b:	83 c7 01             	add    $0x1,%edi
+    105e:	84 c0                	test   %al,%al
+    1060:	74 2b                	je     108d <simpleline+0x6d>
+    if(strchr("<>&;()", *s))
+    1062:	83 ec 08             	sub    $0x8,%esp
+    1065:	50                   	push   %eax
+    1066:	68 9f 1e 00 00       	push   $0x1e9f
+    106b:	e8 00 04 00 00       	call   1470 <strchr>
+    1070:	83 c4 10             	add    $0x10,%esp
+    1073:	85 c0                	test   %eax,%eax
+    1075:	75 41                	jne    10b8 <simpleline+0x98>
+    if(*s == '|'){
+    1077:	0f be 07             	movsbl (%edi),%eax
+    107a:	3c 7c                	cmp    $0x7c,%al
+    107c:	75 c2                	jne    1040 <simpleline+0x20>
+  for(s = buf; *s; s++){
+    107e:	0f be 47 01          	movsbl 0x1(%edi),%eax
+    1082:	83 c7 01             	add    $0x1,%edi
+      words = inword = 0;
+    1085:	31 db                	xor    %ebx,%ebx
+    1087:	31 f6                	xor    %esi,%esi
+  for(s = buf; *s; s++){
+    1089:	84 c0                	test   %al,%al
+    108b:	75 d5                	jne    1062 <simpleline+0x42>
+}
+    108d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 1;
+    1090:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    1095:	5b                   	pop    %ebx
+    1096:	5e                   	pop    %esi
+    1097:	5f                   	pop    %edi
+    1098:	5d                   	pop    %ebp
+    1099:	c3                   	ret
+    109a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(!inword){
+    10a0:	85 db                	test   %ebx,%ebx
+    10a2:	75 b3                	jne    1057 <simpleline+0x37>
+      if(++words >= MAXARGS)
+    10a4:	83 c6 01             	add    $0x1,%esi
+    10a7:	83 fe 09             	cmp    $0x9,%esi
+    10aa:	7f 0c                	jg     10b8 <simpleline+0x98>
+      inword = 1;
+    10ac:	bb 01 00 00 00       	mov    $0x1,%ebx
+    10b1:	eb a4                	jmp    1057 <simpleline+0x37>
+    10b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10b7:	90                   	nop
+}
+    10b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    10bb:	31 c0                	xor    %eax,%eax
+}
+    10bd:	5b                   	pop    %ebx
+    10be:	5e                   	pop    %esi
+    10bf:	5f                   	pop    %edi
+    10c0:	5d                   	pop    %ebp
+    10c1:	c3                   	ret
+    10c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000010d0 <spawnexec>:
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	83 ec 14             	sub    $0x14,%esp
+    10d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ecmd->argv[0] == 0)
+    10da:	8b 43 04             	mov    0x4(%ebx),%eax
+    10dd:	85 c0                	test   %eax,%eax
+    10df:	74 54                	je     1135 <spawnexec+0x65>
+  fds[0] = in;
+    10e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  fds[2] = 2;
+    10e4:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+  fds[0] = in;
+    10eb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  fds[1] = out;
+    10ee:	8b 55 10             	mov    0x10(%ebp),%edx
+    10f1:	89 55 f0             	mov    %edx,-0x10(%ebp)
+  if(spawn(ecmd->argv[0], ecmd->argv, fds, 3) < 0){
+    10f4:	8d 55 ec             	lea    -0x14(%ebp),%edx
+    10f7:	6a 03                	push   $0x3
+    10f9:	52                   	push   %edx
+    10fa:	8d 53 04             	lea    0x4(%ebx),%edx
+    10fd:	52                   	push   %edx
+    10fe:	50                   	push   %eax
+    10ff:	e8 27 06 00 00       	call   172b <spawn>
+    1104:	83 c4 10             	add    $0x10,%esp
+    1107:	89 c2                	mov    %eax,%edx
+  return 1;
+    1109:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(spawn(ecmd->argv[0], ecmd->argv, fds, 3) < 0){
+    110e:	85 d2                	test   %edx,%edx
+    1110:	78 0e                	js     1120 <spawnexec+0x50>
+}
+    1112:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1115:	c9                   	leave
+    1116:	c3                   	ret
+    1117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111e:	66 90                	xchg   %ax,%ax
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+    1120:	83 ec 04             	sub    $0x4,%esp
+    1123:	ff 73 04             	push   0x4(%ebx)
+    1126:	68 0d 1e 00 00       	push   $0x1e0d
+    112b:	6a 02                	push   $0x2
+    112d:	e8 3e 07 00 00       	call   1870 <printf>
+    return 0;
+    1132:	83 c4 10             	add    $0x10,%esp
+}
+    1135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+    1138:	31 c0                	xor    %eax,%eax
+}
+    113a:	c9                   	leave
+    113b:	c3                   	ret
+    113c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <spawncmd>:
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	56                   	push   %esi
+    1145:	53                   	push   %ebx
+    1146:	83 ec 3c             	sub    $0x3c,%esp
+    1149:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  while(cmd->type == PIPE){
+    114c:	8b 03                	mov    (%ebx),%eax
+    114e:	83 f8 03             	cmp    $0x3,%eax
+    1151:	0f 85 63 01 00 00    	jne    12ba <spawncmd+0x17a>
+  n = 0;
+    1157:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+  in = 0;
+    115e:	31 f6                	xor    %esi,%esi
+    1160:	eb 13                	jmp    1175 <spawncmd+0x35>
+    1162:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    cmd = pcmd->right;
+    1168:	8b 5b 08             	mov    0x8(%ebx),%ebx
+    in = p[0];
+    116b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  while(cmd->type == PIPE){
+    116e:	8b 03                	mov    (%ebx),%eax
+    1170:	83 f8 03             	cmp    $0x3,%eax
+    1173:	75 78                	jne    11ed <spawncmd+0xad>
+    if(pipe(p) < 0){
+    1175:	83 ec 0c             	sub    $0xc,%esp
+    1178:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    117b:	50                   	push   %eax
+    117c:	e8 02 05 00 00       	call   1683 <pipe>
+    1181:	83 c4 10             	add    $0x10,%esp
+    1184:	85 c0                	test   %eax,%eax
+    1186:	0f 88 c4 00 00 00    	js     1250 <spawncmd+0x110>
+    n += spawnexec((struct execcmd*)pcmd->left, in, p[1]);
+    118c:	8b 7b 04             	mov    0x4(%ebx),%edi
+    118f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  if(ecmd->argv[0] == 0)
+    1192:	8b 4f 04             	mov    0x4(%edi),%ecx
+    1195:	85 c9                	test   %ecx,%ecx
+    1197:	74 2b                	je     11c4 <spawncmd+0x84>
+  fds[1] = out;
+    1199:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(spawn(ecmd->argv[0], ecmd->argv, fds, 3) < 0){
+    119c:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  fds[0] = in;
+    119f:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  fds[2] = 2;
+    11a2:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%ebp)
+  if(spawn(ecmd->argv[0], ecmd->argv, fds, 3) < 0){
+    11a9:	6a 03                	push   $0x3
+    11ab:	50                   	push   %eax
+    11ac:	8d 47 04             	lea    0x4(%edi),%eax
+    11af:	50                   	push   %eax
+    11b0:	51                   	push   %ecx
+    11b1:	e8 75 05 00 00       	call   172b <spawn>
+    11b6:	83 c4 10             	add    $0x10,%esp
+    11b9:	85 c0                	test   %eax,%eax
+    11bb:	78 73                	js     1230 <spawncmd+0xf0>
+    n += spawnexec((struct execcmd*)pcmd->left, in, p[1]);
+    11bd:	83 45 c4 01          	addl   $0x1,-0x3c(%ebp)
+    close(p[1]);
+    11c1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    11c4:	83 ec 0c             	sub    $0xc,%esp
+    11c7:	50                   	push   %eax
+    11c8:	e8 ce 04 00 00       	call   169b <close>
+    if(in != 0)
+    11cd:	83 c4 10             	add    $0x10,%esp
+    11d0:	85 f6                	test   %esi,%esi
+    11d2:	74 94                	je     1168 <spawncmd+0x28>
+      close(in);
+    11d4:	83 ec 0c             	sub    $0xc,%esp
+    11d7:	56                   	push   %esi
+    11d8:	e8 be 04 00 00       	call   169b <close>
+    cmd = pcmd->right;
+    11dd:	8b 5b 08             	mov    0x8(%ebx),%ebx
+    in = p[0];
+    11e0:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      close(in);
+    11e3:	83 c4 10             	add    $0x10,%esp
+  while(cmd->type == PIPE){
+    11e6:	8b 03                	mov    (%ebx),%eax
+    11e8:	83 f8 03             	cmp    $0x3,%eax
+    11eb:	74 88                	je     1175 <spawncmd+0x35>
+  while(n-- > 0)
+    11ed:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    11f0:	8d 7a ff             	lea    -0x1(%edx),%edi
+  if(cmd->type == EXEC)
+    11f3:	83 f8 01             	cmp    $0x1,%eax
+    11f6:	74 77                	je     126f <spawncmd+0x12f>
+  if(in != 0)
+    11f8:	85 f6                	test   %esi,%esi
+    11fa:	74 0c                	je     1208 <spawncmd+0xc8>
+    close(in);
+    11fc:	83 ec 0c             	sub    $0xc,%esp
+    11ff:	56                   	push   %esi
+    1200:	e8 96 04 00 00       	call   169b <close>
+    1205:	83 c4 10             	add    $0x10,%esp
+  while(n-- > 0)
+    1208:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    120b:	85 c0                	test   %eax,%eax
+    120d:	74 0f                	je     121e <spawncmd+0xde>
+    120f:	90                   	nop
+    wait();
+    1210:	e8 66 04 00 00       	call   167b <wait>
+  while(n-- > 0)
+    1215:	89 f8                	mov    %edi,%eax
+    1217:	83 ef 01             	sub    $0x1,%edi
+    121a:	85 c0                	test   %eax,%eax
+    121c:	7f f2                	jg     1210 <spawncmd+0xd0>
+}
+    121e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1221:	5b                   	pop    %ebx
+    1222:	5e                   	pop    %esi
+    1223:	5f                   	pop    %edi
+    1224:	5d                   	pop    %ebp
+    1225:	c3                   	ret
+    1226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+    1230:	83 ec 04             	sub    $0x4,%esp
+    1233:	ff 77 04             	push   0x4(%edi)
+    1236:	68 0d 1e 00 00       	push   $0x1e0d
+    123b:	6a 02                	push   $0x2
+    123d:	e8 2e 06 00 00       	call   1870 <printf>
+    close(p[1]);
+    1242:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    return 0;
+    1245:	83 c4 10             	add    $0x10,%esp
+    1248:	e9 77 ff ff ff       	jmp    11c4 <spawncmd+0x84>
+    124d:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(2, "pipe failed\n");
+    1250:	83 ec 08             	sub    $0x8,%esp
+    1253:	68 a6 1e 00 00       	push   $0x1ea6
+    1258:	6a 02                	push   $0x2
+    125a:	e8 11 06 00 00       	call   1870 <printf>
+  while(n-- > 0)
+    125f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  if(cmd->type == EXEC)
+    1262:	8b 03                	mov    (%ebx),%eax
+      break;
+    1264:	83 c4 10             	add    $0x10,%esp
+  while(n-- > 0)
+    1267:	8d 7a ff             	lea    -0x1(%edx),%edi
+  if(cmd->type == EXEC)
+    126a:	83 f8 01             	cmp    $0x1,%eax
+    126d:	75 89                	jne    11f8 <spawncmd+0xb8>
+  if(ecmd->argv[0] == 0)
+    126f:	8b 43 04             	mov    0x4(%ebx),%eax
+    1272:	85 c0                	test   %eax,%eax
+    1274:	0f 84 7e ff ff ff    	je     11f8 <spawncmd+0xb8>
+  if(spawn(ecmd->argv[0], ecmd->argv, fds, 3) < 0){
+    127a:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+  fds[0] = in;
+    127d:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  fds[1] = out;
+    1280:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+  fds[2] = 2;
+    1287:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%ebp)
+  if(spawn(ecmd->argv[0], ecmd->argv, fds, 3) < 0){
+    128e:	6a 03                	push   $0x3
+    1290:	51                   	push   %ecx
+    1291:	8d 4b 04             	lea    0x4(%ebx),%ecx
+    1294:	51                   	push   %ecx
+    1295:	50                   	push   %eax
+    1296:	e8 90 04 00 00       	call   172b <spawn>
+    129b:	83 c4 10             	add    $0x10,%esp
+    129e:	85 c0                	test   %eax,%eax
+    12a0:	78 31                	js     12d3 <spawncmd+0x193>
+  if(in != 0)
+    12a2:	85 f6                	test   %esi,%esi
+    12a4:	74 0c                	je     12b2 <spawncmd+0x172>
+    close(in);
+    12a6:	83 ec 0c             	sub    $0xc,%esp
+    12a9:	56                   	push   %esi
+    12aa:	e8 ec 03 00 00       	call   169b <close>
+    12af:	83 c4 10             	add    $0x10,%esp
+  while(n-- > 0)
+    12b2:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+    12b5:	e9 56 ff ff ff       	jmp    1210 <spawncmd+0xd0>
+  if(cmd->type == EXEC)
+    12ba:	83 f8 01             	cmp    $0x1,%eax
+    12bd:	0f 85 5b ff ff ff    	jne    121e <spawncmd+0xde>
+  n = 0;
+    12c3:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+  if(cmd->type == EXEC)
+    12ca:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  in = 0;
+    12cf:	31 f6                	xor    %esi,%esi
+    12d1:	eb 9c                	jmp    126f <spawncmd+0x12f>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+    12d3:	83 ec 04             	sub    $0x4,%esp
+    12d6:	ff 73 04             	push   0x4(%ebx)
+    12d9:	68 0d 1e 00 00       	push   $0x1e0d
+    12de:	6a 02                	push   $0x2
+    12e0:	e8 8b 05 00 00       	call   1870 <printf>
+    return 0;
+    12e5:	83 c4 10             	add    $0x10,%esp
+    12e8:	e9 0b ff ff ff       	jmp    11f8 <spawncmd+0xb8>
+    12ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012f0 <freecmd>:
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	56                   	push   %esi
+    12f4:	53                   	push   %ebx
+    12f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd->type == PIPE){
+    12f8:	83 3b 03             	cmpl   $0x3,(%ebx)
+    12fb:	74 13                	je     1310 <freecmd+0x20>
+  free(cmd);
+    12fd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1300:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1303:	5b                   	pop    %ebx
+    1304:	5e                   	pop    %esi
+    1305:	5d                   	pop    %ebp
+  free(cmd);
+    1306:	e9 75 08 00 00       	jmp    1b80 <free>
+    130b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    130f:	90                   	nop
+    freecmd(((struct pipecmd*)cmd)->left);
+    1310:	8b 73 04             	mov    0x4(%ebx),%esi
+  if(cmd->type == PIPE){
+    1313:	83 3e 03             	cmpl   $0x3,(%esi)
+    1316:	74 58                	je     1370 <freecmd+0x80>
+  free(cmd);
+    1318:	83 ec 0c             	sub    $0xc,%esp
+    131b:	56                   	push   %esi
+    131c:	e8 5f 08 00 00       	call   1b80 <free>
+    freecmd(((struct pipecmd*)cmd)->right);
+    1321:	8b 73 08             	mov    0x8(%ebx),%esi
+  if(cmd->type == PIPE){
+    1324:	83 c4 10             	add    $0x10,%esp
+    1327:	83 3e 03             	cmpl   $0x3,(%esi)
+    132a:	74 24                	je     1350 <freecmd+0x60>
+  free(cmd);
+    132c:	83 ec 0c             	sub    $0xc,%esp
+    132f:	56                   	push   %esi
+    1330:	e8 4b 08 00 00       	call   1b80 <free>
+    1335:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1338:	83 c4 10             	add    $0x10,%esp
+    133b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    133e:	5b                   	pop    %ebx
+    133f:	5e                   	pop    %esi
+    1340:	5d                   	pop    %ebp
+  free(cmd);
+    1341:	e9 3a 08 00 00       	jmp    1b80 <free>
+    1346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+    freecmd(((struct pipecmd*)cmd)->left);
+    1350:	83 ec 0c             	sub    $0xc,%esp
+    1353:	ff 76 04             	push   0x4(%esi)
+    1356:	e8 95 ff ff ff       	call   12f0 <freecmd>
+    freecmd(((struct pipecmd*)cmd)->right);
+    135b:	58                   	pop    %eax
+    135c:	ff 76 08             	push   0x8(%esi)
+    135f:	e8 8c ff ff ff       	call   12f0 <freecmd>
+    1364:	83 c4 10             	add    $0x10,%esp
+    1367:	eb c3                	jmp    132c <freecmd+0x3c>
+    1369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    freecmd(((struct pipecmd*)cmd)->left);
+    1370:	83 ec 0c             	sub    $0xc,%esp
+    1373:	ff 76 04             	push   0x4(%esi)
+    1376:	e8 75 ff ff ff       	call   12f0 <freecmd>
+    freecmd(((struct pipecmd*)cmd)->right);
+    137b:	5a                   	pop    %edx
+    137c:	ff 76 08             	push   0x8(%esi)
+    137f:	e8 6c ff ff ff       	call   12f0 <freecmd>
+    1384:	83 c4 10             	add    $0x10,%esp
+    1387:	eb 8f                	jmp    1318 <freecmd+0x28>
+    1389:	66 90                	xchg   %ax,%ax
+    138b:	66 90                	xchg   %ax,%ax
+    138d:	66 90                	xchg   %ax,%ax
+    138f:	90                   	nop
+
+00001390 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    1390:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1391:	31 c0                	xor    %eax,%eax
+{
+    1393:	89 e5                	mov    %esp,%ebp
+    1395:	53                   	push   %ebx
+    1396:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1399:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    139c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    13a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    13a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    13a7:	83 c0 01             	add    $0x1,%eax
+    13aa:	84 d2                	test   %dl,%dl
+    13ac:	75 f2                	jne    13a0 <strcpy+0x10>
+    ;
+  return os;
+}
+    13ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13b1:	89 c8                	mov    %ecx,%eax
+    13b3:	c9                   	leave
+    13b4:	c3                   	ret
+    13b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	53                   	push   %ebx
+    13c4:	8b 55 08             	mov    0x8(%ebp),%edx
+    13c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    13ca:	0f b6 02             	movzbl (%edx),%eax
+    13cd:	84 c0                	test   %al,%al
+    13cf:	75 17                	jne    13e8 <strcmp+0x28>
+    13d1:	eb 3a                	jmp    140d <strcmp+0x4d>
+    13d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13d7:	90                   	nop
+    13d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    13dc:	83 c2 01             	add    $0x1,%edx
+    13df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    13e2:	84 c0                	test   %al,%al
+    13e4:	74 1a                	je     1400 <strcmp+0x40>
+    p++, q++;
+    13e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    13e8:	0f b6 19             	movzbl (%ecx),%ebx
+    13eb:	38 c3                	cmp    %al,%bl
+    13ed:	74 e9                	je     13d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    13ef:	29 d8                	sub    %ebx,%eax
+}
+    13f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13f4:	c9                   	leave
+    13f5:	c3                   	ret
+    13f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1400:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1404:	31 c0                	xor    %eax,%eax
+    1406:	29 d8                	sub    %ebx,%eax
+}
+    1408:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    140b:	c9                   	leave
+    140c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    140d:	0f b6 19             	movzbl (%ecx),%ebx
+    1410:	31 c0                	xor    %eax,%eax
+    1412:	eb db                	jmp    13ef <strcmp+0x2f>
+    1414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    141f:	90                   	nop
+
+00001420 <strlen>:
+
+uint
+strlen(char *s)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1426:	80 3a 00             	cmpb   $0x0,(%edx)
+    1429:	74 15                	je     1440 <strlen+0x20>
+    142b:	31 c0                	xor    %eax,%eax
+    142d:	8d 76 00             	lea    0x0(%esi),%esi
+    1430:	83 c0 01             	add    $0x1,%eax
+    1433:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1437:	89 c1                	mov    %eax,%ecx
+    1439:	75 f5                	jne    1430 <strlen+0x10>
+    ;
+  return n;
+}
+    143b:	89 c8                	mov    %ecx,%eax
+    143d:	5d                   	pop    %ebp
+    143e:	c3                   	ret
+    143f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1440:	31 c9                	xor    %ecx,%ecx
+}
+    1442:	5d                   	pop    %ebp
+    1443:	89 c8                	mov    %ecx,%eax
+    1445:	c3                   	ret
+    1446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001450 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1450:	55                   	push   %ebp
+    1451:	89 e5                	mov    %esp,%ebp
+    1453:	57                   	push   %edi
+    1454:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1457:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    145a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    145d:	89 d7                	mov    %edx,%edi
+    145f:	fc                   	cld
+    1460:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1462:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1465:	89 d0                	mov    %edx,%eax
+    1467:	c9                   	leave
+    1468:	c3                   	ret
+    1469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001470 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1470:	55                   	push   %ebp
+    1471:	89 e5                	mov    %esp,%ebp
+    1473:	8b 45 08             	mov    0x8(%ebp),%eax
+    1476:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    147a:	0f b6 10             	movzbl (%eax),%edx
+    147d:	84 d2                	test   %dl,%dl
+    147f:	75 12                	jne    1493 <strchr+0x23>
+    1481:	eb 1d                	jmp    14a0 <strchr+0x30>
+    1483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1487:	90                   	nop
+    1488:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    148c:	83 c0 01             	add    $0x1,%eax
+    148f:	84 d2                	test   %dl,%dl
+    1491:	74 0d                	je     14a0 <strchr+0x30>
+    if(*s == c)
+    1493:	38 d1                	cmp    %dl,%cl
+    1495:	75 f1                	jne    1488 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1497:	5d                   	pop    %ebp
+    1498:	c3                   	ret
+    1499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    14a0:	31 c0                	xor    %eax,%eax
+}
+    14a2:	5d                   	pop    %ebp
+    14a3:	c3                   	ret
+    14a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14af:	90                   	nop
+
+000014b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    14b0:	55                   	push   %ebp
+    14b1:	89 e5                	mov    %esp,%ebp
+    14b3:	57                   	push   %edi
+    14b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    14b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    14b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    14b9:	31 db                	xor    %ebx,%ebx
+{
+    14bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    14be:	eb 27                	jmp    14e7 <gets+0x37>
+    cc = read(0, &c, 1);
+    14c0:	83 ec 04             	sub    $0x4,%esp
+    14c3:	6a 01                	push   $0x1
+    14c5:	56                   	push   %esi
+    14c6:	6a 00                	push   $0x0
+    14c8:	e8 be 01 00 00       	call   168b <read>
+    if(cc < 1)
+    14cd:	83 c4 10             	add    $0x10,%esp
+    14d0:	85 c0                	test   %eax,%eax
+    14d2:	7e 1d                	jle    14f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    14d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    14d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    14db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    14df:	3c 0a                	cmp    $0xa,%al
+    14e1:	74 10                	je     14f3 <gets+0x43>
+    14e3:	3c 0d                	cmp    $0xd,%al
+    14e5:	74 0c                	je     14f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    14e7:	89 df                	mov    %ebx,%edi
+    14e9:	83 c3 01             	add    $0x1,%ebx
+    14ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    14ef:	7c cf                	jl     14c0 <gets+0x10>
+    14f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    14f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    14f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    14fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14fd:	5b                   	pop    %ebx
+    14fe:	5e                   	pop    %esi
+    14ff:	5f                   	pop    %edi
+    1500:	5d                   	pop    %ebp
+    1501:	c3                   	ret
+    1502:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001510 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	56                   	push   %esi
+    1514:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1515:	83 ec 08             	sub    $0x8,%esp
+    1518:	6a 00                	push   $0x0
+    151a:	ff 75 08             	push   0x8(%ebp)
+    151d:	e8 91 01 00 00       	call   16b3 <open>
+  if(fd < 0)
+    1522:	83 c4 10             	add    $0x10,%esp
+    1525:	85 c0                	test   %eax,%eax
+    1527:	78 27                	js     1550 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1529:	83 ec 08             	sub    $0x8,%esp
+    152c:	ff 75 0c             	push   0xc(%ebp)
+    152f:	89 c3                	mov    %eax,%ebx
+    1531:	50                   	push   %eax
+    1532:	e8 94 01 00 00       	call   16cb <fstat>
+  close(fd);
+    1537:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    153a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    153c:	e8 5a 01 00 00       	call   169b <close>
+  return r;
+    1541:	83 c4 10             	add    $0x10,%esp
+}
+    1544:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1547:	89 f0                	mov    %esi,%eax
+    1549:	5b                   	pop    %ebx
+    154a:	5e                   	pop    %esi
+    154b:	5d                   	pop    %ebp
+    154c:	c3                   	ret
+    154d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1550:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1555:	eb ed                	jmp    1544 <stat+0x34>
+    1557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    155e:	66 90                	xchg   %ax,%ax
+
+00001560 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+    1560:	55                   	push   %ebp
+    1561:	89 e5                	mov    %esp,%ebp
+    1563:	56                   	push   %esi
+    1564:	53                   	push   %ebx
+    1565:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    1568:	0f b6 02             	movzbl (%edx),%eax
+    156b:	3c 20                	cmp    $0x20,%al
+    156d:	75 0c                	jne    157b <atoi+0x1b>
+    156f:	90                   	nop
+    1570:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    1574:	83 c2 01             	add    $0x1,%edx
+    1577:	3c 20                	cmp    $0x20,%al
+    1579:	74 f5                	je     1570 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    157b:	3c 2d                	cmp    $0x2d,%al
+    157d:	74 41                	je     15c0 <atoi+0x60>
+    157f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    1584:	3c 2b                	cmp    $0x2b,%al
+    1586:	74 3d                	je     15c5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+    1588:	0f be 0a             	movsbl (%edx),%ecx
+    158b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    158e:	3c 09                	cmp    $0x9,%al
+    1590:	b8 00 00 00 00       	mov    $0x0,%eax
+    1595:	77 21                	ja     15b8 <atoi+0x58>
+    1597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    15a0:	83 c2 01             	add    $0x1,%edx
+    15a3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+    15a6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+    15aa:	0f be 0a             	movsbl (%edx),%ecx
+    15ad:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    15b0:	80 fb 09             	cmp    $0x9,%bl
+    15b3:	76 eb                	jbe    15a0 <atoi+0x40>
+  return sign*n;
+    15b5:	0f af c6             	imul   %esi,%eax
+}
+    15b8:	5b                   	pop    %ebx
+    15b9:	5e                   	pop    %esi
+    15ba:	5d                   	pop    %ebp
+    15bb:	c3                   	ret
+    15bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+    15c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    15c5:	83 c2 01             	add    $0x1,%edx
+    15c8:	eb be                	jmp    1588 <atoi+0x28>
+    15ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000015d0 <atoo>:
+
+int
+atoo(const char *s)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	56                   	push   %esi
+    15d4:	53                   	push   %ebx
+    15d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    15d8:	0f b6 02             	movzbl (%edx),%eax
+    15db:	3c 20                	cmp    $0x20,%al
+    15dd:	75 0c                	jne    15eb <atoo+0x1b>
+    15df:	90                   	nop
+    15e0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    15e4:	83 c2 01             	add    $0x1,%edx
+    15e7:	3c 20                	cmp    $0x20,%al
+    15e9:	74 f5                	je     15e0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    15eb:	3c 2d                	cmp    $0x2d,%al
+    15ed:	74 41                	je     1630 <atoo+0x60>
+    15ef:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    15f4:	3c 2b                	cmp    $0x2b,%al
+    15f6:	74 3d                	je     1635 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+    15f8:	0f be 0a             	movsbl (%edx),%ecx
+    15fb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    15fe:	3c 07                	cmp    $0x7,%al
+    1600:	b8 00 00 00 00       	mov    $0x0,%eax
+    1605:	77 1e                	ja     1625 <atoo+0x55>
+    1607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    160e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+    1610:	83 c2 01             	add    $0x1,%edx
+    1613:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+    1617:	0f be 0a             	movsbl (%edx),%ecx
+    161a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    161d:	80 fb 07             	cmp    $0x7,%bl
+    1620:	76 ee                	jbe    1610 <atoo+0x40>
+  return sign*n;
+    1622:	0f af c6             	imul   %esi,%eax
+}
+    1625:	5b                   	pop    %ebx
+    1626:	5e                   	pop    %esi
+    1627:	5d                   	pop    %ebp
+    1628:	c3                   	ret
+    1629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+    1630:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    1635:	83 c2 01             	add    $0x1,%edx
+    1638:	eb be                	jmp    15f8 <atoo+0x28>
+    163a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001640 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	57                   	push   %edi
+    1644:	56                   	push   %esi
+    1645:	8b 45 10             	mov    0x10(%ebp),%eax
+    1648:	8b 55 08             	mov    0x8(%ebp),%edx
+    164b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    164e:	85 c0                	test   %eax,%eax
+    1650:	7e 13                	jle    1665 <memmove+0x25>
+    1652:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1654:	89 d7                	mov    %edx,%edi
+    1656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1660:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1661:	39 f8                	cmp    %edi,%eax
+    1663:	75 fb                	jne    1660 <memmove+0x20>
+  return vdst;
+}
+    1665:	5e                   	pop    %esi
+    1666:	89 d0                	mov    %edx,%eax
+    1668:	5f                   	pop    %edi
+    1669:	5d                   	pop    %ebp
+    166a:	c3                   	ret
+
+0000166b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    166b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1670:	cd 40                	int    $0x40
+    1672:	c3                   	ret
+
+00001673 <exit>:
+SYSCALL(exit)
+    1673:	b8 02 00 00 00       	mov    $0x2,%eax
+    1678:	cd 40                	int    $0x40
+    167a:	c3                   	ret
+
+0000167b <wait>:
+SYSCALL(wait)
+    167b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1680:	cd 40                	int    $0x40
+    1682:	c3                   	ret
+
+00001683 <pipe>:
+SYSCALL(pipe)
+    1683:	b8 04 00 00 00       	mov    $0x4,%eax
+    1688:	cd 40                	int    $0x40
+    168a:	c3                   	ret
+
+0000168b <read>:
+SYSCALL(read)
+    168b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1690:	cd 40                	int    $0x40
+    1692:	c3                   	ret
+
+00001693 <write>:
+SYSCALL(write)
+    1693:	b8 10 00 00 00       	mov    $0x10,%eax
+    1698:	cd 40                	int    $0x40
+    169a:	c3                   	ret
+
+0000169b <close>:
+SYSCALL(close)
+    169b:	b8 15 00 00 00       	mov    $0x15,%eax
+    16a0:	cd 40                	int    $0x40
+    16a2:	c3                   	ret
+
+000016a3 <kill>:
+SYSCALL(kill)
+    16a3:	b8 06 00 00 00       	mov    $0x6,%eax
+    16a8:	cd 40                	int    $0x40
+    16aa:	c3                   	ret
+
+000016ab <exec>:
+SYSCALL(exec)
+    16ab:	b8 07 00 00 00       	mov    $0x7,%eax
+    16b0:	cd 40                	int    $0x40
+    16b2:	c3                   	ret
+
+000016b3 <open>:
+SYSCALL(open)
+    16b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    16b8:	cd 40                	int    $0x40
+    16ba:	c3                   	ret
+
+000016bb <mknod>:
+SYSCALL(mknod)
+    16bb:	b8 11 00 00 00       	mov    $0x11,%eax
+    16c0:	cd 40                	int    $0x40
+    16c2:	c3                   	ret
+
+000016c3 <unlink>:
+SYSCALL(unlink)
+    16c3:	b8 12 00 00 00       	mov    $0x12,%eax
+    16c8:	cd 40                	int    $0x40
+    16ca:	c3                   	ret
+
+000016cb <fstat>:
+SYSCALL(fstat)
+    16cb:	b8 08 00 00 00       	mov    $0x8,%eax
+    16d0:	cd 40                	int    $0x40
+    16d2:	c3                   	ret
+
+000016d3 <link>:
+SYSCALL(link)
+    16d3:	b8 13 00 00 00       	mov    $0x13,%eax
+    16d8:	cd 40                	int    $0x40
+    16da:	c3                   	ret
+
+000016db <mkdir>:
+SYSCALL(mkdir)
+    16db:	b8 14 00 00 00       	mov    $0x14,%eax
+    16e0:	cd 40                	int    $0x40
+    16e2:	c3                   	ret
+
+000016e3 <chdir>:
+SYSCALL(chdir)
+    16e3:	b8 09 00 00 00       	mov    $0x9,%eax
+    16e8:	cd 40                	int    $0x40
+    16ea:	c3                   	ret
+
+000016eb <dup>:
+SYSCALL(dup)
+    16eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    16f0:	cd 40                	int    $0x40
+    16f2:	c3                   	ret
+
+000016f3 <getpid>:
+SYSCALL(getpid)
+    16f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    16f8:	cd 40                	int    $0x40
+    16fa:	c3                   	ret
+
+000016fb <sbrk>:
+SYSCALL(sbrk)
+    16fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1700:	cd 40                	int    $0x40
+    1702:	c3                   	ret
+
+00001703 <sleep>:
+SYSCALL(sleep)
+    1703:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1708:	cd 40                	int    $0x40
+    170a:	c3                   	ret
+
+0000170b <uptime>:
+SYSCALL(uptime)
+    170b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1710:	cd 40                	int    $0x40
+    1712:	c3                   	ret
+
+00001713 <superpages>:
+SYSCALL(superpages)
+    1713:	b8 23 00 00 00       	mov    $0x23,%eax
+    1718:	cd 40                	int    $0x40
+    171a:	c3                   	ret
+
+0000171b <mmap>:
+SYSCALL(mmap)
+    171b:	b8 24 00 00 00       	mov    $0x24,%eax
+    1720:	cd 40                	int    $0x40
+    1722:	c3                   	ret
+
+00001723 <munmap>:
+SYSCALL(munmap)
+    1723:	b8 25 00 00 00       	mov    $0x25,%eax
+    1728:	cd 40                	int    $0x40
+    172a:	c3                   	ret
+
+0000172b <spawn>:
+SYSCALL(spawn)
+    172b:	b8 26 00 00 00       	mov    $0x26,%eax
+    1730:	cd 40                	int    $0x40
+    1732:	c3                   	ret
+
+00001733 <swapstat>:
+SYSCALL(swapstat)
+    1733:	b8 27 00 00 00       	mov    $0x27,%eax
+    1738:	cd 40                	int    $0x40
+    173a:	c3                   	ret
+
+0000173b <getmeminfo>:
+SYSCALL(getmeminfo)
+    173b:	b8 28 00 00 00       	mov    $0x28,%eax
+    1740:	cd 40                	int    $0x40
+    1742:	c3                   	ret
+
+00001743 <iostat>:
+SYSCALL(iostat)
+    1743:	b8 29 00 00 00       	mov    $0x29,%eax
+    1748:	cd 40                	int    $0x40
+    174a:	c3                   	ret
+
+0000174b <dropcache>:
+SYSCALL(dropcache)
+    174b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1750:	cd 40                	int    $0x40
+    1752:	c3                   	ret
+
+00001753 <iosched>:
+SYSCALL(iosched)
+    1753:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1758:	cd 40                	int    $0x40
+    175a:	c3                   	ret
+
+0000175b <halt>:
+SYSCALL(halt)
+    175b:	b8 16 00 00 00       	mov    $0x16,%eax
+    1760:	cd 40                	int    $0x40
+    1762:	c3                   	ret
+
+00001763 <date>:
+SYSCALL(date)
+    1763:	b8 17 00 00 00       	mov    $0x17,%eax
+    1768:	cd 40                	int    $0x40
+    176a:	c3                   	ret
+
+0000176b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+    176b:	b8 18 00 00 00       	mov    $0x18,%eax
+    1770:	cd 40                	int    $0x40
+    1772:	c3                   	ret
+
+00001773 <getgid>:
+SYSCALL(getgid)
+    1773:	b8 19 00 00 00       	mov    $0x19,%eax
+    1778:	cd 40                	int    $0x40
+    177a:	c3                   	ret
+
+0000177b <getppid>:
+SYSCALL(getppid)
+    177b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1780:	cd 40                	int    $0x40
+    1782:	c3                   	ret
+
+00001783 <setuid>:
+SYSCALL(setuid)
+    1783:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1788:	cd 40                	int    $0x40
+    178a:	c3                   	ret
+
+0000178b <setgid>:
+SYSCALL(setgid)
+    178b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1790:	cd 40                	int    $0x40
+    1792:	c3                   	ret
+
+00001793 <getprocs>:
+SYSCALL(getprocs)
+    1793:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1798:	cd 40                	int    $0x40
+    179a:	c3                   	ret
+
+0000179b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+    179b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    17a0:	cd 40                	int    $0x40
+    17a2:	c3                   	ret
+
+000017a3 <getpriority>:
+SYSCALL(getpriority)
+    17a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    17a8:	cd 40                	int    $0x40
+    17aa:	c3                   	ret
+
+000017ab <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+    17ab:	b8 20 00 00 00       	mov    $0x20,%eax
+    17b0:	cd 40                	int    $0x40
+    17b2:	c3                   	ret
+
+000017b3 <chown>:
+SYSCALL(chown)
+    17b3:	b8 21 00 00 00       	mov    $0x21,%eax
+    17b8:	cd 40                	int    $0x40
+    17ba:	c3                   	ret
+
+000017bb <chgrp>:
+SYSCALL(chgrp)
+    17bb:	b8 22 00 00 00       	mov    $0x22,%eax
+    17c0:	cd 40                	int    $0x40
+    17c2:	c3                   	ret
+    17c3:	66 90                	xchg   %ax,%ax
+    17c5:	66 90                	xchg   %ax,%ax
+    17c7:	66 90                	xchg   %ax,%ax
+    17c9:	66 90                	xchg   %ax,%ax
+    17cb:	66 90                	xchg   %ax,%ax
+    17cd:	66 90                	xchg   %ax,%ax
+    17cf:	90                   	nop
+
+000017d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    17d0:	55                   	push   %ebp
+    17d1:	89 e5                	mov    %esp,%ebp
+    17d3:	57                   	push   %edi
+    17d4:	56                   	push   %esi
+    17d5:	53                   	push   %ebx
+    17d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    17d8:	89 d1                	mov    %edx,%ecx
+{
+    17da:	83 ec 3c             	sub    $0x3c,%esp
+    17dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    17e0:	85 d2                	test   %edx,%edx
+    17e2:	0f 89 80 00 00 00    	jns    1868 <printint+0x98>
+    17e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    17ec:	74 7a                	je     1868 <printint+0x98>
+    x = -xx;
+    17ee:	f7 d9                	neg    %ecx
+    neg = 1;
+    17f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    17f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    17f8:	31 f6                	xor    %esi,%esi
+    17fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1800:	89 c8                	mov    %ecx,%eax
+    1802:	31 d2                	xor    %edx,%edx
+    1804:	89 f7                	mov    %esi,%edi
+    1806:	f7 f3                	div    %ebx
+    1808:	8d 76 01             	lea    0x1(%esi),%esi
+    180b:	0f b6 92 5c 1f 00 00 	movzbl 0x1f5c(%edx),%edx
+    1812:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1816:	89 ca                	mov    %ecx,%edx
+    1818:	89 c1                	mov    %eax,%ecx
+    181a:	39 da                	cmp    %ebx,%edx
+    181c:	73 e2                	jae    1800 <printint+0x30>
+  if(neg)
+    181e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1821:	85 c0                	test   %eax,%eax
+    1823:	74 07                	je     182c <printint+0x5c>
+    buf[i++] = '-';
+    1825:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    182a:	89 f7                	mov    %esi,%edi
+    182c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    182f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1832:	01 df                	add    %ebx,%edi
+    1834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1838:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    183b:	83 ec 04             	sub    $0x4,%esp
+    183e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1841:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1844:	6a 01                	push   $0x1
+    1846:	50                   	push   %eax
+    1847:	56                   	push   %esi
+    1848:	e8 46 fe ff ff       	call   1693 <write>
+  while(--i >= 0)
+    184d:	89 f8                	mov    %edi,%eax
+    184f:	83 c4 10             	add    $0x10,%esp
+    1852:	83 ef 01             	sub    $0x1,%edi
+    1855:	39 d8                	cmp    %ebx,%eax
+    1857:	75 df                	jne    1838 <printint+0x68>
+}
+    1859:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    185c:	5b                   	pop    %ebx
+    185d:	5e                   	pop    %esi
+    185e:	5f                   	pop    %edi
+    185f:	5d                   	pop    %ebp
+    1860:	c3                   	ret
+    1861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1868:	31 c0                	xor    %eax,%eax
+    186a:	eb 89                	jmp    17f5 <printint+0x25>
+    186c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001870 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1870:	55                   	push   %ebp
+    1871:	89 e5                	mov    %esp,%ebp
+    1873:	57                   	push   %edi
+    1874:	56                   	push   %esi
+    1875:	53                   	push   %ebx
+    1876:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1879:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    187c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    187f:	0f b6 1e             	movzbl (%esi),%ebx
+    1882:	83 c6 01             	add    $0x1,%esi
+    1885:	84 db                	test   %bl,%bl
+    1887:	74 67                	je     18f0 <printf+0x80>
+    1889:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    188c:	31 d2                	xor    %edx,%edx
+    188e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1891:	eb 34                	jmp    18c7 <printf+0x57>
+    1893:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1897:	90                   	nop
+    1898:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    189b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    18a0:	83 f8 25             	cmp    $0x25,%eax
+    18a3:	74 18                	je     18bd <printf+0x4d>
+  write(fd, &c, 1);
+    18a5:	83 ec 04             	sub    $0x4,%esp
+    18a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    18ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    18ae:	6a 01                	push   $0x1
+    18b0:	50                   	push   %eax
+    18b1:	57                   	push   %edi
+    18b2:	e8 dc fd ff ff       	call   1693 <write>
+    18b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    18ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    18bd:	0f b6 1e             	movzbl (%esi),%ebx
+    18c0:	83 c6 01             	add    $0x1,%esi
+    18c3:	84 db                	test   %bl,%bl
+    18c5:	74 29                	je     18f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    18c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    18ca:	85 d2                	test   %edx,%edx
+    18cc:	74 ca                	je     1898 <printf+0x28>
+      }
+    } else if(state == '%'){
+    18ce:	83 fa 25             	cmp    $0x25,%edx
+    18d1:	75 ea                	jne    18bd <printf+0x4d>
+      if(c == 'd'){
+    18d3:	83 f8 25             	cmp    $0x25,%eax
+    18d6:	0f 84 24 01 00 00    	je     1a00 <printf+0x190>
+    18dc:	83 e8 63             	sub    $0x63,%eax
+    18df:	83 f8 15             	cmp    $0x15,%eax
+    18e2:	77 1c                	ja     1900 <printf+0x90>
+    18e4:	ff 24 85 04 1f 00 00 	jmp    *0x1f04(,%eax,4)
+    18eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    18f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18f3:	5b                   	pop    %ebx
+    18f4:	5e                   	pop    %esi
+    18f5:	5f                   	pop    %edi
+    18f6:	5d                   	pop    %ebp
+    18f7:	c3                   	ret
+    18f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ff:	90                   	nop
+  write(fd, &c, 1);
+    1900:	83 ec 04             	sub    $0x4,%esp
+    1903:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1906:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    190a:	6a 01                	push   $0x1
+    190c:	52                   	push   %edx
+    190d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1910:	57                   	push   %edi
+    1911:	e8 7d fd ff ff       	call   1693 <write>
+    1916:	83 c4 0c             	add    $0xc,%esp
+    1919:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    191c:	6a 01                	push   $0x1
+    191e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1921:	52                   	push   %edx
+    1922:	57                   	push   %edi
+    1923:	e8 6b fd ff ff       	call   1693 <write>
+        putc(fd, c);
+    1928:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    192b:	31 d2                	xor    %edx,%edx
+    192d:	eb 8e                	jmp    18bd <printf+0x4d>
+    192f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1930:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1933:	83 ec 0c             	sub    $0xc,%esp
+    1936:	b9 10 00 00 00       	mov    $0x10,%ecx
+    193b:	8b 13                	mov    (%ebx),%edx
+    193d:	6a 00                	push   $0x0
+    193f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1941:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1944:	e8 87 fe ff ff       	call   17d0 <printint>
+        ap++;
+    1949:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    194c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    194f:	31 d2                	xor    %edx,%edx
+    1951:	e9 67 ff ff ff       	jmp    18bd <printf+0x4d>
+    1956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    195d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1960:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1963:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1965:	83 c0 04             	add    $0x4,%eax
+    1968:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    196b:	85 db                	test   %ebx,%ebx
+    196d:	0f 84 9d 00 00 00    	je     1a10 <printf+0x1a0>
+        while(*s != 0){
+    1973:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1976:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1978:	84 c0                	test   %al,%al
+    197a:	0f 84 3d ff ff ff    	je     18bd <printf+0x4d>
+    1980:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1983:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1986:	89 de                	mov    %ebx,%esi
+    1988:	89 d3                	mov    %edx,%ebx
+    198a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1990:	83 ec 04             	sub    $0x4,%esp
+    1993:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1996:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1999:	6a 01                	push   $0x1
+    199b:	53                   	push   %ebx
+    199c:	57                   	push   %edi
+    199d:	e8 f1 fc ff ff       	call   1693 <write>
+        while(*s != 0){
+    19a2:	0f b6 06             	movzbl (%esi),%eax
+    19a5:	83 c4 10             	add    $0x10,%esp
+    19a8:	84 c0                	test   %al,%al
+    19aa:	75 e4                	jne    1990 <printf+0x120>
+      state = 0;
+    19ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    19af:	31 d2                	xor    %edx,%edx
+    19b1:	e9 07 ff ff ff       	jmp    18bd <printf+0x4d>
+    19b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    19c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    19c3:	83 ec 0c             	sub    $0xc,%esp
+    19c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    19cb:	8b 13                	mov    (%ebx),%edx
+    19cd:	6a 01                	push   $0x1
+    19cf:	e9 6b ff ff ff       	jmp    193f <printf+0xcf>
+    19d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    19d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    19db:	83 ec 04             	sub    $0x4,%esp
+    19de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    19e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    19e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    19e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    19e9:	6a 01                	push   $0x1
+    19eb:	52                   	push   %edx
+    19ec:	57                   	push   %edi
+    19ed:	e8 a1 fc ff ff       	call   1693 <write>
+        ap++;
+    19f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    19f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    19f8:	31 d2                	xor    %edx,%edx
+    19fa:	e9 be fe ff ff       	jmp    18bd <printf+0x4d>
+    19ff:	90                   	nop
+  write(fd, &c, 1);
+    1a00:	83 ec 04             	sub    $0x4,%esp
+    1a03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1a06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1a09:	6a 01                	push   $0x1
+    1a0b:	e9 11 ff ff ff       	jmp    1921 <printf+0xb1>
+    1a10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1a15:	bb fc 1e 00 00       	mov    $0x1efc,%ebx
+    1a1a:	e9 61 ff ff ff       	jmp    1980 <printf+0x110>
+    1a1f:	90                   	nop
+
+00001a20 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+    1a20:	55                   	push   %ebp
+    1a21:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1a23:	a1 84 28 00 00       	mov    0x2884,%eax
+{
+    1a28:	89 e5                	mov    %esp,%ebp
+    1a2a:	56                   	push   %esi
+    1a2b:	53                   	push   %ebx
+    1a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1a30:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1a32:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1a34:	39 ca                	cmp    %ecx,%edx
+    1a36:	73 30                	jae    1a68 <lfree+0x48>
+    1a38:	39 c1                	cmp    %eax,%ecx
+    1a3a:	72 04                	jb     1a40 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1a3c:	39 c2                	cmp    %eax,%edx
+    1a3e:	72 f0                	jb     1a30 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1a40:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1a43:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    1a46:	39 f0                	cmp    %esi,%eax
+    1a48:	74 26                	je     1a70 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1a4a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1a4c:	8b 42 04             	mov    0x4(%edx),%eax
+    1a4f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    1a52:	39 d9                	cmp    %ebx,%ecx
+    1a54:	74 30                	je     1a86 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1a56:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1a58:	5b                   	pop    %ebx
+  freep = p;
+    1a59:	89 15 84 28 00 00    	mov    %edx,0x2884
+}
+    1a5f:	5e                   	pop    %esi
+    1a60:	5d                   	pop    %ebp
+    1a61:	c3                   	ret
+    1a62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1a68:	39 c1                	cmp    %eax,%ecx
+    1a6a:	72 d0                	jb     1a3c <lfree+0x1c>
+    1a6c:	eb c2                	jmp    1a30 <lfree+0x10>
+    1a6e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1a70:	03 58 04             	add    0x4(%eax),%ebx
+    1a73:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1a76:	8b 02                	mov    (%edx),%eax
+    1a78:	8b 00                	mov    (%eax),%eax
+    1a7a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+    1a7c:	8b 42 04             	mov    0x4(%edx),%eax
+    1a7f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    1a82:	39 d9                	cmp    %ebx,%ecx
+    1a84:	75 d0                	jne    1a56 <lfree+0x36>
+    p->s.size += bp->s.size;
+    1a86:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+    1a89:	89 15 84 28 00 00    	mov    %edx,0x2884
+    p->s.size += bp->s.size;
+    1a8f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1a92:	8b 09                	mov    (%ecx),%ecx
+    1a94:	89 0a                	mov    %ecx,(%edx)
+}
+    1a96:	5b                   	pop    %ebx
+    1a97:	5e                   	pop    %esi
+    1a98:	5d                   	pop    %ebp
+    1a99:	c3                   	ret
+    1a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001aa0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+    1aa0:	55                   	push   %ebp
+    1aa1:	89 e5                	mov    %esp,%ebp
+    1aa3:	57                   	push   %edi
+    1aa4:	89 c7                	mov    %eax,%edi
+    1aa6:	56                   	push   %esi
+    1aa7:	53                   	push   %ebx
+    1aa8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    1aab:	a1 84 28 00 00       	mov    0x2884,%eax
+    1ab0:	85 c0                	test   %eax,%eax
+    1ab2:	0f 84 88 00 00 00    	je     1b40 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1ab8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    1aba:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+    1abd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1ac2:	39 df                	cmp    %ebx,%edi
+    1ac4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1ac7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+    1ace:	39 f9                	cmp    %edi,%ecx
+    1ad0:	72 0f                	jb     1ae1 <lalloc+0x41>
+    1ad2:	eb 4c                	jmp    1b20 <lalloc+0x80>
+    1ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1ad8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    1ada:	8b 4a 04             	mov    0x4(%edx),%ecx
+    1add:	39 f9                	cmp    %edi,%ecx
+    1adf:	73 3f                	jae    1b20 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    1ae1:	89 d0                	mov    %edx,%eax
+    1ae3:	39 15 84 28 00 00    	cmp    %edx,0x2884
+    1ae9:	75 ed                	jne    1ad8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    1aeb:	83 ec 0c             	sub    $0xc,%esp
+    1aee:	56                   	push   %esi
+    1aef:	e8 07 fc ff ff       	call   16fb <sbrk>
+  if(p == (char*)-1)
+    1af4:	83 c4 10             	add    $0x10,%esp
+    1af7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1afa:	74 11                	je     1b0d <lalloc+0x6d>
+  hp->s.size = nu;
+    1afc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+    1aff:	e8 1c ff ff ff       	call   1a20 <lfree>
+  return freep;
+    1b04:	a1 84 28 00 00       	mov    0x2884,%eax
+      if((p = morecore(nunits)) == 0)
+    1b09:	85 c0                	test   %eax,%eax
+    1b0b:	75 cb                	jne    1ad8 <lalloc+0x38>
+        return 0;
+  }
+}
+    1b0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1b10:	31 d2                	xor    %edx,%edx
+}
+    1b12:	5b                   	pop    %ebx
+    1b13:	89 d0                	mov    %edx,%eax
+    1b15:	5e                   	pop    %esi
+    1b16:	5f                   	pop    %edi
+    1b17:	5d                   	pop    %ebp
+    1b18:	c3                   	ret
+    1b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+    1b20:	39 cf                	cmp    %ecx,%edi
+    1b22:	74 4c                	je     1b70 <lalloc+0xd0>
+        p->s.size -= nunits;
+    1b24:	29 f9                	sub    %edi,%ecx
+    1b26:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    1b29:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    1b2c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    1b2f:	a3 84 28 00 00       	mov    %eax,0x2884
+}
+    1b34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b37:	89 d0                	mov    %edx,%eax
+    1b39:	5b                   	pop    %ebx
+    1b3a:	5e                   	pop    %esi
+    1b3b:	5f                   	pop    %edi
+    1b3c:	5d                   	pop    %ebp
+    1b3d:	c3                   	ret
+    1b3e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+    1b40:	ba 88 28 00 00       	mov    $0x2888,%edx
+    1b45:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+    1b47:	c7 05 84 28 00 00 88 	movl   $0x2888,0x2884
+    1b4e:	28 00 00 
+    1b51:	c7 05 88 28 00 00 88 	movl   $0x2888,0x2888
+    1b58:	28 00 00 
+    1b5b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+    1b5d:	c7 05 8c 28 00 00 00 	movl   $0x0,0x288c
+    1b64:	00 00 00 
+    1b67:	e9 51 ff ff ff       	jmp    1abd <lalloc+0x1d>
+    1b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+    1b70:	8b 0a                	mov    (%edx),%ecx
+    1b72:	89 08                	mov    %ecx,(%eax)
+    1b74:	eb b9                	jmp    1b2f <lalloc+0x8f>
+    1b76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001b80 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+    1b80:	55                   	push   %ebp
+    1b81:	89 e5                	mov    %esp,%ebp
+    1b83:	57                   	push   %edi
+    1b84:	56                   	push   %esi
+    1b85:	53                   	push   %ebx
+    1b86:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+    1b89:	85 f6                	test   %esi,%esi
+    1b8b:	74 42                	je     1bcf <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+    1b8d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+    1b90:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+    1b93:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+    1b99:	77 3d                	ja     1bd8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+    1b9b:	31 c9                	xor    %ecx,%ecx
+    1b9d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1ba2:	83 fa 02             	cmp    $0x2,%edx
+    1ba5:	74 17                	je     1bbe <free+0x3e>
+    1ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bae:	66 90                	xchg   %ax,%ax
+    1bb0:	83 c1 01             	add    $0x1,%ecx
+    1bb3:	89 d8                	mov    %ebx,%eax
+    1bb5:	d3 e0                	shl    %cl,%eax
+    1bb7:	83 c0 01             	add    $0x1,%eax
+    1bba:	39 c2                	cmp    %eax,%edx
+    1bbc:	75 f2                	jne    1bb0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+    1bbe:	8b 04 8d 60 28 00 00 	mov    0x2860(,%ecx,4),%eax
+  classes[c] = bp;
+    1bc5:	89 3c 8d 60 28 00 00 	mov    %edi,0x2860(,%ecx,4)
+  bp->s.ptr = classes[c];
+    1bcc:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+    1bcf:	5b                   	pop    %ebx
+    1bd0:	5e                   	pop    %esi
+    1bd1:	5f                   	pop    %edi
+    1bd2:	5d                   	pop    %ebp
+    1bd3:	c3                   	ret
+    1bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bd8:	5b                   	pop    %ebx
+    lfree(bp);
+    1bd9:	89 f8                	mov    %edi,%eax
+}
+    1bdb:	5e                   	pop    %esi
+    1bdc:	5f                   	pop    %edi
+    1bdd:	5d                   	pop    %ebp
+    lfree(bp);
+    1bde:	e9 3d fe ff ff       	jmp    1a20 <lfree>
+    1be3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001bf0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1bf0:	55                   	push   %ebp
+    1bf1:	89 e5                	mov    %esp,%ebp
+    1bf3:	57                   	push   %edi
+    1bf4:	56                   	push   %esi
+    1bf5:	53                   	push   %ebx
+    1bf6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+    1bfc:	83 c0 07             	add    $0x7,%eax
+    1bff:	c1 e8 03             	shr    $0x3,%eax
+    1c02:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+    1c05:	3d 01 01 00 00       	cmp    $0x101,%eax
+    1c0a:	77 44                	ja     1c50 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+    1c0c:	31 c9                	xor    %ecx,%ecx
+    1c0e:	ba 01 00 00 00       	mov    $0x1,%edx
+    1c13:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1c18:	83 f8 02             	cmp    $0x2,%eax
+    1c1b:	76 11                	jbe    1c2e <malloc+0x3e>
+    1c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    1c20:	83 c1 01             	add    $0x1,%ecx
+    1c23:	89 d3                	mov    %edx,%ebx
+    1c25:	d3 e3                	shl    %cl,%ebx
+    1c27:	83 c3 01             	add    $0x1,%ebx
+    1c2a:	39 c3                	cmp    %eax,%ebx
+    1c2c:	72 f2                	jb     1c20 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+    1c2e:	8b 04 8d 60 28 00 00 	mov    0x2860(,%ecx,4),%eax
+    1c35:	85 c0                	test   %eax,%eax
+    1c37:	74 2f                	je     1c68 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+    1c39:	8b 10                	mov    (%eax),%edx
+    1c3b:	89 14 8d 60 28 00 00 	mov    %edx,0x2860(,%ecx,4)
+  return (void*)(p + 1);
+    1c42:	83 c0 08             	add    $0x8,%eax
+}
+    1c45:	83 c4 1c             	add    $0x1c,%esp
+    1c48:	5b                   	pop    %ebx
+    1c49:	5e                   	pop    %esi
+    1c4a:	5f                   	pop    %edi
+    1c4b:	5d                   	pop    %ebp
+    1c4c:	c3                   	ret
+    1c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+    1c50:	e8 4b fe ff ff       	call   1aa0 <lalloc>
+    1c55:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+    1c57:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+    1c5a:	85 d2                	test   %edx,%edx
+    1c5c:	75 e7                	jne    1c45 <malloc+0x55>
+      return 0;
+    1c5e:	31 c0                	xor    %eax,%eax
+    1c60:	eb e3                	jmp    1c45 <malloc+0x55>
+    1c62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+    1c68:	31 d2                	xor    %edx,%edx
+    1c6a:	b8 00 02 00 00       	mov    $0x200,%eax
+    1c6f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c72:	f7 f3                	div    %ebx
+  if(n < 4)
+    1c74:	ba 04 00 00 00       	mov    $0x4,%edx
+    1c79:	89 d6                	mov    %edx,%esi
+    1c7b:	39 d0                	cmp    %edx,%eax
+    1c7d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+    1c80:	0f af f3             	imul   %ebx,%esi
+    1c83:	89 f0                	mov    %esi,%eax
+    1c85:	e8 16 fe ff ff       	call   1aa0 <lalloc>
+    1c8a:	85 c0                	test   %eax,%eax
+    1c8c:	74 d0                	je     1c5e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+    1c8e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1c91:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+    1c94:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1c9b:	8b 14 8d 60 28 00 00 	mov    0x2860(,%ecx,4),%edx
+    1ca2:	39 f8                	cmp    %edi,%eax
+    1ca4:	73 22                	jae    1cc8 <malloc+0xd8>
+    1ca6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1ca9:	eb 09                	jmp    1cb4 <malloc+0xc4>
+    1cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1caf:	90                   	nop
+    1cb0:	89 c2                	mov    %eax,%edx
+    1cb2:	89 c8                	mov    %ecx,%eax
+    1cb4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+    1cb7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+    1cba:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+    1cbc:	39 f9                	cmp    %edi,%ecx
+    1cbe:	72 f0                	jb     1cb0 <malloc+0xc0>
+    1cc0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1cc3:	e9 73 ff ff ff       	jmp    1c3b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+    1cc8:	89 d0                	mov    %edx,%eax
+    1cca:	8b 12                	mov    (%edx),%edx
+    1ccc:	e9 6a ff ff ff       	jmp    1c3b <malloc+0x4b>
+    1cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cdf:	90                   	nop
+
+00001ce0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+    1ce0:	55                   	push   %ebp
+    1ce1:	89 e5                	mov    %esp,%ebp
+    1ce3:	56                   	push   %esi
+    1ce4:	53                   	push   %ebx
+    1ce5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    1ce8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+    1ceb:	85 c9                	test   %ecx,%ecx
+    1ced:	74 06                	je     1cf5 <calloc+0x15>
+    1cef:	89 c8                	mov    %ecx,%eax
+    1cf1:	f7 e3                	mul    %ebx
+    1cf3:	70 33                	jo     1d28 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+    1cf5:	0f af d9             	imul   %ecx,%ebx
+    1cf8:	83 ec 0c             	sub    $0xc,%esp
+    1cfb:	53                   	push   %ebx
+    1cfc:	e8 ef fe ff ff       	call   1bf0 <malloc>
+    1d01:	83 c4 10             	add    $0x10,%esp
+    1d04:	89 c6                	mov    %eax,%esi
+    1d06:	85 c0                	test   %eax,%eax
+    1d08:	74 1e                	je     1d28 <calloc+0x48>
+    memset(p, 0, n * size);
+    1d0a:	83 ec 04             	sub    $0x4,%esp
+    1d0d:	53                   	push   %ebx
+    1d0e:	6a 00                	push   $0x0
+    1d10:	50                   	push   %eax
+    1d11:	e8 3a f7 ff ff       	call   1450 <memset>
+    1d16:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    1d19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d1c:	89 f0                	mov    %esi,%eax
+    1d1e:	5b                   	pop    %ebx
+    1d1f:	5e                   	pop    %esi
+    1d20:	5d                   	pop    %ebp
+    1d21:	c3                   	ret
+    1d22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1d28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    1d2b:	31 f6                	xor    %esi,%esi
+}
+    1d2d:	89 f0                	mov    %esi,%eax
+    1d2f:	5b                   	pop    %ebx
+    1d30:	5e                   	pop    %esi
+    1d31:	5d                   	pop    %ebp
+    1d32:	c3                   	ret
+    1d33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001d40 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+    1d40:	55                   	push   %ebp
+    1d41:	89 e5                	mov    %esp,%ebp
+    1d43:	57                   	push   %edi
+    1d44:	56                   	push   %esi
+    1d45:	53                   	push   %ebx
+    1d46:	83 ec 0c             	sub    $0xc,%esp
+    1d49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1d4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    1d4f:	85 db                	test   %ebx,%ebx
+    1d51:	74 55                	je     1da8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    1d53:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    1d56:	89 de                	mov    %ebx,%esi
+    1d58:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    1d5f:	39 c7                	cmp    %eax,%edi
+    1d61:	72 0d                	jb     1d70 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    1d63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d66:	89 f0                	mov    %esi,%eax
+    1d68:	5b                   	pop    %ebx
+    1d69:	5e                   	pop    %esi
+    1d6a:	5f                   	pop    %edi
+    1d6b:	5d                   	pop    %ebp
+    1d6c:	c3                   	ret
+    1d6d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    1d70:	83 ec 0c             	sub    $0xc,%esp
+    1d73:	50                   	push   %eax
+    1d74:	e8 77 fe ff ff       	call   1bf0 <malloc>
+    1d79:	83 c4 10             	add    $0x10,%esp
+    1d7c:	89 c6                	mov    %eax,%esi
+    1d7e:	85 c0                	test   %eax,%eax
+    1d80:	74 e1                	je     1d63 <realloc+0x23>
+  memmove(p, ap, have);
+    1d82:	83 ec 04             	sub    $0x4,%esp
+    1d85:	57                   	push   %edi
+    1d86:	53                   	push   %ebx
+    1d87:	50                   	push   %eax
+    1d88:	e8 b3 f8 ff ff       	call   1640 <memmove>
+  free(ap);
+    1d8d:	89 1c 24             	mov    %ebx,(%esp)
+    1d90:	e8 eb fd ff ff       	call   1b80 <free>
+  return p;
+    1d95:	83 c4 10             	add    $0x10,%esp
+}
+    1d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d9b:	89 f0                	mov    %esi,%eax
+    1d9d:	5b                   	pop    %ebx
+    1d9e:	5e                   	pop    %esi
+    1d9f:	5f                   	pop    %edi
+    1da0:	5d                   	pop    %ebp
+    1da1:	c3                   	ret
+    1da2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    1da8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    1dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1dae:	5b                   	pop    %ebx
+    1daf:	5e                   	pop    %esi
+    1db0:	5f                   	pop    %edi
+    1db1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    1db2:	e9 39 fe ff ff       	jmp    1bf0 <malloc>
@@ -53,6 +53,9 @@ struct backcmd {
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
 struct cmd *parsecmd(char*);
+int simpleline(char*);
+void spawncmd(struct cmd*);
+void freecmd(struct cmd*);
 
 // Execute cmd.  Never returns.
 void
@@ -243,6 +246,7 @@ int
 main(void)
 {
   static char buf[100];
+  struct cmd *cmd;
   int fd;
 
   // Assumes three file descriptors open.
@@ -270,6 +274,13 @@ main(void)
       continue;
     }
 #endif
+    if(simpleline(buf)){
+      // No need to fork a copy of the shell.
+      cmd = parsecmd(buf);
+      spawncmd(cmd);
+      freecmd(cmd);
+      continue;
+    }
     if(fork1() == 0)
       runcmd(parsecmd(buf));
     wait();
@@ -597,3 +608,94 @@ nulterminate(struct cmd *cmd)
   }
   return cmd;
 }
+
+//PAGEBREAK!
+// Simple commands and pipelines are run with spawn(), which
+// builds each child straight from its program file instead of
+// copying the shell with fork() only to throw the copy away.
+
+// Is buf a simple command or pipeline?  Such a line cannot make
+// parsecmd panic, so the shell itself can parse it.
+int
+simpleline(char *buf)
+{
+  char *s;
+  int words, inword;
+
+  words = inword = 0;
+  for(s = buf; *s; s++){
+    if(strchr("<>&;()", *s))
+      return 0;
+    if(*s == '|'){
+      words = inword = 0;
+    } else if(strchr(whitespace, *s)){
+      inword = 0;
+    } else if(!inword){
+      inword = 1;
+      if(++words >= MAXARGS)
+        return 0;
+    }
+  }
+  return 1;
+}
+
+// Start ecmd with standard input in and standard output out.
+// Returns 1 if a child was started, else 0.
+int
+spawnexec(struct execcmd *ecmd, int in, int out)
+{
+  int fds[3];
+
+  if(ecmd->argv[0] == 0)
+    return 0;
+  fds[0] = in;
+  fds[1] = out;
+  fds[2] = 2;
+  if(spawn(ecmd->argv[0], ecmd->argv, fds, 3) < 0){
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+    return 0;
+  }
+  return 1;
+}
+
+// Run a command or pipeline of commands from a simple line
+// and wait for all of it to finish.
+void
+spawncmd(struct cmd *cmd)
+{
+  struct pipecmd *pcmd;
+  int p[2], in, n;
+
+  in = 0;
+  n = 0;
+  while(cmd->type == PIPE){
+    pcmd = (struct pipecmd*)cmd;
+    if(pipe(p) < 0){
+      printf(2, "pipe failed\n");
+      break;
+    }
+    n += spawnexec((struct execcmd*)pcmd->left, in, p[1]);
+    close(p[1]);
+    if(in != 0)
+      close(in);
+    in = p[0];
+    cmd = pcmd->right;
+  }
+  if(cmd->type == EXEC)
+    n += spawnexec((struct execcmd*)cmd, in, 1);
+  if(in != 0)
+    close(in);
+  while(n-- > 0)
+    wait();
+}
+
+// Free a command parsed from a simple line.
+void
+freecmd(struct cmd *cmd)
+{
+  if(cmd->type == PIPE){
+    freecmd(((struct pipecmd*)cmd)->left);
+    freecmd(((struct pipecmd*)cmd)->right);
+  }
+  free(cmd);
+}
@@ -0,0 +1,1816 @@
+
+_shbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         what, N, t, N * 1000 / t);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(argc > 1 && strcmp(argv[1], "-n") == 0)
+  11:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  14:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1 && strcmp(argv[1], "-n") == 0)
+  17:	7e 16                	jle    2f <main+0x2f>
+  19:	52                   	push   %edx
+  1a:	52                   	push   %edx
+  1b:	68 6c 0c 00 00       	push   $0xc6c
+  20:	ff 70 04             	push   0x4(%eax)
+  23:	e8 d8 01 00 00       	call   200 <strcmp>
+  28:	83 c4 10             	add    $0x10,%esp
+  2b:	85 c0                	test   %eax,%eax
+  2d:	74 42                	je     71 <main+0x71>
+    exit();
+
+  report("simple (spawn)", run("shbench -n\n"));
+  2f:	b8 8b 0c 00 00       	mov    $0xc8b,%eax
+  34:	e8 87 00 00 00       	call   c0 <run>
+  39:	89 c2                	mov    %eax,%edx
+  3b:	b8 6f 0c 00 00       	mov    $0xc6f,%eax
+  40:	e8 3b 00 00 00       	call   80 <report>
+  report("pipeline (spawn)", run("shbench -n | shbench -n\n"));
+  45:	b8 7e 0c 00 00       	mov    $0xc7e,%eax
+  4a:	e8 71 00 00 00       	call   c0 <run>
+  4f:	89 c2                	mov    %eax,%edx
+  51:	b8 97 0c 00 00       	mov    $0xc97,%eax
+  56:	e8 25 00 00 00       	call   80 <report>
+  report("subshell (fork+exec)", run("(shbench -n)\n"));
+  5b:	b8 a8 0c 00 00       	mov    $0xca8,%eax
+  60:	e8 5b 00 00 00       	call   c0 <run>
+  65:	89 c2                	mov    %eax,%edx
+  67:	b8 b6 0c 00 00       	mov    $0xcb6,%eax
+  6c:	e8 0f 00 00 00       	call   80 <report>
+  exit();
+  71:	e8 3d 04 00 00       	call   4b3 <exit>
+  76:	66 90                	xchg   %ax,%ax
+  78:	66 90                	xchg   %ax,%ax
+  7a:	66 90                	xchg   %ax,%ax
+  7c:	66 90                	xchg   %ax,%ax
+  7e:	66 90                	xchg   %ax,%ax
+
+00000080 <report>:
+{
+  80:	55                   	push   %ebp
+  81:	89 d1                	mov    %edx,%ecx
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	89 c3                	mov    %eax,%ebx
+    t = 1;
+  88:	b8 01 00 00 00       	mov    $0x1,%eax
+{
+  8d:	83 ec 0c             	sub    $0xc,%esp
+    t = 1;
+  90:	85 d2                	test   %edx,%edx
+  92:	0f 44 c8             	cmove  %eax,%ecx
+  printf(1, "%s: %d commands in %d ms, %d per second\n",
+  95:	b8 a0 86 01 00       	mov    $0x186a0,%eax
+  9a:	31 d2                	xor    %edx,%edx
+  9c:	f7 f9                	idiv   %ecx
+  9e:	50                   	push   %eax
+  9f:	51                   	push   %ecx
+  a0:	6a 64                	push   $0x64
+  a2:	53                   	push   %ebx
+  a3:	68 f8 0b 00 00       	push   $0xbf8
+  a8:	6a 01                	push   $0x1
+  aa:	e8 01 06 00 00       	call   6b0 <printf>
+}
+  af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b2:	83 c4 20             	add    $0x20,%esp
+  b5:	c9                   	leave
+  b6:	c3                   	ret
+  b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <run>:
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	89 c6                	mov    %eax,%esi
+  c7:	53                   	push   %ebx
+  c8:	83 ec 24             	sub    $0x24,%esp
+  if((fd = open(SCRIPT, O_CREATE|O_RDWR)) < 0){
+  cb:	68 02 02 00 00       	push   $0x202
+  d0:	68 21 0c 00 00       	push   $0xc21
+  d5:	e8 19 04 00 00       	call   4f3 <open>
+  da:	83 c4 10             	add    $0x10,%esp
+  dd:	85 c0                	test   %eax,%eax
+  df:	78 74                	js     155 <run+0x95>
+  e1:	89 c7                	mov    %eax,%edi
+  e3:	bb 64 00 00 00       	mov    $0x64,%ebx
+  e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+    write(fd, line, strlen(line));
+  f0:	83 ec 0c             	sub    $0xc,%esp
+  f3:	56                   	push   %esi
+  f4:	e8 67 01 00 00       	call   260 <strlen>
+  f9:	83 c4 0c             	add    $0xc,%esp
+  fc:	50                   	push   %eax
+  fd:	56                   	push   %esi
+  fe:	57                   	push   %edi
+  ff:	e8 cf 03 00 00       	call   4d3 <write>
+  for(i = 0; i < N; i++)
+ 104:	83 c4 10             	add    $0x10,%esp
+ 107:	83 eb 01             	sub    $0x1,%ebx
+ 10a:	75 e4                	jne    f0 <run+0x30>
+  close(fd);
+ 10c:	83 ec 0c             	sub    $0xc,%esp
+ 10f:	57                   	push   %edi
+ 110:	e8 c6 03 00 00       	call   4db <close>
+  start = uptime();
+ 115:	e8 31 04 00 00       	call   54b <uptime>
+ 11a:	89 c3                	mov    %eax,%ebx
+  if(fork() == 0){
+ 11c:	e8 8a 03 00 00       	call   4ab <fork>
+ 121:	83 c4 10             	add    $0x10,%esp
+ 124:	85 c0                	test   %eax,%eax
+ 126:	74 44                	je     16c <run+0xac>
+  wait();
+ 128:	e8 8e 03 00 00       	call   4bb <wait>
+  unlink(SCRIPT);
+ 12d:	83 ec 0c             	sub    $0xc,%esp
+ 130:	68 21 0c 00 00       	push   $0xc21
+ 135:	e8 c9 03 00 00       	call   503 <unlink>
+  unlink(LOG);
+ 13a:	c7 04 24 47 0c 00 00 	movl   $0xc47,(%esp)
+ 141:	e8 bd 03 00 00       	call   503 <unlink>
+  return uptime() - start;
+ 146:	e8 00 04 00 00       	call   54b <uptime>
+}
+ 14b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return uptime() - start;
+ 14e:	29 d8                	sub    %ebx,%eax
+}
+ 150:	5b                   	pop    %ebx
+ 151:	5e                   	pop    %esi
+ 152:	5f                   	pop    %edi
+ 153:	5d                   	pop    %ebp
+ 154:	c3                   	ret
+    printf(2, "shbench: cannot create %s\n", SCRIPT);
+ 155:	51                   	push   %ecx
+ 156:	68 21 0c 00 00       	push   $0xc21
+ 15b:	68 2c 0c 00 00       	push   $0xc2c
+ 160:	6a 02                	push   $0x2
+ 162:	e8 49 05 00 00       	call   6b0 <printf>
+    exit();
+ 167:	e8 47 03 00 00       	call   4b3 <exit>
+    close(0);
+ 16c:	83 ec 0c             	sub    $0xc,%esp
+    args[1] = 0;
+ 16f:	31 f6                	xor    %esi,%esi
+    close(0);
+ 171:	6a 00                	push   $0x0
+ 173:	e8 63 03 00 00       	call   4db <close>
+    open(SCRIPT, O_RDONLY);
+ 178:	58                   	pop    %eax
+ 179:	5a                   	pop    %edx
+ 17a:	6a 00                	push   $0x0
+ 17c:	68 21 0c 00 00       	push   $0xc21
+ 181:	e8 6d 03 00 00       	call   4f3 <open>
+    close(2);
+ 186:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+ 18d:	e8 49 03 00 00       	call   4db <close>
+    open(LOG, O_CREATE|O_RDWR);
+ 192:	59                   	pop    %ecx
+ 193:	5b                   	pop    %ebx
+ 194:	68 02 02 00 00       	push   $0x202
+ 199:	68 47 0c 00 00       	push   $0xc47
+ 19e:	e8 50 03 00 00       	call   4f3 <open>
+    args[0] = "sh";
+ 1a3:	c7 45 e0 29 0c 00 00 	movl   $0xc29,-0x20(%ebp)
+    args[1] = 0;
+ 1aa:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    exec("sh", args);
+ 1ad:	5f                   	pop    %edi
+ 1ae:	58                   	pop    %eax
+ 1af:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 1b2:	50                   	push   %eax
+ 1b3:	68 29 0c 00 00       	push   $0xc29
+ 1b8:	e8 2e 03 00 00       	call   4eb <exec>
+    printf(1, "shbench: exec sh failed\n");
+ 1bd:	58                   	pop    %eax
+ 1be:	5a                   	pop    %edx
+ 1bf:	68 53 0c 00 00       	push   $0xc53
+ 1c4:	6a 01                	push   $0x1
+ 1c6:	e8 e5 04 00 00       	call   6b0 <printf>
+    exit();
+ 1cb:	e8 e3 02 00 00       	call   4b3 <exit>
+
+000001d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d1:	31 c0                	xor    %eax,%eax
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	53                   	push   %ebx
+ 1d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e7:	83 c0 01             	add    $0x1,%eax
+ 1ea:	84 d2                	test   %dl,%dl
+ 1ec:	75 f2                	jne    1e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f1:	89 c8                	mov    %ecx,%eax
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+ 1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 266:	80 3a 00             	cmpb   $0x0,(%edx)
+ 269:	74 15                	je     280 <strlen+0x20>
+ 26b:	31 c0                	xor    %eax,%eax
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 277:	89 c1                	mov    %eax,%ecx
+ 279:	75 f5                	jne    270 <strlen+0x10>
+    ;
+  return n;
+}
+ 27b:	89 c8                	mov    %ecx,%eax
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 280:	31 c9                	xor    %ecx,%ecx
+}
+ 282:	5d                   	pop    %ebp
+ 283:	89 c8                	mov    %ecx,%eax
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 d7                	mov    %edx,%edi
+ 29f:	fc                   	cld
+ 2a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2a5:	89 d0                	mov    %edx,%eax
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ba:	0f b6 10             	movzbl (%eax),%edx
+ 2bd:	84 d2                	test   %dl,%dl
+ 2bf:	75 12                	jne    2d3 <strchr+0x23>
+ 2c1:	eb 1d                	jmp    2e0 <strchr+0x30>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2cc:	83 c0 01             	add    $0x1,%eax
+ 2cf:	84 d2                	test   %dl,%dl
+ 2d1:	74 0d                	je     2e0 <strchr+0x30>
+    if(*s == c)
+ 2d3:	38 d1                	cmp    %dl,%cl
+ 2d5:	75 f1                	jne    2c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2e0:	31 c0                	xor    %eax,%eax
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2f9:	31 db                	xor    %ebx,%ebx
+{
+ 2fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2fe:	eb 27                	jmp    327 <gets+0x37>
+    cc = read(0, &c, 1);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	6a 01                	push   $0x1
+ 305:	56                   	push   %esi
+ 306:	6a 00                	push   $0x0
+ 308:	e8 be 01 00 00       	call   4cb <read>
+    if(cc < 1)
+ 30d:	83 c4 10             	add    $0x10,%esp
+ 310:	85 c0                	test   %eax,%eax
+ 312:	7e 1d                	jle    331 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 314:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 31f:	3c 0a                	cmp    $0xa,%al
+ 321:	74 10                	je     333 <gets+0x43>
+ 323:	3c 0d                	cmp    $0xd,%al
+ 325:	74 0c                	je     333 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 327:	89 df                	mov    %ebx,%edi
+ 329:	83 c3 01             	add    $0x1,%ebx
+ 32c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 32f:	7c cf                	jl     300 <gets+0x10>
+ 331:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 33a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5f                   	pop    %edi
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+ 342:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 91 01 00 00       	call   4f3 <open>
+  if(fd < 0)
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	89 c3                	mov    %eax,%ebx
+ 371:	50                   	push   %eax
+ 372:	e8 94 01 00 00       	call   50b <fstat>
+  close(fd);
+ 377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 37c:	e8 5a 01 00 00       	call   4db <close>
+  return r;
+ 381:	83 c4 10             	add    $0x10,%esp
+}
+ 384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 387:	89 f0                	mov    %esi,%eax
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 395:	eb ed                	jmp    384 <stat+0x34>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+ 3a4:	53                   	push   %ebx
+ 3a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 3a8:	0f b6 02             	movzbl (%edx),%eax
+ 3ab:	3c 20                	cmp    $0x20,%al
+ 3ad:	75 0c                	jne    3bb <atoi+0x1b>
+ 3af:	90                   	nop
+ 3b0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 3b4:	83 c2 01             	add    $0x1,%edx
+ 3b7:	3c 20                	cmp    $0x20,%al
+ 3b9:	74 f5                	je     3b0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 3bb:	3c 2d                	cmp    $0x2d,%al
+ 3bd:	74 41                	je     400 <atoi+0x60>
+ 3bf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 3c4:	3c 2b                	cmp    $0x2b,%al
+ 3c6:	74 3d                	je     405 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 3c8:	0f be 0a             	movsbl (%edx),%ecx
+ 3cb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 3ce:	3c 09                	cmp    $0x9,%al
+ 3d0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3d5:	77 21                	ja     3f8 <atoi+0x58>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3e0:	83 c2 01             	add    $0x1,%edx
+ 3e3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 3e6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 3ea:	0f be 0a             	movsbl (%edx),%ecx
+ 3ed:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 3f0:	80 fb 09             	cmp    $0x9,%bl
+ 3f3:	76 eb                	jbe    3e0 <atoi+0x40>
+  return sign*n;
+ 3f5:	0f af c6             	imul   %esi,%eax
+}
+ 3f8:	5b                   	pop    %ebx
+ 3f9:	5e                   	pop    %esi
+ 3fa:	5d                   	pop    %ebp
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 400:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 405:	83 c2 01             	add    $0x1,%edx
+ 408:	eb be                	jmp    3c8 <atoi+0x28>
+ 40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	56                   	push   %esi
+ 414:	53                   	push   %ebx
+ 415:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 418:	0f b6 02             	movzbl (%edx),%eax
+ 41b:	3c 20                	cmp    $0x20,%al
+ 41d:	75 0c                	jne    42b <atoo+0x1b>
+ 41f:	90                   	nop
+ 420:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 424:	83 c2 01             	add    $0x1,%edx
+ 427:	3c 20                	cmp    $0x20,%al
+ 429:	74 f5                	je     420 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 42b:	3c 2d                	cmp    $0x2d,%al
+ 42d:	74 41                	je     470 <atoo+0x60>
+ 42f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 434:	3c 2b                	cmp    $0x2b,%al
+ 436:	74 3d                	je     475 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 438:	0f be 0a             	movsbl (%edx),%ecx
+ 43b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 43e:	3c 07                	cmp    $0x7,%al
+ 440:	b8 00 00 00 00       	mov    $0x0,%eax
+ 445:	77 1e                	ja     465 <atoo+0x55>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 450:	83 c2 01             	add    $0x1,%edx
+ 453:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 457:	0f be 0a             	movsbl (%edx),%ecx
+ 45a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 45d:	80 fb 07             	cmp    $0x7,%bl
+ 460:	76 ee                	jbe    450 <atoo+0x40>
+  return sign*n;
+ 462:	0f af c6             	imul   %esi,%eax
+}
+ 465:	5b                   	pop    %ebx
+ 466:	5e                   	pop    %esi
+ 467:	5d                   	pop    %ebp
+ 468:	c3                   	ret
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 475:	83 c2 01             	add    $0x1,%edx
+ 478:	eb be                	jmp    438 <atoo+0x28>
+ 47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000480 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	8b 45 10             	mov    0x10(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 48e:	85 c0                	test   %eax,%eax
+ 490:	7e 13                	jle    4a5 <memmove+0x25>
+ 492:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 494:	89 d7                	mov    %edx,%edi
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4a1:	39 f8                	cmp    %edi,%eax
+ 4a3:	75 fb                	jne    4a0 <memmove+0x20>
+  return vdst;
+}
+ 4a5:	5e                   	pop    %esi
+ 4a6:	89 d0                	mov    %edx,%eax
+ 4a8:	5f                   	pop    %edi
+ 4a9:	5d                   	pop    %ebp
+ 4aa:	c3                   	ret
+
+000004ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <exit>:
+SYSCALL(exit)
+ 4b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <wait>:
+SYSCALL(wait)
+ 4bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <pipe>:
+SYSCALL(pipe)
+ 4c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <read>:
+SYSCALL(read)
+ 4cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <write>:
+SYSCALL(write)
+ 4d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <close>:
+SYSCALL(close)
+ 4db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <kill>:
+SYSCALL(kill)
+ 4e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <exec>:
+SYSCALL(exec)
+ 4eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <open>:
+SYSCALL(open)
+ 4f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mknod>:
+SYSCALL(mknod)
+ 4fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <unlink>:
+SYSCALL(unlink)
+ 503:	b8 12 00 00 00       	mov    $0x12,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <fstat>:
+SYSCALL(fstat)
+ 50b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <link>:
+SYSCALL(link)
+ 513:	b8 13 00 00 00       	mov    $0x13,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mkdir>:
+SYSCALL(mkdir)
+ 51b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <chdir>:
+SYSCALL(chdir)
+ 523:	b8 09 00 00 00       	mov    $0x9,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <dup>:
+SYSCALL(dup)
+ 52b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <getpid>:
+SYSCALL(getpid)
+ 533:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <sbrk>:
+SYSCALL(sbrk)
+ 53b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sleep>:
+SYSCALL(sleep)
+ 543:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <uptime>:
+SYSCALL(uptime)
+ 54b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <superpages>:
+SYSCALL(superpages)
+ 553:	b8 23 00 00 00       	mov    $0x23,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mmap>:
+SYSCALL(mmap)
+ 55b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <munmap>:
+SYSCALL(munmap)
+ 563:	b8 25 00 00 00       	mov    $0x25,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <spawn>:
+SYSCALL(spawn)
+ 56b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <swapstat>:
+SYSCALL(swapstat)
+ 573:	b8 27 00 00 00       	mov    $0x27,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 57b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <iostat>:
+SYSCALL(iostat)
+ 583:	b8 29 00 00 00       	mov    $0x29,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <dropcache>:
+SYSCALL(dropcache)
+ 58b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <iosched>:
+SYSCALL(iosched)
+ 593:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <halt>:
+SYSCALL(halt)
+ 59b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <date>:
+SYSCALL(date)
+ 5a3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 5ab:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getgid>:
+SYSCALL(getgid)
+ 5b3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <getppid>:
+SYSCALL(getppid)
+ 5bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <setuid>:
+SYSCALL(setuid)
+ 5c3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <setgid>:
+SYSCALL(setgid)
+ 5cb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <getprocs>:
+SYSCALL(getprocs)
+ 5d3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 5db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <getpriority>:
+SYSCALL(getpriority)
+ 5e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 5eb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <chown>:
+SYSCALL(chown)
+ 5f3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <chgrp>:
+SYSCALL(chgrp)
+ 5fb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+ 603:	66 90                	xchg   %ax,%ax
+ 605:	66 90                	xchg   %ax,%ax
+ 607:	66 90                	xchg   %ax,%ax
+ 609:	66 90                	xchg   %ax,%ax
+ 60b:	66 90                	xchg   %ax,%ax
+ 60d:	66 90                	xchg   %ax,%ax
+ 60f:	90                   	nop
+
+00000610 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 618:	89 d1                	mov    %edx,%ecx
+{
+ 61a:	83 ec 3c             	sub    $0x3c,%esp
+ 61d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 620:	85 d2                	test   %edx,%edx
+ 622:	0f 89 80 00 00 00    	jns    6a8 <printint+0x98>
+ 628:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 62c:	74 7a                	je     6a8 <printint+0x98>
+    x = -xx;
+ 62e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 630:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 635:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 638:	31 f6                	xor    %esi,%esi
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 640:	89 c8                	mov    %ecx,%eax
+ 642:	31 d2                	xor    %edx,%edx
+ 644:	89 f7                	mov    %esi,%edi
+ 646:	f7 f3                	div    %ebx
+ 648:	8d 76 01             	lea    0x1(%esi),%esi
+ 64b:	0f b6 92 2c 0d 00 00 	movzbl 0xd2c(%edx),%edx
+ 652:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 656:	89 ca                	mov    %ecx,%edx
+ 658:	89 c1                	mov    %eax,%ecx
+ 65a:	39 da                	cmp    %ebx,%edx
+ 65c:	73 e2                	jae    640 <printint+0x30>
+  if(neg)
+ 65e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 661:	85 c0                	test   %eax,%eax
+ 663:	74 07                	je     66c <printint+0x5c>
+    buf[i++] = '-';
+ 665:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 66a:	89 f7                	mov    %esi,%edi
+ 66c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 66f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 672:	01 df                	add    %ebx,%edi
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 678:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 681:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 684:	6a 01                	push   $0x1
+ 686:	50                   	push   %eax
+ 687:	56                   	push   %esi
+ 688:	e8 46 fe ff ff       	call   4d3 <write>
+  while(--i >= 0)
+ 68d:	89 f8                	mov    %edi,%eax
+ 68f:	83 c4 10             	add    $0x10,%esp
+ 692:	83 ef 01             	sub    $0x1,%edi
+ 695:	39 d8                	cmp    %ebx,%eax
+ 697:	75 df                	jne    678 <printint+0x68>
+}
+ 699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 69c:	5b                   	pop    %ebx
+ 69d:	5e                   	pop    %esi
+ 69e:	5f                   	pop    %edi
+ 69f:	5d                   	pop    %ebp
+ 6a0:	c3                   	ret
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6a8:	31 c0                	xor    %eax,%eax
+ 6aa:	eb 89                	jmp    635 <printint+0x25>
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c2:	83 c6 01             	add    $0x1,%esi
+ 6c5:	84 db                	test   %bl,%bl
+ 6c7:	74 67                	je     730 <printf+0x80>
+ 6c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6cc:	31 d2                	xor    %edx,%edx
+ 6ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6d1:	eb 34                	jmp    707 <printf+0x57>
+ 6d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6d7:	90                   	nop
+ 6d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6e0:	83 f8 25             	cmp    $0x25,%eax
+ 6e3:	74 18                	je     6fd <printf+0x4d>
+  write(fd, &c, 1);
+ 6e5:	83 ec 04             	sub    $0x4,%esp
+ 6e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ee:	6a 01                	push   $0x1
+ 6f0:	50                   	push   %eax
+ 6f1:	57                   	push   %edi
+ 6f2:	e8 dc fd ff ff       	call   4d3 <write>
+ 6f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 700:	83 c6 01             	add    $0x1,%esi
+ 703:	84 db                	test   %bl,%bl
+ 705:	74 29                	je     730 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 707:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 70a:	85 d2                	test   %edx,%edx
+ 70c:	74 ca                	je     6d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 70e:	83 fa 25             	cmp    $0x25,%edx
+ 711:	75 ea                	jne    6fd <printf+0x4d>
+      if(c == 'd'){
+ 713:	83 f8 25             	cmp    $0x25,%eax
+ 716:	0f 84 24 01 00 00    	je     840 <printf+0x190>
+ 71c:	83 e8 63             	sub    $0x63,%eax
+ 71f:	83 f8 15             	cmp    $0x15,%eax
+ 722:	77 1c                	ja     740 <printf+0x90>
+ 724:	ff 24 85 d4 0c 00 00 	jmp    *0xcd4(,%eax,4)
+ 72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 733:	5b                   	pop    %ebx
+ 734:	5e                   	pop    %esi
+ 735:	5f                   	pop    %edi
+ 736:	5d                   	pop    %ebp
+ 737:	c3                   	ret
+ 738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 746:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 74a:	6a 01                	push   $0x1
+ 74c:	52                   	push   %edx
+ 74d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 750:	57                   	push   %edi
+ 751:	e8 7d fd ff ff       	call   4d3 <write>
+ 756:	83 c4 0c             	add    $0xc,%esp
+ 759:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 75c:	6a 01                	push   $0x1
+ 75e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 761:	52                   	push   %edx
+ 762:	57                   	push   %edi
+ 763:	e8 6b fd ff ff       	call   4d3 <write>
+        putc(fd, c);
+ 768:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 76b:	31 d2                	xor    %edx,%edx
+ 76d:	eb 8e                	jmp    6fd <printf+0x4d>
+ 76f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 00                	push   $0x0
+ 77f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 781:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 784:	e8 87 fe ff ff       	call   610 <printint>
+        ap++;
+ 789:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 78c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 67 ff ff ff       	jmp    6fd <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7a5:	83 c0 04             	add    $0x4,%eax
+ 7a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7ab:	85 db                	test   %ebx,%ebx
+ 7ad:	0f 84 9d 00 00 00    	je     850 <printf+0x1a0>
+        while(*s != 0){
+ 7b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	0f 84 3d ff ff ff    	je     6fd <printf+0x4d>
+ 7c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7c6:	89 de                	mov    %ebx,%esi
+ 7c8:	89 d3                	mov    %edx,%ebx
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	53                   	push   %ebx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 f1 fc ff ff       	call   4d3 <write>
+        while(*s != 0){
+ 7e2:	0f b6 06             	movzbl (%esi),%eax
+ 7e5:	83 c4 10             	add    $0x10,%esp
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	75 e4                	jne    7d0 <printf+0x120>
+      state = 0;
+ 7ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 07 ff ff ff       	jmp    6fd <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 800:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 80b:	8b 13                	mov    (%ebx),%edx
+ 80d:	6a 01                	push   $0x1
+ 80f:	e9 6b ff ff ff       	jmp    77f <printf+0xcf>
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 818:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 821:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 823:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 826:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	52                   	push   %edx
+ 82c:	57                   	push   %edi
+ 82d:	e8 a1 fc ff ff       	call   4d3 <write>
+        ap++;
+ 832:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 835:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 838:	31 d2                	xor    %edx,%edx
+ 83a:	e9 be fe ff ff       	jmp    6fd <printf+0x4d>
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 846:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 849:	6a 01                	push   $0x1
+ 84b:	e9 11 ff ff ff       	jmp    761 <printf+0xb1>
+ 850:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 855:	bb cb 0c 00 00       	mov    $0xccb,%ebx
+ 85a:	e9 61 ff ff ff       	jmp    7c0 <printf+0x110>
+ 85f:	90                   	nop
+
+00000860 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 863:	a1 64 11 00 00       	mov    0x1164,%eax
+{
+ 868:	89 e5                	mov    %esp,%ebp
+ 86a:	56                   	push   %esi
+ 86b:	53                   	push   %ebx
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 870:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 872:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 874:	39 ca                	cmp    %ecx,%edx
+ 876:	73 30                	jae    8a8 <lfree+0x48>
+ 878:	39 c1                	cmp    %eax,%ecx
+ 87a:	72 04                	jb     880 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 87c:	39 c2                	cmp    %eax,%edx
+ 87e:	72 f0                	jb     870 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 880:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 883:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 886:	39 f0                	cmp    %esi,%eax
+ 888:	74 26                	je     8b0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 88a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 88c:	8b 42 04             	mov    0x4(%edx),%eax
+ 88f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 892:	39 d9                	cmp    %ebx,%ecx
+ 894:	74 30                	je     8c6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 896:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 898:	5b                   	pop    %ebx
+  freep = p;
+ 899:	89 15 64 11 00 00    	mov    %edx,0x1164
+}
+ 89f:	5e                   	pop    %esi
+ 8a0:	5d                   	pop    %ebp
+ 8a1:	c3                   	ret
+ 8a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a8:	39 c1                	cmp    %eax,%ecx
+ 8aa:	72 d0                	jb     87c <lfree+0x1c>
+ 8ac:	eb c2                	jmp    870 <lfree+0x10>
+ 8ae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 8b0:	03 58 04             	add    0x4(%eax),%ebx
+ 8b3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b6:	8b 02                	mov    (%edx),%eax
+ 8b8:	8b 00                	mov    (%eax),%eax
+ 8ba:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 8bc:	8b 42 04             	mov    0x4(%edx),%eax
+ 8bf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 8c2:	39 d9                	cmp    %ebx,%ecx
+ 8c4:	75 d0                	jne    896 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 8c6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 8c9:	89 15 64 11 00 00    	mov    %edx,0x1164
+    p->s.size += bp->s.size;
+ 8cf:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8d2:	8b 09                	mov    (%ecx),%ecx
+ 8d4:	89 0a                	mov    %ecx,(%edx)
+}
+ 8d6:	5b                   	pop    %ebx
+ 8d7:	5e                   	pop    %esi
+ 8d8:	5d                   	pop    %ebp
+ 8d9:	c3                   	ret
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008e0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	89 c7                	mov    %eax,%edi
+ 8e6:	56                   	push   %esi
+ 8e7:	53                   	push   %ebx
+ 8e8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 8eb:	a1 64 11 00 00       	mov    0x1164,%eax
+ 8f0:	85 c0                	test   %eax,%eax
+ 8f2:	0f 84 88 00 00 00    	je     980 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 8fa:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 8fd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 902:	39 df                	cmp    %ebx,%edi
+ 904:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 907:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 90e:	39 f9                	cmp    %edi,%ecx
+ 910:	72 0f                	jb     921 <lalloc+0x41>
+ 912:	eb 4c                	jmp    960 <lalloc+0x80>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 918:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 91a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 91d:	39 f9                	cmp    %edi,%ecx
+ 91f:	73 3f                	jae    960 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 921:	89 d0                	mov    %edx,%eax
+ 923:	39 15 64 11 00 00    	cmp    %edx,0x1164
+ 929:	75 ed                	jne    918 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 92b:	83 ec 0c             	sub    $0xc,%esp
+ 92e:	56                   	push   %esi
+ 92f:	e8 07 fc ff ff       	call   53b <sbrk>
+  if(p == (char*)-1)
+ 934:	83 c4 10             	add    $0x10,%esp
+ 937:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 93a:	74 11                	je     94d <lalloc+0x6d>
+  hp->s.size = nu;
+ 93c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 93f:	e8 1c ff ff ff       	call   860 <lfree>
+  return freep;
+ 944:	a1 64 11 00 00       	mov    0x1164,%eax
+      if((p = morecore(nunits)) == 0)
+ 949:	85 c0                	test   %eax,%eax
+ 94b:	75 cb                	jne    918 <lalloc+0x38>
+        return 0;
+  }
+}
+ 94d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 950:	31 d2                	xor    %edx,%edx
+}
+ 952:	5b                   	pop    %ebx
+ 953:	89 d0                	mov    %edx,%eax
+ 955:	5e                   	pop    %esi
+ 956:	5f                   	pop    %edi
+ 957:	5d                   	pop    %ebp
+ 958:	c3                   	ret
+ 959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 960:	39 cf                	cmp    %ecx,%edi
+ 962:	74 4c                	je     9b0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 964:	29 f9                	sub    %edi,%ecx
+ 966:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 969:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 96c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 96f:	a3 64 11 00 00       	mov    %eax,0x1164
+}
+ 974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 977:	89 d0                	mov    %edx,%eax
+ 979:	5b                   	pop    %ebx
+ 97a:	5e                   	pop    %esi
+ 97b:	5f                   	pop    %edi
+ 97c:	5d                   	pop    %ebp
+ 97d:	c3                   	ret
+ 97e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 980:	ba 68 11 00 00       	mov    $0x1168,%edx
+ 985:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 987:	c7 05 64 11 00 00 68 	movl   $0x1168,0x1164
+ 98e:	11 00 00 
+ 991:	c7 05 68 11 00 00 68 	movl   $0x1168,0x1168
+ 998:	11 00 00 
+ 99b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 99d:	c7 05 6c 11 00 00 00 	movl   $0x0,0x116c
+ 9a4:	00 00 00 
+ 9a7:	e9 51 ff ff ff       	jmp    8fd <lalloc+0x1d>
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 9b0:	8b 0a                	mov    (%edx),%ecx
+ 9b2:	89 08                	mov    %ecx,(%eax)
+ 9b4:	eb b9                	jmp    96f <lalloc+0x8f>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 9c9:	85 f6                	test   %esi,%esi
+ 9cb:	74 42                	je     a0f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 9cd:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 9d0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 9d3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 9d9:	77 3d                	ja     a18 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 9db:	31 c9                	xor    %ecx,%ecx
+ 9dd:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 9e2:	83 fa 02             	cmp    $0x2,%edx
+ 9e5:	74 17                	je     9fe <free+0x3e>
+ 9e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ee:	66 90                	xchg   %ax,%ax
+ 9f0:	83 c1 01             	add    $0x1,%ecx
+ 9f3:	89 d8                	mov    %ebx,%eax
+ 9f5:	d3 e0                	shl    %cl,%eax
+ 9f7:	83 c0 01             	add    $0x1,%eax
+ 9fa:	39 c2                	cmp    %eax,%edx
+ 9fc:	75 f2                	jne    9f0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 9fe:	8b 04 8d 40 11 00 00 	mov    0x1140(,%ecx,4),%eax
+  classes[c] = bp;
+ a05:	89 3c 8d 40 11 00 00 	mov    %edi,0x1140(,%ecx,4)
+  bp->s.ptr = classes[c];
+ a0c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ a0f:	5b                   	pop    %ebx
+ a10:	5e                   	pop    %esi
+ a11:	5f                   	pop    %edi
+ a12:	5d                   	pop    %ebp
+ a13:	c3                   	ret
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a18:	5b                   	pop    %ebx
+    lfree(bp);
+ a19:	89 f8                	mov    %edi,%eax
+}
+ a1b:	5e                   	pop    %esi
+ a1c:	5f                   	pop    %edi
+ a1d:	5d                   	pop    %ebp
+    lfree(bp);
+ a1e:	e9 3d fe ff ff       	jmp    860 <lfree>
+ a23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a30 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a39:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3c:	83 c0 07             	add    $0x7,%eax
+ a3f:	c1 e8 03             	shr    $0x3,%eax
+ a42:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ a45:	3d 01 01 00 00       	cmp    $0x101,%eax
+ a4a:	77 44                	ja     a90 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ a4c:	31 c9                	xor    %ecx,%ecx
+ a4e:	ba 01 00 00 00       	mov    $0x1,%edx
+ a53:	bb 02 00 00 00       	mov    $0x2,%ebx
+ a58:	83 f8 02             	cmp    $0x2,%eax
+ a5b:	76 11                	jbe    a6e <malloc+0x3e>
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+ a60:	83 c1 01             	add    $0x1,%ecx
+ a63:	89 d3                	mov    %edx,%ebx
+ a65:	d3 e3                	shl    %cl,%ebx
+ a67:	83 c3 01             	add    $0x1,%ebx
+ a6a:	39 c3                	cmp    %eax,%ebx
+ a6c:	72 f2                	jb     a60 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ a6e:	8b 04 8d 40 11 00 00 	mov    0x1140(,%ecx,4),%eax
+ a75:	85 c0                	test   %eax,%eax
+ a77:	74 2f                	je     aa8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ a79:	8b 10                	mov    (%eax),%edx
+ a7b:	89 14 8d 40 11 00 00 	mov    %edx,0x1140(,%ecx,4)
+  return (void*)(p + 1);
+ a82:	83 c0 08             	add    $0x8,%eax
+}
+ a85:	83 c4 1c             	add    $0x1c,%esp
+ a88:	5b                   	pop    %ebx
+ a89:	5e                   	pop    %esi
+ a8a:	5f                   	pop    %edi
+ a8b:	5d                   	pop    %ebp
+ a8c:	c3                   	ret
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ a90:	e8 4b fe ff ff       	call   8e0 <lalloc>
+ a95:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ a97:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ a9a:	85 d2                	test   %edx,%edx
+ a9c:	75 e7                	jne    a85 <malloc+0x55>
+      return 0;
+ a9e:	31 c0                	xor    %eax,%eax
+ aa0:	eb e3                	jmp    a85 <malloc+0x55>
+ aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ aa8:	31 d2                	xor    %edx,%edx
+ aaa:	b8 00 02 00 00       	mov    $0x200,%eax
+ aaf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ ab2:	f7 f3                	div    %ebx
+  if(n < 4)
+ ab4:	ba 04 00 00 00       	mov    $0x4,%edx
+ ab9:	89 d6                	mov    %edx,%esi
+ abb:	39 d0                	cmp    %edx,%eax
+ abd:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ ac0:	0f af f3             	imul   %ebx,%esi
+ ac3:	89 f0                	mov    %esi,%eax
+ ac5:	e8 16 fe ff ff       	call   8e0 <lalloc>
+ aca:	85 c0                	test   %eax,%eax
+ acc:	74 d0                	je     a9e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ ace:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ ad1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ ad4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ adb:	8b 14 8d 40 11 00 00 	mov    0x1140(,%ecx,4),%edx
+ ae2:	39 f8                	cmp    %edi,%eax
+ ae4:	73 22                	jae    b08 <malloc+0xd8>
+ ae6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ ae9:	eb 09                	jmp    af4 <malloc+0xc4>
+ aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+ af0:	89 c2                	mov    %eax,%edx
+ af2:	89 c8                	mov    %ecx,%eax
+ af4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ af7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ afa:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ afc:	39 f9                	cmp    %edi,%ecx
+ afe:	72 f0                	jb     af0 <malloc+0xc0>
+ b00:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b03:	e9 73 ff ff ff       	jmp    a7b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ b08:	89 d0                	mov    %edx,%eax
+ b0a:	8b 12                	mov    (%edx),%edx
+ b0c:	e9 6a ff ff ff       	jmp    a7b <malloc+0x4b>
+ b11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+
+00000b20 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	56                   	push   %esi
+ b24:	53                   	push   %ebx
+ b25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ b28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ b2b:	85 c9                	test   %ecx,%ecx
+ b2d:	74 06                	je     b35 <calloc+0x15>
+ b2f:	89 c8                	mov    %ecx,%eax
+ b31:	f7 e3                	mul    %ebx
+ b33:	70 33                	jo     b68 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ b35:	0f af d9             	imul   %ecx,%ebx
+ b38:	83 ec 0c             	sub    $0xc,%esp
+ b3b:	53                   	push   %ebx
+ b3c:	e8 ef fe ff ff       	call   a30 <malloc>
+ b41:	83 c4 10             	add    $0x10,%esp
+ b44:	89 c6                	mov    %eax,%esi
+ b46:	85 c0                	test   %eax,%eax
+ b48:	74 1e                	je     b68 <calloc+0x48>
+    memset(p, 0, n * size);
+ b4a:	83 ec 04             	sub    $0x4,%esp
+ b4d:	53                   	push   %ebx
+ b4e:	6a 00                	push   $0x0
+ b50:	50                   	push   %eax
+ b51:	e8 3a f7 ff ff       	call   290 <memset>
+ b56:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ b59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b5c:	89 f0                	mov    %esi,%eax
+ b5e:	5b                   	pop    %ebx
+ b5f:	5e                   	pop    %esi
+ b60:	5d                   	pop    %ebp
+ b61:	c3                   	ret
+ b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ b6b:	31 f6                	xor    %esi,%esi
+}
+ b6d:	89 f0                	mov    %esi,%eax
+ b6f:	5b                   	pop    %ebx
+ b70:	5e                   	pop    %esi
+ b71:	5d                   	pop    %ebp
+ b72:	c3                   	ret
+ b73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b80 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	57                   	push   %edi
+ b84:	56                   	push   %esi
+ b85:	53                   	push   %ebx
+ b86:	83 ec 0c             	sub    $0xc,%esp
+ b89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ b8f:	85 db                	test   %ebx,%ebx
+ b91:	74 55                	je     be8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ b93:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ b96:	89 de                	mov    %ebx,%esi
+ b98:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ b9f:	39 c7                	cmp    %eax,%edi
+ ba1:	72 0d                	jb     bb0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ba6:	89 f0                	mov    %esi,%eax
+ ba8:	5b                   	pop    %ebx
+ ba9:	5e                   	pop    %esi
+ baa:	5f                   	pop    %edi
+ bab:	5d                   	pop    %ebp
+ bac:	c3                   	ret
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ bb0:	83 ec 0c             	sub    $0xc,%esp
+ bb3:	50                   	push   %eax
+ bb4:	e8 77 fe ff ff       	call   a30 <malloc>
+ bb9:	83 c4 10             	add    $0x10,%esp
+ bbc:	89 c6                	mov    %eax,%esi
+ bbe:	85 c0                	test   %eax,%eax
+ bc0:	74 e1                	je     ba3 <realloc+0x23>
+  memmove(p, ap, have);
+ bc2:	83 ec 04             	sub    $0x4,%esp
+ bc5:	57                   	push   %edi
+ bc6:	53                   	push   %ebx
+ bc7:	50                   	push   %eax
+ bc8:	e8 b3 f8 ff ff       	call   480 <memmove>
+  free(ap);
+ bcd:	89 1c 24             	mov    %ebx,(%esp)
+ bd0:	e8 eb fd ff ff       	call   9c0 <free>
+  return p;
+ bd5:	83 c4 10             	add    $0x10,%esp
+}
+ bd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bdb:	89 f0                	mov    %esi,%eax
+ bdd:	5b                   	pop    %ebx
+ bde:	5e                   	pop    %esi
+ bdf:	5f                   	pop    %edi
+ be0:	5d                   	pop    %ebp
+ be1:	c3                   	ret
+ be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ be8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ beb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bee:	5b                   	pop    %ebx
+ bef:	5e                   	pop    %esi
+ bf0:	5f                   	pop    %edi
+ bf1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ bf2:	e9 39 fe ff ff       	jmp    a30 <malloc>
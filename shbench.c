@@ -0,0 +1,66 @@
+// Measure how many commands per second the shell runs.  Feeds
+// sh a script of N trivial commands (this program with -n) as a
+// simple command, as a two-stage pipeline, and in parentheses,
+// which sh still runs with fork()+exec().
+
+#include "types.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define N 100
+#define SCRIPT "shbench.sh"
+#define LOG    "shbench.out"
+
+static int
+run(char *line)
+{
+  char *args[2];
+  int fd, i, start;
+
+  if((fd = open(SCRIPT, O_CREATE|O_RDWR)) < 0){
+    printf(2, "shbench: cannot create %s\n", SCRIPT);
+    exit();
+  }
+  for(i = 0; i < N; i++)
+    write(fd, line, strlen(line));
+  close(fd);
+
+  start = uptime();
+  if(fork() == 0){
+    // sh prints a prompt per command on fd 2; keep it off the console.
+    close(0);
+    open(SCRIPT, O_RDONLY);
+    close(2);
+    open(LOG, O_CREATE|O_RDWR);
+    args[0] = "sh";
+    args[1] = 0;
+    exec("sh", args);
+    printf(1, "shbench: exec sh failed\n");
+    exit();
+  }
+  wait();
+  unlink(SCRIPT);
+  unlink(LOG);
+  return uptime() - start;
+}
+
+static void
+report(char *what, int t)
+{
+  if(t == 0)
+    t = 1;
+  printf(1, "%s: %d commands in %d ms, %d per second\n",
+         what, N, t, N * 1000 / t);
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc > 1 && strcmp(argv[1], "-n") == 0)
+    exit();
+
+  report("simple (spawn)", run("shbench -n\n"));
+  report("pipeline (spawn)", run("shbench -n | shbench -n\n"));
+  report("subshell (fork+exec)", run("(shbench -n)\n"));
+  exit();
+}
@@ -0,0 +1,1748 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 48 0b 00 00       	push   $0xb48
+  44:	6a 01                	push   $0x1
+  46:	e8 b5 05 00 00       	call   600 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 85 01 00 00       	call   1e0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 98 03 00 00       	call   3fb <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 5b 0b 00 00       	push   $0xb5b
+  78:	6a 01                	push   $0x1
+  7a:	e8 81 05 00 00       	call   600 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 a6 03 00 00       	call   443 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 6c 03 00 00       	call   423 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 63 03 00 00       	call   42b <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 65 0b 00 00       	push   $0xb65
+  cf:	6a 01                	push   $0x1
+  d1:	e8 2a 05 00 00       	call   600 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 58 03 00 00       	call   443 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 1c 03 00 00       	call   41b <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 1b 03 00 00       	call   42b <close>
+
+  wait();
+ 110:	e8 f6 02 00 00       	call   40b <wait>
+
+  exit();
+ 115:	e8 e9 02 00 00       	call   403 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 be 01 00 00       	call   41b <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 91 01 00 00       	call   443 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 94 01 00 00       	call   45b <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 5a 01 00 00       	call   42b <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	56                   	push   %esi
+ 2f4:	53                   	push   %ebx
+ 2f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2f8:	0f b6 02             	movzbl (%edx),%eax
+ 2fb:	3c 20                	cmp    $0x20,%al
+ 2fd:	75 0c                	jne    30b <atoi+0x1b>
+ 2ff:	90                   	nop
+ 300:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 304:	83 c2 01             	add    $0x1,%edx
+ 307:	3c 20                	cmp    $0x20,%al
+ 309:	74 f5                	je     300 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 30b:	3c 2d                	cmp    $0x2d,%al
+ 30d:	74 41                	je     350 <atoi+0x60>
+ 30f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 314:	3c 2b                	cmp    $0x2b,%al
+ 316:	74 3d                	je     355 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 318:	0f be 0a             	movsbl (%edx),%ecx
+ 31b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 31e:	3c 09                	cmp    $0x9,%al
+ 320:	b8 00 00 00 00       	mov    $0x0,%eax
+ 325:	77 21                	ja     348 <atoi+0x58>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 330:	83 c2 01             	add    $0x1,%edx
+ 333:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 336:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 33a:	0f be 0a             	movsbl (%edx),%ecx
+ 33d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 eb                	jbe    330 <atoi+0x40>
+  return sign*n;
+ 345:	0f af c6             	imul   %esi,%eax
+}
+ 348:	5b                   	pop    %ebx
+ 349:	5e                   	pop    %esi
+ 34a:	5d                   	pop    %ebp
+ 34b:	c3                   	ret
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 350:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 355:	83 c2 01             	add    $0x1,%edx
+ 358:	eb be                	jmp    318 <atoi+0x28>
+ 35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000360 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+ 364:	53                   	push   %ebx
+ 365:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 368:	0f b6 02             	movzbl (%edx),%eax
+ 36b:	3c 20                	cmp    $0x20,%al
+ 36d:	75 0c                	jne    37b <atoo+0x1b>
+ 36f:	90                   	nop
+ 370:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 374:	83 c2 01             	add    $0x1,%edx
+ 377:	3c 20                	cmp    $0x20,%al
+ 379:	74 f5                	je     370 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 37b:	3c 2d                	cmp    $0x2d,%al
+ 37d:	74 41                	je     3c0 <atoo+0x60>
+ 37f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 384:	3c 2b                	cmp    $0x2b,%al
+ 386:	74 3d                	je     3c5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 388:	0f be 0a             	movsbl (%edx),%ecx
+ 38b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 38e:	3c 07                	cmp    $0x7,%al
+ 390:	b8 00 00 00 00       	mov    $0x0,%eax
+ 395:	77 1e                	ja     3b5 <atoo+0x55>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 3a0:	83 c2 01             	add    $0x1,%edx
+ 3a3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 3a7:	0f be 0a             	movsbl (%edx),%ecx
+ 3aa:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 3ad:	80 fb 07             	cmp    $0x7,%bl
+ 3b0:	76 ee                	jbe    3a0 <atoo+0x40>
+  return sign*n;
+ 3b2:	0f af c6             	imul   %esi,%eax
+}
+ 3b5:	5b                   	pop    %ebx
+ 3b6:	5e                   	pop    %esi
+ 3b7:	5d                   	pop    %ebp
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 3c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 3c5:	83 c2 01             	add    $0x1,%edx
+ 3c8:	eb be                	jmp    388 <atoo+0x28>
+ 3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003d0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7e 13                	jle    3f5 <memmove+0x25>
+ 3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3e4:	89 d7                	mov    %edx,%edi
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3f1:	39 f8                	cmp    %edi,%eax
+ 3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+ 3f5:	5e                   	pop    %esi
+ 3f6:	89 d0                	mov    %edx,%eax
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+ 3fa:	c3                   	ret
+
+000003fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <exit>:
+SYSCALL(exit)
+ 403:	b8 02 00 00 00       	mov    $0x2,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <wait>:
+SYSCALL(wait)
+ 40b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <pipe>:
+SYSCALL(pipe)
+ 413:	b8 04 00 00 00       	mov    $0x4,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <read>:
+SYSCALL(read)
+ 41b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <write>:
+SYSCALL(write)
+ 423:	b8 10 00 00 00       	mov    $0x10,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <close>:
+SYSCALL(close)
+ 42b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <kill>:
+SYSCALL(kill)
+ 433:	b8 06 00 00 00       	mov    $0x6,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <exec>:
+SYSCALL(exec)
+ 43b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <open>:
+SYSCALL(open)
+ 443:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mknod>:
+SYSCALL(mknod)
+ 44b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <unlink>:
+SYSCALL(unlink)
+ 453:	b8 12 00 00 00       	mov    $0x12,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <fstat>:
+SYSCALL(fstat)
+ 45b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <link>:
+SYSCALL(link)
+ 463:	b8 13 00 00 00       	mov    $0x13,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mkdir>:
+SYSCALL(mkdir)
+ 46b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <chdir>:
+SYSCALL(chdir)
+ 473:	b8 09 00 00 00       	mov    $0x9,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <dup>:
+SYSCALL(dup)
+ 47b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getpid>:
+SYSCALL(getpid)
+ 483:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <sbrk>:
+SYSCALL(sbrk)
+ 48b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <sleep>:
+SYSCALL(sleep)
+ 493:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <uptime>:
+SYSCALL(uptime)
+ 49b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <superpages>:
+SYSCALL(superpages)
+ 4a3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mmap>:
+SYSCALL(mmap)
+ 4ab:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <munmap>:
+SYSCALL(munmap)
+ 4b3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <spawn>:
+SYSCALL(spawn)
+ 4bb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <swapstat>:
+SYSCALL(swapstat)
+ 4c3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <getmeminfo>:
+SYSCALL(getmeminfo)
+ 4cb:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <iostat>:
+SYSCALL(iostat)
+ 4d3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <dropcache>:
+SYSCALL(dropcache)
+ 4db:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <iosched>:
+SYSCALL(iosched)
+ 4e3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <halt>:
+SYSCALL(halt)
+ 4eb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <date>:
+SYSCALL(date)
+ 4f3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 4fb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <getgid>:
+SYSCALL(getgid)
+ 503:	b8 19 00 00 00       	mov    $0x19,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <getppid>:
+SYSCALL(getppid)
+ 50b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <setuid>:
+SYSCALL(setuid)
+ 513:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <setgid>:
+SYSCALL(setgid)
+ 51b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getprocs>:
+SYSCALL(getprocs)
+ 523:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 52b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <getpriority>:
+SYSCALL(getpriority)
+ 533:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 53b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <chown>:
+SYSCALL(chown)
+ 543:	b8 21 00 00 00       	mov    $0x21,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <chgrp>:
+SYSCALL(chgrp)
+ 54b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+ 553:	66 90                	xchg   %ax,%ax
+ 555:	66 90                	xchg   %ax,%ax
+ 557:	66 90                	xchg   %ax,%ax
+ 559:	66 90                	xchg   %ax,%ax
+ 55b:	66 90                	xchg   %ax,%ax
+ 55d:	66 90                	xchg   %ax,%ax
+ 55f:	90                   	nop
+
+00000560 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 568:	89 d1                	mov    %edx,%ecx
+{
+ 56a:	83 ec 3c             	sub    $0x3c,%esp
+ 56d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 570:	85 d2                	test   %edx,%edx
+ 572:	0f 89 80 00 00 00    	jns    5f8 <printint+0x98>
+ 578:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 57c:	74 7a                	je     5f8 <printint+0x98>
+    x = -xx;
+ 57e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 580:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 585:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 588:	31 f6                	xor    %esi,%esi
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 590:	89 c8                	mov    %ecx,%eax
+ 592:	31 d2                	xor    %edx,%edx
+ 594:	89 f7                	mov    %esi,%edi
+ 596:	f7 f3                	div    %ebx
+ 598:	8d 76 01             	lea    0x1(%esi),%esi
+ 59b:	0f b6 92 cc 0b 00 00 	movzbl 0xbcc(%edx),%edx
+ 5a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5a6:	89 ca                	mov    %ecx,%edx
+ 5a8:	89 c1                	mov    %eax,%ecx
+ 5aa:	39 da                	cmp    %ebx,%edx
+ 5ac:	73 e2                	jae    590 <printint+0x30>
+  if(neg)
+ 5ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5b1:	85 c0                	test   %eax,%eax
+ 5b3:	74 07                	je     5bc <printint+0x5c>
+    buf[i++] = '-';
+ 5b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ba:	89 f7                	mov    %esi,%edi
+ 5bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5c2:	01 df                	add    %ebx,%edi
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	50                   	push   %eax
+ 5d7:	56                   	push   %esi
+ 5d8:	e8 46 fe ff ff       	call   423 <write>
+  while(--i >= 0)
+ 5dd:	89 f8                	mov    %edi,%eax
+ 5df:	83 c4 10             	add    $0x10,%esp
+ 5e2:	83 ef 01             	sub    $0x1,%edi
+ 5e5:	39 d8                	cmp    %ebx,%eax
+ 5e7:	75 df                	jne    5c8 <printint+0x68>
+}
+ 5e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ec:	5b                   	pop    %ebx
+ 5ed:	5e                   	pop    %esi
+ 5ee:	5f                   	pop    %edi
+ 5ef:	5d                   	pop    %ebp
+ 5f0:	c3                   	ret
+ 5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5f8:	31 c0                	xor    %eax,%eax
+ 5fa:	eb 89                	jmp    585 <printint+0x25>
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 609:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 60c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 60f:	0f b6 1e             	movzbl (%esi),%ebx
+ 612:	83 c6 01             	add    $0x1,%esi
+ 615:	84 db                	test   %bl,%bl
+ 617:	74 67                	je     680 <printf+0x80>
+ 619:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 61c:	31 d2                	xor    %edx,%edx
+ 61e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 621:	eb 34                	jmp    657 <printf+0x57>
+ 623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 627:	90                   	nop
+ 628:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 62b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 630:	83 f8 25             	cmp    $0x25,%eax
+ 633:	74 18                	je     64d <printf+0x4d>
+  write(fd, &c, 1);
+ 635:	83 ec 04             	sub    $0x4,%esp
+ 638:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 63b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63e:	6a 01                	push   $0x1
+ 640:	50                   	push   %eax
+ 641:	57                   	push   %edi
+ 642:	e8 dc fd ff ff       	call   423 <write>
+ 647:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 64a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 64d:	0f b6 1e             	movzbl (%esi),%ebx
+ 650:	83 c6 01             	add    $0x1,%esi
+ 653:	84 db                	test   %bl,%bl
+ 655:	74 29                	je     680 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 657:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 65a:	85 d2                	test   %edx,%edx
+ 65c:	74 ca                	je     628 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 65e:	83 fa 25             	cmp    $0x25,%edx
+ 661:	75 ea                	jne    64d <printf+0x4d>
+      if(c == 'd'){
+ 663:	83 f8 25             	cmp    $0x25,%eax
+ 666:	0f 84 24 01 00 00    	je     790 <printf+0x190>
+ 66c:	83 e8 63             	sub    $0x63,%eax
+ 66f:	83 f8 15             	cmp    $0x15,%eax
+ 672:	77 1c                	ja     690 <printf+0x90>
+ 674:	ff 24 85 74 0b 00 00 	jmp    *0xb74(,%eax,4)
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 683:	5b                   	pop    %ebx
+ 684:	5e                   	pop    %esi
+ 685:	5f                   	pop    %edi
+ 686:	5d                   	pop    %ebp
+ 687:	c3                   	ret
+ 688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 696:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 69a:	6a 01                	push   $0x1
+ 69c:	52                   	push   %edx
+ 69d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6a0:	57                   	push   %edi
+ 6a1:	e8 7d fd ff ff       	call   423 <write>
+ 6a6:	83 c4 0c             	add    $0xc,%esp
+ 6a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6b1:	52                   	push   %edx
+ 6b2:	57                   	push   %edi
+ 6b3:	e8 6b fd ff ff       	call   423 <write>
+        putc(fd, c);
+ 6b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bb:	31 d2                	xor    %edx,%edx
+ 6bd:	eb 8e                	jmp    64d <printf+0x4d>
+ 6bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+ 6c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6cb:	8b 13                	mov    (%ebx),%edx
+ 6cd:	6a 00                	push   $0x0
+ 6cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6d4:	e8 87 fe ff ff       	call   560 <printint>
+        ap++;
+ 6d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6df:	31 d2                	xor    %edx,%edx
+ 6e1:	e9 67 ff ff ff       	jmp    64d <printf+0x4d>
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6f5:	83 c0 04             	add    $0x4,%eax
+ 6f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6fb:	85 db                	test   %ebx,%ebx
+ 6fd:	0f 84 9d 00 00 00    	je     7a0 <printf+0x1a0>
+        while(*s != 0){
+ 703:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 706:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 708:	84 c0                	test   %al,%al
+ 70a:	0f 84 3d ff ff ff    	je     64d <printf+0x4d>
+ 710:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 713:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 716:	89 de                	mov    %ebx,%esi
+ 718:	89 d3                	mov    %edx,%ebx
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 726:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	53                   	push   %ebx
+ 72c:	57                   	push   %edi
+ 72d:	e8 f1 fc ff ff       	call   423 <write>
+        while(*s != 0){
+ 732:	0f b6 06             	movzbl (%esi),%eax
+ 735:	83 c4 10             	add    $0x10,%esp
+ 738:	84 c0                	test   %al,%al
+ 73a:	75 e4                	jne    720 <printf+0x120>
+      state = 0;
+ 73c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 07 ff ff ff       	jmp    64d <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 75b:	8b 13                	mov    (%ebx),%edx
+ 75d:	6a 01                	push   $0x1
+ 75f:	e9 6b ff ff ff       	jmp    6cf <printf+0xcf>
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 768:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 771:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 773:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 776:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	52                   	push   %edx
+ 77c:	57                   	push   %edi
+ 77d:	e8 a1 fc ff ff       	call   423 <write>
+        ap++;
+ 782:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 785:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 788:	31 d2                	xor    %edx,%edx
+ 78a:	e9 be fe ff ff       	jmp    64d <printf+0x4d>
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 796:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 799:	6a 01                	push   $0x1
+ 79b:	e9 11 ff ff ff       	jmp    6b1 <printf+0xb1>
+ 7a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7a5:	bb 6b 0b 00 00       	mov    $0xb6b,%ebx
+ 7aa:	e9 61 ff ff ff       	jmp    710 <printf+0x110>
+ 7af:	90                   	nop
+
+000007b0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b3:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+{
+ 7b8:	89 e5                	mov    %esp,%ebp
+ 7ba:	56                   	push   %esi
+ 7bb:	53                   	push   %ebx
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c4:	39 ca                	cmp    %ecx,%edx
+ 7c6:	73 30                	jae    7f8 <lfree+0x48>
+ 7c8:	39 c1                	cmp    %eax,%ecx
+ 7ca:	72 04                	jb     7d0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7cc:	39 c2                	cmp    %eax,%edx
+ 7ce:	72 f0                	jb     7c0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7d0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 7d3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 7d6:	39 f0                	cmp    %esi,%eax
+ 7d8:	74 26                	je     800 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7da:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7dc:	8b 42 04             	mov    0x4(%edx),%eax
+ 7df:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 7e2:	39 d9                	cmp    %ebx,%ecx
+ 7e4:	74 30                	je     816 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7e6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7e8:	5b                   	pop    %ebx
+  freep = p;
+ 7e9:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+}
+ 7ef:	5e                   	pop    %esi
+ 7f0:	5d                   	pop    %ebp
+ 7f1:	c3                   	ret
+ 7f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f8:	39 c1                	cmp    %eax,%ecx
+ 7fa:	72 d0                	jb     7cc <lfree+0x1c>
+ 7fc:	eb c2                	jmp    7c0 <lfree+0x10>
+ 7fe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 800:	03 58 04             	add    0x4(%eax),%ebx
+ 803:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 806:	8b 02                	mov    (%edx),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 80c:	8b 42 04             	mov    0x4(%edx),%eax
+ 80f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 812:	39 d9                	cmp    %ebx,%ecx
+ 814:	75 d0                	jne    7e6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 816:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 819:	89 15 c4 0f 00 00    	mov    %edx,0xfc4
+    p->s.size += bp->s.size;
+ 81f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 822:	8b 09                	mov    (%ecx),%ecx
+ 824:	89 0a                	mov    %ecx,(%edx)
+}
+ 826:	5b                   	pop    %ebx
+ 827:	5e                   	pop    %esi
+ 828:	5d                   	pop    %ebp
+ 829:	c3                   	ret
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000830 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	89 c7                	mov    %eax,%edi
+ 836:	56                   	push   %esi
+ 837:	53                   	push   %ebx
+ 838:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 83b:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+ 840:	85 c0                	test   %eax,%eax
+ 842:	0f 84 88 00 00 00    	je     8d0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 848:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 84a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 84d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 852:	39 df                	cmp    %ebx,%edi
+ 854:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 857:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 85e:	39 f9                	cmp    %edi,%ecx
+ 860:	72 0f                	jb     871 <lalloc+0x41>
+ 862:	eb 4c                	jmp    8b0 <lalloc+0x80>
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 868:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 86a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 86d:	39 f9                	cmp    %edi,%ecx
+ 86f:	73 3f                	jae    8b0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 871:	89 d0                	mov    %edx,%eax
+ 873:	39 15 c4 0f 00 00    	cmp    %edx,0xfc4
+ 879:	75 ed                	jne    868 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 87b:	83 ec 0c             	sub    $0xc,%esp
+ 87e:	56                   	push   %esi
+ 87f:	e8 07 fc ff ff       	call   48b <sbrk>
+  if(p == (char*)-1)
+ 884:	83 c4 10             	add    $0x10,%esp
+ 887:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 88a:	74 11                	je     89d <lalloc+0x6d>
+  hp->s.size = nu;
+ 88c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 88f:	e8 1c ff ff ff       	call   7b0 <lfree>
+  return freep;
+ 894:	a1 c4 0f 00 00       	mov    0xfc4,%eax
+      if((p = morecore(nunits)) == 0)
+ 899:	85 c0                	test   %eax,%eax
+ 89b:	75 cb                	jne    868 <lalloc+0x38>
+        return 0;
+  }
+}
+ 89d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8a0:	31 d2                	xor    %edx,%edx
+}
+ 8a2:	5b                   	pop    %ebx
+ 8a3:	89 d0                	mov    %edx,%eax
+ 8a5:	5e                   	pop    %esi
+ 8a6:	5f                   	pop    %edi
+ 8a7:	5d                   	pop    %ebp
+ 8a8:	c3                   	ret
+ 8a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 8b0:	39 cf                	cmp    %ecx,%edi
+ 8b2:	74 4c                	je     900 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 8b4:	29 f9                	sub    %edi,%ecx
+ 8b6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 8b9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 8bc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 8bf:	a3 c4 0f 00 00       	mov    %eax,0xfc4
+}
+ 8c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8c7:	89 d0                	mov    %edx,%eax
+ 8c9:	5b                   	pop    %ebx
+ 8ca:	5e                   	pop    %esi
+ 8cb:	5f                   	pop    %edi
+ 8cc:	5d                   	pop    %ebp
+ 8cd:	c3                   	ret
+ 8ce:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 8d0:	ba c8 0f 00 00       	mov    $0xfc8,%edx
+ 8d5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 8d7:	c7 05 c4 0f 00 00 c8 	movl   $0xfc8,0xfc4
+ 8de:	0f 00 00 
+ 8e1:	c7 05 c8 0f 00 00 c8 	movl   $0xfc8,0xfc8
+ 8e8:	0f 00 00 
+ 8eb:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 8ed:	c7 05 cc 0f 00 00 00 	movl   $0x0,0xfcc
+ 8f4:	00 00 00 
+ 8f7:	e9 51 ff ff ff       	jmp    84d <lalloc+0x1d>
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 900:	8b 0a                	mov    (%edx),%ecx
+ 902:	89 08                	mov    %ecx,(%eax)
+ 904:	eb b9                	jmp    8bf <lalloc+0x8f>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000910 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 919:	85 f6                	test   %esi,%esi
+ 91b:	74 42                	je     95f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 91d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 920:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 923:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 929:	77 3d                	ja     968 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 92b:	31 c9                	xor    %ecx,%ecx
+ 92d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 932:	83 fa 02             	cmp    $0x2,%edx
+ 935:	74 17                	je     94e <free+0x3e>
+ 937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93e:	66 90                	xchg   %ax,%ax
+ 940:	83 c1 01             	add    $0x1,%ecx
+ 943:	89 d8                	mov    %ebx,%eax
+ 945:	d3 e0                	shl    %cl,%eax
+ 947:	83 c0 01             	add    $0x1,%eax
+ 94a:	39 c2                	cmp    %eax,%edx
+ 94c:	75 f2                	jne    940 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 94e:	8b 04 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%eax
+  classes[c] = bp;
+ 955:	89 3c 8d a0 0f 00 00 	mov    %edi,0xfa0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 95c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 95f:	5b                   	pop    %ebx
+ 960:	5e                   	pop    %esi
+ 961:	5f                   	pop    %edi
+ 962:	5d                   	pop    %ebp
+ 963:	c3                   	ret
+ 964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 968:	5b                   	pop    %ebx
+    lfree(bp);
+ 969:	89 f8                	mov    %edi,%eax
+}
+ 96b:	5e                   	pop    %esi
+ 96c:	5f                   	pop    %edi
+ 96d:	5d                   	pop    %ebp
+    lfree(bp);
+ 96e:	e9 3d fe ff ff       	jmp    7b0 <lfree>
+ 973:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000980 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 989:	8b 45 08             	mov    0x8(%ebp),%eax
+ 98c:	83 c0 07             	add    $0x7,%eax
+ 98f:	c1 e8 03             	shr    $0x3,%eax
+ 992:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 995:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 99a:	77 44                	ja     9e0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 99c:	31 c9                	xor    %ecx,%ecx
+ 99e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9a3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 9a8:	83 f8 02             	cmp    $0x2,%eax
+ 9ab:	76 11                	jbe    9be <malloc+0x3e>
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 9b0:	83 c1 01             	add    $0x1,%ecx
+ 9b3:	89 d3                	mov    %edx,%ebx
+ 9b5:	d3 e3                	shl    %cl,%ebx
+ 9b7:	83 c3 01             	add    $0x1,%ebx
+ 9ba:	39 c3                	cmp    %eax,%ebx
+ 9bc:	72 f2                	jb     9b0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 9be:	8b 04 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%eax
+ 9c5:	85 c0                	test   %eax,%eax
+ 9c7:	74 2f                	je     9f8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 9c9:	8b 10                	mov    (%eax),%edx
+ 9cb:	89 14 8d a0 0f 00 00 	mov    %edx,0xfa0(,%ecx,4)
+  return (void*)(p + 1);
+ 9d2:	83 c0 08             	add    $0x8,%eax
+}
+ 9d5:	83 c4 1c             	add    $0x1c,%esp
+ 9d8:	5b                   	pop    %ebx
+ 9d9:	5e                   	pop    %esi
+ 9da:	5f                   	pop    %edi
+ 9db:	5d                   	pop    %ebp
+ 9dc:	c3                   	ret
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 9e0:	e8 4b fe ff ff       	call   830 <lalloc>
+ 9e5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 9e7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 9ea:	85 d2                	test   %edx,%edx
+ 9ec:	75 e7                	jne    9d5 <malloc+0x55>
+      return 0;
+ 9ee:	31 c0                	xor    %eax,%eax
+ 9f0:	eb e3                	jmp    9d5 <malloc+0x55>
+ 9f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 9f8:	31 d2                	xor    %edx,%edx
+ 9fa:	b8 00 02 00 00       	mov    $0x200,%eax
+ 9ff:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a02:	f7 f3                	div    %ebx
+  if(n < 4)
+ a04:	ba 04 00 00 00       	mov    $0x4,%edx
+ a09:	89 d6                	mov    %edx,%esi
+ a0b:	39 d0                	cmp    %edx,%eax
+ a0d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ a10:	0f af f3             	imul   %ebx,%esi
+ a13:	89 f0                	mov    %esi,%eax
+ a15:	e8 16 fe ff ff       	call   830 <lalloc>
+ a1a:	85 c0                	test   %eax,%eax
+ a1c:	74 d0                	je     9ee <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ a1e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a21:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ a24:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a2b:	8b 14 8d a0 0f 00 00 	mov    0xfa0(,%ecx,4),%edx
+ a32:	39 f8                	cmp    %edi,%eax
+ a34:	73 22                	jae    a58 <malloc+0xd8>
+ a36:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a39:	eb 09                	jmp    a44 <malloc+0xc4>
+ a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+ a40:	89 c2                	mov    %eax,%edx
+ a42:	89 c8                	mov    %ecx,%eax
+ a44:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ a47:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ a4a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ a4c:	39 f9                	cmp    %edi,%ecx
+ a4e:	72 f0                	jb     a40 <malloc+0xc0>
+ a50:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a53:	e9 73 ff ff ff       	jmp    9cb <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ a58:	89 d0                	mov    %edx,%eax
+ a5a:	8b 12                	mov    (%edx),%edx
+ a5c:	e9 6a ff ff ff       	jmp    9cb <malloc+0x4b>
+ a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+
+00000a70 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	56                   	push   %esi
+ a74:	53                   	push   %ebx
+ a75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a78:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ a7b:	85 c9                	test   %ecx,%ecx
+ a7d:	74 06                	je     a85 <calloc+0x15>
+ a7f:	89 c8                	mov    %ecx,%eax
+ a81:	f7 e3                	mul    %ebx
+ a83:	70 33                	jo     ab8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ a85:	0f af d9             	imul   %ecx,%ebx
+ a88:	83 ec 0c             	sub    $0xc,%esp
+ a8b:	53                   	push   %ebx
+ a8c:	e8 ef fe ff ff       	call   980 <malloc>
+ a91:	83 c4 10             	add    $0x10,%esp
+ a94:	89 c6                	mov    %eax,%esi
+ a96:	85 c0                	test   %eax,%eax
+ a98:	74 1e                	je     ab8 <calloc+0x48>
+    memset(p, 0, n * size);
+ a9a:	83 ec 04             	sub    $0x4,%esp
+ a9d:	53                   	push   %ebx
+ a9e:	6a 00                	push   $0x0
+ aa0:	50                   	push   %eax
+ aa1:	e8 3a f7 ff ff       	call   1e0 <memset>
+ aa6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ aa9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ aac:	89 f0                	mov    %esi,%eax
+ aae:	5b                   	pop    %ebx
+ aaf:	5e                   	pop    %esi
+ ab0:	5d                   	pop    %ebp
+ ab1:	c3                   	ret
+ ab2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ ab8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ abb:	31 f6                	xor    %esi,%esi
+}
+ abd:	89 f0                	mov    %esi,%eax
+ abf:	5b                   	pop    %ebx
+ ac0:	5e                   	pop    %esi
+ ac1:	5d                   	pop    %ebp
+ ac2:	c3                   	ret
+ ac3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ad0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 0c             	sub    $0xc,%esp
+ ad9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ adc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ adf:	85 db                	test   %ebx,%ebx
+ ae1:	74 55                	je     b38 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ae3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ae6:	89 de                	mov    %ebx,%esi
+ ae8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ aef:	39 c7                	cmp    %eax,%edi
+ af1:	72 0d                	jb     b00 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ af3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ af6:	89 f0                	mov    %esi,%eax
+ af8:	5b                   	pop    %ebx
+ af9:	5e                   	pop    %esi
+ afa:	5f                   	pop    %edi
+ afb:	5d                   	pop    %ebp
+ afc:	c3                   	ret
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ b00:	83 ec 0c             	sub    $0xc,%esp
+ b03:	50                   	push   %eax
+ b04:	e8 77 fe ff ff       	call   980 <malloc>
+ b09:	83 c4 10             	add    $0x10,%esp
+ b0c:	89 c6                	mov    %eax,%esi
+ b0e:	85 c0                	test   %eax,%eax
+ b10:	74 e1                	je     af3 <realloc+0x23>
+  memmove(p, ap, have);
+ b12:	83 ec 04             	sub    $0x4,%esp
+ b15:	57                   	push   %edi
+ b16:	53                   	push   %ebx
+ b17:	50                   	push   %eax
+ b18:	e8 b3 f8 ff ff       	call   3d0 <memmove>
+  free(ap);
+ b1d:	89 1c 24             	mov    %ebx,(%esp)
+ b20:	e8 eb fd ff ff       	call   910 <free>
+  return p;
+ b25:	83 c4 10             	add    $0x10,%esp
+}
+ b28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b2b:	89 f0                	mov    %esi,%eax
+ b2d:	5b                   	pop    %ebx
+ b2e:	5e                   	pop    %esi
+ b2f:	5f                   	pop    %edi
+ b30:	5d                   	pop    %ebp
+ b31:	c3                   	ret
+ b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b38:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b3e:	5b                   	pop    %ebx
+ b3f:	5e                   	pop    %esi
+ b40:	5f                   	pop    %edi
+ b41:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ b42:	e9 39 fe ff ff       	jmp    980 <malloc>
@@ -0,0 +1,203 @@
+// Swap space.
+//
+// mkfs reserves sb.nswap blocks after the file system, starting
+// at sb.swapstart.  When a page is needed and kalloc() has none,
+// kallocsw() calls swapout(), which picks a victim user page (see
+// swapvictim in proc.c), writes it to a free slot and frees it.  The victim's PTE keeps
+// the slot number with PTE_SWAP set and PTE_P clear, and the next
+// touch faults it back in through swapin().
+//
+// Swap I/O bypasses the buffer cache: one private buf is used,
+// and swap.lock serializes all swap I/O.  A process faulting on a
+// page that is still being written out waits for the lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "swap.h"
+
+#define BPP       (PGSIZE/BSIZE)   // blocks per page
+#define MAXSWAPPG (SWAPSIZE/BPP)
+
+struct {
+  struct sleeplock lock;   // held during swap I/O
+  struct spinlock slock;   // protects the fields below
+  uint dev;
+  uint start;              // first block of swap space
+  uint nslot;              // pages of swap space
+  uint used;
+  uint pageouts;
+  uint pageins;
+  uchar map[MAXSWAPPG/8];  // bit set if slot in use
+  struct buf io;
+  uchar iodata[BSIZE];
+} swap;
+
+void
+swapinit(int dev)
+{
+  struct superblock sb;
+
+  initsleeplock(&swap.lock, "swap");
+  initlock(&swap.slock, "swapmap");
+  initsleeplock(&swap.io.lock, "swapbuf");
+  swap.io.data = swap.iodata;
+  readsb(dev, &sb);
+  swap.dev = dev;
+  swap.start = sb.swapstart;
+  swap.nslot = sb.nswap / BPP;
+  if(swap.nslot > MAXSWAPPG)
+    swap.nslot = MAXSWAPPG;
+  cprintf("swap: %d pages at block %d\n", swap.nslot, swap.start);
+}
+
+// Allocate a swap slot.  Returns -1 if swap is full.
+static int
+slotalloc(void)
+{
+  uint i;
+
+  acquire(&swap.slock);
+  for(i = 0; i < swap.nslot; i++){
+    if((swap.map[i/8] & (1 << (i%8))) == 0){
+      swap.map[i/8] |= 1 << (i%8);
+      swap.used++;
+      release(&swap.slock);
+      return i;
+    }
+  }
+  release(&swap.slock);
+  return -1;
+}
+
+// Free swap slot, e.g. because the page that was in it has
+// been read back or its process unmapped it.
+void
+swapfree(uint slot)
+{
+  if(slot >= swap.nslot)
+    panic("swapfree");
+  acquire(&swap.slock);
+  if((swap.map[slot/8] & (1 << (slot%8))) == 0)
+    panic("swapfree: free slot");
+  swap.map[slot/8] &= ~(1 << (slot%8));
+  swap.used--;
+  release(&swap.slock);
+}
+
+// Read or write page mem from or to slot.  Caller holds swap.lock.
+static void
+swapio(char *mem, uint slot, int write)
+{
+  int i;
+
+  acquiresleep(&swap.io.lock);
+  for(i = 0; i < BPP; i++){
+    swap.io.dev = swap.dev;
+    swap.io.blockno = swap.start + slot*BPP + i;
+    if(write){
+      memmove(swap.io.data, mem + i*BSIZE, BSIZE);
+      swap.io.flags = B_VALID|B_DIRTY;
+    } else {
+      swap.io.flags = 0;
+    }
+    iderw(&swap.io);
+    if(!write)
+      memmove(mem + i*BSIZE, swap.io.data, BSIZE);
+  }
+  releasesleep(&swap.io.lock);
+}
+
+// Free one page of user memory by writing it to swap.
+// Returns 0 on success, -1 if swap is full or no page
+// could be evicted.  May sleep.
+int
+swapout(void)
+{
+  char *mem;
+  int slot;
+
+  if(swap.nslot == 0)
+    return -1;
+  acquiresleep(&swap.lock);
+  if((slot = slotalloc()) < 0){
+    releasesleep(&swap.lock);
+    return -1;
+  }
+  if((mem = swapvictim(slot)) == 0){
+    swapfree(slot);
+    releasesleep(&swap.lock);
+    return -1;
+  }
+  swapio(mem, slot, 1);
+  kfree(mem);
+  acquire(&swap.slock);
+  swap.pageouts++;
+  release(&swap.slock);
+  releasesleep(&swap.lock);
+  return 0;
+}
+
+// Allocate a page like kalloc(), swapping user pages out while
+// there is no free memory.  May sleep, so the caller must not
+// hold a spinlock; before swapinit() it is just kalloc().
+char*
+kallocsw(void)
+{
+  char *mem;
+
+  while((mem = kalloc()) == 0)
+    if(swapout() < 0)
+      return 0;
+  return mem;
+}
+
+// Read the page in slot into mem and free the slot.  pte must
+// still hold the swap entry for slot, else -1 (the caller should
+// look again).
+int
+swapin(pte_t *pte, char *mem)
+{
+  uint slot;
+
+  acquiresleep(&swap.lock);
+  if(!(*pte & PTE_SWAP)){
+    releasesleep(&swap.lock);
+    return -1;
+  }
+  slot = PTE_ADDR(*pte) >> PGSHIFT;
+  swapio(mem, slot, 0);
+  *pte = V2P(mem) | PTE_FLAGS(*pte & (PTE_W|PTE_U)) | PTE_P | PTE_A;
+  swapfree(slot);
+  acquire(&swap.slock);
+  swap.pageins++;
+  release(&swap.slock);
+  releasesleep(&swap.lock);
+  return 0;
+}
+
+// Copy the page in slot into mem, leaving the slot in place.
+void
+swapread(uint slot, char *mem)
+{
+  acquiresleep(&swap.lock);
+  swapio(mem, slot, 0);
+  releasesleep(&swap.lock);
+}
+
+void
+swapstat(struct swapstat *st)
+{
+  acquire(&swap.slock);
+  st->nslot = swap.nslot;
+  st->used = swap.used;
+  st->pageouts = swap.pageouts;
+  st->pageins = swap.pageins;
+  release(&swap.slock);
+}
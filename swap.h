@@ -0,0 +1,7 @@
+// Swap statistics, returned by the swapstat system call.
+struct swapstat {
+  uint nslot;       // pages of swap space
+  uint used;        // pages now in swap
+  uint pageouts;    // pages written to swap since boot
+  uint pageins;     // pages read back from swap since boot
+};
@@ -0,0 +1,1955 @@
+
+_swaptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         when, st.used, st.nslot, st.pageouts, st.pageins);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  struct meminfo mi;
+  uint size, i;
+  char *p, c;
+  int bad, start, pid, fd[2];
+
+  if(getmeminfo(&mi) < 0){
+   f:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+  12:	53                   	push   %ebx
+  13:	51                   	push   %ecx
+  14:	83 ec 64             	sub    $0x64,%esp
+  17:	8b 31                	mov    (%ecx),%esi
+  19:	8b 79 04             	mov    0x4(%ecx),%edi
+  if(getmeminfo(&mi) < 0){
+  1c:	50                   	push   %eax
+  1d:	e8 69 06 00 00       	call   68b <getmeminfo>
+  22:	83 c4 10             	add    $0x10,%esp
+  25:	85 c0                	test   %eax,%eax
+  27:	0f 88 ba 00 00 00    	js     e7 <main+0xe7>
+    printf(2, "swaptest: getmeminfo failed\n");
+    exit();
+  }
+  size = mi.total * PG + 16*1024*1024;
+  2d:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(argc > 1)
+  30:	83 fe 01             	cmp    $0x1,%esi
+  33:	0f 8f 83 00 00 00    	jg     bc <main+0xbc>
+  size = mi.total * PG + 16*1024*1024;
+  39:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  3f:	c1 e3 0c             	shl    $0xc,%ebx
+    size = atoi(argv[1]) * 1024 * 1024;
+  if(size < KEEP)
+    size = KEEP;
+  stats("before");
+  42:	b8 4a 0d 00 00       	mov    $0xd4a,%eax
+  47:	e8 44 02 00 00       	call   290 <stats>
+
+  // A process that forks once memory is full.
+  if(pipe(fd) < 0){
+  4c:	83 ec 0c             	sub    $0xc,%esp
+  4f:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  52:	50                   	push   %eax
+  53:	e8 7b 05 00 00       	call   5d3 <pipe>
+  58:	83 c4 10             	add    $0x10,%esp
+  5b:	85 c0                	test   %eax,%eax
+  5d:	78 75                	js     d4 <main+0xd4>
+    printf(2, "swaptest: pipe failed\n");
+    exit();
+  }
+  if((pid = fork()) == 0){
+  5f:	e8 57 05 00 00       	call   5bb <fork>
+  64:	85 c0                	test   %eax,%eax
+  66:	0f 85 8e 00 00 00    	jne    fa <main+0xfa>
+    close(fd[1]);
+  6c:	83 ec 0c             	sub    $0xc,%esp
+  6f:	ff 75 bc             	push   -0x44(%ebp)
+  72:	e8 74 05 00 00       	call   5eb <close>
+    read(fd[0], &c, 1);
+  77:	83 c4 0c             	add    $0xc,%esp
+  7a:	8d 45 b7             	lea    -0x49(%ebp),%eax
+  7d:	6a 01                	push   $0x1
+  7f:	50                   	push   %eax
+  80:	ff 75 b8             	push   -0x48(%ebp)
+  83:	e8 53 05 00 00       	call   5db <read>
+    if((pid = fork()) == 0)
+  88:	e8 2e 05 00 00       	call   5bb <fork>
+  8d:	83 c4 10             	add    $0x10,%esp
+  90:	85 c0                	test   %eax,%eax
+  92:	0f 84 df 01 00 00    	je     277 <main+0x277>
+      exit();
+    if(pid > 0)
+      wait();
+    printf(1, "fork with memory full: %s\n", pid > 0 ? "ok" : "FAILED");
+  98:	b8 26 0d 00 00       	mov    $0xd26,%eax
+    if(pid > 0)
+  9d:	7e 0a                	jle    a9 <main+0xa9>
+      wait();
+  9f:	e8 27 05 00 00       	call   5cb <wait>
+    printf(1, "fork with memory full: %s\n", pid > 0 ? "ok" : "FAILED");
+  a4:	b8 23 0d 00 00       	mov    $0xd23,%eax
+  a9:	52                   	push   %edx
+  aa:	50                   	push   %eax
+  ab:	68 68 0d 00 00       	push   $0xd68
+  b0:	6a 01                	push   $0x1
+  b2:	e8 09 07 00 00       	call   7c0 <printf>
+    exit();
+  b7:	e8 07 05 00 00       	call   5c3 <exit>
+    size = atoi(argv[1]) * 1024 * 1024;
+  bc:	83 ec 0c             	sub    $0xc,%esp
+  bf:	ff 77 04             	push   0x4(%edi)
+  c2:	e8 e9 03 00 00       	call   4b0 <atoi>
+  c7:	83 c4 10             	add    $0x10,%esp
+  ca:	c1 e0 14             	shl    $0x14,%eax
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	e9 6e ff ff ff       	jmp    42 <main+0x42>
+    printf(2, "swaptest: pipe failed\n");
+  d4:	51                   	push   %ecx
+  d5:	51                   	push   %ecx
+  d6:	68 51 0d 00 00       	push   $0xd51
+  db:	6a 02                	push   $0x2
+  dd:	e8 de 06 00 00       	call   7c0 <printf>
+    exit();
+  e2:	e8 dc 04 00 00       	call   5c3 <exit>
+    printf(2, "swaptest: getmeminfo failed\n");
+  e7:	53                   	push   %ebx
+  e8:	53                   	push   %ebx
+  e9:	68 2d 0d 00 00       	push   $0xd2d
+  ee:	6a 02                	push   $0x2
+  f0:	e8 cb 06 00 00       	call   7c0 <printf>
+    exit();
+  f5:	e8 c9 04 00 00       	call   5c3 <exit>
+  if(size < KEEP)
+  fa:	b8 00 00 80 00       	mov    $0x800000,%eax
+  ff:	39 c3                	cmp    %eax,%ebx
+ 101:	0f 42 d8             	cmovb  %eax,%ebx
+  }
+  close(fd[0]);
+ 104:	83 ec 0c             	sub    $0xc,%esp
+ 107:	ff 75 b8             	push   -0x48(%ebp)
+ 10a:	e8 dc 04 00 00       	call   5eb <close>
+
+  if((p = sbrk(size)) == (char*)-1){
+ 10f:	89 1c 24             	mov    %ebx,(%esp)
+ 112:	e8 34 05 00 00       	call   64b <sbrk>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	89 c7                	mov    %eax,%edi
+ 11c:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 11f:	0f 84 57 01 00 00    	je     27c <main+0x27c>
+    printf(2, "swaptest: sbrk %d failed\n", size);
+    exit();
+  }
+
+  start = uptime();
+ 125:	e8 31 05 00 00       	call   65b <uptime>
+ 12a:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < size; i += PG)
+ 12c:	31 c0                	xor    %eax,%eax
+ 12e:	66 90                	xchg   %ax,%ax
+    *(uint*)(p + i) = i ^ 0x5a5a5a5a;
+ 130:	89 c1                	mov    %eax,%ecx
+ 132:	81 f1 5a 5a 5a 5a    	xor    $0x5a5a5a5a,%ecx
+ 138:	89 0c 07             	mov    %ecx,(%edi,%eax,1)
+  for(i = 0; i < size; i += PG)
+ 13b:	05 00 10 00 00       	add    $0x1000,%eax
+ 140:	39 d8                	cmp    %ebx,%eax
+ 142:	72 ec                	jb     130 <main+0x130>
+  printf(1, "filled %d MB, %d page tables, in %d ms\n", size/(1024*1024),
+         (size + 4*1024*1024 - 1) / (4*1024*1024), uptime() - start);
+ 144:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+  printf(1, "filled %d MB, %d page tables, in %d ms\n", size/(1024*1024),
+ 147:	89 de                	mov    %ebx,%esi
+         (size + 4*1024*1024 - 1) / (4*1024*1024), uptime() - start);
+ 149:	e8 0d 05 00 00       	call   65b <uptime>
+  printf(1, "filled %d MB, %d page tables, in %d ms\n", size/(1024*1024),
+ 14e:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+ 151:	83 ec 0c             	sub    $0xc,%esp
+ 154:	c1 ee 14             	shr    $0x14,%esi
+ 157:	29 d0                	sub    %edx,%eax
+ 159:	50                   	push   %eax
+         (size + 4*1024*1024 - 1) / (4*1024*1024), uptime() - start);
+ 15a:	8d 83 ff ff 3f 00    	lea    0x3fffff(%ebx),%eax
+  printf(1, "filled %d MB, %d page tables, in %d ms\n", size/(1024*1024),
+ 160:	c1 e8 16             	shr    $0x16,%eax
+ 163:	50                   	push   %eax
+ 164:	56                   	push   %esi
+ 165:	68 28 0e 00 00       	push   $0xe28
+ 16a:	6a 01                	push   $0x1
+ 16c:	e8 4f 06 00 00       	call   7c0 <printf>
+  stats("after fill");
+ 171:	83 c4 20             	add    $0x20,%esp
+ 174:	b8 9d 0d 00 00       	mov    $0xd9d,%eax
+ 179:	e8 12 01 00 00       	call   290 <stats>
+  write(fd[1], "x", 1);
+ 17e:	51                   	push   %ecx
+ 17f:	6a 01                	push   $0x1
+ 181:	68 a8 0d 00 00       	push   $0xda8
+ 186:	ff 75 bc             	push   -0x44(%ebp)
+ 189:	e8 55 04 00 00       	call   5e3 <write>
+  close(fd[1]);
+ 18e:	58                   	pop    %eax
+ 18f:	ff 75 bc             	push   -0x44(%ebp)
+ 192:	e8 54 04 00 00       	call   5eb <close>
+  wait();
+ 197:	e8 2f 04 00 00       	call   5cb <wait>
+
+  start = uptime();
+ 19c:	e8 ba 04 00 00       	call   65b <uptime>
+ 1a1:	83 c4 10             	add    $0x10,%esp
+  bad = 0;
+ 1a4:	31 c9                	xor    %ecx,%ecx
+  start = uptime();
+ 1a6:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  for(i = 0; i < size; i += step)
+ 1a9:	31 c0                	xor    %eax,%eax
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+    if(*(uint*)(p + i) != (i ^ 0x5a5a5a5a))
+ 1b0:	89 c2                	mov    %eax,%edx
+ 1b2:	81 f2 5a 5a 5a 5a    	xor    $0x5a5a5a5a,%edx
+ 1b8:	39 14 07             	cmp    %edx,(%edi,%eax,1)
+ 1bb:	74 03                	je     1c0 <main+0x1c0>
+      bad++;
+ 1bd:	83 c1 01             	add    $0x1,%ecx
+  for(i = 0; i < size; i += step)
+ 1c0:	05 00 10 00 00       	add    $0x1000,%eax
+ 1c5:	39 d8                	cmp    %ebx,%eax
+ 1c7:	72 e7                	jb     1b0 <main+0x1b0>
+  bad = check(p, size, PG);
+  printf(1, "checked %d MB in %d ms: %s\n", size/(1024*1024),
+ 1c9:	85 c9                	test   %ecx,%ecx
+ 1cb:	b8 26 0d 00 00       	mov    $0xd26,%eax
+ 1d0:	ba 23 0d 00 00       	mov    $0xd23,%edx
+ 1d5:	0f 45 d0             	cmovne %eax,%edx
+ 1d8:	89 55 a0             	mov    %edx,-0x60(%ebp)
+         uptime() - start, bad ? "FAILED" : "ok");
+ 1db:	e8 7b 04 00 00       	call   65b <uptime>
+  printf(1, "checked %d MB in %d ms: %s\n", size/(1024*1024),
+ 1e0:	8b 55 a0             	mov    -0x60(%ebp),%edx
+ 1e3:	83 ec 0c             	sub    $0xc,%esp
+ 1e6:	52                   	push   %edx
+ 1e7:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+ 1ea:	29 d0                	sub    %edx,%eax
+ 1ec:	50                   	push   %eax
+ 1ed:	56                   	push   %esi
+ 1ee:	68 aa 0d 00 00       	push   $0xdaa
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	e8 c6 05 00 00       	call   7c0 <printf>
+  stats("after check");
+ 1fa:	83 c4 20             	add    $0x20,%esp
+ 1fd:	b8 c6 0d 00 00       	mov    $0xdc6,%eax
+ 202:	e8 89 00 00 00       	call   290 <stats>
+
+  // Keep the first 8 MB, which the clock swapped out first,
+  // and fork: the child's copy of it is read from swap.
+  sbrk(-(size - KEEP));
+ 207:	b8 00 00 80 00       	mov    $0x800000,%eax
+ 20c:	83 ec 0c             	sub    $0xc,%esp
+ 20f:	29 d8                	sub    %ebx,%eax
+ 211:	50                   	push   %eax
+ 212:	e8 34 04 00 00       	call   64b <sbrk>
+  if(fork() == 0){
+ 217:	e8 9f 03 00 00       	call   5bb <fork>
+ 21c:	83 c4 10             	add    $0x10,%esp
+ 21f:	85 c0                	test   %eax,%eax
+ 221:	75 45                	jne    268 <main+0x268>
+  for(i = 0; i < size; i += step)
+ 223:	31 d2                	xor    %edx,%edx
+ 225:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*(uint*)(p + i) != (i ^ 0x5a5a5a5a))
+ 228:	89 d1                	mov    %edx,%ecx
+ 22a:	81 f1 5a 5a 5a 5a    	xor    $0x5a5a5a5a,%ecx
+ 230:	3b 0c 17             	cmp    (%edi,%edx,1),%ecx
+ 233:	74 03                	je     238 <main+0x238>
+      bad++;
+ 235:	83 c0 01             	add    $0x1,%eax
+  for(i = 0; i < size; i += step)
+ 238:	81 c2 00 10 00 00    	add    $0x1000,%edx
+ 23e:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+ 244:	75 e2                	jne    228 <main+0x228>
+    bad = check(p, KEEP, PG);
+    printf(1, "child check: %s\n", bad ? "FAILED" : "ok");
+ 246:	ba 26 0d 00 00       	mov    $0xd26,%edx
+ 24b:	85 c0                	test   %eax,%eax
+ 24d:	b8 23 0d 00 00       	mov    $0xd23,%eax
+ 252:	0f 45 c2             	cmovne %edx,%eax
+ 255:	52                   	push   %edx
+ 256:	50                   	push   %eax
+ 257:	68 d2 0d 00 00       	push   $0xdd2
+ 25c:	6a 01                	push   $0x1
+ 25e:	e8 5d 05 00 00       	call   7c0 <printf>
+    exit();
+ 263:	e8 5b 03 00 00       	call   5c3 <exit>
+  }
+  wait();
+ 268:	e8 5e 03 00 00       	call   5cb <wait>
+  stats("after fork");
+ 26d:	b8 e3 0d 00 00       	mov    $0xde3,%eax
+ 272:	e8 19 00 00 00       	call   290 <stats>
+  exit();
+ 277:	e8 47 03 00 00       	call   5c3 <exit>
+    printf(2, "swaptest: sbrk %d failed\n", size);
+ 27c:	50                   	push   %eax
+ 27d:	53                   	push   %ebx
+ 27e:	68 83 0d 00 00       	push   $0xd83
+ 283:	6a 02                	push   $0x2
+ 285:	e8 36 05 00 00       	call   7c0 <printf>
+    exit();
+ 28a:	e8 34 03 00 00       	call   5c3 <exit>
+ 28f:	90                   	nop
+
+00000290 <stats>:
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	89 c3                	mov    %eax,%ebx
+  if(swapstat(&st) < 0){
+ 296:	8d 45 e8             	lea    -0x18(%ebp),%eax
+{
+ 299:	83 ec 20             	sub    $0x20,%esp
+  if(swapstat(&st) < 0){
+ 29c:	50                   	push   %eax
+ 29d:	e8 e1 03 00 00       	call   683 <swapstat>
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 24                	js     2cd <stats+0x3d>
+  printf(1, "%s: swap %d/%d pages used, %d page-outs, %d page-ins\n",
+ 2a9:	83 ec 04             	sub    $0x4,%esp
+ 2ac:	ff 75 f4             	push   -0xc(%ebp)
+ 2af:	ff 75 f0             	push   -0x10(%ebp)
+ 2b2:	ff 75 e8             	push   -0x18(%ebp)
+ 2b5:	ff 75 ec             	push   -0x14(%ebp)
+ 2b8:	53                   	push   %ebx
+ 2b9:	68 f0 0d 00 00       	push   $0xdf0
+ 2be:	6a 01                	push   $0x1
+ 2c0:	e8 fb 04 00 00       	call   7c0 <printf>
+ 2c5:	83 c4 20             	add    $0x20,%esp
+}
+ 2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+    printf(2, "swaptest: swapstat failed\n");
+ 2cd:	50                   	push   %eax
+ 2ce:	50                   	push   %eax
+ 2cf:	68 08 0d 00 00       	push   $0xd08
+ 2d4:	6a 02                	push   $0x2
+ 2d6:	e8 e5 04 00 00       	call   7c0 <printf>
+ 2db:	83 c4 10             	add    $0x10,%esp
+ 2de:	eb e8                	jmp    2c8 <stats+0x38>
+
+000002e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2e1:	31 c0                	xor    %eax,%eax
+{
+ 2e3:	89 e5                	mov    %esp,%ebp
+ 2e5:	53                   	push   %ebx
+ 2e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2f7:	83 c0 01             	add    $0x1,%eax
+ 2fa:	84 d2                	test   %dl,%dl
+ 2fc:	75 f2                	jne    2f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 301:	89 c8                	mov    %ecx,%eax
+ 303:	c9                   	leave
+ 304:	c3                   	ret
+ 305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+ 317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 31a:	0f b6 02             	movzbl (%edx),%eax
+ 31d:	84 c0                	test   %al,%al
+ 31f:	75 17                	jne    338 <strcmp+0x28>
+ 321:	eb 3a                	jmp    35d <strcmp+0x4d>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 32c:	83 c2 01             	add    $0x1,%edx
+ 32f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 332:	84 c0                	test   %al,%al
+ 334:	74 1a                	je     350 <strcmp+0x40>
+    p++, q++;
+ 336:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 338:	0f b6 19             	movzbl (%ecx),%ebx
+ 33b:	38 c3                	cmp    %al,%bl
+ 33d:	74 e9                	je     328 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 33f:	29 d8                	sub    %ebx,%eax
+}
+ 341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 344:	c9                   	leave
+ 345:	c3                   	ret
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 350:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 354:	31 c0                	xor    %eax,%eax
+ 356:	29 d8                	sub    %ebx,%eax
+}
+ 358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 35b:	c9                   	leave
+ 35c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 35d:	0f b6 19             	movzbl (%ecx),%ebx
+ 360:	31 c0                	xor    %eax,%eax
+ 362:	eb db                	jmp    33f <strcmp+0x2f>
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 376:	80 3a 00             	cmpb   $0x0,(%edx)
+ 379:	74 15                	je     390 <strlen+0x20>
+ 37b:	31 c0                	xor    %eax,%eax
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+ 380:	83 c0 01             	add    $0x1,%eax
+ 383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 387:	89 c1                	mov    %eax,%ecx
+ 389:	75 f5                	jne    380 <strlen+0x10>
+    ;
+  return n;
+}
+ 38b:	89 c8                	mov    %ecx,%eax
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+ 38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 390:	31 c9                	xor    %ecx,%ecx
+}
+ 392:	5d                   	pop    %ebp
+ 393:	89 c8                	mov    %ecx,%eax
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ad:	89 d7                	mov    %edx,%edi
+ 3af:	fc                   	cld
+ 3b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ca:	0f b6 10             	movzbl (%eax),%edx
+ 3cd:	84 d2                	test   %dl,%dl
+ 3cf:	75 12                	jne    3e3 <strchr+0x23>
+ 3d1:	eb 1d                	jmp    3f0 <strchr+0x30>
+ 3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3d7:	90                   	nop
+ 3d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3dc:	83 c0 01             	add    $0x1,%eax
+ 3df:	84 d2                	test   %dl,%dl
+ 3e1:	74 0d                	je     3f0 <strchr+0x30>
+    if(*s == c)
+ 3e3:	38 d1                	cmp    %dl,%cl
+ 3e5:	75 f1                	jne    3d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3e7:	5d                   	pop    %ebp
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3f0:	31 c0                	xor    %eax,%eax
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	c3                   	ret
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 405:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 408:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 409:	31 db                	xor    %ebx,%ebx
+{
+ 40b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 40e:	eb 27                	jmp    437 <gets+0x37>
+    cc = read(0, &c, 1);
+ 410:	83 ec 04             	sub    $0x4,%esp
+ 413:	6a 01                	push   $0x1
+ 415:	56                   	push   %esi
+ 416:	6a 00                	push   $0x0
+ 418:	e8 be 01 00 00       	call   5db <read>
+    if(cc < 1)
+ 41d:	83 c4 10             	add    $0x10,%esp
+ 420:	85 c0                	test   %eax,%eax
+ 422:	7e 1d                	jle    441 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 424:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 42f:	3c 0a                	cmp    $0xa,%al
+ 431:	74 10                	je     443 <gets+0x43>
+ 433:	3c 0d                	cmp    $0xd,%al
+ 435:	74 0c                	je     443 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 437:	89 df                	mov    %ebx,%edi
+ 439:	83 c3 01             	add    $0x1,%ebx
+ 43c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 43f:	7c cf                	jl     410 <gets+0x10>
+ 441:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 44a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44d:	5b                   	pop    %ebx
+ 44e:	5e                   	pop    %esi
+ 44f:	5f                   	pop    %edi
+ 450:	5d                   	pop    %ebp
+ 451:	c3                   	ret
+ 452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 465:	83 ec 08             	sub    $0x8,%esp
+ 468:	6a 00                	push   $0x0
+ 46a:	ff 75 08             	push   0x8(%ebp)
+ 46d:	e8 91 01 00 00       	call   603 <open>
+  if(fd < 0)
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	85 c0                	test   %eax,%eax
+ 477:	78 27                	js     4a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 479:	83 ec 08             	sub    $0x8,%esp
+ 47c:	ff 75 0c             	push   0xc(%ebp)
+ 47f:	89 c3                	mov    %eax,%ebx
+ 481:	50                   	push   %eax
+ 482:	e8 94 01 00 00       	call   61b <fstat>
+  close(fd);
+ 487:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 48a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 48c:	e8 5a 01 00 00       	call   5eb <close>
+  return r;
+ 491:	83 c4 10             	add    $0x10,%esp
+}
+ 494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 497:	89 f0                	mov    %esi,%eax
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5d                   	pop    %ebp
+ 49c:	c3                   	ret
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4a5:	eb ed                	jmp    494 <stat+0x34>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	56                   	push   %esi
+ 4b4:	53                   	push   %ebx
+ 4b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4b8:	0f b6 02             	movzbl (%edx),%eax
+ 4bb:	3c 20                	cmp    $0x20,%al
+ 4bd:	75 0c                	jne    4cb <atoi+0x1b>
+ 4bf:	90                   	nop
+ 4c0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 4c4:	83 c2 01             	add    $0x1,%edx
+ 4c7:	3c 20                	cmp    $0x20,%al
+ 4c9:	74 f5                	je     4c0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4cb:	3c 2d                	cmp    $0x2d,%al
+ 4cd:	74 41                	je     510 <atoi+0x60>
+ 4cf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4d4:	3c 2b                	cmp    $0x2b,%al
+ 4d6:	74 3d                	je     515 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 4d8:	0f be 0a             	movsbl (%edx),%ecx
+ 4db:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4de:	3c 09                	cmp    $0x9,%al
+ 4e0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4e5:	77 21                	ja     508 <atoi+0x58>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4f0:	83 c2 01             	add    $0x1,%edx
+ 4f3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 4f6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 4fa:	0f be 0a             	movsbl (%edx),%ecx
+ 4fd:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 500:	80 fb 09             	cmp    $0x9,%bl
+ 503:	76 eb                	jbe    4f0 <atoi+0x40>
+  return sign*n;
+ 505:	0f af c6             	imul   %esi,%eax
+}
+ 508:	5b                   	pop    %ebx
+ 509:	5e                   	pop    %esi
+ 50a:	5d                   	pop    %ebp
+ 50b:	c3                   	ret
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 510:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 515:	83 c2 01             	add    $0x1,%edx
+ 518:	eb be                	jmp    4d8 <atoi+0x28>
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000520 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+ 525:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 528:	0f b6 02             	movzbl (%edx),%eax
+ 52b:	3c 20                	cmp    $0x20,%al
+ 52d:	75 0c                	jne    53b <atoo+0x1b>
+ 52f:	90                   	nop
+ 530:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 534:	83 c2 01             	add    $0x1,%edx
+ 537:	3c 20                	cmp    $0x20,%al
+ 539:	74 f5                	je     530 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 53b:	3c 2d                	cmp    $0x2d,%al
+ 53d:	74 41                	je     580 <atoo+0x60>
+ 53f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 544:	3c 2b                	cmp    $0x2b,%al
+ 546:	74 3d                	je     585 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 548:	0f be 0a             	movsbl (%edx),%ecx
+ 54b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 54e:	3c 07                	cmp    $0x7,%al
+ 550:	b8 00 00 00 00       	mov    $0x0,%eax
+ 555:	77 1e                	ja     575 <atoo+0x55>
+ 557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 560:	83 c2 01             	add    $0x1,%edx
+ 563:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 567:	0f be 0a             	movsbl (%edx),%ecx
+ 56a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 56d:	80 fb 07             	cmp    $0x7,%bl
+ 570:	76 ee                	jbe    560 <atoo+0x40>
+  return sign*n;
+ 572:	0f af c6             	imul   %esi,%eax
+}
+ 575:	5b                   	pop    %ebx
+ 576:	5e                   	pop    %esi
+ 577:	5d                   	pop    %ebp
+ 578:	c3                   	ret
+ 579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 580:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 585:	83 c2 01             	add    $0x1,%edx
+ 588:	eb be                	jmp    548 <atoo+0x28>
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	8b 45 10             	mov    0x10(%ebp),%eax
+ 598:	8b 55 08             	mov    0x8(%ebp),%edx
+ 59b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 59e:	85 c0                	test   %eax,%eax
+ 5a0:	7e 13                	jle    5b5 <memmove+0x25>
+ 5a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5a4:	89 d7                	mov    %edx,%edi
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5b1:	39 f8                	cmp    %edi,%eax
+ 5b3:	75 fb                	jne    5b0 <memmove+0x20>
+  return vdst;
+}
+ 5b5:	5e                   	pop    %esi
+ 5b6:	89 d0                	mov    %edx,%eax
+ 5b8:	5f                   	pop    %edi
+ 5b9:	5d                   	pop    %ebp
+ 5ba:	c3                   	ret
+
+000005bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <exit>:
+SYSCALL(exit)
+ 5c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <wait>:
+SYSCALL(wait)
+ 5cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <pipe>:
+SYSCALL(pipe)
+ 5d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <read>:
+SYSCALL(read)
+ 5db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <write>:
+SYSCALL(write)
+ 5e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <close>:
+SYSCALL(close)
+ 5eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <kill>:
+SYSCALL(kill)
+ 5f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <exec>:
+SYSCALL(exec)
+ 5fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <open>:
+SYSCALL(open)
+ 603:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <mknod>:
+SYSCALL(mknod)
+ 60b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <unlink>:
+SYSCALL(unlink)
+ 613:	b8 12 00 00 00       	mov    $0x12,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <fstat>:
+SYSCALL(fstat)
+ 61b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <link>:
+SYSCALL(link)
+ 623:	b8 13 00 00 00       	mov    $0x13,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mkdir>:
+SYSCALL(mkdir)
+ 62b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <chdir>:
+SYSCALL(chdir)
+ 633:	b8 09 00 00 00       	mov    $0x9,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <dup>:
+SYSCALL(dup)
+ 63b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <getpid>:
+SYSCALL(getpid)
+ 643:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <sbrk>:
+SYSCALL(sbrk)
+ 64b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <sleep>:
+SYSCALL(sleep)
+ 653:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <uptime>:
+SYSCALL(uptime)
+ 65b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <superpages>:
+SYSCALL(superpages)
+ 663:	b8 23 00 00 00       	mov    $0x23,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <mmap>:
+SYSCALL(mmap)
+ 66b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <munmap>:
+SYSCALL(munmap)
+ 673:	b8 25 00 00 00       	mov    $0x25,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <spawn>:
+SYSCALL(spawn)
+ 67b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <swapstat>:
+SYSCALL(swapstat)
+ 683:	b8 27 00 00 00       	mov    $0x27,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 68b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <iostat>:
+SYSCALL(iostat)
+ 693:	b8 29 00 00 00       	mov    $0x29,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <dropcache>:
+SYSCALL(dropcache)
+ 69b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <iosched>:
+SYSCALL(iosched)
+ 6a3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <halt>:
+SYSCALL(halt)
+ 6ab:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <date>:
+SYSCALL(date)
+ 6b3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 6bb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <getgid>:
+SYSCALL(getgid)
+ 6c3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <getppid>:
+SYSCALL(getppid)
+ 6cb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <setuid>:
+SYSCALL(setuid)
+ 6d3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <setgid>:
+SYSCALL(setgid)
+ 6db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <getprocs>:
+SYSCALL(getprocs)
+ 6e3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 6eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <getpriority>:
+SYSCALL(getpriority)
+ 6f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 6fb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <chown>:
+SYSCALL(chown)
+ 703:	b8 21 00 00 00       	mov    $0x21,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <chgrp>:
+SYSCALL(chgrp)
+ 70b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+ 713:	66 90                	xchg   %ax,%ax
+ 715:	66 90                	xchg   %ax,%ax
+ 717:	66 90                	xchg   %ax,%ax
+ 719:	66 90                	xchg   %ax,%ax
+ 71b:	66 90                	xchg   %ax,%ax
+ 71d:	66 90                	xchg   %ax,%ax
+ 71f:	90                   	nop
+
+00000720 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 728:	89 d1                	mov    %edx,%ecx
+{
+ 72a:	83 ec 3c             	sub    $0x3c,%esp
+ 72d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 730:	85 d2                	test   %edx,%edx
+ 732:	0f 89 80 00 00 00    	jns    7b8 <printint+0x98>
+ 738:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 73c:	74 7a                	je     7b8 <printint+0x98>
+    x = -xx;
+ 73e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 740:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 745:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 748:	31 f6                	xor    %esi,%esi
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 750:	89 c8                	mov    %ecx,%eax
+ 752:	31 d2                	xor    %edx,%edx
+ 754:	89 f7                	mov    %esi,%edi
+ 756:	f7 f3                	div    %ebx
+ 758:	8d 76 01             	lea    0x1(%esi),%esi
+ 75b:	0f b6 92 b0 0e 00 00 	movzbl 0xeb0(%edx),%edx
+ 762:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 766:	89 ca                	mov    %ecx,%edx
+ 768:	89 c1                	mov    %eax,%ecx
+ 76a:	39 da                	cmp    %ebx,%edx
+ 76c:	73 e2                	jae    750 <printint+0x30>
+  if(neg)
+ 76e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 771:	85 c0                	test   %eax,%eax
+ 773:	74 07                	je     77c <printint+0x5c>
+    buf[i++] = '-';
+ 775:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 77a:	89 f7                	mov    %esi,%edi
+ 77c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 77f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 782:	01 df                	add    %ebx,%edi
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 788:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 791:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 794:	6a 01                	push   $0x1
+ 796:	50                   	push   %eax
+ 797:	56                   	push   %esi
+ 798:	e8 46 fe ff ff       	call   5e3 <write>
+  while(--i >= 0)
+ 79d:	89 f8                	mov    %edi,%eax
+ 79f:	83 c4 10             	add    $0x10,%esp
+ 7a2:	83 ef 01             	sub    $0x1,%edi
+ 7a5:	39 d8                	cmp    %ebx,%eax
+ 7a7:	75 df                	jne    788 <printint+0x68>
+}
+ 7a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ac:	5b                   	pop    %ebx
+ 7ad:	5e                   	pop    %esi
+ 7ae:	5f                   	pop    %edi
+ 7af:	5d                   	pop    %ebp
+ 7b0:	c3                   	ret
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7b8:	31 c0                	xor    %eax,%eax
+ 7ba:	eb 89                	jmp    745 <printint+0x25>
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7d2:	83 c6 01             	add    $0x1,%esi
+ 7d5:	84 db                	test   %bl,%bl
+ 7d7:	74 67                	je     840 <printf+0x80>
+ 7d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7dc:	31 d2                	xor    %edx,%edx
+ 7de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7e1:	eb 34                	jmp    817 <printf+0x57>
+ 7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7e7:	90                   	nop
+ 7e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7f0:	83 f8 25             	cmp    $0x25,%eax
+ 7f3:	74 18                	je     80d <printf+0x4d>
+  write(fd, &c, 1);
+ 7f5:	83 ec 04             	sub    $0x4,%esp
+ 7f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7fe:	6a 01                	push   $0x1
+ 800:	50                   	push   %eax
+ 801:	57                   	push   %edi
+ 802:	e8 dc fd ff ff       	call   5e3 <write>
+ 807:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 80a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 80d:	0f b6 1e             	movzbl (%esi),%ebx
+ 810:	83 c6 01             	add    $0x1,%esi
+ 813:	84 db                	test   %bl,%bl
+ 815:	74 29                	je     840 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 817:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 81a:	85 d2                	test   %edx,%edx
+ 81c:	74 ca                	je     7e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 81e:	83 fa 25             	cmp    $0x25,%edx
+ 821:	75 ea                	jne    80d <printf+0x4d>
+      if(c == 'd'){
+ 823:	83 f8 25             	cmp    $0x25,%eax
+ 826:	0f 84 24 01 00 00    	je     950 <printf+0x190>
+ 82c:	83 e8 63             	sub    $0x63,%eax
+ 82f:	83 f8 15             	cmp    $0x15,%eax
+ 832:	77 1c                	ja     850 <printf+0x90>
+ 834:	ff 24 85 58 0e 00 00 	jmp    *0xe58(,%eax,4)
+ 83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 843:	5b                   	pop    %ebx
+ 844:	5e                   	pop    %esi
+ 845:	5f                   	pop    %edi
+ 846:	5d                   	pop    %ebp
+ 847:	c3                   	ret
+ 848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 856:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 85a:	6a 01                	push   $0x1
+ 85c:	52                   	push   %edx
+ 85d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 860:	57                   	push   %edi
+ 861:	e8 7d fd ff ff       	call   5e3 <write>
+ 866:	83 c4 0c             	add    $0xc,%esp
+ 869:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86c:	6a 01                	push   $0x1
+ 86e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 871:	52                   	push   %edx
+ 872:	57                   	push   %edi
+ 873:	e8 6b fd ff ff       	call   5e3 <write>
+        putc(fd, c);
+ 878:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87b:	31 d2                	xor    %edx,%edx
+ 87d:	eb 8e                	jmp    80d <printf+0x4d>
+ 87f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 880:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 88b:	8b 13                	mov    (%ebx),%edx
+ 88d:	6a 00                	push   $0x0
+ 88f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 891:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 894:	e8 87 fe ff ff       	call   720 <printint>
+        ap++;
+ 899:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 89c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 89f:	31 d2                	xor    %edx,%edx
+ 8a1:	e9 67 ff ff ff       	jmp    80d <printf+0x4d>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8b5:	83 c0 04             	add    $0x4,%eax
+ 8b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8bb:	85 db                	test   %ebx,%ebx
+ 8bd:	0f 84 9d 00 00 00    	je     960 <printf+0x1a0>
+        while(*s != 0){
+ 8c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8c8:	84 c0                	test   %al,%al
+ 8ca:	0f 84 3d ff ff ff    	je     80d <printf+0x4d>
+ 8d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8d6:	89 de                	mov    %ebx,%esi
+ 8d8:	89 d3                	mov    %edx,%ebx
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	53                   	push   %ebx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 f1 fc ff ff       	call   5e3 <write>
+        while(*s != 0){
+ 8f2:	0f b6 06             	movzbl (%esi),%eax
+ 8f5:	83 c4 10             	add    $0x10,%esp
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	75 e4                	jne    8e0 <printf+0x120>
+      state = 0;
+ 8fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 07 ff ff ff       	jmp    80d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 910:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 91b:	8b 13                	mov    (%ebx),%edx
+ 91d:	6a 01                	push   $0x1
+ 91f:	e9 6b ff ff ff       	jmp    88f <printf+0xcf>
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 928:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 92b:	83 ec 04             	sub    $0x4,%esp
+ 92e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 931:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 933:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 936:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	52                   	push   %edx
+ 93c:	57                   	push   %edi
+ 93d:	e8 a1 fc ff ff       	call   5e3 <write>
+        ap++;
+ 942:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 945:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 948:	31 d2                	xor    %edx,%edx
+ 94a:	e9 be fe ff ff       	jmp    80d <printf+0x4d>
+ 94f:	90                   	nop
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 956:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 959:	6a 01                	push   $0x1
+ 95b:	e9 11 ff ff ff       	jmp    871 <printf+0xb1>
+ 960:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 965:	bb 50 0e 00 00       	mov    $0xe50,%ebx
+ 96a:	e9 61 ff ff ff       	jmp    8d0 <printf+0x110>
+ 96f:	90                   	nop
+
+00000970 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 973:	a1 c4 12 00 00       	mov    0x12c4,%eax
+{
+ 978:	89 e5                	mov    %esp,%ebp
+ 97a:	56                   	push   %esi
+ 97b:	53                   	push   %ebx
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 980:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 982:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 984:	39 ca                	cmp    %ecx,%edx
+ 986:	73 30                	jae    9b8 <lfree+0x48>
+ 988:	39 c1                	cmp    %eax,%ecx
+ 98a:	72 04                	jb     990 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 98c:	39 c2                	cmp    %eax,%edx
+ 98e:	72 f0                	jb     980 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 990:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 993:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 996:	39 f0                	cmp    %esi,%eax
+ 998:	74 26                	je     9c0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 99a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 99c:	8b 42 04             	mov    0x4(%edx),%eax
+ 99f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9a2:	39 d9                	cmp    %ebx,%ecx
+ 9a4:	74 30                	je     9d6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9a6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9a8:	5b                   	pop    %ebx
+  freep = p;
+ 9a9:	89 15 c4 12 00 00    	mov    %edx,0x12c4
+}
+ 9af:	5e                   	pop    %esi
+ 9b0:	5d                   	pop    %ebp
+ 9b1:	c3                   	ret
+ 9b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b8:	39 c1                	cmp    %eax,%ecx
+ 9ba:	72 d0                	jb     98c <lfree+0x1c>
+ 9bc:	eb c2                	jmp    980 <lfree+0x10>
+ 9be:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 9c0:	03 58 04             	add    0x4(%eax),%ebx
+ 9c3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9c6:	8b 02                	mov    (%edx),%eax
+ 9c8:	8b 00                	mov    (%eax),%eax
+ 9ca:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 9cc:	8b 42 04             	mov    0x4(%edx),%eax
+ 9cf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9d2:	39 d9                	cmp    %ebx,%ecx
+ 9d4:	75 d0                	jne    9a6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 9d6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 9d9:	89 15 c4 12 00 00    	mov    %edx,0x12c4
+    p->s.size += bp->s.size;
+ 9df:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9e2:	8b 09                	mov    (%ecx),%ecx
+ 9e4:	89 0a                	mov    %ecx,(%edx)
+}
+ 9e6:	5b                   	pop    %ebx
+ 9e7:	5e                   	pop    %esi
+ 9e8:	5d                   	pop    %ebp
+ 9e9:	c3                   	ret
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009f0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	89 c7                	mov    %eax,%edi
+ 9f6:	56                   	push   %esi
+ 9f7:	53                   	push   %ebx
+ 9f8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 9fb:	a1 c4 12 00 00       	mov    0x12c4,%eax
+ a00:	85 c0                	test   %eax,%eax
+ a02:	0f 84 88 00 00 00    	je     a90 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a08:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a0a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ a0d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a12:	39 df                	cmp    %ebx,%edi
+ a14:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a17:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ a1e:	39 f9                	cmp    %edi,%ecx
+ a20:	72 0f                	jb     a31 <lalloc+0x41>
+ a22:	eb 4c                	jmp    a70 <lalloc+0x80>
+ a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a28:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a2a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a2d:	39 f9                	cmp    %edi,%ecx
+ a2f:	73 3f                	jae    a70 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ a31:	89 d0                	mov    %edx,%eax
+ a33:	39 15 c4 12 00 00    	cmp    %edx,0x12c4
+ a39:	75 ed                	jne    a28 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ a3b:	83 ec 0c             	sub    $0xc,%esp
+ a3e:	56                   	push   %esi
+ a3f:	e8 07 fc ff ff       	call   64b <sbrk>
+  if(p == (char*)-1)
+ a44:	83 c4 10             	add    $0x10,%esp
+ a47:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a4a:	74 11                	je     a5d <lalloc+0x6d>
+  hp->s.size = nu;
+ a4c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ a4f:	e8 1c ff ff ff       	call   970 <lfree>
+  return freep;
+ a54:	a1 c4 12 00 00       	mov    0x12c4,%eax
+      if((p = morecore(nunits)) == 0)
+ a59:	85 c0                	test   %eax,%eax
+ a5b:	75 cb                	jne    a28 <lalloc+0x38>
+        return 0;
+  }
+}
+ a5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a60:	31 d2                	xor    %edx,%edx
+}
+ a62:	5b                   	pop    %ebx
+ a63:	89 d0                	mov    %edx,%eax
+ a65:	5e                   	pop    %esi
+ a66:	5f                   	pop    %edi
+ a67:	5d                   	pop    %ebp
+ a68:	c3                   	ret
+ a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ a70:	39 cf                	cmp    %ecx,%edi
+ a72:	74 4c                	je     ac0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ a74:	29 f9                	sub    %edi,%ecx
+ a76:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ a79:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ a7c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ a7f:	a3 c4 12 00 00       	mov    %eax,0x12c4
+}
+ a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a87:	89 d0                	mov    %edx,%eax
+ a89:	5b                   	pop    %ebx
+ a8a:	5e                   	pop    %esi
+ a8b:	5f                   	pop    %edi
+ a8c:	5d                   	pop    %ebp
+ a8d:	c3                   	ret
+ a8e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ a90:	ba c8 12 00 00       	mov    $0x12c8,%edx
+ a95:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ a97:	c7 05 c4 12 00 00 c8 	movl   $0x12c8,0x12c4
+ a9e:	12 00 00 
+ aa1:	c7 05 c8 12 00 00 c8 	movl   $0x12c8,0x12c8
+ aa8:	12 00 00 
+ aab:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ aad:	c7 05 cc 12 00 00 00 	movl   $0x0,0x12cc
+ ab4:	00 00 00 
+ ab7:	e9 51 ff ff ff       	jmp    a0d <lalloc+0x1d>
+ abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ ac0:	8b 0a                	mov    (%edx),%ecx
+ ac2:	89 08                	mov    %ecx,(%eax)
+ ac4:	eb b9                	jmp    a7f <lalloc+0x8f>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ad0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ ad9:	85 f6                	test   %esi,%esi
+ adb:	74 42                	je     b1f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ add:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ ae0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ ae3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ ae9:	77 3d                	ja     b28 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ aeb:	31 c9                	xor    %ecx,%ecx
+ aed:	bb 01 00 00 00       	mov    $0x1,%ebx
+ af2:	83 fa 02             	cmp    $0x2,%edx
+ af5:	74 17                	je     b0e <free+0x3e>
+ af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afe:	66 90                	xchg   %ax,%ax
+ b00:	83 c1 01             	add    $0x1,%ecx
+ b03:	89 d8                	mov    %ebx,%eax
+ b05:	d3 e0                	shl    %cl,%eax
+ b07:	83 c0 01             	add    $0x1,%eax
+ b0a:	39 c2                	cmp    %eax,%edx
+ b0c:	75 f2                	jne    b00 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ b0e:	8b 04 8d a0 12 00 00 	mov    0x12a0(,%ecx,4),%eax
+  classes[c] = bp;
+ b15:	89 3c 8d a0 12 00 00 	mov    %edi,0x12a0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ b1c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ b1f:	5b                   	pop    %ebx
+ b20:	5e                   	pop    %esi
+ b21:	5f                   	pop    %edi
+ b22:	5d                   	pop    %ebp
+ b23:	c3                   	ret
+ b24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b28:	5b                   	pop    %ebx
+    lfree(bp);
+ b29:	89 f8                	mov    %edi,%eax
+}
+ b2b:	5e                   	pop    %esi
+ b2c:	5f                   	pop    %edi
+ b2d:	5d                   	pop    %ebp
+    lfree(bp);
+ b2e:	e9 3d fe ff ff       	jmp    970 <lfree>
+ b33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b40 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	57                   	push   %edi
+ b44:	56                   	push   %esi
+ b45:	53                   	push   %ebx
+ b46:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b49:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4c:	83 c0 07             	add    $0x7,%eax
+ b4f:	c1 e8 03             	shr    $0x3,%eax
+ b52:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ b55:	3d 01 01 00 00       	cmp    $0x101,%eax
+ b5a:	77 44                	ja     ba0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ b5c:	31 c9                	xor    %ecx,%ecx
+ b5e:	ba 01 00 00 00       	mov    $0x1,%edx
+ b63:	bb 02 00 00 00       	mov    $0x2,%ebx
+ b68:	83 f8 02             	cmp    $0x2,%eax
+ b6b:	76 11                	jbe    b7e <malloc+0x3e>
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+ b70:	83 c1 01             	add    $0x1,%ecx
+ b73:	89 d3                	mov    %edx,%ebx
+ b75:	d3 e3                	shl    %cl,%ebx
+ b77:	83 c3 01             	add    $0x1,%ebx
+ b7a:	39 c3                	cmp    %eax,%ebx
+ b7c:	72 f2                	jb     b70 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ b7e:	8b 04 8d a0 12 00 00 	mov    0x12a0(,%ecx,4),%eax
+ b85:	85 c0                	test   %eax,%eax
+ b87:	74 2f                	je     bb8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ b89:	8b 10                	mov    (%eax),%edx
+ b8b:	89 14 8d a0 12 00 00 	mov    %edx,0x12a0(,%ecx,4)
+  return (void*)(p + 1);
+ b92:	83 c0 08             	add    $0x8,%eax
+}
+ b95:	83 c4 1c             	add    $0x1c,%esp
+ b98:	5b                   	pop    %ebx
+ b99:	5e                   	pop    %esi
+ b9a:	5f                   	pop    %edi
+ b9b:	5d                   	pop    %ebp
+ b9c:	c3                   	ret
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ ba0:	e8 4b fe ff ff       	call   9f0 <lalloc>
+ ba5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ ba7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ baa:	85 d2                	test   %edx,%edx
+ bac:	75 e7                	jne    b95 <malloc+0x55>
+      return 0;
+ bae:	31 c0                	xor    %eax,%eax
+ bb0:	eb e3                	jmp    b95 <malloc+0x55>
+ bb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ bb8:	31 d2                	xor    %edx,%edx
+ bba:	b8 00 02 00 00       	mov    $0x200,%eax
+ bbf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ bc2:	f7 f3                	div    %ebx
+  if(n < 4)
+ bc4:	ba 04 00 00 00       	mov    $0x4,%edx
+ bc9:	89 d6                	mov    %edx,%esi
+ bcb:	39 d0                	cmp    %edx,%eax
+ bcd:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ bd0:	0f af f3             	imul   %ebx,%esi
+ bd3:	89 f0                	mov    %esi,%eax
+ bd5:	e8 16 fe ff ff       	call   9f0 <lalloc>
+ bda:	85 c0                	test   %eax,%eax
+ bdc:	74 d0                	je     bae <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ bde:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ be1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ be4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ beb:	8b 14 8d a0 12 00 00 	mov    0x12a0(,%ecx,4),%edx
+ bf2:	39 f8                	cmp    %edi,%eax
+ bf4:	73 22                	jae    c18 <malloc+0xd8>
+ bf6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ bf9:	eb 09                	jmp    c04 <malloc+0xc4>
+ bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bff:	90                   	nop
+ c00:	89 c2                	mov    %eax,%edx
+ c02:	89 c8                	mov    %ecx,%eax
+ c04:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ c07:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ c0a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ c0c:	39 f9                	cmp    %edi,%ecx
+ c0e:	72 f0                	jb     c00 <malloc+0xc0>
+ c10:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c13:	e9 73 ff ff ff       	jmp    b8b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ c18:	89 d0                	mov    %edx,%eax
+ c1a:	8b 12                	mov    (%edx),%edx
+ c1c:	e9 6a ff ff ff       	jmp    b8b <malloc+0x4b>
+ c21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+
+00000c30 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	56                   	push   %esi
+ c34:	53                   	push   %ebx
+ c35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ c38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ c3b:	85 c9                	test   %ecx,%ecx
+ c3d:	74 06                	je     c45 <calloc+0x15>
+ c3f:	89 c8                	mov    %ecx,%eax
+ c41:	f7 e3                	mul    %ebx
+ c43:	70 33                	jo     c78 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ c45:	0f af d9             	imul   %ecx,%ebx
+ c48:	83 ec 0c             	sub    $0xc,%esp
+ c4b:	53                   	push   %ebx
+ c4c:	e8 ef fe ff ff       	call   b40 <malloc>
+ c51:	83 c4 10             	add    $0x10,%esp
+ c54:	89 c6                	mov    %eax,%esi
+ c56:	85 c0                	test   %eax,%eax
+ c58:	74 1e                	je     c78 <calloc+0x48>
+    memset(p, 0, n * size);
+ c5a:	83 ec 04             	sub    $0x4,%esp
+ c5d:	53                   	push   %ebx
+ c5e:	6a 00                	push   $0x0
+ c60:	50                   	push   %eax
+ c61:	e8 3a f7 ff ff       	call   3a0 <memset>
+ c66:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ c69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c6c:	89 f0                	mov    %esi,%eax
+ c6e:	5b                   	pop    %ebx
+ c6f:	5e                   	pop    %esi
+ c70:	5d                   	pop    %ebp
+ c71:	c3                   	ret
+ c72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ c7b:	31 f6                	xor    %esi,%esi
+}
+ c7d:	89 f0                	mov    %esi,%eax
+ c7f:	5b                   	pop    %ebx
+ c80:	5e                   	pop    %esi
+ c81:	5d                   	pop    %ebp
+ c82:	c3                   	ret
+ c83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c90 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	56                   	push   %esi
+ c95:	53                   	push   %ebx
+ c96:	83 ec 0c             	sub    $0xc,%esp
+ c99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ c9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ c9f:	85 db                	test   %ebx,%ebx
+ ca1:	74 55                	je     cf8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ ca3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ ca6:	89 de                	mov    %ebx,%esi
+ ca8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ caf:	39 c7                	cmp    %eax,%edi
+ cb1:	72 0d                	jb     cc0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ cb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cb6:	89 f0                	mov    %esi,%eax
+ cb8:	5b                   	pop    %ebx
+ cb9:	5e                   	pop    %esi
+ cba:	5f                   	pop    %edi
+ cbb:	5d                   	pop    %ebp
+ cbc:	c3                   	ret
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ cc0:	83 ec 0c             	sub    $0xc,%esp
+ cc3:	50                   	push   %eax
+ cc4:	e8 77 fe ff ff       	call   b40 <malloc>
+ cc9:	83 c4 10             	add    $0x10,%esp
+ ccc:	89 c6                	mov    %eax,%esi
+ cce:	85 c0                	test   %eax,%eax
+ cd0:	74 e1                	je     cb3 <realloc+0x23>
+  memmove(p, ap, have);
+ cd2:	83 ec 04             	sub    $0x4,%esp
+ cd5:	57                   	push   %edi
+ cd6:	53                   	push   %ebx
+ cd7:	50                   	push   %eax
+ cd8:	e8 b3 f8 ff ff       	call   590 <memmove>
+  free(ap);
+ cdd:	89 1c 24             	mov    %ebx,(%esp)
+ ce0:	e8 eb fd ff ff       	call   ad0 <free>
+  return p;
+ ce5:	83 c4 10             	add    $0x10,%esp
+}
+ ce8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ceb:	89 f0                	mov    %esi,%eax
+ ced:	5b                   	pop    %ebx
+ cee:	5e                   	pop    %esi
+ cef:	5f                   	pop    %edi
+ cf0:	5d                   	pop    %ebp
+ cf1:	c3                   	ret
+ cf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ cf8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cfe:	5b                   	pop    %ebx
+ cff:	5e                   	pop    %esi
+ d00:	5f                   	pop    %edi
+ d01:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ d02:	e9 39 fe ff ff       	jmp    b40 <malloc>
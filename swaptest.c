@@ -0,0 +1,112 @@
+// Run a working set larger than physical memory: fill all of
+// memory plus 16 MB of heap (or the number of MB given as an
+// argument), read it all back, and have a forked child check it
+// too.  This only passes if pages go to swap and come back
+// intact.  Every 4 MB of heap filled needs a new page-table page,
+// and a process forked while memory is full needs a kernel stack
+// and a page directory; those come from swapping user pages out
+// too.
+
+#include "types.h"
+#include "user.h"
+#include "meminfo.h"
+#include "swap.h"
+
+#define PG   4096
+#define KEEP (8*1024*1024)
+
+static int
+check(char *p, uint size, uint step)
+{
+  uint i;
+  int bad;
+
+  bad = 0;
+  for(i = 0; i < size; i += step)
+    if(*(uint*)(p + i) != (i ^ 0x5a5a5a5a))
+      bad++;
+  return bad;
+}
+
+static void
+stats(char *when)
+{
+  struct swapstat st;
+
+  if(swapstat(&st) < 0){
+    printf(2, "swaptest: swapstat failed\n");
+    return;
+  }
+  printf(1, "%s: swap %d/%d pages used, %d page-outs, %d page-ins\n",
+         when, st.used, st.nslot, st.pageouts, st.pageins);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct meminfo mi;
+  uint size, i;
+  char *p, c;
+  int bad, start, pid, fd[2];
+
+  if(getmeminfo(&mi) < 0){
+    printf(2, "swaptest: getmeminfo failed\n");
+    exit();
+  }
+  size = mi.total * PG + 16*1024*1024;
+  if(argc > 1)
+    size = atoi(argv[1]) * 1024 * 1024;
+  if(size < KEEP)
+    size = KEEP;
+  stats("before");
+
+  // A process that forks once memory is full.
+  if(pipe(fd) < 0){
+    printf(2, "swaptest: pipe failed\n");
+    exit();
+  }
+  if((pid = fork()) == 0){
+    close(fd[1]);
+    read(fd[0], &c, 1);
+    if((pid = fork()) == 0)
+      exit();
+    if(pid > 0)
+      wait();
+    printf(1, "fork with memory full: %s\n", pid > 0 ? "ok" : "FAILED");
+    exit();
+  }
+  close(fd[0]);
+
+  if((p = sbrk(size)) == (char*)-1){
+    printf(2, "swaptest: sbrk %d failed\n", size);
+    exit();
+  }
+
+  start = uptime();
+  for(i = 0; i < size; i += PG)
+    *(uint*)(p + i) = i ^ 0x5a5a5a5a;
+  printf(1, "filled %d MB, %d page tables, in %d ms\n", size/(1024*1024),
+         (size + 4*1024*1024 - 1) / (4*1024*1024), uptime() - start);
+  stats("after fill");
+  write(fd[1], "x", 1);
+  close(fd[1]);
+  wait();
+
+  start = uptime();
+  bad = check(p, size, PG);
+  printf(1, "checked %d MB in %d ms: %s\n", size/(1024*1024),
+         uptime() - start, bad ? "FAILED" : "ok");
+  stats("after check");
+
+  // Keep the first 8 MB, which the clock swapped out first,
+  // and fork: the child's copy of it is read from swap.
+  sbrk(-(size - KEEP));
+  if(fork() == 0){
+    bad = check(p, KEEP, PG);
+    printf(1, "child check: %s\n", bad ? "FAILED" : "ok");
+    exit();
+  }
+  wait();
+  stats("after fork");
+  exit();
+}
@@ -21,6 +21,8 @@ fetchint(uint addr, int *ip)
 
   if(addr >= curproc->sz || addr+4 > curproc->sz)
     return -1;
+  if(uvmtouch(addr, 4, 0) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
@@ -39,6 +41,8 @@ fetchstr(uint addr, char **pp)
   *pp = (char*)addr;
   ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) && uvmtouch((uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -54,16 +58,36 @@ argint(int n, int *ip)
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// lies within the process address space: below sz or in an
+// mmap region (uvmtouch checks the whole block).
 int
 argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
 
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || (uint)i >= KERNBASE)
+    return -1;
+  if(uvmtouch((uint)i, size, 1) < 0)
+    return -1;
+  *pp = (char*)i;
+  return 0;
+}
+
+// Like argptr, but for a block the kernel will only read, so
+// pages that have not been touched yet need not be made writable
+// (and read-only program text is acceptable).
+int
+argrdptr(int n, char **pp, int size)
+{
+  int i;
+
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= KERNBASE)
+    return -1;
+  if(uvmtouch((uint)i, size, 0) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -103,6 +127,15 @@ extern int sys_unlink(void);
 extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
+extern int sys_superpages(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_spawn(void);
+extern int sys_swapstat(void);
+extern int sys_getmeminfo(void);
+extern int sys_iostat(void);
+extern int sys_dropcache(void);
+extern int sys_iosched(void);
 #ifdef PDX_XV6
 extern int sys_halt(void);
 #endif // PDX_XV6
@@ -148,6 +181,15 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
+[SYS_superpages] sys_superpages,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_spawn]   sys_spawn,
+[SYS_swapstat] sys_swapstat,
+[SYS_getmeminfo] sys_getmeminfo,
+[SYS_iostat]  sys_iostat,
+[SYS_dropcache] sys_dropcache,
+[SYS_iosched] sys_iosched,
 #ifdef PDX_XV6
 [SYS_halt]    sys_halt,
 #endif // PDX_XV6
@@ -196,6 +238,15 @@ static char *syscallnames[] = {
   [SYS_link]    "link",
   [SYS_mkdir]   "mkdir",
   [SYS_close]   "close",
+  [SYS_superpages] "superpages",
+  [SYS_mmap]    "mmap",
+  [SYS_munmap]  "munmap",
+  [SYS_spawn]   "spawn",
+  [SYS_swapstat] "swapstat",
+  [SYS_getmeminfo] "getmeminfo",
+  [SYS_iostat]  "iostat",
+  [SYS_dropcache] "dropcache",
+  [SYS_iosched] "iosched",
 #ifdef PDX_XV6
   [SYS_halt]    "halt",
 #endif // PDX_XV6
@@ -211,6 +262,7 @@ syscall(void)
   num = curproc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     curproc->tf->eax = syscalls[num]();
+    uvmunpin(curproc);
     #ifdef PRINT_SYSCALLS
     cprintf("%s -> %d\n", syscallnames[num], curproc->tf->eax);
     #endif
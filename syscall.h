@@ -34,4 +34,13 @@
 #define SYS_chmod   SYS_setpriority+1
 #define SYS_chown   SYS_chmod+1
 #define SYS_chgrp   SYS_chown+1
+#define SYS_superpages SYS_chgrp+1
+#define SYS_mmap    SYS_superpages+1
+#define SYS_munmap  SYS_mmap+1
+#define SYS_spawn   SYS_munmap+1
+#define SYS_swapstat SYS_spawn+1
+#define SYS_getmeminfo SYS_swapstat+1
+#define SYS_iostat  SYS_getmeminfo+1
+#define SYS_dropcache SYS_iostat+1
+#define SYS_iosched SYS_dropcache+1
 
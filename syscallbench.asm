@@ -0,0 +1,1697 @@
+
+_syscallbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         what, N, t, t * (1000000 / N));
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+  int i, t;
+
+  t = uptime();
+   5:	bb 40 0d 03 00       	mov    $0x30d40,%ebx
+{
+   a:	83 e4 f0             	and    $0xfffffff0,%esp
+  t = uptime();
+   d:	e8 09 04 00 00       	call   41b <uptime>
+  12:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < N; i++)
+  14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    getpid();
+  18:	e8 e6 03 00 00       	call   403 <getpid>
+  for(i = 0; i < N; i++)
+  1d:	83 eb 01             	sub    $0x1,%ebx
+  20:	75 f6                	jne    18 <main+0x18>
+  report("getpid", uptime() - t);
+  22:	e8 f4 03 00 00       	call   41b <uptime>
+
+  t = uptime();
+  27:	bb 40 0d 03 00       	mov    $0x30d40,%ebx
+  report("getpid", uptime() - t);
+  2c:	29 f0                	sub    %esi,%eax
+  2e:	89 c2                	mov    %eax,%edx
+  30:	b8 ef 0a 00 00       	mov    $0xaef,%eax
+  35:	e8 36 00 00 00       	call   70 <report>
+  t = uptime();
+  3a:	e8 dc 03 00 00       	call   41b <uptime>
+  3f:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < N; i++)
+  41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    uptime();
+  48:	e8 ce 03 00 00       	call   41b <uptime>
+  for(i = 0; i < N; i++)
+  4d:	83 eb 01             	sub    $0x1,%ebx
+  50:	75 f6                	jne    48 <main+0x48>
+  report("uptime", uptime() - t);
+  52:	e8 c4 03 00 00       	call   41b <uptime>
+  57:	29 f0                	sub    %esi,%eax
+  59:	89 c2                	mov    %eax,%edx
+  5b:	b8 f6 0a 00 00       	mov    $0xaf6,%eax
+  60:	e8 0b 00 00 00       	call   70 <report>
+  exit();
+  65:	e8 19 03 00 00       	call   383 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <report>:
+{
+  70:	55                   	push   %ebp
+    t = 1;
+  71:	b9 01 00 00 00       	mov    $0x1,%ecx
+{
+  76:	89 e5                	mov    %esp,%ebp
+  78:	83 ec 10             	sub    $0x10,%esp
+    t = 1;
+  7b:	85 d2                	test   %edx,%edx
+  7d:	0f 44 d1             	cmove  %ecx,%edx
+  printf(1, "%s: %d calls in %d ms, %d ns per call\n",
+  80:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+  83:	51                   	push   %ecx
+  84:	52                   	push   %edx
+  85:	68 40 0d 03 00       	push   $0x30d40
+  8a:	50                   	push   %eax
+  8b:	68 c8 0a 00 00       	push   $0xac8
+  90:	6a 01                	push   $0x1
+  92:	e8 e9 04 00 00       	call   580 <printf>
+}
+  97:	83 c4 20             	add    $0x20,%esp
+  9a:	c9                   	leave
+  9b:	c3                   	ret
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  a1:	31 c0                	xor    %eax,%eax
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	53                   	push   %ebx
+  a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  b7:	83 c0 01             	add    $0x1,%eax
+  ba:	84 d2                	test   %dl,%dl
+  bc:	75 f2                	jne    b0 <strcpy+0x10>
+    ;
+  return os;
+}
+  be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c1:	89 c8                	mov    %ecx,%eax
+  c3:	c9                   	leave
+  c4:	c3                   	ret
+  c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	53                   	push   %ebx
+  d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  da:	0f b6 02             	movzbl (%edx),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 17                	jne    f8 <strcmp+0x28>
+  e1:	eb 3a                	jmp    11d <strcmp+0x4d>
+  e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  e7:	90                   	nop
+  e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ec:	83 c2 01             	add    $0x1,%edx
+  ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  f2:	84 c0                	test   %al,%al
+  f4:	74 1a                	je     110 <strcmp+0x40>
+    p++, q++;
+  f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  f8:	0f b6 19             	movzbl (%ecx),%ebx
+  fb:	38 c3                	cmp    %al,%bl
+  fd:	74 e9                	je     e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  ff:	29 d8                	sub    %ebx,%eax
+}
+ 101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 104:	c9                   	leave
+ 105:	c3                   	ret
+ 106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 110:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 114:	31 c0                	xor    %eax,%eax
+ 116:	29 d8                	sub    %ebx,%eax
+}
+ 118:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 11b:	c9                   	leave
+ 11c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 11d:	0f b6 19             	movzbl (%ecx),%ebx
+ 120:	31 c0                	xor    %eax,%eax
+ 122:	eb db                	jmp    ff <strcmp+0x2f>
+ 124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+
+00000130 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 136:	80 3a 00             	cmpb   $0x0,(%edx)
+ 139:	74 15                	je     150 <strlen+0x20>
+ 13b:	31 c0                	xor    %eax,%eax
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+ 140:	83 c0 01             	add    $0x1,%eax
+ 143:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 147:	89 c1                	mov    %eax,%ecx
+ 149:	75 f5                	jne    140 <strlen+0x10>
+    ;
+  return n;
+}
+ 14b:	89 c8                	mov    %ecx,%eax
+ 14d:	5d                   	pop    %ebp
+ 14e:	c3                   	ret
+ 14f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 150:	31 c9                	xor    %ecx,%ecx
+}
+ 152:	5d                   	pop    %ebp
+ 153:	89 c8                	mov    %ecx,%eax
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000160 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 167:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 16a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16d:	89 d7                	mov    %edx,%edi
+ 16f:	fc                   	cld
+ 170:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 172:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 175:	89 d0                	mov    %edx,%eax
+ 177:	c9                   	leave
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 45 08             	mov    0x8(%ebp),%eax
+ 186:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 18a:	0f b6 10             	movzbl (%eax),%edx
+ 18d:	84 d2                	test   %dl,%dl
+ 18f:	75 12                	jne    1a3 <strchr+0x23>
+ 191:	eb 1d                	jmp    1b0 <strchr+0x30>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 19c:	83 c0 01             	add    $0x1,%eax
+ 19f:	84 d2                	test   %dl,%dl
+ 1a1:	74 0d                	je     1b0 <strchr+0x30>
+    if(*s == c)
+ 1a3:	38 d1                	cmp    %dl,%cl
+ 1a5:	75 f1                	jne    198 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1a7:	5d                   	pop    %ebp
+ 1a8:	c3                   	ret
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1b0:	31 c0                	xor    %eax,%eax
+}
+ 1b2:	5d                   	pop    %ebp
+ 1b3:	c3                   	ret
+ 1b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+
+000001c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1c9:	31 db                	xor    %ebx,%ebx
+{
+ 1cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ce:	eb 27                	jmp    1f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1d0:	83 ec 04             	sub    $0x4,%esp
+ 1d3:	6a 01                	push   $0x1
+ 1d5:	56                   	push   %esi
+ 1d6:	6a 00                	push   $0x0
+ 1d8:	e8 be 01 00 00       	call   39b <read>
+    if(cc < 1)
+ 1dd:	83 c4 10             	add    $0x10,%esp
+ 1e0:	85 c0                	test   %eax,%eax
+ 1e2:	7e 1d                	jle    201 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1ef:	3c 0a                	cmp    $0xa,%al
+ 1f1:	74 10                	je     203 <gets+0x43>
+ 1f3:	3c 0d                	cmp    $0xd,%al
+ 1f5:	74 0c                	je     203 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1f7:	89 df                	mov    %ebx,%edi
+ 1f9:	83 c3 01             	add    $0x1,%ebx
+ 1fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ff:	7c cf                	jl     1d0 <gets+0x10>
+ 201:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 20a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20d:	5b                   	pop    %ebx
+ 20e:	5e                   	pop    %esi
+ 20f:	5f                   	pop    %edi
+ 210:	5d                   	pop    %ebp
+ 211:	c3                   	ret
+ 212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	56                   	push   %esi
+ 224:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 225:	83 ec 08             	sub    $0x8,%esp
+ 228:	6a 00                	push   $0x0
+ 22a:	ff 75 08             	push   0x8(%ebp)
+ 22d:	e8 91 01 00 00       	call   3c3 <open>
+  if(fd < 0)
+ 232:	83 c4 10             	add    $0x10,%esp
+ 235:	85 c0                	test   %eax,%eax
+ 237:	78 27                	js     260 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 239:	83 ec 08             	sub    $0x8,%esp
+ 23c:	ff 75 0c             	push   0xc(%ebp)
+ 23f:	89 c3                	mov    %eax,%ebx
+ 241:	50                   	push   %eax
+ 242:	e8 94 01 00 00       	call   3db <fstat>
+  close(fd);
+ 247:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 24a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 24c:	e8 5a 01 00 00       	call   3ab <close>
+  return r;
+ 251:	83 c4 10             	add    $0x10,%esp
+}
+ 254:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 257:	89 f0                	mov    %esi,%eax
+ 259:	5b                   	pop    %ebx
+ 25a:	5e                   	pop    %esi
+ 25b:	5d                   	pop    %ebp
+ 25c:	c3                   	ret
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 265:	eb ed                	jmp    254 <stat+0x34>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+
+00000270 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+ 275:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 278:	0f b6 02             	movzbl (%edx),%eax
+ 27b:	3c 20                	cmp    $0x20,%al
+ 27d:	75 0c                	jne    28b <atoi+0x1b>
+ 27f:	90                   	nop
+ 280:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 284:	83 c2 01             	add    $0x1,%edx
+ 287:	3c 20                	cmp    $0x20,%al
+ 289:	74 f5                	je     280 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 28b:	3c 2d                	cmp    $0x2d,%al
+ 28d:	74 41                	je     2d0 <atoi+0x60>
+ 28f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 294:	3c 2b                	cmp    $0x2b,%al
+ 296:	74 3d                	je     2d5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 298:	0f be 0a             	movsbl (%edx),%ecx
+ 29b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 29e:	3c 09                	cmp    $0x9,%al
+ 2a0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2a5:	77 21                	ja     2c8 <atoi+0x58>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2b0:	83 c2 01             	add    $0x1,%edx
+ 2b3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 2b6:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 2ba:	0f be 0a             	movsbl (%edx),%ecx
+ 2bd:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2c0:	80 fb 09             	cmp    $0x9,%bl
+ 2c3:	76 eb                	jbe    2b0 <atoi+0x40>
+  return sign*n;
+ 2c5:	0f af c6             	imul   %esi,%eax
+}
+ 2c8:	5b                   	pop    %ebx
+ 2c9:	5e                   	pop    %esi
+ 2ca:	5d                   	pop    %ebp
+ 2cb:	c3                   	ret
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2d5:	83 c2 01             	add    $0x1,%edx
+ 2d8:	eb be                	jmp    298 <atoi+0x28>
+ 2da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002e0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	56                   	push   %esi
+ 2e4:	53                   	push   %ebx
+ 2e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2e8:	0f b6 02             	movzbl (%edx),%eax
+ 2eb:	3c 20                	cmp    $0x20,%al
+ 2ed:	75 0c                	jne    2fb <atoo+0x1b>
+ 2ef:	90                   	nop
+ 2f0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 2f4:	83 c2 01             	add    $0x1,%edx
+ 2f7:	3c 20                	cmp    $0x20,%al
+ 2f9:	74 f5                	je     2f0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 2fb:	3c 2d                	cmp    $0x2d,%al
+ 2fd:	74 41                	je     340 <atoo+0x60>
+ 2ff:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 304:	3c 2b                	cmp    $0x2b,%al
+ 306:	74 3d                	je     345 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 308:	0f be 0a             	movsbl (%edx),%ecx
+ 30b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 30e:	3c 07                	cmp    $0x7,%al
+ 310:	b8 00 00 00 00       	mov    $0x0,%eax
+ 315:	77 1e                	ja     335 <atoo+0x55>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 320:	83 c2 01             	add    $0x1,%edx
+ 323:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 327:	0f be 0a             	movsbl (%edx),%ecx
+ 32a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 32d:	80 fb 07             	cmp    $0x7,%bl
+ 330:	76 ee                	jbe    320 <atoo+0x40>
+  return sign*n;
+ 332:	0f af c6             	imul   %esi,%eax
+}
+ 335:	5b                   	pop    %ebx
+ 336:	5e                   	pop    %esi
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 345:	83 c2 01             	add    $0x1,%edx
+ 348:	eb be                	jmp    308 <atoo+0x28>
+ 34a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000350 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	8b 45 10             	mov    0x10(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 35e:	85 c0                	test   %eax,%eax
+ 360:	7e 13                	jle    375 <memmove+0x25>
+ 362:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 364:	89 d7                	mov    %edx,%edi
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 370:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 371:	39 f8                	cmp    %edi,%eax
+ 373:	75 fb                	jne    370 <memmove+0x20>
+  return vdst;
+}
+ 375:	5e                   	pop    %esi
+ 376:	89 d0                	mov    %edx,%eax
+ 378:	5f                   	pop    %edi
+ 379:	5d                   	pop    %ebp
+ 37a:	c3                   	ret
+
+0000037b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 37b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <exit>:
+SYSCALL(exit)
+ 383:	b8 02 00 00 00       	mov    $0x2,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <wait>:
+SYSCALL(wait)
+ 38b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <pipe>:
+SYSCALL(pipe)
+ 393:	b8 04 00 00 00       	mov    $0x4,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <read>:
+SYSCALL(read)
+ 39b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <write>:
+SYSCALL(write)
+ 3a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <close>:
+SYSCALL(close)
+ 3ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <kill>:
+SYSCALL(kill)
+ 3b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <exec>:
+SYSCALL(exec)
+ 3bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <open>:
+SYSCALL(open)
+ 3c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mknod>:
+SYSCALL(mknod)
+ 3cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <unlink>:
+SYSCALL(unlink)
+ 3d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <fstat>:
+SYSCALL(fstat)
+ 3db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <link>:
+SYSCALL(link)
+ 3e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mkdir>:
+SYSCALL(mkdir)
+ 3eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <chdir>:
+SYSCALL(chdir)
+ 3f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <dup>:
+SYSCALL(dup)
+ 3fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getpid>:
+SYSCALL(getpid)
+ 403:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <sbrk>:
+SYSCALL(sbrk)
+ 40b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <sleep>:
+SYSCALL(sleep)
+ 413:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <uptime>:
+SYSCALL(uptime)
+ 41b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <superpages>:
+SYSCALL(superpages)
+ 423:	b8 23 00 00 00       	mov    $0x23,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mmap>:
+SYSCALL(mmap)
+ 42b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <munmap>:
+SYSCALL(munmap)
+ 433:	b8 25 00 00 00       	mov    $0x25,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <spawn>:
+SYSCALL(spawn)
+ 43b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <swapstat>:
+SYSCALL(swapstat)
+ 443:	b8 27 00 00 00       	mov    $0x27,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 44b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <iostat>:
+SYSCALL(iostat)
+ 453:	b8 29 00 00 00       	mov    $0x29,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <dropcache>:
+SYSCALL(dropcache)
+ 45b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <iosched>:
+SYSCALL(iosched)
+ 463:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <halt>:
+SYSCALL(halt)
+ 46b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <date>:
+SYSCALL(date)
+ 473:	b8 17 00 00 00       	mov    $0x17,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 47b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getgid>:
+SYSCALL(getgid)
+ 483:	b8 19 00 00 00       	mov    $0x19,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <getppid>:
+SYSCALL(getppid)
+ 48b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <setuid>:
+SYSCALL(setuid)
+ 493:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <setgid>:
+SYSCALL(setgid)
+ 49b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getprocs>:
+SYSCALL(getprocs)
+ 4a3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 4ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getpriority>:
+SYSCALL(getpriority)
+ 4b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 4bb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <chown>:
+SYSCALL(chown)
+ 4c3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <chgrp>:
+SYSCALL(chgrp)
+ 4cb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+ 4d3:	66 90                	xchg   %ax,%ax
+ 4d5:	66 90                	xchg   %ax,%ax
+ 4d7:	66 90                	xchg   %ax,%ax
+ 4d9:	66 90                	xchg   %ax,%ax
+ 4db:	66 90                	xchg   %ax,%ax
+ 4dd:	66 90                	xchg   %ax,%ax
+ 4df:	90                   	nop
+
+000004e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4e8:	89 d1                	mov    %edx,%ecx
+{
+ 4ea:	83 ec 3c             	sub    $0x3c,%esp
+ 4ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4f0:	85 d2                	test   %edx,%edx
+ 4f2:	0f 89 80 00 00 00    	jns    578 <printint+0x98>
+ 4f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4fc:	74 7a                	je     578 <printint+0x98>
+    x = -xx;
+ 4fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 500:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 505:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 508:	31 f6                	xor    %esi,%esi
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 510:	89 c8                	mov    %ecx,%eax
+ 512:	31 d2                	xor    %edx,%edx
+ 514:	89 f7                	mov    %esi,%edi
+ 516:	f7 f3                	div    %ebx
+ 518:	8d 76 01             	lea    0x1(%esi),%esi
+ 51b:	0f b6 92 5c 0b 00 00 	movzbl 0xb5c(%edx),%edx
+ 522:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 526:	89 ca                	mov    %ecx,%edx
+ 528:	89 c1                	mov    %eax,%ecx
+ 52a:	39 da                	cmp    %ebx,%edx
+ 52c:	73 e2                	jae    510 <printint+0x30>
+  if(neg)
+ 52e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 531:	85 c0                	test   %eax,%eax
+ 533:	74 07                	je     53c <printint+0x5c>
+    buf[i++] = '-';
+ 535:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 53a:	89 f7                	mov    %esi,%edi
+ 53c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 53f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 542:	01 df                	add    %ebx,%edi
+ 544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 548:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 54b:	83 ec 04             	sub    $0x4,%esp
+ 54e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 551:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 554:	6a 01                	push   $0x1
+ 556:	50                   	push   %eax
+ 557:	56                   	push   %esi
+ 558:	e8 46 fe ff ff       	call   3a3 <write>
+  while(--i >= 0)
+ 55d:	89 f8                	mov    %edi,%eax
+ 55f:	83 c4 10             	add    $0x10,%esp
+ 562:	83 ef 01             	sub    $0x1,%edi
+ 565:	39 d8                	cmp    %ebx,%eax
+ 567:	75 df                	jne    548 <printint+0x68>
+}
+ 569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 56c:	5b                   	pop    %ebx
+ 56d:	5e                   	pop    %esi
+ 56e:	5f                   	pop    %edi
+ 56f:	5d                   	pop    %ebp
+ 570:	c3                   	ret
+ 571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 578:	31 c0                	xor    %eax,%eax
+ 57a:	eb 89                	jmp    505 <printint+0x25>
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 589:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 58c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 58f:	0f b6 1e             	movzbl (%esi),%ebx
+ 592:	83 c6 01             	add    $0x1,%esi
+ 595:	84 db                	test   %bl,%bl
+ 597:	74 67                	je     600 <printf+0x80>
+ 599:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 59c:	31 d2                	xor    %edx,%edx
+ 59e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5a1:	eb 34                	jmp    5d7 <printf+0x57>
+ 5a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5a7:	90                   	nop
+ 5a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5b0:	83 f8 25             	cmp    $0x25,%eax
+ 5b3:	74 18                	je     5cd <printf+0x4d>
+  write(fd, &c, 1);
+ 5b5:	83 ec 04             	sub    $0x4,%esp
+ 5b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5be:	6a 01                	push   $0x1
+ 5c0:	50                   	push   %eax
+ 5c1:	57                   	push   %edi
+ 5c2:	e8 dc fd ff ff       	call   3a3 <write>
+ 5c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d0:	83 c6 01             	add    $0x1,%esi
+ 5d3:	84 db                	test   %bl,%bl
+ 5d5:	74 29                	je     600 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5da:	85 d2                	test   %edx,%edx
+ 5dc:	74 ca                	je     5a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5de:	83 fa 25             	cmp    $0x25,%edx
+ 5e1:	75 ea                	jne    5cd <printf+0x4d>
+      if(c == 'd'){
+ 5e3:	83 f8 25             	cmp    $0x25,%eax
+ 5e6:	0f 84 24 01 00 00    	je     710 <printf+0x190>
+ 5ec:	83 e8 63             	sub    $0x63,%eax
+ 5ef:	83 f8 15             	cmp    $0x15,%eax
+ 5f2:	77 1c                	ja     610 <printf+0x90>
+ 5f4:	ff 24 85 04 0b 00 00 	jmp    *0xb04(,%eax,4)
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 603:	5b                   	pop    %ebx
+ 604:	5e                   	pop    %esi
+ 605:	5f                   	pop    %edi
+ 606:	5d                   	pop    %ebp
+ 607:	c3                   	ret
+ 608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 616:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 61a:	6a 01                	push   $0x1
+ 61c:	52                   	push   %edx
+ 61d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 620:	57                   	push   %edi
+ 621:	e8 7d fd ff ff       	call   3a3 <write>
+ 626:	83 c4 0c             	add    $0xc,%esp
+ 629:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62c:	6a 01                	push   $0x1
+ 62e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 631:	52                   	push   %edx
+ 632:	57                   	push   %edi
+ 633:	e8 6b fd ff ff       	call   3a3 <write>
+        putc(fd, c);
+ 638:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63b:	31 d2                	xor    %edx,%edx
+ 63d:	eb 8e                	jmp    5cd <printf+0x4d>
+ 63f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 64b:	8b 13                	mov    (%ebx),%edx
+ 64d:	6a 00                	push   $0x0
+ 64f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 651:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 654:	e8 87 fe ff ff       	call   4e0 <printint>
+        ap++;
+ 659:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 65c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 65f:	31 d2                	xor    %edx,%edx
+ 661:	e9 67 ff ff ff       	jmp    5cd <printf+0x4d>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 670:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 673:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 675:	83 c0 04             	add    $0x4,%eax
+ 678:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 67b:	85 db                	test   %ebx,%ebx
+ 67d:	0f 84 9d 00 00 00    	je     720 <printf+0x1a0>
+        while(*s != 0){
+ 683:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 686:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 688:	84 c0                	test   %al,%al
+ 68a:	0f 84 3d ff ff ff    	je     5cd <printf+0x4d>
+ 690:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 693:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 696:	89 de                	mov    %ebx,%esi
+ 698:	89 d3                	mov    %edx,%ebx
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	53                   	push   %ebx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 f1 fc ff ff       	call   3a3 <write>
+        while(*s != 0){
+ 6b2:	0f b6 06             	movzbl (%esi),%eax
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	75 e4                	jne    6a0 <printf+0x120>
+      state = 0;
+ 6bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6bf:	31 d2                	xor    %edx,%edx
+ 6c1:	e9 07 ff ff ff       	jmp    5cd <printf+0x4d>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6db:	8b 13                	mov    (%ebx),%edx
+ 6dd:	6a 01                	push   $0x1
+ 6df:	e9 6b ff ff ff       	jmp    64f <printf+0xcf>
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	52                   	push   %edx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 a1 fc ff ff       	call   3a3 <write>
+        ap++;
+ 702:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 705:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 708:	31 d2                	xor    %edx,%edx
+ 70a:	e9 be fe ff ff       	jmp    5cd <printf+0x4d>
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 716:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 719:	6a 01                	push   $0x1
+ 71b:	e9 11 ff ff ff       	jmp    631 <printf+0xb1>
+ 720:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 725:	bb fd 0a 00 00       	mov    $0xafd,%ebx
+ 72a:	e9 61 ff ff ff       	jmp    690 <printf+0x110>
+ 72f:	90                   	nop
+
+00000730 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 733:	a1 64 0f 00 00       	mov    0xf64,%eax
+{
+ 738:	89 e5                	mov    %esp,%ebp
+ 73a:	56                   	push   %esi
+ 73b:	53                   	push   %ebx
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 740:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 742:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 744:	39 ca                	cmp    %ecx,%edx
+ 746:	73 30                	jae    778 <lfree+0x48>
+ 748:	39 c1                	cmp    %eax,%ecx
+ 74a:	72 04                	jb     750 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 74c:	39 c2                	cmp    %eax,%edx
+ 74e:	72 f0                	jb     740 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 750:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 753:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 756:	39 f0                	cmp    %esi,%eax
+ 758:	74 26                	je     780 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 75a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 75c:	8b 42 04             	mov    0x4(%edx),%eax
+ 75f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 762:	39 d9                	cmp    %ebx,%ecx
+ 764:	74 30                	je     796 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 766:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 768:	5b                   	pop    %ebx
+  freep = p;
+ 769:	89 15 64 0f 00 00    	mov    %edx,0xf64
+}
+ 76f:	5e                   	pop    %esi
+ 770:	5d                   	pop    %ebp
+ 771:	c3                   	ret
+ 772:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 778:	39 c1                	cmp    %eax,%ecx
+ 77a:	72 d0                	jb     74c <lfree+0x1c>
+ 77c:	eb c2                	jmp    740 <lfree+0x10>
+ 77e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 780:	03 58 04             	add    0x4(%eax),%ebx
+ 783:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 786:	8b 02                	mov    (%edx),%eax
+ 788:	8b 00                	mov    (%eax),%eax
+ 78a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 78c:	8b 42 04             	mov    0x4(%edx),%eax
+ 78f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 792:	39 d9                	cmp    %ebx,%ecx
+ 794:	75 d0                	jne    766 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 796:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 799:	89 15 64 0f 00 00    	mov    %edx,0xf64
+    p->s.size += bp->s.size;
+ 79f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7a2:	8b 09                	mov    (%ecx),%ecx
+ 7a4:	89 0a                	mov    %ecx,(%edx)
+}
+ 7a6:	5b                   	pop    %ebx
+ 7a7:	5e                   	pop    %esi
+ 7a8:	5d                   	pop    %ebp
+ 7a9:	c3                   	ret
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007b0 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	89 c7                	mov    %eax,%edi
+ 7b6:	56                   	push   %esi
+ 7b7:	53                   	push   %ebx
+ 7b8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 7bb:	a1 64 0f 00 00       	mov    0xf64,%eax
+ 7c0:	85 c0                	test   %eax,%eax
+ 7c2:	0f 84 88 00 00 00    	je     850 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7c8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 7ca:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 7cd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7d2:	39 df                	cmp    %ebx,%edi
+ 7d4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7d7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 7de:	39 f9                	cmp    %edi,%ecx
+ 7e0:	72 0f                	jb     7f1 <lalloc+0x41>
+ 7e2:	eb 4c                	jmp    830 <lalloc+0x80>
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7e8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 7ea:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 7ed:	39 f9                	cmp    %edi,%ecx
+ 7ef:	73 3f                	jae    830 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 7f1:	89 d0                	mov    %edx,%eax
+ 7f3:	39 15 64 0f 00 00    	cmp    %edx,0xf64
+ 7f9:	75 ed                	jne    7e8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 7fb:	83 ec 0c             	sub    $0xc,%esp
+ 7fe:	56                   	push   %esi
+ 7ff:	e8 07 fc ff ff       	call   40b <sbrk>
+  if(p == (char*)-1)
+ 804:	83 c4 10             	add    $0x10,%esp
+ 807:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 80a:	74 11                	je     81d <lalloc+0x6d>
+  hp->s.size = nu;
+ 80c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 80f:	e8 1c ff ff ff       	call   730 <lfree>
+  return freep;
+ 814:	a1 64 0f 00 00       	mov    0xf64,%eax
+      if((p = morecore(nunits)) == 0)
+ 819:	85 c0                	test   %eax,%eax
+ 81b:	75 cb                	jne    7e8 <lalloc+0x38>
+        return 0;
+  }
+}
+ 81d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 820:	31 d2                	xor    %edx,%edx
+}
+ 822:	5b                   	pop    %ebx
+ 823:	89 d0                	mov    %edx,%eax
+ 825:	5e                   	pop    %esi
+ 826:	5f                   	pop    %edi
+ 827:	5d                   	pop    %ebp
+ 828:	c3                   	ret
+ 829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 830:	39 cf                	cmp    %ecx,%edi
+ 832:	74 4c                	je     880 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 834:	29 f9                	sub    %edi,%ecx
+ 836:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 839:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 83c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 83f:	a3 64 0f 00 00       	mov    %eax,0xf64
+}
+ 844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 847:	89 d0                	mov    %edx,%eax
+ 849:	5b                   	pop    %ebx
+ 84a:	5e                   	pop    %esi
+ 84b:	5f                   	pop    %edi
+ 84c:	5d                   	pop    %ebp
+ 84d:	c3                   	ret
+ 84e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 850:	ba 68 0f 00 00       	mov    $0xf68,%edx
+ 855:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 857:	c7 05 64 0f 00 00 68 	movl   $0xf68,0xf64
+ 85e:	0f 00 00 
+ 861:	c7 05 68 0f 00 00 68 	movl   $0xf68,0xf68
+ 868:	0f 00 00 
+ 86b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 86d:	c7 05 6c 0f 00 00 00 	movl   $0x0,0xf6c
+ 874:	00 00 00 
+ 877:	e9 51 ff ff ff       	jmp    7cd <lalloc+0x1d>
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 880:	8b 0a                	mov    (%edx),%ecx
+ 882:	89 08                	mov    %ecx,(%eax)
+ 884:	eb b9                	jmp    83f <lalloc+0x8f>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000890 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 899:	85 f6                	test   %esi,%esi
+ 89b:	74 42                	je     8df <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 89d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 8a0:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 8a3:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 8a9:	77 3d                	ja     8e8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 8ab:	31 c9                	xor    %ecx,%ecx
+ 8ad:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 8b2:	83 fa 02             	cmp    $0x2,%edx
+ 8b5:	74 17                	je     8ce <free+0x3e>
+ 8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8be:	66 90                	xchg   %ax,%ax
+ 8c0:	83 c1 01             	add    $0x1,%ecx
+ 8c3:	89 d8                	mov    %ebx,%eax
+ 8c5:	d3 e0                	shl    %cl,%eax
+ 8c7:	83 c0 01             	add    $0x1,%eax
+ 8ca:	39 c2                	cmp    %eax,%edx
+ 8cc:	75 f2                	jne    8c0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 8ce:	8b 04 8d 40 0f 00 00 	mov    0xf40(,%ecx,4),%eax
+  classes[c] = bp;
+ 8d5:	89 3c 8d 40 0f 00 00 	mov    %edi,0xf40(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 8dc:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 8df:	5b                   	pop    %ebx
+ 8e0:	5e                   	pop    %esi
+ 8e1:	5f                   	pop    %edi
+ 8e2:	5d                   	pop    %ebp
+ 8e3:	c3                   	ret
+ 8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8e8:	5b                   	pop    %ebx
+    lfree(bp);
+ 8e9:	89 f8                	mov    %edi,%eax
+}
+ 8eb:	5e                   	pop    %esi
+ 8ec:	5f                   	pop    %edi
+ 8ed:	5d                   	pop    %ebp
+    lfree(bp);
+ 8ee:	e9 3d fe ff ff       	jmp    730 <lfree>
+ 8f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000900 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 909:	8b 45 08             	mov    0x8(%ebp),%eax
+ 90c:	83 c0 07             	add    $0x7,%eax
+ 90f:	c1 e8 03             	shr    $0x3,%eax
+ 912:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 915:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 91a:	77 44                	ja     960 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 91c:	31 c9                	xor    %ecx,%ecx
+ 91e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 923:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 928:	83 f8 02             	cmp    $0x2,%eax
+ 92b:	76 11                	jbe    93e <malloc+0x3e>
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+ 930:	83 c1 01             	add    $0x1,%ecx
+ 933:	89 d3                	mov    %edx,%ebx
+ 935:	d3 e3                	shl    %cl,%ebx
+ 937:	83 c3 01             	add    $0x1,%ebx
+ 93a:	39 c3                	cmp    %eax,%ebx
+ 93c:	72 f2                	jb     930 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 93e:	8b 04 8d 40 0f 00 00 	mov    0xf40(,%ecx,4),%eax
+ 945:	85 c0                	test   %eax,%eax
+ 947:	74 2f                	je     978 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 949:	8b 10                	mov    (%eax),%edx
+ 94b:	89 14 8d 40 0f 00 00 	mov    %edx,0xf40(,%ecx,4)
+  return (void*)(p + 1);
+ 952:	83 c0 08             	add    $0x8,%eax
+}
+ 955:	83 c4 1c             	add    $0x1c,%esp
+ 958:	5b                   	pop    %ebx
+ 959:	5e                   	pop    %esi
+ 95a:	5f                   	pop    %edi
+ 95b:	5d                   	pop    %ebp
+ 95c:	c3                   	ret
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 960:	e8 4b fe ff ff       	call   7b0 <lalloc>
+ 965:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 967:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 96a:	85 d2                	test   %edx,%edx
+ 96c:	75 e7                	jne    955 <malloc+0x55>
+      return 0;
+ 96e:	31 c0                	xor    %eax,%eax
+ 970:	eb e3                	jmp    955 <malloc+0x55>
+ 972:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 978:	31 d2                	xor    %edx,%edx
+ 97a:	b8 00 02 00 00       	mov    $0x200,%eax
+ 97f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 982:	f7 f3                	div    %ebx
+  if(n < 4)
+ 984:	ba 04 00 00 00       	mov    $0x4,%edx
+ 989:	89 d6                	mov    %edx,%esi
+ 98b:	39 d0                	cmp    %edx,%eax
+ 98d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 990:	0f af f3             	imul   %ebx,%esi
+ 993:	89 f0                	mov    %esi,%eax
+ 995:	e8 16 fe ff ff       	call   7b0 <lalloc>
+ 99a:	85 c0                	test   %eax,%eax
+ 99c:	74 d0                	je     96e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 99e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9a1:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 9a4:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9ab:	8b 14 8d 40 0f 00 00 	mov    0xf40(,%ecx,4),%edx
+ 9b2:	39 f8                	cmp    %edi,%eax
+ 9b4:	73 22                	jae    9d8 <malloc+0xd8>
+ 9b6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9b9:	eb 09                	jmp    9c4 <malloc+0xc4>
+ 9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+ 9c0:	89 c2                	mov    %eax,%edx
+ 9c2:	89 c8                	mov    %ecx,%eax
+ 9c4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ 9c7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ 9ca:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ 9cc:	39 f9                	cmp    %edi,%ecx
+ 9ce:	72 f0                	jb     9c0 <malloc+0xc0>
+ 9d0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9d3:	e9 73 ff ff ff       	jmp    94b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ 9d8:	89 d0                	mov    %edx,%eax
+ 9da:	8b 12                	mov    (%edx),%edx
+ 9dc:	e9 6a ff ff ff       	jmp    94b <malloc+0x4b>
+ 9e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+
+000009f0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	56                   	push   %esi
+ 9f4:	53                   	push   %ebx
+ 9f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ 9fb:	85 c9                	test   %ecx,%ecx
+ 9fd:	74 06                	je     a05 <calloc+0x15>
+ 9ff:	89 c8                	mov    %ecx,%eax
+ a01:	f7 e3                	mul    %ebx
+ a03:	70 33                	jo     a38 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ a05:	0f af d9             	imul   %ecx,%ebx
+ a08:	83 ec 0c             	sub    $0xc,%esp
+ a0b:	53                   	push   %ebx
+ a0c:	e8 ef fe ff ff       	call   900 <malloc>
+ a11:	83 c4 10             	add    $0x10,%esp
+ a14:	89 c6                	mov    %eax,%esi
+ a16:	85 c0                	test   %eax,%eax
+ a18:	74 1e                	je     a38 <calloc+0x48>
+    memset(p, 0, n * size);
+ a1a:	83 ec 04             	sub    $0x4,%esp
+ a1d:	53                   	push   %ebx
+ a1e:	6a 00                	push   $0x0
+ a20:	50                   	push   %eax
+ a21:	e8 3a f7 ff ff       	call   160 <memset>
+ a26:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ a29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a2c:	89 f0                	mov    %esi,%eax
+ a2e:	5b                   	pop    %ebx
+ a2f:	5e                   	pop    %esi
+ a30:	5d                   	pop    %ebp
+ a31:	c3                   	ret
+ a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ a38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ a3b:	31 f6                	xor    %esi,%esi
+}
+ a3d:	89 f0                	mov    %esi,%eax
+ a3f:	5b                   	pop    %ebx
+ a40:	5e                   	pop    %esi
+ a41:	5d                   	pop    %ebp
+ a42:	c3                   	ret
+ a43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a50 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 0c             	sub    $0xc,%esp
+ a59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ a5f:	85 db                	test   %ebx,%ebx
+ a61:	74 55                	je     ab8 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ a63:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ a66:	89 de                	mov    %ebx,%esi
+ a68:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ a6f:	39 c7                	cmp    %eax,%edi
+ a71:	72 0d                	jb     a80 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ a73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a76:	89 f0                	mov    %esi,%eax
+ a78:	5b                   	pop    %ebx
+ a79:	5e                   	pop    %esi
+ a7a:	5f                   	pop    %edi
+ a7b:	5d                   	pop    %ebp
+ a7c:	c3                   	ret
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ a80:	83 ec 0c             	sub    $0xc,%esp
+ a83:	50                   	push   %eax
+ a84:	e8 77 fe ff ff       	call   900 <malloc>
+ a89:	83 c4 10             	add    $0x10,%esp
+ a8c:	89 c6                	mov    %eax,%esi
+ a8e:	85 c0                	test   %eax,%eax
+ a90:	74 e1                	je     a73 <realloc+0x23>
+  memmove(p, ap, have);
+ a92:	83 ec 04             	sub    $0x4,%esp
+ a95:	57                   	push   %edi
+ a96:	53                   	push   %ebx
+ a97:	50                   	push   %eax
+ a98:	e8 b3 f8 ff ff       	call   350 <memmove>
+  free(ap);
+ a9d:	89 1c 24             	mov    %ebx,(%esp)
+ aa0:	e8 eb fd ff ff       	call   890 <free>
+  return p;
+ aa5:	83 c4 10             	add    $0x10,%esp
+}
+ aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aab:	89 f0                	mov    %esi,%eax
+ aad:	5b                   	pop    %ebx
+ aae:	5e                   	pop    %esi
+ aaf:	5f                   	pop    %edi
+ ab0:	5d                   	pop    %ebp
+ ab1:	c3                   	ret
+ ab2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ ab8:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ abb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ abe:	5b                   	pop    %ebx
+ abf:	5e                   	pop    %esi
+ ac0:	5f                   	pop    %edi
+ ac1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ ac2:	e9 39 fe ff ff       	jmp    900 <malloc>
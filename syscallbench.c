@@ -0,0 +1,35 @@
+// Measure system call latency: time N calls each of getpid(),
+// which does almost nothing but enter and leave the kernel, and
+// uptime(), which also takes a lock.  Both lean on mycpu() and
+// myproc(), in the trap path and in acquire().
+
+#include "types.h"
+#include "user.h"
+
+#define N 200000
+
+static void
+report(char *what, int t)
+{
+  if(t == 0)
+    t = 1;
+  printf(1, "%s: %d calls in %d ms, %d ns per call\n",
+         what, N, t, t * (1000000 / N));
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, t;
+
+  t = uptime();
+  for(i = 0; i < N; i++)
+    getpid();
+  report("getpid", uptime() - t);
+
+  t = uptime();
+  for(i = 0; i < N; i++)
+    uptime();
+  report("uptime", uptime() - t);
+  exit();
+}
@@ -15,6 +15,8 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "mman.h"
+#include "iostat.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -85,7 +87,7 @@ sys_write(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argrdptr(1, &p, n) < 0)
     return -1;
   return filewrite(f, p, n);
 }
@@ -226,6 +228,8 @@ sys_unlink(void)
 
   ip->nlink--;
   iupdate(ip);
+  if(ip->type == T_FILE)
+    textinval(ip);
   iunlockput(ip);
 
   end_op();
@@ -258,8 +262,10 @@ create(char *path, short type, short major, short minor)
     return 0;
   }
 
-  if((ip = ialloc(dp->dev, type)) == 0)
-    panic("create: ialloc");
+  if((ip = ialloc(dp->dev, type)) == 0){
+    iunlockput(dp);
+    return 0;
+  }
 
   ilock(ip);
   ip->major = major;
@@ -420,6 +426,34 @@ sys_exec(void)
   return exec(path, argv);
 }
 
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  int i, nfd, *fdmap;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+     argint(3, &nfd) < 0 || nfd < 0 || nfd > NOFILE ||
+     argptr(2, (void*)&fdmap, nfd*sizeof(fdmap[0])) < 0){
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+  for(i=0;; i++){
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+      return -1;
+    if(uarg == 0){
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+      return -1;
+  }
+  return spawn(path, argv, fdmap, nfd);
+}
+
 int
 sys_pipe(void)
 {
@@ -444,6 +478,46 @@ sys_pipe(void)
   return 0;
 }
 
+// Map a file or anonymous memory into the address space.
+// The address argument is only a hint and is ignored.
+int
+sys_mmap(void)
+{
+  int len, prot, flags, off;
+  struct file *f;
+  struct inode *ip;
+
+  if(argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(len <= 0 || off < 0 || off % PGSIZE != 0)
+    return -1;
+  if(!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE))
+    return -1;
+  ip = 0;
+  if(flags & MAP_ANON){
+    if(flags & MAP_SHARED)
+      return -1;  // only fork-shared memory would make sense
+  } else {
+    if(argfd(4, 0, &f) < 0 || f->type != FD_INODE || !f->readable)
+      return -1;
+    if((flags & MAP_SHARED) && (prot & PROT_WRITE) && !f->writable)
+      return -1;
+    ip = f->ip;
+  }
+  return vmamap(myproc(), len, (prot & PROT_WRITE) ? PTE_W : 0, flags, ip, off);
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  return vmaunmap(myproc(), addr, len);
+}
+
 
 #ifdef CS333_P5
 int
@@ -490,3 +564,34 @@ sys_chgrp(void)
 }
 
 #endif
+
+int
+sys_iostat(void)
+{
+  struct iostat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  bstat(st);
+  idestat(st);
+  logstat(st);
+  return 0;
+}
+
+int
+sys_dropcache(void)
+{
+  bdrop();
+  return 0;
+}
+
+// Set the disk scheduler policy; return the old one.
+int
+sys_iosched(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return idesched(n);
+}
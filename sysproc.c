@@ -10,6 +10,8 @@
 #include "pdx-kernel.h"
 #endif // PDX_XV6
 #include "uproc.h"
+#include "swap.h"
+#include "meminfo.h"
 
 int
 sys_fork(void)
@@ -60,6 +62,43 @@ sys_sbrk(void)
   return addr;
 }
 
+int
+sys_swapstat(void)
+{
+  struct swapstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  swapstat(st);
+  return 0;
+}
+
+int
+sys_getmeminfo(void)
+{
+  struct meminfo *mi;
+
+  if(argptr(0, (void*)&mi, sizeof(*mi)) < 0)
+    return -1;
+  kmeminfo(mi);
+  return 0;
+}
+
+// Back 4MB-aligned, 4MB-sized stretches of the heap with
+// superpages (on != 0) or ordinary pages (on == 0) from now on.
+// Returns the previous setting.
+int
+sys_superpages(void)
+{
+  int on, old;
+
+  if(argint(0, &on) < 0)
+    return -1;
+  old = myproc()->superpg;
+  myproc()->superpg = (on != 0);
+  return old;
+}
+
 int
 sys_sleep(void)
 {
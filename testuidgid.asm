@@ -0,0 +1,1888 @@
+
+_testuidgid:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "Done!\n");
+  return 0;
+}
+
+int
+main() {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  uint uid = getuid();
+   f:	e8 c7 06 00 00       	call   6db <getuid>
+  printf(1, "Current UID is: %d\n", uid);
+  14:	83 ec 04             	sub    $0x4,%esp
+  17:	50                   	push   %eax
+  18:	68 28 0d 00 00       	push   $0xd28
+  1d:	6a 01                	push   $0x1
+  1f:	e8 bc 07 00 00       	call   7e0 <printf>
+  printf(1, "Setting UID to %d\n", nval);
+  24:	83 c4 0c             	add    $0xc,%esp
+  27:	6a 64                	push   $0x64
+  29:	68 3c 0d 00 00       	push   $0xd3c
+  2e:	6a 01                	push   $0x1
+  30:	e8 ab 07 00 00       	call   7e0 <printf>
+  if (setuid(nval) < 0)
+  35:	c7 04 24 64 00 00 00 	movl   $0x64,(%esp)
+  3c:	e8 b2 06 00 00       	call   6f3 <setuid>
+  41:	83 c4 10             	add    $0x10,%esp
+  44:	85 c0                	test   %eax,%eax
+  46:	0f 88 63 02 00 00    	js     2af <main+0x2af>
+  uid = getuid();
+  4c:	e8 8a 06 00 00       	call   6db <getuid>
+  printf(1, "Current UID is: %d\n", uid);
+  51:	83 ec 04             	sub    $0x4,%esp
+  54:	50                   	push   %eax
+  55:	68 28 0d 00 00       	push   $0xd28
+  5a:	6a 01                	push   $0x1
+  5c:	e8 7f 07 00 00       	call   7e0 <printf>
+  sleep(5 * TPS);  // now type control-p
+  61:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+  68:	e8 06 06 00 00       	call   673 <sleep>
+  uint gid = getgid();
+  6d:	e8 71 06 00 00       	call   6e3 <getgid>
+  printf(1, "Current GID is: %d\n", gid);
+  72:	83 c4 0c             	add    $0xc,%esp
+  75:	50                   	push   %eax
+  76:	68 67 0d 00 00       	push   $0xd67
+  7b:	6a 01                	push   $0x1
+  7d:	e8 5e 07 00 00       	call   7e0 <printf>
+  printf(1, "Setting GID to %d\n", nval);
+  82:	83 c4 0c             	add    $0xc,%esp
+  85:	68 c8 00 00 00       	push   $0xc8
+  8a:	68 7b 0d 00 00       	push   $0xd7b
+  8f:	6a 01                	push   $0x1
+  91:	e8 4a 07 00 00       	call   7e0 <printf>
+  if (setgid(nval) < 0)
+  96:	c7 04 24 c8 00 00 00 	movl   $0xc8,(%esp)
+  9d:	e8 59 06 00 00       	call   6fb <setgid>
+  a2:	83 c4 10             	add    $0x10,%esp
+  a5:	85 c0                	test   %eax,%eax
+  a7:	0f 88 e8 01 00 00    	js     295 <main+0x295>
+  setgid(nval);
+  ad:	83 ec 0c             	sub    $0xc,%esp
+  b0:	68 c8 00 00 00       	push   $0xc8
+  b5:	e8 41 06 00 00       	call   6fb <setgid>
+  gid = getgid();
+  ba:	e8 24 06 00 00       	call   6e3 <getgid>
+  printf(1, "Current GID is: %d\n", gid);
+  bf:	83 c4 0c             	add    $0xc,%esp
+  c2:	50                   	push   %eax
+  c3:	68 67 0d 00 00       	push   $0xd67
+  c8:	6a 01                	push   $0x1
+  ca:	e8 11 07 00 00       	call   7e0 <printf>
+  sleep(5 * TPS);  // now type control-p
+  cf:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+  d6:	e8 98 05 00 00       	call   673 <sleep>
+  ppid = getppid();
+  db:	e8 0b 06 00 00       	call   6eb <getppid>
+  printf(1, "My parent process is: %d\n", ppid);
+  e0:	83 c4 0c             	add    $0xc,%esp
+  e3:	50                   	push   %eax
+  e4:	68 a6 0d 00 00       	push   $0xda6
+  e9:	6a 01                	push   $0x1
+  eb:	e8 f0 06 00 00       	call   7e0 <printf>
+  printf(1, "Setting UID to %d and GID to %d before fork(). Value"
+  f0:	6a 6f                	push   $0x6f
+  f2:	6a 6f                	push   $0x6f
+  f4:	68 dc 0d 00 00       	push   $0xddc
+  f9:	6a 01                	push   $0x1
+  fb:	e8 e0 06 00 00       	call   7e0 <printf>
+  if (setuid(nval) < 0)
+ 100:	83 c4 14             	add    $0x14,%esp
+ 103:	6a 6f                	push   $0x6f
+ 105:	e8 e9 05 00 00       	call   6f3 <setuid>
+ 10a:	83 c4 10             	add    $0x10,%esp
+ 10d:	85 c0                	test   %eax,%eax
+ 10f:	0f 88 69 01 00 00    	js     27e <main+0x27e>
+  if (setgid(nval) < 0)
+ 115:	83 ec 0c             	sub    $0xc,%esp
+ 118:	6a 6f                	push   $0x6f
+ 11a:	e8 dc 05 00 00       	call   6fb <setgid>
+ 11f:	83 c4 10             	add    $0x10,%esp
+ 122:	85 c0                	test   %eax,%eax
+ 124:	0f 88 3d 01 00 00    	js     267 <main+0x267>
+  printf(1, "Before fork(), UID = %d, GID = %d\n", getuid(), getgid());
+ 12a:	e8 b4 05 00 00       	call   6e3 <getgid>
+ 12f:	89 c3                	mov    %eax,%ebx
+ 131:	e8 a5 05 00 00       	call   6db <getuid>
+ 136:	53                   	push   %ebx
+ 137:	50                   	push   %eax
+ 138:	68 28 0e 00 00       	push   $0xe28
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 9c 06 00 00       	call   7e0 <printf>
+  pid = fork();
+ 144:	e8 92 04 00 00       	call   5db <fork>
+  if (pid == 0) {  // child
+ 149:	83 c4 10             	add    $0x10,%esp
+ 14c:	85 c0                	test   %eax,%eax
+ 14e:	0f 84 72 01 00 00    	je     2c6 <main+0x2c6>
+    wait();
+ 154:	e8 92 04 00 00       	call   5eb <wait>
+  printf(1, "Setting UID to %d. This test should FAIL\n", nval);
+ 159:	83 ec 04             	sub    $0x4,%esp
+ 15c:	68 20 80 00 00       	push   $0x8020
+ 161:	68 6c 0e 00 00       	push   $0xe6c
+ 166:	6a 01                	push   $0x1
+ 168:	e8 73 06 00 00       	call   7e0 <printf>
+  if (setuid(nval) < 0)
+ 16d:	c7 04 24 20 80 00 00 	movl   $0x8020,(%esp)
+ 174:	e8 7a 05 00 00       	call   6f3 <setuid>
+ 179:	83 c4 10             	add    $0x10,%esp
+ 17c:	85 c0                	test   %eax,%eax
+ 17e:	0f 88 a4 00 00 00    	js     228 <main+0x228>
+    printf(2, "FAILURE! The setuid system call indicates success\n");
+ 184:	50                   	push   %eax
+ 185:	50                   	push   %eax
+ 186:	68 cc 0e 00 00       	push   $0xecc
+ 18b:	6a 02                	push   $0x2
+ 18d:	e8 4e 06 00 00       	call   7e0 <printf>
+ 192:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Setting GID to %d. This test should FAIL\n", nval);
+ 195:	83 ec 04             	sub    $0x4,%esp
+ 198:	68 20 80 00 00       	push   $0x8020
+ 19d:	68 00 0f 00 00       	push   $0xf00
+ 1a2:	6a 01                	push   $0x1
+ 1a4:	e8 37 06 00 00       	call   7e0 <printf>
+  if (setgid(nval) < 0)
+ 1a9:	c7 04 24 20 80 00 00 	movl   $0x8020,(%esp)
+ 1b0:	e8 46 05 00 00       	call   6fb <setgid>
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	85 c0                	test   %eax,%eax
+ 1ba:	0f 88 91 00 00 00    	js     251 <main+0x251>
+    printf(2, "FAILURE! The setgid system call indicates success\n");
+ 1c0:	50                   	push   %eax
+ 1c1:	50                   	push   %eax
+ 1c2:	68 60 0f 00 00       	push   $0xf60
+ 1c7:	6a 02                	push   $0x2
+ 1c9:	e8 12 06 00 00       	call   7e0 <printf>
+ 1ce:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Setting UID to %d. This test should FAIL\n", -1);
+ 1d1:	83 ec 04             	sub    $0x4,%esp
+ 1d4:	6a ff                	push   $0xffffffff
+ 1d6:	68 6c 0e 00 00       	push   $0xe6c
+ 1db:	6a 01                	push   $0x1
+ 1dd:	e8 fe 05 00 00       	call   7e0 <printf>
+  if (setuid(-1) < 0)
+ 1e2:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+ 1e9:	e8 05 05 00 00       	call   6f3 <setuid>
+ 1ee:	83 c4 10             	add    $0x10,%esp
+ 1f1:	85 c0                	test   %eax,%eax
+ 1f3:	78 49                	js     23e <main+0x23e>
+    printf(2, "FAILURE! The setgid system call indicates success\n");
+ 1f5:	51                   	push   %ecx
+ 1f6:	51                   	push   %ecx
+ 1f7:	68 60 0f 00 00       	push   $0xf60
+ 1fc:	6a 02                	push   $0x2
+ 1fe:	e8 dd 05 00 00       	call   7e0 <printf>
+ 203:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Done!\n");
+ 206:	83 ec 08             	sub    $0x8,%esp
+ 209:	68 c0 0d 00 00       	push   $0xdc0
+ 20e:	6a 01                	push   $0x1
+ 210:	e8 cb 05 00 00       	call   7e0 <printf>
+  testuidgid();
+  printf(1, "After testuidgid()\n");
+ 215:	58                   	pop    %eax
+ 216:	5a                   	pop    %edx
+ 217:	68 c7 0d 00 00       	push   $0xdc7
+ 21c:	6a 01                	push   $0x1
+ 21e:	e8 bd 05 00 00       	call   7e0 <printf>
+  exit();
+ 223:	e8 bb 03 00 00       	call   5e3 <exit>
+    printf(1, "SUCCESS! The setuid sytem call indicated failure\n");
+ 228:	50                   	push   %eax
+ 229:	50                   	push   %eax
+ 22a:	68 98 0e 00 00       	push   $0xe98
+ 22f:	6a 01                	push   $0x1
+ 231:	e8 aa 05 00 00       	call   7e0 <printf>
+ 236:	83 c4 10             	add    $0x10,%esp
+ 239:	e9 57 ff ff ff       	jmp    195 <main+0x195>
+    printf(1, "SUCCESS! The setuid sytem call indicated failure\n");
+ 23e:	53                   	push   %ebx
+ 23f:	53                   	push   %ebx
+ 240:	68 98 0e 00 00       	push   $0xe98
+ 245:	6a 01                	push   $0x1
+ 247:	e8 94 05 00 00       	call   7e0 <printf>
+ 24c:	83 c4 10             	add    $0x10,%esp
+ 24f:	eb b5                	jmp    206 <main+0x206>
+    printf(1, "SUCCESS! The setgid sytem call indicated failure\n");
+ 251:	50                   	push   %eax
+ 252:	50                   	push   %eax
+ 253:	68 2c 0f 00 00       	push   $0xf2c
+ 258:	6a 01                	push   $0x1
+ 25a:	e8 81 05 00 00       	call   7e0 <printf>
+ 25f:	83 c4 10             	add    $0x10,%esp
+ 262:	e9 6a ff ff ff       	jmp    1d1 <main+0x1d1>
+    printf(2, "Error. Invalid UID: %d\n", nval);
+ 267:	50                   	push   %eax
+ 268:	6a 6f                	push   $0x6f
+ 26a:	68 4f 0d 00 00       	push   $0xd4f
+ 26f:	6a 02                	push   $0x2
+ 271:	e8 6a 05 00 00       	call   7e0 <printf>
+ 276:	83 c4 10             	add    $0x10,%esp
+ 279:	e9 ac fe ff ff       	jmp    12a <main+0x12a>
+    printf(2, "Error. Invalid UID: %d\n", nval);
+ 27e:	52                   	push   %edx
+ 27f:	6a 6f                	push   $0x6f
+ 281:	68 4f 0d 00 00       	push   $0xd4f
+ 286:	6a 02                	push   $0x2
+ 288:	e8 53 05 00 00       	call   7e0 <printf>
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	e9 80 fe ff ff       	jmp    115 <main+0x115>
+    printf(2, "Error. Invalid GID: %d\n", nval);
+ 295:	51                   	push   %ecx
+ 296:	68 c8 00 00 00       	push   $0xc8
+ 29b:	68 8e 0d 00 00       	push   $0xd8e
+ 2a0:	6a 02                	push   $0x2
+ 2a2:	e8 39 05 00 00       	call   7e0 <printf>
+ 2a7:	83 c4 10             	add    $0x10,%esp
+ 2aa:	e9 fe fd ff ff       	jmp    ad <main+0xad>
+    printf(2, "Error. Invalid UID: %d\n", nval);
+ 2af:	53                   	push   %ebx
+ 2b0:	6a 64                	push   $0x64
+ 2b2:	68 4f 0d 00 00       	push   $0xd4f
+ 2b7:	6a 02                	push   $0x2
+ 2b9:	e8 22 05 00 00       	call   7e0 <printf>
+ 2be:	83 c4 10             	add    $0x10,%esp
+ 2c1:	e9 86 fd ff ff       	jmp    4c <main+0x4c>
+    uid = getuid();
+ 2c6:	e8 10 04 00 00       	call   6db <getuid>
+ 2cb:	89 c3                	mov    %eax,%ebx
+    gid = getgid();
+ 2cd:	e8 11 04 00 00       	call   6e3 <getgid>
+    printf(1, "Child: UID is: %d, GID is: %d\n", uid, gid);
+ 2d2:	50                   	push   %eax
+ 2d3:	53                   	push   %ebx
+ 2d4:	68 4c 0e 00 00       	push   $0xe4c
+ 2d9:	6a 01                	push   $0x1
+ 2db:	e8 00 05 00 00       	call   7e0 <printf>
+    sleep(5 * TPS);  // now type control-p
+ 2e0:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+ 2e7:	e8 87 03 00 00       	call   673 <sleep>
+    exit();
+ 2ec:	e8 f2 02 00 00       	call   5e3 <exit>
+ 2f1:	66 90                	xchg   %ax,%ax
+ 2f3:	66 90                	xchg   %ax,%ax
+ 2f5:	66 90                	xchg   %ax,%ax
+ 2f7:	66 90                	xchg   %ax,%ax
+ 2f9:	66 90                	xchg   %ax,%ax
+ 2fb:	66 90                	xchg   %ax,%ax
+ 2fd:	66 90                	xchg   %ax,%ax
+ 2ff:	90                   	nop
+
+00000300 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 300:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 301:	31 c0                	xor    %eax,%eax
+{
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	53                   	push   %ebx
+ 306:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 310:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 314:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 317:	83 c0 01             	add    $0x1,%eax
+ 31a:	84 d2                	test   %dl,%dl
+ 31c:	75 f2                	jne    310 <strcpy+0x10>
+    ;
+  return os;
+}
+ 31e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 321:	89 c8                	mov    %ecx,%eax
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+ 325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+ 337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 33a:	0f b6 02             	movzbl (%edx),%eax
+ 33d:	84 c0                	test   %al,%al
+ 33f:	75 17                	jne    358 <strcmp+0x28>
+ 341:	eb 3a                	jmp    37d <strcmp+0x4d>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 34c:	83 c2 01             	add    $0x1,%edx
+ 34f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 352:	84 c0                	test   %al,%al
+ 354:	74 1a                	je     370 <strcmp+0x40>
+    p++, q++;
+ 356:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 358:	0f b6 19             	movzbl (%ecx),%ebx
+ 35b:	38 c3                	cmp    %al,%bl
+ 35d:	74 e9                	je     348 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 35f:	29 d8                	sub    %ebx,%eax
+}
+ 361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 364:	c9                   	leave
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 370:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 374:	31 c0                	xor    %eax,%eax
+ 376:	29 d8                	sub    %ebx,%eax
+}
+ 378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 37b:	c9                   	leave
+ 37c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 37d:	0f b6 19             	movzbl (%ecx),%ebx
+ 380:	31 c0                	xor    %eax,%eax
+ 382:	eb db                	jmp    35f <strcmp+0x2f>
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 396:	80 3a 00             	cmpb   $0x0,(%edx)
+ 399:	74 15                	je     3b0 <strlen+0x20>
+ 39b:	31 c0                	xor    %eax,%eax
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+ 3a0:	83 c0 01             	add    $0x1,%eax
+ 3a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3a7:	89 c1                	mov    %eax,%ecx
+ 3a9:	75 f5                	jne    3a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3ab:	89 c8                	mov    %ecx,%eax
+ 3ad:	5d                   	pop    %ebp
+ 3ae:	c3                   	ret
+ 3af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3b0:	31 c9                	xor    %ecx,%ecx
+}
+ 3b2:	5d                   	pop    %ebp
+ 3b3:	89 c8                	mov    %ecx,%eax
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	89 d7                	mov    %edx,%edi
+ 3cf:	fc                   	cld
+ 3d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3d5:	89 d0                	mov    %edx,%eax
+ 3d7:	c9                   	leave
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ea:	0f b6 10             	movzbl (%eax),%edx
+ 3ed:	84 d2                	test   %dl,%dl
+ 3ef:	75 12                	jne    403 <strchr+0x23>
+ 3f1:	eb 1d                	jmp    410 <strchr+0x30>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3fc:	83 c0 01             	add    $0x1,%eax
+ 3ff:	84 d2                	test   %dl,%dl
+ 401:	74 0d                	je     410 <strchr+0x30>
+    if(*s == c)
+ 403:	38 d1                	cmp    %dl,%cl
+ 405:	75 f1                	jne    3f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 407:	5d                   	pop    %ebp
+ 408:	c3                   	ret
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 410:	31 c0                	xor    %eax,%eax
+}
+ 412:	5d                   	pop    %ebp
+ 413:	c3                   	ret
+ 414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+
+00000420 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 425:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 428:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 429:	31 db                	xor    %ebx,%ebx
+{
+ 42b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 42e:	eb 27                	jmp    457 <gets+0x37>
+    cc = read(0, &c, 1);
+ 430:	83 ec 04             	sub    $0x4,%esp
+ 433:	6a 01                	push   $0x1
+ 435:	56                   	push   %esi
+ 436:	6a 00                	push   $0x0
+ 438:	e8 be 01 00 00       	call   5fb <read>
+    if(cc < 1)
+ 43d:	83 c4 10             	add    $0x10,%esp
+ 440:	85 c0                	test   %eax,%eax
+ 442:	7e 1d                	jle    461 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 444:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 44f:	3c 0a                	cmp    $0xa,%al
+ 451:	74 10                	je     463 <gets+0x43>
+ 453:	3c 0d                	cmp    $0xd,%al
+ 455:	74 0c                	je     463 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 457:	89 df                	mov    %ebx,%edi
+ 459:	83 c3 01             	add    $0x1,%ebx
+ 45c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 45f:	7c cf                	jl     430 <gets+0x10>
+ 461:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 46a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46d:	5b                   	pop    %ebx
+ 46e:	5e                   	pop    %esi
+ 46f:	5f                   	pop    %edi
+ 470:	5d                   	pop    %ebp
+ 471:	c3                   	ret
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	56                   	push   %esi
+ 484:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 485:	83 ec 08             	sub    $0x8,%esp
+ 488:	6a 00                	push   $0x0
+ 48a:	ff 75 08             	push   0x8(%ebp)
+ 48d:	e8 91 01 00 00       	call   623 <open>
+  if(fd < 0)
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	78 27                	js     4c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 499:	83 ec 08             	sub    $0x8,%esp
+ 49c:	ff 75 0c             	push   0xc(%ebp)
+ 49f:	89 c3                	mov    %eax,%ebx
+ 4a1:	50                   	push   %eax
+ 4a2:	e8 94 01 00 00       	call   63b <fstat>
+  close(fd);
+ 4a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ac:	e8 5a 01 00 00       	call   60b <close>
+  return r;
+ 4b1:	83 c4 10             	add    $0x10,%esp
+}
+ 4b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4b7:	89 f0                	mov    %esi,%eax
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5d                   	pop    %ebp
+ 4bc:	c3                   	ret
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4c5:	eb ed                	jmp    4b4 <stat+0x34>
+ 4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	56                   	push   %esi
+ 4d4:	53                   	push   %ebx
+ 4d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4d8:	0f b6 02             	movzbl (%edx),%eax
+ 4db:	3c 20                	cmp    $0x20,%al
+ 4dd:	75 0c                	jne    4eb <atoi+0x1b>
+ 4df:	90                   	nop
+ 4e0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 4e4:	83 c2 01             	add    $0x1,%edx
+ 4e7:	3c 20                	cmp    $0x20,%al
+ 4e9:	74 f5                	je     4e0 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 4eb:	3c 2d                	cmp    $0x2d,%al
+ 4ed:	74 41                	je     530 <atoi+0x60>
+ 4ef:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4f4:	3c 2b                	cmp    $0x2b,%al
+ 4f6:	74 3d                	je     535 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 4f8:	0f be 0a             	movsbl (%edx),%ecx
+ 4fb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 4fe:	3c 09                	cmp    $0x9,%al
+ 500:	b8 00 00 00 00       	mov    $0x0,%eax
+ 505:	77 21                	ja     528 <atoi+0x58>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 510:	83 c2 01             	add    $0x1,%edx
+ 513:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 516:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 51a:	0f be 0a             	movsbl (%edx),%ecx
+ 51d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 520:	80 fb 09             	cmp    $0x9,%bl
+ 523:	76 eb                	jbe    510 <atoi+0x40>
+  return sign*n;
+ 525:	0f af c6             	imul   %esi,%eax
+}
+ 528:	5b                   	pop    %ebx
+ 529:	5e                   	pop    %esi
+ 52a:	5d                   	pop    %ebp
+ 52b:	c3                   	ret
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 530:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 535:	83 c2 01             	add    $0x1,%edx
+ 538:	eb be                	jmp    4f8 <atoi+0x28>
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000540 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	56                   	push   %esi
+ 544:	53                   	push   %ebx
+ 545:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 548:	0f b6 02             	movzbl (%edx),%eax
+ 54b:	3c 20                	cmp    $0x20,%al
+ 54d:	75 0c                	jne    55b <atoo+0x1b>
+ 54f:	90                   	nop
+ 550:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 554:	83 c2 01             	add    $0x1,%edx
+ 557:	3c 20                	cmp    $0x20,%al
+ 559:	74 f5                	je     550 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 55b:	3c 2d                	cmp    $0x2d,%al
+ 55d:	74 41                	je     5a0 <atoo+0x60>
+ 55f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 564:	3c 2b                	cmp    $0x2b,%al
+ 566:	74 3d                	je     5a5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 568:	0f be 0a             	movsbl (%edx),%ecx
+ 56b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 56e:	3c 07                	cmp    $0x7,%al
+ 570:	b8 00 00 00 00       	mov    $0x0,%eax
+ 575:	77 1e                	ja     595 <atoo+0x55>
+ 577:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57e:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 580:	83 c2 01             	add    $0x1,%edx
+ 583:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 587:	0f be 0a             	movsbl (%edx),%ecx
+ 58a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 58d:	80 fb 07             	cmp    $0x7,%bl
+ 590:	76 ee                	jbe    580 <atoo+0x40>
+  return sign*n;
+ 592:	0f af c6             	imul   %esi,%eax
+}
+ 595:	5b                   	pop    %ebx
+ 596:	5e                   	pop    %esi
+ 597:	5d                   	pop    %ebp
+ 598:	c3                   	ret
+ 599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 5a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 5a5:	83 c2 01             	add    $0x1,%edx
+ 5a8:	eb be                	jmp    568 <atoo+0x28>
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005b0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+
+000005db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <exit>:
+SYSCALL(exit)
+ 5e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <wait>:
+SYSCALL(wait)
+ 5eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <pipe>:
+SYSCALL(pipe)
+ 5f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <read>:
+SYSCALL(read)
+ 5fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <write>:
+SYSCALL(write)
+ 603:	b8 10 00 00 00       	mov    $0x10,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <close>:
+SYSCALL(close)
+ 60b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <kill>:
+SYSCALL(kill)
+ 613:	b8 06 00 00 00       	mov    $0x6,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <exec>:
+SYSCALL(exec)
+ 61b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <open>:
+SYSCALL(open)
+ 623:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mknod>:
+SYSCALL(mknod)
+ 62b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <unlink>:
+SYSCALL(unlink)
+ 633:	b8 12 00 00 00       	mov    $0x12,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <fstat>:
+SYSCALL(fstat)
+ 63b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <link>:
+SYSCALL(link)
+ 643:	b8 13 00 00 00       	mov    $0x13,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <mkdir>:
+SYSCALL(mkdir)
+ 64b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <chdir>:
+SYSCALL(chdir)
+ 653:	b8 09 00 00 00       	mov    $0x9,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <dup>:
+SYSCALL(dup)
+ 65b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getpid>:
+SYSCALL(getpid)
+ 663:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <sbrk>:
+SYSCALL(sbrk)
+ 66b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <sleep>:
+SYSCALL(sleep)
+ 673:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <uptime>:
+SYSCALL(uptime)
+ 67b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <superpages>:
+SYSCALL(superpages)
+ 683:	b8 23 00 00 00       	mov    $0x23,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <mmap>:
+SYSCALL(mmap)
+ 68b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <munmap>:
+SYSCALL(munmap)
+ 693:	b8 25 00 00 00       	mov    $0x25,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <spawn>:
+SYSCALL(spawn)
+ 69b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <swapstat>:
+SYSCALL(swapstat)
+ 6a3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <getmeminfo>:
+SYSCALL(getmeminfo)
+ 6ab:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <iostat>:
+SYSCALL(iostat)
+ 6b3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <dropcache>:
+SYSCALL(dropcache)
+ 6bb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <iosched>:
+SYSCALL(iosched)
+ 6c3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <halt>:
+SYSCALL(halt)
+ 6cb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <date>:
+SYSCALL(date)
+ 6d3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 6db:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <getgid>:
+SYSCALL(getgid)
+ 6e3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <getppid>:
+SYSCALL(getppid)
+ 6eb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <setuid>:
+SYSCALL(setuid)
+ 6f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <setgid>:
+SYSCALL(setgid)
+ 6fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <getprocs>:
+SYSCALL(getprocs)
+ 703:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 70b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <getpriority>:
+SYSCALL(getpriority)
+ 713:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 71b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <chown>:
+SYSCALL(chown)
+ 723:	b8 21 00 00 00       	mov    $0x21,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <chgrp>:
+SYSCALL(chgrp)
+ 72b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+ 733:	66 90                	xchg   %ax,%ax
+ 735:	66 90                	xchg   %ax,%ax
+ 737:	66 90                	xchg   %ax,%ax
+ 739:	66 90                	xchg   %ax,%ax
+ 73b:	66 90                	xchg   %ax,%ax
+ 73d:	66 90                	xchg   %ax,%ax
+ 73f:	90                   	nop
+
+00000740 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	53                   	push   %ebx
+ 746:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 748:	89 d1                	mov    %edx,%ecx
+{
+ 74a:	83 ec 3c             	sub    $0x3c,%esp
+ 74d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 750:	85 d2                	test   %edx,%edx
+ 752:	0f 89 80 00 00 00    	jns    7d8 <printint+0x98>
+ 758:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 75c:	74 7a                	je     7d8 <printint+0x98>
+    x = -xx;
+ 75e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 760:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 765:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 768:	31 f6                	xor    %esi,%esi
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 770:	89 c8                	mov    %ecx,%eax
+ 772:	31 d2                	xor    %edx,%edx
+ 774:	89 f7                	mov    %esi,%edi
+ 776:	f7 f3                	div    %ebx
+ 778:	8d 76 01             	lea    0x1(%esi),%esi
+ 77b:	0f b6 92 f4 0f 00 00 	movzbl 0xff4(%edx),%edx
+ 782:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 786:	89 ca                	mov    %ecx,%edx
+ 788:	89 c1                	mov    %eax,%ecx
+ 78a:	39 da                	cmp    %ebx,%edx
+ 78c:	73 e2                	jae    770 <printint+0x30>
+  if(neg)
+ 78e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 791:	85 c0                	test   %eax,%eax
+ 793:	74 07                	je     79c <printint+0x5c>
+    buf[i++] = '-';
+ 795:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 79a:	89 f7                	mov    %esi,%edi
+ 79c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 79f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7a2:	01 df                	add    %ebx,%edi
+ 7a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7ab:	83 ec 04             	sub    $0x4,%esp
+ 7ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7b4:	6a 01                	push   $0x1
+ 7b6:	50                   	push   %eax
+ 7b7:	56                   	push   %esi
+ 7b8:	e8 46 fe ff ff       	call   603 <write>
+  while(--i >= 0)
+ 7bd:	89 f8                	mov    %edi,%eax
+ 7bf:	83 c4 10             	add    $0x10,%esp
+ 7c2:	83 ef 01             	sub    $0x1,%edi
+ 7c5:	39 d8                	cmp    %ebx,%eax
+ 7c7:	75 df                	jne    7a8 <printint+0x68>
+}
+ 7c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7cc:	5b                   	pop    %ebx
+ 7cd:	5e                   	pop    %esi
+ 7ce:	5f                   	pop    %edi
+ 7cf:	5d                   	pop    %ebp
+ 7d0:	c3                   	ret
+ 7d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7d8:	31 c0                	xor    %eax,%eax
+ 7da:	eb 89                	jmp    765 <printint+0x25>
+ 7dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	56                   	push   %esi
+ 7e5:	53                   	push   %ebx
+ 7e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 7f2:	83 c6 01             	add    $0x1,%esi
+ 7f5:	84 db                	test   %bl,%bl
+ 7f7:	74 67                	je     860 <printf+0x80>
+ 7f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7fc:	31 d2                	xor    %edx,%edx
+ 7fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 801:	eb 34                	jmp    837 <printf+0x57>
+ 803:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 807:	90                   	nop
+ 808:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 80b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 810:	83 f8 25             	cmp    $0x25,%eax
+ 813:	74 18                	je     82d <printf+0x4d>
+  write(fd, &c, 1);
+ 815:	83 ec 04             	sub    $0x4,%esp
+ 818:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 81b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 81e:	6a 01                	push   $0x1
+ 820:	50                   	push   %eax
+ 821:	57                   	push   %edi
+ 822:	e8 dc fd ff ff       	call   603 <write>
+ 827:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 82a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 82d:	0f b6 1e             	movzbl (%esi),%ebx
+ 830:	83 c6 01             	add    $0x1,%esi
+ 833:	84 db                	test   %bl,%bl
+ 835:	74 29                	je     860 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 837:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 83a:	85 d2                	test   %edx,%edx
+ 83c:	74 ca                	je     808 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 83e:	83 fa 25             	cmp    $0x25,%edx
+ 841:	75 ea                	jne    82d <printf+0x4d>
+      if(c == 'd'){
+ 843:	83 f8 25             	cmp    $0x25,%eax
+ 846:	0f 84 24 01 00 00    	je     970 <printf+0x190>
+ 84c:	83 e8 63             	sub    $0x63,%eax
+ 84f:	83 f8 15             	cmp    $0x15,%eax
+ 852:	77 1c                	ja     870 <printf+0x90>
+ 854:	ff 24 85 9c 0f 00 00 	jmp    *0xf9c(,%eax,4)
+ 85b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 860:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 863:	5b                   	pop    %ebx
+ 864:	5e                   	pop    %esi
+ 865:	5f                   	pop    %edi
+ 866:	5d                   	pop    %ebp
+ 867:	c3                   	ret
+ 868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 876:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 87a:	6a 01                	push   $0x1
+ 87c:	52                   	push   %edx
+ 87d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 880:	57                   	push   %edi
+ 881:	e8 7d fd ff ff       	call   603 <write>
+ 886:	83 c4 0c             	add    $0xc,%esp
+ 889:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 88c:	6a 01                	push   $0x1
+ 88e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 891:	52                   	push   %edx
+ 892:	57                   	push   %edi
+ 893:	e8 6b fd ff ff       	call   603 <write>
+        putc(fd, c);
+ 898:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 89b:	31 d2                	xor    %edx,%edx
+ 89d:	eb 8e                	jmp    82d <printf+0x4d>
+ 89f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8a3:	83 ec 0c             	sub    $0xc,%esp
+ 8a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8ab:	8b 13                	mov    (%ebx),%edx
+ 8ad:	6a 00                	push   $0x0
+ 8af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8b4:	e8 87 fe ff ff       	call   740 <printint>
+        ap++;
+ 8b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8bf:	31 d2                	xor    %edx,%edx
+ 8c1:	e9 67 ff ff ff       	jmp    82d <printf+0x4d>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8d5:	83 c0 04             	add    $0x4,%eax
+ 8d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8db:	85 db                	test   %ebx,%ebx
+ 8dd:	0f 84 9d 00 00 00    	je     980 <printf+0x1a0>
+        while(*s != 0){
+ 8e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	0f 84 3d ff ff ff    	je     82d <printf+0x4d>
+ 8f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8f6:	89 de                	mov    %ebx,%esi
+ 8f8:	89 d3                	mov    %edx,%ebx
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 906:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 909:	6a 01                	push   $0x1
+ 90b:	53                   	push   %ebx
+ 90c:	57                   	push   %edi
+ 90d:	e8 f1 fc ff ff       	call   603 <write>
+        while(*s != 0){
+ 912:	0f b6 06             	movzbl (%esi),%eax
+ 915:	83 c4 10             	add    $0x10,%esp
+ 918:	84 c0                	test   %al,%al
+ 91a:	75 e4                	jne    900 <printf+0x120>
+      state = 0;
+ 91c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 91f:	31 d2                	xor    %edx,%edx
+ 921:	e9 07 ff ff ff       	jmp    82d <printf+0x4d>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 930:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 93b:	8b 13                	mov    (%ebx),%edx
+ 93d:	6a 01                	push   $0x1
+ 93f:	e9 6b ff ff ff       	jmp    8af <printf+0xcf>
+ 944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 948:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 94b:	83 ec 04             	sub    $0x4,%esp
+ 94e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 951:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 953:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 956:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 959:	6a 01                	push   $0x1
+ 95b:	52                   	push   %edx
+ 95c:	57                   	push   %edi
+ 95d:	e8 a1 fc ff ff       	call   603 <write>
+        ap++;
+ 962:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 965:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 968:	31 d2                	xor    %edx,%edx
+ 96a:	e9 be fe ff ff       	jmp    82d <printf+0x4d>
+ 96f:	90                   	nop
+  write(fd, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 976:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 979:	6a 01                	push   $0x1
+ 97b:	e9 11 ff ff ff       	jmp    891 <printf+0xb1>
+ 980:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 985:	bb 93 0f 00 00       	mov    $0xf93,%ebx
+ 98a:	e9 61 ff ff ff       	jmp    8f0 <printf+0x110>
+ 98f:	90                   	nop
+
+00000990 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 993:	a1 e4 13 00 00       	mov    0x13e4,%eax
+{
+ 998:	89 e5                	mov    %esp,%ebp
+ 99a:	56                   	push   %esi
+ 99b:	53                   	push   %ebx
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9a2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a4:	39 ca                	cmp    %ecx,%edx
+ 9a6:	73 30                	jae    9d8 <lfree+0x48>
+ 9a8:	39 c1                	cmp    %eax,%ecx
+ 9aa:	72 04                	jb     9b0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ac:	39 c2                	cmp    %eax,%edx
+ 9ae:	72 f0                	jb     9a0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9b0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 9b3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 9b6:	39 f0                	cmp    %esi,%eax
+ 9b8:	74 26                	je     9e0 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9ba:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9bc:	8b 42 04             	mov    0x4(%edx),%eax
+ 9bf:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9c2:	39 d9                	cmp    %ebx,%ecx
+ 9c4:	74 30                	je     9f6 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9c6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9c8:	5b                   	pop    %ebx
+  freep = p;
+ 9c9:	89 15 e4 13 00 00    	mov    %edx,0x13e4
+}
+ 9cf:	5e                   	pop    %esi
+ 9d0:	5d                   	pop    %ebp
+ 9d1:	c3                   	ret
+ 9d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9d8:	39 c1                	cmp    %eax,%ecx
+ 9da:	72 d0                	jb     9ac <lfree+0x1c>
+ 9dc:	eb c2                	jmp    9a0 <lfree+0x10>
+ 9de:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 9e0:	03 58 04             	add    0x4(%eax),%ebx
+ 9e3:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9e6:	8b 02                	mov    (%edx),%eax
+ 9e8:	8b 00                	mov    (%eax),%eax
+ 9ea:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 9ec:	8b 42 04             	mov    0x4(%edx),%eax
+ 9ef:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 9f2:	39 d9                	cmp    %ebx,%ecx
+ 9f4:	75 d0                	jne    9c6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 9f6:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 9f9:	89 15 e4 13 00 00    	mov    %edx,0x13e4
+    p->s.size += bp->s.size;
+ 9ff:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a02:	8b 09                	mov    (%ecx),%ecx
+ a04:	89 0a                	mov    %ecx,(%edx)
+}
+ a06:	5b                   	pop    %ebx
+ a07:	5e                   	pop    %esi
+ a08:	5d                   	pop    %ebp
+ a09:	c3                   	ret
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a10 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	89 c7                	mov    %eax,%edi
+ a16:	56                   	push   %esi
+ a17:	53                   	push   %ebx
+ a18:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ a1b:	a1 e4 13 00 00       	mov    0x13e4,%eax
+ a20:	85 c0                	test   %eax,%eax
+ a22:	0f 84 88 00 00 00    	je     ab0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a28:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a2a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ a2d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a32:	39 df                	cmp    %ebx,%edi
+ a34:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a37:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ a3e:	39 f9                	cmp    %edi,%ecx
+ a40:	72 0f                	jb     a51 <lalloc+0x41>
+ a42:	eb 4c                	jmp    a90 <lalloc+0x80>
+ a44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a48:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ a4a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ a4d:	39 f9                	cmp    %edi,%ecx
+ a4f:	73 3f                	jae    a90 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ a51:	89 d0                	mov    %edx,%eax
+ a53:	39 15 e4 13 00 00    	cmp    %edx,0x13e4
+ a59:	75 ed                	jne    a48 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ a5b:	83 ec 0c             	sub    $0xc,%esp
+ a5e:	56                   	push   %esi
+ a5f:	e8 07 fc ff ff       	call   66b <sbrk>
+  if(p == (char*)-1)
+ a64:	83 c4 10             	add    $0x10,%esp
+ a67:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a6a:	74 11                	je     a7d <lalloc+0x6d>
+  hp->s.size = nu;
+ a6c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ a6f:	e8 1c ff ff ff       	call   990 <lfree>
+  return freep;
+ a74:	a1 e4 13 00 00       	mov    0x13e4,%eax
+      if((p = morecore(nunits)) == 0)
+ a79:	85 c0                	test   %eax,%eax
+ a7b:	75 cb                	jne    a48 <lalloc+0x38>
+        return 0;
+  }
+}
+ a7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a80:	31 d2                	xor    %edx,%edx
+}
+ a82:	5b                   	pop    %ebx
+ a83:	89 d0                	mov    %edx,%eax
+ a85:	5e                   	pop    %esi
+ a86:	5f                   	pop    %edi
+ a87:	5d                   	pop    %ebp
+ a88:	c3                   	ret
+ a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ a90:	39 cf                	cmp    %ecx,%edi
+ a92:	74 4c                	je     ae0 <lalloc+0xd0>
+        p->s.size -= nunits;
+ a94:	29 f9                	sub    %edi,%ecx
+ a96:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ a99:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ a9c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ a9f:	a3 e4 13 00 00       	mov    %eax,0x13e4
+}
+ aa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aa7:	89 d0                	mov    %edx,%eax
+ aa9:	5b                   	pop    %ebx
+ aaa:	5e                   	pop    %esi
+ aab:	5f                   	pop    %edi
+ aac:	5d                   	pop    %ebp
+ aad:	c3                   	ret
+ aae:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ ab0:	ba e8 13 00 00       	mov    $0x13e8,%edx
+ ab5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ ab7:	c7 05 e4 13 00 00 e8 	movl   $0x13e8,0x13e4
+ abe:	13 00 00 
+ ac1:	c7 05 e8 13 00 00 e8 	movl   $0x13e8,0x13e8
+ ac8:	13 00 00 
+ acb:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ acd:	c7 05 ec 13 00 00 00 	movl   $0x0,0x13ec
+ ad4:	00 00 00 
+ ad7:	e9 51 ff ff ff       	jmp    a2d <lalloc+0x1d>
+ adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ ae0:	8b 0a                	mov    (%edx),%ecx
+ ae2:	89 08                	mov    %ecx,(%eax)
+ ae4:	eb b9                	jmp    a9f <lalloc+0x8f>
+ ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000af0 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ af9:	85 f6                	test   %esi,%esi
+ afb:	74 42                	je     b3f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ afd:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ b00:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ b03:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ b09:	77 3d                	ja     b48 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ b0b:	31 c9                	xor    %ecx,%ecx
+ b0d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ b12:	83 fa 02             	cmp    $0x2,%edx
+ b15:	74 17                	je     b2e <free+0x3e>
+ b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1e:	66 90                	xchg   %ax,%ax
+ b20:	83 c1 01             	add    $0x1,%ecx
+ b23:	89 d8                	mov    %ebx,%eax
+ b25:	d3 e0                	shl    %cl,%eax
+ b27:	83 c0 01             	add    $0x1,%eax
+ b2a:	39 c2                	cmp    %eax,%edx
+ b2c:	75 f2                	jne    b20 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ b2e:	8b 04 8d c0 13 00 00 	mov    0x13c0(,%ecx,4),%eax
+  classes[c] = bp;
+ b35:	89 3c 8d c0 13 00 00 	mov    %edi,0x13c0(,%ecx,4)
+  bp->s.ptr = classes[c];
+ b3c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ b3f:	5b                   	pop    %ebx
+ b40:	5e                   	pop    %esi
+ b41:	5f                   	pop    %edi
+ b42:	5d                   	pop    %ebp
+ b43:	c3                   	ret
+ b44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b48:	5b                   	pop    %ebx
+    lfree(bp);
+ b49:	89 f8                	mov    %edi,%eax
+}
+ b4b:	5e                   	pop    %esi
+ b4c:	5f                   	pop    %edi
+ b4d:	5d                   	pop    %ebp
+    lfree(bp);
+ b4e:	e9 3d fe ff ff       	jmp    990 <lfree>
+ b53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b60 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	57                   	push   %edi
+ b64:	56                   	push   %esi
+ b65:	53                   	push   %ebx
+ b66:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b69:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6c:	83 c0 07             	add    $0x7,%eax
+ b6f:	c1 e8 03             	shr    $0x3,%eax
+ b72:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ b75:	3d 01 01 00 00       	cmp    $0x101,%eax
+ b7a:	77 44                	ja     bc0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ b7c:	31 c9                	xor    %ecx,%ecx
+ b7e:	ba 01 00 00 00       	mov    $0x1,%edx
+ b83:	bb 02 00 00 00       	mov    $0x2,%ebx
+ b88:	83 f8 02             	cmp    $0x2,%eax
+ b8b:	76 11                	jbe    b9e <malloc+0x3e>
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+ b90:	83 c1 01             	add    $0x1,%ecx
+ b93:	89 d3                	mov    %edx,%ebx
+ b95:	d3 e3                	shl    %cl,%ebx
+ b97:	83 c3 01             	add    $0x1,%ebx
+ b9a:	39 c3                	cmp    %eax,%ebx
+ b9c:	72 f2                	jb     b90 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ b9e:	8b 04 8d c0 13 00 00 	mov    0x13c0(,%ecx,4),%eax
+ ba5:	85 c0                	test   %eax,%eax
+ ba7:	74 2f                	je     bd8 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ ba9:	8b 10                	mov    (%eax),%edx
+ bab:	89 14 8d c0 13 00 00 	mov    %edx,0x13c0(,%ecx,4)
+  return (void*)(p + 1);
+ bb2:	83 c0 08             	add    $0x8,%eax
+}
+ bb5:	83 c4 1c             	add    $0x1c,%esp
+ bb8:	5b                   	pop    %ebx
+ bb9:	5e                   	pop    %esi
+ bba:	5f                   	pop    %edi
+ bbb:	5d                   	pop    %ebp
+ bbc:	c3                   	ret
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ bc0:	e8 4b fe ff ff       	call   a10 <lalloc>
+ bc5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ bc7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ bca:	85 d2                	test   %edx,%edx
+ bcc:	75 e7                	jne    bb5 <malloc+0x55>
+      return 0;
+ bce:	31 c0                	xor    %eax,%eax
+ bd0:	eb e3                	jmp    bb5 <malloc+0x55>
+ bd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ bd8:	31 d2                	xor    %edx,%edx
+ bda:	b8 00 02 00 00       	mov    $0x200,%eax
+ bdf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ be2:	f7 f3                	div    %ebx
+  if(n < 4)
+ be4:	ba 04 00 00 00       	mov    $0x4,%edx
+ be9:	89 d6                	mov    %edx,%esi
+ beb:	39 d0                	cmp    %edx,%eax
+ bed:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ bf0:	0f af f3             	imul   %ebx,%esi
+ bf3:	89 f0                	mov    %esi,%eax
+ bf5:	e8 16 fe ff ff       	call   a10 <lalloc>
+ bfa:	85 c0                	test   %eax,%eax
+ bfc:	74 d0                	je     bce <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ bfe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c01:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ c04:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c0b:	8b 14 8d c0 13 00 00 	mov    0x13c0(,%ecx,4),%edx
+ c12:	39 f8                	cmp    %edi,%eax
+ c14:	73 22                	jae    c38 <malloc+0xd8>
+ c16:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ c19:	eb 09                	jmp    c24 <malloc+0xc4>
+ c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+ c20:	89 c2                	mov    %eax,%edx
+ c22:	89 c8                	mov    %ecx,%eax
+ c24:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ c27:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ c2a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ c2c:	39 f9                	cmp    %edi,%ecx
+ c2e:	72 f0                	jb     c20 <malloc+0xc0>
+ c30:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c33:	e9 73 ff ff ff       	jmp    bab <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ c38:	89 d0                	mov    %edx,%eax
+ c3a:	8b 12                	mov    (%edx),%edx
+ c3c:	e9 6a ff ff ff       	jmp    bab <malloc+0x4b>
+ c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4f:	90                   	nop
+
+00000c50 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	56                   	push   %esi
+ c54:	53                   	push   %ebx
+ c55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ c58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ c5b:	85 c9                	test   %ecx,%ecx
+ c5d:	74 06                	je     c65 <calloc+0x15>
+ c5f:	89 c8                	mov    %ecx,%eax
+ c61:	f7 e3                	mul    %ebx
+ c63:	70 33                	jo     c98 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ c65:	0f af d9             	imul   %ecx,%ebx
+ c68:	83 ec 0c             	sub    $0xc,%esp
+ c6b:	53                   	push   %ebx
+ c6c:	e8 ef fe ff ff       	call   b60 <malloc>
+ c71:	83 c4 10             	add    $0x10,%esp
+ c74:	89 c6                	mov    %eax,%esi
+ c76:	85 c0                	test   %eax,%eax
+ c78:	74 1e                	je     c98 <calloc+0x48>
+    memset(p, 0, n * size);
+ c7a:	83 ec 04             	sub    $0x4,%esp
+ c7d:	53                   	push   %ebx
+ c7e:	6a 00                	push   $0x0
+ c80:	50                   	push   %eax
+ c81:	e8 3a f7 ff ff       	call   3c0 <memset>
+ c86:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ c89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c8c:	89 f0                	mov    %esi,%eax
+ c8e:	5b                   	pop    %ebx
+ c8f:	5e                   	pop    %esi
+ c90:	5d                   	pop    %ebp
+ c91:	c3                   	ret
+ c92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ c98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ c9b:	31 f6                	xor    %esi,%esi
+}
+ c9d:	89 f0                	mov    %esi,%eax
+ c9f:	5b                   	pop    %ebx
+ ca0:	5e                   	pop    %esi
+ ca1:	5d                   	pop    %ebp
+ ca2:	c3                   	ret
+ ca3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cb0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	57                   	push   %edi
+ cb4:	56                   	push   %esi
+ cb5:	53                   	push   %ebx
+ cb6:	83 ec 0c             	sub    $0xc,%esp
+ cb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ cbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ cbf:	85 db                	test   %ebx,%ebx
+ cc1:	74 55                	je     d18 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ cc3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ cc6:	89 de                	mov    %ebx,%esi
+ cc8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ ccf:	39 c7                	cmp    %eax,%edi
+ cd1:	72 0d                	jb     ce0 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ cd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cd6:	89 f0                	mov    %esi,%eax
+ cd8:	5b                   	pop    %ebx
+ cd9:	5e                   	pop    %esi
+ cda:	5f                   	pop    %edi
+ cdb:	5d                   	pop    %ebp
+ cdc:	c3                   	ret
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ ce0:	83 ec 0c             	sub    $0xc,%esp
+ ce3:	50                   	push   %eax
+ ce4:	e8 77 fe ff ff       	call   b60 <malloc>
+ ce9:	83 c4 10             	add    $0x10,%esp
+ cec:	89 c6                	mov    %eax,%esi
+ cee:	85 c0                	test   %eax,%eax
+ cf0:	74 e1                	je     cd3 <realloc+0x23>
+  memmove(p, ap, have);
+ cf2:	83 ec 04             	sub    $0x4,%esp
+ cf5:	57                   	push   %edi
+ cf6:	53                   	push   %ebx
+ cf7:	50                   	push   %eax
+ cf8:	e8 b3 f8 ff ff       	call   5b0 <memmove>
+  free(ap);
+ cfd:	89 1c 24             	mov    %ebx,(%esp)
+ d00:	e8 eb fd ff ff       	call   af0 <free>
+  return p;
+ d05:	83 c4 10             	add    $0x10,%esp
+}
+ d08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d0b:	89 f0                	mov    %esi,%eax
+ d0d:	5b                   	pop    %ebx
+ d0e:	5e                   	pop    %esi
+ d0f:	5f                   	pop    %edi
+ d10:	5d                   	pop    %ebp
+ d11:	c3                   	ret
+ d12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ d18:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d1e:	5b                   	pop    %ebx
+ d1f:	5e                   	pop    %esi
+ d20:	5f                   	pop    %edi
+ d21:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ d22:	e9 39 fe ff ff       	jmp    b60 <malloc>
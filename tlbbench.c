@@ -0,0 +1,59 @@
+// Measure the cost of TLB misses: sweep a 16 MB heap one word
+// per page, so every access touches a different page.  With 4 KB
+// pages the sweep needs 4096 TLB entries; with superpages it
+// needs four.  Each mode runs in a fresh child.
+
+#include "types.h"
+#include "user.h"
+
+#define SIZE   (16*1024*1024)
+#define SPG    (4*1024*1024)
+#define PASSES 200
+
+static void
+run(int on)
+{
+  char *p;
+  uint cur, sum;
+  int i, pass, t0, t1, t2;
+
+  superpages(on);
+  cur = (uint)sbrk(0);
+  if(cur % SPG && sbrk(SPG - cur % SPG) == (char*)-1)
+    goto nomem;
+  if((p = sbrk(SIZE)) == (char*)-1)
+    goto nomem;
+
+  t0 = uptime();
+  for(i = 0; i < SIZE; i += 4096)
+    p[i] = 1;
+  t1 = uptime();
+  sum = 0;
+  for(pass = 0; pass < PASSES; pass++)
+    for(i = pass*64 % 4096; i < SIZE; i += 4096)
+      sum += p[i];
+  t2 = uptime();
+  if(sum == 0xFFFFFFFF)
+    printf(1, "unreachable\n");
+  printf(1, "%s: first touch %d ms, %d sweeps in %d ms\n",
+         on ? "superpages" : "4 KB pages", t1 - t0, PASSES, t2 - t1);
+  return;
+
+nomem:
+  printf(2, "tlbbench: sbrk failed\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int on;
+
+  for(on = 0; on <= 1; on++){
+    if(fork() == 0){
+      run(on);
+      exit();
+    }
+    wait();
+  }
+  exit();
+}
@@ -90,9 +90,18 @@ trap(struct trapframe *tf)
             cpuid(), tf->cs, tf->eip);
     lapiceoi();
     break;
+  case T_PGFLT:
+    // Demand-zero heap pages; see pgfault() in vm.c.
+    if(myproc() && pgfault(myproc(), rcr2(), tf->err & FEC_WR) == 0)
+      break;
+    // fall through
 
   //PAGEBREAK: 13
   default:
+    if(pcitrap(tf->trapno)){
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -3,8 +3,22 @@
 #include "user.h"
 #include "param.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator.
+//
+// Small requests (up to 2048 bytes) are rounded up to one of
+// NCLASS power-of-two size classes, each with its own free list,
+// so malloc and free of a small block are O(1).  A class with an
+// empty list is refilled by carving a chunk from the large
+// allocator into blocks of that class; small blocks are never
+// returned to the large allocator.
+//
+// Larger requests use the allocator by Kernighan and Ritchie,
+// The C programming Language, 2nd ed.  Section 8.7: a circular
+// free list in address order, first fit, with neighbouring free
+// blocks coalesced.
+//
+// Every block starts with a Header holding its size in Header
+// units, which tells free() which allocator it came from.
 
 typedef long Align;
 
@@ -18,15 +32,20 @@ union header {
 
 typedef union header Header;
 
+#define NCLASS   9                        // 8, 16, ..., 2048 bytes
+#define CLASSU(c) ((1 << (c)) + 1)        // units in a class-c block
+#define SMALLU   CLASSU(NCLASS-1)
+#define CHUNK    4096                     // bytes per refill
+
 static Header base;
 static Header *freep;
+static Header *classes[NCLASS];
 
-void
-free(void *ap)
+static void
+lfree(Header *bp)
 {
-  Header *bp, *p;
+  Header *p;
 
-  bp = (Header*)ap - 1;
   for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
     if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
       break;
@@ -56,17 +75,16 @@ morecore(uint nu)
     return 0;
   hp = (Header*)p;
   hp->s.size = nu;
-  free((void*)(hp + 1));
+  lfree(hp);
   return freep;
 }
 
-void*
-malloc(uint nbytes)
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
 {
   Header *p, *prevp;
-  uint nunits;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
   if((prevp = freep) == 0){
     base.s.ptr = freep = prevp = &base;
     base.s.size = 0;
@@ -81,10 +99,104 @@ malloc(uint nbytes)
         p->s.size = nunits;
       }
       freep = prevp;
-      return (void*)(p + 1);
+      return p;
     }
     if(p == freep)
       if((p = morecore(nunits)) == 0)
         return 0;
   }
 }
+
+// Fill the free list of class c from one large block.
+static int
+refill(int c)
+{
+  Header *p, *q;
+  uint n, u;
+
+  u = CLASSU(c);
+  n = CHUNK / sizeof(Header) / u;
+  if(n < 4)
+    n = 4;
+  if((p = lalloc(n * u)) == 0)
+    return -1;
+  for(q = p; q < p + n*u; q += u){
+    q->s.size = u;
+    q->s.ptr = classes[c];
+    classes[c] = q;
+  }
+  return 0;
+}
+
+void
+free(void *ap)
+{
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+    ;
+  bp->s.ptr = classes[c];
+  classes[c] = bp;
+}
+
+void*
+malloc(uint nbytes)
+{
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+  if(nunits > SMALLU){
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+  return (void*)(p + 1);
+}
+
+void*
+calloc(uint n, uint size)
+{
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+    return 0;
+  if((p = malloc(n * size)) != 0)
+    memset(p, 0, n * size);
+  return p;
+}
+
+void*
+realloc(void *ap, uint nbytes)
+{
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+  if(nbytes <= have)
+    return ap;
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
@@ -10,6 +10,8 @@ struct uproc {
   uint CPU_total_ticks;
   char state[STRMAX];
   uint size;
+  uint rss;
+  uint ptpages;
   char name[STRMAX];
 };
 
@@ -1,5 +1,8 @@
 struct stat;
 struct rtcdate;
+struct swapstat;
+struct meminfo;
+struct iostat;
 #ifdef CS333_P2
 struct uproc;
 #endif
@@ -26,6 +29,15 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int superpages(int);
+void* mmap(void*, uint, int, int, int, int);
+int munmap(void*, uint);
+int spawn(char*, char**, int*, int);
+int swapstat(struct swapstat*);
+int getmeminfo(struct meminfo*);
+int iostat(struct iostat*);
+int dropcache(void);
+int iosched(int);
 int halt(void);
 
 #ifdef CS333_P1
@@ -65,5 +77,7 @@ uint strlen(char*);
 void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
+void* calloc(uint, uint);
+void* realloc(void*, uint);
 int atoi(const char*);
 int atoo(const char*);
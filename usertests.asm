@@ -0,0 +1,7192 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 e3 51 00 00       	push   $0x51e3
+      16:	6a 01                	push   $0x1
+      18:	e8 23 3c 00 00       	call   3c40 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 f7 51 00 00       	push   $0x51f7
+      26:	e8 58 3a 00 00       	call   3a83 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 60 59 00 00       	push   $0x5960
+      39:	6a 01                	push   $0x1
+      3b:	e8 00 3c 00 00       	call   3c40 <printf>
+    exit();
+      40:	e8 fe 39 00 00       	call   3a43 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 f7 51 00 00       	push   $0x51f7
+      51:	e8 2d 3a 00 00       	call   3a83 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 0d 3a 00 00       	call   3a6b <close>
+
+  argptest();
+      5e:	e8 6d 36 00 00       	call   36d0 <argptest>
+  createdelete();
+      63:	e8 b8 12 00 00       	call   1320 <createdelete>
+  linkunlink();
+      68:	e8 53 1b 00 00       	call   1bc0 <linkunlink>
+  concreate();
+      6d:	e8 4e 18 00 00       	call   18c0 <concreate>
+  fourfiles();
+      72:	e8 a9 10 00 00       	call   1120 <fourfiles>
+  sharedfd();
+      77:	e8 e4 0e 00 00       	call   f60 <sharedfd>
+
+  bigargtest();
+      7c:	e8 0f 33 00 00       	call   3390 <bigargtest>
+  bigwrite();
+      81:	e8 5a 24 00 00       	call   24e0 <bigwrite>
+  bigargtest();
+      86:	e8 05 33 00 00       	call   3390 <bigargtest>
+  bsstest();
+      8b:	e8 90 32 00 00       	call   3320 <bsstest>
+  sbrktest();
+      90:	e8 8b 2d 00 00       	call   2e20 <sbrktest>
+  validatetest();
+      95:	e8 d6 31 00 00       	call   3270 <validatetest>
+
+  opentest();
+      9a:	e8 61 03 00 00       	call   400 <opentest>
+  writetest();
+      9f:	e8 ec 03 00 00       	call   490 <writetest>
+  writetest1();
+      a4:	e8 c7 05 00 00       	call   670 <writetest1>
+  createtest();
+      a9:	e8 92 07 00 00       	call   840 <createtest>
+
+  openiputtest();
+      ae:	e8 4d 02 00 00       	call   300 <openiputtest>
+  exitiputtest();
+      b3:	e8 48 01 00 00       	call   200 <exitiputtest>
+  iputtest();
+      b8:	e8 63 00 00 00       	call   120 <iputtest>
+
+  mem();
+      bd:	e8 ce 0d 00 00       	call   e90 <mem>
+  pipe1();
+      c2:	e8 49 0a 00 00       	call   b10 <pipe1>
+  preempt();
+      c7:	e8 e4 0b 00 00       	call   cb0 <preempt>
+  exitwait();
+      cc:	e8 3f 0d 00 00       	call   e10 <exitwait>
+
+  rmdot();
+      d1:	e8 fa 27 00 00       	call   28d0 <rmdot>
+  fourteen();
+      d6:	e8 b5 26 00 00       	call   2790 <fourteen>
+  bigfile();
+      db:	e8 e0 24 00 00       	call   25c0 <bigfile>
+  subdir();
+      e0:	e8 1b 1d 00 00       	call   1e00 <subdir>
+  linktest();
+      e5:	e8 c6 15 00 00       	call   16b0 <linktest>
+  unlinkread();
+      ea:	e8 31 14 00 00       	call   1520 <unlinkread>
+  dirfile();
+      ef:	e8 5c 29 00 00       	call   2a50 <dirfile>
+  iref();
+      f4:	e8 57 2b 00 00       	call   2c50 <iref>
+  forktest();
+      f9:	e8 72 2c 00 00       	call   2d70 <forktest>
+  bigdir(); // slow
+      fe:	e8 cd 1b 00 00       	call   1cd0 <bigdir>
+
+  uio();
+     103:	e8 58 35 00 00       	call   3660 <uio>
+
+  textbusy();
+     108:	e8 13 09 00 00       	call   a20 <textbusy>
+  exectest();
+     10d:	e8 be 08 00 00       	call   9d0 <exectest>
+
+  exit();
+     112:	e8 2c 39 00 00       	call   3a43 <exit>
+     117:	66 90                	xchg   %ax,%ax
+     119:	66 90                	xchg   %ax,%ax
+     11b:	66 90                	xchg   %ax,%ax
+     11d:	66 90                	xchg   %ax,%ax
+     11f:	90                   	nop
+
+00000120 <iputtest>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     126:	68 1c 42 00 00       	push   $0x421c
+     12b:	ff 35 14 64 00 00    	push   0x6414
+     131:	e8 0a 3b 00 00       	call   3c40 <printf>
+  if(mkdir("iputdir") < 0){
+     136:	c7 04 24 af 41 00 00 	movl   $0x41af,(%esp)
+     13d:	e8 69 39 00 00       	call   3aab <mkdir>
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	85 c0                	test   %eax,%eax
+     147:	78 58                	js     1a1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     149:	83 ec 0c             	sub    $0xc,%esp
+     14c:	68 af 41 00 00       	push   $0x41af
+     151:	e8 5d 39 00 00       	call   3ab3 <chdir>
+     156:	83 c4 10             	add    $0x10,%esp
+     159:	85 c0                	test   %eax,%eax
+     15b:	0f 88 85 00 00 00    	js     1e6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     161:	83 ec 0c             	sub    $0xc,%esp
+     164:	68 ac 41 00 00       	push   $0x41ac
+     169:	e8 25 39 00 00       	call   3a93 <unlink>
+     16e:	83 c4 10             	add    $0x10,%esp
+     171:	85 c0                	test   %eax,%eax
+     173:	78 5a                	js     1cf <iputtest+0xaf>
+  if(chdir("/") < 0){
+     175:	83 ec 0c             	sub    $0xc,%esp
+     178:	68 d1 41 00 00       	push   $0x41d1
+     17d:	e8 31 39 00 00       	call   3ab3 <chdir>
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	85 c0                	test   %eax,%eax
+     187:	78 2f                	js     1b8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     189:	83 ec 08             	sub    $0x8,%esp
+     18c:	68 54 42 00 00       	push   $0x4254
+     191:	ff 35 14 64 00 00    	push   0x6414
+     197:	e8 a4 3a 00 00       	call   3c40 <printf>
+}
+     19c:	83 c4 10             	add    $0x10,%esp
+     19f:	c9                   	leave
+     1a0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1a1:	50                   	push   %eax
+     1a2:	50                   	push   %eax
+     1a3:	68 88 41 00 00       	push   $0x4188
+     1a8:	ff 35 14 64 00 00    	push   0x6414
+     1ae:	e8 8d 3a 00 00       	call   3c40 <printf>
+    exit();
+     1b3:	e8 8b 38 00 00       	call   3a43 <exit>
+    printf(stdout, "chdir / failed\n");
+     1b8:	50                   	push   %eax
+     1b9:	50                   	push   %eax
+     1ba:	68 d3 41 00 00       	push   $0x41d3
+     1bf:	ff 35 14 64 00 00    	push   0x6414
+     1c5:	e8 76 3a 00 00       	call   3c40 <printf>
+    exit();
+     1ca:	e8 74 38 00 00       	call   3a43 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1cf:	52                   	push   %edx
+     1d0:	52                   	push   %edx
+     1d1:	68 b7 41 00 00       	push   $0x41b7
+     1d6:	ff 35 14 64 00 00    	push   0x6414
+     1dc:	e8 5f 3a 00 00       	call   3c40 <printf>
+    exit();
+     1e1:	e8 5d 38 00 00       	call   3a43 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1e6:	51                   	push   %ecx
+     1e7:	51                   	push   %ecx
+     1e8:	68 96 41 00 00       	push   $0x4196
+     1ed:	ff 35 14 64 00 00    	push   0x6414
+     1f3:	e8 48 3a 00 00       	call   3c40 <printf>
+    exit();
+     1f8:	e8 46 38 00 00       	call   3a43 <exit>
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <exitiputtest>:
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     206:	68 e3 41 00 00       	push   $0x41e3
+     20b:	ff 35 14 64 00 00    	push   0x6414
+     211:	e8 2a 3a 00 00       	call   3c40 <printf>
+  pid = fork();
+     216:	e8 20 38 00 00       	call   3a3b <fork>
+  if(pid < 0){
+     21b:	83 c4 10             	add    $0x10,%esp
+     21e:	85 c0                	test   %eax,%eax
+     220:	0f 88 8a 00 00 00    	js     2b0 <exitiputtest+0xb0>
+  if(pid == 0){
+     226:	75 50                	jne    278 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     228:	83 ec 0c             	sub    $0xc,%esp
+     22b:	68 af 41 00 00       	push   $0x41af
+     230:	e8 76 38 00 00       	call   3aab <mkdir>
+     235:	83 c4 10             	add    $0x10,%esp
+     238:	85 c0                	test   %eax,%eax
+     23a:	0f 88 87 00 00 00    	js     2c7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     240:	83 ec 0c             	sub    $0xc,%esp
+     243:	68 af 41 00 00       	push   $0x41af
+     248:	e8 66 38 00 00       	call   3ab3 <chdir>
+     24d:	83 c4 10             	add    $0x10,%esp
+     250:	85 c0                	test   %eax,%eax
+     252:	0f 88 86 00 00 00    	js     2de <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     258:	83 ec 0c             	sub    $0xc,%esp
+     25b:	68 ac 41 00 00       	push   $0x41ac
+     260:	e8 2e 38 00 00       	call   3a93 <unlink>
+     265:	83 c4 10             	add    $0x10,%esp
+     268:	85 c0                	test   %eax,%eax
+     26a:	78 2c                	js     298 <exitiputtest+0x98>
+    exit();
+     26c:	e8 d2 37 00 00       	call   3a43 <exit>
+     271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     278:	e8 ce 37 00 00       	call   3a4b <wait>
+  printf(stdout, "exitiput test ok\n");
+     27d:	83 ec 08             	sub    $0x8,%esp
+     280:	68 06 42 00 00       	push   $0x4206
+     285:	ff 35 14 64 00 00    	push   0x6414
+     28b:	e8 b0 39 00 00       	call   3c40 <printf>
+}
+     290:	83 c4 10             	add    $0x10,%esp
+     293:	c9                   	leave
+     294:	c3                   	ret
+     295:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     298:	83 ec 08             	sub    $0x8,%esp
+     29b:	68 b7 41 00 00       	push   $0x41b7
+     2a0:	ff 35 14 64 00 00    	push   0x6414
+     2a6:	e8 95 39 00 00       	call   3c40 <printf>
+      exit();
+     2ab:	e8 93 37 00 00       	call   3a43 <exit>
+    printf(stdout, "fork failed\n");
+     2b0:	51                   	push   %ecx
+     2b1:	51                   	push   %ecx
+     2b2:	68 36 51 00 00       	push   $0x5136
+     2b7:	ff 35 14 64 00 00    	push   0x6414
+     2bd:	e8 7e 39 00 00       	call   3c40 <printf>
+    exit();
+     2c2:	e8 7c 37 00 00       	call   3a43 <exit>
+      printf(stdout, "mkdir failed\n");
+     2c7:	52                   	push   %edx
+     2c8:	52                   	push   %edx
+     2c9:	68 88 41 00 00       	push   $0x4188
+     2ce:	ff 35 14 64 00 00    	push   0x6414
+     2d4:	e8 67 39 00 00       	call   3c40 <printf>
+      exit();
+     2d9:	e8 65 37 00 00       	call   3a43 <exit>
+      printf(stdout, "child chdir failed\n");
+     2de:	50                   	push   %eax
+     2df:	50                   	push   %eax
+     2e0:	68 f2 41 00 00       	push   $0x41f2
+     2e5:	ff 35 14 64 00 00    	push   0x6414
+     2eb:	e8 50 39 00 00       	call   3c40 <printf>
+      exit();
+     2f0:	e8 4e 37 00 00       	call   3a43 <exit>
+     2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <openiputtest>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     306:	68 18 42 00 00       	push   $0x4218
+     30b:	ff 35 14 64 00 00    	push   0x6414
+     311:	e8 2a 39 00 00       	call   3c40 <printf>
+  if(mkdir("oidir") < 0){
+     316:	c7 04 24 27 42 00 00 	movl   $0x4227,(%esp)
+     31d:	e8 89 37 00 00       	call   3aab <mkdir>
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	85 c0                	test   %eax,%eax
+     327:	0f 88 9f 00 00 00    	js     3cc <openiputtest+0xcc>
+  pid = fork();
+     32d:	e8 09 37 00 00       	call   3a3b <fork>
+  if(pid < 0){
+     332:	85 c0                	test   %eax,%eax
+     334:	78 7f                	js     3b5 <openiputtest+0xb5>
+  if(pid == 0){
+     336:	75 38                	jne    370 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     338:	83 ec 08             	sub    $0x8,%esp
+     33b:	6a 02                	push   $0x2
+     33d:	68 27 42 00 00       	push   $0x4227
+     342:	e8 3c 37 00 00       	call   3a83 <open>
+    if(fd >= 0){
+     347:	83 c4 10             	add    $0x10,%esp
+     34a:	85 c0                	test   %eax,%eax
+     34c:	78 62                	js     3b0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     34e:	83 ec 08             	sub    $0x8,%esp
+     351:	68 18 52 00 00       	push   $0x5218
+     356:	ff 35 14 64 00 00    	push   0x6414
+     35c:	e8 df 38 00 00       	call   3c40 <printf>
+      exit();
+     361:	e8 dd 36 00 00       	call   3a43 <exit>
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     370:	83 ec 0c             	sub    $0xc,%esp
+     373:	6a 01                	push   $0x1
+     375:	e8 59 37 00 00       	call   3ad3 <sleep>
+  if(unlink("oidir") != 0){
+     37a:	c7 04 24 27 42 00 00 	movl   $0x4227,(%esp)
+     381:	e8 0d 37 00 00       	call   3a93 <unlink>
+     386:	83 c4 10             	add    $0x10,%esp
+     389:	85 c0                	test   %eax,%eax
+     38b:	75 56                	jne    3e3 <openiputtest+0xe3>
+  wait();
+     38d:	e8 b9 36 00 00       	call   3a4b <wait>
+  printf(stdout, "openiput test ok\n");
+     392:	83 ec 08             	sub    $0x8,%esp
+     395:	68 50 42 00 00       	push   $0x4250
+     39a:	ff 35 14 64 00 00    	push   0x6414
+     3a0:	e8 9b 38 00 00       	call   3c40 <printf>
+}
+     3a5:	83 c4 10             	add    $0x10,%esp
+     3a8:	c9                   	leave
+     3a9:	c3                   	ret
+     3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3b0:	e8 8e 36 00 00       	call   3a43 <exit>
+    printf(stdout, "fork failed\n");
+     3b5:	52                   	push   %edx
+     3b6:	52                   	push   %edx
+     3b7:	68 36 51 00 00       	push   $0x5136
+     3bc:	ff 35 14 64 00 00    	push   0x6414
+     3c2:	e8 79 38 00 00       	call   3c40 <printf>
+    exit();
+     3c7:	e8 77 36 00 00       	call   3a43 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3cc:	51                   	push   %ecx
+     3cd:	51                   	push   %ecx
+     3ce:	68 2d 42 00 00       	push   $0x422d
+     3d3:	ff 35 14 64 00 00    	push   0x6414
+     3d9:	e8 62 38 00 00       	call   3c40 <printf>
+    exit();
+     3de:	e8 60 36 00 00       	call   3a43 <exit>
+    printf(stdout, "unlink failed\n");
+     3e3:	50                   	push   %eax
+     3e4:	50                   	push   %eax
+     3e5:	68 41 42 00 00       	push   $0x4241
+     3ea:	ff 35 14 64 00 00    	push   0x6414
+     3f0:	e8 4b 38 00 00       	call   3c40 <printf>
+    exit();
+     3f5:	e8 49 36 00 00       	call   3a43 <exit>
+     3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <opentest>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     406:	68 62 42 00 00       	push   $0x4262
+     40b:	ff 35 14 64 00 00    	push   0x6414
+     411:	e8 2a 38 00 00       	call   3c40 <printf>
+  fd = open("echo", 0);
+     416:	58                   	pop    %eax
+     417:	5a                   	pop    %edx
+     418:	6a 00                	push   $0x0
+     41a:	68 6d 42 00 00       	push   $0x426d
+     41f:	e8 5f 36 00 00       	call   3a83 <open>
+  if(fd < 0){
+     424:	83 c4 10             	add    $0x10,%esp
+     427:	85 c0                	test   %eax,%eax
+     429:	78 36                	js     461 <opentest+0x61>
+  close(fd);
+     42b:	83 ec 0c             	sub    $0xc,%esp
+     42e:	50                   	push   %eax
+     42f:	e8 37 36 00 00       	call   3a6b <close>
+  fd = open("doesnotexist", 0);
+     434:	5a                   	pop    %edx
+     435:	59                   	pop    %ecx
+     436:	6a 00                	push   $0x0
+     438:	68 85 42 00 00       	push   $0x4285
+     43d:	e8 41 36 00 00       	call   3a83 <open>
+  if(fd >= 0){
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	85 c0                	test   %eax,%eax
+     447:	79 2f                	jns    478 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     449:	83 ec 08             	sub    $0x8,%esp
+     44c:	68 b0 42 00 00       	push   $0x42b0
+     451:	ff 35 14 64 00 00    	push   0x6414
+     457:	e8 e4 37 00 00       	call   3c40 <printf>
+}
+     45c:	83 c4 10             	add    $0x10,%esp
+     45f:	c9                   	leave
+     460:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     461:	50                   	push   %eax
+     462:	50                   	push   %eax
+     463:	68 72 42 00 00       	push   $0x4272
+     468:	ff 35 14 64 00 00    	push   0x6414
+     46e:	e8 cd 37 00 00       	call   3c40 <printf>
+    exit();
+     473:	e8 cb 35 00 00       	call   3a43 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     478:	50                   	push   %eax
+     479:	50                   	push   %eax
+     47a:	68 92 42 00 00       	push   $0x4292
+     47f:	ff 35 14 64 00 00    	push   0x6414
+     485:	e8 b6 37 00 00       	call   3c40 <printf>
+    exit();
+     48a:	e8 b4 35 00 00       	call   3a43 <exit>
+     48f:	90                   	nop
+
+00000490 <writetest>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	56                   	push   %esi
+     494:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     495:	83 ec 08             	sub    $0x8,%esp
+     498:	68 be 42 00 00       	push   $0x42be
+     49d:	ff 35 14 64 00 00    	push   0x6414
+     4a3:	e8 98 37 00 00       	call   3c40 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4a8:	58                   	pop    %eax
+     4a9:	5a                   	pop    %edx
+     4aa:	68 02 02 00 00       	push   $0x202
+     4af:	68 cf 42 00 00       	push   $0x42cf
+     4b4:	e8 ca 35 00 00       	call   3a83 <open>
+  if(fd >= 0){
+     4b9:	83 c4 10             	add    $0x10,%esp
+     4bc:	85 c0                	test   %eax,%eax
+     4be:	0f 88 88 01 00 00    	js     64c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4c4:	83 ec 08             	sub    $0x8,%esp
+     4c7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4c9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4cb:	68 d5 42 00 00       	push   $0x42d5
+     4d0:	ff 35 14 64 00 00    	push   0x6414
+     4d6:	e8 65 37 00 00       	call   3c40 <printf>
+     4db:	83 c4 10             	add    $0x10,%esp
+     4de:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4e0:	83 ec 04             	sub    $0x4,%esp
+     4e3:	6a 0a                	push   $0xa
+     4e5:	68 0c 43 00 00       	push   $0x430c
+     4ea:	56                   	push   %esi
+     4eb:	e8 73 35 00 00       	call   3a63 <write>
+     4f0:	83 c4 10             	add    $0x10,%esp
+     4f3:	83 f8 0a             	cmp    $0xa,%eax
+     4f6:	0f 85 d9 00 00 00    	jne    5d5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     4fc:	83 ec 04             	sub    $0x4,%esp
+     4ff:	6a 0a                	push   $0xa
+     501:	68 17 43 00 00       	push   $0x4317
+     506:	56                   	push   %esi
+     507:	e8 57 35 00 00       	call   3a63 <write>
+     50c:	83 c4 10             	add    $0x10,%esp
+     50f:	83 f8 0a             	cmp    $0xa,%eax
+     512:	0f 85 d6 00 00 00    	jne    5ee <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     518:	83 c3 01             	add    $0x1,%ebx
+     51b:	83 fb 64             	cmp    $0x64,%ebx
+     51e:	75 c0                	jne    4e0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     520:	83 ec 08             	sub    $0x8,%esp
+     523:	68 22 43 00 00       	push   $0x4322
+     528:	ff 35 14 64 00 00    	push   0x6414
+     52e:	e8 0d 37 00 00       	call   3c40 <printf>
+  close(fd);
+     533:	89 34 24             	mov    %esi,(%esp)
+     536:	e8 30 35 00 00       	call   3a6b <close>
+  fd = open("small", O_RDONLY);
+     53b:	5b                   	pop    %ebx
+     53c:	5e                   	pop    %esi
+     53d:	6a 00                	push   $0x0
+     53f:	68 cf 42 00 00       	push   $0x42cf
+     544:	e8 3a 35 00 00       	call   3a83 <open>
+  if(fd >= 0){
+     549:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     54c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     54e:	85 c0                	test   %eax,%eax
+     550:	0f 88 b1 00 00 00    	js     607 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     556:	83 ec 08             	sub    $0x8,%esp
+     559:	68 2d 43 00 00       	push   $0x432d
+     55e:	ff 35 14 64 00 00    	push   0x6414
+     564:	e8 d7 36 00 00       	call   3c40 <printf>
+  i = read(fd, buf, 2000);
+     569:	83 c4 0c             	add    $0xc,%esp
+     56c:	68 d0 07 00 00       	push   $0x7d0
+     571:	68 60 8b 00 00       	push   $0x8b60
+     576:	53                   	push   %ebx
+     577:	e8 df 34 00 00       	call   3a5b <read>
+  if(i == 2000){
+     57c:	83 c4 10             	add    $0x10,%esp
+     57f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     584:	0f 85 94 00 00 00    	jne    61e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     58a:	83 ec 08             	sub    $0x8,%esp
+     58d:	68 61 43 00 00       	push   $0x4361
+     592:	ff 35 14 64 00 00    	push   0x6414
+     598:	e8 a3 36 00 00       	call   3c40 <printf>
+  close(fd);
+     59d:	89 1c 24             	mov    %ebx,(%esp)
+     5a0:	e8 c6 34 00 00       	call   3a6b <close>
+  if(unlink("small") < 0){
+     5a5:	c7 04 24 cf 42 00 00 	movl   $0x42cf,(%esp)
+     5ac:	e8 e2 34 00 00       	call   3a93 <unlink>
+     5b1:	83 c4 10             	add    $0x10,%esp
+     5b4:	85 c0                	test   %eax,%eax
+     5b6:	78 7d                	js     635 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5b8:	83 ec 08             	sub    $0x8,%esp
+     5bb:	68 89 43 00 00       	push   $0x4389
+     5c0:	ff 35 14 64 00 00    	push   0x6414
+     5c6:	e8 75 36 00 00       	call   3c40 <printf>
+}
+     5cb:	83 c4 10             	add    $0x10,%esp
+     5ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5d1:	5b                   	pop    %ebx
+     5d2:	5e                   	pop    %esi
+     5d3:	5d                   	pop    %ebp
+     5d4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5d5:	83 ec 04             	sub    $0x4,%esp
+     5d8:	53                   	push   %ebx
+     5d9:	68 3c 52 00 00       	push   $0x523c
+     5de:	ff 35 14 64 00 00    	push   0x6414
+     5e4:	e8 57 36 00 00       	call   3c40 <printf>
+      exit();
+     5e9:	e8 55 34 00 00       	call   3a43 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5ee:	83 ec 04             	sub    $0x4,%esp
+     5f1:	53                   	push   %ebx
+     5f2:	68 60 52 00 00       	push   $0x5260
+     5f7:	ff 35 14 64 00 00    	push   0x6414
+     5fd:	e8 3e 36 00 00       	call   3c40 <printf>
+      exit();
+     602:	e8 3c 34 00 00       	call   3a43 <exit>
+    printf(stdout, "error: open small failed!\n");
+     607:	51                   	push   %ecx
+     608:	51                   	push   %ecx
+     609:	68 46 43 00 00       	push   $0x4346
+     60e:	ff 35 14 64 00 00    	push   0x6414
+     614:	e8 27 36 00 00       	call   3c40 <printf>
+    exit();
+     619:	e8 25 34 00 00       	call   3a43 <exit>
+    printf(stdout, "read failed\n");
+     61e:	52                   	push   %edx
+     61f:	52                   	push   %edx
+     620:	68 fa 46 00 00       	push   $0x46fa
+     625:	ff 35 14 64 00 00    	push   0x6414
+     62b:	e8 10 36 00 00       	call   3c40 <printf>
+    exit();
+     630:	e8 0e 34 00 00       	call   3a43 <exit>
+    printf(stdout, "unlink small failed\n");
+     635:	50                   	push   %eax
+     636:	50                   	push   %eax
+     637:	68 74 43 00 00       	push   $0x4374
+     63c:	ff 35 14 64 00 00    	push   0x6414
+     642:	e8 f9 35 00 00       	call   3c40 <printf>
+    exit();
+     647:	e8 f7 33 00 00       	call   3a43 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     64c:	50                   	push   %eax
+     64d:	50                   	push   %eax
+     64e:	68 f0 42 00 00       	push   $0x42f0
+     653:	ff 35 14 64 00 00    	push   0x6414
+     659:	e8 e2 35 00 00       	call   3c40 <printf>
+    exit();
+     65e:	e8 e0 33 00 00       	call   3a43 <exit>
+     663:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000670 <writetest1>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	56                   	push   %esi
+     674:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     675:	83 ec 08             	sub    $0x8,%esp
+     678:	68 9d 43 00 00       	push   $0x439d
+     67d:	ff 35 14 64 00 00    	push   0x6414
+     683:	e8 b8 35 00 00       	call   3c40 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     688:	58                   	pop    %eax
+     689:	5a                   	pop    %edx
+     68a:	68 02 02 00 00       	push   $0x202
+     68f:	68 17 44 00 00       	push   $0x4417
+     694:	e8 ea 33 00 00       	call   3a83 <open>
+  if(fd < 0){
+     699:	83 c4 10             	add    $0x10,%esp
+     69c:	85 c0                	test   %eax,%eax
+     69e:	0f 88 61 01 00 00    	js     805 <writetest1+0x195>
+     6a4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     6a6:	31 db                	xor    %ebx,%ebx
+     6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6b0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6b3:	89 1d 60 8b 00 00    	mov    %ebx,0x8b60
+    if(write(fd, buf, 512) != 512){
+     6b9:	68 00 02 00 00       	push   $0x200
+     6be:	68 60 8b 00 00       	push   $0x8b60
+     6c3:	56                   	push   %esi
+     6c4:	e8 9a 33 00 00       	call   3a63 <write>
+     6c9:	83 c4 10             	add    $0x10,%esp
+     6cc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6d1:	0f 85 b3 00 00 00    	jne    78a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     6d7:	83 c3 01             	add    $0x1,%ebx
+     6da:	81 fb 8a 00 00 00    	cmp    $0x8a,%ebx
+     6e0:	75 ce                	jne    6b0 <writetest1+0x40>
+  close(fd);
+     6e2:	83 ec 0c             	sub    $0xc,%esp
+     6e5:	56                   	push   %esi
+     6e6:	e8 80 33 00 00       	call   3a6b <close>
+  fd = open("big", O_RDONLY);
+     6eb:	5b                   	pop    %ebx
+     6ec:	5e                   	pop    %esi
+     6ed:	6a 00                	push   $0x0
+     6ef:	68 17 44 00 00       	push   $0x4417
+     6f4:	e8 8a 33 00 00       	call   3a83 <open>
+  if(fd < 0){
+     6f9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     6fc:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     6fe:	85 c0                	test   %eax,%eax
+     700:	0f 88 e8 00 00 00    	js     7ee <writetest1+0x17e>
+  n = 0;
+     706:	31 f6                	xor    %esi,%esi
+     708:	eb 1d                	jmp    727 <writetest1+0xb7>
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     710:	3d 00 02 00 00       	cmp    $0x200,%eax
+     715:	0f 85 9f 00 00 00    	jne    7ba <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     71b:	a1 60 8b 00 00       	mov    0x8b60,%eax
+     720:	39 f0                	cmp    %esi,%eax
+     722:	75 7f                	jne    7a3 <writetest1+0x133>
+    n++;
+     724:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     727:	83 ec 04             	sub    $0x4,%esp
+     72a:	68 00 02 00 00       	push   $0x200
+     72f:	68 60 8b 00 00       	push   $0x8b60
+     734:	53                   	push   %ebx
+     735:	e8 21 33 00 00       	call   3a5b <read>
+    if(i == 0){
+     73a:	83 c4 10             	add    $0x10,%esp
+     73d:	85 c0                	test   %eax,%eax
+     73f:	75 cf                	jne    710 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     741:	81 fe 89 00 00 00    	cmp    $0x89,%esi
+     747:	0f 84 86 00 00 00    	je     7d3 <writetest1+0x163>
+  close(fd);
+     74d:	83 ec 0c             	sub    $0xc,%esp
+     750:	53                   	push   %ebx
+     751:	e8 15 33 00 00       	call   3a6b <close>
+  if(unlink("big") < 0){
+     756:	c7 04 24 17 44 00 00 	movl   $0x4417,(%esp)
+     75d:	e8 31 33 00 00       	call   3a93 <unlink>
+     762:	83 c4 10             	add    $0x10,%esp
+     765:	85 c0                	test   %eax,%eax
+     767:	0f 88 af 00 00 00    	js     81c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     76d:	83 ec 08             	sub    $0x8,%esp
+     770:	68 3e 44 00 00       	push   $0x443e
+     775:	ff 35 14 64 00 00    	push   0x6414
+     77b:	e8 c0 34 00 00       	call   3c40 <printf>
+}
+     780:	83 c4 10             	add    $0x10,%esp
+     783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     786:	5b                   	pop    %ebx
+     787:	5e                   	pop    %esi
+     788:	5d                   	pop    %ebp
+     789:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     78a:	83 ec 04             	sub    $0x4,%esp
+     78d:	53                   	push   %ebx
+     78e:	68 c7 43 00 00       	push   $0x43c7
+     793:	ff 35 14 64 00 00    	push   0x6414
+     799:	e8 a2 34 00 00       	call   3c40 <printf>
+      exit();
+     79e:	e8 a0 32 00 00       	call   3a43 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7a3:	50                   	push   %eax
+     7a4:	56                   	push   %esi
+     7a5:	68 84 52 00 00       	push   $0x5284
+     7aa:	ff 35 14 64 00 00    	push   0x6414
+     7b0:	e8 8b 34 00 00       	call   3c40 <printf>
+      exit();
+     7b5:	e8 89 32 00 00       	call   3a43 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ba:	83 ec 04             	sub    $0x4,%esp
+     7bd:	50                   	push   %eax
+     7be:	68 1b 44 00 00       	push   $0x441b
+     7c3:	ff 35 14 64 00 00    	push   0x6414
+     7c9:	e8 72 34 00 00       	call   3c40 <printf>
+      exit();
+     7ce:	e8 70 32 00 00       	call   3a43 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7d3:	52                   	push   %edx
+     7d4:	68 89 00 00 00       	push   $0x89
+     7d9:	68 fe 43 00 00       	push   $0x43fe
+     7de:	ff 35 14 64 00 00    	push   0x6414
+     7e4:	e8 57 34 00 00       	call   3c40 <printf>
+        exit();
+     7e9:	e8 55 32 00 00       	call   3a43 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7ee:	51                   	push   %ecx
+     7ef:	51                   	push   %ecx
+     7f0:	68 e5 43 00 00       	push   $0x43e5
+     7f5:	ff 35 14 64 00 00    	push   0x6414
+     7fb:	e8 40 34 00 00       	call   3c40 <printf>
+    exit();
+     800:	e8 3e 32 00 00       	call   3a43 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     805:	50                   	push   %eax
+     806:	50                   	push   %eax
+     807:	68 ad 43 00 00       	push   $0x43ad
+     80c:	ff 35 14 64 00 00    	push   0x6414
+     812:	e8 29 34 00 00       	call   3c40 <printf>
+    exit();
+     817:	e8 27 32 00 00       	call   3a43 <exit>
+    printf(stdout, "unlink big failed\n");
+     81c:	50                   	push   %eax
+     81d:	50                   	push   %eax
+     81e:	68 2b 44 00 00       	push   $0x442b
+     823:	ff 35 14 64 00 00    	push   0x6414
+     829:	e8 12 34 00 00       	call   3c40 <printf>
+    exit();
+     82e:	e8 10 32 00 00       	call   3a43 <exit>
+     833:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000840 <createtest>:
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	53                   	push   %ebx
+  name[2] = '\0';
+     844:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     849:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     84c:	68 a4 52 00 00       	push   $0x52a4
+     851:	ff 35 14 64 00 00    	push   0x6414
+     857:	e8 e4 33 00 00       	call   3c40 <printf>
+  name[0] = 'a';
+     85c:	c6 05 50 8b 00 00 61 	movb   $0x61,0x8b50
+  name[2] = '\0';
+     863:	83 c4 10             	add    $0x10,%esp
+     866:	c6 05 52 8b 00 00 00 	movb   $0x0,0x8b52
+  for(i = 0; i < 52; i++){
+     86d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     870:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     873:	88 1d 51 8b 00 00    	mov    %bl,0x8b51
+  for(i = 0; i < 52; i++){
+     879:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     87c:	68 02 02 00 00       	push   $0x202
+     881:	68 50 8b 00 00       	push   $0x8b50
+     886:	e8 f8 31 00 00       	call   3a83 <open>
+    close(fd);
+     88b:	89 04 24             	mov    %eax,(%esp)
+     88e:	e8 d8 31 00 00       	call   3a6b <close>
+  for(i = 0; i < 52; i++){
+     893:	83 c4 10             	add    $0x10,%esp
+     896:	80 fb 64             	cmp    $0x64,%bl
+     899:	75 d5                	jne    870 <createtest+0x30>
+  name[0] = 'a';
+     89b:	c6 05 50 8b 00 00 61 	movb   $0x61,0x8b50
+  name[2] = '\0';
+     8a2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8a7:	c6 05 52 8b 00 00 00 	movb   $0x0,0x8b52
+  for(i = 0; i < 52; i++){
+     8ae:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8b0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8b3:	88 1d 51 8b 00 00    	mov    %bl,0x8b51
+  for(i = 0; i < 52; i++){
+     8b9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8bc:	68 50 8b 00 00       	push   $0x8b50
+     8c1:	e8 cd 31 00 00       	call   3a93 <unlink>
+  for(i = 0; i < 52; i++){
+     8c6:	83 c4 10             	add    $0x10,%esp
+     8c9:	80 fb 64             	cmp    $0x64,%bl
+     8cc:	75 e2                	jne    8b0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8ce:	83 ec 08             	sub    $0x8,%esp
+     8d1:	68 cc 52 00 00       	push   $0x52cc
+     8d6:	ff 35 14 64 00 00    	push   0x6414
+     8dc:	e8 5f 33 00 00       	call   3c40 <printf>
+}
+     8e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	c9                   	leave
+     8e8:	c3                   	ret
+     8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <dirtest>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     8f6:	68 4c 44 00 00       	push   $0x444c
+     8fb:	ff 35 14 64 00 00    	push   0x6414
+     901:	e8 3a 33 00 00       	call   3c40 <printf>
+  if(mkdir("dir0") < 0){
+     906:	c7 04 24 58 44 00 00 	movl   $0x4458,(%esp)
+     90d:	e8 99 31 00 00       	call   3aab <mkdir>
+     912:	83 c4 10             	add    $0x10,%esp
+     915:	85 c0                	test   %eax,%eax
+     917:	78 58                	js     971 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     919:	83 ec 0c             	sub    $0xc,%esp
+     91c:	68 58 44 00 00       	push   $0x4458
+     921:	e8 8d 31 00 00       	call   3ab3 <chdir>
+     926:	83 c4 10             	add    $0x10,%esp
+     929:	85 c0                	test   %eax,%eax
+     92b:	0f 88 85 00 00 00    	js     9b6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     931:	83 ec 0c             	sub    $0xc,%esp
+     934:	68 6a 4a 00 00       	push   $0x4a6a
+     939:	e8 75 31 00 00       	call   3ab3 <chdir>
+     93e:	83 c4 10             	add    $0x10,%esp
+     941:	85 c0                	test   %eax,%eax
+     943:	78 5a                	js     99f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     945:	83 ec 0c             	sub    $0xc,%esp
+     948:	68 58 44 00 00       	push   $0x4458
+     94d:	e8 41 31 00 00       	call   3a93 <unlink>
+     952:	83 c4 10             	add    $0x10,%esp
+     955:	85 c0                	test   %eax,%eax
+     957:	78 2f                	js     988 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     959:	83 ec 08             	sub    $0x8,%esp
+     95c:	68 95 44 00 00       	push   $0x4495
+     961:	ff 35 14 64 00 00    	push   0x6414
+     967:	e8 d4 32 00 00       	call   3c40 <printf>
+}
+     96c:	83 c4 10             	add    $0x10,%esp
+     96f:	c9                   	leave
+     970:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     971:	50                   	push   %eax
+     972:	50                   	push   %eax
+     973:	68 88 41 00 00       	push   $0x4188
+     978:	ff 35 14 64 00 00    	push   0x6414
+     97e:	e8 bd 32 00 00       	call   3c40 <printf>
+    exit();
+     983:	e8 bb 30 00 00       	call   3a43 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     988:	50                   	push   %eax
+     989:	50                   	push   %eax
+     98a:	68 81 44 00 00       	push   $0x4481
+     98f:	ff 35 14 64 00 00    	push   0x6414
+     995:	e8 a6 32 00 00       	call   3c40 <printf>
+    exit();
+     99a:	e8 a4 30 00 00       	call   3a43 <exit>
+    printf(stdout, "chdir .. failed\n");
+     99f:	52                   	push   %edx
+     9a0:	52                   	push   %edx
+     9a1:	68 70 44 00 00       	push   $0x4470
+     9a6:	ff 35 14 64 00 00    	push   0x6414
+     9ac:	e8 8f 32 00 00       	call   3c40 <printf>
+    exit();
+     9b1:	e8 8d 30 00 00       	call   3a43 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9b6:	51                   	push   %ecx
+     9b7:	51                   	push   %ecx
+     9b8:	68 5d 44 00 00       	push   $0x445d
+     9bd:	ff 35 14 64 00 00    	push   0x6414
+     9c3:	e8 78 32 00 00       	call   3c40 <printf>
+    exit();
+     9c8:	e8 76 30 00 00       	call   3a43 <exit>
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <exectest>:
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9d6:	68 a4 44 00 00       	push   $0x44a4
+     9db:	ff 35 14 64 00 00    	push   0x6414
+     9e1:	e8 5a 32 00 00       	call   3c40 <printf>
+  if(exec("echo", echoargv) < 0){
+     9e6:	5a                   	pop    %edx
+     9e7:	59                   	pop    %ecx
+     9e8:	68 18 64 00 00       	push   $0x6418
+     9ed:	68 6d 42 00 00       	push   $0x426d
+     9f2:	e8 84 30 00 00       	call   3a7b <exec>
+     9f7:	83 c4 10             	add    $0x10,%esp
+     9fa:	85 c0                	test   %eax,%eax
+     9fc:	78 02                	js     a00 <exectest+0x30>
+}
+     9fe:	c9                   	leave
+     9ff:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a00:	50                   	push   %eax
+     a01:	50                   	push   %eax
+     a02:	68 af 44 00 00       	push   $0x44af
+     a07:	ff 35 14 64 00 00    	push   0x6414
+     a0d:	e8 2e 32 00 00       	call   3c40 <printf>
+    exit();
+     a12:	e8 2c 30 00 00       	call   3a43 <exit>
+     a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1e:	66 90                	xchg   %ax,%ax
+
+00000a20 <textbusy>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	56                   	push   %esi
+     a24:	53                   	push   %ebx
+     a25:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "text busy test\n");
+     a28:	68 c1 44 00 00       	push   $0x44c1
+     a2d:	ff 35 14 64 00 00    	push   0x6414
+     a33:	e8 08 32 00 00       	call   3c40 <printf>
+  fd = open("usertests", O_RDWR);
+     a38:	58                   	pop    %eax
+     a39:	5a                   	pop    %edx
+     a3a:	6a 02                	push   $0x2
+     a3c:	68 d1 44 00 00       	push   $0x44d1
+     a41:	e8 3d 30 00 00       	call   3a83 <open>
+  if(fd < 0){
+     a46:	83 c4 10             	add    $0x10,%esp
+     a49:	85 c0                	test   %eax,%eax
+     a4b:	78 6f                	js     abc <textbusy+0x9c>
+  if(read(fd, &c, 1) != 1){
+     a4d:	83 ec 04             	sub    $0x4,%esp
+     a50:	8d 75 f7             	lea    -0x9(%ebp),%esi
+     a53:	89 c3                	mov    %eax,%ebx
+     a55:	6a 01                	push   $0x1
+     a57:	56                   	push   %esi
+     a58:	50                   	push   %eax
+     a59:	e8 fd 2f 00 00       	call   3a5b <read>
+     a5e:	83 c4 10             	add    $0x10,%esp
+     a61:	83 f8 01             	cmp    $0x1,%eax
+     a64:	0f 85 80 00 00 00    	jne    aea <textbusy+0xca>
+  close(fd);
+     a6a:	83 ec 0c             	sub    $0xc,%esp
+     a6d:	53                   	push   %ebx
+     a6e:	e8 f8 2f 00 00       	call   3a6b <close>
+  fd = open("usertests", O_RDWR);
+     a73:	5b                   	pop    %ebx
+     a74:	58                   	pop    %eax
+     a75:	6a 02                	push   $0x2
+     a77:	68 d1 44 00 00       	push   $0x44d1
+     a7c:	e8 02 30 00 00       	call   3a83 <open>
+  if(write(fd, &c, 1) != -1){
+     a81:	83 c4 0c             	add    $0xc,%esp
+     a84:	6a 01                	push   $0x1
+  fd = open("usertests", O_RDWR);
+     a86:	89 c3                	mov    %eax,%ebx
+  if(write(fd, &c, 1) != -1){
+     a88:	56                   	push   %esi
+     a89:	50                   	push   %eax
+     a8a:	e8 d4 2f 00 00       	call   3a63 <write>
+     a8f:	83 c4 10             	add    $0x10,%esp
+     a92:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a95:	75 3c                	jne    ad3 <textbusy+0xb3>
+  close(fd);
+     a97:	83 ec 0c             	sub    $0xc,%esp
+     a9a:	53                   	push   %ebx
+     a9b:	e8 cb 2f 00 00       	call   3a6b <close>
+  printf(stdout, "text busy ok\n");
+     aa0:	58                   	pop    %eax
+     aa1:	5a                   	pop    %edx
+     aa2:	68 20 45 00 00       	push   $0x4520
+     aa7:	ff 35 14 64 00 00    	push   0x6414
+     aad:	e8 8e 31 00 00       	call   3c40 <printf>
+}
+     ab2:	83 c4 10             	add    $0x10,%esp
+     ab5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ab8:	5b                   	pop    %ebx
+     ab9:	5e                   	pop    %esi
+     aba:	5d                   	pop    %ebp
+     abb:	c3                   	ret
+    printf(stdout, "open usertests failed\n");
+     abc:	50                   	push   %eax
+     abd:	50                   	push   %eax
+     abe:	68 db 44 00 00       	push   $0x44db
+     ac3:	ff 35 14 64 00 00    	push   0x6414
+     ac9:	e8 72 31 00 00       	call   3c40 <printf>
+    exit();
+     ace:	e8 70 2f 00 00       	call   3a43 <exit>
+    printf(stdout, "wrote running binary!\n");
+     ad3:	51                   	push   %ecx
+     ad4:	51                   	push   %ecx
+     ad5:	68 09 45 00 00       	push   $0x4509
+     ada:	ff 35 14 64 00 00    	push   0x6414
+     ae0:	e8 5b 31 00 00       	call   3c40 <printf>
+    exit();
+     ae5:	e8 59 2f 00 00       	call   3a43 <exit>
+    printf(stdout, "read usertests failed\n");
+     aea:	50                   	push   %eax
+     aeb:	50                   	push   %eax
+     aec:	68 f2 44 00 00       	push   $0x44f2
+     af1:	ff 35 14 64 00 00    	push   0x6414
+     af7:	e8 44 31 00 00       	call   3c40 <printf>
+    exit();
+     afc:	e8 42 2f 00 00       	call   3a43 <exit>
+     b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0f:	90                   	nop
+
+00000b10 <pipe1>:
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	57                   	push   %edi
+     b14:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     b15:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     b18:	53                   	push   %ebx
+     b19:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     b1c:	50                   	push   %eax
+     b1d:	e8 31 2f 00 00       	call   3a53 <pipe>
+     b22:	83 c4 10             	add    $0x10,%esp
+     b25:	85 c0                	test   %eax,%eax
+     b27:	0f 85 41 01 00 00    	jne    c6e <pipe1+0x15e>
+     b2d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     b2f:	e8 07 2f 00 00       	call   3a3b <fork>
+  if(pid == 0){
+     b34:	85 c0                	test   %eax,%eax
+     b36:	0f 84 92 00 00 00    	je     bce <pipe1+0xbe>
+  } else if(pid > 0){
+     b3c:	0f 8e 3f 01 00 00    	jle    c81 <pipe1+0x171>
+    close(fds[1]);
+     b42:	83 ec 0c             	sub    $0xc,%esp
+     b45:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     b48:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     b4a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     b4f:	e8 17 2f 00 00       	call   3a6b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     b54:	83 c4 10             	add    $0x10,%esp
+     b57:	83 ec 04             	sub    $0x4,%esp
+     b5a:	57                   	push   %edi
+     b5b:	68 60 8b 00 00       	push   $0x8b60
+     b60:	ff 75 e0             	push   -0x20(%ebp)
+     b63:	e8 f3 2e 00 00       	call   3a5b <read>
+     b68:	83 c4 10             	add    $0x10,%esp
+     b6b:	89 c1                	mov    %eax,%ecx
+     b6d:	85 c0                	test   %eax,%eax
+     b6f:	0f 8e b8 00 00 00    	jle    c2d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     b75:	89 f0                	mov    %esi,%eax
+     b77:	32 05 60 8b 00 00    	xor    0x8b60,%al
+     b7d:	0f b6 c0             	movzbl %al,%eax
+     b80:	85 c0                	test   %eax,%eax
+     b82:	75 30                	jne    bb4 <pipe1+0xa4>
+     b84:	83 c6 01             	add    $0x1,%esi
+     b87:	eb 0f                	jmp    b98 <pipe1+0x88>
+     b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b90:	38 90 60 8b 00 00    	cmp    %dl,0x8b60(%eax)
+     b96:	75 1c                	jne    bb4 <pipe1+0xa4>
+     b98:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     b9b:	83 c0 01             	add    $0x1,%eax
+     b9e:	39 c1                	cmp    %eax,%ecx
+     ba0:	75 ee                	jne    b90 <pipe1+0x80>
+      cc = cc * 2;
+     ba2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ba4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ba9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     bab:	89 d6                	mov    %edx,%esi
+     bad:	39 c7                	cmp    %eax,%edi
+     baf:	0f 4f f8             	cmovg  %eax,%edi
+     bb2:	eb a3                	jmp    b57 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     bb4:	83 ec 08             	sub    $0x8,%esp
+     bb7:	68 4b 45 00 00       	push   $0x454b
+     bbc:	6a 01                	push   $0x1
+     bbe:	e8 7d 30 00 00       	call   3c40 <printf>
+     bc3:	83 c4 10             	add    $0x10,%esp
+}
+     bc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bc9:	5b                   	pop    %ebx
+     bca:	5e                   	pop    %esi
+     bcb:	5f                   	pop    %edi
+     bcc:	5d                   	pop    %ebp
+     bcd:	c3                   	ret
+    close(fds[0]);
+     bce:	83 ec 0c             	sub    $0xc,%esp
+     bd1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     bd4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     bd6:	e8 90 2e 00 00       	call   3a6b <close>
+     bdb:	83 c4 10             	add    $0x10,%esp
+     bde:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     be0:	31 c0                	xor    %eax,%eax
+     be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     be8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     beb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     bee:	88 90 5f 8b 00 00    	mov    %dl,0x8b5f(%eax)
+      for(i = 0; i < 1033; i++)
+     bf4:	3d 09 04 00 00       	cmp    $0x409,%eax
+     bf9:	75 ed                	jne    be8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     bfb:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     bfe:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     c04:	68 09 04 00 00       	push   $0x409
+     c09:	68 60 8b 00 00       	push   $0x8b60
+     c0e:	ff 75 e4             	push   -0x1c(%ebp)
+     c11:	e8 4d 2e 00 00       	call   3a63 <write>
+     c16:	83 c4 10             	add    $0x10,%esp
+     c19:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c1e:	75 74                	jne    c94 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     c20:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c26:	75 b8                	jne    be0 <pipe1+0xd0>
+    exit();
+     c28:	e8 16 2e 00 00       	call   3a43 <exit>
+    if(total != 5 * 1033){
+     c2d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c33:	75 26                	jne    c5b <pipe1+0x14b>
+    close(fds[0]);
+     c35:	83 ec 0c             	sub    $0xc,%esp
+     c38:	ff 75 e0             	push   -0x20(%ebp)
+     c3b:	e8 2b 2e 00 00       	call   3a6b <close>
+    wait();
+     c40:	e8 06 2e 00 00       	call   3a4b <wait>
+  printf(1, "pipe1 ok\n");
+     c45:	5a                   	pop    %edx
+     c46:	59                   	pop    %ecx
+     c47:	68 70 45 00 00       	push   $0x4570
+     c4c:	6a 01                	push   $0x1
+     c4e:	e8 ed 2f 00 00       	call   3c40 <printf>
+     c53:	83 c4 10             	add    $0x10,%esp
+     c56:	e9 6b ff ff ff       	jmp    bc6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     c5b:	56                   	push   %esi
+     c5c:	53                   	push   %ebx
+     c5d:	68 59 45 00 00       	push   $0x4559
+     c62:	6a 01                	push   $0x1
+     c64:	e8 d7 2f 00 00       	call   3c40 <printf>
+      exit();
+     c69:	e8 d5 2d 00 00       	call   3a43 <exit>
+    printf(1, "pipe() failed\n");
+     c6e:	50                   	push   %eax
+     c6f:	50                   	push   %eax
+     c70:	68 2e 45 00 00       	push   $0x452e
+     c75:	6a 01                	push   $0x1
+     c77:	e8 c4 2f 00 00       	call   3c40 <printf>
+    exit();
+     c7c:	e8 c2 2d 00 00       	call   3a43 <exit>
+    printf(1, "fork() failed\n");
+     c81:	50                   	push   %eax
+     c82:	50                   	push   %eax
+     c83:	68 7a 45 00 00       	push   $0x457a
+     c88:	6a 01                	push   $0x1
+     c8a:	e8 b1 2f 00 00       	call   3c40 <printf>
+    exit();
+     c8f:	e8 af 2d 00 00       	call   3a43 <exit>
+        printf(1, "pipe1 oops 1\n");
+     c94:	57                   	push   %edi
+     c95:	57                   	push   %edi
+     c96:	68 3d 45 00 00       	push   $0x453d
+     c9b:	6a 01                	push   $0x1
+     c9d:	e8 9e 2f 00 00       	call   3c40 <printf>
+        exit();
+     ca2:	e8 9c 2d 00 00       	call   3a43 <exit>
+     ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cae:	66 90                	xchg   %ax,%ax
+
+00000cb0 <preempt>:
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	53                   	push   %ebx
+     cb6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     cb9:	68 89 45 00 00       	push   $0x4589
+     cbe:	6a 01                	push   $0x1
+     cc0:	e8 7b 2f 00 00       	call   3c40 <printf>
+  pid1 = fork();
+     cc5:	e8 71 2d 00 00       	call   3a3b <fork>
+  if(pid1 == 0)
+     cca:	83 c4 10             	add    $0x10,%esp
+     ccd:	85 c0                	test   %eax,%eax
+     ccf:	75 07                	jne    cd8 <preempt+0x28>
+    for(;;)
+     cd1:	eb fe                	jmp    cd1 <preempt+0x21>
+     cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cd7:	90                   	nop
+     cd8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     cda:	e8 5c 2d 00 00       	call   3a3b <fork>
+     cdf:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     ce1:	85 c0                	test   %eax,%eax
+     ce3:	75 0b                	jne    cf0 <preempt+0x40>
+    for(;;)
+     ce5:	eb fe                	jmp    ce5 <preempt+0x35>
+     ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cee:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     cf0:	83 ec 0c             	sub    $0xc,%esp
+     cf3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     cf6:	50                   	push   %eax
+     cf7:	e8 57 2d 00 00       	call   3a53 <pipe>
+  pid3 = fork();
+     cfc:	e8 3a 2d 00 00       	call   3a3b <fork>
+  if(pid3 == 0){
+     d01:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     d04:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     d06:	85 c0                	test   %eax,%eax
+     d08:	75 3e                	jne    d48 <preempt+0x98>
+    close(pfds[0]);
+     d0a:	83 ec 0c             	sub    $0xc,%esp
+     d0d:	ff 75 e0             	push   -0x20(%ebp)
+     d10:	e8 56 2d 00 00       	call   3a6b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     d15:	83 c4 0c             	add    $0xc,%esp
+     d18:	6a 01                	push   $0x1
+     d1a:	68 4e 4b 00 00       	push   $0x4b4e
+     d1f:	ff 75 e4             	push   -0x1c(%ebp)
+     d22:	e8 3c 2d 00 00       	call   3a63 <write>
+     d27:	83 c4 10             	add    $0x10,%esp
+     d2a:	83 f8 01             	cmp    $0x1,%eax
+     d2d:	0f 85 b8 00 00 00    	jne    deb <preempt+0x13b>
+    close(pfds[1]);
+     d33:	83 ec 0c             	sub    $0xc,%esp
+     d36:	ff 75 e4             	push   -0x1c(%ebp)
+     d39:	e8 2d 2d 00 00       	call   3a6b <close>
+     d3e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     d41:	eb fe                	jmp    d41 <preempt+0x91>
+     d43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d47:	90                   	nop
+  close(pfds[1]);
+     d48:	83 ec 0c             	sub    $0xc,%esp
+     d4b:	ff 75 e4             	push   -0x1c(%ebp)
+     d4e:	e8 18 2d 00 00       	call   3a6b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     d53:	83 c4 0c             	add    $0xc,%esp
+     d56:	68 00 20 00 00       	push   $0x2000
+     d5b:	68 60 8b 00 00       	push   $0x8b60
+     d60:	ff 75 e0             	push   -0x20(%ebp)
+     d63:	e8 f3 2c 00 00       	call   3a5b <read>
+     d68:	83 c4 10             	add    $0x10,%esp
+     d6b:	83 f8 01             	cmp    $0x1,%eax
+     d6e:	75 67                	jne    dd7 <preempt+0x127>
+  close(pfds[0]);
+     d70:	83 ec 0c             	sub    $0xc,%esp
+     d73:	ff 75 e0             	push   -0x20(%ebp)
+     d76:	e8 f0 2c 00 00       	call   3a6b <close>
+  printf(1, "kill... ");
+     d7b:	58                   	pop    %eax
+     d7c:	5a                   	pop    %edx
+     d7d:	68 ba 45 00 00       	push   $0x45ba
+     d82:	6a 01                	push   $0x1
+     d84:	e8 b7 2e 00 00       	call   3c40 <printf>
+  kill(pid1);
+     d89:	89 1c 24             	mov    %ebx,(%esp)
+     d8c:	e8 e2 2c 00 00       	call   3a73 <kill>
+  kill(pid2);
+     d91:	89 34 24             	mov    %esi,(%esp)
+     d94:	e8 da 2c 00 00       	call   3a73 <kill>
+  kill(pid3);
+     d99:	89 3c 24             	mov    %edi,(%esp)
+     d9c:	e8 d2 2c 00 00       	call   3a73 <kill>
+  printf(1, "wait... ");
+     da1:	59                   	pop    %ecx
+     da2:	5b                   	pop    %ebx
+     da3:	68 c3 45 00 00       	push   $0x45c3
+     da8:	6a 01                	push   $0x1
+     daa:	e8 91 2e 00 00       	call   3c40 <printf>
+  wait();
+     daf:	e8 97 2c 00 00       	call   3a4b <wait>
+  wait();
+     db4:	e8 92 2c 00 00       	call   3a4b <wait>
+  wait();
+     db9:	e8 8d 2c 00 00       	call   3a4b <wait>
+  printf(1, "preempt ok\n");
+     dbe:	5e                   	pop    %esi
+     dbf:	5f                   	pop    %edi
+     dc0:	68 cc 45 00 00       	push   $0x45cc
+     dc5:	6a 01                	push   $0x1
+     dc7:	e8 74 2e 00 00       	call   3c40 <printf>
+     dcc:	83 c4 10             	add    $0x10,%esp
+}
+     dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dd2:	5b                   	pop    %ebx
+     dd3:	5e                   	pop    %esi
+     dd4:	5f                   	pop    %edi
+     dd5:	5d                   	pop    %ebp
+     dd6:	c3                   	ret
+    printf(1, "preempt read error");
+     dd7:	83 ec 08             	sub    $0x8,%esp
+     dda:	68 a7 45 00 00       	push   $0x45a7
+     ddf:	6a 01                	push   $0x1
+     de1:	e8 5a 2e 00 00       	call   3c40 <printf>
+     de6:	83 c4 10             	add    $0x10,%esp
+     de9:	eb e4                	jmp    dcf <preempt+0x11f>
+      printf(1, "preempt write error");
+     deb:	83 ec 08             	sub    $0x8,%esp
+     dee:	68 93 45 00 00       	push   $0x4593
+     df3:	6a 01                	push   $0x1
+     df5:	e8 46 2e 00 00       	call   3c40 <printf>
+     dfa:	83 c4 10             	add    $0x10,%esp
+     dfd:	e9 31 ff ff ff       	jmp    d33 <preempt+0x83>
+     e02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e10 <exitwait>:
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	56                   	push   %esi
+     e14:	be 64 00 00 00       	mov    $0x64,%esi
+     e19:	53                   	push   %ebx
+     e1a:	eb 14                	jmp    e30 <exitwait+0x20>
+     e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     e20:	74 68                	je     e8a <exitwait+0x7a>
+      if(wait() != pid){
+     e22:	e8 24 2c 00 00       	call   3a4b <wait>
+     e27:	39 d8                	cmp    %ebx,%eax
+     e29:	75 2d                	jne    e58 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     e2b:	83 ee 01             	sub    $0x1,%esi
+     e2e:	74 41                	je     e71 <exitwait+0x61>
+    pid = fork();
+     e30:	e8 06 2c 00 00       	call   3a3b <fork>
+     e35:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     e37:	85 c0                	test   %eax,%eax
+     e39:	79 e5                	jns    e20 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     e3b:	83 ec 08             	sub    $0x8,%esp
+     e3e:	68 36 51 00 00       	push   $0x5136
+     e43:	6a 01                	push   $0x1
+     e45:	e8 f6 2d 00 00       	call   3c40 <printf>
+      return;
+     e4a:	83 c4 10             	add    $0x10,%esp
+}
+     e4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e50:	5b                   	pop    %ebx
+     e51:	5e                   	pop    %esi
+     e52:	5d                   	pop    %ebp
+     e53:	c3                   	ret
+     e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     e58:	83 ec 08             	sub    $0x8,%esp
+     e5b:	68 d8 45 00 00       	push   $0x45d8
+     e60:	6a 01                	push   $0x1
+     e62:	e8 d9 2d 00 00       	call   3c40 <printf>
+        return;
+     e67:	83 c4 10             	add    $0x10,%esp
+}
+     e6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e6d:	5b                   	pop    %ebx
+     e6e:	5e                   	pop    %esi
+     e6f:	5d                   	pop    %ebp
+     e70:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     e71:	83 ec 08             	sub    $0x8,%esp
+     e74:	68 e8 45 00 00       	push   $0x45e8
+     e79:	6a 01                	push   $0x1
+     e7b:	e8 c0 2d 00 00       	call   3c40 <printf>
+     e80:	83 c4 10             	add    $0x10,%esp
+}
+     e83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e86:	5b                   	pop    %ebx
+     e87:	5e                   	pop    %esi
+     e88:	5d                   	pop    %ebp
+     e89:	c3                   	ret
+      exit();
+     e8a:	e8 b4 2b 00 00       	call   3a43 <exit>
+     e8f:	90                   	nop
+
+00000e90 <mem>:
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	56                   	push   %esi
+     e94:	31 f6                	xor    %esi,%esi
+     e96:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     e97:	83 ec 08             	sub    $0x8,%esp
+     e9a:	68 f5 45 00 00       	push   $0x45f5
+     e9f:	6a 01                	push   $0x1
+     ea1:	e8 9a 2d 00 00       	call   3c40 <printf>
+  ppid = getpid();
+     ea6:	e8 18 2c 00 00       	call   3ac3 <getpid>
+     eab:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     ead:	e8 89 2b 00 00       	call   3a3b <fork>
+     eb2:	83 c4 10             	add    $0x10,%esp
+     eb5:	85 c0                	test   %eax,%eax
+     eb7:	74 0b                	je     ec4 <mem+0x34>
+     eb9:	e9 8a 00 00 00       	jmp    f48 <mem+0xb8>
+     ebe:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     ec0:	89 30                	mov    %esi,(%eax)
+     ec2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     ec4:	83 ec 0c             	sub    $0xc,%esp
+     ec7:	68 11 27 00 00       	push   $0x2711
+     ecc:	e8 ef 30 00 00       	call   3fc0 <malloc>
+     ed1:	83 c4 10             	add    $0x10,%esp
+     ed4:	85 c0                	test   %eax,%eax
+     ed6:	75 e8                	jne    ec0 <mem+0x30>
+    while(m1){
+     ed8:	85 f6                	test   %esi,%esi
+     eda:	74 18                	je     ef4 <mem+0x64>
+     edc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     ee0:	89 f0                	mov    %esi,%eax
+      free(m1);
+     ee2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     ee5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     ee7:	50                   	push   %eax
+     ee8:	e8 63 30 00 00       	call   3f50 <free>
+    while(m1){
+     eed:	83 c4 10             	add    $0x10,%esp
+     ef0:	85 f6                	test   %esi,%esi
+     ef2:	75 ec                	jne    ee0 <mem+0x50>
+    m1 = malloc(1024*20);
+     ef4:	83 ec 0c             	sub    $0xc,%esp
+     ef7:	68 00 50 00 00       	push   $0x5000
+     efc:	e8 bf 30 00 00       	call   3fc0 <malloc>
+    if(m1 == 0){
+     f01:	83 c4 10             	add    $0x10,%esp
+     f04:	85 c0                	test   %eax,%eax
+     f06:	74 20                	je     f28 <mem+0x98>
+    free(m1);
+     f08:	83 ec 0c             	sub    $0xc,%esp
+     f0b:	50                   	push   %eax
+     f0c:	e8 3f 30 00 00       	call   3f50 <free>
+    printf(1, "mem ok\n");
+     f11:	58                   	pop    %eax
+     f12:	5a                   	pop    %edx
+     f13:	68 19 46 00 00       	push   $0x4619
+     f18:	6a 01                	push   $0x1
+     f1a:	e8 21 2d 00 00       	call   3c40 <printf>
+    exit();
+     f1f:	e8 1f 2b 00 00       	call   3a43 <exit>
+     f24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     f28:	83 ec 08             	sub    $0x8,%esp
+     f2b:	68 ff 45 00 00       	push   $0x45ff
+     f30:	6a 01                	push   $0x1
+     f32:	e8 09 2d 00 00       	call   3c40 <printf>
+      kill(ppid);
+     f37:	89 1c 24             	mov    %ebx,(%esp)
+     f3a:	e8 34 2b 00 00       	call   3a73 <kill>
+      exit();
+     f3f:	e8 ff 2a 00 00       	call   3a43 <exit>
+     f44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     f48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f4b:	5b                   	pop    %ebx
+     f4c:	5e                   	pop    %esi
+     f4d:	5d                   	pop    %ebp
+    wait();
+     f4e:	e9 f8 2a 00 00       	jmp    3a4b <wait>
+     f53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f60 <sharedfd>:
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	57                   	push   %edi
+     f64:	56                   	push   %esi
+     f65:	53                   	push   %ebx
+     f66:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     f69:	68 21 46 00 00       	push   $0x4621
+     f6e:	6a 01                	push   $0x1
+     f70:	e8 cb 2c 00 00       	call   3c40 <printf>
+  unlink("sharedfd");
+     f75:	c7 04 24 30 46 00 00 	movl   $0x4630,(%esp)
+     f7c:	e8 12 2b 00 00       	call   3a93 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     f81:	5b                   	pop    %ebx
+     f82:	5e                   	pop    %esi
+     f83:	68 02 02 00 00       	push   $0x202
+     f88:	68 30 46 00 00       	push   $0x4630
+     f8d:	e8 f1 2a 00 00       	call   3a83 <open>
+  if(fd < 0){
+     f92:	83 c4 10             	add    $0x10,%esp
+     f95:	85 c0                	test   %eax,%eax
+     f97:	0f 88 2a 01 00 00    	js     10c7 <sharedfd+0x167>
+     f9d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     f9f:	8d 75 de             	lea    -0x22(%ebp),%esi
+     fa2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     fa7:	e8 8f 2a 00 00       	call   3a3b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     fac:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     faf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     fb2:	19 c0                	sbb    %eax,%eax
+     fb4:	83 ec 04             	sub    $0x4,%esp
+     fb7:	83 e0 f3             	and    $0xfffffff3,%eax
+     fba:	6a 0a                	push   $0xa
+     fbc:	83 c0 70             	add    $0x70,%eax
+     fbf:	50                   	push   %eax
+     fc0:	56                   	push   %esi
+     fc1:	e8 5a 28 00 00       	call   3820 <memset>
+     fc6:	83 c4 10             	add    $0x10,%esp
+     fc9:	eb 0a                	jmp    fd5 <sharedfd+0x75>
+     fcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fcf:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     fd0:	83 eb 01             	sub    $0x1,%ebx
+     fd3:	74 26                	je     ffb <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     fd5:	83 ec 04             	sub    $0x4,%esp
+     fd8:	6a 0a                	push   $0xa
+     fda:	56                   	push   %esi
+     fdb:	57                   	push   %edi
+     fdc:	e8 82 2a 00 00       	call   3a63 <write>
+     fe1:	83 c4 10             	add    $0x10,%esp
+     fe4:	83 f8 0a             	cmp    $0xa,%eax
+     fe7:	74 e7                	je     fd0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     fe9:	83 ec 08             	sub    $0x8,%esp
+     fec:	68 20 53 00 00       	push   $0x5320
+     ff1:	6a 01                	push   $0x1
+     ff3:	e8 48 2c 00 00       	call   3c40 <printf>
+      break;
+     ff8:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     ffb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     ffe:	85 c9                	test   %ecx,%ecx
+    1000:	0f 84 f5 00 00 00    	je     10fb <sharedfd+0x19b>
+    wait();
+    1006:	e8 40 2a 00 00       	call   3a4b <wait>
+  close(fd);
+    100b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    100e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1010:	57                   	push   %edi
+    1011:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1014:	e8 52 2a 00 00       	call   3a6b <close>
+  fd = open("sharedfd", 0);
+    1019:	58                   	pop    %eax
+    101a:	5a                   	pop    %edx
+    101b:	6a 00                	push   $0x0
+    101d:	68 30 46 00 00       	push   $0x4630
+    1022:	e8 5c 2a 00 00       	call   3a83 <open>
+  if(fd < 0){
+    1027:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    102a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    102c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    102f:	85 c0                	test   %eax,%eax
+    1031:	0f 88 aa 00 00 00    	js     10e1 <sharedfd+0x181>
+    1037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1040:	83 ec 04             	sub    $0x4,%esp
+    1043:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1046:	6a 0a                	push   $0xa
+    1048:	56                   	push   %esi
+    1049:	ff 75 d0             	push   -0x30(%ebp)
+    104c:	e8 0a 2a 00 00       	call   3a5b <read>
+    1051:	83 c4 10             	add    $0x10,%esp
+    1054:	85 c0                	test   %eax,%eax
+    1056:	7e 28                	jle    1080 <sharedfd+0x120>
+    1058:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    105b:	89 f0                	mov    %esi,%eax
+    105d:	eb 13                	jmp    1072 <sharedfd+0x112>
+    105f:	90                   	nop
+        np++;
+    1060:	80 f9 70             	cmp    $0x70,%cl
+    1063:	0f 94 c1             	sete   %cl
+    1066:	0f b6 c9             	movzbl %cl,%ecx
+    1069:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    106b:	83 c0 01             	add    $0x1,%eax
+    106e:	39 f8                	cmp    %edi,%eax
+    1070:	74 ce                	je     1040 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1072:	0f b6 08             	movzbl (%eax),%ecx
+    1075:	80 f9 63             	cmp    $0x63,%cl
+    1078:	75 e6                	jne    1060 <sharedfd+0x100>
+        nc++;
+    107a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    107d:	eb ec                	jmp    106b <sharedfd+0x10b>
+    107f:	90                   	nop
+  close(fd);
+    1080:	83 ec 0c             	sub    $0xc,%esp
+    1083:	ff 75 d0             	push   -0x30(%ebp)
+    1086:	e8 e0 29 00 00       	call   3a6b <close>
+  unlink("sharedfd");
+    108b:	c7 04 24 30 46 00 00 	movl   $0x4630,(%esp)
+    1092:	e8 fc 29 00 00       	call   3a93 <unlink>
+  if(nc == 10000 && np == 10000){
+    1097:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    109a:	83 c4 10             	add    $0x10,%esp
+    109d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    10a3:	75 5b                	jne    1100 <sharedfd+0x1a0>
+    10a5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    10ab:	75 53                	jne    1100 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    10ad:	83 ec 08             	sub    $0x8,%esp
+    10b0:	68 39 46 00 00       	push   $0x4639
+    10b5:	6a 01                	push   $0x1
+    10b7:	e8 84 2b 00 00       	call   3c40 <printf>
+    10bc:	83 c4 10             	add    $0x10,%esp
+}
+    10bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10c2:	5b                   	pop    %ebx
+    10c3:	5e                   	pop    %esi
+    10c4:	5f                   	pop    %edi
+    10c5:	5d                   	pop    %ebp
+    10c6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    10c7:	83 ec 08             	sub    $0x8,%esp
+    10ca:	68 f4 52 00 00       	push   $0x52f4
+    10cf:	6a 01                	push   $0x1
+    10d1:	e8 6a 2b 00 00       	call   3c40 <printf>
+    return;
+    10d6:	83 c4 10             	add    $0x10,%esp
+}
+    10d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10dc:	5b                   	pop    %ebx
+    10dd:	5e                   	pop    %esi
+    10de:	5f                   	pop    %edi
+    10df:	5d                   	pop    %ebp
+    10e0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    10e1:	83 ec 08             	sub    $0x8,%esp
+    10e4:	68 40 53 00 00       	push   $0x5340
+    10e9:	6a 01                	push   $0x1
+    10eb:	e8 50 2b 00 00       	call   3c40 <printf>
+    return;
+    10f0:	83 c4 10             	add    $0x10,%esp
+}
+    10f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10f6:	5b                   	pop    %ebx
+    10f7:	5e                   	pop    %esi
+    10f8:	5f                   	pop    %edi
+    10f9:	5d                   	pop    %ebp
+    10fa:	c3                   	ret
+    exit();
+    10fb:	e8 43 29 00 00       	call   3a43 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1100:	53                   	push   %ebx
+    1101:	52                   	push   %edx
+    1102:	68 46 46 00 00       	push   $0x4646
+    1107:	6a 01                	push   $0x1
+    1109:	e8 32 2b 00 00       	call   3c40 <printf>
+    exit();
+    110e:	e8 30 29 00 00       	call   3a43 <exit>
+    1113:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001120 <fourfiles>:
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	57                   	push   %edi
+    1124:	56                   	push   %esi
+    1125:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1126:	31 db                	xor    %ebx,%ebx
+{
+    1128:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    112b:	c7 45 d8 5b 46 00 00 	movl   $0x465b,-0x28(%ebp)
+    1132:	c7 45 dc a4 47 00 00 	movl   $0x47a4,-0x24(%ebp)
+    1139:	c7 45 e0 a8 47 00 00 	movl   $0x47a8,-0x20(%ebp)
+    1140:	c7 45 e4 5e 46 00 00 	movl   $0x465e,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1147:	68 61 46 00 00       	push   $0x4661
+    114c:	6a 01                	push   $0x1
+    114e:	e8 ed 2a 00 00       	call   3c40 <printf>
+    1153:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1156:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    115a:	83 ec 0c             	sub    $0xc,%esp
+    115d:	56                   	push   %esi
+    115e:	e8 30 29 00 00       	call   3a93 <unlink>
+    pid = fork();
+    1163:	e8 d3 28 00 00       	call   3a3b <fork>
+    if(pid < 0){
+    1168:	83 c4 10             	add    $0x10,%esp
+    116b:	85 c0                	test   %eax,%eax
+    116d:	0f 88 65 01 00 00    	js     12d8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1173:	0f 84 eb 00 00 00    	je     1264 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1179:	83 c3 01             	add    $0x1,%ebx
+    117c:	83 fb 04             	cmp    $0x4,%ebx
+    117f:	75 d5                	jne    1156 <fourfiles+0x36>
+    wait();
+    1181:	e8 c5 28 00 00       	call   3a4b <wait>
+  for(i = 0; i < 2; i++){
+    1186:	31 f6                	xor    %esi,%esi
+    wait();
+    1188:	e8 be 28 00 00       	call   3a4b <wait>
+    118d:	e8 b9 28 00 00       	call   3a4b <wait>
+    1192:	e8 b4 28 00 00       	call   3a4b <wait>
+    fname = names[i];
+    1197:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    119b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    119e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    11a0:	6a 00                	push   $0x0
+    11a2:	53                   	push   %ebx
+    11a3:	e8 db 28 00 00       	call   3a83 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    11a8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    11ab:	83 c4 10             	add    $0x10,%esp
+    11ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    11b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11b8:	83 ec 04             	sub    $0x4,%esp
+    11bb:	68 00 20 00 00       	push   $0x2000
+    11c0:	68 60 8b 00 00       	push   $0x8b60
+    11c5:	ff 75 d4             	push   -0x2c(%ebp)
+    11c8:	e8 8e 28 00 00       	call   3a5b <read>
+    11cd:	83 c4 10             	add    $0x10,%esp
+    11d0:	89 c3                	mov    %eax,%ebx
+    11d2:	85 c0                	test   %eax,%eax
+    11d4:	7e 28                	jle    11fe <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    11d6:	31 c0                	xor    %eax,%eax
+    11d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11df:	90                   	nop
+        if(buf[j] != '0'+i){
+    11e0:	83 fe 01             	cmp    $0x1,%esi
+    11e3:	0f be 88 60 8b 00 00 	movsbl 0x8b60(%eax),%ecx
+    11ea:	19 d2                	sbb    %edx,%edx
+    11ec:	83 c2 31             	add    $0x31,%edx
+    11ef:	39 d1                	cmp    %edx,%ecx
+    11f1:	75 5d                	jne    1250 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    11f3:	83 c0 01             	add    $0x1,%eax
+    11f6:	39 c3                	cmp    %eax,%ebx
+    11f8:	75 e6                	jne    11e0 <fourfiles+0xc0>
+      total += n;
+    11fa:	01 df                	add    %ebx,%edi
+    11fc:	eb ba                	jmp    11b8 <fourfiles+0x98>
+    close(fd);
+    11fe:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1201:	83 ec 0c             	sub    $0xc,%esp
+    1204:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1207:	51                   	push   %ecx
+    1208:	e8 5e 28 00 00       	call   3a6b <close>
+    if(total != 12*500){
+    120d:	83 c4 10             	add    $0x10,%esp
+    1210:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1216:	0f 85 d0 00 00 00    	jne    12ec <fourfiles+0x1cc>
+    unlink(fname);
+    121c:	83 ec 0c             	sub    $0xc,%esp
+    121f:	53                   	push   %ebx
+    1220:	e8 6e 28 00 00       	call   3a93 <unlink>
+  for(i = 0; i < 2; i++){
+    1225:	83 c4 10             	add    $0x10,%esp
+    1228:	85 f6                	test   %esi,%esi
+    122a:	75 0a                	jne    1236 <fourfiles+0x116>
+    122c:	be 01 00 00 00       	mov    $0x1,%esi
+    1231:	e9 61 ff ff ff       	jmp    1197 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1236:	83 ec 08             	sub    $0x8,%esp
+    1239:	68 9f 46 00 00       	push   $0x469f
+    123e:	6a 01                	push   $0x1
+    1240:	e8 fb 29 00 00       	call   3c40 <printf>
+}
+    1245:	83 c4 10             	add    $0x10,%esp
+    1248:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    124b:	5b                   	pop    %ebx
+    124c:	5e                   	pop    %esi
+    124d:	5f                   	pop    %edi
+    124e:	5d                   	pop    %ebp
+    124f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1250:	83 ec 08             	sub    $0x8,%esp
+    1253:	68 82 46 00 00       	push   $0x4682
+    1258:	6a 01                	push   $0x1
+    125a:	e8 e1 29 00 00       	call   3c40 <printf>
+          exit();
+    125f:	e8 df 27 00 00       	call   3a43 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1264:	83 ec 08             	sub    $0x8,%esp
+    1267:	68 02 02 00 00       	push   $0x202
+    126c:	56                   	push   %esi
+    126d:	e8 11 28 00 00       	call   3a83 <open>
+      if(fd < 0){
+    1272:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1275:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1277:	85 c0                	test   %eax,%eax
+    1279:	78 45                	js     12c0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    127b:	83 ec 04             	sub    $0x4,%esp
+    127e:	83 c3 30             	add    $0x30,%ebx
+    1281:	68 00 02 00 00       	push   $0x200
+    1286:	53                   	push   %ebx
+    1287:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    128c:	68 60 8b 00 00       	push   $0x8b60
+    1291:	e8 8a 25 00 00       	call   3820 <memset>
+    1296:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1299:	83 ec 04             	sub    $0x4,%esp
+    129c:	68 f4 01 00 00       	push   $0x1f4
+    12a1:	68 60 8b 00 00       	push   $0x8b60
+    12a6:	56                   	push   %esi
+    12a7:	e8 b7 27 00 00       	call   3a63 <write>
+    12ac:	83 c4 10             	add    $0x10,%esp
+    12af:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    12b4:	75 49                	jne    12ff <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    12b6:	83 eb 01             	sub    $0x1,%ebx
+    12b9:	75 de                	jne    1299 <fourfiles+0x179>
+      exit();
+    12bb:	e8 83 27 00 00       	call   3a43 <exit>
+        printf(1, "create failed\n");
+    12c0:	51                   	push   %ecx
+    12c1:	51                   	push   %ecx
+    12c2:	68 fc 48 00 00       	push   $0x48fc
+    12c7:	6a 01                	push   $0x1
+    12c9:	e8 72 29 00 00       	call   3c40 <printf>
+        exit();
+    12ce:	e8 70 27 00 00       	call   3a43 <exit>
+    12d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12d7:	90                   	nop
+      printf(1, "fork failed\n");
+    12d8:	83 ec 08             	sub    $0x8,%esp
+    12db:	68 36 51 00 00       	push   $0x5136
+    12e0:	6a 01                	push   $0x1
+    12e2:	e8 59 29 00 00       	call   3c40 <printf>
+      exit();
+    12e7:	e8 57 27 00 00       	call   3a43 <exit>
+      printf(1, "wrong length %d\n", total);
+    12ec:	50                   	push   %eax
+    12ed:	57                   	push   %edi
+    12ee:	68 8e 46 00 00       	push   $0x468e
+    12f3:	6a 01                	push   $0x1
+    12f5:	e8 46 29 00 00       	call   3c40 <printf>
+      exit();
+    12fa:	e8 44 27 00 00       	call   3a43 <exit>
+          printf(1, "write failed %d\n", n);
+    12ff:	52                   	push   %edx
+    1300:	50                   	push   %eax
+    1301:	68 71 46 00 00       	push   $0x4671
+    1306:	6a 01                	push   $0x1
+    1308:	e8 33 29 00 00       	call   3c40 <printf>
+          exit();
+    130d:	e8 31 27 00 00       	call   3a43 <exit>
+    1312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <createdelete>:
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1325:	31 f6                	xor    %esi,%esi
+{
+    1327:	53                   	push   %ebx
+    1328:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    132b:	68 ad 46 00 00       	push   $0x46ad
+    1330:	6a 01                	push   $0x1
+    1332:	e8 09 29 00 00       	call   3c40 <printf>
+    1337:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    133a:	e8 fc 26 00 00       	call   3a3b <fork>
+    133f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1341:	85 c0                	test   %eax,%eax
+    1343:	0f 88 ac 01 00 00    	js     14f5 <createdelete+0x1d5>
+    if(pid == 0){
+    1349:	0f 84 01 01 00 00    	je     1450 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    134f:	83 c6 01             	add    $0x1,%esi
+    1352:	83 fe 04             	cmp    $0x4,%esi
+    1355:	75 e3                	jne    133a <createdelete+0x1a>
+    wait();
+    1357:	e8 ef 26 00 00       	call   3a4b <wait>
+  for(i = 0; i < N; i++){
+    135c:	31 ff                	xor    %edi,%edi
+    135e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1361:	e8 e5 26 00 00       	call   3a4b <wait>
+    1366:	e8 e0 26 00 00       	call   3a4b <wait>
+    136b:	e8 db 26 00 00       	call   3a4b <wait>
+  name[0] = name[1] = name[2] = 0;
+    1370:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1378:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    137a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    137d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1382:	0f 94 c2             	sete   %dl
+    1385:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1388:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    138b:	0f 9f c0             	setg   %al
+    138e:	09 c2                	or     %eax,%edx
+    1390:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1393:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1397:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    139a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    139d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    13a0:	6a 00                	push   $0x0
+    13a2:	56                   	push   %esi
+    13a3:	e8 db 26 00 00       	call   3a83 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    13a8:	83 c4 10             	add    $0x10,%esp
+    13ab:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    13af:	74 7f                	je     1430 <createdelete+0x110>
+    13b1:	85 c0                	test   %eax,%eax
+    13b3:	0f 88 27 01 00 00    	js     14e0 <createdelete+0x1c0>
+        close(fd);
+    13b9:	83 ec 0c             	sub    $0xc,%esp
+    13bc:	50                   	push   %eax
+    13bd:	e8 a9 26 00 00       	call   3a6b <close>
+    13c2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    13c5:	83 c3 01             	add    $0x1,%ebx
+    13c8:	80 fb 74             	cmp    $0x74,%bl
+    13cb:	75 c6                	jne    1393 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    13cd:	83 c7 01             	add    $0x1,%edi
+    13d0:	83 ff 14             	cmp    $0x14,%edi
+    13d3:	75 a3                	jne    1378 <createdelete+0x58>
+    13d5:	bf 70 00 00 00       	mov    $0x70,%edi
+    13da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    13e0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    13e3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    13e8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    13eb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    13ed:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    13f0:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    13f3:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    13f7:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    13fa:	56                   	push   %esi
+    13fb:	e8 93 26 00 00       	call   3a93 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1400:	83 c4 10             	add    $0x10,%esp
+    1403:	83 eb 01             	sub    $0x1,%ebx
+    1406:	75 e3                	jne    13eb <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1408:	83 c7 01             	add    $0x1,%edi
+    140b:	89 f8                	mov    %edi,%eax
+    140d:	3c 84                	cmp    $0x84,%al
+    140f:	75 cf                	jne    13e0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1411:	83 ec 08             	sub    $0x8,%esp
+    1414:	68 c0 46 00 00       	push   $0x46c0
+    1419:	6a 01                	push   $0x1
+    141b:	e8 20 28 00 00       	call   3c40 <printf>
+}
+    1420:	83 c4 10             	add    $0x10,%esp
+    1423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1426:	5b                   	pop    %ebx
+    1427:	5e                   	pop    %esi
+    1428:	5f                   	pop    %edi
+    1429:	5d                   	pop    %ebp
+    142a:	c3                   	ret
+    142b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1430:	85 c0                	test   %eax,%eax
+    1432:	78 91                	js     13c5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1434:	50                   	push   %eax
+    1435:	56                   	push   %esi
+    1436:	68 90 53 00 00       	push   $0x5390
+    143b:	6a 01                	push   $0x1
+    143d:	e8 fe 27 00 00       	call   3c40 <printf>
+        exit();
+    1442:	e8 fc 25 00 00       	call   3a43 <exit>
+    1447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1450:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1453:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1457:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    145a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    145d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1460:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1463:	8d 43 30             	lea    0x30(%ebx),%eax
+    1466:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1469:	68 02 02 00 00       	push   $0x202
+    146e:	56                   	push   %esi
+    146f:	e8 0f 26 00 00       	call   3a83 <open>
+        if(fd < 0){
+    1474:	83 c4 10             	add    $0x10,%esp
+    1477:	85 c0                	test   %eax,%eax
+    1479:	0f 88 8a 00 00 00    	js     1509 <createdelete+0x1e9>
+        close(fd);
+    147f:	83 ec 0c             	sub    $0xc,%esp
+    1482:	50                   	push   %eax
+    1483:	e8 e3 25 00 00       	call   3a6b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1488:	83 c4 10             	add    $0x10,%esp
+    148b:	85 db                	test   %ebx,%ebx
+    148d:	74 19                	je     14a8 <createdelete+0x188>
+    148f:	f6 c3 01             	test   $0x1,%bl
+    1492:	74 1b                	je     14af <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1494:	83 c3 01             	add    $0x1,%ebx
+    1497:	83 fb 14             	cmp    $0x14,%ebx
+    149a:	75 c4                	jne    1460 <createdelete+0x140>
+      exit();
+    149c:	e8 a2 25 00 00       	call   3a43 <exit>
+    14a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    14a8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    14ad:	eb b1                	jmp    1460 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    14af:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    14b1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    14b4:	d1 f8                	sar    %eax
+    14b6:	83 c0 30             	add    $0x30,%eax
+    14b9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    14bc:	56                   	push   %esi
+    14bd:	e8 d1 25 00 00       	call   3a93 <unlink>
+    14c2:	83 c4 10             	add    $0x10,%esp
+    14c5:	85 c0                	test   %eax,%eax
+    14c7:	79 cb                	jns    1494 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    14c9:	52                   	push   %edx
+    14ca:	52                   	push   %edx
+    14cb:	68 41 42 00 00       	push   $0x4241
+    14d0:	6a 01                	push   $0x1
+    14d2:	e8 69 27 00 00       	call   3c40 <printf>
+            exit();
+    14d7:	e8 67 25 00 00       	call   3a43 <exit>
+    14dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    14e0:	83 ec 04             	sub    $0x4,%esp
+    14e3:	56                   	push   %esi
+    14e4:	68 6c 53 00 00       	push   $0x536c
+    14e9:	6a 01                	push   $0x1
+    14eb:	e8 50 27 00 00       	call   3c40 <printf>
+        exit();
+    14f0:	e8 4e 25 00 00       	call   3a43 <exit>
+      printf(1, "fork failed\n");
+    14f5:	83 ec 08             	sub    $0x8,%esp
+    14f8:	68 36 51 00 00       	push   $0x5136
+    14fd:	6a 01                	push   $0x1
+    14ff:	e8 3c 27 00 00       	call   3c40 <printf>
+      exit();
+    1504:	e8 3a 25 00 00       	call   3a43 <exit>
+          printf(1, "create failed\n");
+    1509:	83 ec 08             	sub    $0x8,%esp
+    150c:	68 fc 48 00 00       	push   $0x48fc
+    1511:	6a 01                	push   $0x1
+    1513:	e8 28 27 00 00       	call   3c40 <printf>
+          exit();
+    1518:	e8 26 25 00 00       	call   3a43 <exit>
+    151d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001520 <unlinkread>:
+{
+    1520:	55                   	push   %ebp
+    1521:	89 e5                	mov    %esp,%ebp
+    1523:	56                   	push   %esi
+    1524:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1525:	83 ec 08             	sub    $0x8,%esp
+    1528:	68 d1 46 00 00       	push   $0x46d1
+    152d:	6a 01                	push   $0x1
+    152f:	e8 0c 27 00 00       	call   3c40 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1534:	5b                   	pop    %ebx
+    1535:	5e                   	pop    %esi
+    1536:	68 02 02 00 00       	push   $0x202
+    153b:	68 e2 46 00 00       	push   $0x46e2
+    1540:	e8 3e 25 00 00       	call   3a83 <open>
+  if(fd < 0){
+    1545:	83 c4 10             	add    $0x10,%esp
+    1548:	85 c0                	test   %eax,%eax
+    154a:	0f 88 e6 00 00 00    	js     1636 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1550:	83 ec 04             	sub    $0x4,%esp
+    1553:	89 c3                	mov    %eax,%ebx
+    1555:	6a 05                	push   $0x5
+    1557:	68 07 47 00 00       	push   $0x4707
+    155c:	50                   	push   %eax
+    155d:	e8 01 25 00 00       	call   3a63 <write>
+  close(fd);
+    1562:	89 1c 24             	mov    %ebx,(%esp)
+    1565:	e8 01 25 00 00       	call   3a6b <close>
+  fd = open("unlinkread", O_RDWR);
+    156a:	58                   	pop    %eax
+    156b:	5a                   	pop    %edx
+    156c:	6a 02                	push   $0x2
+    156e:	68 e2 46 00 00       	push   $0x46e2
+    1573:	e8 0b 25 00 00       	call   3a83 <open>
+  if(fd < 0){
+    1578:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    157b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    157d:	85 c0                	test   %eax,%eax
+    157f:	0f 88 10 01 00 00    	js     1695 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1585:	83 ec 0c             	sub    $0xc,%esp
+    1588:	68 e2 46 00 00       	push   $0x46e2
+    158d:	e8 01 25 00 00       	call   3a93 <unlink>
+    1592:	83 c4 10             	add    $0x10,%esp
+    1595:	85 c0                	test   %eax,%eax
+    1597:	0f 85 e5 00 00 00    	jne    1682 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    159d:	83 ec 08             	sub    $0x8,%esp
+    15a0:	68 02 02 00 00       	push   $0x202
+    15a5:	68 e2 46 00 00       	push   $0x46e2
+    15aa:	e8 d4 24 00 00       	call   3a83 <open>
+  write(fd1, "yyy", 3);
+    15af:	83 c4 0c             	add    $0xc,%esp
+    15b2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    15b4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    15b6:	68 3f 47 00 00       	push   $0x473f
+    15bb:	50                   	push   %eax
+    15bc:	e8 a2 24 00 00       	call   3a63 <write>
+  close(fd1);
+    15c1:	89 34 24             	mov    %esi,(%esp)
+    15c4:	e8 a2 24 00 00       	call   3a6b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    15c9:	83 c4 0c             	add    $0xc,%esp
+    15cc:	68 00 20 00 00       	push   $0x2000
+    15d1:	68 60 8b 00 00       	push   $0x8b60
+    15d6:	53                   	push   %ebx
+    15d7:	e8 7f 24 00 00       	call   3a5b <read>
+    15dc:	83 c4 10             	add    $0x10,%esp
+    15df:	83 f8 05             	cmp    $0x5,%eax
+    15e2:	0f 85 87 00 00 00    	jne    166f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    15e8:	80 3d 60 8b 00 00 68 	cmpb   $0x68,0x8b60
+    15ef:	75 6b                	jne    165c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    15f1:	83 ec 04             	sub    $0x4,%esp
+    15f4:	6a 0a                	push   $0xa
+    15f6:	68 60 8b 00 00       	push   $0x8b60
+    15fb:	53                   	push   %ebx
+    15fc:	e8 62 24 00 00       	call   3a63 <write>
+    1601:	83 c4 10             	add    $0x10,%esp
+    1604:	83 f8 0a             	cmp    $0xa,%eax
+    1607:	75 40                	jne    1649 <unlinkread+0x129>
+  close(fd);
+    1609:	83 ec 0c             	sub    $0xc,%esp
+    160c:	53                   	push   %ebx
+    160d:	e8 59 24 00 00       	call   3a6b <close>
+  unlink("unlinkread");
+    1612:	c7 04 24 e2 46 00 00 	movl   $0x46e2,(%esp)
+    1619:	e8 75 24 00 00       	call   3a93 <unlink>
+  printf(1, "unlinkread ok\n");
+    161e:	58                   	pop    %eax
+    161f:	5a                   	pop    %edx
+    1620:	68 8a 47 00 00       	push   $0x478a
+    1625:	6a 01                	push   $0x1
+    1627:	e8 14 26 00 00       	call   3c40 <printf>
+}
+    162c:	83 c4 10             	add    $0x10,%esp
+    162f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1632:	5b                   	pop    %ebx
+    1633:	5e                   	pop    %esi
+    1634:	5d                   	pop    %ebp
+    1635:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1636:	51                   	push   %ecx
+    1637:	51                   	push   %ecx
+    1638:	68 ed 46 00 00       	push   $0x46ed
+    163d:	6a 01                	push   $0x1
+    163f:	e8 fc 25 00 00       	call   3c40 <printf>
+    exit();
+    1644:	e8 fa 23 00 00       	call   3a43 <exit>
+    printf(1, "unlinkread write failed\n");
+    1649:	51                   	push   %ecx
+    164a:	51                   	push   %ecx
+    164b:	68 71 47 00 00       	push   $0x4771
+    1650:	6a 01                	push   $0x1
+    1652:	e8 e9 25 00 00       	call   3c40 <printf>
+    exit();
+    1657:	e8 e7 23 00 00       	call   3a43 <exit>
+    printf(1, "unlinkread wrong data\n");
+    165c:	53                   	push   %ebx
+    165d:	53                   	push   %ebx
+    165e:	68 5a 47 00 00       	push   $0x475a
+    1663:	6a 01                	push   $0x1
+    1665:	e8 d6 25 00 00       	call   3c40 <printf>
+    exit();
+    166a:	e8 d4 23 00 00       	call   3a43 <exit>
+    printf(1, "unlinkread read failed");
+    166f:	56                   	push   %esi
+    1670:	56                   	push   %esi
+    1671:	68 43 47 00 00       	push   $0x4743
+    1676:	6a 01                	push   $0x1
+    1678:	e8 c3 25 00 00       	call   3c40 <printf>
+    exit();
+    167d:	e8 c1 23 00 00       	call   3a43 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1682:	50                   	push   %eax
+    1683:	50                   	push   %eax
+    1684:	68 25 47 00 00       	push   $0x4725
+    1689:	6a 01                	push   $0x1
+    168b:	e8 b0 25 00 00       	call   3c40 <printf>
+    exit();
+    1690:	e8 ae 23 00 00       	call   3a43 <exit>
+    printf(1, "open unlinkread failed\n");
+    1695:	50                   	push   %eax
+    1696:	50                   	push   %eax
+    1697:	68 0d 47 00 00       	push   $0x470d
+    169c:	6a 01                	push   $0x1
+    169e:	e8 9d 25 00 00       	call   3c40 <printf>
+    exit();
+    16a3:	e8 9b 23 00 00       	call   3a43 <exit>
+    16a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16af:	90                   	nop
+
+000016b0 <linktest>:
+{
+    16b0:	55                   	push   %ebp
+    16b1:	89 e5                	mov    %esp,%ebp
+    16b3:	53                   	push   %ebx
+    16b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    16b7:	68 99 47 00 00       	push   $0x4799
+    16bc:	6a 01                	push   $0x1
+    16be:	e8 7d 25 00 00       	call   3c40 <printf>
+  unlink("lf1");
+    16c3:	c7 04 24 a3 47 00 00 	movl   $0x47a3,(%esp)
+    16ca:	e8 c4 23 00 00       	call   3a93 <unlink>
+  unlink("lf2");
+    16cf:	c7 04 24 a7 47 00 00 	movl   $0x47a7,(%esp)
+    16d6:	e8 b8 23 00 00       	call   3a93 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    16db:	58                   	pop    %eax
+    16dc:	5a                   	pop    %edx
+    16dd:	68 02 02 00 00       	push   $0x202
+    16e2:	68 a3 47 00 00       	push   $0x47a3
+    16e7:	e8 97 23 00 00       	call   3a83 <open>
+  if(fd < 0){
+    16ec:	83 c4 10             	add    $0x10,%esp
+    16ef:	85 c0                	test   %eax,%eax
+    16f1:	0f 88 1e 01 00 00    	js     1815 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    16f7:	83 ec 04             	sub    $0x4,%esp
+    16fa:	89 c3                	mov    %eax,%ebx
+    16fc:	6a 05                	push   $0x5
+    16fe:	68 07 47 00 00       	push   $0x4707
+    1703:	50                   	push   %eax
+    1704:	e8 5a 23 00 00       	call   3a63 <write>
+    1709:	83 c4 10             	add    $0x10,%esp
+    170c:	83 f8 05             	cmp    $0x5,%eax
+    170f:	0f 85 98 01 00 00    	jne    18ad <linktest+0x1fd>
+  close(fd);
+    1715:	83 ec 0c             	sub    $0xc,%esp
+    1718:	53                   	push   %ebx
+    1719:	e8 4d 23 00 00       	call   3a6b <close>
+  if(link("lf1", "lf2") < 0){
+    171e:	5b                   	pop    %ebx
+    171f:	58                   	pop    %eax
+    1720:	68 a7 47 00 00       	push   $0x47a7
+    1725:	68 a3 47 00 00       	push   $0x47a3
+    172a:	e8 74 23 00 00       	call   3aa3 <link>
+    172f:	83 c4 10             	add    $0x10,%esp
+    1732:	85 c0                	test   %eax,%eax
+    1734:	0f 88 60 01 00 00    	js     189a <linktest+0x1ea>
+  unlink("lf1");
+    173a:	83 ec 0c             	sub    $0xc,%esp
+    173d:	68 a3 47 00 00       	push   $0x47a3
+    1742:	e8 4c 23 00 00       	call   3a93 <unlink>
+  if(open("lf1", 0) >= 0){
+    1747:	58                   	pop    %eax
+    1748:	5a                   	pop    %edx
+    1749:	6a 00                	push   $0x0
+    174b:	68 a3 47 00 00       	push   $0x47a3
+    1750:	e8 2e 23 00 00       	call   3a83 <open>
+    1755:	83 c4 10             	add    $0x10,%esp
+    1758:	85 c0                	test   %eax,%eax
+    175a:	0f 89 27 01 00 00    	jns    1887 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1760:	83 ec 08             	sub    $0x8,%esp
+    1763:	6a 00                	push   $0x0
+    1765:	68 a7 47 00 00       	push   $0x47a7
+    176a:	e8 14 23 00 00       	call   3a83 <open>
+  if(fd < 0){
+    176f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1772:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1774:	85 c0                	test   %eax,%eax
+    1776:	0f 88 f8 00 00 00    	js     1874 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    177c:	83 ec 04             	sub    $0x4,%esp
+    177f:	68 00 20 00 00       	push   $0x2000
+    1784:	68 60 8b 00 00       	push   $0x8b60
+    1789:	50                   	push   %eax
+    178a:	e8 cc 22 00 00       	call   3a5b <read>
+    178f:	83 c4 10             	add    $0x10,%esp
+    1792:	83 f8 05             	cmp    $0x5,%eax
+    1795:	0f 85 c6 00 00 00    	jne    1861 <linktest+0x1b1>
+  close(fd);
+    179b:	83 ec 0c             	sub    $0xc,%esp
+    179e:	53                   	push   %ebx
+    179f:	e8 c7 22 00 00       	call   3a6b <close>
+  if(link("lf2", "lf2") >= 0){
+    17a4:	58                   	pop    %eax
+    17a5:	5a                   	pop    %edx
+    17a6:	68 a7 47 00 00       	push   $0x47a7
+    17ab:	68 a7 47 00 00       	push   $0x47a7
+    17b0:	e8 ee 22 00 00       	call   3aa3 <link>
+    17b5:	83 c4 10             	add    $0x10,%esp
+    17b8:	85 c0                	test   %eax,%eax
+    17ba:	0f 89 8e 00 00 00    	jns    184e <linktest+0x19e>
+  unlink("lf2");
+    17c0:	83 ec 0c             	sub    $0xc,%esp
+    17c3:	68 a7 47 00 00       	push   $0x47a7
+    17c8:	e8 c6 22 00 00       	call   3a93 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    17cd:	59                   	pop    %ecx
+    17ce:	5b                   	pop    %ebx
+    17cf:	68 a3 47 00 00       	push   $0x47a3
+    17d4:	68 a7 47 00 00       	push   $0x47a7
+    17d9:	e8 c5 22 00 00       	call   3aa3 <link>
+    17de:	83 c4 10             	add    $0x10,%esp
+    17e1:	85 c0                	test   %eax,%eax
+    17e3:	79 56                	jns    183b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    17e5:	83 ec 08             	sub    $0x8,%esp
+    17e8:	68 a3 47 00 00       	push   $0x47a3
+    17ed:	68 6b 4a 00 00       	push   $0x4a6b
+    17f2:	e8 ac 22 00 00       	call   3aa3 <link>
+    17f7:	83 c4 10             	add    $0x10,%esp
+    17fa:	85 c0                	test   %eax,%eax
+    17fc:	79 2a                	jns    1828 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    17fe:	83 ec 08             	sub    $0x8,%esp
+    1801:	68 41 48 00 00       	push   $0x4841
+    1806:	6a 01                	push   $0x1
+    1808:	e8 33 24 00 00       	call   3c40 <printf>
+}
+    180d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1810:	83 c4 10             	add    $0x10,%esp
+    1813:	c9                   	leave
+    1814:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1815:	50                   	push   %eax
+    1816:	50                   	push   %eax
+    1817:	68 ab 47 00 00       	push   $0x47ab
+    181c:	6a 01                	push   $0x1
+    181e:	e8 1d 24 00 00       	call   3c40 <printf>
+    exit();
+    1823:	e8 1b 22 00 00       	call   3a43 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1828:	50                   	push   %eax
+    1829:	50                   	push   %eax
+    182a:	68 25 48 00 00       	push   $0x4825
+    182f:	6a 01                	push   $0x1
+    1831:	e8 0a 24 00 00       	call   3c40 <printf>
+    exit();
+    1836:	e8 08 22 00 00       	call   3a43 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    183b:	52                   	push   %edx
+    183c:	52                   	push   %edx
+    183d:	68 d8 53 00 00       	push   $0x53d8
+    1842:	6a 01                	push   $0x1
+    1844:	e8 f7 23 00 00       	call   3c40 <printf>
+    exit();
+    1849:	e8 f5 21 00 00       	call   3a43 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    184e:	50                   	push   %eax
+    184f:	50                   	push   %eax
+    1850:	68 07 48 00 00       	push   $0x4807
+    1855:	6a 01                	push   $0x1
+    1857:	e8 e4 23 00 00       	call   3c40 <printf>
+    exit();
+    185c:	e8 e2 21 00 00       	call   3a43 <exit>
+    printf(1, "read lf2 failed\n");
+    1861:	51                   	push   %ecx
+    1862:	51                   	push   %ecx
+    1863:	68 f6 47 00 00       	push   $0x47f6
+    1868:	6a 01                	push   $0x1
+    186a:	e8 d1 23 00 00       	call   3c40 <printf>
+    exit();
+    186f:	e8 cf 21 00 00       	call   3a43 <exit>
+    printf(1, "open lf2 failed\n");
+    1874:	53                   	push   %ebx
+    1875:	53                   	push   %ebx
+    1876:	68 e5 47 00 00       	push   $0x47e5
+    187b:	6a 01                	push   $0x1
+    187d:	e8 be 23 00 00       	call   3c40 <printf>
+    exit();
+    1882:	e8 bc 21 00 00       	call   3a43 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1887:	50                   	push   %eax
+    1888:	50                   	push   %eax
+    1889:	68 b0 53 00 00       	push   $0x53b0
+    188e:	6a 01                	push   $0x1
+    1890:	e8 ab 23 00 00       	call   3c40 <printf>
+    exit();
+    1895:	e8 a9 21 00 00       	call   3a43 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    189a:	51                   	push   %ecx
+    189b:	51                   	push   %ecx
+    189c:	68 d0 47 00 00       	push   $0x47d0
+    18a1:	6a 01                	push   $0x1
+    18a3:	e8 98 23 00 00       	call   3c40 <printf>
+    exit();
+    18a8:	e8 96 21 00 00       	call   3a43 <exit>
+    printf(1, "write lf1 failed\n");
+    18ad:	50                   	push   %eax
+    18ae:	50                   	push   %eax
+    18af:	68 be 47 00 00       	push   $0x47be
+    18b4:	6a 01                	push   $0x1
+    18b6:	e8 85 23 00 00       	call   3c40 <printf>
+    exit();
+    18bb:	e8 83 21 00 00       	call   3a43 <exit>
+
+000018c0 <concreate>:
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	57                   	push   %edi
+    18c4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    18c5:	31 f6                	xor    %esi,%esi
+{
+    18c7:	53                   	push   %ebx
+    18c8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    18cb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    18ce:	68 4e 48 00 00       	push   $0x484e
+    18d3:	6a 01                	push   $0x1
+    18d5:	e8 66 23 00 00       	call   3c40 <printf>
+  file[0] = 'C';
+    18da:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    18de:	83 c4 10             	add    $0x10,%esp
+    18e1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    18e5:	eb 4c                	jmp    1933 <concreate+0x73>
+    18e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ee:	66 90                	xchg   %ax,%ax
+    18f0:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    18f6:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    18fb:	0f 83 8f 00 00 00    	jae    1990 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1901:	83 ec 08             	sub    $0x8,%esp
+    1904:	68 02 02 00 00       	push   $0x202
+    1909:	53                   	push   %ebx
+    190a:	e8 74 21 00 00       	call   3a83 <open>
+      if(fd < 0){
+    190f:	83 c4 10             	add    $0x10,%esp
+    1912:	85 c0                	test   %eax,%eax
+    1914:	78 63                	js     1979 <concreate+0xb9>
+      close(fd);
+    1916:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1919:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    191c:	50                   	push   %eax
+    191d:	e8 49 21 00 00       	call   3a6b <close>
+    1922:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1925:	e8 21 21 00 00       	call   3a4b <wait>
+  for(i = 0; i < 40; i++){
+    192a:	83 fe 28             	cmp    $0x28,%esi
+    192d:	0f 84 7f 00 00 00    	je     19b2 <concreate+0xf2>
+    unlink(file);
+    1933:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1936:	8d 46 30             	lea    0x30(%esi),%eax
+    1939:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    193c:	53                   	push   %ebx
+    193d:	e8 51 21 00 00       	call   3a93 <unlink>
+    pid = fork();
+    1942:	e8 f4 20 00 00       	call   3a3b <fork>
+    if(pid && (i % 3) == 1){
+    1947:	83 c4 10             	add    $0x10,%esp
+    194a:	85 c0                	test   %eax,%eax
+    194c:	75 a2                	jne    18f0 <concreate+0x30>
+      link("C0", file);
+    194e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1954:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    195a:	0f 83 d0 00 00 00    	jae    1a30 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1960:	83 ec 08             	sub    $0x8,%esp
+    1963:	68 02 02 00 00       	push   $0x202
+    1968:	53                   	push   %ebx
+    1969:	e8 15 21 00 00       	call   3a83 <open>
+      if(fd < 0){
+    196e:	83 c4 10             	add    $0x10,%esp
+    1971:	85 c0                	test   %eax,%eax
+    1973:	0f 89 ea 01 00 00    	jns    1b63 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1979:	83 ec 04             	sub    $0x4,%esp
+    197c:	53                   	push   %ebx
+    197d:	68 61 48 00 00       	push   $0x4861
+    1982:	6a 01                	push   $0x1
+    1984:	e8 b7 22 00 00       	call   3c40 <printf>
+        exit();
+    1989:	e8 b5 20 00 00       	call   3a43 <exit>
+    198e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1990:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1993:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1996:	53                   	push   %ebx
+    1997:	68 5e 48 00 00       	push   $0x485e
+    199c:	e8 02 21 00 00       	call   3aa3 <link>
+    19a1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    19a4:	e8 a2 20 00 00       	call   3a4b <wait>
+  for(i = 0; i < 40; i++){
+    19a9:	83 fe 28             	cmp    $0x28,%esi
+    19ac:	0f 85 81 ff ff ff    	jne    1933 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    19b2:	83 ec 04             	sub    $0x4,%esp
+    19b5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    19b8:	6a 28                	push   $0x28
+    19ba:	6a 00                	push   $0x0
+    19bc:	50                   	push   %eax
+    19bd:	e8 5e 1e 00 00       	call   3820 <memset>
+  fd = open(".", 0);
+    19c2:	5e                   	pop    %esi
+    19c3:	5f                   	pop    %edi
+    19c4:	6a 00                	push   $0x0
+    19c6:	68 6b 4a 00 00       	push   $0x4a6b
+    19cb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    19ce:	e8 b0 20 00 00       	call   3a83 <open>
+  n = 0;
+    19d3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    19da:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    19dd:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    19df:	90                   	nop
+    19e0:	83 ec 04             	sub    $0x4,%esp
+    19e3:	6a 10                	push   $0x10
+    19e5:	57                   	push   %edi
+    19e6:	56                   	push   %esi
+    19e7:	e8 6f 20 00 00       	call   3a5b <read>
+    19ec:	83 c4 10             	add    $0x10,%esp
+    19ef:	85 c0                	test   %eax,%eax
+    19f1:	7e 5d                	jle    1a50 <concreate+0x190>
+    if(de.inum == 0)
+    19f3:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    19f8:	74 e6                	je     19e0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    19fa:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    19fe:	75 e0                	jne    19e0 <concreate+0x120>
+    1a00:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1a04:	75 da                	jne    19e0 <concreate+0x120>
+      i = de.name[1] - '0';
+    1a06:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1a0a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1a0d:	83 f8 27             	cmp    $0x27,%eax
+    1a10:	0f 87 5e 01 00 00    	ja     1b74 <concreate+0x2b4>
+      if(fa[i]){
+    1a16:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1a1b:	0f 85 7e 01 00 00    	jne    1b9f <concreate+0x2df>
+      n++;
+    1a21:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1a25:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1a2a:	eb b4                	jmp    19e0 <concreate+0x120>
+    1a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1a30:	83 ec 08             	sub    $0x8,%esp
+    1a33:	53                   	push   %ebx
+    1a34:	68 5e 48 00 00       	push   $0x485e
+    1a39:	e8 65 20 00 00       	call   3aa3 <link>
+    1a3e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1a41:	e8 fd 1f 00 00       	call   3a43 <exit>
+    1a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a4d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1a50:	83 ec 0c             	sub    $0xc,%esp
+    1a53:	56                   	push   %esi
+    1a54:	e8 12 20 00 00       	call   3a6b <close>
+  if(n != 40){
+    1a59:	83 c4 10             	add    $0x10,%esp
+    1a5c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1a60:	0f 85 26 01 00 00    	jne    1b8c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1a66:	31 f6                	xor    %esi,%esi
+    1a68:	eb 48                	jmp    1ab2 <concreate+0x1f2>
+    1a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1a70:	85 ff                	test   %edi,%edi
+    1a72:	74 05                	je     1a79 <concreate+0x1b9>
+    1a74:	83 f8 01             	cmp    $0x1,%eax
+    1a77:	74 68                	je     1ae1 <concreate+0x221>
+      unlink(file);
+    1a79:	83 ec 0c             	sub    $0xc,%esp
+    1a7c:	53                   	push   %ebx
+    1a7d:	e8 11 20 00 00       	call   3a93 <unlink>
+      unlink(file);
+    1a82:	89 1c 24             	mov    %ebx,(%esp)
+    1a85:	e8 09 20 00 00       	call   3a93 <unlink>
+      unlink(file);
+    1a8a:	89 1c 24             	mov    %ebx,(%esp)
+    1a8d:	e8 01 20 00 00       	call   3a93 <unlink>
+      unlink(file);
+    1a92:	89 1c 24             	mov    %ebx,(%esp)
+    1a95:	e8 f9 1f 00 00       	call   3a93 <unlink>
+    1a9a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1a9d:	85 ff                	test   %edi,%edi
+    1a9f:	74 a0                	je     1a41 <concreate+0x181>
+      wait();
+    1aa1:	e8 a5 1f 00 00       	call   3a4b <wait>
+  for(i = 0; i < 40; i++){
+    1aa6:	83 c6 01             	add    $0x1,%esi
+    1aa9:	83 fe 28             	cmp    $0x28,%esi
+    1aac:	0f 84 86 00 00 00    	je     1b38 <concreate+0x278>
+    file[1] = '0' + i;
+    1ab2:	8d 46 30             	lea    0x30(%esi),%eax
+    1ab5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1ab8:	e8 7e 1f 00 00       	call   3a3b <fork>
+    1abd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1abf:	85 c0                	test   %eax,%eax
+    1ac1:	0f 88 88 00 00 00    	js     1b4f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1ac7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1acc:	f7 e6                	mul    %esi
+    1ace:	89 d0                	mov    %edx,%eax
+    1ad0:	83 e2 fe             	and    $0xfffffffe,%edx
+    1ad3:	d1 e8                	shr    %eax
+    1ad5:	01 c2                	add    %eax,%edx
+    1ad7:	89 f0                	mov    %esi,%eax
+    1ad9:	29 d0                	sub    %edx,%eax
+    1adb:	89 c1                	mov    %eax,%ecx
+    1add:	09 f9                	or     %edi,%ecx
+    1adf:	75 8f                	jne    1a70 <concreate+0x1b0>
+      close(open(file, 0));
+    1ae1:	83 ec 08             	sub    $0x8,%esp
+    1ae4:	6a 00                	push   $0x0
+    1ae6:	53                   	push   %ebx
+    1ae7:	e8 97 1f 00 00       	call   3a83 <open>
+    1aec:	89 04 24             	mov    %eax,(%esp)
+    1aef:	e8 77 1f 00 00       	call   3a6b <close>
+      close(open(file, 0));
+    1af4:	58                   	pop    %eax
+    1af5:	5a                   	pop    %edx
+    1af6:	6a 00                	push   $0x0
+    1af8:	53                   	push   %ebx
+    1af9:	e8 85 1f 00 00       	call   3a83 <open>
+    1afe:	89 04 24             	mov    %eax,(%esp)
+    1b01:	e8 65 1f 00 00       	call   3a6b <close>
+      close(open(file, 0));
+    1b06:	59                   	pop    %ecx
+    1b07:	58                   	pop    %eax
+    1b08:	6a 00                	push   $0x0
+    1b0a:	53                   	push   %ebx
+    1b0b:	e8 73 1f 00 00       	call   3a83 <open>
+    1b10:	89 04 24             	mov    %eax,(%esp)
+    1b13:	e8 53 1f 00 00       	call   3a6b <close>
+      close(open(file, 0));
+    1b18:	58                   	pop    %eax
+    1b19:	5a                   	pop    %edx
+    1b1a:	6a 00                	push   $0x0
+    1b1c:	53                   	push   %ebx
+    1b1d:	e8 61 1f 00 00       	call   3a83 <open>
+    1b22:	89 04 24             	mov    %eax,(%esp)
+    1b25:	e8 41 1f 00 00       	call   3a6b <close>
+    1b2a:	83 c4 10             	add    $0x10,%esp
+    1b2d:	e9 6b ff ff ff       	jmp    1a9d <concreate+0x1dd>
+    1b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1b38:	83 ec 08             	sub    $0x8,%esp
+    1b3b:	68 b3 48 00 00       	push   $0x48b3
+    1b40:	6a 01                	push   $0x1
+    1b42:	e8 f9 20 00 00       	call   3c40 <printf>
+}
+    1b47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b4a:	5b                   	pop    %ebx
+    1b4b:	5e                   	pop    %esi
+    1b4c:	5f                   	pop    %edi
+    1b4d:	5d                   	pop    %ebp
+    1b4e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1b4f:	83 ec 08             	sub    $0x8,%esp
+    1b52:	68 36 51 00 00       	push   $0x5136
+    1b57:	6a 01                	push   $0x1
+    1b59:	e8 e2 20 00 00       	call   3c40 <printf>
+      exit();
+    1b5e:	e8 e0 1e 00 00       	call   3a43 <exit>
+      close(fd);
+    1b63:	83 ec 0c             	sub    $0xc,%esp
+    1b66:	50                   	push   %eax
+    1b67:	e8 ff 1e 00 00       	call   3a6b <close>
+    1b6c:	83 c4 10             	add    $0x10,%esp
+    1b6f:	e9 cd fe ff ff       	jmp    1a41 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1b74:	83 ec 04             	sub    $0x4,%esp
+    1b77:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1b7a:	50                   	push   %eax
+    1b7b:	68 7d 48 00 00       	push   $0x487d
+    1b80:	6a 01                	push   $0x1
+    1b82:	e8 b9 20 00 00       	call   3c40 <printf>
+        exit();
+    1b87:	e8 b7 1e 00 00       	call   3a43 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1b8c:	51                   	push   %ecx
+    1b8d:	51                   	push   %ecx
+    1b8e:	68 fc 53 00 00       	push   $0x53fc
+    1b93:	6a 01                	push   $0x1
+    1b95:	e8 a6 20 00 00       	call   3c40 <printf>
+    exit();
+    1b9a:	e8 a4 1e 00 00       	call   3a43 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1b9f:	83 ec 04             	sub    $0x4,%esp
+    1ba2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1ba5:	50                   	push   %eax
+    1ba6:	68 96 48 00 00       	push   $0x4896
+    1bab:	6a 01                	push   $0x1
+    1bad:	e8 8e 20 00 00       	call   3c40 <printf>
+        exit();
+    1bb2:	e8 8c 1e 00 00       	call   3a43 <exit>
+    1bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bbe:	66 90                	xchg   %ax,%ax
+
+00001bc0 <linkunlink>:
+{
+    1bc0:	55                   	push   %ebp
+    1bc1:	89 e5                	mov    %esp,%ebp
+    1bc3:	57                   	push   %edi
+    1bc4:	56                   	push   %esi
+    1bc5:	53                   	push   %ebx
+    1bc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1bc9:	68 c1 48 00 00       	push   $0x48c1
+    1bce:	6a 01                	push   $0x1
+    1bd0:	e8 6b 20 00 00       	call   3c40 <printf>
+  unlink("x");
+    1bd5:	c7 04 24 4e 4b 00 00 	movl   $0x4b4e,(%esp)
+    1bdc:	e8 b2 1e 00 00       	call   3a93 <unlink>
+  pid = fork();
+    1be1:	e8 55 1e 00 00       	call   3a3b <fork>
+  if(pid < 0){
+    1be6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1be9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1bec:	85 c0                	test   %eax,%eax
+    1bee:	0f 88 b6 00 00 00    	js     1caa <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1bf4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1bf8:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1bfd:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1c02:	19 ff                	sbb    %edi,%edi
+    1c04:	83 e7 60             	and    $0x60,%edi
+    1c07:	83 c7 01             	add    $0x1,%edi
+    1c0a:	eb 1e                	jmp    1c2a <linkunlink+0x6a>
+    1c0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1c10:	83 f8 01             	cmp    $0x1,%eax
+    1c13:	74 7b                	je     1c90 <linkunlink+0xd0>
+      unlink("x");
+    1c15:	83 ec 0c             	sub    $0xc,%esp
+    1c18:	68 4e 4b 00 00       	push   $0x4b4e
+    1c1d:	e8 71 1e 00 00       	call   3a93 <unlink>
+    1c22:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1c25:	83 eb 01             	sub    $0x1,%ebx
+    1c28:	74 41                	je     1c6b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1c2a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1c30:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1c36:	89 f8                	mov    %edi,%eax
+    1c38:	f7 e6                	mul    %esi
+    1c3a:	89 d0                	mov    %edx,%eax
+    1c3c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1c3f:	d1 e8                	shr    %eax
+    1c41:	01 c2                	add    %eax,%edx
+    1c43:	89 f8                	mov    %edi,%eax
+    1c45:	29 d0                	sub    %edx,%eax
+    1c47:	75 c7                	jne    1c10 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1c49:	83 ec 08             	sub    $0x8,%esp
+    1c4c:	68 02 02 00 00       	push   $0x202
+    1c51:	68 4e 4b 00 00       	push   $0x4b4e
+    1c56:	e8 28 1e 00 00       	call   3a83 <open>
+    1c5b:	89 04 24             	mov    %eax,(%esp)
+    1c5e:	e8 08 1e 00 00       	call   3a6b <close>
+    1c63:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1c66:	83 eb 01             	sub    $0x1,%ebx
+    1c69:	75 bf                	jne    1c2a <linkunlink+0x6a>
+  if(pid)
+    1c6b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c6e:	85 c0                	test   %eax,%eax
+    1c70:	74 4b                	je     1cbd <linkunlink+0xfd>
+    wait();
+    1c72:	e8 d4 1d 00 00       	call   3a4b <wait>
+  printf(1, "linkunlink ok\n");
+    1c77:	83 ec 08             	sub    $0x8,%esp
+    1c7a:	68 d6 48 00 00       	push   $0x48d6
+    1c7f:	6a 01                	push   $0x1
+    1c81:	e8 ba 1f 00 00       	call   3c40 <printf>
+}
+    1c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c89:	5b                   	pop    %ebx
+    1c8a:	5e                   	pop    %esi
+    1c8b:	5f                   	pop    %edi
+    1c8c:	5d                   	pop    %ebp
+    1c8d:	c3                   	ret
+    1c8e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1c90:	83 ec 08             	sub    $0x8,%esp
+    1c93:	68 4e 4b 00 00       	push   $0x4b4e
+    1c98:	68 d2 48 00 00       	push   $0x48d2
+    1c9d:	e8 01 1e 00 00       	call   3aa3 <link>
+    1ca2:	83 c4 10             	add    $0x10,%esp
+    1ca5:	e9 7b ff ff ff       	jmp    1c25 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1caa:	52                   	push   %edx
+    1cab:	52                   	push   %edx
+    1cac:	68 36 51 00 00       	push   $0x5136
+    1cb1:	6a 01                	push   $0x1
+    1cb3:	e8 88 1f 00 00       	call   3c40 <printf>
+    exit();
+    1cb8:	e8 86 1d 00 00       	call   3a43 <exit>
+    exit();
+    1cbd:	e8 81 1d 00 00       	call   3a43 <exit>
+    1cc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cd0 <bigdir>:
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	57                   	push   %edi
+    1cd4:	56                   	push   %esi
+    1cd5:	53                   	push   %ebx
+    1cd6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1cd9:	68 e5 48 00 00       	push   $0x48e5
+    1cde:	6a 01                	push   $0x1
+    1ce0:	e8 5b 1f 00 00       	call   3c40 <printf>
+  unlink("bd");
+    1ce5:	c7 04 24 f2 48 00 00 	movl   $0x48f2,(%esp)
+    1cec:	e8 a2 1d 00 00       	call   3a93 <unlink>
+  fd = open("bd", O_CREATE);
+    1cf1:	5a                   	pop    %edx
+    1cf2:	59                   	pop    %ecx
+    1cf3:	68 00 02 00 00       	push   $0x200
+    1cf8:	68 f2 48 00 00       	push   $0x48f2
+    1cfd:	e8 81 1d 00 00       	call   3a83 <open>
+  if(fd < 0){
+    1d02:	83 c4 10             	add    $0x10,%esp
+    1d05:	85 c0                	test   %eax,%eax
+    1d07:	0f 88 de 00 00 00    	js     1deb <bigdir+0x11b>
+  close(fd);
+    1d0d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1d10:	31 f6                	xor    %esi,%esi
+    1d12:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1d15:	50                   	push   %eax
+    1d16:	e8 50 1d 00 00       	call   3a6b <close>
+    1d1b:	83 c4 10             	add    $0x10,%esp
+    1d1e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1d20:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1d22:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1d25:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1d29:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1d2c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1d30:	83 c0 30             	add    $0x30,%eax
+    1d33:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1d36:	89 f0                	mov    %esi,%eax
+    1d38:	83 e0 3f             	and    $0x3f,%eax
+    1d3b:	83 c0 30             	add    $0x30,%eax
+    1d3e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1d41:	57                   	push   %edi
+    1d42:	68 f2 48 00 00       	push   $0x48f2
+    1d47:	e8 57 1d 00 00       	call   3aa3 <link>
+    1d4c:	83 c4 10             	add    $0x10,%esp
+    1d4f:	89 c3                	mov    %eax,%ebx
+    1d51:	85 c0                	test   %eax,%eax
+    1d53:	75 6e                	jne    1dc3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1d55:	83 c6 01             	add    $0x1,%esi
+    1d58:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1d5e:	75 c0                	jne    1d20 <bigdir+0x50>
+  unlink("bd");
+    1d60:	83 ec 0c             	sub    $0xc,%esp
+    1d63:	68 f2 48 00 00       	push   $0x48f2
+    1d68:	e8 26 1d 00 00       	call   3a93 <unlink>
+    1d6d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1d70:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1d72:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1d75:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1d79:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1d7c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1d80:	83 c0 30             	add    $0x30,%eax
+    1d83:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1d86:	89 d8                	mov    %ebx,%eax
+    1d88:	83 e0 3f             	and    $0x3f,%eax
+    1d8b:	83 c0 30             	add    $0x30,%eax
+    1d8e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1d91:	57                   	push   %edi
+    1d92:	e8 fc 1c 00 00       	call   3a93 <unlink>
+    1d97:	83 c4 10             	add    $0x10,%esp
+    1d9a:	85 c0                	test   %eax,%eax
+    1d9c:	75 39                	jne    1dd7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1d9e:	83 c3 01             	add    $0x1,%ebx
+    1da1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1da7:	75 c7                	jne    1d70 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1da9:	83 ec 08             	sub    $0x8,%esp
+    1dac:	68 34 49 00 00       	push   $0x4934
+    1db1:	6a 01                	push   $0x1
+    1db3:	e8 88 1e 00 00       	call   3c40 <printf>
+    1db8:	83 c4 10             	add    $0x10,%esp
+}
+    1dbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1dbe:	5b                   	pop    %ebx
+    1dbf:	5e                   	pop    %esi
+    1dc0:	5f                   	pop    %edi
+    1dc1:	5d                   	pop    %ebp
+    1dc2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1dc3:	83 ec 08             	sub    $0x8,%esp
+    1dc6:	68 0b 49 00 00       	push   $0x490b
+    1dcb:	6a 01                	push   $0x1
+    1dcd:	e8 6e 1e 00 00       	call   3c40 <printf>
+      exit();
+    1dd2:	e8 6c 1c 00 00       	call   3a43 <exit>
+      printf(1, "bigdir unlink failed");
+    1dd7:	83 ec 08             	sub    $0x8,%esp
+    1dda:	68 1f 49 00 00       	push   $0x491f
+    1ddf:	6a 01                	push   $0x1
+    1de1:	e8 5a 1e 00 00       	call   3c40 <printf>
+      exit();
+    1de6:	e8 58 1c 00 00       	call   3a43 <exit>
+    printf(1, "bigdir create failed\n");
+    1deb:	50                   	push   %eax
+    1dec:	50                   	push   %eax
+    1ded:	68 f5 48 00 00       	push   $0x48f5
+    1df2:	6a 01                	push   $0x1
+    1df4:	e8 47 1e 00 00       	call   3c40 <printf>
+    exit();
+    1df9:	e8 45 1c 00 00       	call   3a43 <exit>
+    1dfe:	66 90                	xchg   %ax,%ax
+
+00001e00 <subdir>:
+{
+    1e00:	55                   	push   %ebp
+    1e01:	89 e5                	mov    %esp,%ebp
+    1e03:	53                   	push   %ebx
+    1e04:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1e07:	68 3f 49 00 00       	push   $0x493f
+    1e0c:	6a 01                	push   $0x1
+    1e0e:	e8 2d 1e 00 00       	call   3c40 <printf>
+  unlink("ff");
+    1e13:	c7 04 24 c8 49 00 00 	movl   $0x49c8,(%esp)
+    1e1a:	e8 74 1c 00 00       	call   3a93 <unlink>
+  if(mkdir("dd") != 0){
+    1e1f:	c7 04 24 65 4a 00 00 	movl   $0x4a65,(%esp)
+    1e26:	e8 80 1c 00 00       	call   3aab <mkdir>
+    1e2b:	83 c4 10             	add    $0x10,%esp
+    1e2e:	85 c0                	test   %eax,%eax
+    1e30:	0f 85 b3 05 00 00    	jne    23e9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1e36:	83 ec 08             	sub    $0x8,%esp
+    1e39:	68 02 02 00 00       	push   $0x202
+    1e3e:	68 9e 49 00 00       	push   $0x499e
+    1e43:	e8 3b 1c 00 00       	call   3a83 <open>
+  if(fd < 0){
+    1e48:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1e4b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e4d:	85 c0                	test   %eax,%eax
+    1e4f:	0f 88 81 05 00 00    	js     23d6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1e55:	83 ec 04             	sub    $0x4,%esp
+    1e58:	6a 02                	push   $0x2
+    1e5a:	68 c8 49 00 00       	push   $0x49c8
+    1e5f:	50                   	push   %eax
+    1e60:	e8 fe 1b 00 00       	call   3a63 <write>
+  close(fd);
+    1e65:	89 1c 24             	mov    %ebx,(%esp)
+    1e68:	e8 fe 1b 00 00       	call   3a6b <close>
+  if(unlink("dd") >= 0){
+    1e6d:	c7 04 24 65 4a 00 00 	movl   $0x4a65,(%esp)
+    1e74:	e8 1a 1c 00 00       	call   3a93 <unlink>
+    1e79:	83 c4 10             	add    $0x10,%esp
+    1e7c:	85 c0                	test   %eax,%eax
+    1e7e:	0f 89 3f 05 00 00    	jns    23c3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1e84:	83 ec 0c             	sub    $0xc,%esp
+    1e87:	68 79 49 00 00       	push   $0x4979
+    1e8c:	e8 1a 1c 00 00       	call   3aab <mkdir>
+    1e91:	83 c4 10             	add    $0x10,%esp
+    1e94:	85 c0                	test   %eax,%eax
+    1e96:	0f 85 14 05 00 00    	jne    23b0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1e9c:	83 ec 08             	sub    $0x8,%esp
+    1e9f:	68 02 02 00 00       	push   $0x202
+    1ea4:	68 9b 49 00 00       	push   $0x499b
+    1ea9:	e8 d5 1b 00 00       	call   3a83 <open>
+  if(fd < 0){
+    1eae:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1eb1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1eb3:	85 c0                	test   %eax,%eax
+    1eb5:	0f 88 24 04 00 00    	js     22df <subdir+0x4df>
+  write(fd, "FF", 2);
+    1ebb:	83 ec 04             	sub    $0x4,%esp
+    1ebe:	6a 02                	push   $0x2
+    1ec0:	68 bc 49 00 00       	push   $0x49bc
+    1ec5:	50                   	push   %eax
+    1ec6:	e8 98 1b 00 00       	call   3a63 <write>
+  close(fd);
+    1ecb:	89 1c 24             	mov    %ebx,(%esp)
+    1ece:	e8 98 1b 00 00       	call   3a6b <close>
+  fd = open("dd/dd/../ff", 0);
+    1ed3:	58                   	pop    %eax
+    1ed4:	5a                   	pop    %edx
+    1ed5:	6a 00                	push   $0x0
+    1ed7:	68 bf 49 00 00       	push   $0x49bf
+    1edc:	e8 a2 1b 00 00       	call   3a83 <open>
+  if(fd < 0){
+    1ee1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1ee4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ee6:	85 c0                	test   %eax,%eax
+    1ee8:	0f 88 de 03 00 00    	js     22cc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1eee:	83 ec 04             	sub    $0x4,%esp
+    1ef1:	68 00 20 00 00       	push   $0x2000
+    1ef6:	68 60 8b 00 00       	push   $0x8b60
+    1efb:	50                   	push   %eax
+    1efc:	e8 5a 1b 00 00       	call   3a5b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1f01:	83 c4 10             	add    $0x10,%esp
+    1f04:	83 f8 02             	cmp    $0x2,%eax
+    1f07:	0f 85 3a 03 00 00    	jne    2247 <subdir+0x447>
+    1f0d:	80 3d 60 8b 00 00 66 	cmpb   $0x66,0x8b60
+    1f14:	0f 85 2d 03 00 00    	jne    2247 <subdir+0x447>
+  close(fd);
+    1f1a:	83 ec 0c             	sub    $0xc,%esp
+    1f1d:	53                   	push   %ebx
+    1f1e:	e8 48 1b 00 00       	call   3a6b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1f23:	59                   	pop    %ecx
+    1f24:	5b                   	pop    %ebx
+    1f25:	68 ff 49 00 00       	push   $0x49ff
+    1f2a:	68 9b 49 00 00       	push   $0x499b
+    1f2f:	e8 6f 1b 00 00       	call   3aa3 <link>
+    1f34:	83 c4 10             	add    $0x10,%esp
+    1f37:	85 c0                	test   %eax,%eax
+    1f39:	0f 85 c6 03 00 00    	jne    2305 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1f3f:	83 ec 0c             	sub    $0xc,%esp
+    1f42:	68 9b 49 00 00       	push   $0x499b
+    1f47:	e8 47 1b 00 00       	call   3a93 <unlink>
+    1f4c:	83 c4 10             	add    $0x10,%esp
+    1f4f:	85 c0                	test   %eax,%eax
+    1f51:	0f 85 16 03 00 00    	jne    226d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1f57:	83 ec 08             	sub    $0x8,%esp
+    1f5a:	6a 00                	push   $0x0
+    1f5c:	68 9b 49 00 00       	push   $0x499b
+    1f61:	e8 1d 1b 00 00       	call   3a83 <open>
+    1f66:	83 c4 10             	add    $0x10,%esp
+    1f69:	85 c0                	test   %eax,%eax
+    1f6b:	0f 89 2c 04 00 00    	jns    239d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1f71:	83 ec 0c             	sub    $0xc,%esp
+    1f74:	68 65 4a 00 00       	push   $0x4a65
+    1f79:	e8 35 1b 00 00       	call   3ab3 <chdir>
+    1f7e:	83 c4 10             	add    $0x10,%esp
+    1f81:	85 c0                	test   %eax,%eax
+    1f83:	0f 85 01 04 00 00    	jne    238a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1f89:	83 ec 0c             	sub    $0xc,%esp
+    1f8c:	68 33 4a 00 00       	push   $0x4a33
+    1f91:	e8 1d 1b 00 00       	call   3ab3 <chdir>
+    1f96:	83 c4 10             	add    $0x10,%esp
+    1f99:	85 c0                	test   %eax,%eax
+    1f9b:	0f 85 b9 02 00 00    	jne    225a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1fa1:	83 ec 0c             	sub    $0xc,%esp
+    1fa4:	68 59 4a 00 00       	push   $0x4a59
+    1fa9:	e8 05 1b 00 00       	call   3ab3 <chdir>
+    1fae:	83 c4 10             	add    $0x10,%esp
+    1fb1:	85 c0                	test   %eax,%eax
+    1fb3:	0f 85 a1 02 00 00    	jne    225a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1fb9:	83 ec 0c             	sub    $0xc,%esp
+    1fbc:	68 68 4a 00 00       	push   $0x4a68
+    1fc1:	e8 ed 1a 00 00       	call   3ab3 <chdir>
+    1fc6:	83 c4 10             	add    $0x10,%esp
+    1fc9:	85 c0                	test   %eax,%eax
+    1fcb:	0f 85 21 03 00 00    	jne    22f2 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1fd1:	83 ec 08             	sub    $0x8,%esp
+    1fd4:	6a 00                	push   $0x0
+    1fd6:	68 ff 49 00 00       	push   $0x49ff
+    1fdb:	e8 a3 1a 00 00       	call   3a83 <open>
+  if(fd < 0){
+    1fe0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1fe3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1fe5:	85 c0                	test   %eax,%eax
+    1fe7:	0f 88 e0 04 00 00    	js     24cd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1fed:	83 ec 04             	sub    $0x4,%esp
+    1ff0:	68 00 20 00 00       	push   $0x2000
+    1ff5:	68 60 8b 00 00       	push   $0x8b60
+    1ffa:	50                   	push   %eax
+    1ffb:	e8 5b 1a 00 00       	call   3a5b <read>
+    2000:	83 c4 10             	add    $0x10,%esp
+    2003:	83 f8 02             	cmp    $0x2,%eax
+    2006:	0f 85 ae 04 00 00    	jne    24ba <subdir+0x6ba>
+  close(fd);
+    200c:	83 ec 0c             	sub    $0xc,%esp
+    200f:	53                   	push   %ebx
+    2010:	e8 56 1a 00 00       	call   3a6b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2015:	58                   	pop    %eax
+    2016:	5a                   	pop    %edx
+    2017:	6a 00                	push   $0x0
+    2019:	68 9b 49 00 00       	push   $0x499b
+    201e:	e8 60 1a 00 00       	call   3a83 <open>
+    2023:	83 c4 10             	add    $0x10,%esp
+    2026:	85 c0                	test   %eax,%eax
+    2028:	0f 89 65 02 00 00    	jns    2293 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    202e:	83 ec 08             	sub    $0x8,%esp
+    2031:	68 02 02 00 00       	push   $0x202
+    2036:	68 b3 4a 00 00       	push   $0x4ab3
+    203b:	e8 43 1a 00 00       	call   3a83 <open>
+    2040:	83 c4 10             	add    $0x10,%esp
+    2043:	85 c0                	test   %eax,%eax
+    2045:	0f 89 35 02 00 00    	jns    2280 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    204b:	83 ec 08             	sub    $0x8,%esp
+    204e:	68 02 02 00 00       	push   $0x202
+    2053:	68 d8 4a 00 00       	push   $0x4ad8
+    2058:	e8 26 1a 00 00       	call   3a83 <open>
+    205d:	83 c4 10             	add    $0x10,%esp
+    2060:	85 c0                	test   %eax,%eax
+    2062:	0f 89 0f 03 00 00    	jns    2377 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2068:	83 ec 08             	sub    $0x8,%esp
+    206b:	68 00 02 00 00       	push   $0x200
+    2070:	68 65 4a 00 00       	push   $0x4a65
+    2075:	e8 09 1a 00 00       	call   3a83 <open>
+    207a:	83 c4 10             	add    $0x10,%esp
+    207d:	85 c0                	test   %eax,%eax
+    207f:	0f 89 df 02 00 00    	jns    2364 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2085:	83 ec 08             	sub    $0x8,%esp
+    2088:	6a 02                	push   $0x2
+    208a:	68 65 4a 00 00       	push   $0x4a65
+    208f:	e8 ef 19 00 00       	call   3a83 <open>
+    2094:	83 c4 10             	add    $0x10,%esp
+    2097:	85 c0                	test   %eax,%eax
+    2099:	0f 89 b2 02 00 00    	jns    2351 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    209f:	83 ec 08             	sub    $0x8,%esp
+    20a2:	6a 01                	push   $0x1
+    20a4:	68 65 4a 00 00       	push   $0x4a65
+    20a9:	e8 d5 19 00 00       	call   3a83 <open>
+    20ae:	83 c4 10             	add    $0x10,%esp
+    20b1:	85 c0                	test   %eax,%eax
+    20b3:	0f 89 85 02 00 00    	jns    233e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    20b9:	83 ec 08             	sub    $0x8,%esp
+    20bc:	68 47 4b 00 00       	push   $0x4b47
+    20c1:	68 b3 4a 00 00       	push   $0x4ab3
+    20c6:	e8 d8 19 00 00       	call   3aa3 <link>
+    20cb:	83 c4 10             	add    $0x10,%esp
+    20ce:	85 c0                	test   %eax,%eax
+    20d0:	0f 84 55 02 00 00    	je     232b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    20d6:	83 ec 08             	sub    $0x8,%esp
+    20d9:	68 47 4b 00 00       	push   $0x4b47
+    20de:	68 d8 4a 00 00       	push   $0x4ad8
+    20e3:	e8 bb 19 00 00       	call   3aa3 <link>
+    20e8:	83 c4 10             	add    $0x10,%esp
+    20eb:	85 c0                	test   %eax,%eax
+    20ed:	0f 84 25 02 00 00    	je     2318 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    20f3:	83 ec 08             	sub    $0x8,%esp
+    20f6:	68 ff 49 00 00       	push   $0x49ff
+    20fb:	68 9e 49 00 00       	push   $0x499e
+    2100:	e8 9e 19 00 00       	call   3aa3 <link>
+    2105:	83 c4 10             	add    $0x10,%esp
+    2108:	85 c0                	test   %eax,%eax
+    210a:	0f 84 a9 01 00 00    	je     22b9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2110:	83 ec 0c             	sub    $0xc,%esp
+    2113:	68 b3 4a 00 00       	push   $0x4ab3
+    2118:	e8 8e 19 00 00       	call   3aab <mkdir>
+    211d:	83 c4 10             	add    $0x10,%esp
+    2120:	85 c0                	test   %eax,%eax
+    2122:	0f 84 7e 01 00 00    	je     22a6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2128:	83 ec 0c             	sub    $0xc,%esp
+    212b:	68 d8 4a 00 00       	push   $0x4ad8
+    2130:	e8 76 19 00 00       	call   3aab <mkdir>
+    2135:	83 c4 10             	add    $0x10,%esp
+    2138:	85 c0                	test   %eax,%eax
+    213a:	0f 84 67 03 00 00    	je     24a7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2140:	83 ec 0c             	sub    $0xc,%esp
+    2143:	68 ff 49 00 00       	push   $0x49ff
+    2148:	e8 5e 19 00 00       	call   3aab <mkdir>
+    214d:	83 c4 10             	add    $0x10,%esp
+    2150:	85 c0                	test   %eax,%eax
+    2152:	0f 84 3c 03 00 00    	je     2494 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2158:	83 ec 0c             	sub    $0xc,%esp
+    215b:	68 d8 4a 00 00       	push   $0x4ad8
+    2160:	e8 2e 19 00 00       	call   3a93 <unlink>
+    2165:	83 c4 10             	add    $0x10,%esp
+    2168:	85 c0                	test   %eax,%eax
+    216a:	0f 84 11 03 00 00    	je     2481 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2170:	83 ec 0c             	sub    $0xc,%esp
+    2173:	68 b3 4a 00 00       	push   $0x4ab3
+    2178:	e8 16 19 00 00       	call   3a93 <unlink>
+    217d:	83 c4 10             	add    $0x10,%esp
+    2180:	85 c0                	test   %eax,%eax
+    2182:	0f 84 e6 02 00 00    	je     246e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2188:	83 ec 0c             	sub    $0xc,%esp
+    218b:	68 9e 49 00 00       	push   $0x499e
+    2190:	e8 1e 19 00 00       	call   3ab3 <chdir>
+    2195:	83 c4 10             	add    $0x10,%esp
+    2198:	85 c0                	test   %eax,%eax
+    219a:	0f 84 bb 02 00 00    	je     245b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    21a0:	83 ec 0c             	sub    $0xc,%esp
+    21a3:	68 4a 4b 00 00       	push   $0x4b4a
+    21a8:	e8 06 19 00 00       	call   3ab3 <chdir>
+    21ad:	83 c4 10             	add    $0x10,%esp
+    21b0:	85 c0                	test   %eax,%eax
+    21b2:	0f 84 90 02 00 00    	je     2448 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    21b8:	83 ec 0c             	sub    $0xc,%esp
+    21bb:	68 ff 49 00 00       	push   $0x49ff
+    21c0:	e8 ce 18 00 00       	call   3a93 <unlink>
+    21c5:	83 c4 10             	add    $0x10,%esp
+    21c8:	85 c0                	test   %eax,%eax
+    21ca:	0f 85 9d 00 00 00    	jne    226d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    21d0:	83 ec 0c             	sub    $0xc,%esp
+    21d3:	68 9e 49 00 00       	push   $0x499e
+    21d8:	e8 b6 18 00 00       	call   3a93 <unlink>
+    21dd:	83 c4 10             	add    $0x10,%esp
+    21e0:	85 c0                	test   %eax,%eax
+    21e2:	0f 85 4d 02 00 00    	jne    2435 <subdir+0x635>
+  if(unlink("dd") == 0){
+    21e8:	83 ec 0c             	sub    $0xc,%esp
+    21eb:	68 65 4a 00 00       	push   $0x4a65
+    21f0:	e8 9e 18 00 00       	call   3a93 <unlink>
+    21f5:	83 c4 10             	add    $0x10,%esp
+    21f8:	85 c0                	test   %eax,%eax
+    21fa:	0f 84 22 02 00 00    	je     2422 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2200:	83 ec 0c             	sub    $0xc,%esp
+    2203:	68 7a 49 00 00       	push   $0x497a
+    2208:	e8 86 18 00 00       	call   3a93 <unlink>
+    220d:	83 c4 10             	add    $0x10,%esp
+    2210:	85 c0                	test   %eax,%eax
+    2212:	0f 88 f7 01 00 00    	js     240f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2218:	83 ec 0c             	sub    $0xc,%esp
+    221b:	68 65 4a 00 00       	push   $0x4a65
+    2220:	e8 6e 18 00 00       	call   3a93 <unlink>
+    2225:	83 c4 10             	add    $0x10,%esp
+    2228:	85 c0                	test   %eax,%eax
+    222a:	0f 88 cc 01 00 00    	js     23fc <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2230:	83 ec 08             	sub    $0x8,%esp
+    2233:	68 47 4c 00 00       	push   $0x4c47
+    2238:	6a 01                	push   $0x1
+    223a:	e8 01 1a 00 00       	call   3c40 <printf>
+}
+    223f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2242:	83 c4 10             	add    $0x10,%esp
+    2245:	c9                   	leave
+    2246:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2247:	50                   	push   %eax
+    2248:	50                   	push   %eax
+    2249:	68 e4 49 00 00       	push   $0x49e4
+    224e:	6a 01                	push   $0x1
+    2250:	e8 eb 19 00 00       	call   3c40 <printf>
+    exit();
+    2255:	e8 e9 17 00 00       	call   3a43 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    225a:	50                   	push   %eax
+    225b:	50                   	push   %eax
+    225c:	68 3f 4a 00 00       	push   $0x4a3f
+    2261:	6a 01                	push   $0x1
+    2263:	e8 d8 19 00 00       	call   3c40 <printf>
+    exit();
+    2268:	e8 d6 17 00 00       	call   3a43 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    226d:	50                   	push   %eax
+    226e:	50                   	push   %eax
+    226f:	68 0a 4a 00 00       	push   $0x4a0a
+    2274:	6a 01                	push   $0x1
+    2276:	e8 c5 19 00 00       	call   3c40 <printf>
+    exit();
+    227b:	e8 c3 17 00 00       	call   3a43 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2280:	51                   	push   %ecx
+    2281:	51                   	push   %ecx
+    2282:	68 bc 4a 00 00       	push   $0x4abc
+    2287:	6a 01                	push   $0x1
+    2289:	e8 b2 19 00 00       	call   3c40 <printf>
+    exit();
+    228e:	e8 b0 17 00 00       	call   3a43 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2293:	53                   	push   %ebx
+    2294:	53                   	push   %ebx
+    2295:	68 a0 54 00 00       	push   $0x54a0
+    229a:	6a 01                	push   $0x1
+    229c:	e8 9f 19 00 00       	call   3c40 <printf>
+    exit();
+    22a1:	e8 9d 17 00 00       	call   3a43 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    22a6:	51                   	push   %ecx
+    22a7:	51                   	push   %ecx
+    22a8:	68 50 4b 00 00       	push   $0x4b50
+    22ad:	6a 01                	push   $0x1
+    22af:	e8 8c 19 00 00       	call   3c40 <printf>
+    exit();
+    22b4:	e8 8a 17 00 00       	call   3a43 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    22b9:	53                   	push   %ebx
+    22ba:	53                   	push   %ebx
+    22bb:	68 10 55 00 00       	push   $0x5510
+    22c0:	6a 01                	push   $0x1
+    22c2:	e8 79 19 00 00       	call   3c40 <printf>
+    exit();
+    22c7:	e8 77 17 00 00       	call   3a43 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    22cc:	50                   	push   %eax
+    22cd:	50                   	push   %eax
+    22ce:	68 cb 49 00 00       	push   $0x49cb
+    22d3:	6a 01                	push   $0x1
+    22d5:	e8 66 19 00 00       	call   3c40 <printf>
+    exit();
+    22da:	e8 64 17 00 00       	call   3a43 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    22df:	51                   	push   %ecx
+    22e0:	51                   	push   %ecx
+    22e1:	68 a4 49 00 00       	push   $0x49a4
+    22e6:	6a 01                	push   $0x1
+    22e8:	e8 53 19 00 00       	call   3c40 <printf>
+    exit();
+    22ed:	e8 51 17 00 00       	call   3a43 <exit>
+    printf(1, "chdir ./.. failed\n");
+    22f2:	50                   	push   %eax
+    22f3:	50                   	push   %eax
+    22f4:	68 6d 4a 00 00       	push   $0x4a6d
+    22f9:	6a 01                	push   $0x1
+    22fb:	e8 40 19 00 00       	call   3c40 <printf>
+    exit();
+    2300:	e8 3e 17 00 00       	call   3a43 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2305:	52                   	push   %edx
+    2306:	52                   	push   %edx
+    2307:	68 58 54 00 00       	push   $0x5458
+    230c:	6a 01                	push   $0x1
+    230e:	e8 2d 19 00 00       	call   3c40 <printf>
+    exit();
+    2313:	e8 2b 17 00 00       	call   3a43 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2318:	50                   	push   %eax
+    2319:	50                   	push   %eax
+    231a:	68 ec 54 00 00       	push   $0x54ec
+    231f:	6a 01                	push   $0x1
+    2321:	e8 1a 19 00 00       	call   3c40 <printf>
+    exit();
+    2326:	e8 18 17 00 00       	call   3a43 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    232b:	50                   	push   %eax
+    232c:	50                   	push   %eax
+    232d:	68 c8 54 00 00       	push   $0x54c8
+    2332:	6a 01                	push   $0x1
+    2334:	e8 07 19 00 00       	call   3c40 <printf>
+    exit();
+    2339:	e8 05 17 00 00       	call   3a43 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    233e:	50                   	push   %eax
+    233f:	50                   	push   %eax
+    2340:	68 2c 4b 00 00       	push   $0x4b2c
+    2345:	6a 01                	push   $0x1
+    2347:	e8 f4 18 00 00       	call   3c40 <printf>
+    exit();
+    234c:	e8 f2 16 00 00       	call   3a43 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2351:	50                   	push   %eax
+    2352:	50                   	push   %eax
+    2353:	68 13 4b 00 00       	push   $0x4b13
+    2358:	6a 01                	push   $0x1
+    235a:	e8 e1 18 00 00       	call   3c40 <printf>
+    exit();
+    235f:	e8 df 16 00 00       	call   3a43 <exit>
+    printf(1, "create dd succeeded!\n");
+    2364:	50                   	push   %eax
+    2365:	50                   	push   %eax
+    2366:	68 fd 4a 00 00       	push   $0x4afd
+    236b:	6a 01                	push   $0x1
+    236d:	e8 ce 18 00 00       	call   3c40 <printf>
+    exit();
+    2372:	e8 cc 16 00 00       	call   3a43 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2377:	52                   	push   %edx
+    2378:	52                   	push   %edx
+    2379:	68 e1 4a 00 00       	push   $0x4ae1
+    237e:	6a 01                	push   $0x1
+    2380:	e8 bb 18 00 00       	call   3c40 <printf>
+    exit();
+    2385:	e8 b9 16 00 00       	call   3a43 <exit>
+    printf(1, "chdir dd failed\n");
+    238a:	50                   	push   %eax
+    238b:	50                   	push   %eax
+    238c:	68 22 4a 00 00       	push   $0x4a22
+    2391:	6a 01                	push   $0x1
+    2393:	e8 a8 18 00 00       	call   3c40 <printf>
+    exit();
+    2398:	e8 a6 16 00 00       	call   3a43 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    239d:	50                   	push   %eax
+    239e:	50                   	push   %eax
+    239f:	68 7c 54 00 00       	push   $0x547c
+    23a4:	6a 01                	push   $0x1
+    23a6:	e8 95 18 00 00       	call   3c40 <printf>
+    exit();
+    23ab:	e8 93 16 00 00       	call   3a43 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    23b0:	53                   	push   %ebx
+    23b1:	53                   	push   %ebx
+    23b2:	68 80 49 00 00       	push   $0x4980
+    23b7:	6a 01                	push   $0x1
+    23b9:	e8 82 18 00 00       	call   3c40 <printf>
+    exit();
+    23be:	e8 80 16 00 00       	call   3a43 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    23c3:	50                   	push   %eax
+    23c4:	50                   	push   %eax
+    23c5:	68 30 54 00 00       	push   $0x5430
+    23ca:	6a 01                	push   $0x1
+    23cc:	e8 6f 18 00 00       	call   3c40 <printf>
+    exit();
+    23d1:	e8 6d 16 00 00       	call   3a43 <exit>
+    printf(1, "create dd/ff failed\n");
+    23d6:	50                   	push   %eax
+    23d7:	50                   	push   %eax
+    23d8:	68 64 49 00 00       	push   $0x4964
+    23dd:	6a 01                	push   $0x1
+    23df:	e8 5c 18 00 00       	call   3c40 <printf>
+    exit();
+    23e4:	e8 5a 16 00 00       	call   3a43 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    23e9:	50                   	push   %eax
+    23ea:	50                   	push   %eax
+    23eb:	68 4c 49 00 00       	push   $0x494c
+    23f0:	6a 01                	push   $0x1
+    23f2:	e8 49 18 00 00       	call   3c40 <printf>
+    exit();
+    23f7:	e8 47 16 00 00       	call   3a43 <exit>
+    printf(1, "unlink dd failed\n");
+    23fc:	50                   	push   %eax
+    23fd:	50                   	push   %eax
+    23fe:	68 35 4c 00 00       	push   $0x4c35
+    2403:	6a 01                	push   $0x1
+    2405:	e8 36 18 00 00       	call   3c40 <printf>
+    exit();
+    240a:	e8 34 16 00 00       	call   3a43 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    240f:	52                   	push   %edx
+    2410:	52                   	push   %edx
+    2411:	68 20 4c 00 00       	push   $0x4c20
+    2416:	6a 01                	push   $0x1
+    2418:	e8 23 18 00 00       	call   3c40 <printf>
+    exit();
+    241d:	e8 21 16 00 00       	call   3a43 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2422:	51                   	push   %ecx
+    2423:	51                   	push   %ecx
+    2424:	68 34 55 00 00       	push   $0x5534
+    2429:	6a 01                	push   $0x1
+    242b:	e8 10 18 00 00       	call   3c40 <printf>
+    exit();
+    2430:	e8 0e 16 00 00       	call   3a43 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2435:	53                   	push   %ebx
+    2436:	53                   	push   %ebx
+    2437:	68 0b 4c 00 00       	push   $0x4c0b
+    243c:	6a 01                	push   $0x1
+    243e:	e8 fd 17 00 00       	call   3c40 <printf>
+    exit();
+    2443:	e8 fb 15 00 00       	call   3a43 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2448:	50                   	push   %eax
+    2449:	50                   	push   %eax
+    244a:	68 f3 4b 00 00       	push   $0x4bf3
+    244f:	6a 01                	push   $0x1
+    2451:	e8 ea 17 00 00       	call   3c40 <printf>
+    exit();
+    2456:	e8 e8 15 00 00       	call   3a43 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    245b:	50                   	push   %eax
+    245c:	50                   	push   %eax
+    245d:	68 db 4b 00 00       	push   $0x4bdb
+    2462:	6a 01                	push   $0x1
+    2464:	e8 d7 17 00 00       	call   3c40 <printf>
+    exit();
+    2469:	e8 d5 15 00 00       	call   3a43 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    246e:	50                   	push   %eax
+    246f:	50                   	push   %eax
+    2470:	68 bf 4b 00 00       	push   $0x4bbf
+    2475:	6a 01                	push   $0x1
+    2477:	e8 c4 17 00 00       	call   3c40 <printf>
+    exit();
+    247c:	e8 c2 15 00 00       	call   3a43 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2481:	50                   	push   %eax
+    2482:	50                   	push   %eax
+    2483:	68 a3 4b 00 00       	push   $0x4ba3
+    2488:	6a 01                	push   $0x1
+    248a:	e8 b1 17 00 00       	call   3c40 <printf>
+    exit();
+    248f:	e8 af 15 00 00       	call   3a43 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2494:	50                   	push   %eax
+    2495:	50                   	push   %eax
+    2496:	68 86 4b 00 00       	push   $0x4b86
+    249b:	6a 01                	push   $0x1
+    249d:	e8 9e 17 00 00       	call   3c40 <printf>
+    exit();
+    24a2:	e8 9c 15 00 00       	call   3a43 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    24a7:	52                   	push   %edx
+    24a8:	52                   	push   %edx
+    24a9:	68 6b 4b 00 00       	push   $0x4b6b
+    24ae:	6a 01                	push   $0x1
+    24b0:	e8 8b 17 00 00       	call   3c40 <printf>
+    exit();
+    24b5:	e8 89 15 00 00       	call   3a43 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    24ba:	51                   	push   %ecx
+    24bb:	51                   	push   %ecx
+    24bc:	68 98 4a 00 00       	push   $0x4a98
+    24c1:	6a 01                	push   $0x1
+    24c3:	e8 78 17 00 00       	call   3c40 <printf>
+    exit();
+    24c8:	e8 76 15 00 00       	call   3a43 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    24cd:	53                   	push   %ebx
+    24ce:	53                   	push   %ebx
+    24cf:	68 80 4a 00 00       	push   $0x4a80
+    24d4:	6a 01                	push   $0x1
+    24d6:	e8 65 17 00 00       	call   3c40 <printf>
+    exit();
+    24db:	e8 63 15 00 00       	call   3a43 <exit>
+
+000024e0 <bigwrite>:
+{
+    24e0:	55                   	push   %ebp
+    24e1:	89 e5                	mov    %esp,%ebp
+    24e3:	56                   	push   %esi
+    24e4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    24e5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    24ea:	83 ec 08             	sub    $0x8,%esp
+    24ed:	68 52 4c 00 00       	push   $0x4c52
+    24f2:	6a 01                	push   $0x1
+    24f4:	e8 47 17 00 00       	call   3c40 <printf>
+  unlink("bigwrite");
+    24f9:	c7 04 24 61 4c 00 00 	movl   $0x4c61,(%esp)
+    2500:	e8 8e 15 00 00       	call   3a93 <unlink>
+    2505:	83 c4 10             	add    $0x10,%esp
+    2508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    250f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2510:	83 ec 08             	sub    $0x8,%esp
+    2513:	68 02 02 00 00       	push   $0x202
+    2518:	68 61 4c 00 00       	push   $0x4c61
+    251d:	e8 61 15 00 00       	call   3a83 <open>
+    if(fd < 0){
+    2522:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2525:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2527:	85 c0                	test   %eax,%eax
+    2529:	78 7e                	js     25a9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    252b:	83 ec 04             	sub    $0x4,%esp
+    252e:	53                   	push   %ebx
+    252f:	68 60 8b 00 00       	push   $0x8b60
+    2534:	50                   	push   %eax
+    2535:	e8 29 15 00 00       	call   3a63 <write>
+      if(cc != sz){
+    253a:	83 c4 10             	add    $0x10,%esp
+    253d:	39 d8                	cmp    %ebx,%eax
+    253f:	75 55                	jne    2596 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2541:	83 ec 04             	sub    $0x4,%esp
+    2544:	53                   	push   %ebx
+    2545:	68 60 8b 00 00       	push   $0x8b60
+    254a:	56                   	push   %esi
+    254b:	e8 13 15 00 00       	call   3a63 <write>
+      if(cc != sz){
+    2550:	83 c4 10             	add    $0x10,%esp
+    2553:	39 c3                	cmp    %eax,%ebx
+    2555:	75 3f                	jne    2596 <bigwrite+0xb6>
+    close(fd);
+    2557:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    255a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2560:	56                   	push   %esi
+    2561:	e8 05 15 00 00       	call   3a6b <close>
+    unlink("bigwrite");
+    2566:	c7 04 24 61 4c 00 00 	movl   $0x4c61,(%esp)
+    256d:	e8 21 15 00 00       	call   3a93 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2572:	83 c4 10             	add    $0x10,%esp
+    2575:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    257b:	75 93                	jne    2510 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    257d:	83 ec 08             	sub    $0x8,%esp
+    2580:	68 94 4c 00 00       	push   $0x4c94
+    2585:	6a 01                	push   $0x1
+    2587:	e8 b4 16 00 00       	call   3c40 <printf>
+}
+    258c:	83 c4 10             	add    $0x10,%esp
+    258f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2592:	5b                   	pop    %ebx
+    2593:	5e                   	pop    %esi
+    2594:	5d                   	pop    %ebp
+    2595:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2596:	50                   	push   %eax
+    2597:	53                   	push   %ebx
+    2598:	68 82 4c 00 00       	push   $0x4c82
+    259d:	6a 01                	push   $0x1
+    259f:	e8 9c 16 00 00       	call   3c40 <printf>
+        exit();
+    25a4:	e8 9a 14 00 00       	call   3a43 <exit>
+      printf(1, "cannot create bigwrite\n");
+    25a9:	83 ec 08             	sub    $0x8,%esp
+    25ac:	68 6a 4c 00 00       	push   $0x4c6a
+    25b1:	6a 01                	push   $0x1
+    25b3:	e8 88 16 00 00       	call   3c40 <printf>
+      exit();
+    25b8:	e8 86 14 00 00       	call   3a43 <exit>
+    25bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000025c0 <bigfile>:
+{
+    25c0:	55                   	push   %ebp
+    25c1:	89 e5                	mov    %esp,%ebp
+    25c3:	57                   	push   %edi
+    25c4:	56                   	push   %esi
+    25c5:	53                   	push   %ebx
+    25c6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    25c9:	68 a1 4c 00 00       	push   $0x4ca1
+    25ce:	6a 01                	push   $0x1
+    25d0:	e8 6b 16 00 00       	call   3c40 <printf>
+  unlink("bigfile");
+    25d5:	c7 04 24 bd 4c 00 00 	movl   $0x4cbd,(%esp)
+    25dc:	e8 b2 14 00 00       	call   3a93 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    25e1:	58                   	pop    %eax
+    25e2:	5a                   	pop    %edx
+    25e3:	68 02 02 00 00       	push   $0x202
+    25e8:	68 bd 4c 00 00       	push   $0x4cbd
+    25ed:	e8 91 14 00 00       	call   3a83 <open>
+  if(fd < 0){
+    25f2:	83 c4 10             	add    $0x10,%esp
+    25f5:	85 c0                	test   %eax,%eax
+    25f7:	0f 88 5e 01 00 00    	js     275b <bigfile+0x19b>
+    25fd:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    25ff:	31 db                	xor    %ebx,%ebx
+    2601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2608:	83 ec 04             	sub    $0x4,%esp
+    260b:	68 58 02 00 00       	push   $0x258
+    2610:	53                   	push   %ebx
+    2611:	68 60 8b 00 00       	push   $0x8b60
+    2616:	e8 05 12 00 00       	call   3820 <memset>
+    if(write(fd, buf, 600) != 600){
+    261b:	83 c4 0c             	add    $0xc,%esp
+    261e:	68 58 02 00 00       	push   $0x258
+    2623:	68 60 8b 00 00       	push   $0x8b60
+    2628:	56                   	push   %esi
+    2629:	e8 35 14 00 00       	call   3a63 <write>
+    262e:	83 c4 10             	add    $0x10,%esp
+    2631:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2636:	0f 85 f8 00 00 00    	jne    2734 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    263c:	83 c3 01             	add    $0x1,%ebx
+    263f:	83 fb 14             	cmp    $0x14,%ebx
+    2642:	75 c4                	jne    2608 <bigfile+0x48>
+  close(fd);
+    2644:	83 ec 0c             	sub    $0xc,%esp
+    2647:	56                   	push   %esi
+    2648:	e8 1e 14 00 00       	call   3a6b <close>
+  fd = open("bigfile", 0);
+    264d:	5e                   	pop    %esi
+    264e:	5f                   	pop    %edi
+    264f:	6a 00                	push   $0x0
+    2651:	68 bd 4c 00 00       	push   $0x4cbd
+    2656:	e8 28 14 00 00       	call   3a83 <open>
+  if(fd < 0){
+    265b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    265e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2660:	85 c0                	test   %eax,%eax
+    2662:	0f 88 e0 00 00 00    	js     2748 <bigfile+0x188>
+  total = 0;
+    2668:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    266a:	31 ff                	xor    %edi,%edi
+    266c:	eb 30                	jmp    269e <bigfile+0xde>
+    266e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2670:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2675:	0f 85 91 00 00 00    	jne    270c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    267b:	89 fa                	mov    %edi,%edx
+    267d:	0f be 05 60 8b 00 00 	movsbl 0x8b60,%eax
+    2684:	d1 fa                	sar    %edx
+    2686:	39 d0                	cmp    %edx,%eax
+    2688:	75 6e                	jne    26f8 <bigfile+0x138>
+    268a:	0f be 15 8b 8c 00 00 	movsbl 0x8c8b,%edx
+    2691:	39 d0                	cmp    %edx,%eax
+    2693:	75 63                	jne    26f8 <bigfile+0x138>
+    total += cc;
+    2695:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    269b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    269e:	83 ec 04             	sub    $0x4,%esp
+    26a1:	68 2c 01 00 00       	push   $0x12c
+    26a6:	68 60 8b 00 00       	push   $0x8b60
+    26ab:	56                   	push   %esi
+    26ac:	e8 aa 13 00 00       	call   3a5b <read>
+    if(cc < 0){
+    26b1:	83 c4 10             	add    $0x10,%esp
+    26b4:	85 c0                	test   %eax,%eax
+    26b6:	78 68                	js     2720 <bigfile+0x160>
+    if(cc == 0)
+    26b8:	75 b6                	jne    2670 <bigfile+0xb0>
+  close(fd);
+    26ba:	83 ec 0c             	sub    $0xc,%esp
+    26bd:	56                   	push   %esi
+    26be:	e8 a8 13 00 00       	call   3a6b <close>
+  if(total != 20*600){
+    26c3:	83 c4 10             	add    $0x10,%esp
+    26c6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    26cc:	0f 85 9c 00 00 00    	jne    276e <bigfile+0x1ae>
+  unlink("bigfile");
+    26d2:	83 ec 0c             	sub    $0xc,%esp
+    26d5:	68 bd 4c 00 00       	push   $0x4cbd
+    26da:	e8 b4 13 00 00       	call   3a93 <unlink>
+  printf(1, "bigfile test ok\n");
+    26df:	58                   	pop    %eax
+    26e0:	5a                   	pop    %edx
+    26e1:	68 4c 4d 00 00       	push   $0x4d4c
+    26e6:	6a 01                	push   $0x1
+    26e8:	e8 53 15 00 00       	call   3c40 <printf>
+}
+    26ed:	83 c4 10             	add    $0x10,%esp
+    26f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    26f3:	5b                   	pop    %ebx
+    26f4:	5e                   	pop    %esi
+    26f5:	5f                   	pop    %edi
+    26f6:	5d                   	pop    %ebp
+    26f7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    26f8:	83 ec 08             	sub    $0x8,%esp
+    26fb:	68 19 4d 00 00       	push   $0x4d19
+    2700:	6a 01                	push   $0x1
+    2702:	e8 39 15 00 00       	call   3c40 <printf>
+      exit();
+    2707:	e8 37 13 00 00       	call   3a43 <exit>
+      printf(1, "short read bigfile\n");
+    270c:	83 ec 08             	sub    $0x8,%esp
+    270f:	68 05 4d 00 00       	push   $0x4d05
+    2714:	6a 01                	push   $0x1
+    2716:	e8 25 15 00 00       	call   3c40 <printf>
+      exit();
+    271b:	e8 23 13 00 00       	call   3a43 <exit>
+      printf(1, "read bigfile failed\n");
+    2720:	83 ec 08             	sub    $0x8,%esp
+    2723:	68 f0 4c 00 00       	push   $0x4cf0
+    2728:	6a 01                	push   $0x1
+    272a:	e8 11 15 00 00       	call   3c40 <printf>
+      exit();
+    272f:	e8 0f 13 00 00       	call   3a43 <exit>
+      printf(1, "write bigfile failed\n");
+    2734:	83 ec 08             	sub    $0x8,%esp
+    2737:	68 c5 4c 00 00       	push   $0x4cc5
+    273c:	6a 01                	push   $0x1
+    273e:	e8 fd 14 00 00       	call   3c40 <printf>
+      exit();
+    2743:	e8 fb 12 00 00       	call   3a43 <exit>
+    printf(1, "cannot open bigfile\n");
+    2748:	53                   	push   %ebx
+    2749:	53                   	push   %ebx
+    274a:	68 db 4c 00 00       	push   $0x4cdb
+    274f:	6a 01                	push   $0x1
+    2751:	e8 ea 14 00 00       	call   3c40 <printf>
+    exit();
+    2756:	e8 e8 12 00 00       	call   3a43 <exit>
+    printf(1, "cannot create bigfile");
+    275b:	50                   	push   %eax
+    275c:	50                   	push   %eax
+    275d:	68 af 4c 00 00       	push   $0x4caf
+    2762:	6a 01                	push   $0x1
+    2764:	e8 d7 14 00 00       	call   3c40 <printf>
+    exit();
+    2769:	e8 d5 12 00 00       	call   3a43 <exit>
+    printf(1, "read bigfile wrong total\n");
+    276e:	51                   	push   %ecx
+    276f:	51                   	push   %ecx
+    2770:	68 32 4d 00 00       	push   $0x4d32
+    2775:	6a 01                	push   $0x1
+    2777:	e8 c4 14 00 00       	call   3c40 <printf>
+    exit();
+    277c:	e8 c2 12 00 00       	call   3a43 <exit>
+    2781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    278f:	90                   	nop
+
+00002790 <fourteen>:
+{
+    2790:	55                   	push   %ebp
+    2791:	89 e5                	mov    %esp,%ebp
+    2793:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2796:	68 5d 4d 00 00       	push   $0x4d5d
+    279b:	6a 01                	push   $0x1
+    279d:	e8 9e 14 00 00       	call   3c40 <printf>
+  if(mkdir("12345678901234") != 0){
+    27a2:	c7 04 24 98 4d 00 00 	movl   $0x4d98,(%esp)
+    27a9:	e8 fd 12 00 00       	call   3aab <mkdir>
+    27ae:	83 c4 10             	add    $0x10,%esp
+    27b1:	85 c0                	test   %eax,%eax
+    27b3:	0f 85 97 00 00 00    	jne    2850 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    27b9:	83 ec 0c             	sub    $0xc,%esp
+    27bc:	68 54 55 00 00       	push   $0x5554
+    27c1:	e8 e5 12 00 00       	call   3aab <mkdir>
+    27c6:	83 c4 10             	add    $0x10,%esp
+    27c9:	85 c0                	test   %eax,%eax
+    27cb:	0f 85 de 00 00 00    	jne    28af <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    27d1:	83 ec 08             	sub    $0x8,%esp
+    27d4:	68 00 02 00 00       	push   $0x200
+    27d9:	68 a4 55 00 00       	push   $0x55a4
+    27de:	e8 a0 12 00 00       	call   3a83 <open>
+  if(fd < 0){
+    27e3:	83 c4 10             	add    $0x10,%esp
+    27e6:	85 c0                	test   %eax,%eax
+    27e8:	0f 88 ae 00 00 00    	js     289c <fourteen+0x10c>
+  close(fd);
+    27ee:	83 ec 0c             	sub    $0xc,%esp
+    27f1:	50                   	push   %eax
+    27f2:	e8 74 12 00 00       	call   3a6b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    27f7:	58                   	pop    %eax
+    27f8:	5a                   	pop    %edx
+    27f9:	6a 00                	push   $0x0
+    27fb:	68 14 56 00 00       	push   $0x5614
+    2800:	e8 7e 12 00 00       	call   3a83 <open>
+  if(fd < 0){
+    2805:	83 c4 10             	add    $0x10,%esp
+    2808:	85 c0                	test   %eax,%eax
+    280a:	78 7d                	js     2889 <fourteen+0xf9>
+  close(fd);
+    280c:	83 ec 0c             	sub    $0xc,%esp
+    280f:	50                   	push   %eax
+    2810:	e8 56 12 00 00       	call   3a6b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2815:	c7 04 24 89 4d 00 00 	movl   $0x4d89,(%esp)
+    281c:	e8 8a 12 00 00       	call   3aab <mkdir>
+    2821:	83 c4 10             	add    $0x10,%esp
+    2824:	85 c0                	test   %eax,%eax
+    2826:	74 4e                	je     2876 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2828:	83 ec 0c             	sub    $0xc,%esp
+    282b:	68 b0 56 00 00       	push   $0x56b0
+    2830:	e8 76 12 00 00       	call   3aab <mkdir>
+    2835:	83 c4 10             	add    $0x10,%esp
+    2838:	85 c0                	test   %eax,%eax
+    283a:	74 27                	je     2863 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    283c:	83 ec 08             	sub    $0x8,%esp
+    283f:	68 a7 4d 00 00       	push   $0x4da7
+    2844:	6a 01                	push   $0x1
+    2846:	e8 f5 13 00 00       	call   3c40 <printf>
+}
+    284b:	83 c4 10             	add    $0x10,%esp
+    284e:	c9                   	leave
+    284f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2850:	50                   	push   %eax
+    2851:	50                   	push   %eax
+    2852:	68 6c 4d 00 00       	push   $0x4d6c
+    2857:	6a 01                	push   $0x1
+    2859:	e8 e2 13 00 00       	call   3c40 <printf>
+    exit();
+    285e:	e8 e0 11 00 00       	call   3a43 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2863:	50                   	push   %eax
+    2864:	50                   	push   %eax
+    2865:	68 d0 56 00 00       	push   $0x56d0
+    286a:	6a 01                	push   $0x1
+    286c:	e8 cf 13 00 00       	call   3c40 <printf>
+    exit();
+    2871:	e8 cd 11 00 00       	call   3a43 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2876:	52                   	push   %edx
+    2877:	52                   	push   %edx
+    2878:	68 80 56 00 00       	push   $0x5680
+    287d:	6a 01                	push   $0x1
+    287f:	e8 bc 13 00 00       	call   3c40 <printf>
+    exit();
+    2884:	e8 ba 11 00 00       	call   3a43 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2889:	51                   	push   %ecx
+    288a:	51                   	push   %ecx
+    288b:	68 44 56 00 00       	push   $0x5644
+    2890:	6a 01                	push   $0x1
+    2892:	e8 a9 13 00 00       	call   3c40 <printf>
+    exit();
+    2897:	e8 a7 11 00 00       	call   3a43 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    289c:	51                   	push   %ecx
+    289d:	51                   	push   %ecx
+    289e:	68 d4 55 00 00       	push   $0x55d4
+    28a3:	6a 01                	push   $0x1
+    28a5:	e8 96 13 00 00       	call   3c40 <printf>
+    exit();
+    28aa:	e8 94 11 00 00       	call   3a43 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    28af:	50                   	push   %eax
+    28b0:	50                   	push   %eax
+    28b1:	68 74 55 00 00       	push   $0x5574
+    28b6:	6a 01                	push   $0x1
+    28b8:	e8 83 13 00 00       	call   3c40 <printf>
+    exit();
+    28bd:	e8 81 11 00 00       	call   3a43 <exit>
+    28c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000028d0 <rmdot>:
+{
+    28d0:	55                   	push   %ebp
+    28d1:	89 e5                	mov    %esp,%ebp
+    28d3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    28d6:	68 b4 4d 00 00       	push   $0x4db4
+    28db:	6a 01                	push   $0x1
+    28dd:	e8 5e 13 00 00       	call   3c40 <printf>
+  if(mkdir("dots") != 0){
+    28e2:	c7 04 24 c0 4d 00 00 	movl   $0x4dc0,(%esp)
+    28e9:	e8 bd 11 00 00       	call   3aab <mkdir>
+    28ee:	83 c4 10             	add    $0x10,%esp
+    28f1:	85 c0                	test   %eax,%eax
+    28f3:	0f 85 b0 00 00 00    	jne    29a9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    28f9:	83 ec 0c             	sub    $0xc,%esp
+    28fc:	68 c0 4d 00 00       	push   $0x4dc0
+    2901:	e8 ad 11 00 00       	call   3ab3 <chdir>
+    2906:	83 c4 10             	add    $0x10,%esp
+    2909:	85 c0                	test   %eax,%eax
+    290b:	0f 85 1d 01 00 00    	jne    2a2e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2911:	83 ec 0c             	sub    $0xc,%esp
+    2914:	68 6b 4a 00 00       	push   $0x4a6b
+    2919:	e8 75 11 00 00       	call   3a93 <unlink>
+    291e:	83 c4 10             	add    $0x10,%esp
+    2921:	85 c0                	test   %eax,%eax
+    2923:	0f 84 f2 00 00 00    	je     2a1b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2929:	83 ec 0c             	sub    $0xc,%esp
+    292c:	68 6a 4a 00 00       	push   $0x4a6a
+    2931:	e8 5d 11 00 00       	call   3a93 <unlink>
+    2936:	83 c4 10             	add    $0x10,%esp
+    2939:	85 c0                	test   %eax,%eax
+    293b:	0f 84 c7 00 00 00    	je     2a08 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2941:	83 ec 0c             	sub    $0xc,%esp
+    2944:	68 d1 41 00 00       	push   $0x41d1
+    2949:	e8 65 11 00 00       	call   3ab3 <chdir>
+    294e:	83 c4 10             	add    $0x10,%esp
+    2951:	85 c0                	test   %eax,%eax
+    2953:	0f 85 9c 00 00 00    	jne    29f5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2959:	83 ec 0c             	sub    $0xc,%esp
+    295c:	68 08 4e 00 00       	push   $0x4e08
+    2961:	e8 2d 11 00 00       	call   3a93 <unlink>
+    2966:	83 c4 10             	add    $0x10,%esp
+    2969:	85 c0                	test   %eax,%eax
+    296b:	74 75                	je     29e2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    296d:	83 ec 0c             	sub    $0xc,%esp
+    2970:	68 26 4e 00 00       	push   $0x4e26
+    2975:	e8 19 11 00 00       	call   3a93 <unlink>
+    297a:	83 c4 10             	add    $0x10,%esp
+    297d:	85 c0                	test   %eax,%eax
+    297f:	74 4e                	je     29cf <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2981:	83 ec 0c             	sub    $0xc,%esp
+    2984:	68 c0 4d 00 00       	push   $0x4dc0
+    2989:	e8 05 11 00 00       	call   3a93 <unlink>
+    298e:	83 c4 10             	add    $0x10,%esp
+    2991:	85 c0                	test   %eax,%eax
+    2993:	75 27                	jne    29bc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2995:	83 ec 08             	sub    $0x8,%esp
+    2998:	68 5b 4e 00 00       	push   $0x4e5b
+    299d:	6a 01                	push   $0x1
+    299f:	e8 9c 12 00 00       	call   3c40 <printf>
+}
+    29a4:	83 c4 10             	add    $0x10,%esp
+    29a7:	c9                   	leave
+    29a8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    29a9:	50                   	push   %eax
+    29aa:	50                   	push   %eax
+    29ab:	68 c5 4d 00 00       	push   $0x4dc5
+    29b0:	6a 01                	push   $0x1
+    29b2:	e8 89 12 00 00       	call   3c40 <printf>
+    exit();
+    29b7:	e8 87 10 00 00       	call   3a43 <exit>
+    printf(1, "unlink dots failed!\n");
+    29bc:	50                   	push   %eax
+    29bd:	50                   	push   %eax
+    29be:	68 46 4e 00 00       	push   $0x4e46
+    29c3:	6a 01                	push   $0x1
+    29c5:	e8 76 12 00 00       	call   3c40 <printf>
+    exit();
+    29ca:	e8 74 10 00 00       	call   3a43 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    29cf:	52                   	push   %edx
+    29d0:	52                   	push   %edx
+    29d1:	68 2e 4e 00 00       	push   $0x4e2e
+    29d6:	6a 01                	push   $0x1
+    29d8:	e8 63 12 00 00       	call   3c40 <printf>
+    exit();
+    29dd:	e8 61 10 00 00       	call   3a43 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    29e2:	51                   	push   %ecx
+    29e3:	51                   	push   %ecx
+    29e4:	68 0f 4e 00 00       	push   $0x4e0f
+    29e9:	6a 01                	push   $0x1
+    29eb:	e8 50 12 00 00       	call   3c40 <printf>
+    exit();
+    29f0:	e8 4e 10 00 00       	call   3a43 <exit>
+    printf(1, "chdir / failed\n");
+    29f5:	50                   	push   %eax
+    29f6:	50                   	push   %eax
+    29f7:	68 d3 41 00 00       	push   $0x41d3
+    29fc:	6a 01                	push   $0x1
+    29fe:	e8 3d 12 00 00       	call   3c40 <printf>
+    exit();
+    2a03:	e8 3b 10 00 00       	call   3a43 <exit>
+    printf(1, "rm .. worked!\n");
+    2a08:	50                   	push   %eax
+    2a09:	50                   	push   %eax
+    2a0a:	68 f9 4d 00 00       	push   $0x4df9
+    2a0f:	6a 01                	push   $0x1
+    2a11:	e8 2a 12 00 00       	call   3c40 <printf>
+    exit();
+    2a16:	e8 28 10 00 00       	call   3a43 <exit>
+    printf(1, "rm . worked!\n");
+    2a1b:	50                   	push   %eax
+    2a1c:	50                   	push   %eax
+    2a1d:	68 eb 4d 00 00       	push   $0x4deb
+    2a22:	6a 01                	push   $0x1
+    2a24:	e8 17 12 00 00       	call   3c40 <printf>
+    exit();
+    2a29:	e8 15 10 00 00       	call   3a43 <exit>
+    printf(1, "chdir dots failed\n");
+    2a2e:	50                   	push   %eax
+    2a2f:	50                   	push   %eax
+    2a30:	68 d8 4d 00 00       	push   $0x4dd8
+    2a35:	6a 01                	push   $0x1
+    2a37:	e8 04 12 00 00       	call   3c40 <printf>
+    exit();
+    2a3c:	e8 02 10 00 00       	call   3a43 <exit>
+    2a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a4f:	90                   	nop
+
+00002a50 <dirfile>:
+{
+    2a50:	55                   	push   %ebp
+    2a51:	89 e5                	mov    %esp,%ebp
+    2a53:	53                   	push   %ebx
+    2a54:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2a57:	68 65 4e 00 00       	push   $0x4e65
+    2a5c:	6a 01                	push   $0x1
+    2a5e:	e8 dd 11 00 00       	call   3c40 <printf>
+  fd = open("dirfile", O_CREATE);
+    2a63:	5b                   	pop    %ebx
+    2a64:	58                   	pop    %eax
+    2a65:	68 00 02 00 00       	push   $0x200
+    2a6a:	68 72 4e 00 00       	push   $0x4e72
+    2a6f:	e8 0f 10 00 00       	call   3a83 <open>
+  if(fd < 0){
+    2a74:	83 c4 10             	add    $0x10,%esp
+    2a77:	85 c0                	test   %eax,%eax
+    2a79:	0f 88 43 01 00 00    	js     2bc2 <dirfile+0x172>
+  close(fd);
+    2a7f:	83 ec 0c             	sub    $0xc,%esp
+    2a82:	50                   	push   %eax
+    2a83:	e8 e3 0f 00 00       	call   3a6b <close>
+  if(chdir("dirfile") == 0){
+    2a88:	c7 04 24 72 4e 00 00 	movl   $0x4e72,(%esp)
+    2a8f:	e8 1f 10 00 00       	call   3ab3 <chdir>
+    2a94:	83 c4 10             	add    $0x10,%esp
+    2a97:	85 c0                	test   %eax,%eax
+    2a99:	0f 84 10 01 00 00    	je     2baf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2a9f:	83 ec 08             	sub    $0x8,%esp
+    2aa2:	6a 00                	push   $0x0
+    2aa4:	68 ab 4e 00 00       	push   $0x4eab
+    2aa9:	e8 d5 0f 00 00       	call   3a83 <open>
+  if(fd >= 0){
+    2aae:	83 c4 10             	add    $0x10,%esp
+    2ab1:	85 c0                	test   %eax,%eax
+    2ab3:	0f 89 e3 00 00 00    	jns    2b9c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2ab9:	83 ec 08             	sub    $0x8,%esp
+    2abc:	68 00 02 00 00       	push   $0x200
+    2ac1:	68 ab 4e 00 00       	push   $0x4eab
+    2ac6:	e8 b8 0f 00 00       	call   3a83 <open>
+  if(fd >= 0){
+    2acb:	83 c4 10             	add    $0x10,%esp
+    2ace:	85 c0                	test   %eax,%eax
+    2ad0:	0f 89 c6 00 00 00    	jns    2b9c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2ad6:	83 ec 0c             	sub    $0xc,%esp
+    2ad9:	68 ab 4e 00 00       	push   $0x4eab
+    2ade:	e8 c8 0f 00 00       	call   3aab <mkdir>
+    2ae3:	83 c4 10             	add    $0x10,%esp
+    2ae6:	85 c0                	test   %eax,%eax
+    2ae8:	0f 84 46 01 00 00    	je     2c34 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2aee:	83 ec 0c             	sub    $0xc,%esp
+    2af1:	68 ab 4e 00 00       	push   $0x4eab
+    2af6:	e8 98 0f 00 00       	call   3a93 <unlink>
+    2afb:	83 c4 10             	add    $0x10,%esp
+    2afe:	85 c0                	test   %eax,%eax
+    2b00:	0f 84 1b 01 00 00    	je     2c21 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2b06:	83 ec 08             	sub    $0x8,%esp
+    2b09:	68 ab 4e 00 00       	push   $0x4eab
+    2b0e:	68 0f 4f 00 00       	push   $0x4f0f
+    2b13:	e8 8b 0f 00 00       	call   3aa3 <link>
+    2b18:	83 c4 10             	add    $0x10,%esp
+    2b1b:	85 c0                	test   %eax,%eax
+    2b1d:	0f 84 eb 00 00 00    	je     2c0e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2b23:	83 ec 0c             	sub    $0xc,%esp
+    2b26:	68 72 4e 00 00       	push   $0x4e72
+    2b2b:	e8 63 0f 00 00       	call   3a93 <unlink>
+    2b30:	83 c4 10             	add    $0x10,%esp
+    2b33:	85 c0                	test   %eax,%eax
+    2b35:	0f 85 c0 00 00 00    	jne    2bfb <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2b3b:	83 ec 08             	sub    $0x8,%esp
+    2b3e:	6a 02                	push   $0x2
+    2b40:	68 6b 4a 00 00       	push   $0x4a6b
+    2b45:	e8 39 0f 00 00       	call   3a83 <open>
+  if(fd >= 0){
+    2b4a:	83 c4 10             	add    $0x10,%esp
+    2b4d:	85 c0                	test   %eax,%eax
+    2b4f:	0f 89 93 00 00 00    	jns    2be8 <dirfile+0x198>
+  fd = open(".", 0);
+    2b55:	83 ec 08             	sub    $0x8,%esp
+    2b58:	6a 00                	push   $0x0
+    2b5a:	68 6b 4a 00 00       	push   $0x4a6b
+    2b5f:	e8 1f 0f 00 00       	call   3a83 <open>
+  if(write(fd, "x", 1) > 0){
+    2b64:	83 c4 0c             	add    $0xc,%esp
+    2b67:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2b69:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2b6b:	68 4e 4b 00 00       	push   $0x4b4e
+    2b70:	50                   	push   %eax
+    2b71:	e8 ed 0e 00 00       	call   3a63 <write>
+    2b76:	83 c4 10             	add    $0x10,%esp
+    2b79:	85 c0                	test   %eax,%eax
+    2b7b:	7f 58                	jg     2bd5 <dirfile+0x185>
+  close(fd);
+    2b7d:	83 ec 0c             	sub    $0xc,%esp
+    2b80:	53                   	push   %ebx
+    2b81:	e8 e5 0e 00 00       	call   3a6b <close>
+  printf(1, "dir vs file OK\n");
+    2b86:	58                   	pop    %eax
+    2b87:	5a                   	pop    %edx
+    2b88:	68 42 4f 00 00       	push   $0x4f42
+    2b8d:	6a 01                	push   $0x1
+    2b8f:	e8 ac 10 00 00       	call   3c40 <printf>
+}
+    2b94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b97:	83 c4 10             	add    $0x10,%esp
+    2b9a:	c9                   	leave
+    2b9b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2b9c:	50                   	push   %eax
+    2b9d:	50                   	push   %eax
+    2b9e:	68 b6 4e 00 00       	push   $0x4eb6
+    2ba3:	6a 01                	push   $0x1
+    2ba5:	e8 96 10 00 00       	call   3c40 <printf>
+    exit();
+    2baa:	e8 94 0e 00 00       	call   3a43 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2baf:	52                   	push   %edx
+    2bb0:	52                   	push   %edx
+    2bb1:	68 91 4e 00 00       	push   $0x4e91
+    2bb6:	6a 01                	push   $0x1
+    2bb8:	e8 83 10 00 00       	call   3c40 <printf>
+    exit();
+    2bbd:	e8 81 0e 00 00       	call   3a43 <exit>
+    printf(1, "create dirfile failed\n");
+    2bc2:	51                   	push   %ecx
+    2bc3:	51                   	push   %ecx
+    2bc4:	68 7a 4e 00 00       	push   $0x4e7a
+    2bc9:	6a 01                	push   $0x1
+    2bcb:	e8 70 10 00 00       	call   3c40 <printf>
+    exit();
+    2bd0:	e8 6e 0e 00 00       	call   3a43 <exit>
+    printf(1, "write . succeeded!\n");
+    2bd5:	51                   	push   %ecx
+    2bd6:	51                   	push   %ecx
+    2bd7:	68 2e 4f 00 00       	push   $0x4f2e
+    2bdc:	6a 01                	push   $0x1
+    2bde:	e8 5d 10 00 00       	call   3c40 <printf>
+    exit();
+    2be3:	e8 5b 0e 00 00       	call   3a43 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2be8:	53                   	push   %ebx
+    2be9:	53                   	push   %ebx
+    2bea:	68 24 57 00 00       	push   $0x5724
+    2bef:	6a 01                	push   $0x1
+    2bf1:	e8 4a 10 00 00       	call   3c40 <printf>
+    exit();
+    2bf6:	e8 48 0e 00 00       	call   3a43 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2bfb:	50                   	push   %eax
+    2bfc:	50                   	push   %eax
+    2bfd:	68 16 4f 00 00       	push   $0x4f16
+    2c02:	6a 01                	push   $0x1
+    2c04:	e8 37 10 00 00       	call   3c40 <printf>
+    exit();
+    2c09:	e8 35 0e 00 00       	call   3a43 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2c0e:	50                   	push   %eax
+    2c0f:	50                   	push   %eax
+    2c10:	68 04 57 00 00       	push   $0x5704
+    2c15:	6a 01                	push   $0x1
+    2c17:	e8 24 10 00 00       	call   3c40 <printf>
+    exit();
+    2c1c:	e8 22 0e 00 00       	call   3a43 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2c21:	50                   	push   %eax
+    2c22:	50                   	push   %eax
+    2c23:	68 f1 4e 00 00       	push   $0x4ef1
+    2c28:	6a 01                	push   $0x1
+    2c2a:	e8 11 10 00 00       	call   3c40 <printf>
+    exit();
+    2c2f:	e8 0f 0e 00 00       	call   3a43 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2c34:	50                   	push   %eax
+    2c35:	50                   	push   %eax
+    2c36:	68 d4 4e 00 00       	push   $0x4ed4
+    2c3b:	6a 01                	push   $0x1
+    2c3d:	e8 fe 0f 00 00       	call   3c40 <printf>
+    exit();
+    2c42:	e8 fc 0d 00 00       	call   3a43 <exit>
+    2c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c4e:	66 90                	xchg   %ax,%ax
+
+00002c50 <iref>:
+{
+    2c50:	55                   	push   %ebp
+    2c51:	89 e5                	mov    %esp,%ebp
+    2c53:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2c54:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2c59:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2c5c:	68 52 4f 00 00       	push   $0x4f52
+    2c61:	6a 01                	push   $0x1
+    2c63:	e8 d8 0f 00 00       	call   3c40 <printf>
+    2c68:	83 c4 10             	add    $0x10,%esp
+    2c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c6f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2c70:	83 ec 0c             	sub    $0xc,%esp
+    2c73:	68 63 4f 00 00       	push   $0x4f63
+    2c78:	e8 2e 0e 00 00       	call   3aab <mkdir>
+    2c7d:	83 c4 10             	add    $0x10,%esp
+    2c80:	85 c0                	test   %eax,%eax
+    2c82:	0f 85 bb 00 00 00    	jne    2d43 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2c88:	83 ec 0c             	sub    $0xc,%esp
+    2c8b:	68 63 4f 00 00       	push   $0x4f63
+    2c90:	e8 1e 0e 00 00       	call   3ab3 <chdir>
+    2c95:	83 c4 10             	add    $0x10,%esp
+    2c98:	85 c0                	test   %eax,%eax
+    2c9a:	0f 85 b7 00 00 00    	jne    2d57 <iref+0x107>
+    mkdir("");
+    2ca0:	83 ec 0c             	sub    $0xc,%esp
+    2ca3:	68 18 46 00 00       	push   $0x4618
+    2ca8:	e8 fe 0d 00 00       	call   3aab <mkdir>
+    link("README", "");
+    2cad:	59                   	pop    %ecx
+    2cae:	58                   	pop    %eax
+    2caf:	68 18 46 00 00       	push   $0x4618
+    2cb4:	68 0f 4f 00 00       	push   $0x4f0f
+    2cb9:	e8 e5 0d 00 00       	call   3aa3 <link>
+    fd = open("", O_CREATE);
+    2cbe:	58                   	pop    %eax
+    2cbf:	5a                   	pop    %edx
+    2cc0:	68 00 02 00 00       	push   $0x200
+    2cc5:	68 18 46 00 00       	push   $0x4618
+    2cca:	e8 b4 0d 00 00       	call   3a83 <open>
+    if(fd >= 0)
+    2ccf:	83 c4 10             	add    $0x10,%esp
+    2cd2:	85 c0                	test   %eax,%eax
+    2cd4:	78 0c                	js     2ce2 <iref+0x92>
+      close(fd);
+    2cd6:	83 ec 0c             	sub    $0xc,%esp
+    2cd9:	50                   	push   %eax
+    2cda:	e8 8c 0d 00 00       	call   3a6b <close>
+    2cdf:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2ce2:	83 ec 08             	sub    $0x8,%esp
+    2ce5:	68 00 02 00 00       	push   $0x200
+    2cea:	68 4d 4b 00 00       	push   $0x4b4d
+    2cef:	e8 8f 0d 00 00       	call   3a83 <open>
+    if(fd >= 0)
+    2cf4:	83 c4 10             	add    $0x10,%esp
+    2cf7:	85 c0                	test   %eax,%eax
+    2cf9:	78 0c                	js     2d07 <iref+0xb7>
+      close(fd);
+    2cfb:	83 ec 0c             	sub    $0xc,%esp
+    2cfe:	50                   	push   %eax
+    2cff:	e8 67 0d 00 00       	call   3a6b <close>
+    2d04:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2d07:	83 ec 0c             	sub    $0xc,%esp
+    2d0a:	68 4d 4b 00 00       	push   $0x4b4d
+    2d0f:	e8 7f 0d 00 00       	call   3a93 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2d14:	83 c4 10             	add    $0x10,%esp
+    2d17:	83 eb 01             	sub    $0x1,%ebx
+    2d1a:	0f 85 50 ff ff ff    	jne    2c70 <iref+0x20>
+  chdir("/");
+    2d20:	83 ec 0c             	sub    $0xc,%esp
+    2d23:	68 d1 41 00 00       	push   $0x41d1
+    2d28:	e8 86 0d 00 00       	call   3ab3 <chdir>
+  printf(1, "empty file name OK\n");
+    2d2d:	58                   	pop    %eax
+    2d2e:	5a                   	pop    %edx
+    2d2f:	68 91 4f 00 00       	push   $0x4f91
+    2d34:	6a 01                	push   $0x1
+    2d36:	e8 05 0f 00 00       	call   3c40 <printf>
+}
+    2d3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d3e:	83 c4 10             	add    $0x10,%esp
+    2d41:	c9                   	leave
+    2d42:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2d43:	83 ec 08             	sub    $0x8,%esp
+    2d46:	68 69 4f 00 00       	push   $0x4f69
+    2d4b:	6a 01                	push   $0x1
+    2d4d:	e8 ee 0e 00 00       	call   3c40 <printf>
+      exit();
+    2d52:	e8 ec 0c 00 00       	call   3a43 <exit>
+      printf(1, "chdir irefd failed\n");
+    2d57:	83 ec 08             	sub    $0x8,%esp
+    2d5a:	68 7d 4f 00 00       	push   $0x4f7d
+    2d5f:	6a 01                	push   $0x1
+    2d61:	e8 da 0e 00 00       	call   3c40 <printf>
+      exit();
+    2d66:	e8 d8 0c 00 00       	call   3a43 <exit>
+    2d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2d6f:	90                   	nop
+
+00002d70 <forktest>:
+{
+    2d70:	55                   	push   %ebp
+    2d71:	89 e5                	mov    %esp,%ebp
+    2d73:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2d74:	31 db                	xor    %ebx,%ebx
+{
+    2d76:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2d79:	68 a5 4f 00 00       	push   $0x4fa5
+    2d7e:	6a 01                	push   $0x1
+    2d80:	e8 bb 0e 00 00       	call   3c40 <printf>
+    2d85:	83 c4 10             	add    $0x10,%esp
+    2d88:	eb 13                	jmp    2d9d <forktest+0x2d>
+    2d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2d90:	74 4d                	je     2ddf <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2d92:	83 c3 01             	add    $0x1,%ebx
+    2d95:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2d9b:	74 6e                	je     2e0b <forktest+0x9b>
+    pid = fork();
+    2d9d:	e8 99 0c 00 00       	call   3a3b <fork>
+    if(pid < 0)
+    2da2:	85 c0                	test   %eax,%eax
+    2da4:	79 ea                	jns    2d90 <forktest+0x20>
+  for(; n > 0; n--){
+    2da6:	85 db                	test   %ebx,%ebx
+    2da8:	74 14                	je     2dbe <forktest+0x4e>
+    2daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2db0:	e8 96 0c 00 00       	call   3a4b <wait>
+    2db5:	85 c0                	test   %eax,%eax
+    2db7:	78 2b                	js     2de4 <forktest+0x74>
+  for(; n > 0; n--){
+    2db9:	83 eb 01             	sub    $0x1,%ebx
+    2dbc:	75 f2                	jne    2db0 <forktest+0x40>
+  if(wait() != -1){
+    2dbe:	e8 88 0c 00 00       	call   3a4b <wait>
+    2dc3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2dc6:	75 30                	jne    2df8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2dc8:	83 ec 08             	sub    $0x8,%esp
+    2dcb:	68 d7 4f 00 00       	push   $0x4fd7
+    2dd0:	6a 01                	push   $0x1
+    2dd2:	e8 69 0e 00 00       	call   3c40 <printf>
+}
+    2dd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2dda:	83 c4 10             	add    $0x10,%esp
+    2ddd:	c9                   	leave
+    2dde:	c3                   	ret
+      exit();
+    2ddf:	e8 5f 0c 00 00       	call   3a43 <exit>
+      printf(1, "wait stopped early\n");
+    2de4:	83 ec 08             	sub    $0x8,%esp
+    2de7:	68 b0 4f 00 00       	push   $0x4fb0
+    2dec:	6a 01                	push   $0x1
+    2dee:	e8 4d 0e 00 00       	call   3c40 <printf>
+      exit();
+    2df3:	e8 4b 0c 00 00       	call   3a43 <exit>
+    printf(1, "wait got too many\n");
+    2df8:	50                   	push   %eax
+    2df9:	50                   	push   %eax
+    2dfa:	68 c4 4f 00 00       	push   $0x4fc4
+    2dff:	6a 01                	push   $0x1
+    2e01:	e8 3a 0e 00 00       	call   3c40 <printf>
+    exit();
+    2e06:	e8 38 0c 00 00       	call   3a43 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2e0b:	52                   	push   %edx
+    2e0c:	52                   	push   %edx
+    2e0d:	68 44 57 00 00       	push   $0x5744
+    2e12:	6a 01                	push   $0x1
+    2e14:	e8 27 0e 00 00       	call   3c40 <printf>
+    exit();
+    2e19:	e8 25 0c 00 00       	call   3a43 <exit>
+    2e1e:	66 90                	xchg   %ax,%ax
+
+00002e20 <sbrktest>:
+{
+    2e20:	55                   	push   %ebp
+    2e21:	89 e5                	mov    %esp,%ebp
+    2e23:	57                   	push   %edi
+    2e24:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    2e25:	31 f6                	xor    %esi,%esi
+{
+    2e27:	53                   	push   %ebx
+    2e28:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    2e2b:	68 e5 4f 00 00       	push   $0x4fe5
+    2e30:	ff 35 14 64 00 00    	push   0x6414
+    2e36:	e8 05 0e 00 00       	call   3c40 <printf>
+  oldbrk = sbrk(0);
+    2e3b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2e42:	e8 84 0c 00 00       	call   3acb <sbrk>
+    2e47:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    2e4a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2e51:	e8 75 0c 00 00       	call   3acb <sbrk>
+    2e56:	83 c4 10             	add    $0x10,%esp
+    2e59:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    2e5b:	eb 05                	jmp    2e62 <sbrktest+0x42>
+    2e5d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    2e60:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    2e62:	83 ec 0c             	sub    $0xc,%esp
+    2e65:	6a 01                	push   $0x1
+    2e67:	e8 5f 0c 00 00       	call   3acb <sbrk>
+    if(b != a){
+    2e6c:	83 c4 10             	add    $0x10,%esp
+    2e6f:	39 d8                	cmp    %ebx,%eax
+    2e71:	0f 85 9c 02 00 00    	jne    3113 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    2e77:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    2e7a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    2e7d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    2e80:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    2e86:	75 d8                	jne    2e60 <sbrktest+0x40>
+  pid = fork();
+    2e88:	e8 ae 0b 00 00       	call   3a3b <fork>
+    2e8d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2e8f:	85 c0                	test   %eax,%eax
+    2e91:	0f 88 02 03 00 00    	js     3199 <sbrktest+0x379>
+  c = sbrk(1);
+    2e97:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    2e9a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    2e9d:	6a 01                	push   $0x1
+    2e9f:	e8 27 0c 00 00       	call   3acb <sbrk>
+  c = sbrk(1);
+    2ea4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2eab:	e8 1b 0c 00 00       	call   3acb <sbrk>
+  if(c != a + 1){
+    2eb0:	83 c4 10             	add    $0x10,%esp
+    2eb3:	39 c3                	cmp    %eax,%ebx
+    2eb5:	0f 85 3b 03 00 00    	jne    31f6 <sbrktest+0x3d6>
+  if(pid == 0)
+    2ebb:	85 f6                	test   %esi,%esi
+    2ebd:	0f 84 2e 03 00 00    	je     31f1 <sbrktest+0x3d1>
+  wait();
+    2ec3:	e8 83 0b 00 00       	call   3a4b <wait>
+  a = sbrk(0);
+    2ec8:	83 ec 0c             	sub    $0xc,%esp
+    2ecb:	6a 00                	push   $0x0
+    2ecd:	e8 f9 0b 00 00       	call   3acb <sbrk>
+    2ed2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2ed4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2ed9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2edb:	89 04 24             	mov    %eax,(%esp)
+    2ede:	e8 e8 0b 00 00       	call   3acb <sbrk>
+  if (p != a) {
+    2ee3:	83 c4 10             	add    $0x10,%esp
+    2ee6:	39 c3                	cmp    %eax,%ebx
+    2ee8:	0f 85 94 02 00 00    	jne    3182 <sbrktest+0x362>
+  a = sbrk(0);
+    2eee:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    2ef1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    2ef8:	6a 00                	push   $0x0
+    2efa:	e8 cc 0b 00 00       	call   3acb <sbrk>
+  c = sbrk(-4096);
+    2eff:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    2f06:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2f08:	e8 be 0b 00 00       	call   3acb <sbrk>
+  if(c == (char*)0xffffffff){
+    2f0d:	83 c4 10             	add    $0x10,%esp
+    2f10:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f13:	0f 84 22 03 00 00    	je     323b <sbrktest+0x41b>
+  c = sbrk(0);
+    2f19:	83 ec 0c             	sub    $0xc,%esp
+    2f1c:	6a 00                	push   $0x0
+    2f1e:	e8 a8 0b 00 00       	call   3acb <sbrk>
+  if(c != a - 4096){
+    2f23:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2f29:	83 c4 10             	add    $0x10,%esp
+    2f2c:	39 d0                	cmp    %edx,%eax
+    2f2e:	0f 85 f0 02 00 00    	jne    3224 <sbrktest+0x404>
+  a = sbrk(0);
+    2f34:	83 ec 0c             	sub    $0xc,%esp
+    2f37:	6a 00                	push   $0x0
+    2f39:	e8 8d 0b 00 00       	call   3acb <sbrk>
+  c = sbrk(4096);
+    2f3e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    2f45:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2f47:	e8 7f 0b 00 00       	call   3acb <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    2f4c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    2f4f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2f51:	39 c3                	cmp    %eax,%ebx
+    2f53:	0f 85 b4 02 00 00    	jne    320d <sbrktest+0x3ed>
+    2f59:	83 ec 0c             	sub    $0xc,%esp
+    2f5c:	6a 00                	push   $0x0
+    2f5e:	e8 68 0b 00 00       	call   3acb <sbrk>
+    2f63:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2f69:	83 c4 10             	add    $0x10,%esp
+    2f6c:	39 c2                	cmp    %eax,%edx
+    2f6e:	0f 85 99 02 00 00    	jne    320d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    2f74:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2f7b:	0f 84 2f 02 00 00    	je     31b0 <sbrktest+0x390>
+  a = sbrk(0);
+    2f81:	83 ec 0c             	sub    $0xc,%esp
+    2f84:	6a 00                	push   $0x0
+    2f86:	e8 40 0b 00 00       	call   3acb <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2f8b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    2f92:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2f94:	e8 32 0b 00 00       	call   3acb <sbrk>
+    2f99:	89 c2                	mov    %eax,%edx
+    2f9b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2f9e:	29 d0                	sub    %edx,%eax
+    2fa0:	89 04 24             	mov    %eax,(%esp)
+    2fa3:	e8 23 0b 00 00       	call   3acb <sbrk>
+  if(c != a){
+    2fa8:	83 c4 10             	add    $0x10,%esp
+    2fab:	39 c3                	cmp    %eax,%ebx
+    2fad:	0f 85 b8 01 00 00    	jne    316b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2fb3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    2fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2fbf:	90                   	nop
+    ppid = getpid();
+    2fc0:	e8 fe 0a 00 00       	call   3ac3 <getpid>
+    2fc5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2fc7:	e8 6f 0a 00 00       	call   3a3b <fork>
+    if(pid < 0){
+    2fcc:	85 c0                	test   %eax,%eax
+    2fce:	0f 88 5d 01 00 00    	js     3131 <sbrktest+0x311>
+    if(pid == 0){
+    2fd4:	0f 84 6f 01 00 00    	je     3149 <sbrktest+0x329>
+    wait();
+    2fda:	e8 6c 0a 00 00       	call   3a4b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2fdf:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    2fe5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    2feb:	75 d3                	jne    2fc0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    2fed:	83 ec 0c             	sub    $0xc,%esp
+    2ff0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    2ff3:	50                   	push   %eax
+    2ff4:	e8 5a 0a 00 00       	call   3a53 <pipe>
+    2ff9:	83 c4 10             	add    $0x10,%esp
+    2ffc:	85 c0                	test   %eax,%eax
+    2ffe:	0f 85 da 01 00 00    	jne    31de <sbrktest+0x3be>
+    3004:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3007:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    300a:	89 df                	mov    %ebx,%edi
+    300c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3010:	e8 26 0a 00 00       	call   3a3b <fork>
+    3015:	89 07                	mov    %eax,(%edi)
+    3017:	85 c0                	test   %eax,%eax
+    3019:	0f 84 91 00 00 00    	je     30b0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    301f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3022:	74 14                	je     3038 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3024:	83 ec 04             	sub    $0x4,%esp
+    3027:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    302a:	6a 01                	push   $0x1
+    302c:	50                   	push   %eax
+    302d:	ff 75 b8             	push   -0x48(%ebp)
+    3030:	e8 26 0a 00 00       	call   3a5b <read>
+    3035:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3038:	83 c7 04             	add    $0x4,%edi
+    303b:	39 f7                	cmp    %esi,%edi
+    303d:	75 d1                	jne    3010 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    303f:	83 ec 0c             	sub    $0xc,%esp
+    3042:	68 00 10 00 00       	push   $0x1000
+    3047:	e8 7f 0a 00 00       	call   3acb <sbrk>
+    304c:	83 c4 10             	add    $0x10,%esp
+    304f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3051:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3058:	8b 03                	mov    (%ebx),%eax
+    305a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    305d:	74 11                	je     3070 <sbrktest+0x250>
+    kill(pids[i]);
+    305f:	83 ec 0c             	sub    $0xc,%esp
+    3062:	50                   	push   %eax
+    3063:	e8 0b 0a 00 00       	call   3a73 <kill>
+    wait();
+    3068:	e8 de 09 00 00       	call   3a4b <wait>
+    306d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3070:	83 c3 04             	add    $0x4,%ebx
+    3073:	39 f3                	cmp    %esi,%ebx
+    3075:	75 e1                	jne    3058 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3077:	83 ff ff             	cmp    $0xffffffff,%edi
+    307a:	0f 84 47 01 00 00    	je     31c7 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3080:	83 ec 0c             	sub    $0xc,%esp
+    3083:	6a 00                	push   $0x0
+    3085:	e8 41 0a 00 00       	call   3acb <sbrk>
+    308a:	83 c4 10             	add    $0x10,%esp
+    308d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3090:	72 60                	jb     30f2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3092:	83 ec 08             	sub    $0x8,%esp
+    3095:	68 8d 50 00 00       	push   $0x508d
+    309a:	ff 35 14 64 00 00    	push   0x6414
+    30a0:	e8 9b 0b 00 00       	call   3c40 <printf>
+}
+    30a5:	83 c4 10             	add    $0x10,%esp
+    30a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    30ab:	5b                   	pop    %ebx
+    30ac:	5e                   	pop    %esi
+    30ad:	5f                   	pop    %edi
+    30ae:	5d                   	pop    %ebp
+    30af:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    30b0:	83 ec 0c             	sub    $0xc,%esp
+    30b3:	6a 00                	push   $0x0
+    30b5:	e8 11 0a 00 00       	call   3acb <sbrk>
+    30ba:	89 c2                	mov    %eax,%edx
+    30bc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    30c1:	29 d0                	sub    %edx,%eax
+    30c3:	89 04 24             	mov    %eax,(%esp)
+    30c6:	e8 00 0a 00 00       	call   3acb <sbrk>
+      write(fds[1], "x", 1);
+    30cb:	83 c4 0c             	add    $0xc,%esp
+    30ce:	6a 01                	push   $0x1
+    30d0:	68 4e 4b 00 00       	push   $0x4b4e
+    30d5:	ff 75 bc             	push   -0x44(%ebp)
+    30d8:	e8 86 09 00 00       	call   3a63 <write>
+    30dd:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    30e0:	83 ec 0c             	sub    $0xc,%esp
+    30e3:	68 e8 03 00 00       	push   $0x3e8
+    30e8:	e8 e6 09 00 00       	call   3ad3 <sleep>
+    30ed:	83 c4 10             	add    $0x10,%esp
+    30f0:	eb ee                	jmp    30e0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    30f2:	83 ec 0c             	sub    $0xc,%esp
+    30f5:	6a 00                	push   $0x0
+    30f7:	e8 cf 09 00 00       	call   3acb <sbrk>
+    30fc:	89 c2                	mov    %eax,%edx
+    30fe:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3101:	29 d0                	sub    %edx,%eax
+    3103:	89 04 24             	mov    %eax,(%esp)
+    3106:	e8 c0 09 00 00       	call   3acb <sbrk>
+    310b:	83 c4 10             	add    $0x10,%esp
+    310e:	e9 7f ff ff ff       	jmp    3092 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3113:	83 ec 0c             	sub    $0xc,%esp
+    3116:	50                   	push   %eax
+    3117:	53                   	push   %ebx
+    3118:	56                   	push   %esi
+    3119:	68 f0 4f 00 00       	push   $0x4ff0
+    311e:	ff 35 14 64 00 00    	push   0x6414
+    3124:	e8 17 0b 00 00       	call   3c40 <printf>
+      exit();
+    3129:	83 c4 20             	add    $0x20,%esp
+    312c:	e8 12 09 00 00       	call   3a43 <exit>
+      printf(stdout, "fork failed\n");
+    3131:	83 ec 08             	sub    $0x8,%esp
+    3134:	68 36 51 00 00       	push   $0x5136
+    3139:	ff 35 14 64 00 00    	push   0x6414
+    313f:	e8 fc 0a 00 00       	call   3c40 <printf>
+      exit();
+    3144:	e8 fa 08 00 00       	call   3a43 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3149:	0f be 03             	movsbl (%ebx),%eax
+    314c:	50                   	push   %eax
+    314d:	53                   	push   %ebx
+    314e:	68 59 50 00 00       	push   $0x5059
+    3153:	ff 35 14 64 00 00    	push   0x6414
+    3159:	e8 e2 0a 00 00       	call   3c40 <printf>
+      kill(ppid);
+    315e:	89 34 24             	mov    %esi,(%esp)
+    3161:	e8 0d 09 00 00       	call   3a73 <kill>
+      exit();
+    3166:	e8 d8 08 00 00       	call   3a43 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    316b:	50                   	push   %eax
+    316c:	53                   	push   %ebx
+    316d:	68 38 58 00 00       	push   $0x5838
+    3172:	ff 35 14 64 00 00    	push   0x6414
+    3178:	e8 c3 0a 00 00       	call   3c40 <printf>
+    exit();
+    317d:	e8 c1 08 00 00       	call   3a43 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3182:	56                   	push   %esi
+    3183:	56                   	push   %esi
+    3184:	68 68 57 00 00       	push   $0x5768
+    3189:	ff 35 14 64 00 00    	push   0x6414
+    318f:	e8 ac 0a 00 00       	call   3c40 <printf>
+    exit();
+    3194:	e8 aa 08 00 00       	call   3a43 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3199:	50                   	push   %eax
+    319a:	50                   	push   %eax
+    319b:	68 0b 50 00 00       	push   $0x500b
+    31a0:	ff 35 14 64 00 00    	push   0x6414
+    31a6:	e8 95 0a 00 00       	call   3c40 <printf>
+    exit();
+    31ab:	e8 93 08 00 00       	call   3a43 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    31b0:	51                   	push   %ecx
+    31b1:	51                   	push   %ecx
+    31b2:	68 08 58 00 00       	push   $0x5808
+    31b7:	ff 35 14 64 00 00    	push   0x6414
+    31bd:	e8 7e 0a 00 00       	call   3c40 <printf>
+    exit();
+    31c2:	e8 7c 08 00 00       	call   3a43 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    31c7:	50                   	push   %eax
+    31c8:	50                   	push   %eax
+    31c9:	68 72 50 00 00       	push   $0x5072
+    31ce:	ff 35 14 64 00 00    	push   0x6414
+    31d4:	e8 67 0a 00 00       	call   3c40 <printf>
+    exit();
+    31d9:	e8 65 08 00 00       	call   3a43 <exit>
+    printf(1, "pipe() failed\n");
+    31de:	52                   	push   %edx
+    31df:	52                   	push   %edx
+    31e0:	68 2e 45 00 00       	push   $0x452e
+    31e5:	6a 01                	push   $0x1
+    31e7:	e8 54 0a 00 00       	call   3c40 <printf>
+    exit();
+    31ec:	e8 52 08 00 00       	call   3a43 <exit>
+    exit();
+    31f1:	e8 4d 08 00 00       	call   3a43 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    31f6:	57                   	push   %edi
+    31f7:	57                   	push   %edi
+    31f8:	68 22 50 00 00       	push   $0x5022
+    31fd:	ff 35 14 64 00 00    	push   0x6414
+    3203:	e8 38 0a 00 00       	call   3c40 <printf>
+    exit();
+    3208:	e8 36 08 00 00       	call   3a43 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    320d:	56                   	push   %esi
+    320e:	53                   	push   %ebx
+    320f:	68 e0 57 00 00       	push   $0x57e0
+    3214:	ff 35 14 64 00 00    	push   0x6414
+    321a:	e8 21 0a 00 00       	call   3c40 <printf>
+    exit();
+    321f:	e8 1f 08 00 00       	call   3a43 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3224:	50                   	push   %eax
+    3225:	53                   	push   %ebx
+    3226:	68 a8 57 00 00       	push   $0x57a8
+    322b:	ff 35 14 64 00 00    	push   0x6414
+    3231:	e8 0a 0a 00 00       	call   3c40 <printf>
+    exit();
+    3236:	e8 08 08 00 00       	call   3a43 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    323b:	53                   	push   %ebx
+    323c:	53                   	push   %ebx
+    323d:	68 3e 50 00 00       	push   $0x503e
+    3242:	ff 35 14 64 00 00    	push   0x6414
+    3248:	e8 f3 09 00 00       	call   3c40 <printf>
+    exit();
+    324d:	e8 f1 07 00 00       	call   3a43 <exit>
+    3252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003260 <validateint>:
+}
+    3260:	c3                   	ret
+    3261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    326f:	90                   	nop
+
+00003270 <validatetest>:
+{
+    3270:	55                   	push   %ebp
+    3271:	89 e5                	mov    %esp,%ebp
+    3273:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3274:	31 f6                	xor    %esi,%esi
+{
+    3276:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3277:	83 ec 08             	sub    $0x8,%esp
+    327a:	68 9b 50 00 00       	push   $0x509b
+    327f:	ff 35 14 64 00 00    	push   0x6414
+    3285:	e8 b6 09 00 00       	call   3c40 <printf>
+    328a:	83 c4 10             	add    $0x10,%esp
+    328d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3290:	e8 a6 07 00 00       	call   3a3b <fork>
+    3295:	89 c3                	mov    %eax,%ebx
+    3297:	85 c0                	test   %eax,%eax
+    3299:	74 63                	je     32fe <validatetest+0x8e>
+    sleep(0);
+    329b:	83 ec 0c             	sub    $0xc,%esp
+    329e:	6a 00                	push   $0x0
+    32a0:	e8 2e 08 00 00       	call   3ad3 <sleep>
+    sleep(0);
+    32a5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    32ac:	e8 22 08 00 00       	call   3ad3 <sleep>
+    kill(pid);
+    32b1:	89 1c 24             	mov    %ebx,(%esp)
+    32b4:	e8 ba 07 00 00       	call   3a73 <kill>
+    wait();
+    32b9:	e8 8d 07 00 00       	call   3a4b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    32be:	58                   	pop    %eax
+    32bf:	5a                   	pop    %edx
+    32c0:	56                   	push   %esi
+    32c1:	68 aa 50 00 00       	push   $0x50aa
+    32c6:	e8 d8 07 00 00       	call   3aa3 <link>
+    32cb:	83 c4 10             	add    $0x10,%esp
+    32ce:	83 f8 ff             	cmp    $0xffffffff,%eax
+    32d1:	75 30                	jne    3303 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    32d3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    32d9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    32df:	75 af                	jne    3290 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    32e1:	83 ec 08             	sub    $0x8,%esp
+    32e4:	68 ce 50 00 00       	push   $0x50ce
+    32e9:	ff 35 14 64 00 00    	push   0x6414
+    32ef:	e8 4c 09 00 00       	call   3c40 <printf>
+}
+    32f4:	83 c4 10             	add    $0x10,%esp
+    32f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    32fa:	5b                   	pop    %ebx
+    32fb:	5e                   	pop    %esi
+    32fc:	5d                   	pop    %ebp
+    32fd:	c3                   	ret
+      exit();
+    32fe:	e8 40 07 00 00       	call   3a43 <exit>
+      printf(stdout, "link should not succeed\n");
+    3303:	83 ec 08             	sub    $0x8,%esp
+    3306:	68 b5 50 00 00       	push   $0x50b5
+    330b:	ff 35 14 64 00 00    	push   0x6414
+    3311:	e8 2a 09 00 00       	call   3c40 <printf>
+      exit();
+    3316:	e8 28 07 00 00       	call   3a43 <exit>
+    331b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    331f:	90                   	nop
+
+00003320 <bsstest>:
+{
+    3320:	55                   	push   %ebp
+    3321:	89 e5                	mov    %esp,%ebp
+    3323:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3326:	68 db 50 00 00       	push   $0x50db
+    332b:	ff 35 14 64 00 00    	push   0x6414
+    3331:	e8 0a 09 00 00       	call   3c40 <printf>
+    3336:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3339:	31 c0                	xor    %eax,%eax
+    333b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    333f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3340:	80 b8 40 64 00 00 00 	cmpb   $0x0,0x6440(%eax)
+    3347:	75 22                	jne    336b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3349:	83 c0 01             	add    $0x1,%eax
+    334c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3351:	75 ed                	jne    3340 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3353:	83 ec 08             	sub    $0x8,%esp
+    3356:	68 f6 50 00 00       	push   $0x50f6
+    335b:	ff 35 14 64 00 00    	push   0x6414
+    3361:	e8 da 08 00 00       	call   3c40 <printf>
+}
+    3366:	83 c4 10             	add    $0x10,%esp
+    3369:	c9                   	leave
+    336a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    336b:	83 ec 08             	sub    $0x8,%esp
+    336e:	68 e5 50 00 00       	push   $0x50e5
+    3373:	ff 35 14 64 00 00    	push   0x6414
+    3379:	e8 c2 08 00 00       	call   3c40 <printf>
+      exit();
+    337e:	e8 c0 06 00 00       	call   3a43 <exit>
+    3383:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    338a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003390 <bigargtest>:
+{
+    3390:	55                   	push   %ebp
+    3391:	89 e5                	mov    %esp,%ebp
+    3393:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3396:	68 03 51 00 00       	push   $0x5103
+    339b:	e8 f3 06 00 00       	call   3a93 <unlink>
+  pid = fork();
+    33a0:	e8 96 06 00 00       	call   3a3b <fork>
+  if(pid == 0){
+    33a5:	83 c4 10             	add    $0x10,%esp
+    33a8:	85 c0                	test   %eax,%eax
+    33aa:	74 44                	je     33f0 <bigargtest+0x60>
+  } else if(pid < 0){
+    33ac:	0f 88 c3 00 00 00    	js     3475 <bigargtest+0xe5>
+  wait();
+    33b2:	e8 94 06 00 00       	call   3a4b <wait>
+  fd = open("bigarg-ok", 0);
+    33b7:	83 ec 08             	sub    $0x8,%esp
+    33ba:	6a 00                	push   $0x0
+    33bc:	68 03 51 00 00       	push   $0x5103
+    33c1:	e8 bd 06 00 00       	call   3a83 <open>
+  if(fd < 0){
+    33c6:	83 c4 10             	add    $0x10,%esp
+    33c9:	85 c0                	test   %eax,%eax
+    33cb:	0f 88 8d 00 00 00    	js     345e <bigargtest+0xce>
+  close(fd);
+    33d1:	83 ec 0c             	sub    $0xc,%esp
+    33d4:	50                   	push   %eax
+    33d5:	e8 91 06 00 00       	call   3a6b <close>
+  unlink("bigarg-ok");
+    33da:	c7 04 24 03 51 00 00 	movl   $0x5103,(%esp)
+    33e1:	e8 ad 06 00 00       	call   3a93 <unlink>
+}
+    33e6:	83 c4 10             	add    $0x10,%esp
+    33e9:	c9                   	leave
+    33ea:	c3                   	ret
+    33eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    33ef:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    33f0:	c7 04 85 60 ab 00 00 	movl   $0x585c,0xab60(,%eax,4)
+    33f7:	5c 58 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    33fb:	83 c0 01             	add    $0x1,%eax
+    33fe:	83 f8 1f             	cmp    $0x1f,%eax
+    3401:	75 ed                	jne    33f0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3403:	31 c9                	xor    %ecx,%ecx
+    3405:	89 0d dc ab 00 00    	mov    %ecx,0xabdc
+    printf(stdout, "bigarg test\n");
+    340b:	50                   	push   %eax
+    340c:	50                   	push   %eax
+    340d:	68 0d 51 00 00       	push   $0x510d
+    3412:	ff 35 14 64 00 00    	push   0x6414
+    3418:	e8 23 08 00 00       	call   3c40 <printf>
+    exec("echo", args);
+    341d:	58                   	pop    %eax
+    341e:	5a                   	pop    %edx
+    341f:	68 60 ab 00 00       	push   $0xab60
+    3424:	68 6d 42 00 00       	push   $0x426d
+    3429:	e8 4d 06 00 00       	call   3a7b <exec>
+    printf(stdout, "bigarg test ok\n");
+    342e:	59                   	pop    %ecx
+    342f:	58                   	pop    %eax
+    3430:	68 1a 51 00 00       	push   $0x511a
+    3435:	ff 35 14 64 00 00    	push   0x6414
+    343b:	e8 00 08 00 00       	call   3c40 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3440:	58                   	pop    %eax
+    3441:	5a                   	pop    %edx
+    3442:	68 00 02 00 00       	push   $0x200
+    3447:	68 03 51 00 00       	push   $0x5103
+    344c:	e8 32 06 00 00       	call   3a83 <open>
+    close(fd);
+    3451:	89 04 24             	mov    %eax,(%esp)
+    3454:	e8 12 06 00 00       	call   3a6b <close>
+    exit();
+    3459:	e8 e5 05 00 00       	call   3a43 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    345e:	50                   	push   %eax
+    345f:	50                   	push   %eax
+    3460:	68 43 51 00 00       	push   $0x5143
+    3465:	ff 35 14 64 00 00    	push   0x6414
+    346b:	e8 d0 07 00 00       	call   3c40 <printf>
+    exit();
+    3470:	e8 ce 05 00 00       	call   3a43 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3475:	52                   	push   %edx
+    3476:	52                   	push   %edx
+    3477:	68 2a 51 00 00       	push   $0x512a
+    347c:	ff 35 14 64 00 00    	push   0x6414
+    3482:	e8 b9 07 00 00       	call   3c40 <printf>
+    exit();
+    3487:	e8 b7 05 00 00       	call   3a43 <exit>
+    348c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003490 <fsfull>:
+{
+    3490:	55                   	push   %ebp
+    3491:	89 e5                	mov    %esp,%ebp
+    3493:	57                   	push   %edi
+    3494:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3495:	31 f6                	xor    %esi,%esi
+{
+    3497:	53                   	push   %ebx
+    3498:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    349b:	68 58 51 00 00       	push   $0x5158
+    34a0:	6a 01                	push   $0x1
+    34a2:	e8 99 07 00 00       	call   3c40 <printf>
+    34a7:	83 c4 10             	add    $0x10,%esp
+    34aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    34b0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    34b5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    34ba:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    34bd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    34c1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    34c3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    34c7:	c1 ea 06             	shr    $0x6,%edx
+    34ca:	8d 42 30             	lea    0x30(%edx),%eax
+    34cd:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    34d0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    34d6:	89 f2                	mov    %esi,%edx
+    34d8:	29 c2                	sub    %eax,%edx
+    34da:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    34df:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    34e1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    34e6:	c1 ea 05             	shr    $0x5,%edx
+    34e9:	83 c2 30             	add    $0x30,%edx
+    34ec:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    34ef:	f7 e6                	mul    %esi
+    34f1:	c1 ea 05             	shr    $0x5,%edx
+    34f4:	6b c2 64             	imul   $0x64,%edx,%eax
+    34f7:	89 f2                	mov    %esi,%edx
+    34f9:	29 c2                	sub    %eax,%edx
+    34fb:	89 d0                	mov    %edx,%eax
+    34fd:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    34ff:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3501:	c1 ea 03             	shr    $0x3,%edx
+    3504:	83 c2 30             	add    $0x30,%edx
+    3507:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    350a:	f7 e1                	mul    %ecx
+    350c:	89 f0                	mov    %esi,%eax
+    350e:	c1 ea 03             	shr    $0x3,%edx
+    3511:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3514:	01 d2                	add    %edx,%edx
+    3516:	29 d0                	sub    %edx,%eax
+    3518:	83 c0 30             	add    $0x30,%eax
+    351b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    351e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3521:	50                   	push   %eax
+    3522:	68 65 51 00 00       	push   $0x5165
+    3527:	6a 01                	push   $0x1
+    3529:	e8 12 07 00 00       	call   3c40 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    352e:	58                   	pop    %eax
+    352f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3532:	5a                   	pop    %edx
+    3533:	68 02 02 00 00       	push   $0x202
+    3538:	50                   	push   %eax
+    3539:	e8 45 05 00 00       	call   3a83 <open>
+    if(fd < 0){
+    353e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3541:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3543:	85 c0                	test   %eax,%eax
+    3545:	78 4f                	js     3596 <fsfull+0x106>
+    int total = 0;
+    3547:	31 db                	xor    %ebx,%ebx
+    3549:	eb 07                	jmp    3552 <fsfull+0xc2>
+    354b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    354f:	90                   	nop
+      total += cc;
+    3550:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3552:	83 ec 04             	sub    $0x4,%esp
+    3555:	68 00 02 00 00       	push   $0x200
+    355a:	68 60 8b 00 00       	push   $0x8b60
+    355f:	57                   	push   %edi
+    3560:	e8 fe 04 00 00       	call   3a63 <write>
+      if(cc < 512)
+    3565:	83 c4 10             	add    $0x10,%esp
+    3568:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    356d:	7f e1                	jg     3550 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    356f:	83 ec 04             	sub    $0x4,%esp
+    3572:	53                   	push   %ebx
+    3573:	68 81 51 00 00       	push   $0x5181
+    3578:	6a 01                	push   $0x1
+    357a:	e8 c1 06 00 00       	call   3c40 <printf>
+    close(fd);
+    357f:	89 3c 24             	mov    %edi,(%esp)
+    3582:	e8 e4 04 00 00       	call   3a6b <close>
+    if(total == 0)
+    3587:	83 c4 10             	add    $0x10,%esp
+    358a:	85 db                	test   %ebx,%ebx
+    358c:	74 1e                	je     35ac <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    358e:	83 c6 01             	add    $0x1,%esi
+    3591:	e9 1a ff ff ff       	jmp    34b0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3596:	83 ec 04             	sub    $0x4,%esp
+    3599:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    359c:	50                   	push   %eax
+    359d:	68 71 51 00 00       	push   $0x5171
+    35a2:	6a 01                	push   $0x1
+    35a4:	e8 97 06 00 00       	call   3c40 <printf>
+      break;
+    35a9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    35ac:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    35b1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    35b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    35bd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    35c0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    35c2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    35c5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    35c9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    35cb:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    35cf:	c1 ea 06             	shr    $0x6,%edx
+    35d2:	8d 42 30             	lea    0x30(%edx),%eax
+    35d5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    35d8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    35de:	89 f2                	mov    %esi,%edx
+    35e0:	29 c2                	sub    %eax,%edx
+    35e2:	89 d0                	mov    %edx,%eax
+    35e4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    35e6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    35e8:	c1 ea 05             	shr    $0x5,%edx
+    35eb:	83 c2 30             	add    $0x30,%edx
+    35ee:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    35f1:	f7 e3                	mul    %ebx
+    35f3:	c1 ea 05             	shr    $0x5,%edx
+    35f6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    35f9:	89 f2                	mov    %esi,%edx
+    35fb:	29 ca                	sub    %ecx,%edx
+    35fd:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3602:	89 d0                	mov    %edx,%eax
+    3604:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3606:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3608:	c1 ea 03             	shr    $0x3,%edx
+    360b:	83 c2 30             	add    $0x30,%edx
+    360e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3611:	f7 e1                	mul    %ecx
+    3613:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3615:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3618:	c1 ea 03             	shr    $0x3,%edx
+    361b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    361e:	01 d2                	add    %edx,%edx
+    3620:	29 d0                	sub    %edx,%eax
+    3622:	83 c0 30             	add    $0x30,%eax
+    3625:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3628:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    362b:	50                   	push   %eax
+    362c:	e8 62 04 00 00       	call   3a93 <unlink>
+  while(nfiles >= 0){
+    3631:	83 c4 10             	add    $0x10,%esp
+    3634:	83 fe ff             	cmp    $0xffffffff,%esi
+    3637:	75 87                	jne    35c0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3639:	83 ec 08             	sub    $0x8,%esp
+    363c:	68 91 51 00 00       	push   $0x5191
+    3641:	6a 01                	push   $0x1
+    3643:	e8 f8 05 00 00       	call   3c40 <printf>
+}
+    3648:	83 c4 10             	add    $0x10,%esp
+    364b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    364e:	5b                   	pop    %ebx
+    364f:	5e                   	pop    %esi
+    3650:	5f                   	pop    %edi
+    3651:	5d                   	pop    %ebp
+    3652:	c3                   	ret
+    3653:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    365a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003660 <uio>:
+{
+    3660:	55                   	push   %ebp
+    3661:	89 e5                	mov    %esp,%ebp
+    3663:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3666:	68 a7 51 00 00       	push   $0x51a7
+    366b:	6a 01                	push   $0x1
+    366d:	e8 ce 05 00 00       	call   3c40 <printf>
+  pid = fork();
+    3672:	e8 c4 03 00 00       	call   3a3b <fork>
+  if(pid == 0){
+    3677:	83 c4 10             	add    $0x10,%esp
+    367a:	85 c0                	test   %eax,%eax
+    367c:	74 1b                	je     3699 <uio+0x39>
+  } else if(pid < 0){
+    367e:	78 3d                	js     36bd <uio+0x5d>
+  wait();
+    3680:	e8 c6 03 00 00       	call   3a4b <wait>
+  printf(1, "uio test done\n");
+    3685:	83 ec 08             	sub    $0x8,%esp
+    3688:	68 b1 51 00 00       	push   $0x51b1
+    368d:	6a 01                	push   $0x1
+    368f:	e8 ac 05 00 00       	call   3c40 <printf>
+}
+    3694:	83 c4 10             	add    $0x10,%esp
+    3697:	c9                   	leave
+    3698:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3699:	b8 09 00 00 00       	mov    $0x9,%eax
+    369e:	ba 70 00 00 00       	mov    $0x70,%edx
+    36a3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    36a4:	ba 71 00 00 00       	mov    $0x71,%edx
+    36a9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    36aa:	52                   	push   %edx
+    36ab:	52                   	push   %edx
+    36ac:	68 3c 59 00 00       	push   $0x593c
+    36b1:	6a 01                	push   $0x1
+    36b3:	e8 88 05 00 00       	call   3c40 <printf>
+    exit();
+    36b8:	e8 86 03 00 00       	call   3a43 <exit>
+    printf (1, "fork failed\n");
+    36bd:	50                   	push   %eax
+    36be:	50                   	push   %eax
+    36bf:	68 36 51 00 00       	push   $0x5136
+    36c4:	6a 01                	push   $0x1
+    36c6:	e8 75 05 00 00       	call   3c40 <printf>
+    exit();
+    36cb:	e8 73 03 00 00       	call   3a43 <exit>
+
+000036d0 <argptest>:
+{
+    36d0:	55                   	push   %ebp
+    36d1:	89 e5                	mov    %esp,%ebp
+    36d3:	53                   	push   %ebx
+    36d4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    36d7:	6a 00                	push   $0x0
+    36d9:	68 c0 51 00 00       	push   $0x51c0
+    36de:	e8 a0 03 00 00       	call   3a83 <open>
+  if (fd < 0) {
+    36e3:	83 c4 10             	add    $0x10,%esp
+    36e6:	85 c0                	test   %eax,%eax
+    36e8:	78 39                	js     3723 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    36ea:	83 ec 0c             	sub    $0xc,%esp
+    36ed:	89 c3                	mov    %eax,%ebx
+    36ef:	6a 00                	push   $0x0
+    36f1:	e8 d5 03 00 00       	call   3acb <sbrk>
+    36f6:	83 c4 0c             	add    $0xc,%esp
+    36f9:	83 e8 01             	sub    $0x1,%eax
+    36fc:	6a ff                	push   $0xffffffff
+    36fe:	50                   	push   %eax
+    36ff:	53                   	push   %ebx
+    3700:	e8 56 03 00 00       	call   3a5b <read>
+  close(fd);
+    3705:	89 1c 24             	mov    %ebx,(%esp)
+    3708:	e8 5e 03 00 00       	call   3a6b <close>
+  printf(1, "arg test passed\n");
+    370d:	58                   	pop    %eax
+    370e:	5a                   	pop    %edx
+    370f:	68 d2 51 00 00       	push   $0x51d2
+    3714:	6a 01                	push   $0x1
+    3716:	e8 25 05 00 00       	call   3c40 <printf>
+}
+    371b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    371e:	83 c4 10             	add    $0x10,%esp
+    3721:	c9                   	leave
+    3722:	c3                   	ret
+    printf(2, "open failed\n");
+    3723:	51                   	push   %ecx
+    3724:	51                   	push   %ecx
+    3725:	68 c5 51 00 00       	push   $0x51c5
+    372a:	6a 02                	push   $0x2
+    372c:	e8 0f 05 00 00       	call   3c40 <printf>
+    exit();
+    3731:	e8 0d 03 00 00       	call   3a43 <exit>
+    3736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    373d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003740 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3740:	69 05 10 64 00 00 0d 	imul   $0x19660d,0x6410,%eax
+    3747:	66 19 00 
+    374a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    374f:	a3 10 64 00 00       	mov    %eax,0x6410
+}
+    3754:	c3                   	ret
+    3755:	66 90                	xchg   %ax,%ax
+    3757:	66 90                	xchg   %ax,%ax
+    3759:	66 90                	xchg   %ax,%ax
+    375b:	66 90                	xchg   %ax,%ax
+    375d:	66 90                	xchg   %ax,%ax
+    375f:	90                   	nop
+
+00003760 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    3760:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3761:	31 c0                	xor    %eax,%eax
+{
+    3763:	89 e5                	mov    %esp,%ebp
+    3765:	53                   	push   %ebx
+    3766:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3769:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    376c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3770:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3774:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3777:	83 c0 01             	add    $0x1,%eax
+    377a:	84 d2                	test   %dl,%dl
+    377c:	75 f2                	jne    3770 <strcpy+0x10>
+    ;
+  return os;
+}
+    377e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3781:	89 c8                	mov    %ecx,%eax
+    3783:	c9                   	leave
+    3784:	c3                   	ret
+    3785:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    378c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003790 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    3790:	55                   	push   %ebp
+    3791:	89 e5                	mov    %esp,%ebp
+    3793:	53                   	push   %ebx
+    3794:	8b 55 08             	mov    0x8(%ebp),%edx
+    3797:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    379a:	0f b6 02             	movzbl (%edx),%eax
+    379d:	84 c0                	test   %al,%al
+    379f:	75 17                	jne    37b8 <strcmp+0x28>
+    37a1:	eb 3a                	jmp    37dd <strcmp+0x4d>
+    37a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    37a7:	90                   	nop
+    37a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    37ac:	83 c2 01             	add    $0x1,%edx
+    37af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    37b2:	84 c0                	test   %al,%al
+    37b4:	74 1a                	je     37d0 <strcmp+0x40>
+    p++, q++;
+    37b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    37b8:	0f b6 19             	movzbl (%ecx),%ebx
+    37bb:	38 c3                	cmp    %al,%bl
+    37bd:	74 e9                	je     37a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    37bf:	29 d8                	sub    %ebx,%eax
+}
+    37c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    37c4:	c9                   	leave
+    37c5:	c3                   	ret
+    37c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    37d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    37d4:	31 c0                	xor    %eax,%eax
+    37d6:	29 d8                	sub    %ebx,%eax
+}
+    37d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    37db:	c9                   	leave
+    37dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    37dd:	0f b6 19             	movzbl (%ecx),%ebx
+    37e0:	31 c0                	xor    %eax,%eax
+    37e2:	eb db                	jmp    37bf <strcmp+0x2f>
+    37e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    37ef:	90                   	nop
+
+000037f0 <strlen>:
+
+uint
+strlen(char *s)
+{
+    37f0:	55                   	push   %ebp
+    37f1:	89 e5                	mov    %esp,%ebp
+    37f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    37f6:	80 3a 00             	cmpb   $0x0,(%edx)
+    37f9:	74 15                	je     3810 <strlen+0x20>
+    37fb:	31 c0                	xor    %eax,%eax
+    37fd:	8d 76 00             	lea    0x0(%esi),%esi
+    3800:	83 c0 01             	add    $0x1,%eax
+    3803:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3807:	89 c1                	mov    %eax,%ecx
+    3809:	75 f5                	jne    3800 <strlen+0x10>
+    ;
+  return n;
+}
+    380b:	89 c8                	mov    %ecx,%eax
+    380d:	5d                   	pop    %ebp
+    380e:	c3                   	ret
+    380f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3810:	31 c9                	xor    %ecx,%ecx
+}
+    3812:	5d                   	pop    %ebp
+    3813:	89 c8                	mov    %ecx,%eax
+    3815:	c3                   	ret
+    3816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    381d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003820 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3820:	55                   	push   %ebp
+    3821:	89 e5                	mov    %esp,%ebp
+    3823:	57                   	push   %edi
+    3824:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3827:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    382a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    382d:	89 d7                	mov    %edx,%edi
+    382f:	fc                   	cld
+    3830:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    3832:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3835:	89 d0                	mov    %edx,%eax
+    3837:	c9                   	leave
+    3838:	c3                   	ret
+    3839:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003840 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3840:	55                   	push   %ebp
+    3841:	89 e5                	mov    %esp,%ebp
+    3843:	8b 45 08             	mov    0x8(%ebp),%eax
+    3846:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    384a:	0f b6 10             	movzbl (%eax),%edx
+    384d:	84 d2                	test   %dl,%dl
+    384f:	75 12                	jne    3863 <strchr+0x23>
+    3851:	eb 1d                	jmp    3870 <strchr+0x30>
+    3853:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3857:	90                   	nop
+    3858:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    385c:	83 c0 01             	add    $0x1,%eax
+    385f:	84 d2                	test   %dl,%dl
+    3861:	74 0d                	je     3870 <strchr+0x30>
+    if(*s == c)
+    3863:	38 d1                	cmp    %dl,%cl
+    3865:	75 f1                	jne    3858 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    3867:	5d                   	pop    %ebp
+    3868:	c3                   	ret
+    3869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    3870:	31 c0                	xor    %eax,%eax
+}
+    3872:	5d                   	pop    %ebp
+    3873:	c3                   	ret
+    3874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    387b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    387f:	90                   	nop
+
+00003880 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3880:	55                   	push   %ebp
+    3881:	89 e5                	mov    %esp,%ebp
+    3883:	57                   	push   %edi
+    3884:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    3885:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    3888:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    3889:	31 db                	xor    %ebx,%ebx
+{
+    388b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    388e:	eb 27                	jmp    38b7 <gets+0x37>
+    cc = read(0, &c, 1);
+    3890:	83 ec 04             	sub    $0x4,%esp
+    3893:	6a 01                	push   $0x1
+    3895:	56                   	push   %esi
+    3896:	6a 00                	push   $0x0
+    3898:	e8 be 01 00 00       	call   3a5b <read>
+    if(cc < 1)
+    389d:	83 c4 10             	add    $0x10,%esp
+    38a0:	85 c0                	test   %eax,%eax
+    38a2:	7e 1d                	jle    38c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    38a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    38a8:	8b 55 08             	mov    0x8(%ebp),%edx
+    38ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    38af:	3c 0a                	cmp    $0xa,%al
+    38b1:	74 10                	je     38c3 <gets+0x43>
+    38b3:	3c 0d                	cmp    $0xd,%al
+    38b5:	74 0c                	je     38c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    38b7:	89 df                	mov    %ebx,%edi
+    38b9:	83 c3 01             	add    $0x1,%ebx
+    38bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    38bf:	7c cf                	jl     3890 <gets+0x10>
+    38c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    38c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    38c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    38ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    38cd:	5b                   	pop    %ebx
+    38ce:	5e                   	pop    %esi
+    38cf:	5f                   	pop    %edi
+    38d0:	5d                   	pop    %ebp
+    38d1:	c3                   	ret
+    38d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    38d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000038e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    38e0:	55                   	push   %ebp
+    38e1:	89 e5                	mov    %esp,%ebp
+    38e3:	56                   	push   %esi
+    38e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    38e5:	83 ec 08             	sub    $0x8,%esp
+    38e8:	6a 00                	push   $0x0
+    38ea:	ff 75 08             	push   0x8(%ebp)
+    38ed:	e8 91 01 00 00       	call   3a83 <open>
+  if(fd < 0)
+    38f2:	83 c4 10             	add    $0x10,%esp
+    38f5:	85 c0                	test   %eax,%eax
+    38f7:	78 27                	js     3920 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    38f9:	83 ec 08             	sub    $0x8,%esp
+    38fc:	ff 75 0c             	push   0xc(%ebp)
+    38ff:	89 c3                	mov    %eax,%ebx
+    3901:	50                   	push   %eax
+    3902:	e8 94 01 00 00       	call   3a9b <fstat>
+  close(fd);
+    3907:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    390a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    390c:	e8 5a 01 00 00       	call   3a6b <close>
+  return r;
+    3911:	83 c4 10             	add    $0x10,%esp
+}
+    3914:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3917:	89 f0                	mov    %esi,%eax
+    3919:	5b                   	pop    %ebx
+    391a:	5e                   	pop    %esi
+    391b:	5d                   	pop    %ebp
+    391c:	c3                   	ret
+    391d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    3920:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3925:	eb ed                	jmp    3914 <stat+0x34>
+    3927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    392e:	66 90                	xchg   %ax,%ax
+
+00003930 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+    3930:	55                   	push   %ebp
+    3931:	89 e5                	mov    %esp,%ebp
+    3933:	56                   	push   %esi
+    3934:	53                   	push   %ebx
+    3935:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    3938:	0f b6 02             	movzbl (%edx),%eax
+    393b:	3c 20                	cmp    $0x20,%al
+    393d:	75 0c                	jne    394b <atoi+0x1b>
+    393f:	90                   	nop
+    3940:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    3944:	83 c2 01             	add    $0x1,%edx
+    3947:	3c 20                	cmp    $0x20,%al
+    3949:	74 f5                	je     3940 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    394b:	3c 2d                	cmp    $0x2d,%al
+    394d:	74 41                	je     3990 <atoi+0x60>
+    394f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    3954:	3c 2b                	cmp    $0x2b,%al
+    3956:	74 3d                	je     3995 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+    3958:	0f be 0a             	movsbl (%edx),%ecx
+    395b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    395e:	3c 09                	cmp    $0x9,%al
+    3960:	b8 00 00 00 00       	mov    $0x0,%eax
+    3965:	77 21                	ja     3988 <atoi+0x58>
+    3967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    396e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    3970:	83 c2 01             	add    $0x1,%edx
+    3973:	8d 04 80             	lea    (%eax,%eax,4),%eax
+    3976:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+    397a:	0f be 0a             	movsbl (%edx),%ecx
+    397d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    3980:	80 fb 09             	cmp    $0x9,%bl
+    3983:	76 eb                	jbe    3970 <atoi+0x40>
+  return sign*n;
+    3985:	0f af c6             	imul   %esi,%eax
+}
+    3988:	5b                   	pop    %ebx
+    3989:	5e                   	pop    %esi
+    398a:	5d                   	pop    %ebp
+    398b:	c3                   	ret
+    398c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+    3990:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    3995:	83 c2 01             	add    $0x1,%edx
+    3998:	eb be                	jmp    3958 <atoi+0x28>
+    399a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000039a0 <atoo>:
+
+int
+atoo(const char *s)
+{
+    39a0:	55                   	push   %ebp
+    39a1:	89 e5                	mov    %esp,%ebp
+    39a3:	56                   	push   %esi
+    39a4:	53                   	push   %ebx
+    39a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    39a8:	0f b6 02             	movzbl (%edx),%eax
+    39ab:	3c 20                	cmp    $0x20,%al
+    39ad:	75 0c                	jne    39bb <atoo+0x1b>
+    39af:	90                   	nop
+    39b0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    39b4:	83 c2 01             	add    $0x1,%edx
+    39b7:	3c 20                	cmp    $0x20,%al
+    39b9:	74 f5                	je     39b0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+    39bb:	3c 2d                	cmp    $0x2d,%al
+    39bd:	74 41                	je     3a00 <atoo+0x60>
+    39bf:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    39c4:	3c 2b                	cmp    $0x2b,%al
+    39c6:	74 3d                	je     3a05 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+    39c8:	0f be 0a             	movsbl (%edx),%ecx
+    39cb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+    39ce:	3c 07                	cmp    $0x7,%al
+    39d0:	b8 00 00 00 00       	mov    $0x0,%eax
+    39d5:	77 1e                	ja     39f5 <atoo+0x55>
+    39d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39de:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+    39e0:	83 c2 01             	add    $0x1,%edx
+    39e3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+    39e7:	0f be 0a             	movsbl (%edx),%ecx
+    39ea:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    39ed:	80 fb 07             	cmp    $0x7,%bl
+    39f0:	76 ee                	jbe    39e0 <atoo+0x40>
+  return sign*n;
+    39f2:	0f af c6             	imul   %esi,%eax
+}
+    39f5:	5b                   	pop    %ebx
+    39f6:	5e                   	pop    %esi
+    39f7:	5d                   	pop    %ebp
+    39f8:	c3                   	ret
+    39f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+    3a00:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+    3a05:	83 c2 01             	add    $0x1,%edx
+    3a08:	eb be                	jmp    39c8 <atoo+0x28>
+    3a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003a10 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    3a10:	55                   	push   %ebp
+    3a11:	89 e5                	mov    %esp,%ebp
+    3a13:	57                   	push   %edi
+    3a14:	56                   	push   %esi
+    3a15:	8b 45 10             	mov    0x10(%ebp),%eax
+    3a18:	8b 55 08             	mov    0x8(%ebp),%edx
+    3a1b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    3a1e:	85 c0                	test   %eax,%eax
+    3a20:	7e 13                	jle    3a35 <memmove+0x25>
+    3a22:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    3a24:	89 d7                	mov    %edx,%edi
+    3a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    3a30:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    3a31:	39 f8                	cmp    %edi,%eax
+    3a33:	75 fb                	jne    3a30 <memmove+0x20>
+  return vdst;
+}
+    3a35:	5e                   	pop    %esi
+    3a36:	89 d0                	mov    %edx,%eax
+    3a38:	5f                   	pop    %edi
+    3a39:	5d                   	pop    %ebp
+    3a3a:	c3                   	ret
+
+00003a3b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3a3b:	b8 01 00 00 00       	mov    $0x1,%eax
+    3a40:	cd 40                	int    $0x40
+    3a42:	c3                   	ret
+
+00003a43 <exit>:
+SYSCALL(exit)
+    3a43:	b8 02 00 00 00       	mov    $0x2,%eax
+    3a48:	cd 40                	int    $0x40
+    3a4a:	c3                   	ret
+
+00003a4b <wait>:
+SYSCALL(wait)
+    3a4b:	b8 03 00 00 00       	mov    $0x3,%eax
+    3a50:	cd 40                	int    $0x40
+    3a52:	c3                   	ret
+
+00003a53 <pipe>:
+SYSCALL(pipe)
+    3a53:	b8 04 00 00 00       	mov    $0x4,%eax
+    3a58:	cd 40                	int    $0x40
+    3a5a:	c3                   	ret
+
+00003a5b <read>:
+SYSCALL(read)
+    3a5b:	b8 05 00 00 00       	mov    $0x5,%eax
+    3a60:	cd 40                	int    $0x40
+    3a62:	c3                   	ret
+
+00003a63 <write>:
+SYSCALL(write)
+    3a63:	b8 10 00 00 00       	mov    $0x10,%eax
+    3a68:	cd 40                	int    $0x40
+    3a6a:	c3                   	ret
+
+00003a6b <close>:
+SYSCALL(close)
+    3a6b:	b8 15 00 00 00       	mov    $0x15,%eax
+    3a70:	cd 40                	int    $0x40
+    3a72:	c3                   	ret
+
+00003a73 <kill>:
+SYSCALL(kill)
+    3a73:	b8 06 00 00 00       	mov    $0x6,%eax
+    3a78:	cd 40                	int    $0x40
+    3a7a:	c3                   	ret
+
+00003a7b <exec>:
+SYSCALL(exec)
+    3a7b:	b8 07 00 00 00       	mov    $0x7,%eax
+    3a80:	cd 40                	int    $0x40
+    3a82:	c3                   	ret
+
+00003a83 <open>:
+SYSCALL(open)
+    3a83:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3a88:	cd 40                	int    $0x40
+    3a8a:	c3                   	ret
+
+00003a8b <mknod>:
+SYSCALL(mknod)
+    3a8b:	b8 11 00 00 00       	mov    $0x11,%eax
+    3a90:	cd 40                	int    $0x40
+    3a92:	c3                   	ret
+
+00003a93 <unlink>:
+SYSCALL(unlink)
+    3a93:	b8 12 00 00 00       	mov    $0x12,%eax
+    3a98:	cd 40                	int    $0x40
+    3a9a:	c3                   	ret
+
+00003a9b <fstat>:
+SYSCALL(fstat)
+    3a9b:	b8 08 00 00 00       	mov    $0x8,%eax
+    3aa0:	cd 40                	int    $0x40
+    3aa2:	c3                   	ret
+
+00003aa3 <link>:
+SYSCALL(link)
+    3aa3:	b8 13 00 00 00       	mov    $0x13,%eax
+    3aa8:	cd 40                	int    $0x40
+    3aaa:	c3                   	ret
+
+00003aab <mkdir>:
+SYSCALL(mkdir)
+    3aab:	b8 14 00 00 00       	mov    $0x14,%eax
+    3ab0:	cd 40                	int    $0x40
+    3ab2:	c3                   	ret
+
+00003ab3 <chdir>:
+SYSCALL(chdir)
+    3ab3:	b8 09 00 00 00       	mov    $0x9,%eax
+    3ab8:	cd 40                	int    $0x40
+    3aba:	c3                   	ret
+
+00003abb <dup>:
+SYSCALL(dup)
+    3abb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3ac0:	cd 40                	int    $0x40
+    3ac2:	c3                   	ret
+
+00003ac3 <getpid>:
+SYSCALL(getpid)
+    3ac3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3ac8:	cd 40                	int    $0x40
+    3aca:	c3                   	ret
+
+00003acb <sbrk>:
+SYSCALL(sbrk)
+    3acb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3ad0:	cd 40                	int    $0x40
+    3ad2:	c3                   	ret
+
+00003ad3 <sleep>:
+SYSCALL(sleep)
+    3ad3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3ad8:	cd 40                	int    $0x40
+    3ada:	c3                   	ret
+
+00003adb <uptime>:
+SYSCALL(uptime)
+    3adb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3ae0:	cd 40                	int    $0x40
+    3ae2:	c3                   	ret
+
+00003ae3 <superpages>:
+SYSCALL(superpages)
+    3ae3:	b8 23 00 00 00       	mov    $0x23,%eax
+    3ae8:	cd 40                	int    $0x40
+    3aea:	c3                   	ret
+
+00003aeb <mmap>:
+SYSCALL(mmap)
+    3aeb:	b8 24 00 00 00       	mov    $0x24,%eax
+    3af0:	cd 40                	int    $0x40
+    3af2:	c3                   	ret
+
+00003af3 <munmap>:
+SYSCALL(munmap)
+    3af3:	b8 25 00 00 00       	mov    $0x25,%eax
+    3af8:	cd 40                	int    $0x40
+    3afa:	c3                   	ret
+
+00003afb <spawn>:
+SYSCALL(spawn)
+    3afb:	b8 26 00 00 00       	mov    $0x26,%eax
+    3b00:	cd 40                	int    $0x40
+    3b02:	c3                   	ret
+
+00003b03 <swapstat>:
+SYSCALL(swapstat)
+    3b03:	b8 27 00 00 00       	mov    $0x27,%eax
+    3b08:	cd 40                	int    $0x40
+    3b0a:	c3                   	ret
+
+00003b0b <getmeminfo>:
+SYSCALL(getmeminfo)
+    3b0b:	b8 28 00 00 00       	mov    $0x28,%eax
+    3b10:	cd 40                	int    $0x40
+    3b12:	c3                   	ret
+
+00003b13 <iostat>:
+SYSCALL(iostat)
+    3b13:	b8 29 00 00 00       	mov    $0x29,%eax
+    3b18:	cd 40                	int    $0x40
+    3b1a:	c3                   	ret
+
+00003b1b <dropcache>:
+SYSCALL(dropcache)
+    3b1b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    3b20:	cd 40                	int    $0x40
+    3b22:	c3                   	ret
+
+00003b23 <iosched>:
+SYSCALL(iosched)
+    3b23:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    3b28:	cd 40                	int    $0x40
+    3b2a:	c3                   	ret
+
+00003b2b <halt>:
+SYSCALL(halt)
+    3b2b:	b8 16 00 00 00       	mov    $0x16,%eax
+    3b30:	cd 40                	int    $0x40
+    3b32:	c3                   	ret
+
+00003b33 <date>:
+SYSCALL(date)
+    3b33:	b8 17 00 00 00       	mov    $0x17,%eax
+    3b38:	cd 40                	int    $0x40
+    3b3a:	c3                   	ret
+
+00003b3b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+    3b3b:	b8 18 00 00 00       	mov    $0x18,%eax
+    3b40:	cd 40                	int    $0x40
+    3b42:	c3                   	ret
+
+00003b43 <getgid>:
+SYSCALL(getgid)
+    3b43:	b8 19 00 00 00       	mov    $0x19,%eax
+    3b48:	cd 40                	int    $0x40
+    3b4a:	c3                   	ret
+
+00003b4b <getppid>:
+SYSCALL(getppid)
+    3b4b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3b50:	cd 40                	int    $0x40
+    3b52:	c3                   	ret
+
+00003b53 <setuid>:
+SYSCALL(setuid)
+    3b53:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    3b58:	cd 40                	int    $0x40
+    3b5a:	c3                   	ret
+
+00003b5b <setgid>:
+SYSCALL(setgid)
+    3b5b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3b60:	cd 40                	int    $0x40
+    3b62:	c3                   	ret
+
+00003b63 <getprocs>:
+SYSCALL(getprocs)
+    3b63:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3b68:	cd 40                	int    $0x40
+    3b6a:	c3                   	ret
+
+00003b6b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+    3b6b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3b70:	cd 40                	int    $0x40
+    3b72:	c3                   	ret
+
+00003b73 <getpriority>:
+SYSCALL(getpriority)
+    3b73:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3b78:	cd 40                	int    $0x40
+    3b7a:	c3                   	ret
+
+00003b7b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+    3b7b:	b8 20 00 00 00       	mov    $0x20,%eax
+    3b80:	cd 40                	int    $0x40
+    3b82:	c3                   	ret
+
+00003b83 <chown>:
+SYSCALL(chown)
+    3b83:	b8 21 00 00 00       	mov    $0x21,%eax
+    3b88:	cd 40                	int    $0x40
+    3b8a:	c3                   	ret
+
+00003b8b <chgrp>:
+SYSCALL(chgrp)
+    3b8b:	b8 22 00 00 00       	mov    $0x22,%eax
+    3b90:	cd 40                	int    $0x40
+    3b92:	c3                   	ret
+    3b93:	66 90                	xchg   %ax,%ax
+    3b95:	66 90                	xchg   %ax,%ax
+    3b97:	66 90                	xchg   %ax,%ax
+    3b99:	66 90                	xchg   %ax,%ax
+    3b9b:	66 90                	xchg   %ax,%ax
+    3b9d:	66 90                	xchg   %ax,%ax
+    3b9f:	90                   	nop
+
+00003ba0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3ba0:	55                   	push   %ebp
+    3ba1:	89 e5                	mov    %esp,%ebp
+    3ba3:	57                   	push   %edi
+    3ba4:	56                   	push   %esi
+    3ba5:	53                   	push   %ebx
+    3ba6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    3ba8:	89 d1                	mov    %edx,%ecx
+{
+    3baa:	83 ec 3c             	sub    $0x3c,%esp
+    3bad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    3bb0:	85 d2                	test   %edx,%edx
+    3bb2:	0f 89 80 00 00 00    	jns    3c38 <printint+0x98>
+    3bb8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    3bbc:	74 7a                	je     3c38 <printint+0x98>
+    x = -xx;
+    3bbe:	f7 d9                	neg    %ecx
+    neg = 1;
+    3bc0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3bc5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    3bc8:	31 f6                	xor    %esi,%esi
+    3bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    3bd0:	89 c8                	mov    %ecx,%eax
+    3bd2:	31 d2                	xor    %edx,%edx
+    3bd4:	89 f7                	mov    %esi,%edi
+    3bd6:	f7 f3                	div    %ebx
+    3bd8:	8d 76 01             	lea    0x1(%esi),%esi
+    3bdb:	0f b6 92 ec 59 00 00 	movzbl 0x59ec(%edx),%edx
+    3be2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    3be6:	89 ca                	mov    %ecx,%edx
+    3be8:	89 c1                	mov    %eax,%ecx
+    3bea:	39 da                	cmp    %ebx,%edx
+    3bec:	73 e2                	jae    3bd0 <printint+0x30>
+  if(neg)
+    3bee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    3bf1:	85 c0                	test   %eax,%eax
+    3bf3:	74 07                	je     3bfc <printint+0x5c>
+    buf[i++] = '-';
+    3bf5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    3bfa:	89 f7                	mov    %esi,%edi
+    3bfc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    3bff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    3c02:	01 df                	add    %ebx,%edi
+    3c04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    3c08:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    3c0b:	83 ec 04             	sub    $0x4,%esp
+    3c0e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    3c11:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    3c14:	6a 01                	push   $0x1
+    3c16:	50                   	push   %eax
+    3c17:	56                   	push   %esi
+    3c18:	e8 46 fe ff ff       	call   3a63 <write>
+  while(--i >= 0)
+    3c1d:	89 f8                	mov    %edi,%eax
+    3c1f:	83 c4 10             	add    $0x10,%esp
+    3c22:	83 ef 01             	sub    $0x1,%edi
+    3c25:	39 d8                	cmp    %ebx,%eax
+    3c27:	75 df                	jne    3c08 <printint+0x68>
+}
+    3c29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c2c:	5b                   	pop    %ebx
+    3c2d:	5e                   	pop    %esi
+    3c2e:	5f                   	pop    %edi
+    3c2f:	5d                   	pop    %ebp
+    3c30:	c3                   	ret
+    3c31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    3c38:	31 c0                	xor    %eax,%eax
+    3c3a:	eb 89                	jmp    3bc5 <printint+0x25>
+    3c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003c40 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    3c40:	55                   	push   %ebp
+    3c41:	89 e5                	mov    %esp,%ebp
+    3c43:	57                   	push   %edi
+    3c44:	56                   	push   %esi
+    3c45:	53                   	push   %ebx
+    3c46:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    3c49:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    3c4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    3c4f:	0f b6 1e             	movzbl (%esi),%ebx
+    3c52:	83 c6 01             	add    $0x1,%esi
+    3c55:	84 db                	test   %bl,%bl
+    3c57:	74 67                	je     3cc0 <printf+0x80>
+    3c59:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    3c5c:	31 d2                	xor    %edx,%edx
+    3c5e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    3c61:	eb 34                	jmp    3c97 <printf+0x57>
+    3c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3c67:	90                   	nop
+    3c68:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    3c6b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    3c70:	83 f8 25             	cmp    $0x25,%eax
+    3c73:	74 18                	je     3c8d <printf+0x4d>
+  write(fd, &c, 1);
+    3c75:	83 ec 04             	sub    $0x4,%esp
+    3c78:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3c7b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3c7e:	6a 01                	push   $0x1
+    3c80:	50                   	push   %eax
+    3c81:	57                   	push   %edi
+    3c82:	e8 dc fd ff ff       	call   3a63 <write>
+    3c87:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    3c8a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    3c8d:	0f b6 1e             	movzbl (%esi),%ebx
+    3c90:	83 c6 01             	add    $0x1,%esi
+    3c93:	84 db                	test   %bl,%bl
+    3c95:	74 29                	je     3cc0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    3c97:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    3c9a:	85 d2                	test   %edx,%edx
+    3c9c:	74 ca                	je     3c68 <printf+0x28>
+      }
+    } else if(state == '%'){
+    3c9e:	83 fa 25             	cmp    $0x25,%edx
+    3ca1:	75 ea                	jne    3c8d <printf+0x4d>
+      if(c == 'd'){
+    3ca3:	83 f8 25             	cmp    $0x25,%eax
+    3ca6:	0f 84 24 01 00 00    	je     3dd0 <printf+0x190>
+    3cac:	83 e8 63             	sub    $0x63,%eax
+    3caf:	83 f8 15             	cmp    $0x15,%eax
+    3cb2:	77 1c                	ja     3cd0 <printf+0x90>
+    3cb4:	ff 24 85 94 59 00 00 	jmp    *0x5994(,%eax,4)
+    3cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3cbf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    3cc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3cc3:	5b                   	pop    %ebx
+    3cc4:	5e                   	pop    %esi
+    3cc5:	5f                   	pop    %edi
+    3cc6:	5d                   	pop    %ebp
+    3cc7:	c3                   	ret
+    3cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ccf:	90                   	nop
+  write(fd, &c, 1);
+    3cd0:	83 ec 04             	sub    $0x4,%esp
+    3cd3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3cd6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    3cda:	6a 01                	push   $0x1
+    3cdc:	52                   	push   %edx
+    3cdd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    3ce0:	57                   	push   %edi
+    3ce1:	e8 7d fd ff ff       	call   3a63 <write>
+    3ce6:	83 c4 0c             	add    $0xc,%esp
+    3ce9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3cec:	6a 01                	push   $0x1
+    3cee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    3cf1:	52                   	push   %edx
+    3cf2:	57                   	push   %edi
+    3cf3:	e8 6b fd ff ff       	call   3a63 <write>
+        putc(fd, c);
+    3cf8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3cfb:	31 d2                	xor    %edx,%edx
+    3cfd:	eb 8e                	jmp    3c8d <printf+0x4d>
+    3cff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    3d00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3d03:	83 ec 0c             	sub    $0xc,%esp
+    3d06:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3d0b:	8b 13                	mov    (%ebx),%edx
+    3d0d:	6a 00                	push   $0x0
+    3d0f:	89 f8                	mov    %edi,%eax
+        ap++;
+    3d11:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    3d14:	e8 87 fe ff ff       	call   3ba0 <printint>
+        ap++;
+    3d19:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3d1c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3d1f:	31 d2                	xor    %edx,%edx
+    3d21:	e9 67 ff ff ff       	jmp    3c8d <printf+0x4d>
+    3d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d2d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    3d30:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3d33:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    3d35:	83 c0 04             	add    $0x4,%eax
+    3d38:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    3d3b:	85 db                	test   %ebx,%ebx
+    3d3d:	0f 84 9d 00 00 00    	je     3de0 <printf+0x1a0>
+        while(*s != 0){
+    3d43:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    3d46:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    3d48:	84 c0                	test   %al,%al
+    3d4a:	0f 84 3d ff ff ff    	je     3c8d <printf+0x4d>
+    3d50:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3d53:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    3d56:	89 de                	mov    %ebx,%esi
+    3d58:	89 d3                	mov    %edx,%ebx
+    3d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    3d60:	83 ec 04             	sub    $0x4,%esp
+    3d63:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    3d66:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    3d69:	6a 01                	push   $0x1
+    3d6b:	53                   	push   %ebx
+    3d6c:	57                   	push   %edi
+    3d6d:	e8 f1 fc ff ff       	call   3a63 <write>
+        while(*s != 0){
+    3d72:	0f b6 06             	movzbl (%esi),%eax
+    3d75:	83 c4 10             	add    $0x10,%esp
+    3d78:	84 c0                	test   %al,%al
+    3d7a:	75 e4                	jne    3d60 <printf+0x120>
+      state = 0;
+    3d7c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    3d7f:	31 d2                	xor    %edx,%edx
+    3d81:	e9 07 ff ff ff       	jmp    3c8d <printf+0x4d>
+    3d86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d8d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    3d90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3d93:	83 ec 0c             	sub    $0xc,%esp
+    3d96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3d9b:	8b 13                	mov    (%ebx),%edx
+    3d9d:	6a 01                	push   $0x1
+    3d9f:	e9 6b ff ff ff       	jmp    3d0f <printf+0xcf>
+    3da4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    3da8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    3dab:	83 ec 04             	sub    $0x4,%esp
+    3dae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    3db1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    3db3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    3db6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    3db9:	6a 01                	push   $0x1
+    3dbb:	52                   	push   %edx
+    3dbc:	57                   	push   %edi
+    3dbd:	e8 a1 fc ff ff       	call   3a63 <write>
+        ap++;
+    3dc2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3dc5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3dc8:	31 d2                	xor    %edx,%edx
+    3dca:	e9 be fe ff ff       	jmp    3c8d <printf+0x4d>
+    3dcf:	90                   	nop
+  write(fd, &c, 1);
+    3dd0:	83 ec 04             	sub    $0x4,%esp
+    3dd3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3dd6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3dd9:	6a 01                	push   $0x1
+    3ddb:	e9 11 ff ff ff       	jmp    3cf1 <printf+0xb1>
+    3de0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    3de5:	bb 8a 59 00 00       	mov    $0x598a,%ebx
+    3dea:	e9 61 ff ff ff       	jmp    3d50 <printf+0x110>
+    3def:	90                   	nop
+
+00003df0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+    3df0:	55                   	push   %ebp
+    3df1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3df3:	a1 04 ac 00 00       	mov    0xac04,%eax
+{
+    3df8:	89 e5                	mov    %esp,%ebp
+    3dfa:	56                   	push   %esi
+    3dfb:	53                   	push   %ebx
+    3dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3e00:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3e02:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3e04:	39 ca                	cmp    %ecx,%edx
+    3e06:	73 30                	jae    3e38 <lfree+0x48>
+    3e08:	39 c1                	cmp    %eax,%ecx
+    3e0a:	72 04                	jb     3e10 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3e0c:	39 c2                	cmp    %eax,%edx
+    3e0e:	72 f0                	jb     3e00 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    3e10:	8b 59 04             	mov    0x4(%ecx),%ebx
+    3e13:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+    3e16:	39 f0                	cmp    %esi,%eax
+    3e18:	74 26                	je     3e40 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3e1a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    3e1c:	8b 42 04             	mov    0x4(%edx),%eax
+    3e1f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    3e22:	39 d9                	cmp    %ebx,%ecx
+    3e24:	74 30                	je     3e56 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    3e26:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    3e28:	5b                   	pop    %ebx
+  freep = p;
+    3e29:	89 15 04 ac 00 00    	mov    %edx,0xac04
+}
+    3e2f:	5e                   	pop    %esi
+    3e30:	5d                   	pop    %ebp
+    3e31:	c3                   	ret
+    3e32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3e38:	39 c1                	cmp    %eax,%ecx
+    3e3a:	72 d0                	jb     3e0c <lfree+0x1c>
+    3e3c:	eb c2                	jmp    3e00 <lfree+0x10>
+    3e3e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    3e40:	03 58 04             	add    0x4(%eax),%ebx
+    3e43:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3e46:	8b 02                	mov    (%edx),%eax
+    3e48:	8b 00                	mov    (%eax),%eax
+    3e4a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+    3e4c:	8b 42 04             	mov    0x4(%edx),%eax
+    3e4f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    3e52:	39 d9                	cmp    %ebx,%ecx
+    3e54:	75 d0                	jne    3e26 <lfree+0x36>
+    p->s.size += bp->s.size;
+    3e56:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+    3e59:	89 15 04 ac 00 00    	mov    %edx,0xac04
+    p->s.size += bp->s.size;
+    3e5f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    3e62:	8b 09                	mov    (%ecx),%ecx
+    3e64:	89 0a                	mov    %ecx,(%edx)
+}
+    3e66:	5b                   	pop    %ebx
+    3e67:	5e                   	pop    %esi
+    3e68:	5d                   	pop    %ebp
+    3e69:	c3                   	ret
+    3e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003e70 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+    3e70:	55                   	push   %ebp
+    3e71:	89 e5                	mov    %esp,%ebp
+    3e73:	57                   	push   %edi
+    3e74:	89 c7                	mov    %eax,%edi
+    3e76:	56                   	push   %esi
+    3e77:	53                   	push   %ebx
+    3e78:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+    3e7b:	a1 04 ac 00 00       	mov    0xac04,%eax
+    3e80:	85 c0                	test   %eax,%eax
+    3e82:	0f 84 88 00 00 00    	je     3f10 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3e88:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    3e8a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+    3e8d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    3e92:	39 df                	cmp    %ebx,%edi
+    3e94:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    3e97:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+    3e9e:	39 f9                	cmp    %edi,%ecx
+    3ea0:	72 0f                	jb     3eb1 <lalloc+0x41>
+    3ea2:	eb 4c                	jmp    3ef0 <lalloc+0x80>
+    3ea4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3ea8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+    3eaa:	8b 4a 04             	mov    0x4(%edx),%ecx
+    3ead:	39 f9                	cmp    %edi,%ecx
+    3eaf:	73 3f                	jae    3ef0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+    3eb1:	89 d0                	mov    %edx,%eax
+    3eb3:	39 15 04 ac 00 00    	cmp    %edx,0xac04
+    3eb9:	75 ed                	jne    3ea8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+    3ebb:	83 ec 0c             	sub    $0xc,%esp
+    3ebe:	56                   	push   %esi
+    3ebf:	e8 07 fc ff ff       	call   3acb <sbrk>
+  if(p == (char*)-1)
+    3ec4:	83 c4 10             	add    $0x10,%esp
+    3ec7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3eca:	74 11                	je     3edd <lalloc+0x6d>
+  hp->s.size = nu;
+    3ecc:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+    3ecf:	e8 1c ff ff ff       	call   3df0 <lfree>
+  return freep;
+    3ed4:	a1 04 ac 00 00       	mov    0xac04,%eax
+      if((p = morecore(nunits)) == 0)
+    3ed9:	85 c0                	test   %eax,%eax
+    3edb:	75 cb                	jne    3ea8 <lalloc+0x38>
+        return 0;
+  }
+}
+    3edd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    3ee0:	31 d2                	xor    %edx,%edx
+}
+    3ee2:	5b                   	pop    %ebx
+    3ee3:	89 d0                	mov    %edx,%eax
+    3ee5:	5e                   	pop    %esi
+    3ee6:	5f                   	pop    %edi
+    3ee7:	5d                   	pop    %ebp
+    3ee8:	c3                   	ret
+    3ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+    3ef0:	39 cf                	cmp    %ecx,%edi
+    3ef2:	74 4c                	je     3f40 <lalloc+0xd0>
+        p->s.size -= nunits;
+    3ef4:	29 f9                	sub    %edi,%ecx
+    3ef6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+    3ef9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+    3efc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+    3eff:	a3 04 ac 00 00       	mov    %eax,0xac04
+}
+    3f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3f07:	89 d0                	mov    %edx,%eax
+    3f09:	5b                   	pop    %ebx
+    3f0a:	5e                   	pop    %esi
+    3f0b:	5f                   	pop    %edi
+    3f0c:	5d                   	pop    %ebp
+    3f0d:	c3                   	ret
+    3f0e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+    3f10:	ba 08 ac 00 00       	mov    $0xac08,%edx
+    3f15:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+    3f17:	c7 05 04 ac 00 00 08 	movl   $0xac08,0xac04
+    3f1e:	ac 00 00 
+    3f21:	c7 05 08 ac 00 00 08 	movl   $0xac08,0xac08
+    3f28:	ac 00 00 
+    3f2b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+    3f2d:	c7 05 0c ac 00 00 00 	movl   $0x0,0xac0c
+    3f34:	00 00 00 
+    3f37:	e9 51 ff ff ff       	jmp    3e8d <lalloc+0x1d>
+    3f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+    3f40:	8b 0a                	mov    (%edx),%ecx
+    3f42:	89 08                	mov    %ecx,(%eax)
+    3f44:	eb b9                	jmp    3eff <lalloc+0x8f>
+    3f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003f50 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+    3f50:	55                   	push   %ebp
+    3f51:	89 e5                	mov    %esp,%ebp
+    3f53:	57                   	push   %edi
+    3f54:	56                   	push   %esi
+    3f55:	53                   	push   %ebx
+    3f56:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+    3f59:	85 f6                	test   %esi,%esi
+    3f5b:	74 42                	je     3f9f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+    3f5d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+    3f60:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+    3f63:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+    3f69:	77 3d                	ja     3fa8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+    3f6b:	31 c9                	xor    %ecx,%ecx
+    3f6d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    3f72:	83 fa 02             	cmp    $0x2,%edx
+    3f75:	74 17                	je     3f8e <free+0x3e>
+    3f77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f7e:	66 90                	xchg   %ax,%ax
+    3f80:	83 c1 01             	add    $0x1,%ecx
+    3f83:	89 d8                	mov    %ebx,%eax
+    3f85:	d3 e0                	shl    %cl,%eax
+    3f87:	83 c0 01             	add    $0x1,%eax
+    3f8a:	39 c2                	cmp    %eax,%edx
+    3f8c:	75 f2                	jne    3f80 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+    3f8e:	8b 04 8d e0 ab 00 00 	mov    0xabe0(,%ecx,4),%eax
+  classes[c] = bp;
+    3f95:	89 3c 8d e0 ab 00 00 	mov    %edi,0xabe0(,%ecx,4)
+  bp->s.ptr = classes[c];
+    3f9c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+    3f9f:	5b                   	pop    %ebx
+    3fa0:	5e                   	pop    %esi
+    3fa1:	5f                   	pop    %edi
+    3fa2:	5d                   	pop    %ebp
+    3fa3:	c3                   	ret
+    3fa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3fa8:	5b                   	pop    %ebx
+    lfree(bp);
+    3fa9:	89 f8                	mov    %edi,%eax
+}
+    3fab:	5e                   	pop    %esi
+    3fac:	5f                   	pop    %edi
+    3fad:	5d                   	pop    %ebp
+    lfree(bp);
+    3fae:	e9 3d fe ff ff       	jmp    3df0 <lfree>
+    3fb3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003fc0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    3fc0:	55                   	push   %ebp
+    3fc1:	89 e5                	mov    %esp,%ebp
+    3fc3:	57                   	push   %edi
+    3fc4:	56                   	push   %esi
+    3fc5:	53                   	push   %ebx
+    3fc6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3fc9:	8b 45 08             	mov    0x8(%ebp),%eax
+    3fcc:	83 c0 07             	add    $0x7,%eax
+    3fcf:	c1 e8 03             	shr    $0x3,%eax
+    3fd2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+    3fd5:	3d 01 01 00 00       	cmp    $0x101,%eax
+    3fda:	77 44                	ja     4020 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+    3fdc:	31 c9                	xor    %ecx,%ecx
+    3fde:	ba 01 00 00 00       	mov    $0x1,%edx
+    3fe3:	bb 02 00 00 00       	mov    $0x2,%ebx
+    3fe8:	83 f8 02             	cmp    $0x2,%eax
+    3feb:	76 11                	jbe    3ffe <malloc+0x3e>
+    3fed:	8d 76 00             	lea    0x0(%esi),%esi
+    3ff0:	83 c1 01             	add    $0x1,%ecx
+    3ff3:	89 d3                	mov    %edx,%ebx
+    3ff5:	d3 e3                	shl    %cl,%ebx
+    3ff7:	83 c3 01             	add    $0x1,%ebx
+    3ffa:	39 c3                	cmp    %eax,%ebx
+    3ffc:	72 f2                	jb     3ff0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+    3ffe:	8b 04 8d e0 ab 00 00 	mov    0xabe0(,%ecx,4),%eax
+    4005:	85 c0                	test   %eax,%eax
+    4007:	74 2f                	je     4038 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+    4009:	8b 10                	mov    (%eax),%edx
+    400b:	89 14 8d e0 ab 00 00 	mov    %edx,0xabe0(,%ecx,4)
+  return (void*)(p + 1);
+    4012:	83 c0 08             	add    $0x8,%eax
+}
+    4015:	83 c4 1c             	add    $0x1c,%esp
+    4018:	5b                   	pop    %ebx
+    4019:	5e                   	pop    %esi
+    401a:	5f                   	pop    %edi
+    401b:	5d                   	pop    %ebp
+    401c:	c3                   	ret
+    401d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+    4020:	e8 4b fe ff ff       	call   3e70 <lalloc>
+    4025:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+    4027:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+    402a:	85 d2                	test   %edx,%edx
+    402c:	75 e7                	jne    4015 <malloc+0x55>
+      return 0;
+    402e:	31 c0                	xor    %eax,%eax
+    4030:	eb e3                	jmp    4015 <malloc+0x55>
+    4032:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+    4038:	31 d2                	xor    %edx,%edx
+    403a:	b8 00 02 00 00       	mov    $0x200,%eax
+    403f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    4042:	f7 f3                	div    %ebx
+  if(n < 4)
+    4044:	ba 04 00 00 00       	mov    $0x4,%edx
+    4049:	89 d6                	mov    %edx,%esi
+    404b:	39 d0                	cmp    %edx,%eax
+    404d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+    4050:	0f af f3             	imul   %ebx,%esi
+    4053:	89 f0                	mov    %esi,%eax
+    4055:	e8 16 fe ff ff       	call   3e70 <lalloc>
+    405a:	85 c0                	test   %eax,%eax
+    405c:	74 d0                	je     402e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+    405e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    4061:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+    4064:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    406b:	8b 14 8d e0 ab 00 00 	mov    0xabe0(,%ecx,4),%edx
+    4072:	39 f8                	cmp    %edi,%eax
+    4074:	73 22                	jae    4098 <malloc+0xd8>
+    4076:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    4079:	eb 09                	jmp    4084 <malloc+0xc4>
+    407b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    407f:	90                   	nop
+    4080:	89 c2                	mov    %eax,%edx
+    4082:	89 c8                	mov    %ecx,%eax
+    4084:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+    4087:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+    408a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+    408c:	39 f9                	cmp    %edi,%ecx
+    408e:	72 f0                	jb     4080 <malloc+0xc0>
+    4090:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    4093:	e9 73 ff ff ff       	jmp    400b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+    4098:	89 d0                	mov    %edx,%eax
+    409a:	8b 12                	mov    (%edx),%edx
+    409c:	e9 6a ff ff ff       	jmp    400b <malloc+0x4b>
+    40a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40af:	90                   	nop
+
+000040b0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+    40b0:	55                   	push   %ebp
+    40b1:	89 e5                	mov    %esp,%ebp
+    40b3:	56                   	push   %esi
+    40b4:	53                   	push   %ebx
+    40b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    40b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+    40bb:	85 c9                	test   %ecx,%ecx
+    40bd:	74 06                	je     40c5 <calloc+0x15>
+    40bf:	89 c8                	mov    %ecx,%eax
+    40c1:	f7 e3                	mul    %ebx
+    40c3:	70 33                	jo     40f8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+    40c5:	0f af d9             	imul   %ecx,%ebx
+    40c8:	83 ec 0c             	sub    $0xc,%esp
+    40cb:	53                   	push   %ebx
+    40cc:	e8 ef fe ff ff       	call   3fc0 <malloc>
+    40d1:	83 c4 10             	add    $0x10,%esp
+    40d4:	89 c6                	mov    %eax,%esi
+    40d6:	85 c0                	test   %eax,%eax
+    40d8:	74 1e                	je     40f8 <calloc+0x48>
+    memset(p, 0, n * size);
+    40da:	83 ec 04             	sub    $0x4,%esp
+    40dd:	53                   	push   %ebx
+    40de:	6a 00                	push   $0x0
+    40e0:	50                   	push   %eax
+    40e1:	e8 3a f7 ff ff       	call   3820 <memset>
+    40e6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+    40e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    40ec:	89 f0                	mov    %esi,%eax
+    40ee:	5b                   	pop    %ebx
+    40ef:	5e                   	pop    %esi
+    40f0:	5d                   	pop    %ebp
+    40f1:	c3                   	ret
+    40f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    40f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    40fb:	31 f6                	xor    %esi,%esi
+}
+    40fd:	89 f0                	mov    %esi,%eax
+    40ff:	5b                   	pop    %ebx
+    4100:	5e                   	pop    %esi
+    4101:	5d                   	pop    %ebp
+    4102:	c3                   	ret
+    4103:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    410a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004110 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+    4110:	55                   	push   %ebp
+    4111:	89 e5                	mov    %esp,%ebp
+    4113:	57                   	push   %edi
+    4114:	56                   	push   %esi
+    4115:	53                   	push   %ebx
+    4116:	83 ec 0c             	sub    $0xc,%esp
+    4119:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    411c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+    411f:	85 db                	test   %ebx,%ebx
+    4121:	74 55                	je     4178 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+    4123:	8b 53 fc             	mov    -0x4(%ebx),%edx
+    4126:	89 de                	mov    %ebx,%esi
+    4128:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+    412f:	39 c7                	cmp    %eax,%edi
+    4131:	72 0d                	jb     4140 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+    4133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4136:	89 f0                	mov    %esi,%eax
+    4138:	5b                   	pop    %ebx
+    4139:	5e                   	pop    %esi
+    413a:	5f                   	pop    %edi
+    413b:	5d                   	pop    %ebp
+    413c:	c3                   	ret
+    413d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+    4140:	83 ec 0c             	sub    $0xc,%esp
+    4143:	50                   	push   %eax
+    4144:	e8 77 fe ff ff       	call   3fc0 <malloc>
+    4149:	83 c4 10             	add    $0x10,%esp
+    414c:	89 c6                	mov    %eax,%esi
+    414e:	85 c0                	test   %eax,%eax
+    4150:	74 e1                	je     4133 <realloc+0x23>
+  memmove(p, ap, have);
+    4152:	83 ec 04             	sub    $0x4,%esp
+    4155:	57                   	push   %edi
+    4156:	53                   	push   %ebx
+    4157:	50                   	push   %eax
+    4158:	e8 b3 f8 ff ff       	call   3a10 <memmove>
+  free(ap);
+    415d:	89 1c 24             	mov    %ebx,(%esp)
+    4160:	e8 eb fd ff ff       	call   3f50 <free>
+  return p;
+    4165:	83 c4 10             	add    $0x10,%esp
+}
+    4168:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    416b:	89 f0                	mov    %esi,%eax
+    416d:	5b                   	pop    %ebx
+    416e:	5e                   	pop    %esi
+    416f:	5f                   	pop    %edi
+    4170:	5d                   	pop    %ebp
+    4171:	c3                   	ret
+    4172:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+    4178:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+    417b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    417e:	5b                   	pop    %ebx
+    417f:	5e                   	pop    %esi
+    4180:	5f                   	pop    %edi
+    4181:	5d                   	pop    %ebp
+    return malloc(nbytes);
+    4182:	e9 39 fe ff ff       	jmp    3fc0 <malloc>
@@ -300,6 +300,34 @@ exectest(void)
   }
 }
 
+// writing the binary of a running program must fail.
+// write back the byte that is there, in case it doesn't.
+void
+textbusy(void)
+{
+  int fd;
+  char c;
+
+  printf(stdout, "text busy test\n");
+  fd = open("usertests", O_RDWR);
+  if(fd < 0){
+    printf(stdout, "open usertests failed\n");
+    exit();
+  }
+  if(read(fd, &c, 1) != 1){
+    printf(stdout, "read usertests failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("usertests", O_RDWR);
+  if(write(fd, &c, 1) != -1){
+    printf(stdout, "wrote running binary!\n");
+    exit();
+  }
+  close(fd);
+  printf(stdout, "text busy ok\n");
+}
+
 // simple fork and pipe read/write
 
 void
@@ -1797,6 +1825,7 @@ main(int argc, char *argv[])
 
   uio();
 
+  textbusy();
   exectest();
 
   exit();
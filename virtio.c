@@ -0,0 +1,332 @@
+// Disk driver for a virtio block device ("virtio-blk"), in
+// place of ide.c; see kernelvirtio in the Makefile.  Uses the
+// legacy virtio PCI interface: registers in I/O space at BAR 0
+// and a single virtqueue.
+//
+// Each request takes a chain of descriptors: a header saying
+// read or write and where, the data of one or more bufs for
+// consecutive blocks, and a status byte the device fills in.
+// Many requests may be in flight, and they may complete in any
+// order.  Bufs wait in the queue of iosched.c only while the
+// ring has no room, and are merged then, as in ide.c.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iostat.h"
+#include "pci.h"
+
+#define SECTOR_SIZE 512
+
+// Legacy virtio PCI registers, from BAR 0.
+#define VIO_DEVFEAT   0x00
+#define VIO_DRVFEAT   0x04
+#define VIO_QADDR     0x08  // queue's page frame number
+#define VIO_QSIZE     0x0c
+#define VIO_QSEL      0x0e
+#define VIO_QNOTIFY   0x10
+#define VIO_STATUS    0x12
+#define VIO_ISR       0x13
+
+#define VIO_ACK       1     // in VIO_STATUS
+#define VIO_DRIVER    2
+#define VIO_DRIVER_OK 4
+
+#define VIRTIO_VENDOR 0x1af4
+#define VIRTIO_BLK    0x1001
+
+// A virtqueue.
+struct vdesc {
+  uint addr;
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VD_NEXT  1    // chain continues at next
+#define VD_WRITE 2    // device writes this memory
+
+struct vavail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];
+};
+
+struct vusedelem {
+  uint id;       // head of the finished chain
+  uint len;
+};
+
+struct vused {
+  ushort flags;
+  ushort idx;
+  struct vusedelem ring[];
+};
+
+// Request header.
+struct vhdr {
+  uint type;
+  uint reserved;
+  uint sector;
+  uint sectorhi;
+};
+#define VIRTIO_BLK_T_IN  0
+#define VIRTIO_BLK_T_OUT 1
+
+// A request in flight, indexed by its first descriptor.
+struct vreq {
+  struct vhdr hdr;
+  struct buf *b;      // bufs, through qnext
+  int n;
+  uchar status;
+};
+
+static struct spinlock vlock;
+static ushort iobase;
+static int qsize;
+static struct vdesc *desc;
+static struct vavail *avail;
+static struct vused *used;
+static struct vreq *req;
+static int freedesc;       // free descriptors, through next
+static int nfree;
+static ushort lastused;    // used ring entries we have seen
+static uint nreqs;         // requests issued
+static uint nblocks;       // blocks they moved
+
+static int
+alloc(void)
+{
+  int d;
+
+  d = freedesc;
+  freedesc = desc[d].next;
+  nfree--;
+  return d;
+}
+
+static void
+vfree(int d)
+{
+  desc[d].next = freedesc;
+  freedesc = d;
+  nfree++;
+}
+
+void
+ideinit(void)
+{
+  struct pcidev d;
+  uint sz, availoff, usedoff;
+  char *ring;
+  int i;
+
+  initlock(&vlock, "virtio");
+  if(pcifindid(VIRTIO_VENDOR, VIRTIO_BLK, 0, &d) < 0 || (d.bar[0] & 1) == 0)
+    panic("virtio: no disk");
+  iobase = d.bar[0] & ~3;
+  pcienable(&d, PCI_CMD_IO|PCI_CMD_MASTER);
+
+  outb(iobase + VIO_STATUS, 0);
+  outb(iobase + VIO_STATUS, VIO_ACK);
+  outb(iobase + VIO_STATUS, VIO_ACK|VIO_DRIVER);
+  outl(iobase + VIO_DRVFEAT, 0);
+
+  outw(iobase + VIO_QSEL, 0);
+  if((qsize = inw(iobase + VIO_QSIZE)) == 0)
+    panic("virtio: no queue");
+  availoff = qsize * sizeof(struct vdesc);
+  usedoff = PGROUNDUP(availoff + 2*(3 + qsize));
+  sz = usedoff + PGROUNDUP(2*3 + qsize * sizeof(struct vusedelem));
+  ring = ktable(1, sz);
+  desc = (struct vdesc*)ring;
+  avail = (struct vavail*)(ring + availoff);
+  used = (struct vused*)(ring + usedoff);
+  req = ktable(qsize, sizeof(struct vreq));
+  for(i = 0; i < qsize; i++)
+    vfree(i);
+  outl(iobase + VIO_QADDR, V2P(ring) >> PGSHIFT);
+
+  if(pciintr(&d, ideintr) < 0)
+    panic("virtio: no irq");
+  outb(iobase + VIO_STATUS, VIO_ACK|VIO_DRIVER|VIO_DRIVER_OK);
+  cprintf("virtio: disk with %d descriptors, irq %d\n", qsize, d.irq);
+}
+
+// Give the device requests for waiting bufs while the ring has
+// room.  Caller holds vlock.
+static void
+vstart(void)
+{
+  struct buf *b, *q;
+  struct vreq *r;
+  int head, d, prev, i, n, added;
+
+  added = 0;
+  while(nfree >= IDEMAXMERGE + 2 && (b = iosnext()) != 0){
+    if(b->blockno >= FSSIZE + SWAPSIZE)
+      panic("virtio: blockno");
+    n = iosmerge(b, IDEMAXMERGE);
+    nreqs++;
+    nblocks += n;
+
+    head = alloc();
+    r = &req[head];
+    r->b = b;
+    r->n = n;
+    r->status = 0xff;
+    r->hdr.type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+    r->hdr.reserved = 0;
+    r->hdr.sector = b->blockno * (BSIZE/SECTOR_SIZE);
+    r->hdr.sectorhi = 0;
+    desc[head].addr = V2P(&r->hdr);
+    desc[head].addrhi = 0;
+    desc[head].len = sizeof(r->hdr);
+    desc[head].flags = VD_NEXT;
+
+    prev = head;
+    for(i = 0, q = b; i < n; i++, q = q->qnext){
+      d = alloc();
+      desc[d].addr = V2P(q->data);
+      desc[d].addrhi = 0;
+      desc[d].len = BSIZE;
+      desc[d].flags = (b->flags & B_DIRTY) ? 0 : VD_WRITE;
+      desc[prev].next = d;
+      desc[prev].flags |= VD_NEXT;
+      prev = d;
+    }
+    d = alloc();
+    desc[d].addr = V2P(&r->status);
+    desc[d].addrhi = 0;
+    desc[d].len = 1;
+    desc[d].flags = VD_WRITE;
+    desc[prev].next = d;
+    desc[prev].flags |= VD_NEXT;
+
+    avail->ring[avail->idx % qsize] = head;
+    __sync_synchronize();
+    avail->idx++;
+    added = 1;
+  }
+  if(added){
+    __sync_synchronize();
+    outw(iobase + VIO_QNOTIFY, 0);
+  }
+}
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+  struct buf *b, *next, *reada;
+  struct vreq *r;
+  int id, d, nd, i;
+
+  acquire(&vlock);
+  inb(iobase + VIO_ISR);  // acknowledge
+  reada = 0;
+  __sync_synchronize();
+  while(lastused != used->idx){
+    id = used->ring[lastused % qsize].id;
+    lastused++;
+    r = &req[id];
+    if(r->status != 0)
+      panic("virtio: disk error");
+
+    // Wake processes waiting for these bufs.
+    for(i = 0, b = r->b; i < r->n; i++, b = next){
+      next = b->qnext;
+      iosdone(b);
+      b->flags |= B_VALID;
+      b->flags &= ~(B_DIRTY|B_ASYNC);
+      if(b->flags & B_READA){
+        b->flags &= ~B_READA;
+        b->qnext = reada;
+        reada = b;
+      }
+      wakeup(b);
+    }
+
+    // Free the descriptor chain.
+    for(d = id; desc[d].flags & VD_NEXT; d = nd){
+      nd = desc[d].next;
+      vfree(d);
+    }
+    vfree(d);
+  }
+  vstart();
+  release(&vlock);
+
+  // No one waits for a read-ahead; release its buffer.
+  for(b = reada; b; b = next){
+    next = b->qnext;
+    bdone(b);
+  }
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once: wait with ideawait(), or
+// if B_READA is set too, ideintr releases the buf.
+void
+iderw(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+  if(b->dev != ROOTDEV)
+    panic("iderw: request not for the virtio disk");
+
+  acquire(&vlock);
+  iosadd(b);
+  vstart();
+  if(b->flags & B_ASYNC){
+    release(&vlock);
+    return;
+  }
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &vlock);
+  release(&vlock);
+}
+
+// Wait for the disk to finish b, which iderw() started with
+// B_ASYNC set.
+void
+ideawait(struct buf *b)
+{
+  acquire(&vlock);
+  while(b->flags & B_ASYNC)
+    sleep(b, &vlock);
+  release(&vlock);
+}
+
+void
+idestat(struct iostat *st)
+{
+  acquire(&vlock);
+  st->diskreqs = nreqs;
+  st->diskblocks = nblocks;
+  iosstat(st);
+  release(&vlock);
+}
+
+int
+idesched(int n)
+{
+  int old;
+
+  acquire(&vlock);
+  old = iosset(n);
+  release(&vlock);
+  return old;
+}
@@ -6,9 +6,16 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "mman.h"
+#include "meminfo.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+char *zeropage; // shared read-only page for untouched heap reads
 
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
@@ -16,22 +23,36 @@ void
 seginit(void)
 {
   struct cpu *c;
+  int apicid;
+
+  // Find this cpu's struct cpu by its APIC ID.  This is the only
+  // search; afterwards mycpu() finds it through %gs.
+  apicid = lapicid();
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c->apicid == apicid)
+      break;
+  if(c == cpus+ncpu)
+    panic("seginit: unknown apicid");
 
   // Map "logical" addresses to virtual addresses using identity map.
   // Cannot share a CODE descriptor for both kernel and user
   // because it would have to have DPL_USR, but the CPU forbids
   // an interrupt from CPL=0 to DPL=3.
-  c = &cpus[cpuid()];
   c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
   c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->self, 8, 0);
   lgdt(c->gdt, sizeof(c->gdt));
+  c->self = c;
+  loadgs(SEG_KCPU << 3);
 }
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
+// create any required page table pages, swapping user pages
+// out for them if need be.  Returns 0 if va is mapped by a
+// superpage, which has no page table.
 static pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
@@ -39,11 +60,14 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if(*pde & PTE_PS)
+    return 0;
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    if(!alloc || (pgtab = (pte_t*)kallocsw()) == 0)
       return 0;
+    ktag((char*)pgtab, KM_PGTBL);
     // Make sure all those PTE_P bits are zero.
     memset(pgtab, 0, PGSIZE);
     // The permissions here are overly generous, but they can
@@ -79,6 +103,42 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
   return 0;
 }
 
+// Like mappages, but for the kernel's own mappings: wherever va
+// and pa are 4MB aligned and a whole 4MB fits, map it with one
+// superpage directory entry, which needs no page-table page and
+// only one TLB entry.
+static int
+kmappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
+{
+  uint a, last;
+  pte_t *pte;
+
+  a = PGROUNDDOWN((uint)va);
+  last = PGROUNDDOWN(((uint)va) + size - 1);
+  for(;;){
+    if(a % SPGSIZE == 0 && pa % SPGSIZE == 0 && last - a >= SPGSIZE - PGSIZE){
+      if(pgdir[PDX(a)] & PTE_P)
+        panic("remap");
+      pgdir[PDX(a)] = pa | perm | PTE_P | PTE_PS;
+      if(last - a == SPGSIZE - PGSIZE)
+        break;
+      a += SPGSIZE;
+      pa += SPGSIZE;
+      continue;
+    }
+    if((pte = walkpgdir(pgdir, (char*)a, 1)) == 0)
+      return -1;
+    if(*pte & PTE_P)
+      panic("remap");
+    *pte = pa | perm | PTE_P;
+    if(a == last)
+      break;
+    a += PGSIZE;
+    pa += PGSIZE;
+  }
+  return 0;
+}
+
 // There is one page table per process, plus one that's used when
 // a CPU is not running any process (kpgdir). The kernel uses the
 // current process's page table during system calls and interrupts;
@@ -92,13 +152,16 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
-//   data..KERNBASE+PHYSTOP: mapped to V2P(data)..PHYSTOP,
+//   data..KERNBASE+phystop: mapped to V2P(data)..phystop,
 //                                  rw data + free physical memory
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
+// Above the first 4MB the kernel mappings use 4MB superpages
+// (see kmappages); entry.S turns on CR4_PSE on every CPU.
+//
 // The kernel allocates physical memory for its heap and for user memory
-// between V2P(end) and the end of physical memory (PHYSTOP)
-// (directly addressable from end..P2V(PHYSTOP)).
+// between V2P(end) and the end of physical memory (phystop, which
+// kinit1 reads from CMOS) (directly addressable from end..P2V(phystop)).
 
 // This table defines the kernel's mappings, which are present in
 // every process's page table.
@@ -110,37 +173,113 @@ static struct kmap {
 } kmap[] = {
  { (void*)KERNBASE, 0,             EXTMEM,    PTE_W}, // I/O space
  { (void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
- { (void*)data,     V2P(data),     PHYSTOP,   PTE_W}, // kern data+memory
+ { (void*)data,     V2P(data),     0,         PTE_W}, // kern data+memory
  { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
 };
 
-// Set up kernel part of a page table.
-pde_t*
-setupkvm(void)
+// Page directories with the kernel half set up and an empty
+// user half, kept ready so that fork and exec need not build
+// one.  freevm() puts directories back here; idle cpus refill
+// it with fillpgdirs().
+static struct {
+  struct spinlock lock;
+  pde_t *pgdir[NFORKPOOL];
+  int n;
+} pgdirpool;
+
+// Build a page directory with the kernel part of a page table.
+// The kernel half of every address space is identical, so it is
+// built once in kpgdir by kvmalloc(); a new page directory just
+// copies kpgdir's directory entries and so shares its page-table
+// pages.  freevm() never frees them.  If swap is set, user pages
+// may be swapped out to make room, which may sleep.
+static pde_t*
+newpgdir(int swap)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)(swap ? kallocsw() : kalloc())) == 0)
     return 0;
+  ktag((char*)pgdir, KM_PGTBL);
   memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return 0;
-    }
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
   return pgdir;
 }
 
+// Set up kernel part of a page table, preferably by taking a
+// ready one from the pool.  May sleep.
+pde_t*
+setupkvm(void)
+{
+  pde_t *pgdir;
+
+  pgdir = 0;
+  acquire(&pgdirpool.lock);
+  if(pgdirpool.n > 0)
+    pgdir = pgdirpool.pgdir[--pgdirpool.n];
+  release(&pgdirpool.lock);
+  if(pgdir == 0)
+    pgdir = newpgdir(1);
+  return pgdir;
+}
+
+// Put pgdir, whose user half must be empty, in the pool, or
+// free it if the pool is full.
+static void
+putpgdir(pde_t *pgdir)
+{
+  acquire(&pgdirpool.lock);
+  if(pgdirpool.n < NFORKPOOL){
+    pgdirpool.pgdir[pgdirpool.n++] = pgdir;
+    pgdir = 0;
+  }
+  release(&pgdirpool.lock);
+  if(pgdir)
+    kfree((char*)pgdir);
+}
+
+// Top up the page directory pool.  Returns the number of
+// directories added.
+int
+fillpgdirs(void)
+{
+  pde_t *pgdir;
+  int n, full;
+
+  for(n = 0; ; n++){
+    acquire(&pgdirpool.lock);
+    full = pgdirpool.n >= NFORKPOOL;
+    release(&pgdirpool.lock);
+    if(full || (pgdir = newpgdir(0)) == 0)
+      return n;
+    putpgdir(pgdir);
+  }
+}
+
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes.  Its kernel half is shared by
+// every other page table (see setupkvm).
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+
+  initlock(&pgdirpool.lock, "pgdirpool");
+  if((kpgdir = (pde_t*)kalloc()) == 0)
+    panic("kvmalloc");
+  ktag((char*)kpgdir, KM_PGTBL);
+  memset(kpgdir, 0, PGSIZE);
+  kmap[2].phys_end = phystop;   // kern data+memory
+  if (P2V(phystop) > (void*)DEVSPACE)
+    panic("phystop too high");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+    if(kmappages(kpgdir, k->virt, k->phys_end - k->phys_start,
+                (uint)k->phys_start, k->perm) < 0)
+      panic("kvmalloc: out of memory");
+  if((zeropage = kalloc()) == 0)
+    panic("kvmalloc: zeropage");
+  memset(zeropage, 0, PGSIZE);
   switchkvm();
 }
 
@@ -187,6 +326,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
   mem = kalloc();
+  ktag(mem, KM_USER);
   memset(mem, 0, PGSIZE);
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
@@ -231,12 +371,13 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kallocsw();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
+    ktag(mem, KM_USER);
     memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
@@ -248,6 +389,26 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Replace the superpage mapped by directory entry *pde with a
+// page table of ordinary pages covering the same memory.
+// Returns -1 if there is no memory for the page table.
+static int
+splitsuper(pde_t *pde)
+{
+  pte_t *pgtab;
+  uint pa, i;
+
+  if((pgtab = (pte_t*)kalloc()) == 0)
+    return -1;
+  ktag((char*)pgtab, KM_PGTBL);
+  pa = PTE_ADDR(*pde);
+  ksplit4m(P2V(pa));
+  for(i = 0; i < NPTENTRIES; i++)
+    pgtab[i] = (pa + i*PGSIZE) | PTE_P | PTE_W | PTE_U;
+  *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  return 0;
+}
+
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
@@ -263,6 +424,21 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
+    if(pgdir[PDX(a)] & PTE_PS){
+      if(a % SPGSIZE == 0 && a + SPGSIZE <= oldsz){
+        kfree4m(P2V(PTE_ADDR(pgdir[PDX(a)])));
+        pgdir[PDX(a)] = 0;
+        a += SPGSIZE - PGSIZE;
+        continue;
+      }
+      // Freeing part of a superpage: break it up first.  If
+      // that fails the whole superpage stays mapped until the
+      // address space is freed.
+      if(splitsuper(&pgdir[PDX(a)]) < 0){
+        a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+    }
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
@@ -271,7 +447,11 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       if(pa == 0)
         panic("kfree");
       char *v = P2V(pa);
-      kfree(v);
+      if(v != zeropage)
+        kfree(v);
+      *pte = 0;
+    } else if(*pte & PTE_SWAP){
+      swapfree(PTE_ADDR(*pte) >> PGSHIFT);
       *pte = 0;
     }
   }
@@ -279,7 +459,9 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel part's page-table pages
+// belong to kpgdir and are left alone, and the directory
+// itself goes back to the pool if there is room.
 void
 freevm(pde_t *pgdir)
 {
@@ -288,13 +470,14 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
+      pgdir[i] = 0;
     }
   }
-  kfree((char*)pgdir);
+  putpgdir(pgdir);
 }
 
 // Clear PTE_U on a page. Used to create an inaccessible
@@ -310,29 +493,112 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Allocate a page of user memory, swapping another user page
+// out if there is no free memory.  May sleep, so the caller must
+// not hold a spinlock.
+static char*
+ualloc(void)
+{
+  char *mem;
+
+  if((mem = kallocsw()) == 0)
+    return 0;
+  ktag(mem, KM_USER);
+  return mem;
+}
+
+// Copy the user pages of pgdir in [start, end) into d.
+// Read-only pages, and every page if shared is set, are
+// mapped in both rather than copied.
+static int
+copyrange(pde_t *d, pde_t *pgdir, uint start, uint end, int shared)
+{
+  pte_t *pte;
+  uint pa, i, j, flags;
+  char *mem;
+
+  for(i = start; i < end; i += PGSIZE){
+    if(pgdir[PDX(i)] & PTE_PS){
+      // Superpage: copy into a new one if the reserve has
+      // one, else into ordinary pages.
+      pa = PTE_ADDR(pgdir[PDX(i)]);
+      if((mem = kalloc4m()) != 0){
+        memmove(mem, (char*)P2V(pa), SPGSIZE);
+        d[PDX(i)] = V2P(mem) | PTE_FLAGS(pgdir[PDX(i)]);
+      } else {
+        for(j = 0; j < SPGSIZE; j += PGSIZE){
+          if((mem = ualloc()) == 0)
+            return -1;
+          memmove(mem, (char*)P2V(pa + j), PGSIZE);
+          if(mappages(d, (void*)(i + j), PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+            kfree(mem);
+            return -1;
+          }
+        }
+      }
+      i += SPGSIZE - PGSIZE;
+      continue;
+    }
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      // No page table: the whole 4MB range was never touched.
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(!(*pte & (PTE_P|PTE_SWAP)))
+      continue;  // lazily reserved by growproc, not yet touched
+    pa = PTE_ADDR(*pte);
+    flags = PTE_FLAGS(*pte) & ~PTE_PIN;
+    if((flags & PTE_P) &&
+       (shared || ((flags & PTE_U) && !(flags & PTE_W)))){
+      // Read-only page (zeropage or shared program text):
+      // share it; pgfault() copies it if either side writes.
+      // Pages of a MAP_SHARED region are shared writable;
+      // the parent is the one to write back what it dirtied.
+      // Take the reference first: mappages() may swap pages
+      // out, but not one that is shared.
+      if(P2V(pa) != zeropage)
+        kref(P2V(pa));
+      if(mappages(d, (void*)i, PGSIZE, pa, flags & ~PTE_D) < 0){
+        if(P2V(pa) != zeropage)
+          kfree(P2V(pa));
+        return -1;
+      }
+      continue;
+    }
+    // Give the child its own copy.  ualloc() may swap this
+    // very page out, so only look at *pte after it.
+    if((mem = ualloc()) == 0)
+      return -1;
+    if(*pte & PTE_SWAP)
+      swapread(PTE_ADDR(*pte) >> PGSHIFT, mem);
+    else
+      memmove(mem, (char*)P2V(PTE_ADDR(*pte)), PGSIZE);
+    if(mappages(d, (void*)i, PGSIZE, V2P(mem), PTE_FLAGS(*pte) & (PTE_W|PTE_U)) < 0){
+      kfree(mem);
+      return -1;
+    }
+  }
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child: the image below sz and the mmap
+// regions in vma.
 pde_t*
-copyuvm(pde_t *pgdir, uint sz)
+copyuvm(pde_t *pgdir, uint sz, struct vma *vma)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
-  char *mem;
+  int i;
 
   if((d = setupkvm()) == 0)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0)
+  if(copyrange(d, pgdir, 0, sz, 0) < 0)
+    goto bad;
+  for(i = 0; i < NVMA; i++){
+    if(vma[i].flags == 0)
+      continue;
+    if(copyrange(d, pgdir, vma[i].start, vma[i].end,
+                 vma[i].flags & MAP_SHARED) < 0)
       goto bad;
   }
   return d;
@@ -350,7 +616,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -384,9 +650,794 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 }
 
 //PAGEBREAK!
-// Blank page.
-//PAGEBREAK!
-// Blank page.
+// Demand paging.
+//
+// growproc() only moves p->sz; the pages between the old and the
+// new break are not allocated until the process touches them.  A
+// read fault maps the shared zeropage read-only, so a large arena
+// that is only read costs nothing.  A write fault (or a write to
+// the zeropage) allocates a private zeroed page.
+//
+// exec() does not load program segments either.  It records each
+// segment as a vma, and the first touch of a page reads that page
+// from the executable's inode.  Pages read this way are kept in
+// textcache, so that every process running the same binary maps
+// the same physical page read-only.  A write to such a page (or
+// to any read-only page of a writable region) copies it first.
+//
+// mmap() adds regions of the same kind above the heap.  Private
+// file mappings work exactly like program segments and anonymous
+// ones like the heap.  A page of a shared file mapping comes from
+// shmcache, so every process mapping that part of the file maps
+// the same page writable; syncvma() writes it back at munmap,
+// exec and exit if that process dirtied it.
+
+// Cache of program pages, keyed by inode and file offset.  The
+// cache holds one reference to each page (see kref in kalloc.c),
+// and each mapping holds another.  Writing or unlinking the file
+// drops its pages from the cache (see textinval).  Pages are
+// added with the inode locked, so no write can come in between
+// reading a page and caching it.
+struct {
+  struct spinlock lock;
+  uint hand;          // next slot to replace
+  struct {
+    uint dev;
+    uint inum;
+    uint off;         // file offset of the page
+    uint n;           // bytes read from the file; rest is zero
+    char *page;       // 0 if slot unused
+  } slot[NTEXTPG];
+} textcache;
+
+// Pages of shared file mappings, keyed by inode and file offset.
+// Each slot holds one reference to its page, and each mapping
+// another; a slot whose page nobody maps any more (krefcnt is 1)
+// may be reused.  Writing the file drops such pages only, so a
+// page stays shared for as long as it is mapped.
+struct {
+  struct spinlock lock;
+  struct {
+    uint dev;
+    uint inum;
+    uint off;         // file offset of the page
+    char *page;       // 0 if slot unused
+  } slot[NSHMPG];
+} shmcache;
+
+void
+textinit(void)
+{
+  initlock(&textcache.lock, "textcache");
+  initlock(&shmcache.lock, "shmcache");
+}
+
+// Drop the cached pages of ip, except shared-mapping pages that
+// are still mapped.  Caller holds ip->lock.  The caches are only
+// searched if ip->textpg says they may hold some of its pages.
+void
+textinval(struct inode *ip)
+{
+  int i, left;
+
+  if(!ip->textpg)
+    return;
+  acquire(&textcache.lock);
+  for(i = 0; i < NTEXTPG; i++){
+    if(textcache.slot[i].page && textcache.slot[i].dev == ip->dev &&
+       textcache.slot[i].inum == ip->inum){
+      kfree(textcache.slot[i].page);
+      textcache.slot[i].page = 0;
+    }
+  }
+  release(&textcache.lock);
+
+  left = 0;
+  acquire(&shmcache.lock);
+  for(i = 0; i < NSHMPG; i++){
+    if(shmcache.slot[i].page && shmcache.slot[i].dev == ip->dev &&
+       shmcache.slot[i].inum == ip->inum){
+      if(krefcnt(shmcache.slot[i].page) == 1){
+        kfree(shmcache.slot[i].page);
+        shmcache.slot[i].page = 0;
+      } else {
+        left = 1;
+      }
+    }
+  }
+  release(&shmcache.lock);
+  ip->textpg = left;
+}
+
+// Return the region of p containing va, or 0.
+static struct vma*
+findvma(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Return a region of p overlapping [start, end), or 0.
+struct vma*
+vmaoverlap(struct proc *p, uint start, uint end)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end && v->start < end && v->end > start)
+      return v;
+  return 0;
+}
+
+// Read the page at a of region v from its inode into mem,
+// which must be zeroed.  Caller holds v->ip->lock.
+static int
+fillpage(struct vma *v, char *mem, uint a)
+{
+  uint n;
+
+  n = v->filesz - (a - v->start);
+  if(n > PGSIZE)
+    n = PGSIZE;
+  if(readi(v->ip, mem, v->off + (a - v->start), n) != n)
+    return -1;
+  return 0;
+}
+
+// Return the page at a of region v, shared through textcache.
+// The caller gets its own reference to the page.
+static char*
+textpage(struct vma *v, uint a)
+{
+  uint off, n;
+  char *mem;
+  int i;
+
+  off = v->off + (a - v->start);
+  n = v->filesz - (a - v->start);
+  if(n > PGSIZE)
+    n = PGSIZE;
+
+  acquire(&textcache.lock);
+  for(i = 0; i < NTEXTPG; i++){
+    if(textcache.slot[i].page && textcache.slot[i].dev == v->ip->dev &&
+       textcache.slot[i].inum == v->ip->inum &&
+       textcache.slot[i].off == off && textcache.slot[i].n == n){
+      mem = textcache.slot[i].page;
+      kref(mem);
+      release(&textcache.lock);
+      return mem;
+    }
+  }
+  release(&textcache.lock);
+
+  if((mem = ualloc()) == 0)
+    return 0;
+  memset(mem, 0, PGSIZE);
+  ilock(v->ip);
+  if(fillpage(v, mem, a) < 0){
+    iunlock(v->ip);
+    kfree(mem);
+    return 0;
+  }
+  acquire(&textcache.lock);
+  i = textcache.hand;
+  textcache.hand = (i + 1) % NTEXTPG;
+  if(textcache.slot[i].page)
+    kfree(textcache.slot[i].page);
+  textcache.slot[i].dev = v->ip->dev;
+  textcache.slot[i].inum = v->ip->inum;
+  textcache.slot[i].off = off;
+  textcache.slot[i].n = n;
+  textcache.slot[i].page = mem;
+  kref(mem);
+  release(&textcache.lock);
+  v->ip->textpg = 1;
+  iunlock(v->ip);
+  return mem;
+}
+
+// Look up the page at file offset off of (dev, inum) in shmcache
+// and take a reference to it.  Caller holds shmcache.lock.
+static char*
+shmlookup(uint dev, uint inum, uint off)
+{
+  int i;
+
+  for(i = 0; i < NSHMPG; i++){
+    if(shmcache.slot[i].page && shmcache.slot[i].dev == dev &&
+       shmcache.slot[i].inum == inum && shmcache.slot[i].off == off){
+      kref(shmcache.slot[i].page);
+      return shmcache.slot[i].page;
+    }
+  }
+  return 0;
+}
+
+// Return the page at a of shared file region v, the same one
+// every other mapping of that part of the file has.  The caller
+// gets its own reference to the page.  If shmcache is full of
+// mapped pages, the page is the caller's alone.
+static char*
+shmpage(struct vma *v, uint a)
+{
+  uint off;
+  char *mem, *old;
+  int i, free;
+
+  off = v->off + (a - v->start);
+  acquire(&shmcache.lock);
+  mem = shmlookup(v->ip->dev, v->ip->inum, off);
+  release(&shmcache.lock);
+  if(mem)
+    return mem;
+
+  if((mem = ualloc()) == 0)
+    return 0;
+  memset(mem, 0, PGSIZE);
+  ilock(v->ip);
+  if(fillpage(v, mem, a) < 0){
+    iunlock(v->ip);
+    kfree(mem);
+    return 0;
+  }
+
+  // Another process may have read the page meanwhile.
+  acquire(&shmcache.lock);
+  if((old = shmlookup(v->ip->dev, v->ip->inum, off)) != 0){
+    release(&shmcache.lock);
+    iunlock(v->ip);
+    kfree(mem);
+    return old;
+  }
+  free = -1;
+  for(i = 0; i < NSHMPG; i++){
+    if(shmcache.slot[i].page == 0){
+      free = i;
+      break;
+    }
+    if(free < 0 && krefcnt(shmcache.slot[i].page) == 1)
+      free = i;
+  }
+  if(free >= 0){
+    if(shmcache.slot[free].page)
+      kfree(shmcache.slot[free].page);
+    shmcache.slot[free].dev = v->ip->dev;
+    shmcache.slot[free].inum = v->ip->inum;
+    shmcache.slot[free].off = off;
+    shmcache.slot[free].page = mem;
+    kref(mem);
+    v->ip->textpg = 1;
+  }
+  release(&shmcache.lock);
+  iunlock(v->ip);
+  return mem;
+}
+
+// Give the present, read-only page at a a private writable copy.
+// If nobody else holds the page, just make it writable.  Returns
+// 1 if the page was swapped out or remapped while ualloc() slept;
+// the caller should look at the PTE again.
+static int
+cowpage(pte_t *pte, char *a)
+{
+  char *old, *mem;
+
+  mem = 0;
+  old = P2V(PTE_ADDR(*pte));
+  if(old == zeropage || krefcnt(old) > 1){
+    // ualloc() may swap pages out, this one too once the
+    // others let go of it, so only look at *pte after it.
+    if((mem = ualloc()) == 0)
+      return -1;
+    if((*pte & (PTE_P|PTE_W)) != PTE_P){
+      kfree(mem);
+      return 1;
+    }
+    old = P2V(PTE_ADDR(*pte));
+  }
+  if(old != zeropage && krefcnt(old) == 1){
+    *pte |= PTE_W;
+    if(mem)
+      kfree(mem);
+  } else {
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+    if(old != zeropage)
+      kfree(old);
+  }
+  invlpg(a);
+  return 0;
+}
+
+// Can the 4MB range around heap address va be one superpage?
+// It must lie wholly below p->sz, hold no program segment and
+// have nothing mapped in it yet.
+static int
+superfits(struct proc *p, uint va)
+{
+  uint base;
+
+  base = va & ~(SPGSIZE-1);
+  if(base + SPGSIZE > p->sz || base + SPGSIZE < base)
+    return 0;
+  if(p->pgdir[PDX(base)] & PTE_P)
+    return 0;
+  return vmaoverlap(p, base, base + SPGSIZE) == 0;
+}
+
+// Resolve a fault at user address va in process p.  write is
+// non-zero for a write access.  Returns 0 if the page is now
+// mapped, -1 if the access is invalid or memory is exhausted.
+int
+pgfault(struct proc *p, uint va, int write)
+{
+  struct vma *v;
+  pte_t *pte;
+  char *mem;
+  char *a;
+  int perm, r;
+
+  if(va >= KERNBASE)
+    return -1;
+  v = findvma(p, va);
+  if(v == 0 && va >= p->sz)
+    return -1;
+  perm = v ? v->perm : PTE_W;
+  if(write && !(perm & PTE_W))
+    return -1;
+again:
+  if(p->pgdir[PDX(va)] & PTE_PS)
+    return -1;  // superpages are always fully mapped
+  if(v == 0 && p->superpg && superfits(p, va)){
+    if((mem = kalloc4m()) != 0){
+      memset(mem, 0, SPGSIZE);
+      p->pgdir[PDX(va)] = V2P(mem) | PTE_P | PTE_W | PTE_U | PTE_PS;
+      return 0;
+    }
+    // Reserve exhausted: fall back to ordinary pages.
+  }
+  a = (char*)PGROUNDDOWN(va);
+  pte = walkpgdir(p->pgdir, a, 0);
+  if(pte && (*pte & PTE_SWAP)){
+    if((mem = ualloc()) == 0)
+      return -1;
+    // Only present pages are evicted, so the entry cannot
+    // change while ualloc() sleeps; swapin() checks anyway.
+    if(swapin(pte, mem) < 0)
+      kfree(mem);
+    invlpg(a);
+    if(!write || (*pte & PTE_W))
+      return 0;
+  }
+  if(pte && (*pte & PTE_P)){
+    // Present: only a write to a shared read-only page is
+    // resolvable.  Anything else (e.g. the stack guard page)
+    // is a real fault.
+    if(!write || !(*pte & PTE_U) || (*pte & PTE_W))
+      return -1;
+    if((r = cowpage(pte, a)) > 0)
+      goto again;
+    return r;
+  }
+
+  if(v && (v->flags & MAP_SHARED) && (uint)a - v->start < v->filesz){
+    // Shared file page: the page every mapping of this part of
+    // the file shares, written back by syncvma().
+    if((mem = shmpage(v, (uint)a)) == 0)
+      return -1;
+    if(mappages(p->pgdir, a, PGSIZE, V2P(mem), PTE_U|v->perm) < 0){
+      kfree(mem);
+      return -1;
+    }
+    return 0;
+  }
+
+  if(v && (uint)a - v->start < v->filesz){
+    // File-backed page.  Map the shared copy read-only; a later
+    // write will copy it.
+    if((mem = textpage(v, (uint)a)) == 0)
+      return -1;
+    if(mappages(p->pgdir, a, PGSIZE, V2P(mem), PTE_U) < 0){
+      kfree(mem);
+      return -1;
+    }
+    if(write && (r = cowpage(walkpgdir(p->pgdir, a, 0), a)) != 0){
+      if(r > 0)
+        goto again;
+      return r;
+    }
+    return 0;
+  }
+
+  if(!write){
+    if(mappages(p->pgdir, a, PGSIZE, V2P(zeropage), PTE_U) < 0)
+      return -1;
+    return 0;
+  }
+  if((mem = ualloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  if(mappages(p->pgdir, a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Copy the regions of a parent into a child, taking new
+// references on the backing inodes.
+void
+dupvmas(struct vma *dst, struct vma *src)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    dst[i] = src[i];
+    if(dst[i].ip)
+      idup(dst[i].ip);
+    if(dst[i].ip && dst[i].flags == 0)
+      itext(dst[i].ip, 1);
+  }
+}
+
+// Release all regions in vma[0..NVMA).  Must be called inside
+// a transaction, since iput() may free the inode.
+void
+freevmas(struct vma *vma)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    if(vma[i].ip && vma[i].flags == 0)
+      itext(vma[i].ip, -1);
+    if(vma[i].ip)
+      iput(vma[i].ip);
+    memset(&vma[i], 0, sizeof(vma[i]));
+  }
+}
+
+// Write the pages of shared file region v in [start, end) that
+// pgdir has dirtied back to the file, and mark them clean in
+// pgdir.  Must not be called inside a transaction.
+static void
+syncvma(pde_t *pgdir, struct vma *v, uint start, uint end)
+{
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;  // as in filewrite()
+  uint a, i, n, n1;
+  pte_t *pte;
+  char *mem;
+
+  for(a = start; a < end && a - v->start < v->filesz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0 || !(*pte & PTE_P) || !(*pte & PTE_D))
+      continue;
+    // Clear the dirty bit first, so a write during writei()
+    // sets it again.  Hold the page: writei() sleeps, and
+    // swapout() could take it meanwhile.
+    *pte &= ~PTE_D;
+    if(pgdir == myproc()->pgdir)
+      invlpg((void*)a);
+    mem = P2V(PTE_ADDR(*pte));
+    kref(mem);
+    n = v->filesz - (a - v->start);
+    if(n > PGSIZE)
+      n = PGSIZE;
+    for(i = 0; i < n; i += n1){
+      n1 = n - i;
+      if(n1 > max)
+        n1 = max;
+      begin_op();
+      ilock(v->ip);
+      writei(v->ip, mem + i, v->off + (a - v->start) + i, n1);
+      iunlock(v->ip);
+      end_op();
+    }
+    kfree(mem);
+  }
+}
+
+// Write back every shared file region in vma[0..NVMA) of pgdir.
+void
+syncvmas(pde_t *pgdir, struct vma *vma)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++)
+    if(vma[i].ip && (vma[i].flags & MAP_SHARED))
+      syncvma(pgdir, &vma[i], vma[i].start, vma[i].end);
+}
+
+// Map len bytes of ip from offset off (or zero-filled memory
+// if ip is 0) into p, below KERNBASE and above the heap.
+// Nothing is read until the pages are touched.  Returns the
+// address of the region, or -1.
+int
+vmamap(struct proc *p, uint len, int perm, int flags, struct inode *ip, uint off)
+{
+  struct vma *v, *nv;
+  uint start;
+
+  len = PGROUNDUP(len);
+  if(len == 0 || len >= KERNBASE)
+    return -1;
+  nv = 0;
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->end == 0){
+      nv = v;
+      break;
+    }
+  }
+  if(nv == 0)
+    return -1;
+
+  // Take the highest free range.
+  start = KERNBASE - len;
+  while((v = vmaoverlap(p, start, start + len)) != 0){
+    if(v->start < len)
+      return -1;
+    start = v->start - len;
+  }
+  if(start < PGROUNDUP(p->sz))
+    return -1;
+
+  nv->start = start;
+  nv->end = start + len;
+  nv->off = off;
+  nv->filesz = 0;
+  nv->perm = perm;
+  nv->flags = flags;
+  nv->ip = 0;
+  if(ip){
+    ilock(ip);
+    if(ip->size > off)
+      nv->filesz = ip->size - off;
+    iunlock(ip);
+    if(nv->filesz > len)
+      nv->filesz = len;
+    nv->ip = idup(ip);
+  }
+  return start;
+}
+
+// Remove the mmap regions of p in [addr, addr+len), writing back
+// shared pages first.  A region may be cut at either end or
+// split in two.  Returns 0, or -1 if the arguments are bad or a
+// split needs a free region slot and there is none.
+int
+vmaunmap(struct proc *p, uint addr, uint len)
+{
+  struct vma *v, *nv;
+  uint a, b, s, e;
+
+  a = addr;
+  b = addr + PGROUNDUP(len);
+  if(a % PGSIZE || len == 0 || b < a || b > KERNBASE)
+    return -1;
+  nv = 0;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end == 0 && nv == 0)
+      nv = v;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->flags && v->start < a && v->end > b && nv == 0)
+      return -1;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->flags == 0 || v->end <= a || v->start >= b)
+      continue;
+    s = v->start > a ? v->start : a;
+    e = v->end < b ? v->end : b;
+    if(v->ip && (v->flags & MAP_SHARED))
+      syncvma(p->pgdir, v, s, e);
+    deallocuvm(p->pgdir, e, s);
+    if(s == v->start && e == v->end){
+      if(v->ip){
+        begin_op();
+        iput(v->ip);
+        end_op();
+      }
+      memset(v, 0, sizeof(*v));
+    } else if(s == v->start){
+      v->filesz = v->filesz > e - v->start ? v->filesz - (e - v->start) : 0;
+      v->off += e - v->start;
+      v->start = e;
+    } else {
+      if(e < v->end){
+        *nv = *v;
+        nv->start = e;
+        nv->off = v->off + (e - v->start);
+        nv->filesz = v->filesz > e - v->start ? v->filesz - (e - v->start) : 0;
+        if(nv->ip)
+          idup(nv->ip);
+      }
+      v->end = s;
+      if(v->filesz > s - v->start)
+        v->filesz = s - v->start;
+    }
+  }
+  lcr3(V2P(p->pgdir));
+  return 0;
+}
+
+// Record that [start, end) of p may hold pinned pages.  When all
+// NPIN ranges are taken the last one is stretched to cover it.
+static void
+uvmpin(struct proc *p, uint start, uint end)
+{
+  int i;
+
+  for(i = 0; i < p->npin; i++){
+    if(start <= p->pin[i].end && end >= p->pin[i].start){
+      if(start < p->pin[i].start)
+        p->pin[i].start = start;
+      if(end > p->pin[i].end)
+        p->pin[i].end = end;
+      return;
+    }
+  }
+  if(p->npin < NPIN){
+    p->pin[p->npin].start = start;
+    p->pin[p->npin].end = end;
+    p->npin++;
+    return;
+  }
+  if(start < p->pin[NPIN-1].start)
+    p->pin[NPIN-1].start = start;
+  if(end > p->pin[NPIN-1].end)
+    p->pin[NPIN-1].end = end;
+}
+
+// Make sure the user pages covering [va, va+n) of the current
+// process are mapped, so that the kernel can access them without
+// taking a page fault.  Used to validate system call arguments.
+// The pages are pinned until the system call returns, so that
+// swapout() leaves them be (see uvmunpin).
+int
+uvmtouch(uint va, uint n, int write)
+{
+  struct proc *p = myproc();
+  pte_t *pte;
+  uint a, last;
+
+  if(n == 0)
+    return 0;
+  if(va + n < va || va + n > KERNBASE)
+    return -1;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + n - 1);
+  uvmpin(p, a, last + PGSIZE);
+  for(;; a += PGSIZE){
+    if(p->pgdir[PDX(a)] & PTE_PS){
+      if(a == last)
+        break;
+      continue;
+    }
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte == 0 || !(*pte & PTE_P) || !(*pte & PTE_U) ||
+       (write && !(*pte & PTE_W))){
+      if(pgfault(p, a, write) < 0)
+        return -1;
+      pte = walkpgdir(p->pgdir, (char*)a, 0);
+    }
+    if(pte)
+      *pte |= PTE_PIN;  // else pgfault() mapped a superpage
+    if(a == last)
+      break;
+  }
+  return 0;
+}
+
+// Unpin the pages uvmtouch() pinned for p's system call.
+void
+uvmunpin(struct proc *p)
+{
+  pte_t *pte;
+  uint a;
+  int i;
+
+  for(i = 0; i < p->npin; i++){
+    for(a = p->pin[i].start; a < p->pin[i].end; a += PGSIZE){
+      if(p->pgdir[PDX(a)] & PTE_PS){
+        a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+      if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0){
+        a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+      if(*pte & PTE_P)
+        *pte &= ~PTE_PIN;
+    }
+  }
+  p->npin = 0;
+}
+
+// Count the resident (present, privately owned) user pages
+// below sz, for reporting in ps.
+int
+uvmrss(pde_t *pgdir, uint sz)
+{
+  pte_t *pte;
+  uint a;
+  int n;
+
+  n = 0;
+  for(a = 0; a < sz; a += PGSIZE){
+    if(pgdir[PDX(a)] & PTE_PS){
+      n += SPGSIZE / PGSIZE;
+      a += SPGSIZE - PGSIZE;
+      continue;
+    }
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if((*pte & PTE_P) && P2V(PTE_ADDR(*pte)) != zeropage)
+      n++;
+  }
+  return n;
+}
+
+// Count the page-table pages of pgdir's user half, including
+// the directory itself.
+int
+uvmptpages(pde_t *pgdir)
+{
+  int i, n;
+
+  n = 1;
+  for(i = 0; i < PDX(KERNBASE); i++)
+    if((pgdir[i] & PTE_P) && !(pgdir[i] & PTE_PS))
+      n++;
+  return n;
+}
+
 //PAGEBREAK!
 // Blank page.
 
+// Look for a page of p to swap out, starting at *va, for
+// swapvictim().  A page accessed since the last look gets a
+// second chance: its accessed bit is cleared instead.  Only
+// present, unpinned user pages below sz that no one else maps
+// are candidates.  On success the PTE is replaced by a swap entry
+// for slot and the page is returned.
+char*
+pgevict(struct proc *p, uint *va, uint slot)
+{
+  pte_t *pte;
+  char *mem;
+  uint a;
+
+  for(a = *va; a < p->sz; a += PGSIZE){
+    if(p->pgdir[PDX(a)] & PTE_PS){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if((*pte & (PTE_P|PTE_U|PTE_PIN)) != (PTE_P|PTE_U))
+      continue;
+    mem = P2V(PTE_ADDR(*pte));
+    if(mem == zeropage || krefcnt(mem) != 1)
+      continue;
+    if(*pte & PTE_A){
+      *pte &= ~PTE_A;
+      if(p == myproc())
+        invlpg((void*)a);
+      continue;
+    }
+    *pte = (slot << PGSHIFT) | PTE_SWAP | (*pte & (PTE_W|PTE_U));
+    if(p == myproc())
+      invlpg((void*)a);
+    *va = a + PGSIZE;
+    return mem;
+  }
+  *va = a;
+  return 0;
+}
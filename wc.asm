@@ -0,0 +1,1807 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 42 04 00 00       	call   48b <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 46 04 00 00       	call   4a3 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 cb 0b 00 00       	push   $0xbcb
+  6e:	6a 01                	push   $0x1
+  70:	e8 eb 05 00 00       	call   660 <printf>
+      exit();
+  75:	e8 e9 03 00 00       	call   463 <exit>
+  }
+  exit();
+  7a:	e8 e4 03 00 00       	call   463 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 bd 0b 00 00       	push   $0xbbd
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 d1 03 00 00       	call   463 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 40 10 00 00       	push   $0x1040
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 a6 03 00 00       	call   47b <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 40 10 00 00 	movsbl 0x1040(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 a8 0b 00 00       	push   $0xba8
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 be 0b 00 00       	push   $0xbbe
+ 155:	6a 01                	push   $0x1
+ 157:	e8 04 05 00 00       	call   660 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 ae 0b 00 00       	push   $0xbae
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 eb 04 00 00       	call   660 <printf>
+    exit();
+ 175:	e8 e9 02 00 00       	call   463 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 be 01 00 00       	call   47b <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 91 01 00 00       	call   4a3 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 94 01 00 00       	call   4bb <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 5a 01 00 00       	call   48b <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+ 355:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 358:	0f b6 02             	movzbl (%edx),%eax
+ 35b:	3c 20                	cmp    $0x20,%al
+ 35d:	75 0c                	jne    36b <atoi+0x1b>
+ 35f:	90                   	nop
+ 360:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 364:	83 c2 01             	add    $0x1,%edx
+ 367:	3c 20                	cmp    $0x20,%al
+ 369:	74 f5                	je     360 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 36b:	3c 2d                	cmp    $0x2d,%al
+ 36d:	74 41                	je     3b0 <atoi+0x60>
+ 36f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 374:	3c 2b                	cmp    $0x2b,%al
+ 376:	74 3d                	je     3b5 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 378:	0f be 0a             	movsbl (%edx),%ecx
+ 37b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 37e:	3c 09                	cmp    $0x9,%al
+ 380:	b8 00 00 00 00       	mov    $0x0,%eax
+ 385:	77 21                	ja     3a8 <atoi+0x58>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 390:	83 c2 01             	add    $0x1,%edx
+ 393:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 396:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 39a:	0f be 0a             	movsbl (%edx),%ecx
+ 39d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 3a0:	80 fb 09             	cmp    $0x9,%bl
+ 3a3:	76 eb                	jbe    390 <atoi+0x40>
+  return sign*n;
+ 3a5:	0f af c6             	imul   %esi,%eax
+}
+ 3a8:	5b                   	pop    %ebx
+ 3a9:	5e                   	pop    %esi
+ 3aa:	5d                   	pop    %ebp
+ 3ab:	c3                   	ret
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 3b5:	83 c2 01             	add    $0x1,%edx
+ 3b8:	eb be                	jmp    378 <atoi+0x28>
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003c0 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	56                   	push   %esi
+ 3c4:	53                   	push   %ebx
+ 3c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 3c8:	0f b6 02             	movzbl (%edx),%eax
+ 3cb:	3c 20                	cmp    $0x20,%al
+ 3cd:	75 0c                	jne    3db <atoo+0x1b>
+ 3cf:	90                   	nop
+ 3d0:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 3d4:	83 c2 01             	add    $0x1,%edx
+ 3d7:	3c 20                	cmp    $0x20,%al
+ 3d9:	74 f5                	je     3d0 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 3db:	3c 2d                	cmp    $0x2d,%al
+ 3dd:	74 41                	je     420 <atoo+0x60>
+ 3df:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 3e4:	3c 2b                	cmp    $0x2b,%al
+ 3e6:	74 3d                	je     425 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 3e8:	0f be 0a             	movsbl (%edx),%ecx
+ 3eb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 3ee:	3c 07                	cmp    $0x7,%al
+ 3f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3f5:	77 1e                	ja     415 <atoo+0x55>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 400:	83 c2 01             	add    $0x1,%edx
+ 403:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 407:	0f be 0a             	movsbl (%edx),%ecx
+ 40a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 40d:	80 fb 07             	cmp    $0x7,%bl
+ 410:	76 ee                	jbe    400 <atoo+0x40>
+  return sign*n;
+ 412:	0f af c6             	imul   %esi,%eax
+}
+ 415:	5b                   	pop    %ebx
+ 416:	5e                   	pop    %esi
+ 417:	5d                   	pop    %ebp
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 425:	83 c2 01             	add    $0x1,%edx
+ 428:	eb be                	jmp    3e8 <atoo+0x28>
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	8b 45 10             	mov    0x10(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 43e:	85 c0                	test   %eax,%eax
+ 440:	7e 13                	jle    455 <memmove+0x25>
+ 442:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 444:	89 d7                	mov    %edx,%edi
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 450:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 451:	39 f8                	cmp    %edi,%eax
+ 453:	75 fb                	jne    450 <memmove+0x20>
+  return vdst;
+}
+ 455:	5e                   	pop    %esi
+ 456:	89 d0                	mov    %edx,%eax
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+ 45a:	c3                   	ret
+
+0000045b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 45b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <exit>:
+SYSCALL(exit)
+ 463:	b8 02 00 00 00       	mov    $0x2,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <wait>:
+SYSCALL(wait)
+ 46b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <pipe>:
+SYSCALL(pipe)
+ 473:	b8 04 00 00 00       	mov    $0x4,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <read>:
+SYSCALL(read)
+ 47b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <write>:
+SYSCALL(write)
+ 483:	b8 10 00 00 00       	mov    $0x10,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <close>:
+SYSCALL(close)
+ 48b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <kill>:
+SYSCALL(kill)
+ 493:	b8 06 00 00 00       	mov    $0x6,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <exec>:
+SYSCALL(exec)
+ 49b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <open>:
+SYSCALL(open)
+ 4a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mknod>:
+SYSCALL(mknod)
+ 4ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <unlink>:
+SYSCALL(unlink)
+ 4b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <fstat>:
+SYSCALL(fstat)
+ 4bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <link>:
+SYSCALL(link)
+ 4c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mkdir>:
+SYSCALL(mkdir)
+ 4cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <chdir>:
+SYSCALL(chdir)
+ 4d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <dup>:
+SYSCALL(dup)
+ 4db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <getpid>:
+SYSCALL(getpid)
+ 4e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <sbrk>:
+SYSCALL(sbrk)
+ 4eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <sleep>:
+SYSCALL(sleep)
+ 4f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <uptime>:
+SYSCALL(uptime)
+ 4fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <superpages>:
+SYSCALL(superpages)
+ 503:	b8 23 00 00 00       	mov    $0x23,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mmap>:
+SYSCALL(mmap)
+ 50b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <munmap>:
+SYSCALL(munmap)
+ 513:	b8 25 00 00 00       	mov    $0x25,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <spawn>:
+SYSCALL(spawn)
+ 51b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <swapstat>:
+SYSCALL(swapstat)
+ 523:	b8 27 00 00 00       	mov    $0x27,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <getmeminfo>:
+SYSCALL(getmeminfo)
+ 52b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <iostat>:
+SYSCALL(iostat)
+ 533:	b8 29 00 00 00       	mov    $0x29,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dropcache>:
+SYSCALL(dropcache)
+ 53b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <iosched>:
+SYSCALL(iosched)
+ 543:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <halt>:
+SYSCALL(halt)
+ 54b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <date>:
+SYSCALL(date)
+ 553:	b8 17 00 00 00       	mov    $0x17,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 55b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getgid>:
+SYSCALL(getgid)
+ 563:	b8 19 00 00 00       	mov    $0x19,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <getppid>:
+SYSCALL(getppid)
+ 56b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <setuid>:
+SYSCALL(setuid)
+ 573:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <setgid>:
+SYSCALL(setgid)
+ 57b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getprocs>:
+SYSCALL(getprocs)
+ 583:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 58b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getpriority>:
+SYSCALL(getpriority)
+ 593:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 59b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <chown>:
+SYSCALL(chown)
+ 5a3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <chgrp>:
+SYSCALL(chgrp)
+ 5ab:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+ 5b3:	66 90                	xchg   %ax,%ax
+ 5b5:	66 90                	xchg   %ax,%ax
+ 5b7:	66 90                	xchg   %ax,%ax
+ 5b9:	66 90                	xchg   %ax,%ax
+ 5bb:	66 90                	xchg   %ax,%ax
+ 5bd:	66 90                	xchg   %ax,%ax
+ 5bf:	90                   	nop
+
+000005c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5c8:	89 d1                	mov    %edx,%ecx
+{
+ 5ca:	83 ec 3c             	sub    $0x3c,%esp
+ 5cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5d0:	85 d2                	test   %edx,%edx
+ 5d2:	0f 89 80 00 00 00    	jns    658 <printint+0x98>
+ 5d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5dc:	74 7a                	je     658 <printint+0x98>
+    x = -xx;
+ 5de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5e8:	31 f6                	xor    %esi,%esi
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5f0:	89 c8                	mov    %ecx,%eax
+ 5f2:	31 d2                	xor    %edx,%edx
+ 5f4:	89 f7                	mov    %esi,%edi
+ 5f6:	f7 f3                	div    %ebx
+ 5f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5fb:	0f b6 92 40 0c 00 00 	movzbl 0xc40(%edx),%edx
+ 602:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 606:	89 ca                	mov    %ecx,%edx
+ 608:	89 c1                	mov    %eax,%ecx
+ 60a:	39 da                	cmp    %ebx,%edx
+ 60c:	73 e2                	jae    5f0 <printint+0x30>
+  if(neg)
+ 60e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 611:	85 c0                	test   %eax,%eax
+ 613:	74 07                	je     61c <printint+0x5c>
+    buf[i++] = '-';
+ 615:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 61a:	89 f7                	mov    %esi,%edi
+ 61c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 61f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 622:	01 df                	add    %ebx,%edi
+ 624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 628:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 62b:	83 ec 04             	sub    $0x4,%esp
+ 62e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 631:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 634:	6a 01                	push   $0x1
+ 636:	50                   	push   %eax
+ 637:	56                   	push   %esi
+ 638:	e8 46 fe ff ff       	call   483 <write>
+  while(--i >= 0)
+ 63d:	89 f8                	mov    %edi,%eax
+ 63f:	83 c4 10             	add    $0x10,%esp
+ 642:	83 ef 01             	sub    $0x1,%edi
+ 645:	39 d8                	cmp    %ebx,%eax
+ 647:	75 df                	jne    628 <printint+0x68>
+}
+ 649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64c:	5b                   	pop    %ebx
+ 64d:	5e                   	pop    %esi
+ 64e:	5f                   	pop    %edi
+ 64f:	5d                   	pop    %ebp
+ 650:	c3                   	ret
+ 651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 658:	31 c0                	xor    %eax,%eax
+ 65a:	eb 89                	jmp    5e5 <printint+0x25>
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 669:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 66c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 66f:	0f b6 1e             	movzbl (%esi),%ebx
+ 672:	83 c6 01             	add    $0x1,%esi
+ 675:	84 db                	test   %bl,%bl
+ 677:	74 67                	je     6e0 <printf+0x80>
+ 679:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 67c:	31 d2                	xor    %edx,%edx
+ 67e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 681:	eb 34                	jmp    6b7 <printf+0x57>
+ 683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 687:	90                   	nop
+ 688:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 68b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 690:	83 f8 25             	cmp    $0x25,%eax
+ 693:	74 18                	je     6ad <printf+0x4d>
+  write(fd, &c, 1);
+ 695:	83 ec 04             	sub    $0x4,%esp
+ 698:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 69b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69e:	6a 01                	push   $0x1
+ 6a0:	50                   	push   %eax
+ 6a1:	57                   	push   %edi
+ 6a2:	e8 dc fd ff ff       	call   483 <write>
+ 6a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b0:	83 c6 01             	add    $0x1,%esi
+ 6b3:	84 db                	test   %bl,%bl
+ 6b5:	74 29                	je     6e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ba:	85 d2                	test   %edx,%edx
+ 6bc:	74 ca                	je     688 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6be:	83 fa 25             	cmp    $0x25,%edx
+ 6c1:	75 ea                	jne    6ad <printf+0x4d>
+      if(c == 'd'){
+ 6c3:	83 f8 25             	cmp    $0x25,%eax
+ 6c6:	0f 84 24 01 00 00    	je     7f0 <printf+0x190>
+ 6cc:	83 e8 63             	sub    $0x63,%eax
+ 6cf:	83 f8 15             	cmp    $0x15,%eax
+ 6d2:	77 1c                	ja     6f0 <printf+0x90>
+ 6d4:	ff 24 85 e8 0b 00 00 	jmp    *0xbe8(,%eax,4)
+ 6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e3:	5b                   	pop    %ebx
+ 6e4:	5e                   	pop    %esi
+ 6e5:	5f                   	pop    %edi
+ 6e6:	5d                   	pop    %ebp
+ 6e7:	c3                   	ret
+ 6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6fa:	6a 01                	push   $0x1
+ 6fc:	52                   	push   %edx
+ 6fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 700:	57                   	push   %edi
+ 701:	e8 7d fd ff ff       	call   483 <write>
+ 706:	83 c4 0c             	add    $0xc,%esp
+ 709:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70c:	6a 01                	push   $0x1
+ 70e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 711:	52                   	push   %edx
+ 712:	57                   	push   %edi
+ 713:	e8 6b fd ff ff       	call   483 <write>
+        putc(fd, c);
+ 718:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71b:	31 d2                	xor    %edx,%edx
+ 71d:	eb 8e                	jmp    6ad <printf+0x4d>
+ 71f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 00                	push   $0x0
+ 72f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 731:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 734:	e8 87 fe ff ff       	call   5c0 <printint>
+        ap++;
+ 739:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 73c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 67 ff ff ff       	jmp    6ad <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 750:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 753:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 755:	83 c0 04             	add    $0x4,%eax
+ 758:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 75b:	85 db                	test   %ebx,%ebx
+ 75d:	0f 84 9d 00 00 00    	je     800 <printf+0x1a0>
+        while(*s != 0){
+ 763:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 766:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 768:	84 c0                	test   %al,%al
+ 76a:	0f 84 3d ff ff ff    	je     6ad <printf+0x4d>
+ 770:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 773:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 776:	89 de                	mov    %ebx,%esi
+ 778:	89 d3                	mov    %edx,%ebx
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 786:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 789:	6a 01                	push   $0x1
+ 78b:	53                   	push   %ebx
+ 78c:	57                   	push   %edi
+ 78d:	e8 f1 fc ff ff       	call   483 <write>
+        while(*s != 0){
+ 792:	0f b6 06             	movzbl (%esi),%eax
+ 795:	83 c4 10             	add    $0x10,%esp
+ 798:	84 c0                	test   %al,%al
+ 79a:	75 e4                	jne    780 <printf+0x120>
+      state = 0;
+ 79c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 07 ff ff ff       	jmp    6ad <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7bb:	8b 13                	mov    (%ebx),%edx
+ 7bd:	6a 01                	push   $0x1
+ 7bf:	e9 6b ff ff ff       	jmp    72f <printf+0xcf>
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7cb:	83 ec 04             	sub    $0x4,%esp
+ 7ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	52                   	push   %edx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 a1 fc ff ff       	call   483 <write>
+        ap++;
+ 7e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7e8:	31 d2                	xor    %edx,%edx
+ 7ea:	e9 be fe ff ff       	jmp    6ad <printf+0x4d>
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	e9 11 ff ff ff       	jmp    711 <printf+0xb1>
+ 800:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 805:	bb df 0b 00 00       	mov    $0xbdf,%ebx
+ 80a:	e9 61 ff ff ff       	jmp    770 <printf+0x110>
+ 80f:	90                   	nop
+
+00000810 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 813:	a1 64 12 00 00       	mov    0x1264,%eax
+{
+ 818:	89 e5                	mov    %esp,%ebp
+ 81a:	56                   	push   %esi
+ 81b:	53                   	push   %ebx
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 820:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 822:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 824:	39 ca                	cmp    %ecx,%edx
+ 826:	73 30                	jae    858 <lfree+0x48>
+ 828:	39 c1                	cmp    %eax,%ecx
+ 82a:	72 04                	jb     830 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 82c:	39 c2                	cmp    %eax,%edx
+ 82e:	72 f0                	jb     820 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 830:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 833:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 836:	39 f0                	cmp    %esi,%eax
+ 838:	74 26                	je     860 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 83a:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 83c:	8b 42 04             	mov    0x4(%edx),%eax
+ 83f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 842:	39 d9                	cmp    %ebx,%ecx
+ 844:	74 30                	je     876 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 846:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 848:	5b                   	pop    %ebx
+  freep = p;
+ 849:	89 15 64 12 00 00    	mov    %edx,0x1264
+}
+ 84f:	5e                   	pop    %esi
+ 850:	5d                   	pop    %ebp
+ 851:	c3                   	ret
+ 852:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 858:	39 c1                	cmp    %eax,%ecx
+ 85a:	72 d0                	jb     82c <lfree+0x1c>
+ 85c:	eb c2                	jmp    820 <lfree+0x10>
+ 85e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 860:	03 58 04             	add    0x4(%eax),%ebx
+ 863:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 866:	8b 02                	mov    (%edx),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 86c:	8b 42 04             	mov    0x4(%edx),%eax
+ 86f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 872:	39 d9                	cmp    %ebx,%ecx
+ 874:	75 d0                	jne    846 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 876:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 879:	89 15 64 12 00 00    	mov    %edx,0x1264
+    p->s.size += bp->s.size;
+ 87f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 882:	8b 09                	mov    (%ecx),%ecx
+ 884:	89 0a                	mov    %ecx,(%edx)
+}
+ 886:	5b                   	pop    %ebx
+ 887:	5e                   	pop    %esi
+ 888:	5d                   	pop    %ebp
+ 889:	c3                   	ret
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000890 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	89 c7                	mov    %eax,%edi
+ 896:	56                   	push   %esi
+ 897:	53                   	push   %ebx
+ 898:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 89b:	a1 64 12 00 00       	mov    0x1264,%eax
+ 8a0:	85 c0                	test   %eax,%eax
+ 8a2:	0f 84 88 00 00 00    	je     930 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 8aa:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 8ad:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8b2:	39 df                	cmp    %ebx,%edi
+ 8b4:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8b7:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 8be:	39 f9                	cmp    %edi,%ecx
+ 8c0:	72 0f                	jb     8d1 <lalloc+0x41>
+ 8c2:	eb 4c                	jmp    910 <lalloc+0x80>
+ 8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c8:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 8ca:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 8cd:	39 f9                	cmp    %edi,%ecx
+ 8cf:	73 3f                	jae    910 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 8d1:	89 d0                	mov    %edx,%eax
+ 8d3:	39 15 64 12 00 00    	cmp    %edx,0x1264
+ 8d9:	75 ed                	jne    8c8 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 8db:	83 ec 0c             	sub    $0xc,%esp
+ 8de:	56                   	push   %esi
+ 8df:	e8 07 fc ff ff       	call   4eb <sbrk>
+  if(p == (char*)-1)
+ 8e4:	83 c4 10             	add    $0x10,%esp
+ 8e7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8ea:	74 11                	je     8fd <lalloc+0x6d>
+  hp->s.size = nu;
+ 8ec:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 8ef:	e8 1c ff ff ff       	call   810 <lfree>
+  return freep;
+ 8f4:	a1 64 12 00 00       	mov    0x1264,%eax
+      if((p = morecore(nunits)) == 0)
+ 8f9:	85 c0                	test   %eax,%eax
+ 8fb:	75 cb                	jne    8c8 <lalloc+0x38>
+        return 0;
+  }
+}
+ 8fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 900:	31 d2                	xor    %edx,%edx
+}
+ 902:	5b                   	pop    %ebx
+ 903:	89 d0                	mov    %edx,%eax
+ 905:	5e                   	pop    %esi
+ 906:	5f                   	pop    %edi
+ 907:	5d                   	pop    %ebp
+ 908:	c3                   	ret
+ 909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 910:	39 cf                	cmp    %ecx,%edi
+ 912:	74 4c                	je     960 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 914:	29 f9                	sub    %edi,%ecx
+ 916:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 919:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 91c:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 91f:	a3 64 12 00 00       	mov    %eax,0x1264
+}
+ 924:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 927:	89 d0                	mov    %edx,%eax
+ 929:	5b                   	pop    %ebx
+ 92a:	5e                   	pop    %esi
+ 92b:	5f                   	pop    %edi
+ 92c:	5d                   	pop    %ebp
+ 92d:	c3                   	ret
+ 92e:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 930:	ba 68 12 00 00       	mov    $0x1268,%edx
+ 935:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 937:	c7 05 64 12 00 00 68 	movl   $0x1268,0x1264
+ 93e:	12 00 00 
+ 941:	c7 05 68 12 00 00 68 	movl   $0x1268,0x1268
+ 948:	12 00 00 
+ 94b:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 94d:	c7 05 6c 12 00 00 00 	movl   $0x0,0x126c
+ 954:	00 00 00 
+ 957:	e9 51 ff ff ff       	jmp    8ad <lalloc+0x1d>
+ 95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 960:	8b 0a                	mov    (%edx),%ecx
+ 962:	89 08                	mov    %ecx,(%eax)
+ 964:	eb b9                	jmp    91f <lalloc+0x8f>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000970 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 979:	85 f6                	test   %esi,%esi
+ 97b:	74 42                	je     9bf <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 97d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 980:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 983:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 989:	77 3d                	ja     9c8 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 98b:	31 c9                	xor    %ecx,%ecx
+ 98d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 992:	83 fa 02             	cmp    $0x2,%edx
+ 995:	74 17                	je     9ae <free+0x3e>
+ 997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99e:	66 90                	xchg   %ax,%ax
+ 9a0:	83 c1 01             	add    $0x1,%ecx
+ 9a3:	89 d8                	mov    %ebx,%eax
+ 9a5:	d3 e0                	shl    %cl,%eax
+ 9a7:	83 c0 01             	add    $0x1,%eax
+ 9aa:	39 c2                	cmp    %eax,%edx
+ 9ac:	75 f2                	jne    9a0 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 9ae:	8b 04 8d 40 12 00 00 	mov    0x1240(,%ecx,4),%eax
+  classes[c] = bp;
+ 9b5:	89 3c 8d 40 12 00 00 	mov    %edi,0x1240(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 9bc:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 9bf:	5b                   	pop    %ebx
+ 9c0:	5e                   	pop    %esi
+ 9c1:	5f                   	pop    %edi
+ 9c2:	5d                   	pop    %ebp
+ 9c3:	c3                   	ret
+ 9c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9c8:	5b                   	pop    %ebx
+    lfree(bp);
+ 9c9:	89 f8                	mov    %edi,%eax
+}
+ 9cb:	5e                   	pop    %esi
+ 9cc:	5f                   	pop    %edi
+ 9cd:	5d                   	pop    %ebp
+    lfree(bp);
+ 9ce:	e9 3d fe ff ff       	jmp    810 <lfree>
+ 9d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ec:	83 c0 07             	add    $0x7,%eax
+ 9ef:	c1 e8 03             	shr    $0x3,%eax
+ 9f2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 9f5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 9fa:	77 44                	ja     a40 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 9fc:	31 c9                	xor    %ecx,%ecx
+ 9fe:	ba 01 00 00 00       	mov    $0x1,%edx
+ a03:	bb 02 00 00 00       	mov    $0x2,%ebx
+ a08:	83 f8 02             	cmp    $0x2,%eax
+ a0b:	76 11                	jbe    a1e <malloc+0x3e>
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+ a10:	83 c1 01             	add    $0x1,%ecx
+ a13:	89 d3                	mov    %edx,%ebx
+ a15:	d3 e3                	shl    %cl,%ebx
+ a17:	83 c3 01             	add    $0x1,%ebx
+ a1a:	39 c3                	cmp    %eax,%ebx
+ a1c:	72 f2                	jb     a10 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ a1e:	8b 04 8d 40 12 00 00 	mov    0x1240(,%ecx,4),%eax
+ a25:	85 c0                	test   %eax,%eax
+ a27:	74 2f                	je     a58 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ a29:	8b 10                	mov    (%eax),%edx
+ a2b:	89 14 8d 40 12 00 00 	mov    %edx,0x1240(,%ecx,4)
+  return (void*)(p + 1);
+ a32:	83 c0 08             	add    $0x8,%eax
+}
+ a35:	83 c4 1c             	add    $0x1c,%esp
+ a38:	5b                   	pop    %ebx
+ a39:	5e                   	pop    %esi
+ a3a:	5f                   	pop    %edi
+ a3b:	5d                   	pop    %ebp
+ a3c:	c3                   	ret
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ a40:	e8 4b fe ff ff       	call   890 <lalloc>
+ a45:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ a47:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ a4a:	85 d2                	test   %edx,%edx
+ a4c:	75 e7                	jne    a35 <malloc+0x55>
+      return 0;
+ a4e:	31 c0                	xor    %eax,%eax
+ a50:	eb e3                	jmp    a35 <malloc+0x55>
+ a52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ a58:	31 d2                	xor    %edx,%edx
+ a5a:	b8 00 02 00 00       	mov    $0x200,%eax
+ a5f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a62:	f7 f3                	div    %ebx
+  if(n < 4)
+ a64:	ba 04 00 00 00       	mov    $0x4,%edx
+ a69:	89 d6                	mov    %edx,%esi
+ a6b:	39 d0                	cmp    %edx,%eax
+ a6d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ a70:	0f af f3             	imul   %ebx,%esi
+ a73:	89 f0                	mov    %esi,%eax
+ a75:	e8 16 fe ff ff       	call   890 <lalloc>
+ a7a:	85 c0                	test   %eax,%eax
+ a7c:	74 d0                	je     a4e <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ a7e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a81:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ a84:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a8b:	8b 14 8d 40 12 00 00 	mov    0x1240(,%ecx,4),%edx
+ a92:	39 f8                	cmp    %edi,%eax
+ a94:	73 22                	jae    ab8 <malloc+0xd8>
+ a96:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a99:	eb 09                	jmp    aa4 <malloc+0xc4>
+ a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+ aa0:	89 c2                	mov    %eax,%edx
+ aa2:	89 c8                	mov    %ecx,%eax
+ aa4:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ aa7:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ aaa:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ aac:	39 f9                	cmp    %edi,%ecx
+ aae:	72 f0                	jb     aa0 <malloc+0xc0>
+ ab0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ ab3:	e9 73 ff ff ff       	jmp    a2b <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ ab8:	89 d0                	mov    %edx,%eax
+ aba:	8b 12                	mov    (%edx),%edx
+ abc:	e9 6a ff ff ff       	jmp    a2b <malloc+0x4b>
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+
+00000ad0 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	56                   	push   %esi
+ ad4:	53                   	push   %ebx
+ ad5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ ad8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ adb:	85 c9                	test   %ecx,%ecx
+ add:	74 06                	je     ae5 <calloc+0x15>
+ adf:	89 c8                	mov    %ecx,%eax
+ ae1:	f7 e3                	mul    %ebx
+ ae3:	70 33                	jo     b18 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ ae5:	0f af d9             	imul   %ecx,%ebx
+ ae8:	83 ec 0c             	sub    $0xc,%esp
+ aeb:	53                   	push   %ebx
+ aec:	e8 ef fe ff ff       	call   9e0 <malloc>
+ af1:	83 c4 10             	add    $0x10,%esp
+ af4:	89 c6                	mov    %eax,%esi
+ af6:	85 c0                	test   %eax,%eax
+ af8:	74 1e                	je     b18 <calloc+0x48>
+    memset(p, 0, n * size);
+ afa:	83 ec 04             	sub    $0x4,%esp
+ afd:	53                   	push   %ebx
+ afe:	6a 00                	push   $0x0
+ b00:	50                   	push   %eax
+ b01:	e8 3a f7 ff ff       	call   240 <memset>
+ b06:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ b09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b0c:	89 f0                	mov    %esi,%eax
+ b0e:	5b                   	pop    %ebx
+ b0f:	5e                   	pop    %esi
+ b10:	5d                   	pop    %ebp
+ b11:	c3                   	ret
+ b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ b18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ b1b:	31 f6                	xor    %esi,%esi
+}
+ b1d:	89 f0                	mov    %esi,%eax
+ b1f:	5b                   	pop    %ebx
+ b20:	5e                   	pop    %esi
+ b21:	5d                   	pop    %ebp
+ b22:	c3                   	ret
+ b23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b30 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	57                   	push   %edi
+ b34:	56                   	push   %esi
+ b35:	53                   	push   %ebx
+ b36:	83 ec 0c             	sub    $0xc,%esp
+ b39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ b3f:	85 db                	test   %ebx,%ebx
+ b41:	74 55                	je     b98 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ b43:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ b46:	89 de                	mov    %ebx,%esi
+ b48:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ b4f:	39 c7                	cmp    %eax,%edi
+ b51:	72 0d                	jb     b60 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ b53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b56:	89 f0                	mov    %esi,%eax
+ b58:	5b                   	pop    %ebx
+ b59:	5e                   	pop    %esi
+ b5a:	5f                   	pop    %edi
+ b5b:	5d                   	pop    %ebp
+ b5c:	c3                   	ret
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ b60:	83 ec 0c             	sub    $0xc,%esp
+ b63:	50                   	push   %eax
+ b64:	e8 77 fe ff ff       	call   9e0 <malloc>
+ b69:	83 c4 10             	add    $0x10,%esp
+ b6c:	89 c6                	mov    %eax,%esi
+ b6e:	85 c0                	test   %eax,%eax
+ b70:	74 e1                	je     b53 <realloc+0x23>
+  memmove(p, ap, have);
+ b72:	83 ec 04             	sub    $0x4,%esp
+ b75:	57                   	push   %edi
+ b76:	53                   	push   %ebx
+ b77:	50                   	push   %eax
+ b78:	e8 b3 f8 ff ff       	call   430 <memmove>
+  free(ap);
+ b7d:	89 1c 24             	mov    %ebx,(%esp)
+ b80:	e8 eb fd ff ff       	call   970 <free>
+  return p;
+ b85:	83 c4 10             	add    $0x10,%esp
+}
+ b88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b8b:	89 f0                	mov    %esi,%eax
+ b8d:	5b                   	pop    %ebx
+ b8e:	5e                   	pop    %esi
+ b8f:	5f                   	pop    %edi
+ b90:	5d                   	pop    %ebp
+ b91:	c3                   	ret
+ b92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ b98:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ b9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b9e:	5b                   	pop    %ebx
+ b9f:	5e                   	pop    %esi
+ ba0:	5f                   	pop    %edi
+ ba1:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ ba2:	e9 39 fe ff ff       	jmp    9e0 <malloc>
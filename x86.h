@@ -13,6 +13,24 @@ inb(ushort port)
   return data;
 }
 
+static inline ushort
+inw(ushort port)
+{
+  ushort data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+  return data;
+}
+
+static inline uint
+inl(ushort port)
+{
+  uint data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+  return data;
+}
+
 static inline void
 insl(int port, void *addr, int cnt)
 {
@@ -34,6 +52,12 @@ outw(ushort port, ushort data)
   asm volatile("out %0,%1" : : "a" (data), "d" (port));
 }
 
+static inline void
+outl(ushort port, uint data)
+{
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+}
+
 static inline void
 outsl(int port, const void *addr, int cnt)
 {
@@ -95,6 +119,16 @@ ltr(ushort sel)
   asm volatile("ltr %0" : : "r" (sel));
 }
 
+// Read the time-stamp counter: CPU cycles since reset.
+static inline unsigned long long
+rdtsc(void)
+{
+  unsigned long long t;
+
+  asm volatile("rdtsc" : "=A" (t));
+  return t;
+}
+
 static inline uint
 readeflags(void)
 {
@@ -148,6 +182,12 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
@@ -0,0 +1,1639 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 f5 02 00 00       	call   30b <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 7f 03 00 00       	call   3a3 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 e7 02 00 00       	call   313 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 be 01 00 00       	call   32b <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 91 01 00 00       	call   353 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 94 01 00 00       	call   36b <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 5a 01 00 00       	call   33b <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+ 205:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 208:	0f b6 02             	movzbl (%edx),%eax
+ 20b:	3c 20                	cmp    $0x20,%al
+ 20d:	75 0c                	jne    21b <atoi+0x1b>
+ 20f:	90                   	nop
+ 210:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 214:	83 c2 01             	add    $0x1,%edx
+ 217:	3c 20                	cmp    $0x20,%al
+ 219:	74 f5                	je     210 <atoi+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 21b:	3c 2d                	cmp    $0x2d,%al
+ 21d:	74 41                	je     260 <atoi+0x60>
+ 21f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 224:	3c 2b                	cmp    $0x2b,%al
+ 226:	74 3d                	je     265 <atoi+0x65>
+    s++;
+  while('0' <= *s && *s <= '9')
+ 228:	0f be 0a             	movsbl (%edx),%ecx
+ 22b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 22e:	3c 09                	cmp    $0x9,%al
+ 230:	b8 00 00 00 00       	mov    $0x0,%eax
+ 235:	77 21                	ja     258 <atoi+0x58>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 240:	83 c2 01             	add    $0x1,%edx
+ 243:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 246:	8d 44 41 d0          	lea    -0x30(%ecx,%eax,2),%eax
+  while('0' <= *s && *s <= '9')
+ 24a:	0f be 0a             	movsbl (%edx),%ecx
+ 24d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 250:	80 fb 09             	cmp    $0x9,%bl
+ 253:	76 eb                	jbe    240 <atoi+0x40>
+  return sign*n;
+ 255:	0f af c6             	imul   %esi,%eax
+}
+ 258:	5b                   	pop    %ebx
+ 259:	5e                   	pop    %esi
+ 25a:	5d                   	pop    %ebp
+ 25b:	c3                   	ret
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 265:	83 c2 01             	add    $0x1,%edx
+ 268:	eb be                	jmp    228 <atoi+0x28>
+ 26a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000270 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+ 275:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 278:	0f b6 02             	movzbl (%edx),%eax
+ 27b:	3c 20                	cmp    $0x20,%al
+ 27d:	75 0c                	jne    28b <atoo+0x1b>
+ 27f:	90                   	nop
+ 280:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+ 284:	83 c2 01             	add    $0x1,%edx
+ 287:	3c 20                	cmp    $0x20,%al
+ 289:	74 f5                	je     280 <atoo+0x10>
+  sign = (*s == '-') ? -1 : 1;
+ 28b:	3c 2d                	cmp    $0x2d,%al
+ 28d:	74 41                	je     2d0 <atoo+0x60>
+ 28f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 294:	3c 2b                	cmp    $0x2b,%al
+ 296:	74 3d                	je     2d5 <atoo+0x65>
+    s++;
+  while('0' <= *s && *s <= '7')
+ 298:	0f be 0a             	movsbl (%edx),%ecx
+ 29b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 29e:	3c 07                	cmp    $0x7,%al
+ 2a0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2a5:	77 1e                	ja     2c5 <atoo+0x55>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+    n = n*8 + *s++ - '0';
+ 2b0:	83 c2 01             	add    $0x1,%edx
+ 2b3:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 2b7:	0f be 0a             	movsbl (%edx),%ecx
+ 2ba:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2bd:	80 fb 07             	cmp    $0x7,%bl
+ 2c0:	76 ee                	jbe    2b0 <atoo+0x40>
+  return sign*n;
+ 2c2:	0f af c6             	imul   %esi,%eax
+}
+ 2c5:	5b                   	pop    %ebx
+ 2c6:	5e                   	pop    %esi
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sign = (*s == '-') ? -1 : 1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    s++;
+ 2d5:	83 c2 01             	add    $0x1,%edx
+ 2d8:	eb be                	jmp    298 <atoo+0x28>
+ 2da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002e0 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ee:	85 c0                	test   %eax,%eax
+ 2f0:	7e 13                	jle    305 <memmove+0x25>
+ 2f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2f4:	89 d7                	mov    %edx,%edi
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 300:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 301:	39 f8                	cmp    %edi,%eax
+ 303:	75 fb                	jne    300 <memmove+0x20>
+  return vdst;
+}
+ 305:	5e                   	pop    %esi
+ 306:	89 d0                	mov    %edx,%eax
+ 308:	5f                   	pop    %edi
+ 309:	5d                   	pop    %ebp
+ 30a:	c3                   	ret
+
+0000030b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 30b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <exit>:
+SYSCALL(exit)
+ 313:	b8 02 00 00 00       	mov    $0x2,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <wait>:
+SYSCALL(wait)
+ 31b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <pipe>:
+SYSCALL(pipe)
+ 323:	b8 04 00 00 00       	mov    $0x4,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <read>:
+SYSCALL(read)
+ 32b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <write>:
+SYSCALL(write)
+ 333:	b8 10 00 00 00       	mov    $0x10,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <close>:
+SYSCALL(close)
+ 33b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <kill>:
+SYSCALL(kill)
+ 343:	b8 06 00 00 00       	mov    $0x6,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <exec>:
+SYSCALL(exec)
+ 34b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <open>:
+SYSCALL(open)
+ 353:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <mknod>:
+SYSCALL(mknod)
+ 35b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <unlink>:
+SYSCALL(unlink)
+ 363:	b8 12 00 00 00       	mov    $0x12,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <fstat>:
+SYSCALL(fstat)
+ 36b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <link>:
+SYSCALL(link)
+ 373:	b8 13 00 00 00       	mov    $0x13,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <mkdir>:
+SYSCALL(mkdir)
+ 37b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <chdir>:
+SYSCALL(chdir)
+ 383:	b8 09 00 00 00       	mov    $0x9,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <dup>:
+SYSCALL(dup)
+ 38b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <getpid>:
+SYSCALL(getpid)
+ 393:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <sbrk>:
+SYSCALL(sbrk)
+ 39b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <sleep>:
+SYSCALL(sleep)
+ 3a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <uptime>:
+SYSCALL(uptime)
+ 3ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <superpages>:
+SYSCALL(superpages)
+ 3b3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <mmap>:
+SYSCALL(mmap)
+ 3bb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <munmap>:
+SYSCALL(munmap)
+ 3c3:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <spawn>:
+SYSCALL(spawn)
+ 3cb:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <swapstat>:
+SYSCALL(swapstat)
+ 3d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <getmeminfo>:
+SYSCALL(getmeminfo)
+ 3db:	b8 28 00 00 00       	mov    $0x28,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <iostat>:
+SYSCALL(iostat)
+ 3e3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <dropcache>:
+SYSCALL(dropcache)
+ 3eb:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <iosched>:
+SYSCALL(iosched)
+ 3f3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <halt>:
+SYSCALL(halt)
+ 3fb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <date>:
+SYSCALL(date)
+ 403:	b8 17 00 00 00       	mov    $0x17,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <getuid>:
+
+//PROJECT 2
+SYSCALL(getuid)
+ 40b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getgid>:
+SYSCALL(getgid)
+ 413:	b8 19 00 00 00       	mov    $0x19,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <getppid>:
+SYSCALL(getppid)
+ 41b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <setuid>:
+SYSCALL(setuid)
+ 423:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <setgid>:
+SYSCALL(setgid)
+ 42b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <getprocs>:
+SYSCALL(getprocs)
+ 433:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <setpriority>:
+
+//Project 4
+SYSCALL(setpriority)
+ 43b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getpriority>:
+SYSCALL(getpriority)
+ 443:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <chmod>:
+
+//Project 5
+SYSCALL(chmod)
+ 44b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <chown>:
+SYSCALL(chown)
+ 453:	b8 21 00 00 00       	mov    $0x21,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <chgrp>:
+SYSCALL(chgrp)
+ 45b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+ 463:	66 90                	xchg   %ax,%ax
+ 465:	66 90                	xchg   %ax,%ax
+ 467:	66 90                	xchg   %ax,%ax
+ 469:	66 90                	xchg   %ax,%ax
+ 46b:	66 90                	xchg   %ax,%ax
+ 46d:	66 90                	xchg   %ax,%ax
+ 46f:	90                   	nop
+
+00000470 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 478:	89 d1                	mov    %edx,%ecx
+{
+ 47a:	83 ec 3c             	sub    $0x3c,%esp
+ 47d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 480:	85 d2                	test   %edx,%edx
+ 482:	0f 89 80 00 00 00    	jns    508 <printint+0x98>
+ 488:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 48c:	74 7a                	je     508 <printint+0x98>
+    x = -xx;
+ 48e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 490:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 495:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 498:	31 f6                	xor    %esi,%esi
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4a0:	89 c8                	mov    %ecx,%eax
+ 4a2:	31 d2                	xor    %edx,%edx
+ 4a4:	89 f7                	mov    %esi,%edi
+ 4a6:	f7 f3                	div    %ebx
+ 4a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4ab:	0f b6 92 b8 0a 00 00 	movzbl 0xab8(%edx),%edx
+ 4b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4b6:	89 ca                	mov    %ecx,%edx
+ 4b8:	89 c1                	mov    %eax,%ecx
+ 4ba:	39 da                	cmp    %ebx,%edx
+ 4bc:	73 e2                	jae    4a0 <printint+0x30>
+  if(neg)
+ 4be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4c1:	85 c0                	test   %eax,%eax
+ 4c3:	74 07                	je     4cc <printint+0x5c>
+    buf[i++] = '-';
+ 4c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ca:	89 f7                	mov    %esi,%edi
+ 4cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4d2:	01 df                	add    %ebx,%edi
+ 4d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4db:	83 ec 04             	sub    $0x4,%esp
+ 4de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4e4:	6a 01                	push   $0x1
+ 4e6:	50                   	push   %eax
+ 4e7:	56                   	push   %esi
+ 4e8:	e8 46 fe ff ff       	call   333 <write>
+  while(--i >= 0)
+ 4ed:	89 f8                	mov    %edi,%eax
+ 4ef:	83 c4 10             	add    $0x10,%esp
+ 4f2:	83 ef 01             	sub    $0x1,%edi
+ 4f5:	39 d8                	cmp    %ebx,%eax
+ 4f7:	75 df                	jne    4d8 <printint+0x68>
+}
+ 4f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4fc:	5b                   	pop    %ebx
+ 4fd:	5e                   	pop    %esi
+ 4fe:	5f                   	pop    %edi
+ 4ff:	5d                   	pop    %ebp
+ 500:	c3                   	ret
+ 501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 508:	31 c0                	xor    %eax,%eax
+ 50a:	eb 89                	jmp    495 <printint+0x25>
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 519:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 51c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 51f:	0f b6 1e             	movzbl (%esi),%ebx
+ 522:	83 c6 01             	add    $0x1,%esi
+ 525:	84 db                	test   %bl,%bl
+ 527:	74 67                	je     590 <printf+0x80>
+ 529:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 52c:	31 d2                	xor    %edx,%edx
+ 52e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 531:	eb 34                	jmp    567 <printf+0x57>
+ 533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 537:	90                   	nop
+ 538:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 53b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 540:	83 f8 25             	cmp    $0x25,%eax
+ 543:	74 18                	je     55d <printf+0x4d>
+  write(fd, &c, 1);
+ 545:	83 ec 04             	sub    $0x4,%esp
+ 548:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 54b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 54e:	6a 01                	push   $0x1
+ 550:	50                   	push   %eax
+ 551:	57                   	push   %edi
+ 552:	e8 dc fd ff ff       	call   333 <write>
+ 557:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 55a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 55d:	0f b6 1e             	movzbl (%esi),%ebx
+ 560:	83 c6 01             	add    $0x1,%esi
+ 563:	84 db                	test   %bl,%bl
+ 565:	74 29                	je     590 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 567:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 56a:	85 d2                	test   %edx,%edx
+ 56c:	74 ca                	je     538 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 56e:	83 fa 25             	cmp    $0x25,%edx
+ 571:	75 ea                	jne    55d <printf+0x4d>
+      if(c == 'd'){
+ 573:	83 f8 25             	cmp    $0x25,%eax
+ 576:	0f 84 24 01 00 00    	je     6a0 <printf+0x190>
+ 57c:	83 e8 63             	sub    $0x63,%eax
+ 57f:	83 f8 15             	cmp    $0x15,%eax
+ 582:	77 1c                	ja     5a0 <printf+0x90>
+ 584:	ff 24 85 60 0a 00 00 	jmp    *0xa60(,%eax,4)
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 593:	5b                   	pop    %ebx
+ 594:	5e                   	pop    %esi
+ 595:	5f                   	pop    %edi
+ 596:	5d                   	pop    %ebp
+ 597:	c3                   	ret
+ 598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+  write(fd, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5aa:	6a 01                	push   $0x1
+ 5ac:	52                   	push   %edx
+ 5ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5b0:	57                   	push   %edi
+ 5b1:	e8 7d fd ff ff       	call   333 <write>
+ 5b6:	83 c4 0c             	add    $0xc,%esp
+ 5b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5bc:	6a 01                	push   $0x1
+ 5be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5c1:	52                   	push   %edx
+ 5c2:	57                   	push   %edi
+ 5c3:	e8 6b fd ff ff       	call   333 <write>
+        putc(fd, c);
+ 5c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5cb:	31 d2                	xor    %edx,%edx
+ 5cd:	eb 8e                	jmp    55d <printf+0x4d>
+ 5cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5d3:	83 ec 0c             	sub    $0xc,%esp
+ 5d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5db:	8b 13                	mov    (%ebx),%edx
+ 5dd:	6a 00                	push   $0x0
+ 5df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5e4:	e8 87 fe ff ff       	call   470 <printint>
+        ap++;
+ 5e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ef:	31 d2                	xor    %edx,%edx
+ 5f1:	e9 67 ff ff ff       	jmp    55d <printf+0x4d>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 600:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 603:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 605:	83 c0 04             	add    $0x4,%eax
+ 608:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 60b:	85 db                	test   %ebx,%ebx
+ 60d:	0f 84 9d 00 00 00    	je     6b0 <printf+0x1a0>
+        while(*s != 0){
+ 613:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 616:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 618:	84 c0                	test   %al,%al
+ 61a:	0f 84 3d ff ff ff    	je     55d <printf+0x4d>
+ 620:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 623:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 626:	89 de                	mov    %ebx,%esi
+ 628:	89 d3                	mov    %edx,%ebx
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 636:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 639:	6a 01                	push   $0x1
+ 63b:	53                   	push   %ebx
+ 63c:	57                   	push   %edi
+ 63d:	e8 f1 fc ff ff       	call   333 <write>
+        while(*s != 0){
+ 642:	0f b6 06             	movzbl (%esi),%eax
+ 645:	83 c4 10             	add    $0x10,%esp
+ 648:	84 c0                	test   %al,%al
+ 64a:	75 e4                	jne    630 <printf+0x120>
+      state = 0;
+ 64c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 64f:	31 d2                	xor    %edx,%edx
+ 651:	e9 07 ff ff ff       	jmp    55d <printf+0x4d>
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 660:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 663:	83 ec 0c             	sub    $0xc,%esp
+ 666:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 66b:	8b 13                	mov    (%ebx),%edx
+ 66d:	6a 01                	push   $0x1
+ 66f:	e9 6b ff ff ff       	jmp    5df <printf+0xcf>
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 678:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 681:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 683:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 686:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 689:	6a 01                	push   $0x1
+ 68b:	52                   	push   %edx
+ 68c:	57                   	push   %edi
+ 68d:	e8 a1 fc ff ff       	call   333 <write>
+        ap++;
+ 692:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 695:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 698:	31 d2                	xor    %edx,%edx
+ 69a:	e9 be fe ff ff       	jmp    55d <printf+0x4d>
+ 69f:	90                   	nop
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	e9 11 ff ff ff       	jmp    5c1 <printf+0xb1>
+ 6b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6b5:	bb 58 0a 00 00       	mov    $0xa58,%ebx
+ 6ba:	e9 61 ff ff ff       	jmp    620 <printf+0x110>
+ 6bf:	90                   	nop
+
+000006c0 <lfree>:
+static Header *freep;
+static Header *classes[NCLASS];
+
+static void
+lfree(Header *bp)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 c1                	mov    %eax,%ecx
+  Header *p;
+
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6c3:	a1 a4 0e 00 00       	mov    0xea4,%eax
+{
+ 6c8:	89 e5                	mov    %esp,%ebp
+ 6ca:	56                   	push   %esi
+ 6cb:	53                   	push   %ebx
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6d2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d4:	39 ca                	cmp    %ecx,%edx
+ 6d6:	73 30                	jae    708 <lfree+0x48>
+ 6d8:	39 c1                	cmp    %eax,%ecx
+ 6da:	72 04                	jb     6e0 <lfree+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6dc:	39 c2                	cmp    %eax,%edx
+ 6de:	72 f0                	jb     6d0 <lfree+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e0:	8b 59 04             	mov    0x4(%ecx),%ebx
+ 6e3:	8d 34 d9             	lea    (%ecx,%ebx,8),%esi
+ 6e6:	39 f0                	cmp    %esi,%eax
+ 6e8:	74 26                	je     710 <lfree+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6ea:	89 01                	mov    %eax,(%ecx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6ec:	8b 42 04             	mov    0x4(%edx),%eax
+ 6ef:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 6f2:	39 d9                	cmp    %ebx,%ecx
+ 6f4:	74 30                	je     726 <lfree+0x66>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6f6:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6f8:	5b                   	pop    %ebx
+  freep = p;
+ 6f9:	89 15 a4 0e 00 00    	mov    %edx,0xea4
+}
+ 6ff:	5e                   	pop    %esi
+ 700:	5d                   	pop    %ebp
+ 701:	c3                   	ret
+ 702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 708:	39 c1                	cmp    %eax,%ecx
+ 70a:	72 d0                	jb     6dc <lfree+0x1c>
+ 70c:	eb c2                	jmp    6d0 <lfree+0x10>
+ 70e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ 710:	03 58 04             	add    0x4(%eax),%ebx
+ 713:	89 59 04             	mov    %ebx,0x4(%ecx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 716:	8b 02                	mov    (%edx),%eax
+ 718:	8b 00                	mov    (%eax),%eax
+ 71a:	89 01                	mov    %eax,(%ecx)
+  if(p + p->s.size == bp){
+ 71c:	8b 42 04             	mov    0x4(%edx),%eax
+ 71f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+ 722:	39 d9                	cmp    %ebx,%ecx
+ 724:	75 d0                	jne    6f6 <lfree+0x36>
+    p->s.size += bp->s.size;
+ 726:	03 41 04             	add    0x4(%ecx),%eax
+  freep = p;
+ 729:	89 15 a4 0e 00 00    	mov    %edx,0xea4
+    p->s.size += bp->s.size;
+ 72f:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 732:	8b 09                	mov    (%ecx),%ecx
+ 734:	89 0a                	mov    %ecx,(%edx)
+}
+ 736:	5b                   	pop    %ebx
+ 737:	5e                   	pop    %esi
+ 738:	5d                   	pop    %ebp
+ 739:	c3                   	ret
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000740 <lalloc>:
+}
+
+// Allocate a block of nunits from the K&R free list.
+static Header*
+lalloc(uint nunits)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	89 c7                	mov    %eax,%edi
+ 746:	56                   	push   %esi
+ 747:	53                   	push   %ebx
+ 748:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+
+  if((prevp = freep) == 0){
+ 74b:	a1 a4 0e 00 00       	mov    0xea4,%eax
+ 750:	85 c0                	test   %eax,%eax
+ 752:	0f 84 88 00 00 00    	je     7e0 <lalloc+0xa0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 758:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 75a:	8b 4a 04             	mov    0x4(%edx),%ecx
+  if(nu < 4096)
+ 75d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 762:	39 df                	cmp    %ebx,%edi
+ 764:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 767:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    if(p->s.size >= nunits){
+ 76e:	39 f9                	cmp    %edi,%ecx
+ 770:	72 0f                	jb     781 <lalloc+0x41>
+ 772:	eb 4c                	jmp    7c0 <lalloc+0x80>
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 778:	8b 10                	mov    (%eax),%edx
+    if(p->s.size >= nunits){
+ 77a:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 77d:	39 f9                	cmp    %edi,%ecx
+ 77f:	73 3f                	jae    7c0 <lalloc+0x80>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return p;
+    }
+    if(p == freep)
+ 781:	89 d0                	mov    %edx,%eax
+ 783:	39 15 a4 0e 00 00    	cmp    %edx,0xea4
+ 789:	75 ed                	jne    778 <lalloc+0x38>
+  p = sbrk(nu * sizeof(Header));
+ 78b:	83 ec 0c             	sub    $0xc,%esp
+ 78e:	56                   	push   %esi
+ 78f:	e8 07 fc ff ff       	call   39b <sbrk>
+  if(p == (char*)-1)
+ 794:	83 c4 10             	add    $0x10,%esp
+ 797:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 79a:	74 11                	je     7ad <lalloc+0x6d>
+  hp->s.size = nu;
+ 79c:	89 58 04             	mov    %ebx,0x4(%eax)
+  lfree(hp);
+ 79f:	e8 1c ff ff ff       	call   6c0 <lfree>
+  return freep;
+ 7a4:	a1 a4 0e 00 00       	mov    0xea4,%eax
+      if((p = morecore(nunits)) == 0)
+ 7a9:	85 c0                	test   %eax,%eax
+ 7ab:	75 cb                	jne    778 <lalloc+0x38>
+        return 0;
+  }
+}
+ 7ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7b0:	31 d2                	xor    %edx,%edx
+}
+ 7b2:	5b                   	pop    %ebx
+ 7b3:	89 d0                	mov    %edx,%eax
+ 7b5:	5e                   	pop    %esi
+ 7b6:	5f                   	pop    %edi
+ 7b7:	5d                   	pop    %ebp
+ 7b8:	c3                   	ret
+ 7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p->s.size == nunits)
+ 7c0:	39 cf                	cmp    %ecx,%edi
+ 7c2:	74 4c                	je     810 <lalloc+0xd0>
+        p->s.size -= nunits;
+ 7c4:	29 f9                	sub    %edi,%ecx
+ 7c6:	89 4a 04             	mov    %ecx,0x4(%edx)
+        p += p->s.size;
+ 7c9:	8d 14 ca             	lea    (%edx,%ecx,8),%edx
+        p->s.size = nunits;
+ 7cc:	89 7a 04             	mov    %edi,0x4(%edx)
+      freep = prevp;
+ 7cf:	a3 a4 0e 00 00       	mov    %eax,0xea4
+}
+ 7d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d7:	89 d0                	mov    %edx,%eax
+ 7d9:	5b                   	pop    %ebx
+ 7da:	5e                   	pop    %esi
+ 7db:	5f                   	pop    %edi
+ 7dc:	5d                   	pop    %ebp
+ 7dd:	c3                   	ret
+ 7de:	66 90                	xchg   %ax,%ax
+    base.s.size = 0;
+ 7e0:	ba a8 0e 00 00       	mov    $0xea8,%edx
+ 7e5:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 7e7:	c7 05 a4 0e 00 00 a8 	movl   $0xea8,0xea4
+ 7ee:	0e 00 00 
+ 7f1:	c7 05 a8 0e 00 00 a8 	movl   $0xea8,0xea8
+ 7f8:	0e 00 00 
+ 7fb:	89 d0                	mov    %edx,%eax
+    base.s.size = 0;
+ 7fd:	c7 05 ac 0e 00 00 00 	movl   $0x0,0xeac
+ 804:	00 00 00 
+ 807:	e9 51 ff ff ff       	jmp    75d <lalloc+0x1d>
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        prevp->s.ptr = p->s.ptr;
+ 810:	8b 0a                	mov    (%edx),%ecx
+ 812:	89 08                	mov    %ecx,(%eax)
+ 814:	eb b9                	jmp    7cf <lalloc+0x8f>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000820 <free>:
+  return 0;
+}
+
+void
+free(void *ap)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	8b 75 08             	mov    0x8(%ebp),%esi
+  Header *bp;
+  int c;
+
+  if(ap == 0)
+ 829:	85 f6                	test   %esi,%esi
+ 82b:	74 42                	je     86f <free+0x4f>
+    return;
+  bp = (Header*)ap - 1;
+  if(bp->s.size > SMALLU){
+ 82d:	8b 56 fc             	mov    -0x4(%esi),%edx
+  bp = (Header*)ap - 1;
+ 830:	8d 7e f8             	lea    -0x8(%esi),%edi
+  if(bp->s.size > SMALLU){
+ 833:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+ 839:	77 3d                	ja     878 <free+0x58>
+    lfree(bp);
+    return;
+  }
+  for(c = 0; CLASSU(c) != bp->s.size; c++)
+ 83b:	31 c9                	xor    %ecx,%ecx
+ 83d:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 842:	83 fa 02             	cmp    $0x2,%edx
+ 845:	74 17                	je     85e <free+0x3e>
+ 847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84e:	66 90                	xchg   %ax,%ax
+ 850:	83 c1 01             	add    $0x1,%ecx
+ 853:	89 d8                	mov    %ebx,%eax
+ 855:	d3 e0                	shl    %cl,%eax
+ 857:	83 c0 01             	add    $0x1,%eax
+ 85a:	39 c2                	cmp    %eax,%edx
+ 85c:	75 f2                	jne    850 <free+0x30>
+    ;
+  bp->s.ptr = classes[c];
+ 85e:	8b 04 8d 80 0e 00 00 	mov    0xe80(,%ecx,4),%eax
+  classes[c] = bp;
+ 865:	89 3c 8d 80 0e 00 00 	mov    %edi,0xe80(,%ecx,4)
+  bp->s.ptr = classes[c];
+ 86c:	89 46 f8             	mov    %eax,-0x8(%esi)
+}
+ 86f:	5b                   	pop    %ebx
+ 870:	5e                   	pop    %esi
+ 871:	5f                   	pop    %edi
+ 872:	5d                   	pop    %ebp
+ 873:	c3                   	ret
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 878:	5b                   	pop    %ebx
+    lfree(bp);
+ 879:	89 f8                	mov    %edi,%eax
+}
+ 87b:	5e                   	pop    %esi
+ 87c:	5f                   	pop    %edi
+ 87d:	5d                   	pop    %ebp
+    lfree(bp);
+ 87e:	e9 3d fe ff ff       	jmp    6c0 <lfree>
+ 883:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000890 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	83 ec 1c             	sub    $0x1c,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 899:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89c:	83 c0 07             	add    $0x7,%eax
+ 89f:	c1 e8 03             	shr    $0x3,%eax
+ 8a2:	83 c0 01             	add    $0x1,%eax
+  if(nunits > SMALLU){
+ 8a5:	3d 01 01 00 00       	cmp    $0x101,%eax
+ 8aa:	77 44                	ja     8f0 <malloc+0x60>
+    if((p = lalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+  for(c = 0; CLASSU(c) < nunits; c++)
+ 8ac:	31 c9                	xor    %ecx,%ecx
+ 8ae:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8b3:	bb 02 00 00 00       	mov    $0x2,%ebx
+ 8b8:	83 f8 02             	cmp    $0x2,%eax
+ 8bb:	76 11                	jbe    8ce <malloc+0x3e>
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 8c0:	83 c1 01             	add    $0x1,%ecx
+ 8c3:	89 d3                	mov    %edx,%ebx
+ 8c5:	d3 e3                	shl    %cl,%ebx
+ 8c7:	83 c3 01             	add    $0x1,%ebx
+ 8ca:	39 c3                	cmp    %eax,%ebx
+ 8cc:	72 f2                	jb     8c0 <malloc+0x30>
+    ;
+  if(classes[c] == 0 && refill(c) < 0)
+ 8ce:	8b 04 8d 80 0e 00 00 	mov    0xe80(,%ecx,4),%eax
+ 8d5:	85 c0                	test   %eax,%eax
+ 8d7:	74 2f                	je     908 <malloc+0x78>
+    return 0;
+  p = classes[c];
+  classes[c] = p->s.ptr;
+ 8d9:	8b 10                	mov    (%eax),%edx
+ 8db:	89 14 8d 80 0e 00 00 	mov    %edx,0xe80(,%ecx,4)
+  return (void*)(p + 1);
+ 8e2:	83 c0 08             	add    $0x8,%eax
+}
+ 8e5:	83 c4 1c             	add    $0x1c,%esp
+ 8e8:	5b                   	pop    %ebx
+ 8e9:	5e                   	pop    %esi
+ 8ea:	5f                   	pop    %edi
+ 8eb:	5d                   	pop    %ebp
+ 8ec:	c3                   	ret
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if((p = lalloc(nunits)) == 0)
+ 8f0:	e8 4b fe ff ff       	call   740 <lalloc>
+ 8f5:	89 c2                	mov    %eax,%edx
+    return (void*)(p + 1);
+ 8f7:	8d 40 08             	lea    0x8(%eax),%eax
+    if((p = lalloc(nunits)) == 0)
+ 8fa:	85 d2                	test   %edx,%edx
+ 8fc:	75 e7                	jne    8e5 <malloc+0x55>
+      return 0;
+ 8fe:	31 c0                	xor    %eax,%eax
+ 900:	eb e3                	jmp    8e5 <malloc+0x55>
+ 902:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = CHUNK / sizeof(Header) / u;
+ 908:	31 d2                	xor    %edx,%edx
+ 90a:	b8 00 02 00 00       	mov    $0x200,%eax
+ 90f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 912:	f7 f3                	div    %ebx
+  if(n < 4)
+ 914:	ba 04 00 00 00       	mov    $0x4,%edx
+ 919:	89 d6                	mov    %edx,%esi
+ 91b:	39 d0                	cmp    %edx,%eax
+ 91d:	0f 43 f0             	cmovae %eax,%esi
+  if((p = lalloc(n * u)) == 0)
+ 920:	0f af f3             	imul   %ebx,%esi
+ 923:	89 f0                	mov    %esi,%eax
+ 925:	e8 16 fe ff ff       	call   740 <lalloc>
+ 92a:	85 c0                	test   %eax,%eax
+ 92c:	74 d0                	je     8fe <malloc+0x6e>
+  for(q = p; q < p + n*u; q += u){
+ 92e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 931:	8d 3c f0             	lea    (%eax,%esi,8),%edi
+ 934:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 93b:	8b 14 8d 80 0e 00 00 	mov    0xe80(,%ecx,4),%edx
+ 942:	39 f8                	cmp    %edi,%eax
+ 944:	73 22                	jae    968 <malloc+0xd8>
+ 946:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 949:	eb 09                	jmp    954 <malloc+0xc4>
+ 94b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+ 950:	89 c2                	mov    %eax,%edx
+ 952:	89 c8                	mov    %ecx,%eax
+ 954:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+    q->s.size = u;
+ 957:	89 58 04             	mov    %ebx,0x4(%eax)
+    q->s.ptr = classes[c];
+ 95a:	89 10                	mov    %edx,(%eax)
+  for(q = p; q < p + n*u; q += u){
+ 95c:	39 f9                	cmp    %edi,%ecx
+ 95e:	72 f0                	jb     950 <malloc+0xc0>
+ 960:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 963:	e9 73 ff ff ff       	jmp    8db <malloc+0x4b>
+  classes[c] = p->s.ptr;
+ 968:	89 d0                	mov    %edx,%eax
+ 96a:	8b 12                	mov    (%edx),%edx
+ 96c:	e9 6a ff ff ff       	jmp    8db <malloc+0x4b>
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+
+00000980 <calloc>:
+
+void*
+calloc(uint n, uint size)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	56                   	push   %esi
+ 984:	53                   	push   %ebx
+ 985:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 988:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  void *p;
+
+  if(size && n > 0xFFFFFFFF / size)
+ 98b:	85 c9                	test   %ecx,%ecx
+ 98d:	74 06                	je     995 <calloc+0x15>
+ 98f:	89 c8                	mov    %ecx,%eax
+ 991:	f7 e3                	mul    %ebx
+ 993:	70 33                	jo     9c8 <calloc+0x48>
+    return 0;
+  if((p = malloc(n * size)) != 0)
+ 995:	0f af d9             	imul   %ecx,%ebx
+ 998:	83 ec 0c             	sub    $0xc,%esp
+ 99b:	53                   	push   %ebx
+ 99c:	e8 ef fe ff ff       	call   890 <malloc>
+ 9a1:	83 c4 10             	add    $0x10,%esp
+ 9a4:	89 c6                	mov    %eax,%esi
+ 9a6:	85 c0                	test   %eax,%eax
+ 9a8:	74 1e                	je     9c8 <calloc+0x48>
+    memset(p, 0, n * size);
+ 9aa:	83 ec 04             	sub    $0x4,%esp
+ 9ad:	53                   	push   %ebx
+ 9ae:	6a 00                	push   $0x0
+ 9b0:	50                   	push   %eax
+ 9b1:	e8 3a f7 ff ff       	call   f0 <memset>
+ 9b6:	83 c4 10             	add    $0x10,%esp
+  return p;
+}
+ 9b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9bc:	89 f0                	mov    %esi,%eax
+ 9be:	5b                   	pop    %ebx
+ 9bf:	5e                   	pop    %esi
+ 9c0:	5d                   	pop    %ebp
+ 9c1:	c3                   	ret
+ 9c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 9c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 9cb:	31 f6                	xor    %esi,%esi
+}
+ 9cd:	89 f0                	mov    %esi,%eax
+ 9cf:	5b                   	pop    %ebx
+ 9d0:	5e                   	pop    %esi
+ 9d1:	5d                   	pop    %ebp
+ 9d2:	c3                   	ret
+ 9d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009e0 <realloc>:
+
+void*
+realloc(void *ap, uint nbytes)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	83 ec 0c             	sub    $0xc,%esp
+ 9e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 9ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  Header *bp;
+  uint have;
+  void *p;
+
+  if(ap == 0)
+ 9ef:	85 db                	test   %ebx,%ebx
+ 9f1:	74 55                	je     a48 <realloc+0x68>
+    return malloc(nbytes);
+  bp = (Header*)ap - 1;
+  have = (bp->s.size - 1) * sizeof(Header);
+ 9f3:	8b 53 fc             	mov    -0x4(%ebx),%edx
+ 9f6:	89 de                	mov    %ebx,%esi
+ 9f8:	8d 3c d5 f8 ff ff ff 	lea    -0x8(,%edx,8),%edi
+  if(nbytes <= have)
+ 9ff:	39 c7                	cmp    %eax,%edi
+ a01:	72 0d                	jb     a10 <realloc+0x30>
+  if((p = malloc(nbytes)) == 0)
+    return 0;
+  memmove(p, ap, have);
+  free(ap);
+  return p;
+}
+ a03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a06:	89 f0                	mov    %esi,%eax
+ a08:	5b                   	pop    %ebx
+ a09:	5e                   	pop    %esi
+ a0a:	5f                   	pop    %edi
+ a0b:	5d                   	pop    %ebp
+ a0c:	c3                   	ret
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((p = malloc(nbytes)) == 0)
+ a10:	83 ec 0c             	sub    $0xc,%esp
+ a13:	50                   	push   %eax
+ a14:	e8 77 fe ff ff       	call   890 <malloc>
+ a19:	83 c4 10             	add    $0x10,%esp
+ a1c:	89 c6                	mov    %eax,%esi
+ a1e:	85 c0                	test   %eax,%eax
+ a20:	74 e1                	je     a03 <realloc+0x23>
+  memmove(p, ap, have);
+ a22:	83 ec 04             	sub    $0x4,%esp
+ a25:	57                   	push   %edi
+ a26:	53                   	push   %ebx
+ a27:	50                   	push   %eax
+ a28:	e8 b3 f8 ff ff       	call   2e0 <memmove>
+  free(ap);
+ a2d:	89 1c 24             	mov    %ebx,(%esp)
+ a30:	e8 eb fd ff ff       	call   820 <free>
+  return p;
+ a35:	83 c4 10             	add    $0x10,%esp
+}
+ a38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a3b:	89 f0                	mov    %esi,%eax
+ a3d:	5b                   	pop    %ebx
+ a3e:	5e                   	pop    %esi
+ a3f:	5f                   	pop    %edi
+ a40:	5d                   	pop    %ebp
+ a41:	c3                   	ret
+ a42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return malloc(nbytes);
+ a48:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+ a4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a4e:	5b                   	pop    %ebx
+ a4f:	5e                   	pop    %esi
+ a50:	5f                   	pop    %edi
+ a51:	5d                   	pop    %ebp
+    return malloc(nbytes);
+ a52:	e9 39 fe ff ff       	jmp    890 <malloc>